@@ -0,0 +1,156 @@
+/*!
+\file	LRarena.c
+\brief	Arena (pool) allocation for LR_obj objects and their auxiliary tables
+
+Programs that create and destroy very many `LR_obj` objects (e.g.
+one per agent in an agent based model) can allocate them from an
+`LR_arena` arena instead of from the heap.  The arena hands out
+cache line aligned memory from large blocks, so creating an object
+with \c LR_new_in() costs no \c malloc() traffic, and all the objects
+(along with any auxiliary tables such as the \e piece segments)
+are released together with \c LR_arena_reset() or \c LR_arena_rm() .
+Calling \c LR_rm() on an arena object is allowed, but does not
+release any memory.
+
+\code
+#include "libran.h"
+...
+LR_arena *a = LR_arena_new(0);
+...
+for (i = 0; i < nagents; i++) {
+	agent[i].o = LR_new_in(a, nexp, LR_double);
+	LR_set(agent[i].o, 'm', 2.);
+	LR_lsetseed(agent[i].o, seed + i);
+}
+...
+// next run - drop all the objects at once and reuse the memory
+LR_arena_reset(a);
+...
+LR_arena_rm(&a);
+\endcode
+
+\see LRnew.c
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>	/* posix_memalign,free */
+#include <string.h>	/* memset */
+#include "libran.h"
+
+/* each block starts with a pointer to the next (older) block */
+#define LR_ARENA_HDR	LR_CACHELINE
+#define LR_ARENA_SIZE	65536
+
+/*!
+@brief	LR_arena_new(size_t size) - create a new arena
+
+@param	size	block size in bytes (0 for the default of 64KiB)
+@return	LR_arena *, or NULL if failed
+*/
+LR_arena *LR_arena_new(size_t size) {
+	LR_arena *ptr = (void *) NULL;
+
+	if (!(ptr = (LR_arena *) calloc(sizeof(LR_arena),1)))
+		return ptr;
+	ptr->size = (size ? size : LR_ARENA_SIZE);
+	ptr->blk = (void *) NULL;
+	ptr->used = ptr->cap = 0;
+	ptr->errno = 0;
+	return ptr;
+}
+
+/*!
+@brief	LR_arena_alloc(LR_arena *a, size_t n) - allocate zeroed memory
+from the arena
+
+The memory is aligned to `LR_CACHELINE` and is only released with the
+arena (see \c LR_arena_reset() and \c LR_arena_rm() ).
+
+@param	a	LR_arena pointer
+@param	n	number of bytes
+@return	void * pointer to memory, or NULL if failed
+*/
+void *LR_arena_alloc(LR_arena *a, size_t n) {
+	void	*ptr;
+	size_t	size;
+
+	/* keep every allocation on its own cache line(s) */
+	n = (n + LR_CACHELINE - 1) & ~((size_t) LR_CACHELINE - 1);
+	if (!a->blk || a->used + n > a->cap) {
+		size = a->size;
+		if (size < n + LR_ARENA_HDR)
+			size = n + LR_ARENA_HDR;
+		if (posix_memalign(&ptr, LR_CACHELINE, size)) {
+			a->errno = LRerr_AllocFail;
+			return (void *) NULL;
+		}
+		*((void **) ptr) = a->blk;
+		a->blk = ptr;
+		a->used = LR_ARENA_HDR;
+		a->cap = size;
+	}
+	ptr = (char *) a->blk + a->used;
+	a->used += n;
+	(void) memset(ptr, 0, n);
+	return ptr;
+}
+
+/*!
+@brief	LR_arena_reset(LR_arena *a) - release all the arena objects at once
+
+All objects and tables allocated from the arena become invalid.
+The most recent block is kept for reuse.
+
+@param	a	LR_arena pointer
+@return	0	if successful, non-zero if an error
+*/
+int LR_arena_reset(LR_arena *a) {
+	void	*blk, *next;
+
+	if (!a)
+		return LRerr_Unspecified;
+	if (a->blk) {
+		/* keep the current block, free the older ones */
+		blk = *((void **) a->blk);
+		while (blk) {
+			next = *((void **) blk);
+			free(blk);
+			blk = next;
+		}
+		*((void **) a->blk) = (void *) NULL;
+		a->used = LR_ARENA_HDR;
+	}
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_arena_rm(LR_arena **a) - destroy the arena and all its objects
+
+@param	a	Address of LR_arena pointer
+@return	0	if successful, non-zero if an error
+*/
+int LR_arena_rm(LR_arena **a) {
+	void	*blk, *next;
+
+	if (!a || !*a)
+		return LRerr_Unspecified;
+	blk = (*a)->blk;
+	while (blk) {
+		next = *((void **) blk);
+		free(blk);
+		blk = next;
+	}
+	free((void *) *a);
+	*a = (LR_arena *) NULL;
+	return LRerr_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,631 @@
+/*!
+\file	LRbattery.c
+\brief	A battery of quality tests for the uniform generators
+
+Everything LibRan produces is derived from the uniform generator of the
+`LR_obj` object (its \e ud or \e uf function), so before adopting a
+new one its quality and speed should be known.  These functions test
+it without any external test suite.
+
+Spectral test
+-------------
+
+\c LR_spectral() gives the spectral test (Knuth, vol. 2, 3.3.4) of a
+linear congruential generator \f$ x_{i+1} = (a x_i + c) \bmod m \f$ ,
+such as the urand parameters
+(see \c LR_igetval("LR_IA") and \c LR_lgetval("LR_LA") ).
+The increment \e c doesn't matter.
+In \e t dimensions the points \f$ (x_i, \ldots, x_{i+t-1}) \f$ lie on
+parallel hyperplanes \f$ 1/\nu_t \f$ apart, where \f$ \nu_t \f$ is the
+length of the shortest non-zero vector \e s with
+\f$ s_1 + s_2 a + \cdots + s_t a^{t-1} \equiv 0 \pmod m \f$ .
+It is found exactly by an LLL reduction of the lattice of such vectors and
+then an enumeration of the short vectors of the reduced basis.
+Also given is the normalized \f$ S_t = \nu_t / (\gamma_t^{1/2} m^{1/t})
+\f$ , where \f$ \gamma_t \f$ is the Hermite constant, which is 1 for the
+best possible lattice (values above about 0.6 are considered good).
+
+Statistical tests
+-----------------
+
+\c LR_battery_run() runs several replications of each of these tests,
+each on a stream (see \c LR_stream_new()) of an `LR_spec` object with
+a distinct seed, in several threads:
+
+Test     | Description
+-------- | -------------------------------------------------------------
+birthday | 8192 birthdays in \f$ 2^{36} \f$ days (from two uniforms), the number of repeated spacings is Poisson (Marsaglia)
+gap      | the gaps between values in [0,1/8) are geometric (Knuth)
+runs     | the lengths of ascending runs, discarding the value after each, are independent with \f$ P(r) = r/(r+1)! \f$ (Knuth)
+serial   | non-overlapping pairs in \f$ d \times d \f$ cells are uniform
+rank     | the rank of \f$ L \times L \f$ binary matrices from the leading \e L bits (32 for double, 24 for float)
+
+The uniforms are those from the object's \e ud function for LR_double
+objects, else from \e uf , so any generator can be tested by installing
+it there before creating the `LR_spec` object.  Each stream is seeded
+with \c LR_lsetseed() .
+The p-values of the replications are combined by Fisher's method
+(as for \c LR_gof_pks() ), a p-value below say \f$ 10^{-6} \f$ indicating a
+failure.  The throughput of the generator alone and of each test is
+reported with the results.
+
+\code
+#include <stdio.h>
+#include "libran.h"
+...
+LR_obj *o = LR_new(unif, LR_double);
+LR_battery b;
+LR_spec *s = LR_spec_new(&o);
+LR_battery_run(&b, s, 1l << 24, 8, 4, 12345l);
+printf("generator %.2f ns/uniform\n", b.ns);
+for (int i = 0; i < LR_BATTERY_TESTS; i++)
+	printf("%-10s p = %-10.3g %.3g uniforms/s\n",
+		LR_battery_name(i), b.p[i], b.rate[i]);
+...
+LR_spec_rm(&s);
+\endcode
+
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>	/* malloc,calloc,qsort,free */
+#include <math.h>	/* log(),sqrt(),pow() */
+#include <time.h>	/* clock_gettime() */
+#include <pthread.h>
+#include "libran.h"
+
+/* exact lattice arithmetic */
+#ifdef __SIZEOF_INT128__
+typedef __int128	LR_bat_int;
+#else
+typedef long double	LR_bat_int;
+#endif
+
+#define LR_BAT_BDAYS	8192	/* birthdays per sample */
+#define LR_BAT_BBITS	18	/* bits of each coordinate (2^36 days) */
+#define LR_BAT_GAPT	48	/* longest gap tallied separately */
+#define LR_BAT_RUNS	6	/* longest run tallied separately */
+#define LR_BAT_MINN	(1l << 16)	/* fewest uniforms for all the tests */
+#define LR_BAT_RATE	10000000l	/* most uniforms for the raw timing */
+
+static const char *LR_bat_names[LR_BATTERY_TESTS] = {
+	"birthday", "gap", "runs", "serial", "rank"
+};
+
+/* a generator */
+typedef double (*LR_bat_u)(LR_obj *o);
+static double LR_bat_uf(LR_obj *o) {
+	return (double) o->uf(o);
+}
+
+/* a b mod m without overflow */
+static unsigned long LR_bat_mulmod(unsigned long a, unsigned long b,
+	unsigned long m) {
+#ifdef __SIZEOF_INT128__
+	return (unsigned long) (((unsigned __int128) a * b) % m);
+#else
+	unsigned long	r = 0;
+
+	for (a %= m; b; b >>= 1) {
+		if (b & 1)
+			r = (r >= m - a ? r - (m - a) : r + a);
+		a = (a >= m - a ? a - (m - a) : a + a);
+	}
+	return r;
+#endif
+}
+
+static double LR_bat_now(void) {
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/* chi-square upper tail */
+static double LR_bat_qchi2(double x, double df) {
+	return LR_gammq(0.5 * df, 0.5 * x);
+}
+
+/* chi-square statistic of counts c with probabilities p */
+static double LR_bat_chi2(const long *c, const double *p, int k) {
+	double	nn = 0.0, x = 0.0, e;
+
+	for (int i = 0; i < k; i++)
+		nn += c[i];
+	for (int i = 0; i < k; i++) {
+		e = nn * p[i];
+		x += (c[i] - e) * (c[i] - e) / e;
+	}
+	return x;
+}
+
+/* for qsort() */
+static int LR_bat_cmp(const void *a, const void *b) {
+	unsigned long	x = *((const unsigned long *) a),
+			y = *((const unsigned long *) b);
+	return (x > y) - (x < y);
+}
+
+/* birthday spacings - two-sided Poisson p-value */
+static double LR_bat_birthday(LR_obj *o, LR_bat_u u, long n) {
+	unsigned long	*y;
+	double	sc = (double) (1ul << LR_BAT_BBITS), lam, lo, hi, p;
+	long	ns = n / (2 * LR_BAT_BDAYS), col = 0;
+
+	if (!(y = (unsigned long *) malloc(LR_BAT_BDAYS * sizeof(unsigned long))))
+		return NAN;
+	for (long k = 0; k < ns; k++) {
+		for (int i = 0; i < LR_BAT_BDAYS; i++) {
+			unsigned long a = (unsigned long) (u(o) * sc);
+			y[i] = (a << LR_BAT_BBITS) | (unsigned long) (u(o) * sc);
+		}
+		qsort(y, LR_BAT_BDAYS, sizeof(unsigned long), LR_bat_cmp);
+		for (int i = LR_BAT_BDAYS - 1; i > 0; i--)
+			y[i] -= y[i - 1];
+		qsort(y, LR_BAT_BDAYS, sizeof(unsigned long), LR_bat_cmp);
+		for (int i = 1; i < LR_BAT_BDAYS; i++)
+			col += (y[i] == y[i - 1]);
+	}
+	free((void *) y);
+	/* m^3/(4 d) per sample */
+	lam = ns * pow((double) LR_BAT_BDAYS, 3.0)
+		/ (4.0 * sc * sc);
+	lo = LR_gammq(col + 1.0, lam);			/* P(Y <= col) */
+	hi = (col ? 1.0 - LR_gammq((double) col, lam) : 1.0); /* P(Y >= col) */
+	p = 2.0 * (lo < hi ? lo : hi);
+	return (p > 1.0 ? 1.0 : p);
+}
+
+/* gap test for [0,1/8) */
+static double LR_bat_gap(LR_obj *o, LR_bat_u u, long n) {
+	double	beta = 0.125, p[LR_BAT_GAPT + 1], q = 1.0;
+	long	c[LR_BAT_GAPT + 1] = {0}, r = 0;
+
+	for (long i = 0; i < n; i++) {
+		if (u(o) < beta) {
+			c[r < LR_BAT_GAPT ? r : LR_BAT_GAPT]++;
+			r = 0;
+		} else {
+			r++;
+		}
+	}
+	for (int i = 0; i < LR_BAT_GAPT; i++) {
+		p[i] = beta * q;
+		q *= 1.0 - beta;
+	}
+	p[LR_BAT_GAPT] = q;
+	return LR_bat_qchi2(LR_bat_chi2(c, p, LR_BAT_GAPT + 1), LR_BAT_GAPT);
+}
+
+/* ascending runs, discarding the value after each */
+static double LR_bat_runs(LR_obj *o, LR_bat_u u, long n) {
+	double	p[LR_BAT_RUNS], f = 1.0, x, prev = u(o);
+	long	c[LR_BAT_RUNS] = {0}, len = 1;
+
+	for (long i = 1; i < n; i++) {
+		x = u(o);
+		if (x > prev) {
+			len++;
+			prev = x;
+		} else {
+			c[(len < LR_BAT_RUNS ? len : LR_BAT_RUNS) - 1]++;
+			prev = u(o);
+			i++;
+			len = 1;
+		}
+	}
+	/* P(r) = 1/r! - 1/(r+1)! , P(r >= R) = 1/R! */
+	for (int r = 1; r < LR_BAT_RUNS; r++) {
+		f /= r;
+		p[r - 1] = f - f / (r + 1);
+	}
+	p[LR_BAT_RUNS - 1] = f / LR_BAT_RUNS;
+	return LR_bat_qchi2(LR_bat_chi2(c, p, LR_BAT_RUNS), LR_BAT_RUNS - 1);
+}
+
+/* non-overlapping pairs in d x d cells, at least 10 per cell */
+static double LR_bat_serial(LR_obj *o, LR_bat_u u, long n) {
+	long	*c, np = n / 2;
+	double	x = 0.0, e;
+	int	k = 3, d;
+
+	while (k < 10 && 10l << (2 * (k + 1)) <= np)
+		k++;
+	d = 1 << k;
+	if (!(c = (long *) calloc((size_t) d * d, sizeof(long))))
+		return NAN;
+	for (long i = 0; i < np; i++) {
+		int a = (int) (u(o) * d);
+		c[a * d + (int) (u(o) * d)]++;
+	}
+	e = (double) np / ((double) d * d);
+	for (long i = 0; i < (long) d * d; i++)
+		x += (c[i] - e) * (c[i] - e);
+	free((void *) c);
+	return LR_bat_qchi2(x / e, (double) d * d - 1.0);
+}
+
+/* rank of L x L binary matrices */
+static double LR_bat_rank(LR_obj *o, LR_bat_u u, long n) {
+	int	L = (o->d == LR_double ? 32 : 24), r;
+	double	sc = ldexp(1.0, L), p[4], f;
+	long	c[4] = {0};
+	unsigned long row[32], piv, t;
+
+	for (long k = 0; k < n / L; k++) {
+		for (int i = 0; i < L; i++)
+			row[i] = (unsigned long) (u(o) * sc);
+		/* Gaussian elimination over GF(2) */
+		r = 0;
+		for (int b = L - 1; b >= 0 && r < L; b--) {
+			piv = 1ul << b;
+			for (int i = r; i < L; i++) {
+				if (row[i] & piv) {
+					t = row[i];
+					row[i] = row[r];
+					row[r] = t;
+					for (int j = r + 1; j < L; j++)
+						if (row[j] & piv)
+							row[j] ^= t;
+					r++;
+					break;
+				}
+			}
+		}
+		c[(L - r < 3 ? L - r : 3)]++;
+	}
+	/* P(rank r) = 2^(r(2L-r)-L^2) prod_{i<r} (1-2^(i-L))^2/(1-2^(i-r)) */
+	p[3] = 1.0;
+	for (int k = 0; k < 3; k++) {
+		r = L - k;
+		f = ldexp(1.0, r * (2 * L - r) - L * L);
+		for (int i = 0; i < r; i++)
+			f *= (1.0 - ldexp(1.0, i - L)) * (1.0 - ldexp(1.0, i - L))
+				/ (1.0 - ldexp(1.0, i - r));
+		p[k] = f;
+		p[3] -= f;
+	}
+	return LR_bat_qchi2(LR_bat_chi2(c, p, 4), 3.0);
+}
+
+typedef double (*LR_bat_test)(LR_obj *o, LR_bat_u u, long n);
+static LR_bat_test LR_bat_tests[LR_BATTERY_TESTS] = {
+	LR_bat_birthday, LR_bat_gap, LR_bat_runs, LR_bat_serial, LR_bat_rank
+};
+
+/*!
+@brief	LR_battery_name(int i) - the name of a test
+
+@param	i	test number [0,LR_BATTERY_TESTS)
+@return	name, or NULL if no such test
+*/
+const char *LR_battery_name(int i) {
+	if (i < 0 || i >= LR_BATTERY_TESTS)
+		return (const char *) NULL;
+	return LR_bat_names[i];
+}
+
+/* the work shared by the threads */
+typedef struct {
+	LR_spec	*s;
+	long	n;
+	long	seed;
+	int	ntask;
+	int	next;		/* next task to do */
+	int	ret;
+	double	*p;		/* p-value of each task */
+	double	*secs;		/* time of each task */
+} LR_bat_pool;
+
+static void *LR_bat_work(void *arg) {
+	LR_bat_pool *a = (LR_bat_pool *) arg;
+	LR_obj	*o;
+	double	t;
+	int	k;
+
+	while ((k = __atomic_fetch_add(&(a->next), 1, __ATOMIC_RELAXED))
+	< a->ntask) {
+		if (!(o = LR_stream_new(a->s))) {
+			__atomic_store_n(&(a->ret), LRerr_AllocFail,
+				__ATOMIC_RELAXED);
+			continue;
+		}
+		LR_lsetseed(o, a->seed + 2l * k);
+		t = LR_bat_now();
+		a->p[k] = LR_bat_tests[k % LR_BATTERY_TESTS](o,
+			(o->d == LR_double ? o->ud : LR_bat_uf), a->n);
+		a->secs[k] = LR_bat_now() - t;
+		(void) LR_rm(&o);
+	}
+	return NULL;
+}
+
+/*!
+@brief	LR_battery_run(LR_battery *b, LR_spec *s, long n, int reps,
+int nthreads, long seed) - run the statistical tests
+
+Runs \e reps replications of each test using \e n uniforms each
+in \e nthreads threads, and stores the combined p-values, the
+throughput of each test (uniforms per second in one thread), and the
+throughput of the generator alone in \e b .
+The task \e k (replication \e k / \c LR_BATTERY_TESTS of test
+\e k % \c LR_BATTERY_TESTS) uses a stream seeded with
+\e seed + 2 \e k , so the results don't depend on the number of threads.
+
+@param	b	LR_battery object for the results
+@param	s	LR_spec object with the generator to test
+@param	n	uniforms for each test (at least 65536)
+@param	reps	replications of each test (at least 1)
+@param	nthreads	number of threads (at least 1)
+@param	seed	seed of the first task
+@return	0 if successful, else non-zero if failed
+*/
+int LR_battery_run(LR_battery *b, LR_spec *s, long n, int reps,
+	int nthreads, long seed) {
+	LR_bat_pool	a;
+	pthread_t	*th = (pthread_t *) NULL;
+	LR_obj		*o;
+	LR_bat_u	u;
+	double		t, sum = 0.0, x;
+	long		nr;
+	int		started = 0;
+
+	if (!b)
+		return LRerr_Unspecified;
+	b->n = n;
+	b->reps = reps;
+	b->nthreads = nthreads;
+	b->errno = LRerr_OK;
+	b->ns = NAN;
+	for (int i = 0; i < LR_BATTERY_TESTS; i++)
+		b->p[i] = b->rate[i] = NAN;
+	if (!s || n < LR_BAT_MINN || reps < 1 || nthreads < 1)
+		return b->errno = LRerr_InvalidInputValue;
+	t = LR_bat_now();
+
+	/* the generator alone */
+	if (!(o = LR_stream_new(s)))
+		return b->errno = LRerr_AllocFail;
+	LR_lsetseed(o, seed);
+	u = (o->d == LR_double ? o->ud : LR_bat_uf);
+	nr = (n < LR_BAT_RATE ? n : LR_BAT_RATE);
+	x = LR_bat_now();
+	for (long i = 0; i < nr; i++)
+		sum += u(o);
+	b->ns = 1e9 * (LR_bat_now() - x) / nr;
+	(void) LR_rm(&o);
+	if (isnan(sum))
+		return b->errno = LRerr_SuspiciousValues;
+
+	a.s = s;
+	a.n = n;
+	a.seed = seed;
+	a.ntask = reps * LR_BATTERY_TESTS;
+	a.next = 0;
+	a.ret = LRerr_OK;
+	a.p = (double *) malloc(2 * a.ntask * sizeof(double));
+	a.secs = a.p + a.ntask;
+	th = (pthread_t *) malloc(nthreads * sizeof(pthread_t));
+	if (!a.p || !th) {
+		b->errno = LRerr_AllocFail;
+		goto done;
+	}
+	for (started = 0; started < nthreads; started++)
+		if (pthread_create(&th[started], NULL, LR_bat_work, &a))
+			break;
+	/* if none could be started do the work here */
+	if (!started)
+		(void) LR_bat_work(&a);
+	for (int i = 0; i < started; i++)
+		(void) pthread_join(th[i], NULL);
+	if (a.ret) {
+		b->errno = a.ret;
+		goto done;
+	}
+
+	/* combine the replications */
+	for (int i = 0; i < LR_BATTERY_TESTS; i++) {
+		double	f = 0.0, ts = 0.0;
+		for (int r = 0; r < reps; r++) {
+			f -= 2.0 * log(a.p[r * LR_BATTERY_TESTS + i]);
+			ts += a.secs[r * LR_BATTERY_TESTS + i];
+		}
+		b->p[i] = (reps == 1 ? a.p[i] : LR_bat_qchi2(f, 2.0 * reps));
+		b->rate[i] = (double) n * reps / ts;
+	}
+
+done:
+	b->secs = LR_bat_now() - t;
+	free((void *) th);
+	free((void *) a.p);
+	return b->errno;
+}
+
+/* the Gram-Schmidt orthogonalization of the basis */
+static void LR_spect_gs(int k, LR_bat_int b[][LR_SPECTRAL_MAX],
+	long double mu[][LR_SPECTRAL_MAX], long double *B) {
+	long double	bs[LR_SPECTRAL_MAX][LR_SPECTRAL_MAX], d;
+
+	for (int i = 0; i < k; i++) {
+		for (int l = 0; l < k; l++)
+			bs[i][l] = (long double) b[i][l];
+		for (int j = 0; j < i; j++) {
+			d = 0.0L;
+			for (int l = 0; l < k; l++)
+				d += (long double) b[i][l] * bs[j][l];
+			mu[i][j] = d / B[j];
+			for (int l = 0; l < k; l++)
+				bs[i][l] -= mu[i][j] * bs[j][l];
+		}
+		B[i] = 0.0L;
+		for (int l = 0; l < k; l++)
+			B[i] += bs[i][l] * bs[i][l];
+	}
+}
+
+/* LLL reduction (delta = 0.99) */
+static int LR_spect_lll(int k, LR_bat_int b[][LR_SPECTRAL_MAX],
+	long double mu[][LR_SPECTRAL_MAX], long double *B) {
+	LR_bat_int	q, t;
+	int		i = 1;
+
+	LR_spect_gs(k, b, mu, B);
+	for (long iter = 0; i < k; iter++) {
+		if (iter > 1000000l)
+			return LRerr_Unspecified;
+		for (int j = i - 1; j >= 0; j--) {
+			if (fabsl(mu[i][j]) > 0.5L) {
+				q = (LR_bat_int) roundl(mu[i][j]);
+				for (int l = 0; l < k; l++)
+					b[i][l] -= q * b[j][l];
+				LR_spect_gs(k, b, mu, B);
+			}
+		}
+		if (B[i] >= (0.99L - mu[i][i - 1] * mu[i][i - 1]) * B[i - 1]) {
+			i++;
+		} else {
+			for (int l = 0; l < k; l++) {
+				t = b[i][l];
+				b[i][l] = b[i - 1][l];
+				b[i - 1][l] = t;
+			}
+			LR_spect_gs(k, b, mu, B);
+			i = (i > 1 ? i - 1 : 1);
+		}
+	}
+	return LRerr_OK;
+}
+
+/* shortest vector enumeration */
+typedef struct {
+	int		k;
+	LR_bat_int	(*b)[LR_SPECTRAL_MAX];
+	long double	(*mu)[LR_SPECTRAL_MAX];
+	long double	*B;
+	long double	r2;	/* search radius squared */
+	LR_bat_int	best;	/* shortest length squared */
+	long double	x[LR_SPECTRAL_MAX];
+} LR_spect_enum;
+
+static void LR_spect_search(LR_spect_enum *e, int i, long double part) {
+	long double	c = 0.0L, r, d, pp;
+	LR_bat_int	v, n2;
+	int		nz;
+
+	for (int j = i + 1; j < e->k; j++)
+		c -= e->x[j] * e->mu[j][i];
+	r = sqrtl((e->r2 - part) / e->B[i]);
+	for (long double xi = ceill(c - r); xi <= floorl(c + r); xi++) {
+		d = xi - c;
+		pp = part + d * d * e->B[i];
+		if (pp > e->r2)
+			continue;
+		e->x[i] = xi;
+		if (i) {
+			LR_spect_search(e, i - 1, pp);
+			continue;
+		}
+		/* the exact length */
+		nz = 0;
+		for (int j = 0; j < e->k; j++)
+			nz |= (e->x[j] != 0.0L);
+		if (!nz)
+			continue;
+		n2 = 0;
+		for (int l = 0; l < e->k; l++) {
+			v = 0;
+			for (int j = 0; j < e->k; j++)
+				v += (LR_bat_int) e->x[j] * e->b[j][l];
+			n2 += v * v;
+		}
+		if (n2 < e->best) {
+			e->best = n2;
+			e->r2 = (long double) n2 * (1.0L + 1e-9L);
+		}
+	}
+	e->x[i] = 0.0L;
+}
+
+/*!
+@brief	LR_spectral(unsigned long a, unsigned long m, int t, double *nu,
+double *st) - spectral test of a linear congruential generator
+
+Finds \f$ \nu_k \f$ and the normalized \f$ S_k \f$ for the dimensions
+\e k = 2 to \e t of the generator with multiplier \e a and modulus \e m .
+By convention \f$ \nu_1 = m \f$ and \f$ S_1 = 1 \f$ .
+For the urand generators the modulus is
+2 \c LR_lgetval("LR_IRAND_LMAX2") (or 2 \c LR_igetval("LR_IRAND_IMAX2") ).
+
+@param	a	multiplier
+@param	m	modulus (at most \f$ 2^{63} \f$ )
+@param	t	largest dimension [2,LR_SPECTRAL_MAX]
+@param	nu	array (t+1) for \f$ \nu_k \f$ (index 0 unused)
+@param	st	array (t+1) for \f$ S_k \f$ (if not NULL)
+@return	0 if successful, else non-zero if failed
+*/
+int LR_spectral(unsigned long a, unsigned long m, int t, double *nu,
+	double *st) {
+	/* Hermite constants gamma_k^k */
+	static const double	gk[LR_SPECTRAL_MAX + 1] = {
+		1.0, 1.0, 4.0/3.0, 2.0, 4.0, 8.0, 64.0/3.0, 64.0, 256.0
+	};
+	LR_bat_int	b[LR_SPECTRAL_MAX][LR_SPECTRAL_MAX];
+	long double	mu[LR_SPECTRAL_MAX][LR_SPECTRAL_MAX],
+			B[LR_SPECTRAL_MAX];
+	LR_spect_enum	e;
+	unsigned long	ak;
+
+	if (!nu || t < 2 || t > LR_SPECTRAL_MAX || m < 2
+	|| m > (1ul << 63) || a % m == 0)
+		return LRerr_InvalidInputValue;
+	nu[0] = NAN;
+	nu[1] = (double) m;
+	if (st) {
+		st[0] = NAN;
+		st[1] = 1.0;
+	}
+	for (int k = 2; k <= t; k++) {
+		/* the basis (m,0,..), (-a^(i) mod m,..,1,..) */
+		ak = 1;
+		for (int i = 0; i < k; i++) {
+			for (int l = 0; l < k; l++)
+				b[i][l] = 0;
+			if (!i) {
+				b[0][0] = (LR_bat_int) m;
+			} else {
+				ak = LR_bat_mulmod(ak, a, m);
+				b[i][0] = -(LR_bat_int) ak;
+				b[i][i] = 1;
+			}
+		}
+		if (LR_spect_lll(k, b, mu, B))
+			return LRerr_Unspecified;
+		e.k = k;
+		e.b = b;
+		e.mu = mu;
+		e.B = B;
+		e.best = 0;
+		for (int l = 0; l < k; l++)
+			e.best += b[0][l] * b[0][l];
+		e.r2 = (long double) e.best * (1.0L + 1e-9L);
+		for (int j = 0; j < k; j++)
+			e.x[j] = 0.0L;
+		LR_spect_search(&e, k - 1, 0.0L);
+		nu[k] = (double) sqrtl((long double) e.best);
+		if (st)
+			st[k] = nu[k] / (pow(gk[k], 0.5 / k)
+				* pow((double) m, 1.0 / k));
+	}
+	return LRerr_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -23,6 +23,28 @@ If you define \e n-1 boundaries then there are \e n bins.
 The order the boundaries are set is not important.  The method orders
 the boundaries internally.
 
+Bins of equal width can be made at once with \c LR_bin_new_uniform() ,
+in which case the bin for each sample is computed directly.
+Otherwise the boundaries are binary searched.
+
+Setting many boundaries one at a time with \c LR_bin_set() is slow
+(each is inserted in order), so there are also constructors that
+size the object and fill in all the boundaries at once:
+- \c LR_bin_new_array() - from an array of boundaries
+- \c LR_bin_new_log() - logarithmically spaced boundaries
+- \c LR_bin_new_geom() - bin widths growing geometrically
+- \c LR_bin_new_quantile() - bins of equal probability for a
+  given `LR_obj` distribution
+.
+
+For importance sampling and the like each sample can carry a weight.
+Once \c LR_bin_weighted() is called the samples are tallied with
+\c LR_bin_addw() or \c LR_bin_addw_n() , and the bins keep the sum of
+the weights and of the squared weights, besides the count.
+Then the weighted bin content, its variance, and the effective sample
+size are given by \c LR_bin_sumw() , \c LR_bin_var() , and
+\c LR_bin_ess() .
+
 The following is some example code fragments for defining the bins, tallying
 the samples, and viewing the results.
 
@@ -63,9 +85,12 @@ LR_bin_rm(&b);
 extern "C" {
 #endif
 
-#include <stdlib.h>
-#include <math.h>	/* isnan() */
+#include <stdlib.h>	/* malloc,calloc,qsort,free */
+#include <string.h>	/* memcpy,memcmp */
+#include <limits.h>	/* INT_MIN,INT_MAX */
+#include <math.h>	/* isnan(),log(),exp() */
 #include "libran.h"
+#include "urand/config.h"	/* LR_DEPS, LR_FEPS */
 
 /*!
 @brief	LR_bin_new(LR_data_type d, int n) - create new binning object
@@ -86,7 +111,11 @@ LR_bin *LR_bin_new(int n) {
 	ptr->n  = n;
 	ptr->nn = 1;	/* always start with one bin */
 	ptr->c  = 0;
+	ptr->lo = 0.0;
+	ptr->w1 = 0.0;
+	ptr->flags = 0;
 	ptr->errno = 0;
+	ptr->sw = ptr->sw2 = ptr->cw = (double *) NULL;
 
 	if (!(ptr->bdrs = (double *) calloc(n, sizeof(double))))
 		goto bad0;
@@ -104,6 +133,317 @@ bad0:
 	return (void *) NULL;
 }
 
+/*!
+@brief	LR_bin_new_uniform(int n, double lo, double hi) - create new
+binning object with equal width bins
+
+This routine creates a new `LR_bin` object with \e n bins of equal width
+on the interval [lo,hi) plus the bins below and above, so there are
+\e n + 2 bins and \e n + 1 boundaries in all.  The bin for a value is then
+computed directly rather than searched for.  No other boundaries can be set.
+
+@param	n	number of bins within [lo,hi)
+@param	lo	lowest boundary
+@param	hi	highest boundary
+@return	LR_bin object if successful, else NULL
+*/
+LR_bin *LR_bin_new_uniform(int n, double lo, double hi) {
+	LR_bin *ptr = (void *) NULL;
+	double	w;
+
+	if (n < 1 || !(lo < hi))
+		return ptr;
+	if (!(ptr = LR_bin_new(n + 2)))
+		return ptr;
+	w = (hi - lo) / n;
+	for (int i = 0; i < n; i++)
+		ptr->bdrs[i] = lo + i * w;
+	ptr->bdrs[n] = hi;
+	ptr->nn = n + 2;
+	ptr->lo = lo;
+	ptr->w1 = n / (hi - lo);
+
+	return ptr;
+}
+
+/* for qsort() */
+static int LR_bin_cmp(const void *a, const void *b) {
+	double	x = *((const double *) a), y = *((const double *) b);
+	return (x > y) - (x < y);
+}
+
+/*!
+@brief	LR_bin_new_array(const double *x, int m) - create new binning object
+from an array of boundaries
+
+This routine creates a new `LR_bin` object with the \e m boundaries
+given in \e x , hence \e m + 1 bins.  The boundaries are copied in one pass
+if already in non-decreasing order, else they are sorted.
+Repeated boundaries are allowed (the bins between are always empty).
+
+@param	x	array of bin boundaries
+@param	m	number of boundaries
+@return	LR_bin object if successful, else NULL
+*/
+LR_bin *LR_bin_new_array(const double *x, int m) {
+	LR_bin *ptr = (void *) NULL;
+	int	sorted = 1;
+
+	if (m < 0 || (m && !x))
+		return ptr;
+	for (int i = 0; i < m; i++) {
+		if (isnan(x[i]))
+			return ptr;
+		if (i && x[i] < x[i-1])
+			sorted = 0;
+	}
+	if (!(ptr = LR_bin_new(m + 1)))
+		return ptr;
+	if (m)
+		(void) memcpy(ptr->bdrs, x, m * sizeof(double));
+	if (!sorted)
+		qsort(ptr->bdrs, m, sizeof(double), LR_bin_cmp);
+	ptr->nn = m + 1;
+
+	return ptr;
+}
+
+/*!
+@brief	LR_bin_new_log(int n, double lo, double hi) - create new
+binning object with logarithmically spaced boundaries
+
+This routine creates a new `LR_bin` object with \e n bins on the
+interval [lo,hi) of equal width in \f$ \log x \f$ , i.e. the boundaries
+are \f$ lo (hi/lo)^{i/n} \f$ , plus the bins below and above.
+So there are \e n + 2 bins and \e n + 1 boundaries in all.
+
+@param	n	number of bins within [lo,hi)
+@param	lo	lowest boundary (> 0)
+@param	hi	highest boundary
+@return	LR_bin object if successful, else NULL
+*/
+LR_bin *LR_bin_new_log(int n, double lo, double hi) {
+	LR_bin *ptr = (void *) NULL;
+	double	zero = 0.0, l0, dl;
+
+	if (n < 1 || !(zero < lo && lo < hi) || isinf(hi))
+		return ptr;
+	if (!(ptr = LR_bin_new(n + 2)))
+		return ptr;
+	l0 = log(lo);
+	dl = (log(hi) - l0) / n;
+	ptr->bdrs[0] = lo;
+	for (int i = 1; i < n; i++)
+		ptr->bdrs[i] = exp(l0 + i * dl);
+	ptr->bdrs[n] = hi;
+	ptr->nn = n + 2;
+
+	return ptr;
+}
+
+/*!
+@brief	LR_bin_new_geom(int n, double lo, double w, double r) - create new
+binning object with geometrically growing bin widths
+
+This routine creates a new `LR_bin` object with \e n bins starting
+at \e lo where the first bin has width \e w and each following bin
+is \e r times wider than the one before, i.e. the boundaries are
+\f$ lo + w (r^i - 1)/(r - 1) \f$ , plus the bins below and above.
+So there are \e n + 2 bins and \e n + 1 boundaries in all.
+If \e r is 1 this is the same as \c LR_bin_new_uniform() .
+
+@param	n	number of bins
+@param	lo	lowest boundary
+@param	w	width of the first bin (> 0)
+@param	r	ratio of each bin width to the one before (> 0)
+@return	LR_bin object if successful, else NULL
+*/
+LR_bin *LR_bin_new_geom(int n, double lo, double w, double r) {
+	LR_bin *ptr = (void *) NULL;
+	double	zero = 0.0, one = 1.0, x;
+
+	if (n < 1 || !(w > zero) || !(r > zero) || isinf(lo))
+		return ptr;
+	if (r == one)
+		return LR_bin_new_uniform(n, lo, lo + n * w);
+	if (!(ptr = LR_bin_new(n + 2)))
+		return ptr;
+	ptr->bdrs[0] = x = lo;
+	for (int i = 1; i <= n; i++, w *= r)
+		ptr->bdrs[i] = x += w;
+	if (isinf(x) || !(x > ptr->bdrs[n-1])) {
+		/* overflowed, or the widths underflowed to nothing */
+		LR_bin_rm(&ptr);
+		return ptr;
+	}
+	ptr->nn = n + 2;
+
+	return ptr;
+}
+
+/* the CDF of o at x for any data type */
+static double LR_bin_cdf(LR_obj *o, double x) {
+	if (o->d == LR_double)
+		return o->ops->cdfd(o, x);
+	else if (o->d == LR_float)
+		return (double) o->ops->cdff(o, (float) x);
+	return (double) o->ops->cdfi(o, (int) x);
+}
+
+/* find x such that CDF(x) = p for a continuous distribution, starting
+ * from the guess x (which must be finite) and search step h > 0.
+ * First bracket the solution, then close in by the Illinois variant
+ * of the false position method falling back on bisection if the
+ * bracket doesn't shrink fast enough.
+ * The result is to within the relative precision or that relative
+ * to the step h.  Returns NAN if the CDF misbehaves. */
+static double LR_bin_qcont(LR_obj *o, double p, double x, double h) {
+	double	half = 0.5, two = 2.0, eps, tol,
+		a, b, fa, fb, c, fc, w;
+	int	side = 0, i;
+
+	eps = (o->d == LR_float ? LR_FEPS : LR_DEPS);
+	tol = eps * h;
+	fa = fb = LR_bin_cdf(o, x) - p;
+	if (isnan(fa))
+		return NAN;
+	a = b = x;
+	/* bracket [a,b] where F(a) < p <= F(b) */
+	for (i = 0; fa >= 0.0 && i < 2100; i++, h *= two) {
+		b = a; fb = fa;
+		a = x - h;
+		if (isinf(a) || isnan(fa = LR_bin_cdf(o, a) - p))
+			return NAN;
+	}
+	for (i = 0; fb < 0.0 && i < 2100; i++, h *= two) {
+		a = b; fa = fb;
+		b = x + h;
+		if (isinf(b) || isnan(fb = LR_bin_cdf(o, b) - p))
+			return NAN;
+	}
+	if (fa >= 0.0 || fb < 0.0)
+		return NAN;
+
+	/* shrink the bracket */
+	for (i = 0; i < 200; i++) {
+		w = b - a;
+		if (w <= eps * (fabs(a) > fabs(b) ? fabs(a) : fabs(b))
+		||  w <= tol)
+			break;
+		if (fb == 0.0 || fb - fa <= 0.0 || i % 4 == 3) {
+			/* bisect */
+			c = a + half * w;
+		} else {
+			c = a - fa * w / (fb - fa);
+			/* keep away from the ends */
+			if (!(c > a) || !(c < b))
+				c = a + half * w;
+		}
+		if (isnan(fc = LR_bin_cdf(o, c) - p))
+			return NAN;
+		if (fc < 0.0) {
+			a = c; fa = fc;
+			if (side == -1)	/* Illinois - stale end, halve it */
+				fb *= half;
+			side = -1;
+		} else {
+			b = c; fb = fc;
+			if (side == 1)
+				fa *= half;
+			side = 1;
+		}
+	}
+	return b;
+}
+
+/* find the smallest integer k such that CDF(k) >= p for a discrete
+ * distribution, starting from the guess k */
+static int LR_bin_qdisc(LR_obj *o, double p, int k) {
+	long	a = k, b = k, c, h = 1;
+
+	/* bracket (a,b] where CDF(a) < p <= CDF(b) */
+	if (LR_bin_cdf(o, k) >= p) {
+		for (a = b - h; a > INT_MIN && LR_bin_cdf(o, a) >= p; h *= 2) {
+			b = a;
+			a = (b - INT_MIN > 2*h ? b - 2*h : INT_MIN);
+		}
+	} else {
+		for (b = a + h; b < INT_MAX && LR_bin_cdf(o, b) < p; h *= 2) {
+			a = b;
+			b = (INT_MAX - a > 2*h ? a + 2*h : INT_MAX);
+		}
+	}
+	while (b - a > 1) {
+		c = a + (b - a) / 2;
+		if (LR_bin_cdf(o, c) >= p)
+			b = c;
+		else
+			a = c;
+	}
+	return (int) b;
+}
+
+/*!
+@brief	LR_bin_new_quantile(LR_obj *o, int n) - create new binning object
+with bins of equal probability
+
+This routine creates a new `LR_bin` object with \e n bins each with
+probability \e 1/n for the distribution given by the `LR_obj` object \e o ,
+i.e. the \e n - 1 boundaries are the quantiles
+\f$ x_i = F^{-1}(i/n) \f$ found numerically from its CDF \f$ F(x) \f$ .
+(The lowest and highest bins extend to \f$ -\infty \f$ and
+\f$ \infty \f$ .)  Each quantile is searched for from the one before,
+so even many bins are quick to set up.
+
+For a discrete distribution each boundary is placed halfway above the
+integer quantile (the smallest \e k such that \f$ F(k) \ge i/n \f$ ),
+found from the type's own QUANT where it has one and then checked
+against the CDF, so the bins can't all have equal probability, and some
+boundaries may be repeated (those bins are always empty).
+
+@param	o	LR_obj object
+@param	n	number of bins
+@return	LR_bin object if successful, else NULL
+	(and \e o->errno is set if the CDF fails)
+*/
+LR_bin *LR_bin_new_quantile(LR_obj *o, int n) {
+	LR_bin *ptr = (void *) NULL;
+	double	zero = 0.0, half = 0.5, one = 1.0, x = zero, h = one, p;
+	int	k = 0;
+
+	if (!o || n < 1)
+		return ptr;
+	if (LR_check(o))
+		return ptr;
+	if (!(ptr = LR_bin_new(n)))
+		return ptr;
+	for (int i = 1; i < n; i++) {
+		p = (double) i / n;
+		if (o->d == LR_int) {
+			/* start from the type's own quantile */
+			if (o->ops->qni)
+				k = o->ops->qni(o, (float) p);
+			k = LR_bin_qdisc(o, p, k);
+			ptr->bdrs[i-1] = k + half;
+			continue;
+		}
+		x = LR_bin_qcont(o, p, x, h);
+		if (isnan(x)) {
+			if (!o->errno)
+				o->errno = LRerr_InvalidCDF;
+			LR_bin_rm(&ptr);
+			return ptr;
+		}
+		ptr->bdrs[i-1] = x;
+		/* step for the next, the last spacing (if any) */
+		if (i > 1 && x > ptr->bdrs[i-2])
+			h = x - ptr->bdrs[i-2];
+	}
+	ptr->nn = n;
+
+	return ptr;
+}
+
 /*!
 @brief	LR_bin_rm(LR_bin **b) - remove binning object
 
@@ -115,6 +455,7 @@ called to deallocate the memory to avoid memory leaks.
 */
 int LR_bin_rm(LR_bin **b) {
 	if (b && *b) {
+		free((void *) (*b)->sw);
 		free((void *) (*b)->bins);
 		free((void *) (*b)->bdrs);
 		free((void *) *b);
@@ -165,37 +506,480 @@ int LR_bin_set(LR_bin *b, double x) {
 	return LRerr_OK;
 }
 
+/* set the errno - atomically if the bins are shared */
+static inline int LR_bin_err(LR_bin *b, int err) {
+	if (b->flags & LR_BIN_ATOMIC)
+		__atomic_store_n(&(b->errno), err, __ATOMIC_RELAXED);
+	else
+		b->errno = err;
+	return err;
+}
+
+/* add n to bins[i] and c - atomically if the bins are shared */
+static inline void LR_bin_tally(LR_bin *b, int i, long n) {
+	if (b->flags & LR_BIN_ATOMIC)
+		(void) __atomic_fetch_add(&(b->bins[i]), n, __ATOMIC_RELAXED);
+	else
+		b->bins[i] += n;
+}
+
+/* compensated (Kahan-Neumaier) summation s + c += x */
+static inline void LR_bin_ksum(double *s, double *c, double x) {
+	double	t = *s + x;
+	*c += (fabs(*s) >= fabs(x) ? (*s - t) + x : (x - t) + *s);
+	*s = t;
+}
+
+/* add the weight w to bin i */
+static inline void LR_bin_wtally(LR_bin *b, int i, double w) {
+	LR_bin_ksum(b->sw + i, b->cw + i, w);
+	LR_bin_ksum(b->sw2 + i, b->cw + b->n + i, w * w);
+}
+
+/* find the bin for x - the number of boundaries <= x */
+static inline int LR_bin_index(const LR_bin *b, double x) {
+	const double	*base = b->bdrs;
+	int		i, len = b->nn - 1;
+
+	if (b->w1 != 0.0) {
+		/* uniform bins - compute the bin, clamped to [lo,hi) ... */
+		double	t = (x - b->lo) * b->w1;
+		i = (t < 0.0 ? 0 : (t >= len - 1 ? len - 2 : (int) t)) + 1;
+		/* ... and correct for any roundoff at the boundaries */
+		i -= (x < b->bdrs[i - 1]);
+		i += (x >= b->bdrs[i]);
+		return i;
+	}
+	if (len <= 0)
+		return 0;
+	/* branchless binary search (keeps the loop free of data
+	 * dependent branches, the compare becomes a conditional move) */
+	while (len > 1) {
+		int half = len >> 1;
+		base += (base[half - 1] <= x) ? half : 0;
+		len -= half;
+	}
+	return (base - b->bdrs) + (*base <= x);
+}
+
 /*!
 @brief	LR_bin_add(LR_bin *b, double x) - collect value to be binned.
 
 This is *the* tallying routine, where the value \e x is compared to the
 boundary values and the appropriate bin array element tally is incremented.
+The bin is found by a binary search of the boundaries, or is computed
+directly for equal width bins (see \c LR_bin_new_uniform()).
 
 @param	b	LR_bin object
 @param	x	value to count within the given bin.
 @return	0 if successful, else non-zero if failed
 */
 int LR_bin_add(LR_bin *b, double x) {
-	int i = 0;
+	int i;
 
 	if (isnan(x))			
-		return	b->errno = LRerr_InvalidInputValue;
+		return	LR_bin_err(b, LRerr_InvalidInputValue);
 
-	while (i <= b->nn - 1) {
-		if (x < b->bdrs[i]
-		||  i == b->nn - 1) {
-			b->bins[i]++;
-			break;
+	i = LR_bin_index(b, x);
+	if (i >= b->nn)
+		return	LR_bin_err(b, LRerr_InvalidRange);
+	if (b->flags & LR_BIN_ATOMIC) {
+		(void) __atomic_fetch_add(&(b->bins[i]), 1, __ATOMIC_RELAXED);
+		(void) __atomic_fetch_add(&(b->c), 1, __ATOMIC_RELAXED);
+	} else {
+		b->bins[i]++;
+		b->c++;
+		if (b->flags & LR_BIN_WEIGHTED)
+			LR_bin_wtally(b, i, 1.0);
+	}
+
+	return LRerr_OK;
+}
+
+/* number of values binned at a time, and of private sub-histograms */
+#define LR_BIN_CHUNK	256
+#define LR_BIN_NSUB	4
+
+/* find the bins for a chunk of values - NaNs get the bin b->nn
+ * Each pass is a simple loop over the chunk without data dependent
+ * branches, so the compiler can vectorize the index computation. */
+static void LR_bin_index_n(const LR_bin *b, const double *x, int *idx,
+	size_t m) {
+	const double	*bd = b->bdrs;
+	int		len = b->nn - 1, nan = b->nn;
+	size_t		j;
+
+	if (b->w1 != 0.0) {
+		/* uniform bins - compute the bin, clamped to [lo,hi) ... */
+		double	lo = b->lo, w1 = b->w1, top = len - 2, t;
+		for (j = 0; j < m; j++) {
+			t = (x[j] - lo) * w1;
+			t = (t < 0.0 ? 0.0 : t);
+			t = (t > top ? top : t);
+			t = (x[j] == x[j] ? t : 0.0);
+			idx[j] = ((int) t) + 1;
+		}
+		/* ... and correct for any roundoff at the boundaries */
+		for (j = 0; j < m; j++) {
+			int i = idx[j];
+			i -= (x[j] < bd[i - 1]);
+			i += (x[j] >= bd[i]);
+			idx[j] = (x[j] == x[j] ? i : nan);
+		}
+	} else if (len <= 0) {
+		for (j = 0; j < m; j++)
+			idx[j] = (x[j] == x[j] ? 0 : nan);
+	} else {
+		/* branchless binary search, one level at a time for all */
+		for (j = 0; j < m; j++)
+			idx[j] = 0;
+		for (int l = len, half; l > 1; l -= half) {
+			half = l >> 1;
+			for (j = 0; j < m; j++)
+				idx[j] += (bd[idx[j] + half - 1] <= x[j] ? half : 0);
 		}
-		i++;
+		for (j = 0; j < m; j++)
+			idx[j] = (x[j] == x[j] ? idx[j] + (bd[idx[j]] <= x[j]) : nan);
+	}
+}
+
+/*!
+@brief	LR_bin_add_n(LR_bin *b, const double *x, size_t n) - collect
+an array of values to be binned.
+
+This is the batch version of \c LR_bin_add() with the same results.
+The bins are found a chunk of values at a time, and the values are tallied
+round robin into several private sub-histograms (so repeated hits on the same
+bin don't wait on each other) which are then added into \e bins .
+NaN values are not tallied or counted and raise an error, but the remaining
+values are still tallied.
+For weighted bins each value has weight 1 (see \c LR_bin_addw_n()).
+
+@param	b	LR_bin object
+@param	x	array of values to count within the given bins.
+@param	n	number of values
+@return	0 if successful, else non-zero if failed
+*/
+int LR_bin_add_n(LR_bin *b, const double *x, size_t n) {
+	int	idx[LR_BIN_CHUNK], nb = b->nn, ns = b->nn + 1;
+	long	*sub, nan = 0;
+	size_t	k, m;
+
+	if (b->flags & LR_BIN_WEIGHTED)
+		return LR_bin_addw_n(b, x, (const double *) NULL, n);
+	if (!(sub = (long *) calloc(LR_BIN_NSUB * ns, sizeof(long)))) {
+		/* fall back on one at a time */
+		int ret = LRerr_OK;
+		for (k = 0; k < n; k++)
+			if (LR_bin_add(b, x[k]))
+				ret = LRerr_InvalidInputValue;
+		return ret;
+	}
+	for (k = 0; k < n; k += m) {
+		m = (n - k < LR_BIN_CHUNK ? n - k : LR_BIN_CHUNK);
+		LR_bin_index_n(b, x + k, idx, m);
+		for (size_t j = 0; j < m; j++)
+			sub[(j % LR_BIN_NSUB) * ns + idx[j]]++;
 	}
+	/* reduce the sub-histograms */
+	for (int s = 1; s < LR_BIN_NSUB; s++) {
+		for (int i = 0; i <= nb; i++)
+			sub[i] += sub[s * ns + i];
+	}
+	for (int i = 0; i < nb; i++)
+		if (sub[i])
+			LR_bin_tally(b, i, sub[i]);
+	nan = sub[nb];
+	free((void *) sub);
+	if (b->flags & LR_BIN_ATOMIC)
+		(void) __atomic_fetch_add(&(b->c), n - nan, __ATOMIC_RELAXED);
+	else
+		b->c += n - nan;
+
+	if (nan)
+		return	LR_bin_err(b, LRerr_InvalidInputValue);
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_bin_clone_empty(const LR_bin *b) - create a new binning object
+with the same boundaries
+
+The new `LR_bin` object has the same bins and boundaries (and flags)
+as \e b but no tallies, e.g. so that each thread can tally its own
+and then combine them with \c LR_bin_merge().
+
+@param	b	LR_bin object
+@return	LR_bin object if successful, else NULL
+*/
+LR_bin *LR_bin_clone_empty(const LR_bin *b) {
+	LR_bin *ptr = (void *) NULL;
+
+	if (!b || !(ptr = LR_bin_new(b->n)))
+		return ptr;
+	(void) memcpy(ptr->bdrs, b->bdrs, b->n * sizeof(double));
+	ptr->nn = b->nn;
+	ptr->lo = b->lo;
+	ptr->w1 = b->w1;
+	if ((b->flags & LR_BIN_WEIGHTED) && LR_bin_weighted(ptr)) {
+		LR_bin_rm(&ptr);
+		return ptr;
+	}
+	ptr->flags = b->flags;
+
+	return ptr;
+}
+
+/*!
+@brief	LR_bin_merge(LR_bin *dst, const LR_bin *src) - add the tallies
+of one binning object to another
+
+Both must have the same boundaries (see \c LR_bin_clone_empty()),
+and either both or neither have weighted tallies.
+If \e dst tallies with atomic counters (see \c LR_bin_atomic()) then
+several threads can merge into it at once.
+
+@param	dst	LR_bin object to add to
+@param	src	LR_bin object to add
+@return	0 if successful, else non-zero if failed
+*/
+int LR_bin_merge(LR_bin *dst, const LR_bin *src) {
+	if (!dst || !src)
+		return LRerr_BinGeneric;
+	if (dst->nn != src->nn
+	||  memcmp(dst->bdrs, src->bdrs, (dst->nn - 1) * sizeof(double)))
+		return LR_bin_err(dst, LRerr_InvalidRange);
+	if ((dst->flags ^ src->flags) & LR_BIN_WEIGHTED)
+		return LR_bin_err(dst, LRerr_UnmetPreconditions);
+
+	for (int i = 0; i < dst->nn; i++)
+		if (src->bins[i])
+			LR_bin_tally(dst, i, src->bins[i]);
+	if (dst->flags & LR_BIN_WEIGHTED) {
+		for (int i = 0, n = dst->n; i < dst->nn; i++) {
+			LR_bin_ksum(dst->sw + i, dst->cw + i, src->sw[i]);
+			LR_bin_ksum(dst->sw + i, dst->cw + i, src->cw[i]);
+			LR_bin_ksum(dst->sw2 + i, dst->cw + n + i, src->sw2[i]);
+			LR_bin_ksum(dst->sw2 + i, dst->cw + n + i, src->cw[n + i]);
+		}
+	}
+	if (dst->flags & LR_BIN_ATOMIC)
+		(void) __atomic_fetch_add(&(dst->c), src->c, __ATOMIC_RELAXED);
+	else
+		dst->c += src->c;
+
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_bin_atomic(LR_bin *b, int on) - tally with atomic counters
+
+When on, \c LR_bin_add(), \c LR_bin_add_n(), and \c LR_bin_merge()
+update the tallies with atomic operations so that one `LR_bin` object can
+be shared by several threads.  (The boundaries must not be set
+concurrently.)  Thread local objects merged at the end are generally
+faster.  Should be set before the object is shared.
+Weighted tallies can't be atomic.
+
+@param	b	LR_bin object
+@param	on	non-zero to use atomic counters
+@return	0 if successful, else non-zero if failed
+*/
+int LR_bin_atomic(LR_bin *b, int on) {
+	if (!b)
+		return LRerr_BinGeneric;
+	if (on && (b->flags & LR_BIN_WEIGHTED))
+		return b->errno = LRerr_UnmetPreconditions;
+	if (on)
+		b->flags |= LR_BIN_ATOMIC;
+	else
+		b->flags &= ~LR_BIN_ATOMIC;
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_bin_weighted(LR_bin *b) - tally sample weights
+
+After this each bin also keeps the sum of the sample weights \f$ w_j \f$
+and of the squared weights \f$ w_j^2 \f$ , with compensated summation
+so that very many small weights don't lose precision.
+Values added with \c LR_bin_add() or \c LR_bin_add_n() have weight 1.
+The weight sums start at zero, so it should be called before tallying.
+
+@param	b	LR_bin object
+@return	0 if successful, else non-zero if failed
+*/
+int LR_bin_weighted(LR_bin *b) {
+	double	*w;
+
+	if (!b)
+		return LRerr_BinGeneric;
+	if (b->flags & LR_BIN_ATOMIC)
+		return b->errno = LRerr_UnmetPreconditions;
+	if (b->flags & LR_BIN_WEIGHTED)
+		return LRerr_OK;
+	/* one block: sw, sw2, then the compensations for each */
+	if (!(w = (double *) calloc(4 * b->n, sizeof(double))))
+		return b->errno = LRerr_AllocFail;
+	b->sw = w;
+	b->sw2 = w + b->n;
+	b->cw = w + 2 * b->n;
+	b->flags |= LR_BIN_WEIGHTED;
+
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_bin_addw(LR_bin *b, double x, double w) - collect value with
+weight to be binned.
+
+The weighted version of \c LR_bin_add() , where the bin's count is
+incremented and the weight \e w is added to the bin's sums.
+The object must have weighted tallies (see \c LR_bin_weighted()).
+A NaN value or non-finite weight is not tallied and raises an error.
+
+@param	b	LR_bin object
+@param	x	value to count within the given bin.
+@param	w	weight of the value
+@return	0 if successful, else non-zero if failed
+*/
+int LR_bin_addw(LR_bin *b, double x, double w) {
+	int i;
+
+	if (!(b->flags & LR_BIN_WEIGHTED))
+		return b->errno = LRerr_UnmetPreconditions;
+	if (isnan(x) || !isfinite(w))
+		return b->errno = LRerr_InvalidInputValue;
+
+	i = LR_bin_index(b, x);
 	if (i >= b->nn)
-		return	b->errno = LRerr_InvalidRange;
+		return b->errno = LRerr_InvalidRange;
+	b->bins[i]++;
 	b->c++;
+	LR_bin_wtally(b, i, w);
+
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_bin_addw_n(LR_bin *b, const double *x, const double *w,
+size_t n) - collect an array of values with weights to be binned.
+
+This is the batch version of \c LR_bin_addw() with the same results,
+where \e x and \e w are parallel arrays.  If \e w is NULL each value has
+weight 1.  The bins are found a chunk of values at a time as for
+\c LR_bin_add_n() .  Values that can't be tallied raise an error, but the
+remaining values are still tallied.
+
+@param	b	LR_bin object
+@param	x	array of values to count within the given bins.
+@param	w	array of weights (or NULL)
+@param	n	number of values
+@return	0 if successful, else non-zero if failed
+*/
+int LR_bin_addw_n(LR_bin *b, const double *x, const double *w, size_t n) {
+	int	idx[LR_BIN_CHUNK], nb = b->nn, bad = 0;
+	size_t	k, m;
+	double	wj = 1.0;
+
+	if (!(b->flags & LR_BIN_WEIGHTED))
+		return b->errno = LRerr_UnmetPreconditions;
+	for (k = 0; k < n; k += m) {
+		m = (n - k < LR_BIN_CHUNK ? n - k : LR_BIN_CHUNK);
+		LR_bin_index_n(b, x + k, idx, m);
+		for (size_t j = 0; j < m; j++) {
+			if (w)
+				wj = w[k + j];
+			if (idx[j] == nb || !isfinite(wj)) {
+				bad++;
+				continue;
+			}
+			b->bins[idx[j]]++;
+			LR_bin_wtally(b, idx[j], wj);
+		}
+	}
+	b->c += n - bad;
 
+	if (bad)
+		return b->errno = LRerr_InvalidInputValue;
 	return LRerr_OK;
 }
 
+/* the compensated sum of s[i] + c[i] over all the bins */
+static double LR_bin_ktotal(const LR_bin *b, const double *s,
+	const double *c) {
+	double	t = 0.0, tc = 0.0;
+
+	for (int i = 0; i < b->nn; i++) {
+		LR_bin_ksum(&t, &tc, s[i]);
+		LR_bin_ksum(&t, &tc, c[i]);
+	}
+	return t + tc;
+}
+
+/*!
+@brief	LR_bin_sumw(const LR_bin *b, int i) - the sum of weights in a bin
+
+This is the weighted bin content \f$ \sum_j w_j \f$ over the samples in
+bin \e i , or over all the samples if \e i < 0.
+
+@param	b	LR_bin object with weighted tallies
+@param	i	bin index, or -1 for all bins
+@return	sum of weights, or NAN if not available
+*/
+double LR_bin_sumw(const LR_bin *b, int i) {
+	if (!b || !(b->flags & LR_BIN_WEIGHTED) || i >= b->nn)
+		return NAN;
+	if (i < 0)
+		return LR_bin_ktotal(b, b->sw, b->cw);
+	return b->sw[i] + b->cw[i];
+}
+
+/*!
+@brief	LR_bin_var(const LR_bin *b, int i) - the variance of a weighted
+bin content
+
+The variance of the weighted bin content is estimated by the sum of the
+squared weights \f$ \sum_j w_j^2 \f$ over the samples in bin \e i (or
+over all the samples if \e i < 0), so the standard error is its square root.
+For unit weights this is the usual Poisson variance, the count.
+
+@param	b	LR_bin object with weighted tallies
+@param	i	bin index, or -1 for all bins
+@return	variance, or NAN if not available
+*/
+double LR_bin_var(const LR_bin *b, int i) {
+	if (!b || !(b->flags & LR_BIN_WEIGHTED) || i >= b->nn)
+		return NAN;
+	if (i < 0)
+		return LR_bin_ktotal(b, b->sw2, b->cw + b->n);
+	return b->sw2[i] + b->cw[b->n + i];
+}
+
+/*!
+@brief	LR_bin_ess(const LR_bin *b, int i) - the effective sample size
+of a bin
+
+Kish's effective sample size
+\f[ n_{\mbox{eff}} = \frac{\left(\sum_j w_j\right)^2}{\sum_j w_j^2} \f]
+over the samples in bin \e i , or over all the samples if \e i < 0.
+It equals the count for equal weights, and is smaller the more
+uneven the weights are.
+
+@param	b	LR_bin object with weighted tallies
+@param	i	bin index, or -1 for all bins
+@return	effective sample size (0 if empty), or NAN if not available
+*/
+double LR_bin_ess(const LR_bin *b, int i) {
+	double	zero = 0.0, sw = LR_bin_sumw(b, i), sw2 = LR_bin_var(b, i);
+
+	if (isnan(sw) || isnan(sw2))
+		return NAN;
+	if (sw2 == zero)
+		return zero;
+	return sw * sw / sw2;
+}
+
 #ifdef __cplusplus
 }
 #endif
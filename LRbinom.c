@@ -65,7 +65,10 @@ extern "C" {
 #endif
 
 #include <math.h>
+#include <float.h>
 #include "libran.h"
+#include "LRmathf.h"
+#include "LRquant.h"
 
 /* int */
 /*!
@@ -80,23 +83,33 @@ exceeds some value.
 @return int
 */
 int LRi_binomial_RAN(LR_obj *o) {
-	float	zero = 0.0, one = 1.0, u, sum = zero, p = one;
-	int	i;
-	if (isnan(o->q))
-		o->q = -logf(one - o->p);
+	float	zero = 0.0, u, sum = zero, q = o->rc[0].f;
+	int	i, n = o->rc[1].i;
 
-	for (i = 0; i < o->n; i++) {
+	for (i = 0; i < n; i++) {
 		do {
 			u = o->uf(o);
 		} while (u == zero);
-		sum += (-logf(u)/(o->n - i));
-		if (sum > o->q)
+		sum += (-LR_logf(u)/(n - i));
+		if (sum > q)
 			break;
 	}
 
 	return i;
 }
 
+/* log of the PDF for 0 <= k <= n, the binomial factor (n k) from
+ * LR_lfact() instead of lgamma() which sets the global signgam
+ * (not thread-safe) */
+static double LRi_binomial_lpdf(LR_obj *o, int k) {
+	int	n = o->n;
+	double	lt = LR_lfact(n) - LR_lfact(k) - LR_lfact(n - k);
+
+	if (k > 0)	lt += k * o->dc[0].d;
+	if (k < n)	lt += (n - k) * o->dc[1].d;
+	return lt;
+}
+
 /*!
 @brief	LRi_binomial_PDF(LR_obj *o, int k) - Binomial 
 probablity (or mass) distribution function
@@ -106,48 +119,85 @@ probablity (or mass) distribution function
 @return float PDF at x
 */
 float LRi_binomial_PDF(LR_obj *o, int k) {
-	float zero = 0.0, one = 1.0, p = o->p, lp, lq, lt;
-
-	if (isnan(o->q))
-		o->q = -logf(one - o->p);
+	float zero = 0.0;
 
 	if (k < 0 || k > o->n)	return zero;
 
-	lp = logf(o->p);
-	lq = - o->q;
-
-	lt = k*lp + (o->n - k)*lq;
-	lt += (lgammaf(o->n + 1) - lgammaf(k + 1) - lgammaf(o->n - k + 1));
-
-	return expf(lt);
+	return (float) exp(LRi_binomial_lpdf(o, k));
 }
 
 /*!
 @brief	LRi_binomial_CDF(LR_obj *o, int k) - Binomial distribution
 cumulative distribution function
 
+Below the mode the PDF is summed down from \e k , otherwise the upper
+tail is summed up from \e k + 1 and taken from 1, in each case until
+the terms no longer count, so only the terms near \e k are needed
+even for large \e n .
+
 @param o	LR_obj object
 @param x	value
 @return float CDF at x
 */
 float LRi_binomial_CDF(LR_obj *o, int k) {
-	float zero = 0.0, one = 1.0, sum = zero, p = o->p, lp, lq, lt;
-
-	if (isnan(o->q))
-		o->q = -logf(one - o->p);
+	double	zero = 0.0, one = 1.0, p = o->p, r = p / (one - p), t, s;
+	int	n = o->n;
+
+	if (k < 0)	return zero;
+	if (k >= n)	return one;
+	if (p >= one)	return zero;
+
+	if (k < (int) floor((n + one) * p)) {	/* below the mode */
+		t = s = exp(LRi_binomial_lpdf(o, k));
+		for (int i = k; i > 0 && t > DBL_EPSILON * s; i--) {
+			t *= i / (r * (n - i + 1));
+			s += t;
+		}
+		return (float) s;
+	}
+	t = s = exp(LRi_binomial_lpdf(o, k + 1));
+	for (int i = k + 1; i < n && t > DBL_EPSILON * s; i++) {
+		t *= r * (n - i) / (i + 1);
+		s += t;
+	}
+	return (float) (one - s);
+}
 
-	if (k < 0 || k > o->n)	return zero;
+/*!
+@brief	LRi_binomial_QUANT(LR_obj *o, float u) - Binomial distribution
+quantile (inverse cumulative distribution function)
 
-	lp = logf(o->p);
-	lq = - o->q;
+The PDF is found at the mode from its logarithm (so it does not
+underflow for large \e n ), then by recurrence down to where the lower
+tail is negligible against \e u , and summed back up from there until
+it reaches \e u .
 
-	for (int i = 0; i <= k; i++) {
-		lt = i*lp + (o->n - i)*lq;
-		lt += (lgammaf(o->n + 1) - lgammaf(i+1) - lgammaf(o->n - i+1));
-		sum += expf(lt);
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return int smallest k where the CDF is at least u
+*/
+int LRi_binomial_QUANT(LR_obj *o, float u) {
+	double	zero = 0.0, one = 1.0, p = o->p, r = p / (one - p), t, s;
+	int	n = o->n, m, kk;
+
+	if (u <= zero)	return 0;
+	if (p >= one)	return n;
+
+	/* the mode & the PDF there */
+	m = (int) floor((n + one) * p);
+	m = (m > n ? n : m);
+	t = exp(LRi_binomial_lpdf(o, m));
+	/* down to where the terms no longer count */
+	for (kk = m; kk > 0 && t > DBL_EPSILON * u; kk--)
+		t *= kk / (r * (n - kk + 1));
+	/* and sum up */
+	for (s = t; s < u && kk < n; s += t) {
+		t *= r * (n - kk) / (kk + 1);
+		kk++;
+		if (kk > m && t <= DBL_EPSILON * s)
+			break;
 	}
-
-	return sum;
+	return kk;
 }
 
 #ifdef __cplusplus
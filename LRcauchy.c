@@ -58,6 +58,9 @@ extern "C" {
 
 #include <math.h>
 #include "libran.h"
+#include "LRmathf.h"
+#include "LRmathd.h"
+#include "LRkern.h"
 
 /* double */
 /*!
@@ -69,7 +72,32 @@ Default values: peak m = 0, half width s = 1
 @return double
 */
 double LRd_cauchy_RAN(LR_obj *o) {
-	return o->m.d + o->s.d*tan(M_PI * o->ud(o));
+	double	x = M_PI * o->ud(o);
+
+	return o->rc[0].d + o->rc[1].d
+		* ((o->flags & LR_OBJ_FAST) ? LR_tand(x) : tan(x));
+}
+
+/*!
+@brief	LRd_cauchy_RAN_n(LR_obj *o, double *x, long n) - a batch of double random
+Cauchy/Lorentz variates (see \c LRd_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRd_cauchy_RAN_n(LR_obj *o, double *x, long n) {
+	double	pi = M_PI, m = o->rc[0].d, s = o->rc[1].d;
+
+	(void) LR_drand_n(o, x, n);
+	if (o->flags & LR_OBJ_FAST) {
+		LR_kern_get()->dcauchy(x, n, m, s);
+	} else {
+		for (long i = 0; i < n; i++)
+			x[i] = m + s*tan(pi * x[i]);
+	}
+	return LRerr_OK;
 }
 
 /*!
@@ -84,13 +112,16 @@ Default values: peak m = 0, half width s = 1
 double LRd_cauchymar_RAN(LR_obj *o) {
 	double zero = 0.0, one = 1.0, two = 2.0;
 	double s, z1, z2;
-	do {
+	for (;;) {
 		z1 = two*o->ud(o) - one;
 		z2 = two*o->ud(o) - one;
 		s = z1*z1 + z2*z2;
-	} while (s > one || z2 == zero);
+		if (!(s > one || z2 == zero))
+			break;
+		LR_COUNT(o, rejections, 1);
+	}
 
-	return o->m.d + o->s.d*z1/z2;
+	return o->rc[0].d + o->rc[1].d*z1/z2;
 }
 
 /*!
@@ -101,10 +132,9 @@ double LRd_cauchymar_RAN(LR_obj *o) {
 @return double PDF at x
 */
 double LRd_cauchy_PDF(LR_obj *o, double x) {
-
 	x -= o->m.d;
 
-	return o->s.d * M_1_PI / (x*x + o->s.d * o->s.d);
+	return o->dc[1].d / (x*x + o->dc[0].d);
 }
 
 /*!
@@ -119,7 +149,28 @@ double LRd_cauchy_CDF(LR_obj *o, double x) {
 
 	x -= o->m.d;
 
-	return half + M_1_PI * atan(x/o->s.d);
+	return half + M_1_PI * atan(x * o->dc[2].d);
+}
+
+/*!
+@brief	LRd_cauchy_QUANT(LR_obj *o, double u) - double Cauchy/Lorentz
+quantile (inverse cumulative distribution function)
+
+The \f$ \tan(\pi (u - 1/2)) \f$ is taken as \f$ -1/\tan(\pi u) \f$ from
+the nearer end, so the tails keep their precision and u = 0, 1 give
+\f$ \mp\infty \f$.
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return double x where the CDF is u
+*/
+double LRd_cauchy_QUANT(LR_obj *o, double u) {
+	double	half = 0.5, one = 1.0, pi = M_PI;
+
+	if (u <= half)
+		return o->rc[0].d - o->rc[1].d / tan(pi * u);
+	else
+		return o->rc[0].d + o->rc[1].d / tan(pi * (one - u));
 }
 
 /* float */
@@ -132,7 +183,24 @@ Default values: peak m = 0, half width s = 1
 @return float
 */
 float LRf_cauchy_RAN(LR_obj *o) {
-	return o->m.f + o->s.f*tanf(M_PI * o->uf(o));
+	float	pi = M_PI;
+
+	return o->rc[0].f + o->rc[1].f*LR_tanf(pi * o->uf(o));
+}
+
+/*!
+@brief	LRf_cauchy_RAN_n(LR_obj *o, float *x, long n) - a batch of float random
+Cauchy/Lorentz variates (see \c LRf_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRf_cauchy_RAN_n(LR_obj *o, float *x, long n) {
+	(void) LR_frand_n(o, x, n);
+	LR_kern_get()->fcauchy(x, n, o->rc[0].f, o->rc[1].f);
+	return LRerr_OK;
 }
 
 /*!
@@ -147,13 +215,16 @@ Default values: peak m = 0, half width s = 1
 float LRf_cauchymar_RAN(LR_obj *o) {
 	float zero = 0.0, one = 1.0, two = 2.0;
 	float s, z1, z2;
-	do {
+	for (;;) {
 		z1 = two*o->uf(o) - one;
 		z2 = two*o->uf(o) - one;
 		s = z1*z1 + z2*z2;
-	} while (s > one || z2 == zero);
+		if (!(s > one || z2 == zero))
+			break;
+		LR_COUNT(o, rejections, 1);
+	}
 
-	return o->m.f + o->s.f*z1/z2;
+	return o->rc[0].f + o->rc[1].f*z1/z2;
 }
 
 /*!
@@ -164,10 +235,9 @@ float LRf_cauchymar_RAN(LR_obj *o) {
 @return float PDF at x
 */
 float LRf_cauchy_PDF(LR_obj *o, float x) {
-
 	x -= o->m.f;
 
-	return o->s.f * M_1_PI / (x*x + o->s.f * o->s.f);
+	return o->dc[1].f / (x*x + o->dc[0].f);
 }
 
 /*!
@@ -178,11 +248,32 @@ float LRf_cauchy_PDF(LR_obj *o, float x) {
 @return float CDF at x
 */
 float LRf_cauchy_CDF(LR_obj *o, float x) {
-	float	half = 0.5;
+	float	half = 0.5, onepi = M_1_PI;
 
 	x -= o->m.f;
 
-	return half + M_1_PI * atanf(x/o->s.f);
+	return half + onepi * atanf(x * o->dc[2].f);
+}
+
+/*!
+@brief	LRf_cauchy_QUANT(LR_obj *o, float u) - float Cauchy/Lorentz
+quantile (inverse cumulative distribution function)
+
+The \f$ \tan(\pi (u - 1/2)) \f$ is taken as \f$ -1/\tan(\pi u) \f$ from
+the nearer end, so the tails keep their precision and u = 0, 1 give
+\f$ \mp\infty \f$.
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return float x where the CDF is u
+*/
+float LRf_cauchy_QUANT(LR_obj *o, float u) {
+	float	half = 0.5, one = 1.0, pi = M_PI;
+
+	if (u <= half)
+		return o->rc[0].f - o->rc[1].f / tanf(pi * u);
+	else
+		return o->rc[0].f + o->rc[1].f / tanf(pi * (one - u));
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,94 @@
+/*!
+\file	LRcounters.c
+\brief	LibRan per-object instrumentation counters
+
+When compiled with \c LR_COUNTERS defined (\c configure \c --enable-counters )
+each `LR_obj` object counts the work its methods do, which helps
+explain why a distribution is slow:
+
+Counter    | Counts
+---------- | -----------------------------------------------------------
+uniforms   | uniform values drawn from the built-in urand generator
+rejections | candidates rejected (e.g. the polar methods \e gausmar and \e cauchymar )
+iterations | root finder iterations (\e uinvcdf )
+callbacks  | evaluations of user supplied functions (the \e uinvcdf CDF)
+
+A user generator installed as the object's \e ud or \e uf can count
+its own uniforms with \c LR_COUNT(o,uniforms,1) .
+The counters are per object (each stream of a shared spec starts at
+zero), so the threads never contend for them, and the totals for
+several streams are simply summed.
+Without \c LR_COUNTERS the counters and the code updating them are
+compiled out.  The setting is recorded in the installed \c LRconfig.h ,
+which \c libran.h includes, so callers always see the same `LR_obj`
+layout as the library.
+
+\code
+#include <stdio.h>
+#include "libran.h"
+...
+LR_obj *o = LR_new(gausmar, LR_double);
+LR_counters c;
+...
+for (int i = 0; i < 1000000; i++)
+	x = LRd_RAN(o);
+if (!LR_counters_get(o, &c))
+	printf("%.3f uniforms/variate, %lu rejections\n",
+		c.uniforms / 1e6, c.rejections);
+LR_counters_reset(o);
+\endcode
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <string.h>	/* memset */
+#include "libran.h"
+
+/*!
+@brief	LR_counters_get(LR_obj *o, LR_counters *c) - get the counters
+
+The object's counters are copied to \e c , or \e c is zeroed if
+LibRan was compiled without \c LR_COUNTERS .
+
+@param	o	LR_obj object
+@param	c	where to put the counters
+@return	0 if successful, else LRerr_UnmetPreconditions if compiled
+	without counters
+*/
+int LR_counters_get(LR_obj *o, LR_counters *c) {
+	if (!o || !c)
+		return LRerr_InvalidInputValue;
+#ifdef LR_COUNTERS
+	*c = o->cnt;
+	return LRerr_OK;
+#else
+	(void) memset(c, 0, sizeof(LR_counters));
+	return o->errno = LRerr_UnmetPreconditions;
+#endif
+}
+
+/*!
+@brief	LR_counters_reset(LR_obj *o) - zero the counters
+
+Does nothing if LibRan was compiled without \c LR_COUNTERS .
+
+@param	o	LR_obj object
+@return	void
+*/
+void LR_counters_reset(LR_obj *o) {
+#ifdef LR_COUNTERS
+	if (o)
+		(void) memset(&(o->cnt), 0, sizeof(LR_counters));
+#else
+	(void) o;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
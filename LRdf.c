@@ -12,8 +12,9 @@ Also using these routines instead of calling the associated specific
 functions allows one to quickly switch from one random variate
 distribution to another without making any programmatic changes.
 
-These routines call the associated PDF, CDF, RAN functions
-given in the `LR_obj` object as specified by the `LR_type` and `LR_data_type`.
+These routines call the associated PDF, CDF, RAN, and QUANT (quantile)
+functions given in the `LR_obj` object as specified by the `LR_type` and
+`LR_data_type`.
 
 There are also \e generic auxiliary functions: new, rm, set, and norm.
 The auxiliary methods are not dependent on the `LR_data_type`, but only
@@ -61,7 +62,7 @@ double LRd_RAN(LR_obj *o) {
 		o->errno = LRerr_BadDataType;
 		return NAN;
 	}
-	return o->rnd(o);
+	return o->ops->rnd(o);
 }
 
 /*!
@@ -82,7 +83,7 @@ double LRd_PDF(LR_obj *o, double x) {
 		o->errno = LRerr_BadDataType;
 		return NAN;
 	}
-	return o->pdfd(o,x);
+	return o->ops->pdfd(o,x);
 }
 
 /*!
@@ -103,7 +104,7 @@ double LRd_CDF(LR_obj *o, double x) {
 		o->errno = LRerr_BadDataType;
 		return NAN;
 	}
-	return o->cdfd(o,x);
+	return o->ops->cdfd(o,x);
 }
 
 /*!
@@ -121,7 +122,7 @@ float LRf_RAN(LR_obj *o) {
 		o->errno = LRerr_BadDataType;
 		return NAN;
 	}
-	return o->rnf(o);
+	return o->ops->rnf(o);
 }
 
 /*!
@@ -142,7 +143,7 @@ float LRf_PDF(LR_obj *o, float x) {
 		o->errno = LRerr_BadDataType;
 		return NAN;
 	}
-	return o->pdff(o,x);
+	return o->ops->pdff(o,x);
 }
 
 /*!
@@ -163,7 +164,7 @@ float LRf_CDF(LR_obj *o, float x) {
 		o->errno = LRerr_BadDataType;
 		return NAN;
 	}
-	return o->cdff(o,x);
+	return o->ops->cdff(o,x);
 }
 
 /*!
@@ -181,7 +182,7 @@ int LRi_RAN(LR_obj *o) {
 		o->errno = LRerr_BadDataType;
 		return NAN;
 	}
-	return o->rni(o);
+	return o->ops->rni(o);
 }
 
 /*!
@@ -202,7 +203,7 @@ float LRi_PDF(LR_obj *o, int x) {
 		o->errno = LRerr_BadDataType;
 		return NAN;
 	}
-	return o->pdfi(o,x);
+	return o->ops->pdfi(o,x);
 }
 
 /*!
@@ -223,7 +224,253 @@ float LRi_CDF(LR_obj *o, int x) {
 		o->errno = LRerr_BadDataType;
 		return NAN;
 	}
-	return o->cdfi(o,x);
+	return o->ops->cdfi(o,x);
+}
+
+/*!
+@brief	LRd_RAN_n(LR_obj *o, double *x, long n) - a batch of random variates
+
+Fills \e x with the next \e n random variates, the same sequence as
+\e n calls of \c LRd_RAN() .  The distributions with a batch method
+(\e unif , \e nexp , \e gausbm , \e cauchy ) draw all the uniforms
+first and then transform them in one loop the compiler can vectorize
+(with kernels for the CPU's instruction set, see \c LR_isa() ),
+the others are sampled one at a time.
+
+@param	o	LR_obj object
+@param	x	array of at least \e n values
+@param	n	number of variates
+@return	0 if successful, else non-zero if failed
+*/
+int LRd_RAN_n(LR_obj *o, double *x, long n) {
+	int	e;
+
+	if (o->d != LR_double)
+		return o->errno = LRerr_BadDataType;
+	if (n < 0 || (n && !x))
+		return o->errno = LRerr_InvalidInputValue;
+	if (o->ops->rnd_n)
+		return o->ops->rnd_n(o, x, n);
+	e = o->errno;
+	o->errno = LRerr_OK;
+	for (long i = 0; i < n; i++)
+		x[i] = o->ops->rnd(o);
+	if (o->errno)
+		return o->errno;
+	o->errno = e;
+	return LRerr_OK;
+}
+
+/*!
+@brief	LRf_RAN_n(LR_obj *o, float *x, long n) - a batch of random variates
+
+Fills \e x with the next \e n random variates, the same sequence as
+\e n calls of \c LRf_RAN() .  The distributions with a batch method
+(\e unif , \e nexp , \e gausbm , \e cauchy ) draw all the uniforms
+first and then transform them in one loop the compiler can vectorize
+(with kernels for the CPU's instruction set, see \c LR_isa() ),
+the others are sampled one at a time.
+
+@param	o	LR_obj object
+@param	x	array of at least \e n values
+@param	n	number of variates
+@return	0 if successful, else non-zero if failed
+*/
+int LRf_RAN_n(LR_obj *o, float *x, long n) {
+	int	e;
+
+	if (o->d != LR_float)
+		return o->errno = LRerr_BadDataType;
+	if (n < 0 || (n && !x))
+		return o->errno = LRerr_InvalidInputValue;
+	if (o->ops->rnf_n)
+		return o->ops->rnf_n(o, x, n);
+	e = o->errno;
+	o->errno = LRerr_OK;
+	for (long i = 0; i < n; i++)
+		x[i] = o->ops->rnf(o);
+	if (o->errno)
+		return o->errno;
+	o->errno = e;
+	return LRerr_OK;
+}
+
+/*!
+@brief	LRd_QUANT(LR_obj *o, double u) - quantile (inverse cumulative
+distribution function)
+
+This method will call the specific random variate quantile function
+as determined by the object's `LR_type` and `LR_data_type`, giving the
+\e x where the CDF is \e u .  So a uniform \e u gives a random
+variate, which lets the inversion methods (quasi-Monte Carlo,
+antithetic variates, stratified sampling, or common random numbers)
+use any distribution.  The ends \e u = 0 and 1 give the
+distribution's bounds (which may be infinite).  Note that using the
+wrong data type or a \e u outside [0,1] will return a NAN and raise
+an error.
+
+@param	o	LR_obj object
+@param	u	probability in [0,1]
+@return	double x where the CDF is u
+*/
+double LRd_QUANT(LR_obj *o, double u) {
+	if (o->d != LR_double) {
+		o->errno = LRerr_BadDataType;
+		return NAN;
+	}
+	if (!(u >= 0.0 && u <= 1.0)) {
+		o->errno = LRerr_InvalidInputValue;
+		return NAN;
+	}
+	return o->ops->qnd(o,u);
+}
+
+/*!
+@brief	LRf_QUANT(LR_obj *o, float u) - quantile (inverse cumulative
+distribution function)
+
+See \c LRd_QUANT() .
+
+@param	o	LR_obj object
+@param	u	probability in [0,1]
+@return	float x where the CDF is u
+*/
+float LRf_QUANT(LR_obj *o, float u) {
+	if (o->d != LR_float) {
+		o->errno = LRerr_BadDataType;
+		return NAN;
+	}
+	if (!(u >= 0.0f && u <= 1.0f)) {
+		o->errno = LRerr_InvalidInputValue;
+		return NAN;
+	}
+	return o->ops->qnf(o,u);
+}
+
+/*!
+@brief	LRi_QUANT(LR_obj *o, float u) - quantile (inverse cumulative
+distribution function)
+
+For the discrete distributions this is the smallest \e k where the CDF
+is at least \e u (see \c LRd_QUANT() ).  Note that using the wrong
+data type or a \e u outside [0,1] will return a 0 and raise an error.
+
+@param	o	LR_obj object
+@param	u	probability in [0,1]
+@return	int k where the CDF first reaches u
+*/
+int LRi_QUANT(LR_obj *o, float u) {
+	if (o->d != LR_int) {
+		o->errno = LRerr_BadDataType;
+		return 0;
+	}
+	if (!(u >= 0.0f && u <= 1.0f)) {
+		o->errno = LRerr_InvalidInputValue;
+		return 0;
+	}
+	return o->ops->qni(o,u);
+}
+
+/*!
+@brief	LRd_QUANT_n(LR_obj *o, const double *u, double *x, long n) - a batch
+of quantiles
+
+Fills \e x with the quantiles of the \e n probabilities in \e u
+(which may be the same array), as \e n calls of \c LRd_QUANT() .
+Any \e u outside [0,1] gives a NAN and the error is returned after
+the rest are done.
+
+@param	o	LR_obj object
+@param	u	array of at least \e n probabilities
+@param	x	array of at least \e n values
+@param	n	number of quantiles
+@return	0 if successful, else non-zero if failed
+*/
+int LRd_QUANT_n(LR_obj *o, const double *u, double *x, long n) {
+	double	(*qn)(LR_obj *, double) = o->ops->qnd;
+	int	e = LRerr_OK;
+
+	if (o->d != LR_double)
+		return o->errno = LRerr_BadDataType;
+	if (n < 0 || (n && (!u || !x)))
+		return o->errno = LRerr_InvalidInputValue;
+	for (long i = 0; i < n; i++) {
+		if (u[i] >= 0.0 && u[i] <= 1.0) {
+			x[i] = qn(o, u[i]);
+		} else {
+			x[i] = NAN;
+			e = LRerr_InvalidInputValue;
+		}
+	}
+	if (e)
+		return o->errno = e;
+	return LRerr_OK;
+}
+
+/*!
+@brief	LRf_QUANT_n(LR_obj *o, const float *u, float *x, long n) - a batch
+of quantiles
+
+See \c LRd_QUANT_n() .
+
+@param	o	LR_obj object
+@param	u	array of at least \e n probabilities
+@param	x	array of at least \e n values
+@param	n	number of quantiles
+@return	0 if successful, else non-zero if failed
+*/
+int LRf_QUANT_n(LR_obj *o, const float *u, float *x, long n) {
+	float	(*qn)(LR_obj *, float) = o->ops->qnf;
+	int	e = LRerr_OK;
+
+	if (o->d != LR_float)
+		return o->errno = LRerr_BadDataType;
+	if (n < 0 || (n && (!u || !x)))
+		return o->errno = LRerr_InvalidInputValue;
+	for (long i = 0; i < n; i++) {
+		if (u[i] >= 0.0f && u[i] <= 1.0f) {
+			x[i] = qn(o, u[i]);
+		} else {
+			x[i] = NAN;
+			e = LRerr_InvalidInputValue;
+		}
+	}
+	if (e)
+		return o->errno = e;
+	return LRerr_OK;
+}
+
+/*!
+@brief	LRi_QUANT_n(LR_obj *o, const float *u, int *x, long n) - a batch
+of quantiles
+
+See \c LRd_QUANT_n() , except a \e u outside [0,1] gives a 0.
+
+@param	o	LR_obj object
+@param	u	array of at least \e n probabilities
+@param	x	array of at least \e n values
+@param	n	number of quantiles
+@return	0 if successful, else non-zero if failed
+*/
+int LRi_QUANT_n(LR_obj *o, const float *u, int *x, long n) {
+	int	(*qn)(LR_obj *, float) = o->ops->qni;
+	int	e = LRerr_OK;
+
+	if (o->d != LR_int)
+		return o->errno = LRerr_BadDataType;
+	if (n < 0 || (n && (!u || !x)))
+		return o->errno = LRerr_InvalidInputValue;
+	for (long i = 0; i < n; i++) {
+		if (u[i] >= 0.0f && u[i] <= 1.0f) {
+			x[i] = qn(o, u[i]);
+		} else {
+			x[i] = 0;
+			e = LRerr_InvalidInputValue;
+		}
+	}
+	if (e)
+		return o->errno = e;
+	return LRerr_OK;
 }
 
 /*!
@@ -241,6 +488,8 @@ that need it.  Can be called otherwise but raises an ignorable error.
 int LR_aux_new(LR_obj *o, int n) {
 	if (!o->aux)
 		return o->errno = LRerr_NoAuxiliaryObject;
+	if (o->spec)
+		return o->errno = LRerr_SharedObject;
 	if (!(((LR_pcs *) o->aux)->new))
 		return o->errno = LRerr_BadAuxSetup;
 
@@ -260,6 +509,8 @@ that need it.  Can be called otherwise but raises an ignorable error.
 int LR_aux_rm(LR_obj *o) {
 	if (!o->aux)
 		return o->errno = LRerr_NoAuxiliaryObject;
+	if (o->spec)
+		return o->errno = LRerr_SharedObject;
 	if (!(((LR_pcs *) o->aux)->rm))
 		return o->errno = LRerr_BadAuxSetup;
 
@@ -282,6 +533,8 @@ that need it.  Can be called otherwise but raises an ignorable error.
 int LR_aux_set(LR_obj *o, double x, double p) {
 	if (!o->aux)
 		return o->errno = LRerr_NoAuxiliaryObject;
+	if (o->spec)
+		return o->errno = LRerr_SharedObject;
 	if (!(((LR_pcs *) o->aux)->set))
 		return o->errno = LRerr_BadAuxSetup;
 
@@ -302,6 +555,8 @@ int LR_aux_norm(LR_obj *o) {
 	int ret;
 	if (!o->aux)
 		return o->errno = LRerr_NoAuxiliaryObject;
+	if (o->spec)
+		return o->errno = LRerr_SharedObject;
 	if (!(((LR_pcs *) o->aux)->normalize))
 		return o->errno = LRerr_BadAuxSetup;
 
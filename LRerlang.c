@@ -52,7 +52,64 @@ extern "C" {
 #endif
 
 #include <math.h>
+#include <float.h>
 #include "libran.h"
+#include "LRmathf.h"
+#include "LRquant.h"
+
+/* the y where the unit scale Erlang CDF of order k is u, by Halley's method
+ * from the Wilson-Hilferty approximation.  The CDF P and its complement
+ * Q are each summed from the density d where they don't cancel. */
+static double LR_erlang_quant(int k, double u) {
+	double	zero = 0.0, one = 1.0, half = 0.5, c = one / (9.0 * k),
+		lgk = zero, y, dy, d, t, s, f, r;
+
+	if (u <= zero)	return zero;
+	if (u >= one)	return INFINITY;
+	if (k == 1)	return - log1p(- u);
+
+	/* log (k-1)!, summed directly instead of with lgamma() which sets
+	 * the global signgam (not thread-safe) */
+	for (int j = 2; j < k; j++)
+		lgk += log((double) j);
+
+	t = one - c + LR_ppndd(u) * sqrt(c);
+	y = k * t * t * t;
+	if (y <= zero)	/* the lower tail P ~ y^k/k! */
+		y = exp((log(u) + lgk + log((double) k)) / k);
+
+	for (int it = 0; it < 100; it++) {
+		d = exp((k - 1) * log(y) - y - lgk);
+		if (d == zero)
+			break;
+		s = t = one;
+		if (y < k) {
+			/* P = d y/k (1 + y/(k+1) + y^2/((k+1)(k+2)) + ...) */
+			for (int j = k + 1; t > DBL_EPSILON * s; j++) {
+				t *= y / j;
+				s += t;
+			}
+			f = d * y / k * s - u;
+		} else {
+			/* Q = d (1 + (k-1)/y + (k-1)(k-2)/y^2 + ... ) */
+			for (int j = k - 1; j > 0 && t > DBL_EPSILON * s; j--) {
+				t *= j / y;
+				s += t;
+			}
+			f = (one - u) - d * s;
+		}
+		/* Halley's correction, f''/f' = (k-1)/y - 1 */
+		r = f / d;
+		t = one - half * r * ((k - 1) / y - one);
+		dy = (t > half ? r / t : r);
+		if (dy >= y)
+			dy = half * y;
+		y -= dy;
+		if (fabs(dy) <= 4.0 * DBL_EPSILON * y)
+			break;
+	}
+	return y;
+}
 
 /* double */
 /*!
@@ -73,7 +130,7 @@ double LRd_erlang_RAN(LR_obj *o) {
 		} while (u == zero);
 		p *= u;
 	}
-	return - o->m.d*log(p);
+	return o->rc[1].d*log(p);
 }
 
 /*!
@@ -85,25 +142,23 @@ probablity distribution function
 @return double PDF at x
 */
 double LRd_erlang_PDF(LR_obj *o, double x) {
-	double zero = 0.0, one = 1.0, p = one, xx = x;
-	if (isnan(o->s.d))
-		o->s.d = one/o->m.d;
+	double zero = 0.0, one = 1.0, sa = o->dc[0].d, p = one, xx = x;
 
 	if (x < zero)	return zero;
 
 	if (x == zero) {
 		if (o->k == 1) {
-			return o->s.d;
+			return sa;
 		} else {
 			return zero;
 		}
 	} else {
-		p *= o->s.d;
+		p *= sa;
 		xx *= p;
 		for (int nn = 1; nn < o->k; nn++) {
 			p *= (xx/nn);
 		}
-		return p * exp(- o->s.d * x);
+		return p * exp(- sa * x);
 	}
 }
 
@@ -116,18 +171,32 @@ cumulative distribution function
 @return double CDF at x
 */
 double LRd_erlang_CDF(LR_obj *o, double x) {
-	double zero = 0.0, one = 1.0, xx = x, p = one, s = one;
-	if (isnan(o->s.d))
-		o->s.d = one/o->m.d;
+	double zero = 0.0, one = 1.0, sa = o->dc[0].d, xx = x, p = one, s = one;
 
 	if (x < zero)	return zero;
+	if (isinf(x))	return one;
 
-	xx *= o->s.d;
+	xx *= sa;
 	for (int nn = 1; nn < o->k; nn++) {
 		p *= (xx / nn);
 		s += p;
 	}
-	return one - s * exp(- o->s.d * x);
+	return one - s * exp(- sa * x);
+}
+
+/*!
+@brief	LRd_erlang_QUANT(LR_obj *o, double u) - Erlang distribution
+quantile (inverse cumulative distribution function)
+
+The CDF is inverted by Halley's method, which takes 2 to 4 steps
+from the Wilson-Hilferty approximation.
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return double x where the CDF is u
+*/
+double LRd_erlang_QUANT(LR_obj *o, double u) {
+	return o->m.d * LR_erlang_quant(o->k, u);
 }
 
 /* float */
@@ -149,7 +218,7 @@ float LRf_erlang_RAN(LR_obj *o) {
 		} while (u == zero);
 		p *= u;
 	}
-	return - o->m.f*logf(p);
+	return o->rc[1].f*LR_logf(p);
 }
 
 /*!
@@ -161,25 +230,23 @@ probablity distribution function
 @return float PDF at x
 */
 float LRf_erlang_PDF(LR_obj *o, float x) {
-	float zero = 0.0, one = 1.0, p = one, xx = x;
-	if (isnan(o->s.f))
-		o->s.f = one/o->m.f;
+	float zero = 0.0, one = 1.0, sa = o->dc[0].f, p = one, xx = x;
 
 	if (x < zero)	return zero;
 
 	if (x == zero) {
 		if (o->k == 1) {
-			return o->s.f;
+			return sa;
 		} else {
 			return zero;
 		}
 	} else {
-		p *= o->s.f;
+		p *= sa;
 		xx *= p;
 		for (int nn = 1; nn < o->k; nn++) {
 			p *= (xx/nn);
 		}
-		return p * expf(- o->s.f * x);
+		return p * LR_expf(- sa * x);
 	}
 }
 
@@ -192,18 +259,32 @@ cumulative distribution function
 @return float CDF at x
 */
 float LRf_erlang_CDF(LR_obj *o, float x) {
-	float zero = 0.0, one = 1.0, xx = x, p = one, s = one;
-	if (isnan(o->s.f))
-		o->s.f = one/o->m.f;
+	float zero = 0.0, one = 1.0, sa = o->dc[0].f, xx = x, p = one, s = one;
 
 	if (x < zero)	return zero;
+	if (isinf(x))	return one;
 
-	xx *= o->s.f;
+	xx *= sa;
 	for (int nn = 1; nn < o->k; nn++) {
 		p *= (xx / nn);
 		s += p;
 	}
-	return one - s * expf(- o->s.f * x);
+	return one - s * LR_expf(- sa * x);
+}
+
+/*!
+@brief	LRf_erlang_QUANT(LR_obj *o, float u) - Erlang distribution
+quantile (inverse cumulative distribution function)
+
+The CDF is inverted by Halley's method, which takes 2 to 4 steps
+from the Wilson-Hilferty approximation.
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return float x where the CDF is u
+*/
+float LRf_erlang_QUANT(LR_obj *o, float u) {
+	return o->m.f * (float) LR_erlang_quant(o->k, u);
 }
 
 
@@ -98,6 +98,10 @@ char *LRstrerror(int LRerrno) {
 		return	"LibRan - Suspicious Value - Normalization Error?";
 	case	LRerr_AllocFail:
 		return	"LibRan - Memory Allocation Error";
+	case	LRerr_InvalidCDF:
+		return	"LibRan - Invalid CDF Function";
+	case	LRerr_SharedObject:
+		return	"LibRan - Shared Object is Read-Only";
 	}
 	return	"LibRan - Invalid errno";
 }
@@ -139,6 +143,10 @@ char *LRstrerrno(int LRerrno) {
 		return	"LRerr_SuspiciousValues";
 	case	LRerr_AllocFail:
 		return	"LRerr_AllocFail";
+	case	LRerr_InvalidCDF:
+		return	"LRerr_InvalidCDF";
+	case	LRerr_SharedObject:
+		return	"LRerr_SharedObject";
 	}
 	return	"";
 }
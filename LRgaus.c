@@ -58,6 +58,10 @@ extern "C" {
 
 #include <math.h>
 #include "libran.h"
+#include "LRmathf.h"
+#include "LRmathd.h"
+#include "LRkern.h"
+#include "LRquant.h"
 
 /* double */
 /*!
@@ -77,17 +81,61 @@ double LRd_gausbm_RAN(LR_obj *o) {
 		/* generate new pair - 1-U avoids possible overflow */
 		c = sqrt(ntwo * log(one - o->ud(o)));
 		z2 = twopi * o->ud(o);
-		z1 = c * sin(z2);
-		o->x.d = z2 = c * cos(z2);
-		return o->m.d + o->s.d * z1;
+		if (o->flags & LR_OBJ_FAST) {
+			LR_sincosd(z2, &z1, &z2);
+		} else {
+			z1 = sin(z2);
+			z2 = cos(z2);
+		}
+		z1 = c * z1;
+		o->x.d = z2 = c * z2;
+		return o->rc[0].d + o->rc[1].d * z1;
 	} else {
 		/* return saved variate */
 		c = o->x.d;
 		o->x.d = NAN;
-		return o->m.d + o->s.d * c;
+		return o->rc[0].d + o->rc[1].d * c;
 	}
 }
 
+/*!
+@brief	LRd_gausbm_RAN_n(LR_obj *o, double *x, long n) - a batch of double
+random Gaussian/Normal variates using the Box-Muller method
+(see \c LRd_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRd_gausbm_RAN_n(LR_obj *o, double *x, long n) {
+	double	one = 1.0, ntwo = -2.0, twopi = 2.0 * M_PI,
+		m = o->rc[0].d, s = o->rc[1].d, c, z;
+	long	np;
+
+	/* any saved variate first, then whole pairs */
+	if (n > 0 && !isnan(o->x.d)) {
+		*x++ = LRd_gausbm_RAN(o);
+		n--;
+	}
+	np = n / 2;
+	(void) LR_drand_n(o, x, 2*np);
+	if (o->flags & LR_OBJ_FAST) {
+		LR_kern_get()->dgausbm(x, np, m, s);
+	} else {
+		for (long i = 0; i < np; i++) {
+			c = sqrt(ntwo * log(one - x[2*i]));
+			z = twopi * x[2*i+1];
+			x[2*i] = m + s * (c * sin(z));
+			x[2*i+1] = m + s * (c * cos(z));
+		}
+	}
+	/* an odd one out saves the other of its pair */
+	if (n & 1)
+		x[n-1] = LRd_gausbm_RAN(o);
+	return LRerr_OK;
+}
+
 /* double */
 /*!
 @brief	LRd_gausmar_RAN(LR_obj *o) - double random Gaussian/Normal distribution
@@ -103,19 +151,22 @@ double LRd_gausmar_RAN(LR_obj *o) {
 	double s, z1, z2;
 
 	if (isnan(o->x.d)) {
-		do {
+		for (;;) {
 			z1 = two*o->ud(o) - one;
 			z2 = two*o->ud(o) - one;
 			s = z1*z1 + z2*z2;
-		} while (s > one);
+			if (!(s > one))
+				break;
+			LR_COUNT(o, rejections, 1);
+		}
 		s = sqrt(-two*log(s)/s);
 		o->x.d = z2 * s;
-		return o->m.d + o->s.d * z1 * s;
+		return o->rc[0].d + o->rc[1].d * z1 * s;
 	} else {
 		/* return saved variate */
 		s = o->x.d;
 		o->x.d = NAN;
-		return o->m.d + o->s.d * s;
+		return o->rc[0].d + o->rc[1].d * s;
 	}
 }
 
@@ -127,13 +178,10 @@ double LRd_gausmar_RAN(LR_obj *o) {
 @return double PDF at x
 */
 double LRd_gaus_PDF(LR_obj *o, double x) {
-	double	one = 1.0, half = .5,
-		is = one / o->s.d,
-		cc = half * M_2_SQRTPI * M_SQRT1_2 * is,
-		xm = (x - o->m.d) * is,
-		xx = xm * xm;
+	double	half = .5,
+		xm = (x - o->m.d) * o->dc[0].d;
 
-	return cc * exp(-half * xx);
+	return o->dc[1].d * exp(-half * xm * xm);
 }
 
 /*!
@@ -145,11 +193,24 @@ double LRd_gaus_PDF(LR_obj *o, double x) {
 */
 double LRd_gaus_CDF(LR_obj *o, double x) {
 	double	one = 1.0,
-		half = 0.5,
-		is = M_SQRT1_2 / o->s.d,
-		xm = (x - o->m.d) * is;
+		half = 0.5;
 
-	return half * (one + erf(xm));
+	x = (x - o->m.d) * o->dc[2].d;
+	return half * (one + ((o->flags & LR_OBJ_FAST) ? LR_erfd(x) : erf(x)));
+}
+
+/*!
+@brief	LRd_gaus_QUANT(LR_obj *o, double u) - double Gaussian/Normal quantile
+(inverse cumulative distribution function)
+
+Uses Wichura's algorithm AS241 (PPND16).
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return double x where the CDF is u
+*/
+double LRd_gaus_QUANT(LR_obj *o, double u) {
+	return o->m.d + o->s.d * LR_ppndd(u);
 }
 
 /* float */
@@ -168,19 +229,46 @@ float LRf_gausbm_RAN(LR_obj *o) {
 
 	if (isnan(o->x.f)) {
 		/* generate new pair - 1-U avoids possible overflow */
-		c = sqrt(ntwo * log(one - o->uf(o)));
-		z2 = twopi * o->uf(o);
-		z1 = c * sinf(z2);
-		o->x.f = z2 = c * cosf(z2);
-		return o->m.f + o->s.f * z1;
+		c = sqrtf(ntwo * LR_logf(one - o->uf(o)));
+		LR_sincosf(twopi * o->uf(o), &z1, &z2);
+		z1 = c * z1;
+		o->x.f = z2 = c * z2;
+		return o->rc[0].f + o->rc[1].f * z1;
 	} else {
 		/* return saved variate */
 		c = o->x.f;
 		o->x.f = NAN;
-		return o->m.f + o->s.f * c;
+		return o->rc[0].f + o->rc[1].f * c;
 	}
 }
 
+/*!
+@brief	LRf_gausbm_RAN_n(LR_obj *o, float *x, long n) - a batch of float
+random Gaussian/Normal variates using the Box-Muller method
+(see \c LRf_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRf_gausbm_RAN_n(LR_obj *o, float *x, long n) {
+	long	np;
+
+	/* any saved variate first, then whole pairs */
+	if (n > 0 && !isnan(o->x.f)) {
+		*x++ = LRf_gausbm_RAN(o);
+		n--;
+	}
+	np = n / 2;
+	(void) LR_frand_n(o, x, 2*np);
+	LR_kern_get()->fgausbm(x, np, o->rc[0].f, o->rc[1].f);
+	/* an odd one out saves the other of its pair */
+	if (n & 1)
+		x[n-1] = LRf_gausbm_RAN(o);
+	return LRerr_OK;
+}
+
 /*!
 @brief	LRf_gausmar_RAN(LR_obj *o) - float random Gaussian/Normal distribution
 using the Marsaglia method with acceptance-rejection.
@@ -195,19 +283,22 @@ float LRf_gausmar_RAN(LR_obj *o) {
 	float s, z1, z2;
 
 	if (isnan(o->x.f)) {
-		do {
-			z1 = two*o->ud(o) - one;
-			z2 = two*o->ud(o) - one;
+		for (;;) {
+			z1 = two*o->uf(o) - one;
+			z2 = two*o->uf(o) - one;
 			s = z1*z1 + z2*z2;
-		} while (s > one);
-		s = sqrtf(-two*logf(s)/s);
+			if (!(s > one))
+				break;
+			LR_COUNT(o, rejections, 1);
+		}
+		s = sqrtf(-two*LR_logf(s)/s);
 		o->x.f = z2 * s;
-		return o->m.f + o->s.f * z1 * s;
+		return o->rc[0].f + o->rc[1].f * z1 * s;
 	} else {
 		/* return saved variate */
 		s = o->x.f;
 		o->x.f = NAN;
-		return o->m.f + o->s.f * s;
+		return o->rc[0].f + o->rc[1].f * s;
 	}
 }
 
@@ -219,13 +310,10 @@ float LRf_gausmar_RAN(LR_obj *o) {
 @return float PDF at x
 */
 float LRf_gaus_PDF(LR_obj *o, float x) {
-	float	one = 1.0, half = .5,
-		is = one / o->s.f,
-		cc = half * M_2_SQRTPI * M_SQRT1_2 * is,
-		xm = (x - o->m.f) * is,
-		xx = xm * xm;
+	float	half = .5,
+		xm = (x - o->m.f) * o->dc[0].f;
 
-	return cc * expf(-half * xx);
+	return o->dc[1].f * LR_expf(-half * xm * xm);
 }
 
 /*!
@@ -237,11 +325,24 @@ float LRf_gaus_PDF(LR_obj *o, float x) {
 */
 float LRf_gaus_CDF(LR_obj *o, float x) {
 	float	one = 1.0,
-		half = 0.5,
-		is = M_SQRT1_2 / o->s.f,
-		xm = (x - o->m.f) * is;
+		half = 0.5;
+
+	x = (x - o->m.f) * o->dc[2].f;
+	return half * (one + ((o->flags & LR_OBJ_FAST) ? LR_erff(x) : erff(x)));
+}
+
+/*!
+@brief	LRf_gaus_QUANT(LR_obj *o, float u) - float Gaussian/Normal quantile
+(inverse cumulative distribution function)
+
+Uses Wichura's algorithm AS241 (PPND7).
 
-	return half * (one + erff(xm));
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return float x where the CDF is u
+*/
+float LRf_gaus_QUANT(LR_obj *o, float u) {
+	return o->m.f + o->s.f * LR_ppndf(u);
 }
 
 #ifdef __cplusplus
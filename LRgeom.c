@@ -53,7 +53,9 @@ extern "C" {
 #endif
 
 #include <math.h>
+#include <limits.h>
 #include "libran.h"
+#include "LRmathf.h"
 
 /* int */
 /*!
@@ -66,15 +68,13 @@ The random variate is generated using inversion and truncation.
 @return int
 */
 int LRi_geometric_RAN(LR_obj *o) {
-	float zero = 0.0, one = 1.0, u, p = one;
-	if (isnan(o->q))
-		o->q = one/logf(one - o->p);
+	float zero = 0.0, u, q = o->rc[0].f;
 
 	do {
 		u = o->uf(o);
 	} while (u == zero);
 
-	return ceilf(o->q * logf(u));
+	return ceilf(q * LR_logf(u));
 }
 
 /*!
@@ -86,14 +86,14 @@ probablity (or mass) distribution function
 @return float PDF at x
 */
 float LRi_geometric_PDF(LR_obj *o, int x) {
-	float zero = 0.0, one = 1.0, p = o->p;
+	float zero = 0.0, p = o->p;
 
 	if (x <= 0)	return zero;
 
 	if (x == 1) {
 		return p;
 	} else {
-		float q = one - p;
+		float q = o->dc[1].f;
 		for (int nn = 2; nn <= x; nn++) {
 			p *= q;
 		}
@@ -110,7 +110,7 @@ cumulative distribution function
 @return float CDF at x
 */
 float LRi_geometric_CDF(LR_obj *o, int x) {
-	float zero = 0.0, one = 1.0, q = one - o->p, p = q;
+	float zero = 0.0, one = 1.0, q = o->dc[1].f, p = q;
 
 	if (x <= 0)	return zero;
 
@@ -124,6 +124,25 @@ float LRi_geometric_CDF(LR_obj *o, int x) {
 	}
 }
 
+/*!
+@brief	LRi_geometric_QUANT(LR_obj *o, float u) - Geometric distribution
+quantile (inverse cumulative distribution function)
+
+Inverts the CDF in closed form,
+\f$ k = \lceil \log(1-u)/\log(1-p) \rceil \f$.
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return int smallest k where the CDF is at least u
+*/
+int LRi_geometric_QUANT(LR_obj *o, float u) {
+	double k = ceil(log1p(- (double) u) / log1p(- (double) o->p));
+
+	if (k < 1.0)	return 1;
+	if (!(k < INT_MAX))	return INT_MAX;
+	return k;
+}
+
 #ifdef __cplusplus
 }
 #endif
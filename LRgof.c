@@ -0,0 +1,745 @@
+/*!
+\file	LRgof.c
+\brief	Goodness-of-fit tests of samples against an `LR_obj` distribution
+
+These functions test whether samples follow the distribution of a given
+`LR_obj` object, using its CDF, and return the p-value (the probability
+of a test statistic at least as extreme if they do).
+A p-value that is very small (e.g. < 0.001) indicates the samples don't
+follow the distribution.
+
+Chi-square
+----------
+
+\c LR_gof_chisq() compares the tallies of an `LR_bin` object with the
+expected counts \f$ E_i = N \left[F(x_{i+1}) - F(x_i)\right] \f$ ,
+\f[ \chi^2 = \sum_i \frac{(O_i - E_i)^2}{E_i} \f]
+where adjacent bins are pooled until each expects at least 5 samples.
+For the discrete distributions the bin \f$ [x_i,x_{i+1}) \f$ holds
+the integers within it.
+
+Kolmogorov-Smirnov and Anderson-Darling
+---------------------------------------
+
+\c LR_gof_ks() and \c LR_gof_ad() sort an array of samples and
+compare its empirical CDF with the distribution CDF through the
+statistics
+\f[ D = \sup_x |F_n(x) - F(x)| \f]
+and
+\f[ A^2 = -n - \frac{1}{n} \sum_{i=1}^n (2i-1)
+	\left[\ln F(x_{(i)}) + \ln(1 - F(x_{(n+1-i)}))\right] \f]
+(the latter giving more weight to the tails).  The KS p-value uses
+the Kolmogorov distribution with Stephens' correction for \e n , the AD
+p-value the asymptotic distribution of Marsaglia and Marsaglia (2004).
+They only apply to the continuous distributions.
+For a float distribution the CDF values are kept within
+[\e eps/2, 1 - \e eps/2] so the float roundoff in the far tails
+doesn't give an infinite \f$ A^2 \f$ .
+
+Streaming many samples
+----------------------
+
+Sorting all the samples isn't possible for very many of them,
+so the `LR_gof` object tests a stream of samples in \e batches .
+\c LR_gof_add_n() tallies the samples for the chi-square test and
+collects them into batches of \e m values, each of which is
+KS and AD tested as it fills.  The batch p-values are
+combined with Fisher's method
+\f$ X = -2 \sum \ln p_j \f$ , which is \f$ \chi^2 \f$ distributed with
+twice as many degrees of freedom as batches, to give the overall
+p-values of \c LR_gof_pks() and \c LR_gof_pad() .
+Partial results (e.g. one per thread) are combined with
+\c LR_gof_merge() , and \c LR_gof_spec() does that for any number
+of samples generated from an `LR_spec` object in several threads.
+
+\code
+#include <stdio.h>
+#include "libran.h"
+...
+LR_obj *o = LR_new(gausbm, LR_double);
+LR_set_all(o, "ms", 1., 2.);
+LR_obj *ref = LR_new(gausbm, LR_double);
+LR_set_all(ref, "ms", 1., 2.);
+// 1000 equal probability bins, and the default batch size
+LR_gof *g = LR_gof_new(ref, 1000, 0);
+LR_spec *s = LR_spec_new(&o);
+// 10^9 samples in 8 threads
+LR_gof_spec(g, s, 1000000000l, 8, 12345l);
+double chi2; int df;
+printf("chi-square p = %g KS p = %g AD p = %g\n",
+	LR_gof_pchisq(g, &chi2, &df), LR_gof_pks(g), LR_gof_pad(g));
+...
+LR_gof_rm(&g);
+LR_spec_rm(&s);
+\endcode
+
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>	/* malloc,realloc,qsort,free */
+#include <string.h>	/* memcpy */
+#include <math.h>	/* exp(),log(),lgamma(),sqrt() */
+#include <pthread.h>
+#include "libran.h"
+#include "urand/config.h"	/* LR_DEPS, LR_FEPS */
+
+#define LR_GOF_BINS	100	/* default number of chi-square bins */
+#define LR_GOF_BATCH	(1 << 20)	/* default KS/AD batch size */
+#define LR_GOF_MINBATCH	8	/* smallest batch worth testing */
+#define LR_GOF_MINEXP	5.0	/* smallest expected bin count */
+#define LR_GOF_CHUNK	4096	/* samples generated at a time */
+
+/* for qsort() */
+static int LR_gof_cmp(const void *a, const void *b) {
+	double	x = *((const double *) a), y = *((const double *) b);
+	return (x > y) - (x < y);
+}
+
+/* P(X < x) of o for any data type */
+static double LR_gof_below(LR_obj *o, double x) {
+	double	one = 1.0, k;
+
+	if (o->d == LR_double)
+		return o->ops->cdfd(o, x);
+	else if (o->d == LR_float)
+		return (double) o->ops->cdff(o, (float) x);
+	/* integers below x */
+	if (isinf(x))
+		return (x < 0 ? 0.0 : one);
+	k = ceil(x) - one;
+	if (k < -2147483647.0)
+		return 0.0;
+	if (k > 2147483647.0)
+		return one;
+	return (double) o->ops->cdfi(o, (int) k);
+}
+
+/*!
+@brief	LR_gammq(double a, double x) - regularized upper incomplete gamma
+function
+
+\f$ Q(a,x) = \Gamma(a,x)/\Gamma(a) \f$ by its series (x < a+1)
+or continued fraction.
+This gives the upper tail of the chi-square distribution,
+\f$ Q(\nu/2, \chi^2/2) \f$ , and the Poisson CDF,
+\f$ P(Y < k) = Q(k, \lambda) \f$ .
+
+@param	a	parameter (> 0)
+@param	x	value (>= 0)
+@return	Q(a,x), or NAN if x < 0
+*/
+double LR_gammq(double a, double x) {
+	double	zero = 0.0, one = 1.0, two = 2.0,
+		eps = LR_DEPS, tiny = 1e-300, ln, s, t, b, c, d, h, an;
+
+	if (!(x > zero))
+		return (x == zero ? one : NAN);
+	if (isinf(x))
+		return zero;
+	ln = a * log(x) - x - lgamma(a);
+	if (x < a + one) {
+		s = t = one / a;
+		for (int i = 1; i < 10000; i++) {
+			t *= x / (a + i);
+			s += t;
+			if (fabs(t) < fabs(s) * eps)
+				break;
+		}
+		return one - s * exp(ln);
+	}
+	/* modified Lentz */
+	b = x + one - a;
+	c = one / tiny;
+	d = one / b;
+	h = d;
+	for (int i = 1; i < 10000; i++) {
+		an = -i * (i - a);
+		b += two;
+		d = an * d + b;
+		d = (fabs(d) < tiny ? tiny : d);
+		c = b + an / c;
+		c = (fabs(c) < tiny ? tiny : c);
+		d = one / d;
+		t = d * c;
+		h *= t;
+		if (fabs(t - one) < eps)
+			break;
+	}
+	return exp(ln) * h;
+}
+
+/* upper tail of chi-square with df degrees of freedom */
+static double LR_gof_qchi2(double x, double df) {
+	return LR_gammq(0.5 * df, 0.5 * x);
+}
+
+/* upper tail of the Kolmogorov distribution */
+static double LR_gof_qks(double lam) {
+	double	zero = 0.0, one = 1.0, two = 2.0, pi = M_PI, y, p;
+
+	if (lam < 0.2)
+		return one;
+	if (lam < 1.18) {
+		y = exp(-pi * pi / (8.0 * lam * lam));
+		p = sqrt(two * pi) / lam * y * (one + pow(y, 8.0)
+			+ pow(y, 24.0) + pow(y, 48.0));
+		p = one - p;
+	} else {
+		y = exp(-two * lam * lam);
+		p = two * (y - pow(y, 4.0) + pow(y, 9.0) - pow(y, 16.0));
+	}
+	return (p < zero ? zero : (p > one ? one : p));
+}
+
+/* upper tail of the asymptotic Anderson-Darling distribution
+ * (Marsaglia and Marsaglia, J. Stat. Software 9(2), 2004) */
+static double LR_gof_qad(double z) {
+	double	zero = 0.0, one = 1.0, two = 2.0, p;
+
+	if (!(z > zero))
+		return (z == zero ? one : NAN);
+	if (isinf(z))
+		return zero;
+	if (z < two)
+		p = exp(-1.2337141 / z) / sqrt(z) * (2.00012 + (.247105
+			- (.0649821 - (.0347962 - (.011672 - .00168691 * z)
+			* z) * z) * z) * z);
+	else
+		p = exp(-exp(1.0776 - (2.30695 - (.43424 - (.082433
+			- (.008056 - .0003146 * z) * z) * z) * z) * z));
+	p = one - p;
+	return (p < zero ? zero : (p > one ? one : p));
+}
+
+/* the CDF of the sorted samples, kept off 0 and 1 for float */
+static void LR_gof_cdfs(LR_obj *o, const double *x, double *u, size_t n) {
+	double	one = 1.0, e = 0.5 * LR_FEPS;
+
+	for (size_t i = 0; i < n; i++)
+		u[i] = LR_gof_below(o, x[i]);
+	if (o->d == LR_float) {
+		for (size_t i = 0; i < n; i++)
+			u[i] = (u[i] < e ? e : (u[i] > one - e ? one - e : u[i]));
+	}
+}
+
+/* KS statistic and p-value from the sorted CDF values */
+static double LR_gof_ks_u(const double *u, size_t n, double *d) {
+	double	dn = (double) n, dmax = 0.0, t, sn;
+
+	for (size_t i = 0; i < n; i++) {
+		t = (i + 1) / dn - u[i];
+		dmax = (t > dmax ? t : dmax);
+		t = u[i] - i / dn;
+		dmax = (t > dmax ? t : dmax);
+	}
+	if (d)
+		*d = dmax;
+	sn = sqrt(dn);
+	return LR_gof_qks((sn + 0.12 + 0.11 / sn) * dmax);
+}
+
+/* AD statistic and p-value from the sorted CDF values */
+static double LR_gof_ad_u(const double *u, size_t n, double *a2) {
+	double	dn = (double) n, s = 0.0, a;
+
+	for (size_t i = 0; i < n; i++)
+		s += (2.0 * i + 1.0) * (log(u[i]) + log1p(-u[n - 1 - i]));
+	a = -dn - s / dn;
+	if (isnan(a))
+		a = INFINITY;	/* a CDF value of 0 or 1 */
+	if (a2)
+		*a2 = a;
+	return LR_gof_qad(a);
+}
+
+/* sort x, find the CDF values - u may be x */
+static int LR_gof_prep(LR_obj *o, double *x, double *u, size_t n) {
+	if (!o || !x || n < 1)
+		return LRerr_Unspecified;
+	if (o->d == LR_int)
+		return o->errno = LRerr_BadDataType;
+	qsort(x, n, sizeof(double), LR_gof_cmp);
+	if (isnan(x[n - 1]))
+		return o->errno = LRerr_InvalidInputValue;
+	LR_gof_cdfs(o, x, u, n);
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_gof_ks(LR_obj *o, double *x, size_t n, double *d) -
+Kolmogorov-Smirnov test
+
+The array of samples is sorted in place.
+
+@param	o	LR_obj object with a continuous distribution
+@param	x	array of samples
+@param	n	number of samples
+@param	d	where to store the statistic \e D (if not NULL)
+@return	p-value, or NAN if failed
+*/
+double LR_gof_ks(LR_obj *o, double *x, size_t n, double *d) {
+	double	*u, p;
+
+	if (!(u = (double *) malloc(n * sizeof(double))))
+		return NAN;
+	p = (LR_gof_prep(o, x, u, n) ? NAN : LR_gof_ks_u(u, n, d));
+	free((void *) u);
+	return p;
+}
+
+/*!
+@brief	LR_gof_ad(LR_obj *o, double *x, size_t n, double *a2) -
+Anderson-Darling test
+
+The array of samples is sorted in place.
+
+@param	o	LR_obj object with a continuous distribution
+@param	x	array of samples
+@param	n	number of samples
+@param	a2	where to store the statistic \f$ A^2 \f$ (if not NULL)
+@return	p-value, or NAN if failed
+*/
+double LR_gof_ad(LR_obj *o, double *x, size_t n, double *a2) {
+	double	*u, p;
+
+	if (!(u = (double *) malloc(n * sizeof(double))))
+		return NAN;
+	p = (LR_gof_prep(o, x, u, n) ? NAN : LR_gof_ad_u(u, n, a2));
+	free((void *) u);
+	return p;
+}
+
+/*!
+@brief	LR_gof_chisq(LR_obj *o, const LR_bin *b, double *chi2, int *df) -
+chi-square test
+
+The bin tallies are compared with the expected counts from the CDF,
+pooling adjacent bins until each expects at least 5 samples.
+A bin expecting no samples that has some gives a p-value of 0.
+
+@param	o	LR_obj object
+@param	b	LR_bin object with the tallies
+@param	chi2	where to store the statistic (if not NULL)
+@param	df	where to store the degrees of freedom (if not NULL)
+@return	p-value, or NAN if failed
+*/
+double LR_gof_chisq(LR_obj *o, const LR_bin *b, double *chi2, int *df) {
+	double	zero = 0.0, nn, f0, f1, e = zero, x2 = zero;
+	long	obs = 0;
+	int	k = 0;
+
+	if (!o || !b)
+		return NAN;
+	if (b->c < 1)
+		return NAN;
+	nn = (double) b->c;
+	f0 = zero;
+	for (int i = 0; i < b->nn; i++) {
+		f1 = (i < b->nn - 1 ? LR_gof_below(o, b->bdrs[i]) : 1.0);
+		if (isnan(f1))
+			return NAN;
+		e += nn * (f1 - f0);
+		obs += b->bins[i];
+		f0 = f1;
+		if (e >= LR_GOF_MINEXP && nn * (1.0 - f1) >= LR_GOF_MINEXP) {
+			x2 += (obs - e) * (obs - e) / e;
+			e = zero;
+			obs = 0;
+			k++;
+		}
+	}
+	/* the remainder */
+	if (e > zero) {
+		x2 += (obs - e) * (obs - e) / e;
+		k++;
+	} else if (obs) {
+		x2 = INFINITY;
+	}
+	if (chi2)
+		*chi2 = x2;
+	if (df)
+		*df = k - 1;
+	if (k < 2)
+		return NAN;
+	return LR_gof_qchi2(x2, k - 1);
+}
+
+/*!
+@brief	LR_gof_new(LR_obj *o, int nbins, size_t m) - create a new
+goodness-of-fit object
+
+The samples are to be tested against the distribution of the `LR_obj`
+object \e o (which must not be removed before the `LR_gof` object).
+The chi-square test uses \e nbins bins of equal probability (see
+\c LR_bin_new_quantile()), and the KS and AD tests batches of \e m
+samples.
+
+@param	o	LR_obj object
+@param	nbins	number of chi-square bins (0 for the default of 100)
+@param	m	batch size (0 for the default of 2^20)
+@return	LR_gof object if successful, else NULL
+*/
+LR_gof *LR_gof_new(LR_obj *o, int nbins, size_t m) {
+	LR_gof *ptr = (void *) NULL;
+
+	if (!o || nbins < 0 || (m && m < LR_GOF_MINBATCH))
+		return ptr;
+	if (!(ptr = (LR_gof *) calloc(1, sizeof(LR_gof))))
+		return ptr;
+	ptr->o = o;
+	ptr->m = (m ? m : LR_GOF_BATCH);
+	if (!(ptr->b = LR_bin_new_quantile(o, (nbins ? nbins : LR_GOF_BINS))))
+		goto bad0;
+	if (o->d != LR_int
+	&& !(ptr->buf = (double *) malloc(ptr->m * sizeof(double))))
+		goto bad1;
+	return ptr;
+
+bad1:
+	LR_bin_rm(&(ptr->b));
+bad0:
+	free((void *) ptr);
+	return (void *) NULL;
+}
+
+/* a new empty object like g */
+static LR_gof *LR_gof_clone_empty(const LR_gof *g) {
+	LR_gof *ptr = (void *) NULL;
+
+	if (!(ptr = (LR_gof *) calloc(1, sizeof(LR_gof))))
+		return ptr;
+	ptr->o = g->o;
+	ptr->m = g->m;
+	if (!(ptr->b = LR_bin_clone_empty(g->b)))
+		goto bad0;
+	if (g->buf && !(ptr->buf = (double *) malloc(ptr->m * sizeof(double))))
+		goto bad1;
+	return ptr;
+
+bad1:
+	LR_bin_rm(&(ptr->b));
+bad0:
+	free((void *) ptr);
+	return (void *) NULL;
+}
+
+/*!
+@brief	LR_gof_rm(LR_gof **g) - remove goodness-of-fit object
+
+@param	g	LR_gof object address
+@return	0 if successful, else non-zero if failed
+*/
+int LR_gof_rm(LR_gof **g) {
+	if (g && *g) {
+		LR_bin_rm(&((*g)->b));
+		free((void *) (*g)->buf);
+		free((void *) (*g)->pks);
+		free((void *) (*g)->pad);
+		free((void *) *g);
+		*g = (LR_gof *) NULL;
+		return LRerr_OK;
+	}
+	return LRerr_Unspecified;
+}
+
+/* KS and AD test the batch in the buffer */
+static int LR_gof_batch(LR_gof *g) {
+	double	*p;
+	size_t	n = g->nbuf;
+
+	if (n < LR_GOF_MINBATCH)
+		return LRerr_OK;
+	if (g->nb == g->mb) {
+		int mb = (g->mb ? 2 * g->mb : 64);
+		if (!(p = (double *) realloc(g->pks, mb * sizeof(double))))
+			return g->errno = LRerr_AllocFail;
+		g->pks = p;
+		if (!(p = (double *) realloc(g->pad, mb * sizeof(double))))
+			return g->errno = LRerr_AllocFail;
+		g->pad = p;
+		g->mb = mb;
+	}
+	qsort(g->buf, n, sizeof(double), LR_gof_cmp);
+	LR_gof_cdfs(g->o, g->buf, g->buf, n);
+	g->pks[g->nb] = LR_gof_ks_u(g->buf, n, (double *) NULL);
+	g->pad[g->nb] = LR_gof_ad_u(g->buf, n, (double *) NULL);
+	g->nb++;
+	g->nbuf = 0;
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_gof_add_n(LR_gof *g, const double *x, size_t n) - add an array
+of samples
+
+The samples are tallied for the chi-square test and, for a continuous
+distribution, collected into batches for the KS and AD tests, each
+batch being tested as it fills.
+NaN values are not added and raise an error, but the remaining
+values are still added.
+
+@param	g	LR_gof object
+@param	x	array of samples
+@param	n	number of samples
+@return	0 if successful, else non-zero if failed
+*/
+int LR_gof_add_n(LR_gof *g, const double *x, size_t n) {
+	int	ret;
+
+	if (!g || !x)
+		return LRerr_Unspecified;
+	ret = LR_bin_add_n(g->b, x, n);
+	g->n = g->b->c;
+	if (!g->buf)
+		return (ret ? (g->errno = ret) : LRerr_OK);
+	for (size_t i = 0; i < n; i++) {
+		if (isnan(x[i]))
+			continue;
+		g->buf[g->nbuf++] = x[i];
+		if (g->nbuf == g->m && LR_gof_batch(g))
+			return g->errno;
+	}
+	return (ret ? (g->errno = ret) : LRerr_OK);
+}
+
+/*!
+@brief	LR_gof_merge(LR_gof *dst, const LR_gof *src) - add the results
+of one goodness-of-fit object to another
+
+Both must have been created for the same distribution and bins
+(e.g. with the same arguments to \c LR_gof_new()).
+The batch results are combined, and any partial batch of \e src
+is added to that of \e dst .
+
+@param	dst	LR_gof object to add to
+@param	src	LR_gof object to add
+@return	0 if successful, else non-zero if failed
+*/
+int LR_gof_merge(LR_gof *dst, const LR_gof *src) {
+	double	*p;
+	int	mb;
+
+	if (!dst || !src)
+		return LRerr_Unspecified;
+	if (dst->m != src->m)
+		return dst->errno = LRerr_InvalidRange;
+	if (LR_bin_merge(dst->b, src->b))
+		return dst->errno = dst->b->errno;
+	dst->n = dst->b->c;
+	if (src->nb) {
+		if (dst->nb + src->nb > dst->mb) {
+			mb = dst->nb + src->nb;
+			if (!(p = (double *) realloc(dst->pks, mb * sizeof(double))))
+				return dst->errno = LRerr_AllocFail;
+			dst->pks = p;
+			if (!(p = (double *) realloc(dst->pad, mb * sizeof(double))))
+				return dst->errno = LRerr_AllocFail;
+			dst->pad = p;
+			dst->mb = mb;
+		}
+		(void) memcpy(dst->pks + dst->nb, src->pks, src->nb * sizeof(double));
+		(void) memcpy(dst->pad + dst->nb, src->pad, src->nb * sizeof(double));
+		dst->nb += src->nb;
+	}
+	if (dst->buf && src->buf) {
+		for (size_t i = 0; i < src->nbuf; i++) {
+			dst->buf[dst->nbuf++] = src->buf[i];
+			if (dst->nbuf == dst->m && LR_gof_batch(dst))
+				return dst->errno;
+		}
+	}
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_gof_flush(LR_gof *g) - test the partial batch
+
+Any samples left in a partial batch are KS and AD tested as a batch of
+their own (if there are at least 8).  Typically called once after all
+the samples have been added, when the number of samples isn't a
+multiple of the batch size.
+
+@param	g	LR_gof object
+@return	0 if successful, else non-zero if failed
+*/
+int LR_gof_flush(LR_gof *g) {
+	if (!g)
+		return LRerr_Unspecified;
+	if (!g->buf || !g->nbuf)
+		return LRerr_OK;
+	return LR_gof_batch(g);
+}
+
+/*!
+@brief	LR_gof_pchisq(LR_gof *g, double *chi2, int *df) - chi-square
+p-value of all the samples
+
+@param	g	LR_gof object
+@param	chi2	where to store the statistic (if not NULL)
+@param	df	where to store the degrees of freedom (if not NULL)
+@return	p-value, or NAN if not available
+*/
+double LR_gof_pchisq(LR_gof *g, double *chi2, int *df) {
+	if (!g)
+		return NAN;
+	return LR_gof_chisq(g->o, g->b, chi2, df);
+}
+
+/* Fisher's combination of p-values */
+static double LR_gof_fisher(const double *p, int n) {
+	double	x = 0.0;
+
+	if (n < 1)
+		return NAN;
+	if (n == 1)
+		return p[0];
+	for (int i = 0; i < n; i++)
+		x -= 2.0 * log(p[i]);
+	return LR_gof_qchi2(x, 2.0 * n);
+}
+
+/*!
+@brief	LR_gof_pks(LR_gof *g) - Kolmogorov-Smirnov p-value of the batches
+
+The p-values of the KS tested batches combined by Fisher's method.
+
+@param	g	LR_gof object
+@return	p-value, or NAN if no batches have been tested
+*/
+double LR_gof_pks(LR_gof *g) {
+	if (!g)
+		return NAN;
+	return LR_gof_fisher(g->pks, g->nb);
+}
+
+/*!
+@brief	LR_gof_pad(LR_gof *g) - Anderson-Darling p-value of the batches
+
+The p-values of the AD tested batches combined by Fisher's method.
+
+@param	g	LR_gof object
+@return	p-value, or NAN if no batches have been tested
+*/
+double LR_gof_pad(LR_gof *g) {
+	if (!g)
+		return NAN;
+	return LR_gof_fisher(g->pad, g->nb);
+}
+
+/* per thread work for LR_gof_spec() */
+typedef struct {
+	LR_spec	*s;
+	LR_gof	*g;
+	long	n;
+	long	seed;
+	int	ret;
+} LR_gof_thr;
+
+static void *LR_gof_run(void *arg) {
+	LR_gof_thr *a = (LR_gof_thr *) arg;
+	LR_obj	*o;
+	double	x[LR_GOF_CHUNK];
+	long	k, m;
+
+	if (!(o = LR_stream_new(a->s))) {
+		a->ret = LRerr_AllocFail;
+		return NULL;
+	}
+	LR_lsetseed(o, a->seed);
+	for (k = 0; k < a->n; k += m) {
+		m = (a->n - k < LR_GOF_CHUNK ? a->n - k : LR_GOF_CHUNK);
+		if (o->d == LR_double) {
+			if ((a->ret = LRd_RAN_n(o, x, m)))
+				break;
+		} else if (o->d == LR_float) {
+			for (long i = 0; i < m; i++)
+				x[i] = (double) LRf_RAN(o);
+		} else {
+			for (long i = 0; i < m; i++)
+				x[i] = (double) LRi_RAN(o);
+		}
+		if ((a->ret = LR_gof_add_n(a->g, x, m)))
+			break;
+	}
+	(void) LR_rm(&o);
+	return NULL;
+}
+
+/*!
+@brief	LR_gof_spec(LR_gof *g, LR_spec *s, long n, int nthreads,
+long seed) - test samples generated from a spec
+
+Generates \e n samples from streams of the `LR_spec` object
+(see \c LR_stream_new()) in \e nthreads threads, each seeded with
+\e seed plus twice its thread number, and adds them to \e g .
+Double samples are made with \c LRd_RAN_n() , so the batch kernels
+are tested too.  The results for the same arguments are repeatable.
+Call \c LR_gof_flush() afterwards to also test the last partial batch.
+
+@param	g	LR_gof object
+@param	s	LR_spec object
+@param	n	number of samples
+@param	nthreads	number of threads (at least 1)
+@param	seed	seed for the first thread
+@return	0 if successful, else non-zero if failed
+*/
+int LR_gof_spec(LR_gof *g, LR_spec *s, long n, int nthreads, long seed) {
+	pthread_t	*th;
+	LR_gof_thr	*par;
+	int		ret = LRerr_OK, *run;
+
+	if (!g || !s || n < 0 || nthreads < 1)
+		return LRerr_Unspecified;
+	th = (pthread_t *) malloc(nthreads * sizeof(pthread_t));
+	par = (LR_gof_thr *) calloc(nthreads, sizeof(LR_gof_thr));
+	run = (int *) calloc(nthreads, sizeof(int));
+	if (!th || !par || !run) {
+		ret = g->errno = LRerr_AllocFail;
+		goto done;
+	}
+	for (int i = 0; i < nthreads; i++) {
+		par[i].s = s;
+		par[i].n = n / nthreads + (i < n % nthreads);
+		par[i].seed = seed + 2l * i;
+		if (!(par[i].g = LR_gof_clone_empty(g))) {
+			ret = g->errno = LRerr_AllocFail;
+			goto done;
+		}
+	}
+	for (int i = 0; i < nthreads; i++) {
+		/* if a thread can't be started do the work here */
+		if (pthread_create(&th[i], NULL, LR_gof_run, &par[i]))
+			(void) LR_gof_run(&par[i]);
+		else
+			run[i] = 1;
+	}
+	for (int i = 0; i < nthreads; i++) {
+		if (run[i])
+			(void) pthread_join(th[i], NULL);
+		if (par[i].ret && !ret)
+			ret = g->errno = par[i].ret;
+	}
+	/* combine in thread order so the results are repeatable */
+	for (int i = 0; i < nthreads && !ret; i++)
+		ret = LR_gof_merge(g, par[i].g);
+
+done:
+	if (par)
+		for (int i = 0; i < nthreads; i++)
+			(void) LR_gof_rm(&(par[i].g));
+	free((void *) run);
+	free((void *) par);
+	free((void *) th);
+	return ret;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -143,6 +143,24 @@ Note that this distribution uses the \e mean and \e deviation to identify
 the distribution characteristics.  It is understood that the lower
 bound is \f$ m - s \f$ and the upper bound is \f$ m + s \f$.
 
+GSNN
+====
+
+The general \e gsnN variate sums \f$ k \f$ uniform random variates,
+for any order \f$ 1 \le k \le \f$ \c LR_GSN_MAX (24), set with
+the \e k attribute (default 12).  Like \e gsn12 it is scaled to the
+mean \e m and standard deviation \e s , so its bounds are
+\f$ m \pm s \sqrt{3k} \f$ and a larger order follows the Gaussian further
+into the tails at the cost of more uniforms per variate.
+
+The default values are \f$ k = 12 \f$, \f$ m = 0 \f$ and \f$ s = 1 \f$.
+
+The PDF and CDF coefficients of every order (including \e gsn4 and
+\e gsn12 ) are computed exactly beforehand (by aux/gsn.c into
+LRgsntab.h) so there is nothing to set up at run time.
+The batch RAN methods (see \c LRd_RAN_n() ) of all the \e gsn types
+draw all the uniforms first and sum them in vectorized loops.
+
 \see LRgaus.c
 
 */
@@ -155,7 +173,11 @@ extern "C" {
 #endif
 
 #include <math.h>
+#include <float.h>
 #include "libran.h"
+#include "LRkern.h"
+#include "LRquant.h"
+#include "LRgsntab.h"	/* generated by aux/gsn.c */
 
 /*!
 @brief	LRd_gsn2_RAN(LR_obj *o) - double random g2 gaussian-like (saw tooth)
@@ -167,9 +189,7 @@ Default range: [a,b) = [-1,1)
 @return double
 */
 double LRd_gsn2_RAN(LR_obj *o) {
-	double half = .5;
-	double sa = half * (o->b.d - o->a.d);
-	return o->a.d + sa * (o->ud(o) + o->ud(o));
+	return o->rc[0].d + o->rc[1].d * (o->ud(o) + o->ud(o));
 }
 
 /*!
@@ -181,9 +201,8 @@ probablity distribution function
 @return double PDF at x
 */
 double LRd_gsn2_PDF(LR_obj *o, double x) {
-	double	zero = 0.0, one = 1.0, two = 2.0, half = .5;
-	double	mm = half*(o->b.d - o->a.d),
-		sa = one/mm,
+	double	zero = 0.0, one = 1.0, two = 2.0;
+	double	sa = o->dc[1].d,
 		xx = sa * (x - o->a.d);
 
 	if (xx <= zero || xx >= two) {
@@ -205,8 +224,7 @@ cumulative distribution function
 */
 double LRd_gsn2_CDF(LR_obj *o, double x) {
 	double	zero = 0.0, one = 1.0, two = 2.0, half = .5;
-	double	mm = half*(o->b.d - o->a.d),
-		sa = one/mm,
+	double	sa = o->dc[1].d,
 		xx = sa * (x - o->a.d);
 
 	if (xx <= zero) {
@@ -232,9 +250,7 @@ Default range: [a,b) = [-1,1)
 @return float
 */
 float LRf_gsn2_RAN(LR_obj *o) {
-	float half = .5;
-	float sa = half * (o->b.f - o->a.f);
-	return o->a.f + sa * (o->uf(o) + o->uf(o));
+	return o->rc[0].f + o->rc[1].f * (o->uf(o) + o->uf(o));
 }
 
 /*!
@@ -246,9 +262,8 @@ probablity distribution function
 @return float PDF at x
 */
 float LRf_gsn2_PDF(LR_obj *o, float x) {
-	float	zero = 0.0, one = 1.0, two = 2.0, half = .5;
-	float	mm = half*(o->b.f - o->a.f),
-		sa = one/mm,
+	float	zero = 0.0, one = 1.0, two = 2.0;
+	float	sa = o->dc[1].f,
 		xx = sa * (x - o->a.f);
 
 	if (xx <= zero || xx >= two) {
@@ -270,8 +285,7 @@ cumulative distribution function
 */
 float LRf_gsn2_CDF(LR_obj *o, float x) {
 	float	zero = 0.0, one = 1.0, two = 2.0, half = .5;
-	float	mm = half*(o->b.f - o->a.f),
-		sa = one/mm,
+	float	sa = o->dc[1].f,
 		xx = sa * (x - o->a.f);
 
 	if (xx <= zero) {
@@ -287,80 +301,6 @@ float LRf_gsn2_CDF(LR_obj *o, float x) {
 	}
 }
 
-/* gsn4 - data */
-
-int gscdfn4[5][5] = {
-  {0,0,0,0,1},
-  {1,1,1,1,-1},
-  {1,2,0,-1,1},
-  {23,1,-1,1,-1},
-  {1,0,0,0,0}
-};
-
-int gscdfd4[5][5] = {
-  {1,1,1,1,24},
-  {24,6,4,6,8},
-  {2,3,1,3,8},
-  {24,6,4,6,24},
-  {1,1,1,1,1}
-};
-
-int gspdfn4[5][5] = {
-  {0,0,0,1,0},
-  {1,1,1,-1,0},
-  {2,0,-1,1,0},
-  {1,-1,1,-1,0},
-  {0,0,0,0,0}
-};
-
-int gspdfd4[5][5] = {
-  {1,1,1,6,1},
-  {6,2,2,2,1},
-  {3,1,1,2,1},
-  {6,2,2,6,1},
-  {1,1,1,1,1}
-};
-
-
-double gspdf4d[5][5] = {
-	NAN
-};
-
-double gscdf4d[5][5] = {
-	NAN
-};
-
-float gspdf4f[5][5] = {
-	NAN
-};
-
-float gscdf4f[5][5] = {
-	NAN
-};
-
-/* set up coefs from rational integers */
-int gs4initd(void) {
-	for (int i = 0; i < 5; i++) {
-		for (int j = 0; j < 5; j++) {
-			gspdf4d[i][j] = ((double) gspdfn4[i][j])
-				/ ((double) gspdfd4[i][j]);
-			gscdf4d[i][j] = ((double) gscdfn4[i][j])
-				/ ((double) gscdfd4[i][j]);
-		}
-	}
-}
-
-int gs4initf(void) {
-	for (int i = 0; i < 5; i++) {
-		for (int j = 0; j < 5; j++) {
-			gspdf4f[i][j] = ((float) gspdfn4[i][j])
-				/ ((float) gspdfd4[i][j]);
-			gscdf4f[i][j] = ((float) gscdfn4[i][j])
-				/ ((float) gscdfd4[i][j]);
-		}
-	}
-}
-
 /*!
 @brief	LRd_gsn4_RAN(LR_obj *o) - double random g4 gaussian-like
 (simple bell curve) distribution
@@ -371,10 +311,7 @@ Default range: [a,b) = [-2,2)
 @return double
 */
 double LRd_gsn4_RAN(LR_obj *o) {
-	double fourth = .25;
-	double sa = fourth * (o->b.d - o->a.d);
-
-	return o->a.d + sa * (o->ud(o) + o->ud(o) + o->ud(o) + o->ud(o));
+	return o->rc[0].d + o->rc[1].d * (o->ud(o) + o->ud(o) + o->ud(o) + o->ud(o));
 }
 
 /*!
@@ -386,22 +323,20 @@ double LRd_gsn4_RAN(LR_obj *o) {
 @return double PDF at x
 */
 double LRd_gsn4_PDF(LR_obj *o, double x) {
-	double	zero = 0.0, one = 1.0, two = 2.0, four = 4.0;
-	double	mm = o->b.d - o->a.d,
-		sa = four/mm,
+	double	zero = 0.0, two = 2.0;
+	double	sa = o->dc[1].d,
 		xx = sa * (x - o->a.d) - two;
 
-	if (isnan(gspdf4d[0][0]))	gs4initd();
-
 	if (xx <= -two || xx >= two) {
 		return zero;
 	} else {
 		int i = xx + two;		/* truncate */
 		double xt = xx + two - i;	/* translate to [0-1] */
-		double r = gspdf4d[i][4];
+		const double *c = LR_gsn_pdfd + LR_gsn_off[4] + 5*i;
+		double r = c[4];
 		/* horners rule to evaluate polynomial */
 		for (int j = 3; j >= 0; j--) {
-			r = (gspdf4d[i][j] + xt*r);
+			r = (c[j] + xt*r);
 		}
 		return sa * r;
 	}
@@ -416,13 +351,10 @@ cumulative distribution function
 @return double CDF at x
 */
 double LRd_gsn4_CDF(LR_obj *o, double x) {
-	double	zero = 0.0, one = 1.0, two = 2.0, four = 4.0;
-	double	mm = o->b.d - o->a.d,
-		sa = four/mm,
+	double	zero = 0.0, one = 1.0, two = 2.0;
+	double	sa = o->dc[1].d,
 		xx = sa * (x - o->a.d) - two;
 
-	if (isnan(gscdf4d[0][0]))	gs4initd();
-
 	if (xx <= -two) {
 		return zero;
 	} else if (xx >= two) {
@@ -430,10 +362,11 @@ double LRd_gsn4_CDF(LR_obj *o, double x) {
 	} else {
 		int i = xx + two;		/* truncate */
 		double xt = xx + two - i;	/* translate to [0-1] */
-		double r = gscdf4d[i][4];
+		const double *c = LR_gsn_cdfd + LR_gsn_off[4] + 5*i;
+		double r = c[4];
 		/* horners rule to evaluate polynomial */
 		for (int j = 3; j >= 0; j--) {
-			r = (gscdf4d[i][j] + xt*r);
+			r = (c[j] + xt*r);
 		}
 		return r;
 	}
@@ -449,10 +382,7 @@ Default range: [a,b) = [-2,2)
 @return float
 */
 float LRf_gsn4_RAN(LR_obj *o) {
-	float fourth = .25;
-	float sa = fourth * (o->b.f - o->a.f);
-
-	return o->a.f + sa * (o->uf(o) + o->uf(o) + o->uf(o) + o->uf(o));
+	return o->rc[0].f + o->rc[1].f * (o->uf(o) + o->uf(o) + o->uf(o) + o->uf(o));
 }
 
 /*!
@@ -464,22 +394,20 @@ float LRf_gsn4_RAN(LR_obj *o) {
 @return float PDF at x
 */
 float LRf_gsn4_PDF(LR_obj *o, float x) {
-	float	zero = 0.0, one = 1.0, two = 2.0, four = 4.0;
-	float	mm = o->b.f - o->a.f,
-		sa = four/mm,
+	float	zero = 0.0, two = 2.0;
+	float	sa = o->dc[1].f,
 		xx = sa * (x - o->a.f) - two;
 
-	if (isnan(gspdf4f[0][0]))	gs4initf();
-
 	if (xx <= -two || xx >= two) {
 		return zero;
 	} else {
 		int i = xx + two;		/* truncate */
 		float xt = xx + two - i;	/* translate to [0-1] */
-		float r = gspdf4f[i][4];
+		const float *c = LR_gsn_pdff + LR_gsn_off[4] + 5*i;
+		float r = c[4];
 		/* horners rule to evaluate polynomial */
 		for (int j = 3; j >= 0; j--) {
-			r = (gspdf4f[i][j] + xt*r);
+			r = (c[j] + xt*r);
 		}
 		return sa * r;
 	}
@@ -494,13 +422,10 @@ cumulative distribution function
 @return float CDF at x
 */
 float LRf_gsn4_CDF(LR_obj *o, float x) {
-	float	zero = 0.0, one = 1.0, two = 2.0, four = 4.0;
-	float	mm = o->b.f - o->a.f,
-		sa = four/mm,
+	float	zero = 0.0, one = 1.0, two = 2.0;
+	float	sa = o->dc[1].f,
 		xx = sa * (x - o->a.f) - two;
 
-	if (isnan(gspdf4f[0][0]))	gs4initf();
-
 	if (xx <= -two) {
 		return zero;
 	} else if (xx >= two) {
@@ -508,124 +433,16 @@ float LRf_gsn4_CDF(LR_obj *o, float x) {
 	} else {
 		int i = xx + two;		/* truncate */
 		float xt = xx + two - i;	/* translate to [0-1] */
-		float r = gscdf4f[i][4];
+		const float *c = LR_gsn_cdff + LR_gsn_off[4] + 5*i;
+		float r = c[4];
 		/* horners rule to evaluate polynomial */
 		for (int j = 3; j >= 0; j--) {
-			r = (gscdf4f[i][j] + xt*r);
+			r = (c[j] + xt*r);
 		}
 		return r;
 	}
 }
 
-/* gsn12 - data  [ */
-long gscdfn12[13][13] = {
-  {0l,0l,0l,0l,0l,0l,0l,0l,0l,0l,0l,0l,1l},
-  {1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,-1l},
-  {1021l,509l,253l,25l,61l,29l,13l,1l,1l,-1l,-1l,-1l,1l},
-  {397l,50879l,5203l,907l,79l,239l,1l,-1l,-1l,-1l,1l,1l,-1l},
-  {29639l,1093l,16973l,31l,29l,-17l,-1l,0l,1l,1l,-1l,-1l,1l},
-  {12831419l,1623019l,6787l,-1l,-443l,-43l,167l,11l,-1l,-1l,1l,1l,-1l},
-  {1l,655177l,0l,-809l,0l,31l,0l,-23l,0l,1l,0l,-1l,1l},
-  {67002181l,1623019l,-6787l,-1l,443l,-43l,-167l,11l,1l,-1l,-1l,1l,-1l},
-  {1300921l,1093l,-16973l,31l,-29l,-17l,1l,0l,-1l,1l,1l,-1l,1l},
-  {393843l,50879l,-5203l,907l,-79l,239l,-1l,-1l,1l,-1l,-1l,1l,-1l},
-  {119749379l,509l,-253l,25l,-61l,29l,-13l,1l,-1l,-1l,1l,-1l,1l},
-  {479001599l,1l,-1l,1l,-1l,1l,-1l,1l,-1l,1l,-1l,1l,-1l},
-  {1l,0l,0l,0l,0l,0l,0l,0l,0l,0l,0l,0l,0l}
-};
-/* integer type must support max value = 479001599 */
-
-long gscdfd12[13][13] = {
-  {1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,479001600l},
-  {479001600l,39916800l,7257600l,2177280l,967680l,604800l,518400l,604800l,967680l,2177280l,7257600l,39916800l,43545600l},
-  {119750400l,9979200l,1814400l,108864l,241920l,151200l,129600l,30240l,241920l,544320l,907200l,3991680l,8709120l},
-  {394240l,13305600l,806400l,145152l,21504l,201600l,19200l,8064l,21504l,725760l,268800l,887040l,2903040l},
-  {1330560l,19800l,302400l,1134l,8064l,6300l,800l,1l,8064l,45360l,151200l,332640l,1451520l},
-  {79833600l,6652800l,57600l,384l,23040l,14400l,86400l,20160l,7680l,17280l,172800l,190080l,1036800l},
-  {2l,1663200l,1l,12960l,1l,3600l,1l,25200l,1l,12960l,1l,158400l,1036800l},
-  {79833600l,6652800l,57600l,384l,23040l,14400l,86400l,20160l,7680l,17280l,172800l,190080l,1451520l},
-  {1330560l,19800l,302400l,1134l,8064l,6300l,800l,1l,8064l,45360l,151200l,332640l,2903040l},
-  {394240l,13305600l,806400l,145152l,21504l,201600l,19200l,8064l,21504l,725760l,268800l,887040l,8709120l},
-  {119750400l,9979200l,1814400l,108864l,241920l,151200l,129600l,30240l,241920l,544320l,907200l,3991680l,43545600l},
-  {479001600l,39916800l,7257600l,2177280l,967680l,604800l,518400l,604800l,967680l,2177280l,7257600l,39916800l,479001600l},
-  {1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l}
-};
-/* integer type must support max value = 479001600 */
-
-long gspdfn12[13][13] = {
-  {0l,0l,0l,0l,0l,0l,0l,0l,0l,0l,0l,1l,0l},
-  {1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,-1l,0l},
-  {509l,253l,25l,61l,29l,13l,1l,1l,-1l,-1l,-1l,1l,0l},
-  {50879l,5203l,907l,79l,239l,1l,-1l,-1l,-1l,1l,1l,-1l,0l},
-  {1093l,16973l,31l,29l,-17l,-3l,0l,1l,1l,-1l,-1l,1l,0l},
-  {1623019l,6787l,-1l,-443l,-43l,167l,11l,-1l,-1l,1l,1l,-1l,0l},
-  {655177l,0l,-809l,0l,31l,0l,-23l,0l,1l,0l,-1l,1l,0l},
-  {1623019l,-6787l,-1l,443l,-43l,-167l,11l,1l,-1l,-1l,1l,-1l,0l},
-  {1093l,-16973l,31l,-29l,-17l,3l,0l,-1l,1l,1l,-1l,1l,0l},
-  {50879l,-5203l,907l,-79l,239l,-1l,-1l,1l,-1l,-1l,1l,-1l,0l},
-  {509l,-253l,25l,-61l,29l,-13l,1l,-1l,-1l,1l,-1l,1l,0l},
-  {1l,-1l,1l,-1l,1l,-1l,1l,-1l,1l,-1l,1l,-1l,0l},
-  {0l,0l,0l,0l,0l,0l,0l,0l,0l,0l,0l,0l,0l}
-};
-/* integer type must support max value = 1623019 */
-
-long gspdfd12[13][13] = {
-  {1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,39916800l,1l},
-  {39916800l,3628800l,725760l,241920l,120960l,86400l,86400l,120960l,241920l,725760l,3628800l,3628800l,1l},
-  {9979200l,907200l,36288l,60480l,30240l,21600l,4320l,30240l,60480l,90720l,362880l,725760l,1l},
-  {13305600l,403200l,48384l,5376l,40320l,3200l,1152l,2688l,80640l,26880l,80640l,241920l,1l},
-  {19800l,151200l,378l,2016l,1260l,400l,1l,1008l,5040l,15120l,30240l,120960l,1l},
-  {6652800l,28800l,128l,5760l,2880l,14400l,2880l,960l,1920l,17280l,17280l,86400l,1l},
-  {1663200l,1l,4320l,1l,720l,1l,3600l,1l,1440l,1l,14400l,86400l,1l},
-  {6652800l,28800l,128l,5760l,2880l,14400l,2880l,960l,1920l,17280l,17280l,120960l,1l},
-  {19800l,151200l,378l,2016l,1260l,400l,1l,1008l,5040l,15120l,30240l,241920l,1l},
-  {13305600l,403200l,48384l,5376l,40320l,3200l,1152l,2688l,80640l,26880l,80640l,725760l,1l},
-  {9979200l,907200l,36288l,60480l,30240l,21600l,4320l,30240l,60480l,90720l,362880l,3628800l,1l},
-  {39916800l,3628800l,725760l,241920l,120960l,86400l,86400l,120960l,241920l,725760l,3628800l,39916800l,1l},
-  {1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l,1l}
-};
-/* integer type must support max value = 39916800 */
-
-
-double gspdf12d[13][13] = {
-	NAN
-};
-
-double gscdf12d[13][13] = {
-	NAN
-};
-
-float gspdf12f[13][13] = {
-	NAN
-};
-
-float gscdf12f[13][13] = {
-	NAN
-};
-
-/* ] set up coefs from rational integers */
-int gs12initd(void) {
-	for (int i = 0; i < 13; i++) {
-		for (int j = 0; j < 13; j++) {
-			gspdf12d[i][j] = ((double) gspdfn12[i][j])
-				/ ((double) gspdfd12[i][j]);
-			gscdf12d[i][j] = ((double) gscdfn12[i][j])
-				/ ((double) gscdfd12[i][j]);
-		}
-	}
-}
-
-int gs12initf(void) {
-	for (int i = 0; i < 13; i++) {
-		for (int j = 0; j < 13; j++) {
-			gspdf12f[i][j] = ((float) gspdfn12[i][j])
-				/ ((float) gspdfd12[i][j]);
-			gscdf12f[i][j] = ((float) gscdfn12[i][j])
-				/ ((float) gscdfd12[i][j]);
-		}
-	}
-}
-
 /*!
 @brief	LRd_gsn12_RAN(LR_obj *o) - double random g12 gaussian-like
 distribution closely matches a Gaussian/Normal distribution
@@ -640,7 +457,7 @@ double LRd_gsn12_RAN(LR_obj *o) {
 	double six = 6.0;
 
 	/* unroll "loop" */
-	return o->m.d + o->s.d * (
+	return o->rc[0].d + o->rc[1].d * (
 		o->ud(o) + o->ud(o) + o->ud(o) + o->ud(o)
 	+	o->ud(o) + o->ud(o) + o->ud(o) + o->ud(o)
 	+	o->ud(o) + o->ud(o) + o->ud(o) + o->ud(o)
@@ -657,21 +474,20 @@ double LRd_gsn12_RAN(LR_obj *o) {
 @return double PDF at x
 */
 double LRd_gsn12_PDF(LR_obj *o, double x) {
-	double	zero = 0.0, one = 1.0, six = 6.0;
-	double	sa = one/o->s.d,
+	double	zero = 0.0, six = 6.0;
+	double	sa = o->dc[0].d,
 		xx = sa * (x - o->m.d);
 
-	if (isnan(gspdf12d[0][0]))	gs12initd();
-
 	if (xx <= -six || xx >= six) {
 		return zero;
 	} else {
 		int i = xx + six;		/* truncate */
 		double xt = xx + six - i;	/* translate to [0-1] */
-		double r = gspdf12d[i][12];
+		const double *c = LR_gsn_pdfd + LR_gsn_off[12] + 13*i;
+		double r = c[12];
 		/* horners rule to evaluate polynomial */
 		for (int j = 11; j >= 0; j--) {
-			r = (gspdf12d[i][j] + xt*r);
+			r = (c[j] + xt*r);
 		}
 		return sa * r;
 	}
@@ -687,11 +503,9 @@ double LRd_gsn12_PDF(LR_obj *o, double x) {
 */
 double LRd_gsn12_CDF(LR_obj *o, double x) {
 	double	zero = 0.0, one = 1.0, six = 6.0;
-	double	sa = one/o->s.d,
+	double	sa = o->dc[0].d,
 		xx = sa * (x - o->m.d);
 
-	if (isnan(gscdf12d[0][0]))	gs12initd();
-
 	if (xx <= -six) {
 		return zero;
 	} else if (xx >= six) {
@@ -699,10 +513,11 @@ double LRd_gsn12_CDF(LR_obj *o, double x) {
 	} else {
 		int i = xx + six;		/* truncate */
 		double xt = xx + six - i;	/* translate to [0-1] */
-		double r = gscdf12d[i][12];
+		const double *c = LR_gsn_cdfd + LR_gsn_off[12] + 13*i;
+		double r = c[12];
 		/* horners rule to evaluate polynomial */
 		for (int j = 11; j >= 0; j--) {
-			r = (gscdf12d[i][j] + xt*r);
+			r = (c[j] + xt*r);
 		}
 		return r;
 	}
@@ -722,7 +537,7 @@ float LRf_gsn12_RAN(LR_obj *o) {
 	float six = 6.0;
 
 	/* unroll "loop" */
-	return o->m.f + o->s.f * (
+	return o->rc[0].f + o->rc[1].f * (
 		o->uf(o) + o->uf(o) + o->uf(o) + o->uf(o)
 	+	o->uf(o) + o->uf(o) + o->uf(o) + o->uf(o)
 	+	o->uf(o) + o->uf(o) + o->uf(o) + o->uf(o)
@@ -739,21 +554,20 @@ float LRf_gsn12_RAN(LR_obj *o) {
 @return float PDF at x
 */
 float LRf_gsn12_PDF(LR_obj *o, float x) {
-	float	zero = 0.0, one = 1.0, six = 6.0;
-	float	sa = one/o->s.f,
+	float	zero = 0.0, six = 6.0;
+	float	sa = o->dc[0].f,
 		xx = sa * (x - o->m.f);
 
-	if (isnan(gspdf12f[0][0]))	gs12initf();
-
 	if (xx <= -six || xx >= six) {
 		return zero;
 	} else {
 		int i = xx + six;		/* truncate */
 		float xt = xx + six - i;	/* translate to [0-1] */
-		float r = gspdf12f[i][12];
+		const float *c = LR_gsn_pdff + LR_gsn_off[12] + 13*i;
+		float r = c[12];
 		/* horners rule to evaluate polynomial */
 		for (int j = 11; j >= 0; j--) {
-			r = (gspdf12f[i][j] + xt*r);
+			r = (c[j] + xt*r);
 		}
 		return sa * r;
 	}
@@ -769,11 +583,9 @@ float LRf_gsn12_PDF(LR_obj *o, float x) {
 */
 float LRf_gsn12_CDF(LR_obj *o, float x) {
 	float	zero = 0.0, one = 1.0, six = 6.0;
-	float	sa = one/o->s.f,
+	float	sa = o->dc[0].f,
 		xx = sa * (x - o->m.f);
 
-	if (isnan(gspdf12f[0][0]))	gs12initf();
-
 	if (xx <= -six) {
 		return zero;
 	} else if (xx >= six) {
@@ -781,15 +593,503 @@ float LRf_gsn12_CDF(LR_obj *o, float x) {
 	} else {
 		int i = xx + six;		/* truncate */
 		float xt = xx + six - i;	/* translate to [0-1] */
-		float r = gscdf12f[i][12];
+		const float *c = LR_gsn_cdff + LR_gsn_off[12] + 13*i;
+		float r = c[12];
 		/* horners rule to evaluate polynomial */
 		for (int j = 11; j >= 0; j--) {
-			r = (gscdf12f[i][j] + xt*r);
+			r = (c[j] + xt*r);
 		}
 		return r;
 	}
 }
 
+/* the batch uniforms are drawn LR_GSN_NU at a time */
+#define	LR_GSN_NU	2048
+
+/* a batch of a + s (u_1 + ... + u_k - c) */
+static int LRd_gsn_n(LR_obj *o, double *x, long n, int k,
+double a, double s, double c) {
+	double		u[LR_GSN_NU];
+	const LR_kern	*kern = LR_kern_get();
+	long		nb, nv;
+
+	if (k < 1 || k > LR_GSN_MAX)
+		return o->errno = LRerr_InvalidInputValue;
+	nb = LR_GSN_NU / k;
+	for (long i = 0; i < n; i += nv) {
+		nv = (n - i < nb ? n - i : nb);
+		(void) LR_drand_n(o, u, nv * k);
+		kern->dgsn(x + i, u, nv, k, a, s, c);
+	}
+	return LRerr_OK;
+}
+
+static int LRf_gsn_n(LR_obj *o, float *x, long n, int k,
+float a, float s, float c) {
+	float		u[LR_GSN_NU];
+	const LR_kern	*kern = LR_kern_get();
+	long		nb, nv;
+
+	if (k < 1 || k > LR_GSN_MAX)
+		return o->errno = LRerr_InvalidInputValue;
+	nb = LR_GSN_NU / k;
+	for (long i = 0; i < n; i += nv) {
+		nv = (n - i < nb ? n - i : nb);
+		(void) LR_frand_n(o, u, nv * k);
+		kern->fgsn(x + i, u, nv, k, a, s, c);
+	}
+	return LRerr_OK;
+}
+
+/*!
+@brief	LRd_gsn2_RAN_n(LR_obj *o, double *x, long n) - a batch of double
+random g2 gaussian-like variates (see \c LRd_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRd_gsn2_RAN_n(LR_obj *o, double *x, long n) {
+	return LRd_gsn_n(o, x, n, 2, o->rc[0].d, o->rc[1].d, 0.0);
+}
+
+/*!
+@brief	LRf_gsn2_RAN_n(LR_obj *o, float *x, long n) - a batch of float
+random g2 gaussian-like variates (see \c LRf_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRf_gsn2_RAN_n(LR_obj *o, float *x, long n) {
+	return LRf_gsn_n(o, x, n, 2, o->rc[0].f, o->rc[1].f, 0.0f);
+}
+
+/*!
+@brief	LRd_gsn4_RAN_n(LR_obj *o, double *x, long n) - a batch of double
+random g4 gaussian-like variates (see \c LRd_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRd_gsn4_RAN_n(LR_obj *o, double *x, long n) {
+	return LRd_gsn_n(o, x, n, 4, o->rc[0].d, o->rc[1].d, 0.0);
+}
+
+/*!
+@brief	LRf_gsn4_RAN_n(LR_obj *o, float *x, long n) - a batch of float
+random g4 gaussian-like variates (see \c LRf_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRf_gsn4_RAN_n(LR_obj *o, float *x, long n) {
+	return LRf_gsn_n(o, x, n, 4, o->rc[0].f, o->rc[1].f, 0.0f);
+}
+
+/*!
+@brief	LRd_gsn12_RAN_n(LR_obj *o, double *x, long n) - a batch of double
+random g12 gaussian-like variates (see \c LRd_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRd_gsn12_RAN_n(LR_obj *o, double *x, long n) {
+	return LRd_gsn_n(o, x, n, 12, o->rc[0].d, o->rc[1].d, 6.0);
+}
+
+/*!
+@brief	LRf_gsn12_RAN_n(LR_obj *o, float *x, long n) - a batch of float
+random g12 gaussian-like variates (see \c LRf_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRf_gsn12_RAN_n(LR_obj *o, float *x, long n) {
+	return LRf_gsn_n(o, x, n, 12, o->rc[0].f, o->rc[1].f, 6.0f);
+}
+
+/*!
+@brief	LRd_gsnN_RAN(LR_obj *o) - double random gaussian-like
+distribution using the sum of k uniform random variates.
+
+Default: k = 12, mean m = 0, std.deviation s = 1
+
+@param o	LR_obj object
+@return double
+*/
+double LRd_gsnN_RAN(LR_obj *o) {
+	double	u = 0.0;
+
+	for (int i = 0; i < o->k; i++)
+		u += o->ud(o);
+	return o->rc[0].d + o->rc[1].d * u;
+}
+
+/*!
+@brief	LRd_gsnN_RAN_n(LR_obj *o, double *x, long n) - a batch of double
+random gaussian-like variates (see \c LRd_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRd_gsnN_RAN_n(LR_obj *o, double *x, long n) {
+	return LRd_gsn_n(o, x, n, o->k, o->rc[0].d, o->rc[1].d, 0.0);
+}
+
+/*!
+@brief	LRd_gsnN_PDF(LR_obj *o, double x) - double gaussian-like
+probablity distribution function of order k
+
+@param o	LR_obj object
+@param x	value
+@return double PDF at x
+*/
+double LRd_gsnN_PDF(LR_obj *o, double x) {
+	double	zero = 0.0;
+	double	sa = o->dc[0].d,
+		xx = sa * (x - o->dc[1].d);
+	int	kk = o->k;
+
+	if (kk < 1 || kk > LR_GSN_MAX) {
+		o->errno = LRerr_InvalidInputValue;
+		return NAN;
+	}
+	if (xx <= zero || xx >= kk) {
+		return zero;
+	} else {
+		int i = xx;			/* truncate */
+		double xt = xx - i;		/* translate to [0-1] */
+		const double *c = LR_gsn_pdfd + LR_gsn_off[kk] + (kk+1)*i;
+		double r = c[kk];
+		/* horners rule to evaluate polynomial */
+		for (int j = kk-1; j >= 0; j--) {
+			r = (c[j] + xt*r);
+		}
+		return sa * r;
+	}
+}
+
+/*!
+@brief	LRd_gsnN_CDF(LR_obj *o, double x) - double gaussian-like
+cumulative distribution function of order k
+
+@param o	LR_obj object
+@param x	value
+@return double CDF at x
+*/
+double LRd_gsnN_CDF(LR_obj *o, double x) {
+	double	zero = 0.0, one = 1.0;
+	double	sa = o->dc[0].d,
+		xx = sa * (x - o->dc[1].d);
+	int	kk = o->k;
+
+	if (kk < 1 || kk > LR_GSN_MAX) {
+		o->errno = LRerr_InvalidInputValue;
+		return NAN;
+	}
+	if (xx <= zero) {
+		return zero;
+	} else if (xx >= kk) {
+		return one;
+	} else {
+		int i = xx;			/* truncate */
+		double xt = xx - i;		/* translate to [0-1] */
+		const double *c = LR_gsn_cdfd + LR_gsn_off[kk] + (kk+1)*i;
+		double r = c[kk];
+		/* horners rule to evaluate polynomial */
+		for (int j = kk-1; j >= 0; j--) {
+			r = (c[j] + xt*r);
+		}
+		return r;
+	}
+}
+
+/*!
+@brief	LRf_gsnN_RAN(LR_obj *o) - float random gaussian-like
+distribution using the sum of k uniform random variates.
+
+Default: k = 12, mean m = 0, std.deviation s = 1
+
+@param o	LR_obj object
+@return float
+*/
+float LRf_gsnN_RAN(LR_obj *o) {
+	float	u = 0.0;
+
+	for (int i = 0; i < o->k; i++)
+		u += o->uf(o);
+	return o->rc[0].f + o->rc[1].f * u;
+}
+
+/*!
+@brief	LRf_gsnN_RAN_n(LR_obj *o, float *x, long n) - a batch of float
+random gaussian-like variates (see \c LRf_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRf_gsnN_RAN_n(LR_obj *o, float *x, long n) {
+	return LRf_gsn_n(o, x, n, o->k, o->rc[0].f, o->rc[1].f, 0.0f);
+}
+
+/*!
+@brief	LRf_gsnN_PDF(LR_obj *o, float x) - float gaussian-like
+probablity distribution function of order k
+
+@param o	LR_obj object
+@param x	value
+@return float PDF at x
+*/
+float LRf_gsnN_PDF(LR_obj *o, float x) {
+	float	zero = 0.0;
+	float	sa = o->dc[0].f,
+		xx = sa * (x - o->dc[1].f);
+	int	kk = o->k;
+
+	if (kk < 1 || kk > LR_GSN_MAX) {
+		o->errno = LRerr_InvalidInputValue;
+		return NAN;
+	}
+	if (xx <= zero || xx >= kk) {
+		return zero;
+	} else {
+		int i = xx;			/* truncate */
+		float xt = xx - i;		/* translate to [0-1] */
+		const float *c = LR_gsn_pdff + LR_gsn_off[kk] + (kk+1)*i;
+		float r = c[kk];
+		/* horners rule to evaluate polynomial */
+		for (int j = kk-1; j >= 0; j--) {
+			r = (c[j] + xt*r);
+		}
+		return sa * r;
+	}
+}
+
+/*!
+@brief	LRf_gsnN_CDF(LR_obj *o, float x) - float gaussian-like
+cumulative distribution function of order k
+
+@param o	LR_obj object
+@param x	value
+@return float CDF at x
+*/
+float LRf_gsnN_CDF(LR_obj *o, float x) {
+	float	zero = 0.0, one = 1.0;
+	float	sa = o->dc[0].f,
+		xx = sa * (x - o->dc[1].f);
+	int	kk = o->k;
+
+	if (kk < 1 || kk > LR_GSN_MAX) {
+		o->errno = LRerr_InvalidInputValue;
+		return NAN;
+	}
+	if (xx <= zero) {
+		return zero;
+	} else if (xx >= kk) {
+		return one;
+	} else {
+		int i = xx;			/* truncate */
+		float xt = xx - i;		/* translate to [0-1] */
+		const float *c = LR_gsn_cdff + LR_gsn_off[kk] + (kk+1)*i;
+		float r = c[kk];
+		/* horners rule to evaluate polynomial */
+		for (int j = kk-1; j >= 0; j--) {
+			r = (c[j] + xt*r);
+		}
+		return r;
+	}
+}
+
+/* the z in [0,k] where the CDF of the sum of k uniforms is u, by Newton's
+ * method kept within a bracket, from the exact z^k/k! of the first
+ * interval or else the Gaussian approximation */
+static double LR_gsn_quant(int k, double u) {
+	double	zero = 0.0, one = 1.0, half = 0.5, kf = one,
+		lo = zero, hi = half * k, z, zn, f, d;
+	const double	*cdf = LR_gsn_cdfd + LR_gsn_off[k],
+			*pdf = LR_gsn_pdfd + LR_gsn_off[k];
+	int	flip = 0;
+
+	if (u <= zero)	return zero;
+	if (u >= one)	return k;
+	if (u == half)	return hi;
+	/* the upper half by symmetry */
+	if (u > half) {
+		u = one - u;
+		flip = 1;
+	}
+	for (int j = 2; j <= k; j++)
+		kf *= j;
+	z = pow(u * kf, one / k);
+	if (z >= one)
+		z = half * k + sqrt(k / 12.0) * LR_ppndd(u);
+	if (z <= lo || z >= hi)
+		z = half * (lo + hi);
+
+	for (int it = 0; it < 100; it++) {
+		int i = z;			/* truncate */
+		double xt = z - i;		/* translate to [0-1] */
+		const double *c = cdf + (k+1)*i, *p = pdf + (k+1)*i;
+		f = c[k];
+		d = p[k];
+		/* horners rule to evaluate polynomial */
+		for (int j = k-1; j >= 0; j--) {
+			f = (c[j] + xt*f);
+			d = (p[j] + xt*d);
+		}
+		f -= u;
+		if (f > zero)
+			hi = z;
+		else
+			lo = z;
+		zn = (d > zero ? z - f/d : lo);
+		/* else bisect */
+		if (zn <= lo || zn >= hi)
+			zn = half * (lo + hi);
+		if (fabs(zn - z) <= 2.0 * DBL_EPSILON * z) {
+			z = zn;
+			break;
+		}
+		z = zn;
+	}
+	return (flip ? k - z : z);
+}
+
+/*!
+@brief	LRd_gsn2_QUANT(LR_obj *o, double u) - double gaussian-like
+(saw tooth) quantile (inverse cumulative distribution function)
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return double x where the CDF is u
+*/
+double LRd_gsn2_QUANT(LR_obj *o, double u) {
+	double	half = 0.5, two = 2.0;
+
+	if (u <= half)
+		return o->rc[0].d + o->rc[1].d * sqrt(two * u);
+	else
+		return o->rc[0].d + o->rc[1].d * (two - sqrt(two * (1.0 - u)));
+}
+
+/*!
+@brief	LRf_gsn2_QUANT(LR_obj *o, float u) - float gaussian-like
+(saw tooth) quantile (inverse cumulative distribution function)
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return float x where the CDF is u
+*/
+float LRf_gsn2_QUANT(LR_obj *o, float u) {
+	float	half = 0.5, two = 2.0;
+
+	if (u <= half)
+		return o->rc[0].f + o->rc[1].f * sqrtf(two * u);
+	else
+		return o->rc[0].f + o->rc[1].f * (two - sqrtf(two * (1.0f - u)));
+}
+
+/*!
+@brief	LRd_gsn4_QUANT(LR_obj *o, double u) - double gaussian-like
+(simple bell curve) quantile (inverse cumulative distribution function)
+
+The piecewise polynomial CDF is inverted by Newton's method.
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return double x where the CDF is u
+*/
+double LRd_gsn4_QUANT(LR_obj *o, double u) {
+	return o->rc[0].d + o->rc[1].d * LR_gsn_quant(4, u);
+}
+
+/*!
+@brief	LRf_gsn4_QUANT(LR_obj *o, float u) - float gaussian-like
+(simple bell curve) quantile (inverse cumulative distribution function)
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return float x where the CDF is u
+*/
+float LRf_gsn4_QUANT(LR_obj *o, float u) {
+	return o->rc[0].f + o->rc[1].f * (float) LR_gsn_quant(4, u);
+}
+
+/*!
+@brief	LRd_gsn12_QUANT(LR_obj *o, double u) - double gaussian-like
+quantile (inverse cumulative distribution function)
+
+The piecewise polynomial CDF is inverted by Newton's method.
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return double x where the CDF is u
+*/
+double LRd_gsn12_QUANT(LR_obj *o, double u) {
+	return o->rc[0].d + o->rc[1].d * (LR_gsn_quant(12, u) - 6.0);
+}
+
+/*!
+@brief	LRf_gsn12_QUANT(LR_obj *o, float u) - float gaussian-like
+quantile (inverse cumulative distribution function)
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return float x where the CDF is u
+*/
+float LRf_gsn12_QUANT(LR_obj *o, float u) {
+	return o->rc[0].f + o->rc[1].f * (float) (LR_gsn_quant(12, u) - 6.0);
+}
+
+/*!
+@brief	LRd_gsnN_QUANT(LR_obj *o, double u) - double gaussian-like
+quantile of order k (inverse cumulative distribution function)
+
+The piecewise polynomial CDF is inverted by Newton's method.
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return double x where the CDF is u
+*/
+double LRd_gsnN_QUANT(LR_obj *o, double u) {
+	if (o->k < 1 || o->k > LR_GSN_MAX) {
+		o->errno = LRerr_InvalidInputValue;
+		return NAN;
+	}
+	return o->rc[0].d + o->rc[1].d * LR_gsn_quant(o->k, u);
+}
+
+/*!
+@brief	LRf_gsnN_QUANT(LR_obj *o, float u) - float gaussian-like
+quantile of order k (inverse cumulative distribution function)
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return float x where the CDF is u
+*/
+float LRf_gsnN_QUANT(LR_obj *o, float u) {
+	if (o->k < 1 || o->k > LR_GSN_MAX) {
+		o->errno = LRerr_InvalidInputValue;
+		return NAN;
+	}
+	return o->rc[0].f + o->rc[1].f * (float) LR_gsn_quant(o->k, u);
+}
+
 #ifdef __cplusplus
 }
 #endif
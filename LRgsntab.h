@@ -0,0 +1,1417 @@
+/* LRgsntab.h - the gsn coefficient tables for orders 1 to 24
+ * generated by aux/gsn -t 24 (make gsntab, see aux/gsn.c), do not edit */
+
+#if LR_GSN_MAX != 24
+#  error "LR_GSN_MAX does not match the generated tables"
+#endif
+
+static const int LR_gsn_off[26] = {
+	0, 0, 4, 13, 29, 54, 90, 139,
+	203, 284, 384, 505, 649, 818, 1014, 1239,
+	1495, 1784, 2108, 2469, 2869, 3310, 3794, 4323,
+	4899, 5524
+};
+
+static const double LR_gsn_cdfd[5524] = {
+/* 1 */
+	0x0p+0, 0x1p+0,
+	0x1p+0, 0x0p+0,
+/* 2 */
+	0x0p+0, 0x0p+0, 0x1p-1,
+	0x1p-1, 0x1p+0, -0x1p-1,
+	0x1p+0, 0x0p+0, 0x0p+0,
+/* 3 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x1.5555555555555p-3,
+	0x1.5555555555555p-3, 0x1p-1, 0x1p-1, -0x1.5555555555555p-2,
+	0x1.aaaaaaaaaaaabp-1, 0x1p-1, -0x1p-1, 0x1.5555555555555p-3,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 4 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.5555555555555p-5,
+	0x1.5555555555555p-5, 0x1.5555555555555p-3, 0x1p-2, 0x1.5555555555555p-3, -0x1p-3,
+	0x1p-1, 0x1.5555555555555p-1, 0x0p+0, -0x1.5555555555555p-2, 0x1p-3,
+	0x1.eaaaaaaaaaaabp-1, 0x1.5555555555555p-3, -0x1p-2, 0x1.5555555555555p-3, -0x1.5555555555555p-5,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 5 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.1111111111111p-7,
+	0x1.1111111111111p-7, 0x1.5555555555555p-5, 0x1.5555555555555p-4, 0x1.5555555555555p-4, 0x1.5555555555555p-5, -0x1.1111111111111p-5,
+	0x1.ccccccccccccdp-3, 0x1.d555555555555p-2, 0x1p-2, -0x1.5555555555555p-4, -0x1p-3, 0x1.999999999999ap-5,
+	0x1.8cccccccccccdp-1, 0x1.d555555555555p-2, -0x1p-2, -0x1.5555555555555p-4, 0x1p-3, -0x1.1111111111111p-5,
+	0x1.fbbbbbbbbbbbcp-1, 0x1.5555555555555p-5, -0x1.5555555555555p-4, 0x1.5555555555555p-4, -0x1.5555555555555p-5, 0x1.1111111111111p-7,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 6 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.6c16c16c16c17p-10,
+	0x1.6c16c16c16c17p-10, 0x1.1111111111111p-7, 0x1.5555555555555p-6, 0x1.c71c71c71c71cp-6, 0x1.5555555555555p-6, 0x1.1111111111111p-7, -0x1.c71c71c71c71cp-8,
+	0x1.49f49f49f49f5p-4, 0x1.bbbbbbbbbbbbcp-3, 0x1.aaaaaaaaaaaabp-3, 0x1.c71c71c71c71cp-5, -0x1.5555555555555p-5, -0x1.1111111111111p-5, 0x1.c71c71c71c71cp-7,
+	0x1p-1, 0x1.199999999999ap-1, 0x0p+0, -0x1.5555555555555p-3, 0x0p+0, 0x1.999999999999ap-5, -0x1.c71c71c71c71cp-7,
+	0x1.d6c16c16c16c1p-1, 0x1.bbbbbbbbbbbbcp-3, -0x1.aaaaaaaaaaaabp-3, 0x1.c71c71c71c71cp-5, 0x1.5555555555555p-5, -0x1.1111111111111p-5, 0x1.c71c71c71c71cp-8,
+	0x1.ff49f49f49f4ap-1, 0x1.1111111111111p-7, -0x1.5555555555555p-6, 0x1.c71c71c71c71cp-6, -0x1.5555555555555p-6, 0x1.1111111111111p-7, -0x1.6c16c16c16c17p-10,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 7 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.a01a01a01a01ap-13,
+	0x1.a01a01a01a01ap-13, 0x1.6c16c16c16c17p-10, 0x1.1111111111111p-8, 0x1.c71c71c71c71cp-8, 0x1.c71c71c71c71cp-8, 0x1.1111111111111p-8, 0x1.6c16c16c16c17p-10, -0x1.3813813813814p-10,
+	0x1.8958958958959p-6, 0x1.4444444444444p-4, 0x1.aaaaaaaaaaaabp-4, 0x1p-4, 0x1.c71c71c71c71cp-8, -0x1.999999999999ap-7, -0x1.c71c71c71c71cp-8, 0x1.8618618618618p-9,
+	0x1.0a90a90a90a91p-2, 0x1.ad82d82d82d83p-2, 0x1.5555555555555p-3, -0x1.1c71c71c71c72p-4, -0x1.c71c71c71c71cp-5, 0x1.1111111111111p-7, 0x1.c71c71c71c71cp-7, -0x1.041041041041p-8,
+	0x1.7ab7ab7ab7ab8p-1, 0x1.ad82d82d82d83p-2, -0x1.5555555555555p-3, -0x1.1c71c71c71c72p-4, 0x1.c71c71c71c71cp-5, 0x1.1111111111111p-7, -0x1.c71c71c71c71cp-7, 0x1.8618618618618p-9,
+	0x1.f3b53b53b53b5p-1, 0x1.4444444444444p-4, -0x1.aaaaaaaaaaaabp-4, 0x1p-4, -0x1.c71c71c71c71cp-8, -0x1.999999999999ap-7, 0x1.c71c71c71c71cp-8, -0x1.3813813813814p-10,
+	0x1.ffe5fe5fe5fe6p-1, 0x1.6c16c16c16c17p-10, -0x1.1111111111111p-8, 0x1.c71c71c71c71cp-8, -0x1.c71c71c71c71cp-8, 0x1.1111111111111p-8, -0x1.6c16c16c16c17p-10, 0x1.a01a01a01a01ap-13,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 8 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.a01a01a01a01ap-16,
+	0x1.a01a01a01a01ap-16, 0x1.a01a01a01a01ap-13, 0x1.6c16c16c16c17p-11, 0x1.6c16c16c16c17p-10, 0x1.c71c71c71c71cp-10, 0x1.6c16c16c16c17p-10, 0x1.6c16c16c16c17p-11, 0x1.a01a01a01a01ap-13, -0x1.6c16c16c16c17p-13,
+	0x1.9319319319319p-8, 0x1.8618618618618p-6, 0x1.3e93e93e93e94p-5, 0x1.1111111111111p-5, 0x1.c71c71c71c71cp-7, 0x0p+0, -0x1.6c16c16c16c17p-9, -0x1.3813813813814p-10, 0x1.1111111111111p-11,
+	0x1.cd4ed4ed4ed4fp-4, 0x1.e3f63f63f63f6p-3, 0x1.5c71c71c71c72p-3, 0x1.5555555555555p-6, -0x1.0e38e38e38e39p-5, -0x1.999999999999ap-7, 0x1.c71c71c71c71cp-9, 0x1.8618618618618p-9, -0x1.c71c71c71c71cp-11,
+	0x1p-1, 0x1.eadeadeadeadfp-2, 0x0p+0, -0x1.c71c71c71c71cp-4, 0x0p+0, 0x1.6c16c16c16c17p-6, 0x0p+0, -0x1.041041041041p-8, 0x1.c71c71c71c71cp-11,
+	0x1.c656256256256p-1, 0x1.e3f63f63f63f6p-3, -0x1.5c71c71c71c72p-3, 0x1.5555555555555p-6, 0x1.0e38e38e38e39p-5, -0x1.999999999999ap-7, -0x1.c71c71c71c71cp-9, 0x1.8618618618618p-9, -0x1.1111111111111p-11,
+	0x1.fcd9cd9cd9cdap-1, 0x1.8618618618618p-6, -0x1.3e93e93e93e94p-5, 0x1.1111111111111p-5, -0x1.c71c71c71c71cp-7, 0x0p+0, 0x1.6c16c16c16c17p-9, -0x1.3813813813814p-10, 0x1.6c16c16c16c17p-13,
+	0x1.fffcbfcbfcbfdp-1, 0x1.a01a01a01a01ap-13, -0x1.6c16c16c16c17p-11, 0x1.6c16c16c16c17p-10, -0x1.c71c71c71c71cp-10, 0x1.6c16c16c16c17p-10, -0x1.6c16c16c16c17p-11, 0x1.a01a01a01a01ap-13, -0x1.a01a01a01a01ap-16,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 9 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.71de3a556c734p-19,
+	0x1.71de3a556c734p-19, 0x1.a01a01a01a01ap-16, 0x1.a01a01a01a01ap-14, 0x1.e573ac901e574p-13, 0x1.6c16c16c16c17p-12, 0x1.6c16c16c16c17p-12, 0x1.e573ac901e574p-13, 0x1.a01a01a01a01ap-14, 0x1.a01a01a01a01ap-16, -0x1.71de3a556c734p-16,
+	0x1.6b5dd24eec0b3p-10, 0x1.9179179179179p-8, 0x1.82d82d82d82d8p-7, 0x1.a12f684bda12fp-7, 0x1.05b05b05b05bp-7, 0x1.3e93e93e93e94p-9, -0x1.e573ac901e574p-13, -0x1.041041041041p-11, -0x1.6c16c16c16c17p-13, 0x1.43a2730abee4dp-14,
+	0x1.5521521521521p-5, 0x1.b41d41d41d41dp-4, 0x1.b333333333333p-4, 0x1.6666666666666p-5, -0x1.999999999999ap-9, -0x1.3333333333333p-7, -0x1.1111111111111p-9, 0x1.d41d41d41d41dp-11, 0x1.1111111111111p-11, -0x1.43a2730abee4dp-13,
+	0x1.23a0483d6764bp-2, 0x1.8cac4ac4ac4acp-2, 0x1.f1c71c71c71c7p-4, -0x1.d097b425ed098p-5, -0x1.0e38e38e38e39p-5, 0x1.b05b05b05b05bp-8, 0x1.7b425ed097b42p-8, -0x1.041041041041p-11, -0x1.c71c71c71c71cp-11, 0x1.948b0fcd6e9ep-13,
+	0x1.6e2fdbe14c4dbp-1, 0x1.8cac4ac4ac4acp-2, -0x1.f1c71c71c71c7p-4, -0x1.d097b425ed098p-5, 0x1.0e38e38e38e39p-5, 0x1.b05b05b05b05bp-8, -0x1.7b425ed097b42p-8, -0x1.041041041041p-11, 0x1.c71c71c71c71cp-11, -0x1.43a2730abee4dp-13,
+	0x1.eaadeadeadeaep-1, 0x1.b41d41d41d41dp-4, -0x1.b333333333333p-4, 0x1.6666666666666p-5, 0x1.999999999999ap-9, -0x1.3333333333333p-7, 0x1.1111111111111p-9, 0x1.d41d41d41d41dp-11, -0x1.1111111111111p-11, 0x1.43a2730abee4dp-14,
+	0x1.ff4a5116d88ap-1, 0x1.9179179179179p-8, -0x1.82d82d82d82d8p-7, 0x1.a12f684bda12fp-7, -0x1.05b05b05b05bp-7, 0x1.3e93e93e93e94p-9, 0x1.e573ac901e574p-13, -0x1.041041041041p-11, 0x1.6c16c16c16c17p-13, -0x1.71de3a556c734p-16,
+	0x1.ffffa388716aap-1, 0x1.a01a01a01a01ap-16, -0x1.a01a01a01a01ap-14, 0x1.e573ac901e574p-13, -0x1.6c16c16c16c17p-12, 0x1.6c16c16c16c17p-12, -0x1.e573ac901e574p-13, 0x1.a01a01a01a01ap-14, -0x1.a01a01a01a01ap-16, 0x1.71de3a556c734p-19,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 10 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.27e4fb7789f5cp-22,
+	0x1.27e4fb7789f5cp-22, 0x1.71de3a556c734p-19, 0x1.a01a01a01a01ap-17, 0x1.1566abc011567p-15, 0x1.e573ac901e574p-15, 0x1.23456789abcdfp-14, 0x1.e573ac901e574p-15, 0x1.1566abc011567p-15, 0x1.a01a01a01a01ap-17, 0x1.71de3a556c734p-19, -0x1.4ce19ae67b348p-19,
+	0x1.25013f02df1cep-12, 0x1.6aa4e331c155p-10, 0x1.8fd8fd8fd8fd9p-9, 0x1.ff754caa1ff75p-9, 0x1.999999999999ap-9, 0x1.907f6e5d4c3b3p-10, 0x1.6c16c16c16c17p-12, -0x1.1566abc011567p-14, -0x1.3813813813814p-14, -0x1.71de3a556c734p-16, 0x1.4ce19ae67b348p-17,
+	0x1.b9269819dca38p-7, 0x1.49c66382a9f1cp-5, 0x1.9b05b05b05b06p-5, 0x1.01e573ac901e5p-5, 0x1.fc3518a6dfc35p-8, -0x1.23456789abcdfp-9, -0x1.01e573ac901e5p-9, -0x1.1566abc011567p-12, 0x1.6c16c16c16c17p-13, 0x1.43a2730abee4dp-14, -0x1.845c8a0ce5129p-16,
+	0x1.1c786c8117b67p-3, 0x1.f1f83bf58674ep-3, 0x1.1fa4fa4fa4fa5p-3, 0x1.4dbf86a314dcp-8, -0x1.9b7f0d4629b7fp-6, -0x1.87654320fedccp-8, 0x1.5ceb240795cebp-9, 0x1.26bd167c126bdp-10, -0x1.6c16c16c16c17p-13, -0x1.43a2730abee4dp-13, 0x1.23456789abcdfp-15,
+	0x1p-1, 0x1.b8bf6f853136ap-2, 0x0p+0, -0x1.4bda12f684bdap-4, 0x0p+0, 0x1.b05b05b05b05bp-7, 0x0p+0, -0x1.b1706c5c1b17p-10, 0x0p+0, 0x1.948b0fcd6e9ep-13, -0x1.23456789abcdfp-15,
+	0x1.b8e1e4dfba126p-1, 0x1.f1f83bf58674ep-3, -0x1.1fa4fa4fa4fa5p-3, 0x1.4dbf86a314dcp-8, 0x1.9b7f0d4629b7fp-6, -0x1.87654320fedccp-8, -0x1.5ceb240795cebp-9, 0x1.26bd167c126bdp-10, 0x1.6c16c16c16c17p-13, -0x1.43a2730abee4dp-13, 0x1.845c8a0ce5129p-16,
+	0x1.f91b659f988d7p-1, 0x1.49c66382a9f1cp-5, -0x1.9b05b05b05b06p-5, 0x1.01e573ac901e5p-5, -0x1.fc3518a6dfc35p-8, -0x1.23456789abcdfp-9, 0x1.01e573ac901e5p-9, -0x1.1566abc011567p-12, -0x1.6c16c16c16c17p-13, 0x1.43a2730abee4dp-14, -0x1.4ce19ae67b348p-17,
+	0x1.ffdb5fd81fa42p-1, 0x1.6aa4e331c155p-10, -0x1.8fd8fd8fd8fd9p-9, 0x1.ff754caa1ff75p-9, -0x1.999999999999ap-9, 0x1.907f6e5d4c3b3p-10, -0x1.6c16c16c16c17p-12, -0x1.1566abc011567p-14, 0x1.3813813813814p-14, -0x1.71de3a556c734p-16, 0x1.4ce19ae67b348p-19,
+	0x1.fffff6c0d8244p-1, 0x1.71de3a556c734p-19, -0x1.a01a01a01a01ap-17, 0x1.1566abc011567p-15, -0x1.e573ac901e574p-15, 0x1.23456789abcdfp-14, -0x1.e573ac901e574p-15, 0x1.1566abc011567p-15, -0x1.a01a01a01a01ap-17, 0x1.71de3a556c734p-19, -0x1.27e4fb7789f5cp-22,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 11 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.ae64567f544e4p-26,
+	0x1.ae64567f544e4p-26, 0x1.27e4fb7789f5cp-22, 0x1.71de3a556c734p-20, 0x1.1566abc011567p-18, 0x1.1566abc011567p-17, 0x1.845c8a0ce5129p-17, 0x1.845c8a0ce5129p-17, 0x1.1566abc011567p-17, 0x1.1566abc011567p-18, 0x1.71de3a556c734p-20, 0x1.27e4fb7789f5cp-22, -0x1.0cfeb60f94b0ep-22,
+	0x1.ac148c88653a5p-15, 0x1.24b745c4013a6p-12, 0x1.69ebf414969ecp-11, 0x1.097b425ed097bp-10, 0x1.fb1fb1fb1fb2p-11, 0x1.419ca252adb36p-11, 0x1.fdb97530eca86p-13, 0x1.5ac056b015acp-15, -0x1.a01a01a01a01ap-17, -0x1.43a2730abee4dp-17, -0x1.4ce19ae67b348p-19, 0x1.2e9e8cd18747p-20,
+	0x1.fbe465d6a7e38p-9, 0x1.affe8e21c5aa9p-7, 0x1.3e713c691be71p-6, 0x1.015ac056b015bp-6, 0x1.c3dc3dc3dc3dcp-8, 0x1.e573ac901e574p-11, -0x1.47ae147ae147bp-11, -0x1.5ac056b015acp-12, -0x1.a01a01a01a01ap-16, 0x1.ce55c8eac79p-16, 0x1.4ce19ae67b348p-17, -0x1.937e11175f095p-19,
+	0x1.e3f54d4b8597cp-5, 0x1.00e602ff79ec4p-3, 0x1.9f86a314dbf87p-4, 0x1.ed097b425ed09p-6, -0x1.b05b05b05b05bp-8, -0x1.aed6a9264e20ap-8, -0x1.47ae147ae147bp-11, 0x1.5ac056b015acp-11, 0x1.6c16c16c16c17p-13, -0x1.43a2730abee4dp-15, -0x1.845c8a0ce5129p-16, 0x1.610e4ef473283p-18,
+	0x1.364f636906779p-2, 0x1.71c3c9bf7424cp-2, 0x1.7f86a314dbf87p-4, -0x1.7f86a314dbf87p-5, -0x1.60b60b60b60b6p-6, 0x1.49327104ee2ccp-8, 0x1.a2b3c4d5e6f81p-9, -0x1.8ec396e418ec4p-12, -0x1.6c16c16c16c17p-12, 0x1.43a2730abee4dp-16, 0x1.23456789abcdfp-15, -0x1.a7aac52556fdp-18,
+	0x1.64d84e4b7cc43p-1, 0x1.71c3c9bf7424cp-2, -0x1.7f86a314dbf87p-4, -0x1.7f86a314dbf87p-5, 0x1.60b60b60b60b6p-6, 0x1.49327104ee2ccp-8, -0x1.a2b3c4d5e6f81p-9, -0x1.8ec396e418ec4p-12, 0x1.6c16c16c16c17p-12, 0x1.43a2730abee4dp-16, -0x1.23456789abcdfp-15, 0x1.610e4ef473283p-18,
+	0x1.e1c0ab2b47a68p-1, 0x1.00e602ff79ec4p-3, -0x1.9f86a314dbf87p-4, 0x1.ed097b425ed09p-6, 0x1.b05b05b05b05bp-8, -0x1.aed6a9264e20ap-8, 0x1.47ae147ae147bp-11, 0x1.5ac056b015acp-11, -0x1.6c16c16c16c17p-13, -0x1.43a2730abee4dp-15, 0x1.845c8a0ce5129p-16, -0x1.937e11175f095p-19,
+	0x1.fe041b9a29582p-1, 0x1.affe8e21c5aa9p-7, -0x1.3e713c691be71p-6, 0x1.015ac056b015bp-6, -0x1.c3dc3dc3dc3dcp-8, 0x1.e573ac901e574p-11, 0x1.47ae147ae147bp-11, -0x1.5ac056b015acp-12, 0x1.a01a01a01a01ap-16, 0x1.ce55c8eac79p-16, -0x1.4ce19ae67b348p-17, 0x1.2e9e8cd18747p-20,
+	0x1.fff94fadcdde7p-1, 0x1.24b745c4013a6p-12, -0x1.69ebf414969ecp-11, 0x1.097b425ed097bp-10, -0x1.fb1fb1fb1fb2p-11, 0x1.419ca252adb36p-11, -0x1.fdb97530eca86p-13, 0x1.5ac056b015acp-15, 0x1.a01a01a01a01ap-17, -0x1.43a2730abee4dp-17, 0x1.4ce19ae67b348p-19, -0x1.0cfeb60f94b0ep-22,
+	0x1.ffffff28cdd4cp-1, 0x1.27e4fb7789f5cp-22, -0x1.71de3a556c734p-20, 0x1.1566abc011567p-18, -0x1.1566abc011567p-17, 0x1.845c8a0ce5129p-17, -0x1.845c8a0ce5129p-17, 0x1.1566abc011567p-17, -0x1.1566abc011567p-18, 0x1.71de3a556c734p-20, -0x1.27e4fb7789f5cp-22, 0x1.ae64567f544e4p-26,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 12 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.1eed8eff8d898p-29,
+	0x1.1eed8eff8d898p-29, 0x1.ae64567f544e4p-26, 0x1.27e4fb7789f5cp-23, 0x1.ed284dc73b445p-22, 0x1.1566abc011567p-20, 0x1.bbd779334ef0bp-20, 0x1.02e85c0898b71p-19, 0x1.bbd779334ef0bp-20, 0x1.1566abc011567p-20, 0x1.ed284dc73b445p-22, 0x1.27e4fb7789f5cp-23, 0x1.ae64567f544e4p-26, -0x1.8a86a49f629d1p-26,
+	0x1.1e165cd44ddf5p-17, 0x1.abdebffd954fcp-15, 0x1.246d4c852357ep-13, 0x1.e1995bf48fe0bp-13, 0x1.0865dbb310866p-12, 0x1.923b45d67f8a2p-13, 0x1.a4b9958df8297p-14, 0x1.1566abc011567p-15, 0x1.1566abc011567p-18, -0x1.ed284dc73b445p-20, -0x1.27e4fb7789f5cp-20, -0x1.0cfeb60f94b0ep-22, 0x1.ed284dc73b445p-24,
+	0x1.07faae3686512p-10, 0x1.f53413a4864eap-9, 0x1.a6d8d3f3a5a0cp-8, 0x1.99827bb5f442dp-8, 0x1.e186186186186p-9, 0x1.36c69f9d2d06p-10, 0x1.b4e81b4e81b4fp-15, -0x1.041041041041p-13, -0x1.8618618618618p-15, -0x1.71de3a556c734p-20, 0x1.f3526859b8cecp-19, 0x1.2e9e8cd18747p-20, -0x1.71de3a556c734p-22,
+	0x1.6cf6915991b82p-6, 0x1.c43706ee1b199p-5, 0x1.cbcc343abb233p-5, 0x1.bfe31aa371538p-6, 0x1.d75d75d75d75dp-9, -0x1.61afb494e2e7dp-9, -0x1.47ae147ae147bp-10, 0x0p+0, 0x1.041041041041p-13, 0x1.71de3a556c734p-16, -0x1.bbd779334ef0bp-18, -0x1.937e11175f095p-19, 0x1.71de3a556c734p-21,
+	0x1.492b437288df2p-3, 0x1.f3a1737f2b893p-3, 0x1.e2a1907f6e5d5p-4, -0x1.5555555555555p-9, -0x1.3b05b05b05b06p-6, -0x1.87654320fedccp-9, 0x1.fab0bc1cd2de4p-10, 0x1.1e11e11e11e12p-11, -0x1.1111111111111p-13, -0x1.e573ac901e574p-15, 0x1.845c8a0ce5129p-18, 0x1.610e4ef473283p-18, -0x1.02e85c0898b71p-20,
+	0x1p-1, 0x1.9361392df310dp-2, 0x0p+0, -0x1.ff5e2ec67aa09p-5, 0x0p+0, 0x1.1a2b3c4d5e6f8p-7, 0x0p+0, -0x1.de844eab511b8p-11, 0x0p+0, 0x1.43a2730abee4dp-14, 0x0p+0, -0x1.a7aac52556fdp-18, 0x1.02e85c0898b71p-20,
+	0x1.adb52f235dc84p-1, 0x1.f3a1737f2b893p-3, -0x1.e2a1907f6e5d5p-4, -0x1.5555555555555p-9, 0x1.3b05b05b05b06p-6, -0x1.87654320fedccp-9, -0x1.fab0bc1cd2de4p-10, 0x1.1e11e11e11e12p-11, 0x1.1111111111111p-13, -0x1.e573ac901e574p-15, -0x1.845c8a0ce5129p-18, 0x1.610e4ef473283p-18, -0x1.71de3a556c734p-21,
+	0x1.f4984b7533724p-1, 0x1.c43706ee1b199p-5, -0x1.cbcc343abb233p-5, 0x1.bfe31aa371538p-6, -0x1.d75d75d75d75dp-9, -0x1.61afb494e2e7dp-9, 0x1.47ae147ae147bp-10, 0x0p+0, -0x1.041041041041p-13, 0x1.71de3a556c734p-16, 0x1.bbd779334ef0bp-18, -0x1.937e11175f095p-19, 0x1.71de3a556c734p-22,
+	0x1.ff7c02a8e4bcdp-1, 0x1.f53413a4864eap-9, -0x1.a6d8d3f3a5a0cp-8, 0x1.99827bb5f442dp-8, -0x1.e186186186186p-9, 0x1.36c69f9d2d06p-10, -0x1.b4e81b4e81b4fp-15, -0x1.041041041041p-13, 0x1.8618618618618p-15, -0x1.71de3a556c734p-20, -0x1.f3526859b8cecp-19, 0x1.2e9e8cd18747p-20, -0x1.ed284dc73b445p-24,
+	0x1.fffee1e9a32bbp-1, 0x1.abdebffd954fcp-15, -0x1.246d4c852357ep-13, 0x1.e1995bf48fe0bp-13, -0x1.0865dbb310866p-12, 0x1.923b45d67f8a2p-13, -0x1.a4b9958df8297p-14, 0x1.1566abc011567p-15, -0x1.1566abc011567p-18, -0x1.ed284dc73b445p-20, 0x1.27e4fb7789f5cp-20, -0x1.0cfeb60f94b0ep-22, 0x1.8a86a49f629d1p-26,
+	0x1.ffffffee11271p-1, 0x1.ae64567f544e4p-26, -0x1.27e4fb7789f5cp-23, 0x1.ed284dc73b445p-22, -0x1.1566abc011567p-20, 0x1.bbd779334ef0bp-20, -0x1.02e85c0898b71p-19, 0x1.bbd779334ef0bp-20, -0x1.1566abc011567p-20, 0x1.ed284dc73b445p-22, -0x1.27e4fb7789f5cp-23, 0x1.ae64567f544e4p-26, -0x1.1eed8eff8d898p-29,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 13 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.6124613a86d09p-33,
+	0x1.6124613a86d09p-33, 0x1.1eed8eff8d898p-29, 0x1.ae64567f544e4p-27, 0x1.8a86a49f629d1p-25, 0x1.ed284dc73b445p-24, 0x1.bbd779334ef0bp-23, 0x1.27e4fb7789f5cp-22, 0x1.27e4fb7789f5cp-22, 0x1.bbd779334ef0bp-23, 0x1.ed284dc73b445p-24, 0x1.8a86a49f629d1p-25, 0x1.ae64567f544e4p-27, 0x1.1eed8eff8d898p-29, -0x1.08db48ebe51c7p-29,
+	0x1.6094ea730709dp-20, 0x1.1e046dfb5de68p-17, 0x1.aba8f372c5654p-16, 0x1.85846f085c9c9p-15, 0x1.e0a2c7cdac431p-15, 0x1.a54d880bb3ee7p-15, 0x1.09d7b9ed65f2dp-15, 0x1.d794f0c683dfbp-17, 0x1.0787eff676deep-18, 0x1.71de3a556c734p-22, -0x1.ed284dc73b445p-23, -0x1.e430e14f3ed8p-24, -0x1.8a86a49f629d1p-26, 0x1.6c2d84445b072p-27,
+	0x1.f519b75154543p-13, 0x1.05be817cddb56p-10, 0x1.ee8498a48ff96p-10, 0x1.13ce465fa8595p-9, 0x1.8a75b0d64fc3dp-10, 0x1.66c77d88e99fbp-11, 0x1.5b54492dd171p-13, -0x1.ce55c8eac79p-18, -0x1.4969ebf41496ap-16, -0x1.7992db8c89605p-18, 0x1.8a86a49f629d1p-25, 0x1.d6bdbe9b44359p-22, 0x1.ed284dc73b445p-24, -0x1.2f7b438e4bdb4p-25,
+	0x1.eedfc732c0bf7p-8, 0x1.5c76e67629531p-6, 0x1.a4e3c5b3d2b4ap-6, 0x1.0f4b667d844a1p-6, 0x1.59827bb5f442dp-8, -0x1.041041041041p-16, -0x1.536202ecfb9c8p-11, -0x1.8618618618618p-13, 0x1.041041041041p-16, 0x1.3ddafa216933p-16, 0x1.3a634b2f02952p-19, -0x1.f85d955d36cbbp-21, -0x1.71de3a556c734p-22, 0x1.556aac001556bp-24,
+	0x1.355ae7c85851dp-4, 0x1.1b8c714756a82p-3, 0x1.8293b1c3a4c2dp-4, 0x1.50f9f32d6bba5p-6, -0x1.ea8dc54e1bfe3p-8, -0x1.2b277f44c118ep-8, -0x1.923b45d67f8a2p-15, 0x1.dcc877321dcc8p-12, 0x1.1e11e11e11e12p-14, -0x1.d9e4babd72f3ap-16, -0x1.0c2783e45506cp-17, 0x1.2e9e8cd18747p-20, 0x1.71de3a556c734p-21, -0x1.1122233344455p-23,
+	0x1.44ee1c014c3c1p-2, 0x1.5b6a5e46bb907p-2, 0x1.3320fedcba987p-4, -0x1.41c10aff9ee8ep-5, -0x1.ea08d971254b4p-7, 0x1.f8091a2b3c4d6p-9, 0x1.fab0bc1cd2de4p-10, -0x1.21899010787fp-12, -0x1.7e4b17e4b17e5p-13, 0x1.e573ac901e574p-17, 0x1.c516a10f0b406p-17, -0x1.1a71d8c38f535p-21, -0x1.02e85c0898b71p-20, 0x1.3ea7d3bbcfa64p-23,
+	0x1.5d88f1ff59e1fp-1, 0x1.5b6a5e46bb907p-2, -0x1.3320fedcba987p-4, -0x1.41c10aff9ee8ep-5, 0x1.ea08d971254b4p-7, 0x1.f8091a2b3c4d6p-9, -0x1.fab0bc1cd2de4p-10, -0x1.21899010787fp-12, 0x1.7e4b17e4b17e5p-13, 0x1.e573ac901e574p-17, -0x1.c516a10f0b406p-17, -0x1.1a71d8c38f535p-21, 0x1.02e85c0898b71p-20, -0x1.1122233344455p-23,
+	0x1.d954a306f4f5cp-1, 0x1.1b8c714756a82p-3, -0x1.8293b1c3a4c2dp-4, 0x1.50f9f32d6bba5p-6, 0x1.ea8dc54e1bfe3p-8, -0x1.2b277f44c118ep-8, 0x1.923b45d67f8a2p-15, 0x1.dcc877321dcc8p-12, -0x1.1e11e11e11e12p-14, -0x1.d9e4babd72f3ap-16, 0x1.0c2783e45506cp-17, 0x1.2e9e8cd18747p-20, -0x1.71de3a556c734p-21, 0x1.556aac001556bp-24,
+	0x1.fc2240719a7e8p-1, 0x1.5c76e67629531p-6, -0x1.a4e3c5b3d2b4ap-6, 0x1.0f4b667d844a1p-6, -0x1.59827bb5f442dp-8, -0x1.041041041041p-16, 0x1.536202ecfb9c8p-11, -0x1.8618618618618p-13, -0x1.041041041041p-16, 0x1.3ddafa216933p-16, -0x1.3a634b2f02952p-19, -0x1.f85d955d36cbbp-21, 0x1.71de3a556c734p-22, -0x1.2f7b438e4bdb4p-25,
+	0x1.ffe0ae648aeacp-1, 0x1.05be817cddb56p-10, -0x1.ee8498a48ff96p-10, 0x1.13ce465fa8595p-9, -0x1.8a75b0d64fc3dp-10, 0x1.66c77d88e99fbp-11, -0x1.5b54492dd171p-13, -0x1.ce55c8eac79p-18, 0x1.4969ebf41496ap-16, -0x1.7992db8c89605p-18, -0x1.8a86a49f629d1p-25, 0x1.d6bdbe9b44359p-22, -0x1.ed284dc73b445p-24, 0x1.6c2d84445b072p-27,
+	0x1.ffffd3ed62b1ap-1, 0x1.1e046dfb5de68p-17, -0x1.aba8f372c5654p-16, 0x1.85846f085c9c9p-15, -0x1.e0a2c7cdac431p-15, 0x1.a54d880bb3ee7p-15, -0x1.09d7b9ed65f2dp-15, 0x1.d794f0c683dfbp-17, -0x1.0787eff676deep-18, 0x1.71de3a556c734p-22, 0x1.ed284dc73b445p-23, -0x1.e430e14f3ed8p-24, 0x1.8a86a49f629d1p-26, -0x1.08db48ebe51c7p-29,
+	0x1.fffffffe9edbap-1, 0x1.1eed8eff8d898p-29, -0x1.ae64567f544e4p-27, 0x1.8a86a49f629d1p-25, -0x1.ed284dc73b445p-24, 0x1.bbd779334ef0bp-23, -0x1.27e4fb7789f5cp-22, 0x1.27e4fb7789f5cp-22, -0x1.bbd779334ef0bp-23, 0x1.ed284dc73b445p-24, -0x1.8a86a49f629d1p-25, 0x1.ae64567f544e4p-27, -0x1.1eed8eff8d898p-29, 0x1.6124613a86d09p-33,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 14 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.93974a8c07c9dp-37,
+	0x1.93974a8c07c9dp-37, 0x1.6124613a86d09p-33, 0x1.1eed8eff8d898p-30, 0x1.1eed8eff8d898p-28, 0x1.8a86a49f629d1p-27, 0x1.8a86a49f629d1p-26, 0x1.27e4fb7789f5cp-25, 0x1.522a43f65486ap-25, 0x1.27e4fb7789f5cp-25, 0x1.8a86a49f629d1p-26, 0x1.8a86a49f629d1p-27, 0x1.1eed8eff8d898p-28, 0x1.1eed8eff8d898p-30, 0x1.6124613a86d09p-33, -0x1.47eaec91c654p-33,
+	0x1.933f0173b9282p-23, 0x1.6089e14ffd35ap-20, 0x1.1df27f226dedap-18, 0x1.1cf76f454e51dp-17, 0x1.8521cd5f34c3ep-17, 0x1.7fbcf61f06eacp-17, 0x1.17b675b7006a5p-17, 0x1.2d2da4876347ep-18, 0x1.ce55c8eac79p-20, 0x1.bbd779334ef0bp-22, 0x1.8a86a49f629d1p-26, -0x1.ae64567f544e4p-26, -0x1.66a8f2bf70ebep-27, -0x1.08db48ebe51c7p-29, 0x1.ebe062daa97dfp-31,
+	0x1.b62bfc0764747p-15, 0x1.f2588d7c6e462p-13, 0x1.038278a0e6f99p-11, 0x1.45394de483428p-11, 0x1.0db834a386e6ep-11, 0x1.2f8d487981e7cp-12, 0x1.bb4386b5932bbp-14, 0x1.40fe1e82d23bcp-16, -0x1.5f5fea9df3d3ep-19, -0x1.5f5fea9df3d3ep-19, -0x1.408d65c1801f9p-21, 0x1.ae64567f544e4p-26, 0x1.8a86a49f629d1p-25, 0x1.6c2d84445b072p-27, -0x1.c2e3054870b38p-29,
+	0x1.3127e0de58c37p-9, 0x1.df36f978361cdp-8, 0x1.4c1afe5e5b77cp-7, 0x1.03fcfd710678bp-7, 0x1.d9a33b631e7dcp-9, 0x1.8b0818cd66e96p-11, -0x1.e93554c162d7ap-14, -0x1.e71a61651240ep-14, -0x1.77a5b33ec225p-16, 0x1.05fd6951d77c5p-18, 0x1.49cc8d9d3c6f4p-19, 0x1.c0532f6f4d26dp-23, -0x1.ed284dc73b445p-24, -0x1.2f7b438e4bdb4p-25, 0x1.19cde34d46703p-27,
+	0x1.04bc0eb577b78p-5, 0x1.166ceb552c45dp-4, 0x1.dffb28f122fb7p-5, 0x1.7723ab1e401cep-6, 0x1.06ba32bf9dc1p-10, -0x1.4e6ce6ce6ce6dp-9, -0x1.8d849404fc0b8p-11, 0x1.6722a2ed3b047p-14, 0x1.4fea53fa94feap-14, 0x1.88fc1dfac33a7p-18, -0x1.3cb31525f1a91p-18, -0x1.f85d955d36cbbp-21, 0x1.71de3a556c734p-23, 0x1.556aac001556bp-24, -0x1.fb3f65f17ec9ep-27,
+	0x1.6ee61115c84aep-3, 0x1.ef2ec41e6c4f4p-3, 0x1.9b484b462078dp-4, -0x1.a7b90f7a36375p-8, -0x1.ea3e049654c6p-7, -0x1.879cbe102546ap-10, 0x1.6f72b2e6ea2a6p-10, 0x1.28b855e203eaap-12, -0x1.7f2903a14b25cp-14, -0x1.d2f55cd8a5b7ep-16, 0x1.1ea5d39bcda62p-18, 0x1.064524b5975fbp-19, -0x1.27e4fb7789f5cp-23, -0x1.1122233344455p-23, 0x1.522a43f65486ap-26,
+	0x1p-1, 0x1.7623c7fd6787ep-2, 0x0p+0, -0x1.998153d0f8cb5p-5, 0x0p+0, 0x1.8807145a843c3p-8, 0x0p+0, -0x1.21899010787fp-11, 0x0p+0, 0x1.53d0f8cb48704p-15, 0x0p+0, -0x1.4984d2397c8bep-19, 0x0p+0, 0x1.3ea7d3bbcfa64p-23, -0x1.522a43f65486ap-26,
+	0x1.a4467bba8ded5p-1, 0x1.ef2ec41e6c4f4p-3, -0x1.9b484b462078dp-4, -0x1.a7b90f7a36375p-8, 0x1.ea3e049654c6p-7, -0x1.879cbe102546ap-10, -0x1.6f72b2e6ea2a6p-10, 0x1.28b855e203eaap-12, 0x1.7f2903a14b25cp-14, -0x1.d2f55cd8a5b7ep-16, -0x1.1ea5d39bcda62p-18, 0x1.064524b5975fbp-19, 0x1.27e4fb7789f5cp-23, -0x1.1122233344455p-23, 0x1.fb3f65f17ec9ep-27,
+	0x1.efb43f14a8848p-1, 0x1.166ceb552c45dp-4, -0x1.dffb28f122fb7p-5, 0x1.7723ab1e401cep-6, -0x1.06ba32bf9dc1p-10, -0x1.4e6ce6ce6ce6dp-9, 0x1.8d849404fc0b8p-11, 0x1.6722a2ed3b047p-14, -0x1.4fea53fa94feap-14, 0x1.88fc1dfac33a7p-18, 0x1.3cb31525f1a91p-18, -0x1.f85d955d36cbbp-21, -0x1.71de3a556c734p-23, 0x1.556aac001556bp-24, -0x1.19cde34d46703p-27,
+	0x1.feced81f21a74p-1, 0x1.df36f978361cdp-8, -0x1.4c1afe5e5b77cp-7, 0x1.03fcfd710678bp-7, -0x1.d9a33b631e7dcp-9, 0x1.8b0818cd66e96p-11, 0x1.e93554c162d7ap-14, -0x1.e71a61651240ep-14, 0x1.77a5b33ec225p-16, 0x1.05fd6951d77c5p-18, -0x1.49cc8d9d3c6f4p-19, 0x1.c0532f6f4d26dp-23, 0x1.ed284dc73b445p-24, -0x1.2f7b438e4bdb4p-25, 0x1.c2e3054870b38p-29,
+	0x1.fff927500fe27p-1, 0x1.f2588d7c6e462p-13, -0x1.038278a0e6f99p-11, 0x1.45394de483428p-11, -0x1.0db834a386e6ep-11, 0x1.2f8d487981e7cp-12, -0x1.bb4386b5932bbp-14, 0x1.40fe1e82d23bcp-16, 0x1.5f5fea9df3d3ep-19, -0x1.5f5fea9df3d3ep-19, 0x1.408d65c1801f9p-21, 0x1.ae64567f544e4p-26, -0x1.8a86a49f629d1p-25, 0x1.6c2d84445b072p-27, -0x1.ebe062daa97dfp-31,
+	0x1.fffff9b303fa3p-1, 0x1.6089e14ffd35ap-20, -0x1.1df27f226dedap-18, 0x1.1cf76f454e51dp-17, -0x1.8521cd5f34c3ep-17, 0x1.7fbcf61f06eacp-17, -0x1.17b675b7006a5p-17, 0x1.2d2da4876347ep-18, -0x1.ce55c8eac79p-20, 0x1.bbd779334ef0bp-22, -0x1.8a86a49f629d1p-26, -0x1.ae64567f544e4p-26, 0x1.66a8f2bf70ebep-27, -0x1.08db48ebe51c7p-29, 0x1.47eaec91c654p-33,
+	0x1.ffffffffe6c69p-1, 0x1.6124613a86d09p-33, -0x1.1eed8eff8d898p-30, 0x1.1eed8eff8d898p-28, -0x1.8a86a49f629d1p-27, 0x1.8a86a49f629d1p-26, -0x1.27e4fb7789f5cp-25, 0x1.522a43f65486ap-25, -0x1.27e4fb7789f5cp-25, 0x1.8a86a49f629d1p-26, -0x1.8a86a49f629d1p-27, 0x1.1eed8eff8d898p-28, -0x1.1eed8eff8d898p-30, 0x1.6124613a86d09p-33, -0x1.93974a8c07c9dp-37,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 15 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.ae7f3e733b81fp-41,
+	0x1.ae7f3e733b81fp-41, 0x1.93974a8c07c9dp-37, 0x1.6124613a86d09p-34, 0x1.7e9213ff6762p-32, 0x1.1eed8eff8d898p-30, 0x1.3b9eea191bb0dp-29, 0x1.07046dbf97136p-28, 0x1.522a43f65486ap-28, 0x1.522a43f65486ap-28, 0x1.07046dbf97136p-28, 0x1.3b9eea191bb0dp-29, 0x1.1eed8eff8d898p-30, 0x1.7e9213ff6762p-32, 0x1.6124613a86d09p-34, 0x1.93974a8c07c9dp-37, -0x1.78af56a4d411bp-37,
+	0x1.ae4ccb89ea00fp-26, 0x1.9338b3168ef8p-23, 0x1.607ed82cf3616p-21, 0x1.7d2b6b0ca7f11p-20, 0x1.1cd391936e602p-19, 0x1.36ff562b3d89p-19, 0x1.fe9f9910f44c9p-20, 0x1.3e59c9fae592bp-20, 0x1.2a894fff769edp-21, 0x1.92bec80d5f55ap-23, 0x1.4f58d8baad6bep-25, 0x1.1eed8eff8d898p-30, -0x1.4ebfd17f7a75cp-29, -0x1.e59205b0795edp-31, -0x1.47eaec91c654p-33, 0x1.320e7665ec4e6p-34,
+	0x1.6393f9a42914p-17, 0x1.b498bd05f0bb4p-15, 0x1.ef9779b9ce4bbp-14, 0x1.5708c4d8d827ap-13, 0x1.40c570276e094p-13, 0x1.a5d2af1676862p-14, 0x1.84bf2bb60ceb4p-15, 0x1.d2a0d247a822cp-17, 0x1.eb656ac1f2d3ap-20, -0x1.02e85c0898b71p-21, -0x1.457be169e48e6p-22, -0x1.e430e14f3ed8p-25, 0x1.1eed8eff8d898p-28, 0x1.29f6b20961cp-28, 0x1.ebe062daa97dfp-31, -0x1.320e7665ec4e6p-32,
+	0x1.59951613e89e5p-11, 0x1.2a4f30ee3b31ap-9, 0x1.cfa4350c52aaap-9, 0x1.a52e73c5bc0aep-9, 0x1.df52d1257c891p-10, 0x1.44f7582e97034p-11, 0x1.44574616329cbp-14, -0x1.0a6bac6b21b7dp-15, -0x1.1bacf482e367fp-16, -0x1.26ddf709ca5ebp-19, 0x1.5e244bb3dab83p-21, 0x1.2a22d6958910ep-22, 0x1.07046dbf97136p-26, -0x1.a8dfc4fa6a32fp-27, -0x1.c2e3054870b38p-29, 0x1.a4d3e2cc24ebcp-31,
+	0x1.8e8163c1ae6aap-7, 0x1.e353214f2456ap-6, 0x1.f0f2f77b51c81p-6, 0x1.08a2f0e65d69p-6, 0x1.ea4a58cb79c11p-9, -0x1.11d1b4cf72e43p-11, -0x1.20c9f356846b7p-11, -0x1.806b53ea11ee5p-14, 0x1.a71e822926a2bp-16, 0x1.7e118eecaf954p-17, 0x1.a32f0ee958c6ep-23, -0x1.5e40fd0ef4465p-21, -0x1.9af6eb7b5c0e4p-24, 0x1.7b5a1471ded21p-26, 0x1.19cde34d46703p-27, -0x1.a4d3e2cc24ebcp-30,
+	0x1.73bd4547ddbfcp-4, 0x1.2db70d686a5dp-3, 0x1.63f84e73d62c5p-4, 0x1.c8c73cced29d8p-7, -0x1.e111eefccdaacp-8, -0x1.a2776f2506cb5p-9, 0x1.71a6bf6646096p-13, 0x1.438bfe3c3b893p-12, 0x1.9ddf5a4d6a53p-16, -0x1.3f96d19a9c81fp-16, -0x1.c429e9df786b9p-19, 0x1.b6cc4c2fd0f3cp-21, 0x1.02e85c0898b71p-22, -0x1.99b334cce668p-26, -0x1.fb3f65f17ec9ep-27, 0x1.3b9eea191bb0dp-29,
+	0x1.50c5e26c35695p-2, 0x1.488cf7751bda9p-2, 0x1.fa3197b8c580fp-5, -0x1.1230322ec0508p-5, -0x1.648a31e1b2046p-7, 0x1.88319d45109e7p-9, 0x1.469ed7e9b3b3ep-10, -0x1.a3f0cc759de74p-13, -0x1.b5e5bb017a745p-14, 0x1.54963c1d98219p-17, 0x1.caa2ec2c7c3cfp-18, -0x1.a0f133cb59abcp-22, -0x1.8a86a49f629d1p-22, 0x1.6c2d84445b072p-27, 0x1.522a43f65486ap-26, -0x1.68b59dd38d5c6p-29,
+	0x1.579d0ec9e54b6p-1, 0x1.488cf7751bda9p-2, -0x1.fa3197b8c580fp-5, -0x1.1230322ec0508p-5, 0x1.648a31e1b2046p-7, 0x1.88319d45109e7p-9, -0x1.469ed7e9b3b3ep-10, -0x1.a3f0cc759de74p-13, 0x1.b5e5bb017a745p-14, 0x1.54963c1d98219p-17, -0x1.caa2ec2c7c3cfp-18, -0x1.a0f133cb59abcp-22, 0x1.8a86a49f629d1p-22, 0x1.6c2d84445b072p-27, -0x1.522a43f65486ap-26, 0x1.3b9eea191bb0dp-29,
+	0x1.d188575704481p-1, 0x1.2db70d686a5dp-3, -0x1.63f84e73d62c5p-4, 0x1.c8c73cced29d8p-7, 0x1.e111eefccdaacp-8, -0x1.a2776f2506cb5p-9, -0x1.71a6bf6646096p-13, 0x1.438bfe3c3b893p-12, -0x1.9ddf5a4d6a53p-16, -0x1.3f96d19a9c81fp-16, 0x1.c429e9df786b9p-19, 0x1.b6cc4c2fd0f3cp-21, -0x1.02e85c0898b71p-22, -0x1.99b334cce668p-26, 0x1.fb3f65f17ec9ep-27, -0x1.a4d3e2cc24ebcp-30,
+	0x1.f9c5fa70f9465p-1, 0x1.e353214f2456ap-6, -0x1.f0f2f77b51c81p-6, 0x1.08a2f0e65d69p-6, -0x1.ea4a58cb79c11p-9, -0x1.11d1b4cf72e43p-11, 0x1.20c9f356846b7p-11, -0x1.806b53ea11ee5p-14, -0x1.a71e822926a2bp-16, 0x1.7e118eecaf954p-17, -0x1.a32f0ee958c6ep-23, -0x1.5e40fd0ef4465p-21, 0x1.9af6eb7b5c0e4p-24, 0x1.7b5a1471ded21p-26, -0x1.19cde34d46703p-27, 0x1.a4d3e2cc24ebcp-31,
+	0x1.ffa99aba7b05ep-1, 0x1.2a4f30ee3b31ap-9, -0x1.cfa4350c52aaap-9, 0x1.a52e73c5bc0aep-9, -0x1.df52d1257c891p-10, 0x1.44f7582e97034p-11, -0x1.44574616329cbp-14, -0x1.0a6bac6b21b7dp-15, 0x1.1bacf482e367fp-16, -0x1.26ddf709ca5ebp-19, -0x1.5e244bb3dab83p-21, 0x1.2a22d6958910ep-22, -0x1.07046dbf97136p-26, -0x1.a8dfc4fa6a32fp-27, 0x1.c2e3054870b38p-29, -0x1.320e7665ec4e6p-32,
+	0x1.fffe9c6c065bdp-1, 0x1.b498bd05f0bb4p-15, -0x1.ef9779b9ce4bbp-14, 0x1.5708c4d8d827ap-13, -0x1.40c570276e094p-13, 0x1.a5d2af1676862p-14, -0x1.84bf2bb60ceb4p-15, 0x1.d2a0d247a822cp-17, -0x1.eb656ac1f2d3ap-20, -0x1.02e85c0898b71p-21, 0x1.457be169e48e6p-22, -0x1.e430e14f3ed8p-25, -0x1.1eed8eff8d898p-28, 0x1.29f6b20961cp-28, -0x1.ebe062daa97dfp-31, 0x1.320e7665ec4e6p-34,
+	0x1.ffffff28d99a4p-1, 0x1.9338b3168ef8p-23, -0x1.607ed82cf3616p-21, 0x1.7d2b6b0ca7f11p-20, -0x1.1cd391936e602p-19, 0x1.36ff562b3d89p-19, -0x1.fe9f9910f44c9p-20, 0x1.3e59c9fae592bp-20, -0x1.2a894fff769edp-21, 0x1.92bec80d5f55ap-23, -0x1.4f58d8baad6bep-25, 0x1.1eed8eff8d898p-30, 0x1.4ebfd17f7a75cp-29, -0x1.e59205b0795edp-31, 0x1.47eaec91c654p-33, -0x1.78af56a4d411bp-37,
+	0x1.fffffffffe518p-1, 0x1.93974a8c07c9dp-37, -0x1.6124613a86d09p-34, 0x1.7e9213ff6762p-32, -0x1.1eed8eff8d898p-30, 0x1.3b9eea191bb0dp-29, -0x1.07046dbf97136p-28, 0x1.522a43f65486ap-28, -0x1.522a43f65486ap-28, 0x1.07046dbf97136p-28, -0x1.3b9eea191bb0dp-29, 0x1.1eed8eff8d898p-30, -0x1.7e9213ff6762p-32, 0x1.6124613a86d09p-34, -0x1.93974a8c07c9dp-37, 0x1.ae7f3e733b81fp-41,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 16 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.ae7f3e733b81fp-45,
+	0x1.ae7f3e733b81fp-45, 0x1.ae7f3e733b81fp-41, 0x1.93974a8c07c9dp-38, 0x1.d6db2c4e09162p-36, 0x1.7e9213ff6762p-34, 0x1.cb15b198e2759p-33, 0x1.a4d3e2cc24ebcp-32, 0x1.2c9758daf5cdp-31, 0x1.522a43f65486ap-31, 0x1.2c9758daf5cdp-31, 0x1.a4d3e2cc24ebcp-32, 0x1.cb15b198e2759p-33, 0x1.7e9213ff6762p-34, 0x1.d6db2c4e09162p-36, 0x1.93974a8c07c9dp-38, 0x1.ae7f3e733b81fp-41, -0x1.93974a8c07c9dp-41,
+	0x1.ae64567f544e4p-29, 0x1.ae496e8b6d1a8p-26, 0x1.933264b964c7ep-24, 0x1.d5efbeb7e2119p-23, 0x1.7d1381eb67fa9p-22, 0x1.c77f8635b0b0ap-22, 0x1.9e409340f4581p-22, 0x1.23329e141e1e9p-22, 0x1.3d079fb6ef3e3p-23, 0x1.07046dbf97136p-24, 0x1.3b9eea191bb0dp-26, 0x1.cb15b198e2759p-29, 0x0p+0, -0x1.d6db2c4e09162p-33, -0x1.2eb177e905d76p-34, -0x1.78af56a4d411bp-37, 0x1.6124613a86d09p-38,
+	0x1.0d6a3805deeb4p-19, 0x1.62bcd33e641fp-17, 0x1.b3058452da2c5p-16, 0x1.488efd5ba2edfp-15, 0x1.540e6e02bed7cp-15, 0x1.fa1d0301cd4c6p-16, 0x1.12bc784368669p-16, 0x1.aa0ba35898534p-18, 0x1.aad599084b706p-20, 0x1.301d1ee586ae6p-23, -0x1.1facd8098d3d3p-24, -0x1.0b33a05dfbce7p-25, -0x1.48c5892f7cd83p-28, 0x1.1792224e55652p-31, 0x1.99e5a7b637e9p-32, 0x1.320e7665ec4e6p-34, -0x1.7e9213ff6762p-36,
+	0x1.6a4005c79a8b4p-13, 0x1.5406c62d57fap-11, 0x1.237ccdfa236ebp-10, 0x1.2ac4fb7f02d03p-10, 0x1.8fbde7782e886p-11, 0x1.5f61b5b3a56ccp-12, 0x1.6afc030fb598ap-14, 0x1.291192d064eb9p-18, -0x1.7f13e0fd0bc08p-18, -0x1.1774b49b90849p-19, -0x1.70396672a04e5p-23, 0x1.7501a04c37ff8p-24, 0x1.de3698ff413a8p-26, 0x1.d6db2c4e09162p-31, -0x1.47eaec91c654p-30, -0x1.320e7665ec4e6p-32, 0x1.1eed8eff8d898p-34,
+	0x1.16c3ae3ec3004p-8, 0x1.78e812606fe0bp-7, 0x1.be093b315cf07p-7, 0x1.24a9a0912fa1dp-7, 0x1.a7fa44db4bcf5p-9, 0x1.9101805ac5941p-12, -0x1.8f30b354069a5p-13, -0x1.7860fb8a9e913p-14, -0x1.f66afb690224ep-18, 0x1.3a218a1392af6p-18, 0x1.6ca0d6f281bd9p-20, -0x1.64dddd0dd8096p-25, -0x1.4ce19ae67b348p-24, -0x1.255d8e1a9ea95p-27, 0x1.522a43f65486ap-29, 0x1.a4d3e2cc24ebcp-31, -0x1.3b9eea191bb0dp-33,
+	0x1.55122b8c29907p-5, 0x1.41ed18cfa7f27p-4, 0x1.e299527d0ba45p-5, 0x1.34fa161c024dcp-6, -0x1.21fa93f7a0d1fp-11, -0x1.227c715a9dd15p-9, -0x1.d2aead418d6dbp-12, 0x1.b3a8ba80190fcp-14, 0x1.a3a6d336c004dp-15, -0x1.07046dbf97136p-24, -0x1.987fada729d6ep-19, -0x1.5be67095db9d2p-22, 0x1.07046dbf97136p-23, 0x1.bd1b2fe1c496fp-26, -0x1.c2e3054870b38p-29, -0x1.a4d3e2cc24ebcp-30, 0x1.07046dbf97136p-32,
+	0x1.8f3a619ae51a1p-3, 0x1.e7ad22347bf2cp-3, 0x1.6362e181cd583p-4, -0x1.125406e933ca4p-7, -0x1.8462016274f7ep-7, -0x1.7337213dbd634p-11, 0x1.0e385978b2789p-10, 0x1.4079248ec35e8p-13, -0x1.0ac2323b853e7p-14, -0x1.e136ba4b68081p-17, 0x1.87e7f2eded423p-19, 0x1.f1fa18148624ep-21, -0x1.af83440e53dbcp-24, -0x1.921cecb624828p-25, 0x1.522a43f65486ap-29, 0x1.3b9eea191bb0dp-29, -0x1.522a43f65486ap-32,
+	0x1p-1, 0x1.5e743b27952d7p-2, 0x0p+0, -0x1.51766525d900ap-5, 0x0p+0, 0x1.1d3b5b1af4d05p-8, 0x0p+0, -0x1.7547d22fa8cd9p-12, 0x0p+0, 0x1.853dfb8f894afp-16, 0x0p+0, -0x1.4d8dc30914897p-20, 0x0p+0, 0x1.e59205b0795edp-25, 0x0p+0, -0x1.68b59dd38d5c6p-29, 0x1.522a43f65486ap-32,
+	0x1.9c31679946b98p-1, 0x1.e7ad22347bf2cp-3, -0x1.6362e181cd583p-4, -0x1.125406e933ca4p-7, 0x1.8462016274f7ep-7, -0x1.7337213dbd634p-11, -0x1.0e385978b2789p-10, 0x1.4079248ec35e8p-13, 0x1.0ac2323b853e7p-14, -0x1.e136ba4b68081p-17, -0x1.87e7f2eded423p-19, 0x1.f1fa18148624ep-21, 0x1.af83440e53dbcp-24, -0x1.921cecb624828p-25, -0x1.522a43f65486ap-29, 0x1.3b9eea191bb0dp-29, -0x1.07046dbf97136p-32,
+	0x1.eaaedd473d67p-1, 0x1.41ed18cfa7f27p-4, -0x1.e299527d0ba45p-5, 0x1.34fa161c024dcp-6, 0x1.21fa93f7a0d1fp-11, -0x1.227c715a9dd15p-9, 0x1.d2aead418d6dbp-12, 0x1.b3a8ba80190fcp-14, -0x1.a3a6d336c004dp-15, -0x1.07046dbf97136p-24, 0x1.987fada729d6ep-19, -0x1.5be67095db9d2p-22, -0x1.07046dbf97136p-23, 0x1.bd1b2fe1c496fp-26, 0x1.c2e3054870b38p-29, -0x1.a4d3e2cc24ebcp-30, 0x1.3b9eea191bb0dp-33,
+	0x1.fdd278a3827ap-1, 0x1.78e812606fe0bp-7, -0x1.be093b315cf07p-7, 0x1.24a9a0912fa1dp-7, -0x1.a7fa44db4bcf5p-9, 0x1.9101805ac5941p-12, 0x1.8f30b354069a5p-13, -0x1.7860fb8a9e913p-14, 0x1.f66afb690224ep-18, 0x1.3a218a1392af6p-18, -0x1.6ca0d6f281bd9p-20, -0x1.64dddd0dd8096p-25, 0x1.4ce19ae67b348p-24, -0x1.255d8e1a9ea95p-27, -0x1.522a43f65486ap-29, 0x1.a4d3e2cc24ebcp-31, -0x1.1eed8eff8d898p-34,
+	0x1.ffe95bffa3865p-1, 0x1.5406c62d57fap-11, -0x1.237ccdfa236ebp-10, 0x1.2ac4fb7f02d03p-10, -0x1.8fbde7782e886p-11, 0x1.5f61b5b3a56ccp-12, -0x1.6afc030fb598ap-14, 0x1.291192d064eb9p-18, 0x1.7f13e0fd0bc08p-18, -0x1.1774b49b90849p-19, 0x1.70396672a04e5p-23, 0x1.7501a04c37ff8p-24, -0x1.de3698ff413a8p-26, 0x1.d6db2c4e09162p-31, 0x1.47eaec91c654p-30, -0x1.320e7665ec4e6p-32, 0x1.7e9213ff6762p-36,
+	0x1.ffffbca571fe9p-1, 0x1.62bcd33e641fp-17, -0x1.b3058452da2c5p-16, 0x1.488efd5ba2edfp-15, -0x1.540e6e02bed7cp-15, 0x1.fa1d0301cd4c6p-16, -0x1.12bc784368669p-16, 0x1.aa0ba35898534p-18, -0x1.aad599084b706p-20, 0x1.301d1ee586ae6p-23, 0x1.1facd8098d3d3p-24, -0x1.0b33a05dfbce7p-25, 0x1.48c5892f7cd83p-28, 0x1.1792224e55652p-31, -0x1.99e5a7b637e9p-32, 0x1.320e7665ec4e6p-34, -0x1.6124613a86d09p-38,
+	0x1.ffffffe519baap-1, 0x1.ae496e8b6d1a8p-26, -0x1.933264b964c7ep-24, 0x1.d5efbeb7e2119p-23, -0x1.7d1381eb67fa9p-22, 0x1.c77f8635b0b0ap-22, -0x1.9e409340f4581p-22, 0x1.23329e141e1e9p-22, -0x1.3d079fb6ef3e3p-23, 0x1.07046dbf97136p-24, -0x1.3b9eea191bb0dp-26, 0x1.cb15b198e2759p-29, 0x0p+0, -0x1.d6db2c4e09162p-33, 0x1.2eb177e905d76p-34, -0x1.78af56a4d411bp-37, 0x1.93974a8c07c9dp-41,
+	0x1.ffffffffffe52p-1, 0x1.ae7f3e733b81fp-41, -0x1.93974a8c07c9dp-38, 0x1.d6db2c4e09162p-36, -0x1.7e9213ff6762p-34, 0x1.cb15b198e2759p-33, -0x1.a4d3e2cc24ebcp-32, 0x1.2c9758daf5cdp-31, -0x1.522a43f65486ap-31, 0x1.2c9758daf5cdp-31, -0x1.a4d3e2cc24ebcp-32, 0x1.cb15b198e2759p-33, -0x1.7e9213ff6762p-34, 0x1.d6db2c4e09162p-36, -0x1.93974a8c07c9dp-38, 0x1.ae7f3e733b81fp-41, -0x1.ae7f3e733b81fp-45,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 17 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.952c77030ad4ap-49,
+	0x1.952c77030ad4ap-49, 0x1.ae7f3e733b81fp-45, 0x1.ae7f3e733b81fp-42, 0x1.0d0f870805313p-39, 0x1.d6db2c4e09162p-38, 0x1.320e7665ec4e6p-36, 0x1.320e7665ec4e6p-35, 0x1.e0f227c4bc7b3p-35, 0x1.2c9758daf5cdp-34, 0x1.2c9758daf5cdp-34, 0x1.e0f227c4bc7b3p-35, 0x1.320e7665ec4e6p-35, 0x1.320e7665ec4e6p-36, 0x1.d6db2c4e09162p-38, 0x1.0d0f870805313p-39, 0x1.ae7f3e733b81fp-42, 0x1.ae7f3e733b81fp-45, -0x1.952c77030ad4ap-45,
+	0x1.951f0309173adp-32, 0x1.ae62a80015dbp-29, 0x1.ae46118cf0341p-27, 0x1.0cc80ee8270fdp-25, 0x1.d5e107de7fa15p-25, 0x1.30c9470820035p-24, 0x1.2f8417aa53b84p-24, 0x1.d8f6229bb85a2p-25, 0x1.229c5267b0a3bp-25, 0x1.18a14bf46b7a6p-26, 0x1.a111fe7c9b72dp-28, 0x1.c1853de5b3132p-30, 0x1.1eed8eff8d898p-32, -0x1.d6db2c4e09162p-38, -0x1.2eb177e905d76p-36, -0x1.5dc762bda0599p-38, -0x1.93974a8c07c9dp-41, 0x1.7bd9af92da276p-42,
+	0x1.7f1e9a002a8bbp-22, 0x1.0cfe9ef03f163p-19, 0x1.61e5ae871e688p-18, 0x1.20f6e1496b2fbp-17, 0x1.46b90d9ceb0bep-17, 0x1.0da9d265866cap-17, 0x1.4caa0345f9b11p-18, 0x1.32963dabe0aa8p-19, 0x1.97d8797756715p-21, 0x1.582ecb9db6b25p-23, 0x1.142b0cd5f83acp-27, -0x1.0a9a9922c8d84p-27, -0x1.8a86a49f629d1p-29, -0x1.94a45a130fcfp-32, 0x1.c60a33dd88c31p-35, 0x1.02f88b9151cc3p-35, 0x1.6124613a86d09p-38, -0x1.bb28a22b53d89p-40,
+	0x1.61d1554b33a31p-15, 0x1.660a5ce7830fap-13, 0x1.4e7bd2e05e699p-12, 0x1.7b964a8bcab2bp-12, 0x1.2080839425b8cp-12, 0x1.2eca66e002158p-13, 0x1.aa553204b61ffp-15, 0x1.5057e12343fedp-17, -0x1.01f4211066cf5p-22, -0x1.b35d94a9e2525p-21, -0x1.dd8a70dca7e59p-23, -0x1.46616c42b0ff9p-27, 0x1.51bcf5a779448p-27, 0x1.58dd86f327a7bp-29, 0x1.b5393b6d087p-36, -0x1.cb15b198e2759p-34, -0x1.7e9213ff6762p-36, 0x1.681103c3342p-38,
+	0x1.67ebdc9027c14p-10, 0x1.0b71ae10862bep-8, 0x1.63a7a5fd9a611p-8, 0x1.1111164c10571p-8, 0x1.fea202429e8fap-10, 0x1.033bd597668a9p-11, 0x1.08a98e2600d1cp-17, -0x1.4bd18beb5c3aap-15, -0x1.8af214b7a4dfep-17, -0x1.a852250e16ba4p-23, 0x1.6b16504de25afp-21, 0x1.2aa8bce955a84p-23, -0x1.6fa05f376d582p-27, -0x1.166bd952a49f7p-27, -0x1.70e84a23ff1e8p-31, 0x1.0bcca7992ec49p-32, 0x1.1eed8eff8d898p-34, -0x1.b0146aea3e8ccp-37,
+	0x1.1dd9a81a4469cp-6, 0x1.3239b5c451307p-5, 0x1.12d0168399f65p-5, 0x1.eec95a40f08afp-7, 0x1.454a8ba6d4f9ap-9, -0x1.8d2d87e0f6697p-11, -0x1.c6262c87f35a7p-12, -0x1.313e16640b92ep-15, 0x1.9604db055bd07p-16, 0x1.acd91091aaebfp-18, -0x1.fd2f5faa81ac4p-22, -0x1.adae9de907c9fp-22, -0x1.94639bf02b7a9p-26, 0x1.0848246e0cb9ap-26, 0x1.522a43f65486ap-29, -0x1.a4d3e2cc24ebcp-32, -0x1.3b9eea191bb0dp-33, 0x1.8c12b756b9566p-36,
+	0x1.ad174e21415e1p-4, 0x1.39f5d6b7dab5fp-3, 0x1.46b695cca7f98p-4, 0x1.303b40b369656p-7, -0x1.be2419909c32ep-8, -0x1.2835134f2f224p-9, 0x1.07938c0ee8a0bp-12, 0x1.ba292a0a6216dp-13, 0x1.9a931d3adb5aap-18, -0x1.a7a16e145a00cp-17, -0x1.7f53c12653e18p-20, 0x1.230e68f0657d8p-21, 0x1.bff38aea4d4dp-24, -0x1.26a144c9144f8p-26, -0x1.64f3b98403e37p-28, 0x1.a4d3e2cc24ebcp-32, 0x1.07046dbf97136p-32, -0x1.1ae8cc195fdp-35,
+	0x1.5a9e833f96ff6p-2, 0x1.3862cf328d72fp-2, 0x1.aa76a8355cd03p-5, -0x1.d9d92cad11caep-6, -0x1.0ce1636b8c0e1p-7, 0x1.36b4cde85d932p-9, 0x1.ba2da9ae3b50fp-11, -0x1.34d2af655e40ap-13, -0x1.0ac2323b853e7p-14, 0x1.da3ccb147b19ap-18, 0x1.f7e113c4310bfp-19, -0x1.1d05c7f2db18ep-22, -0x1.845c8a0ce5129p-23, 0x1.098bdb1c825fep-27, 0x1.fb3f65f17ec9ep-28, -0x1.68b59dd38d5c6p-33, -0x1.522a43f65486ap-32, 0x1.3e45e59c8bcap-35,
+	0x1.52b0be6034805p-1, 0x1.3862cf328d72fp-2, -0x1.aa76a8355cd03p-5, -0x1.d9d92cad11caep-6, 0x1.0ce1636b8c0e1p-7, 0x1.36b4cde85d932p-9, -0x1.ba2da9ae3b50fp-11, -0x1.34d2af655e40ap-13, 0x1.0ac2323b853e7p-14, 0x1.da3ccb147b19ap-18, -0x1.f7e113c4310bfp-19, -0x1.1d05c7f2db18ep-22, 0x1.845c8a0ce5129p-23, 0x1.098bdb1c825fep-27, -0x1.fb3f65f17ec9ep-28, -0x1.68b59dd38d5c6p-33, 0x1.522a43f65486ap-32, -0x1.1ae8cc195fdp-35,
+	0x1.ca5d163bd7d44p-1, 0x1.39f5d6b7dab5fp-3, -0x1.46b695cca7f98p-4, 0x1.303b40b369656p-7, 0x1.be2419909c32ep-8, -0x1.2835134f2f224p-9, -0x1.07938c0ee8a0bp-12, 0x1.ba292a0a6216dp-13, -0x1.9a931d3adb5aap-18, -0x1.a7a16e145a00cp-17, 0x1.7f53c12653e18p-20, 0x1.230e68f0657d8p-21, -0x1.bff38aea4d4dp-24, -0x1.26a144c9144f8p-26, 0x1.64f3b98403e37p-28, 0x1.a4d3e2cc24ebcp-32, -0x1.07046dbf97136p-32, 0x1.8c12b756b9566p-36,
+	0x1.f71132bf2ddcbp-1, 0x1.3239b5c451307p-5, -0x1.12d0168399f65p-5, 0x1.eec95a40f08afp-7, -0x1.454a8ba6d4f9ap-9, -0x1.8d2d87e0f6697p-11, 0x1.c6262c87f35a7p-12, -0x1.313e16640b92ep-15, -0x1.9604db055bd07p-16, 0x1.acd91091aaebfp-18, 0x1.fd2f5faa81ac4p-22, -0x1.adae9de907c9fp-22, 0x1.94639bf02b7a9p-26, 0x1.0848246e0cb9ap-26, -0x1.522a43f65486ap-29, -0x1.a4d3e2cc24ebcp-32, 0x1.3b9eea191bb0dp-33, -0x1.b0146aea3e8ccp-37,
+	0x1.ff4c0a11b7ec2p-1, 0x1.0b71ae10862bep-8, -0x1.63a7a5fd9a611p-8, 0x1.1111164c10571p-8, -0x1.fea202429e8fap-10, 0x1.033bd597668a9p-11, -0x1.08a98e2600d1cp-17, -0x1.4bd18beb5c3aap-15, 0x1.8af214b7a4dfep-17, -0x1.a852250e16ba4p-23, -0x1.6b16504de25afp-21, 0x1.2aa8bce955a84p-23, 0x1.6fa05f376d582p-27, -0x1.166bd952a49f7p-27, 0x1.70e84a23ff1e8p-31, 0x1.0bcca7992ec49p-32, -0x1.1eed8eff8d898p-34, 0x1.681103c3342p-38,
+	0x1.fffa78baaad33p-1, 0x1.660a5ce7830fap-13, -0x1.4e7bd2e05e699p-12, 0x1.7b964a8bcab2bp-12, -0x1.2080839425b8cp-12, 0x1.2eca66e002158p-13, -0x1.aa553204b61ffp-15, 0x1.5057e12343fedp-17, 0x1.01f4211066cf5p-22, -0x1.b35d94a9e2525p-21, 0x1.dd8a70dca7e59p-23, -0x1.46616c42b0ff9p-27, -0x1.51bcf5a779448p-27, 0x1.58dd86f327a7bp-29, -0x1.b5393b6d087p-36, -0x1.cb15b198e2759p-34, 0x1.7e9213ff6762p-36, -0x1.bb28a22b53d89p-40,
+	0x1.fffff4070b3p-1, 0x1.0cfe9ef03f163p-19, -0x1.61e5ae871e688p-18, 0x1.20f6e1496b2fbp-17, -0x1.46b90d9ceb0bep-17, 0x1.0da9d265866cap-17, -0x1.4caa0345f9b11p-18, 0x1.32963dabe0aa8p-19, -0x1.97d8797756715p-21, 0x1.582ecb9db6b25p-23, -0x1.142b0cd5f83acp-27, -0x1.0a9a9922c8d84p-27, 0x1.8a86a49f629d1p-29, -0x1.94a45a130fcfp-32, -0x1.c60a33dd88c31p-35, 0x1.02f88b9151cc3p-35, -0x1.6124613a86d09p-38, 0x1.7bd9af92da276p-42,
+	0x1.fffffffcd5c2p-1, 0x1.ae62a80015dbp-29, -0x1.ae46118cf0341p-27, 0x1.0cc80ee8270fdp-25, -0x1.d5e107de7fa15p-25, 0x1.30c9470820035p-24, -0x1.2f8417aa53b84p-24, 0x1.d8f6229bb85a2p-25, -0x1.229c5267b0a3bp-25, 0x1.18a14bf46b7a6p-26, -0x1.a111fe7c9b72dp-28, 0x1.c1853de5b3132p-30, -0x1.1eed8eff8d898p-32, -0x1.d6db2c4e09162p-38, 0x1.2eb177e905d76p-36, -0x1.5dc762bda0599p-38, 0x1.93974a8c07c9dp-41, -0x1.952c77030ad4ap-45,
+	0x1.fffffffffffe7p-1, 0x1.ae7f3e733b81fp-45, -0x1.ae7f3e733b81fp-42, 0x1.0d0f870805313p-39, -0x1.d6db2c4e09162p-38, 0x1.320e7665ec4e6p-36, -0x1.320e7665ec4e6p-35, 0x1.e0f227c4bc7b3p-35, -0x1.2c9758daf5cdp-34, 0x1.2c9758daf5cdp-34, -0x1.e0f227c4bc7b3p-35, 0x1.320e7665ec4e6p-35, -0x1.320e7665ec4e6p-36, 0x1.d6db2c4e09162p-38, -0x1.0d0f870805313p-39, 0x1.ae7f3e733b81fp-42, -0x1.ae7f3e733b81fp-45, 0x1.952c77030ad4ap-49,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 18 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.6827863b97d97p-53,
+	0x1.6827863b97d97p-53, 0x1.952c77030ad4ap-49, 0x1.ae7f3e733b81fp-46, 0x1.1eff7ef77d015p-43, 0x1.0d0f870805313p-41, 0x1.78af56a4d411bp-40, 0x1.98134887e5bddp-39, 0x1.5dc762bda0599p-38, 0x1.e0f227c4bc7b3p-38, 0x1.0b313289be0b9p-37, 0x1.e0f227c4bc7b3p-38, 0x1.5dc762bda0599p-38, 0x1.98134887e5bddp-39, 0x1.78af56a4d411bp-40, 0x1.0d0f870805313p-41, 0x1.1eff7ef77d015p-43, 0x1.ae7f3e733b81fp-46, 0x1.952c77030ad4ap-49, -0x1.7ea9fe9f51571p-49,
+	0x1.68213189bbcd5p-35, 0x1.951e3872dbb94p-32, 0x1.ae60f980d767cp-30, 0x1.1ed72309a233bp-28, 0x1.0cc3daaa0aefcp-27, 0x1.77db7404175a7p-27, 0x1.964832d64cdb6p-27, 0x1.5ab4621f75b0dp-27, 0x1.d87de611c72bp-28, 0x1.01cc77c2e65d2p-28, 0x1.bf2120f8e73a8p-30, 0x1.2c9758daf5cdp-31, 0x1.254ddc21ad207p-33, 0x1.49996bd0398f8p-36, -0x1.0d0f870805313p-40, -0x1.66bf5eb55c41ap-40, -0x1.78af56a4d411bp-42, -0x1.952c77030ad4ap-45, 0x1.7ea9fe9f51571p-46,
+	0x1.00bb55d7f945dp-24, 0x1.7eb9523f6845fp-22, 0x1.0c9306463f10cp-20, 0x1.d6be0f531feb3p-20, 0x1.1fea193a8308ap-19, 0x1.03e8f0773d3dp-19, 0x1.6460551f483b8p-20, 0x1.76c4835180704p-21, 0x1.2b32652171c91p-22, 0x1.5a626764513f3p-24, 0x1.ee9103650ed1bp-27, 0x1.89804f155464cp-33, -0x1.ae64567f544e4p-31, -0x1.08db48ebe51c7p-32, -0x1.c60a33dd88c31p-36, 0x1.42df6ed66ca17p-38, 0x1.2eb177e905d76p-39, 0x1.7bd9af92da276p-42, -0x1.de547e4725acdp-44,
+	0x1.43d10a39f60b7p-17, 0x1.5ed31817334dfp-15, 0x1.61d6626bc2134p-14, 0x1.b69afaddad3fep-14, 0x1.728e93817f593p-14, 0x1.bd445ea5309a3p-15, 0x1.7d3fb7a23793ap-16, 0x1.b7b6cafb63546p-18, 0x1.03b251b84bd43p-20, -0x1.dd2cec715e164p-24, -0x1.a121060dd998bp-24, -0x1.67db0135d6d83p-26, -0x1.3ecf10aa2b7c5p-33, 0x1.0c88ff44812eap-30, 0x1.c3f014cf78b8bp-33, -0x1.f63f1e311ac24p-40, -0x1.2648fbb0c5addp-37, -0x1.bb28a22b53d89p-40, 0x1.a289ee7e40f74p-42,
+	0x1.afdabe8c4b802p-12, 0x1.5cdd51e5ce243p-10, 0x1.00415b294a136p-9, 0x1.be55366a1b4ep-10, 0x1.f2af6346a757dp-11, 0x1.5ece4de4774dfp-12, 0x1.e96df4fe65632p-15, -0x1.9b9ea2d5f47aep-18, -0x1.9fe784342d3a5p-18, -0x1.57e5bc29e5086p-20, 0x1.076da2b84a1c9p-24, 0x1.5ee394bdda6bep-24, 0x1.a9691a3caba04p-27, -0x1.b2120cd7f0606p-30, -0x1.a0ba8ca3ec0acp-31, -0x1.98134887e5bddp-35, 0x1.7e9213ff6762p-36, 0x1.681103c3342p-38, -0x1.100cdb0543d3ep-40,
+	0x1.b91eda3b0c829p-8, 0x1.075aea5141edbp-6, 0x1.10cb8002406afp-6, 0x1.33242d05338d9p-7, 0x1.6640cf1ae85f6p-9, 0x1.bfd6a9bcf13eep-14, -0x1.b59b93a5934d5p-13, -0x1.083d69b2efa52p-14, 0x1.a93758750a7c1p-22, 0x1.0c37f42b31003p-18, 0x1.61afb494e2e7dp-21, -0x1.c138ba4819981p-24, -0x1.8201fd93cc696p-25, -0x1.0f7a5df1cad6cp-30, 0x1.cd225cacfee62p-30, 0x1.cb15b198e2759p-33, -0x1.58504532a9d83p-35, -0x1.b0146aea3e8ccp-37, 0x1.100cdb0543d3ep-39,
+	0x1.a514a1e900a26p-5, 0x1.65a0e41ab043ap-4, 0x1.daced28d8cd3bp-5, 0x1.f8d1717247fb9p-7, -0x1.7d1c331b0e4b2p-10, -0x1.e7077f83388c9p-10, -0x1.068cec73ecb53p-12, 0x1.9a20fbc3eb6afp-14, 0x1.033c57d1b27dcp-15, -0x1.0daabc3092a52p-19, -0x1.fe7191e425f89p-20, -0x1.7468991105096p-24, 0x1.5143cfedf0ec5p-24, 0x1.51e0461798b86p-27, -0x1.3f60ce68a529dp-29, -0x1.188d41dd6df28p-31, 0x1.a4d3e2cc24ebcp-35, 0x1.8c12b756b9566p-36, -0x1.ab81ea75fcdf4p-39,
+	0x1.ab4c4341c30b6p-3, 0x1.deb15f6e8d4fbp-3, 0x1.36cfc7ad403p-4, -0x1.2e9e0485442e7p-7, -0x1.38fb6683633edp-7, -0x1.252ef747f2eaap-12, 0x1.949beb7a5dce4p-11, 0x1.62bb4d50e36e6p-14, -0x1.777decb7e02bcp-15, -0x1.03edae46662e5p-17, 0x1.084cbb0c3c9fp-19, 0x1.f9d96be270b7dp-22, -0x1.210b889be206ap-24, -0x1.78d2a714f3859p-26, 0x1.e875f063cf6d2p-30, 0x1.cce810c734a0bp-31, -0x1.2c9758daf5cdp-35, -0x1.1ae8cc195fdp-35, 0x1.0b313289be0b9p-38,
+	0x1p-1, 0x1.4ac2f980d2014p-2, 0x0p+0, -0x1.1c4f1ace3de02p-5, 0x0p+0, 0x1.ae356bdf467cfp-9, 0x0p+0, -0x1.f958c1ebb1811p-13, 0x0p+0, 0x1.da3ccb147b19ap-17, 0x0p+0, -0x1.6e7525a5f52p-21, 0x0p+0, 0x1.ddfbbd99b7795p-26, 0x0p+0, -0x1.0e88365eaa055p-30, 0x0p+0, 0x1.3e45e59c8bcap-35, -0x1.0b313289be0b9p-38,
+	0x1.952cef2f8f3d3p-1, 0x1.deb15f6e8d4fbp-3, -0x1.36cfc7ad403p-4, -0x1.2e9e0485442e7p-7, 0x1.38fb6683633edp-7, -0x1.252ef747f2eaap-12, -0x1.949beb7a5dce4p-11, 0x1.62bb4d50e36e6p-14, 0x1.777decb7e02bcp-15, -0x1.03edae46662e5p-17, -0x1.084cbb0c3c9fp-19, 0x1.f9d96be270b7dp-22, 0x1.210b889be206ap-24, -0x1.78d2a714f3859p-26, -0x1.e875f063cf6d2p-30, 0x1.cce810c734a0bp-31, 0x1.2c9758daf5cdp-35, -0x1.1ae8cc195fdp-35, 0x1.ab81ea75fcdf4p-39,
+	0x1.e5aeb5e16ff5ep-1, 0x1.65a0e41ab043ap-4, -0x1.daced28d8cd3bp-5, 0x1.f8d1717247fb9p-7, 0x1.7d1c331b0e4b2p-10, -0x1.e7077f83388c9p-10, 0x1.068cec73ecb53p-12, 0x1.9a20fbc3eb6afp-14, -0x1.033c57d1b27dcp-15, -0x1.0daabc3092a52p-19, 0x1.fe7191e425f89p-20, -0x1.7468991105096p-24, -0x1.5143cfedf0ec5p-24, 0x1.51e0461798b86p-27, 0x1.3f60ce68a529dp-29, -0x1.188d41dd6df28p-31, -0x1.a4d3e2cc24ebcp-35, 0x1.8c12b756b9566p-36, -0x1.100cdb0543d3ep-39,
+	0x1.fc8dc24b89e7p-1, 0x1.075aea5141edbp-6, -0x1.10cb8002406afp-6, 0x1.33242d05338d9p-7, -0x1.6640cf1ae85f6p-9, 0x1.bfd6a9bcf13eep-14, 0x1.b59b93a5934d5p-13, -0x1.083d69b2efa52p-14, -0x1.a93758750a7c1p-22, 0x1.0c37f42b31003p-18, -0x1.61afb494e2e7dp-21, -0x1.c138ba4819981p-24, 0x1.8201fd93cc696p-25, -0x1.0f7a5df1cad6cp-30, -0x1.cd225cacfee62p-30, 0x1.cb15b198e2759p-33, 0x1.58504532a9d83p-35, -0x1.b0146aea3e8ccp-37, 0x1.100cdb0543d3ep-40,
+	0x1.ffca04a82e769p-1, 0x1.5cdd51e5ce243p-10, -0x1.00415b294a136p-9, 0x1.be55366a1b4ep-10, -0x1.f2af6346a757dp-11, 0x1.5ece4de4774dfp-12, -0x1.e96df4fe65632p-15, -0x1.9b9ea2d5f47aep-18, 0x1.9fe784342d3a5p-18, -0x1.57e5bc29e5086p-20, -0x1.076da2b84a1c9p-24, 0x1.5ee394bdda6bep-24, -0x1.a9691a3caba04p-27, -0x1.b2120cd7f0606p-30, 0x1.a0ba8ca3ec0acp-31, -0x1.98134887e5bddp-35, -0x1.7e9213ff6762p-36, 0x1.681103c3342p-38, -0x1.a289ee7e40f74p-42,
+	0x1.fffebc2ef5c61p-1, 0x1.5ed31817334dfp-15, -0x1.61d6626bc2134p-14, 0x1.b69afaddad3fep-14, -0x1.728e93817f593p-14, 0x1.bd445ea5309a3p-15, -0x1.7d3fb7a23793ap-16, 0x1.b7b6cafb63546p-18, -0x1.03b251b84bd43p-20, -0x1.dd2cec715e164p-24, 0x1.a121060dd998bp-24, -0x1.67db0135d6d83p-26, 0x1.3ecf10aa2b7c5p-33, 0x1.0c88ff44812eap-30, -0x1.c3f014cf78b8bp-33, -0x1.f63f1e311ac24p-40, 0x1.2648fbb0c5addp-37, -0x1.bb28a22b53d89p-40, 0x1.de547e4725acdp-44,
+	0x1.fffffdfe89545p-1, 0x1.7eb9523f6845fp-22, -0x1.0c9306463f10cp-20, 0x1.d6be0f531feb3p-20, -0x1.1fea193a8308ap-19, 0x1.03e8f0773d3dp-19, -0x1.6460551f483b8p-20, 0x1.76c4835180704p-21, -0x1.2b32652171c91p-22, 0x1.5a626764513f3p-24, -0x1.ee9103650ed1bp-27, 0x1.89804f155464cp-33, 0x1.ae64567f544e4p-31, -0x1.08db48ebe51c7p-32, 0x1.c60a33dd88c31p-36, 0x1.42df6ed66ca17p-38, -0x1.2eb177e905d76p-39, 0x1.7bd9af92da276p-42, -0x1.7ea9fe9f51571p-46,
+	0x1.ffffffffa5f7bp-1, 0x1.951e3872dbb94p-32, -0x1.ae60f980d767cp-30, 0x1.1ed72309a233bp-28, -0x1.0cc3daaa0aefcp-27, 0x1.77db7404175a7p-27, -0x1.964832d64cdb6p-27, 0x1.5ab4621f75b0dp-27, -0x1.d87de611c72bp-28, 0x1.01cc77c2e65d2p-28, -0x1.bf2120f8e73a8p-30, 0x1.2c9758daf5cdp-31, -0x1.254ddc21ad207p-33, 0x1.49996bd0398f8p-36, 0x1.0d0f870805313p-40, -0x1.66bf5eb55c41ap-40, 0x1.78af56a4d411bp-42, -0x1.952c77030ad4ap-45, 0x1.7ea9fe9f51571p-49,
+	0x1.fffffffffffffp-1, 0x1.952c77030ad4ap-49, -0x1.ae7f3e733b81fp-46, 0x1.1eff7ef77d015p-43, -0x1.0d0f870805313p-41, 0x1.78af56a4d411bp-40, -0x1.98134887e5bddp-39, 0x1.5dc762bda0599p-38, -0x1.e0f227c4bc7b3p-38, 0x1.0b313289be0b9p-37, -0x1.e0f227c4bc7b3p-38, 0x1.5dc762bda0599p-38, -0x1.98134887e5bddp-39, 0x1.78af56a4d411bp-40, -0x1.0d0f870805313p-41, 0x1.1eff7ef77d015p-43, -0x1.ae7f3e733b81fp-46, 0x1.952c77030ad4ap-49, -0x1.6827863b97d97p-53,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 19 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.2f49b46814157p-57,
+	0x1.2f49b46814157p-57, 0x1.6827863b97d97p-53, 0x1.952c77030ad4ap-50, 0x1.1eff7ef77d015p-47, 0x1.1eff7ef77d015p-45, 0x1.ae7f3e733b81fp-44, 0x1.f63f1e311ac24p-43, 0x1.d25f2e522b222p-42, 0x1.5dc762bda0599p-41, 0x1.ab81ea75fcdf4p-41, 0x1.ab81ea75fcdf4p-41, 0x1.5dc762bda0599p-41, 0x1.d25f2e522b222p-42, 0x1.f63f1e311ac24p-43, 0x1.ae7f3e733b81fp-44, 0x1.1eff7ef77d015p-45, 0x1.1eff7ef77d015p-47, 0x1.952c77030ad4ap-50, 0x1.6827863b97d97p-53, -0x1.5532eaf516982p-53,
+	0x1.2f46e419079e4p-38, 0x1.6820d77fda3e6p-35, 0x1.951d6ddca037cp-33, 0x1.1eea320110a3p-31, 0x1.1ed4e50aa444cp-30, 0x1.adff70acb14c4p-30, 0x1.f514e8b72d9a6p-30, 0x1.d0355d4b298eep-30, 0x1.5a88a9331dfccp-30, 0x1.a393415c4c6e2p-31, 0x1.9ba498429bfdp-32, 0x1.43d196698d72fp-33, 0x1.8d250d71f8bb1p-35, 0x1.6124613a86d09p-37, 0x1.5dc762bda0599p-40, -0x1.ae7f3e733b81fp-44, -0x1.8a9f4e944be1cp-44, -0x1.7bd9af92da276p-46, -0x1.7ea9fe9f51571p-49, 0x1.6a8619a46801ap-50,
+	0x1.457a378b5e03dp-27, 0x1.008e51b1c80e6p-24, 0x1.7e540ab14b8fp-23, 0x1.6589e80a7e793p-22, 0x1.d59f38301648fp-22, 0x1.cafbbbcc8e62bp-22, 0x1.5896c6aef6dcep-22, 0x1.93a8e0d41f945p-23, 0x1.7159b1c902997p-24, 0x1.0363ef965ed22p-25, 0x1.0837b3201be12p-27, 0x1.3f095c8ff5c1bp-30, -0x1.0d9f06c780efbp-35, -0x1.35faf4a24e83ep-34, -0x1.463c6d5353188p-36, -0x1.d25f2e522b222p-40, 0x1.9c8f4683c3b1ep-42, 0x1.493420b278cccp-43, 0x1.7ea9fe9f51571p-46, -0x1.e35d7785e0023p-48,
+	0x1.17057f5c7415p-19, 0x1.41cf938e4618ep-17, 0x1.5bd5a572b47d6p-16, 0x1.d2301dc38c1eap-16, 0x1.af4002a060c03p-16, 0x1.213f6892ef672p-16, 0x1.1e03dfbe7dd99p-17, 0x1.9a41f05bba5b5p-19, 0x1.88de3a9133466p-21, 0x1.48b4d61c543c5p-24, -0x1.496c87ef12efp-26, -0x1.5c53bee4b6df3p-27, -0x1.e3e8027002014p-30, 0x1.af9e3df232fefp-35, 0x1.7e9213ff6762p-34, 0x1.0f4d8605f42b4p-36, -0x1.c06f3662b352p-42, -0x1.5c3236469d4ecp-41, -0x1.de547e4725acdp-44, 0x1.c527a00d82021p-46,
+	0x1.e468ab33f6fa7p-14, 0x1.a5bc363a7bcfcp-12, 0x1.51e6b9251489cp-11, 0x1.46ee35729003cp-11, 0x1.a2eb86bc407ap-12, 0x1.69e473dec5f08p-13, 0x1.8987ad6a6c4e4p-15, 0x1.557dd3a178af4p-18, -0x1.a9aab6e8abe7ap-20, -0x1.ab673257557f7p-21, -0x1.f684af047ea4cp-24, 0x1.eef36378d426cp-27, 0x1.25e6e35ce016ap-27, 0x1.08db48ebe51c7p-30, -0x1.917d2b7df7bf7p-33, -0x1.1a8380fb9f0d4p-34, -0x1.88614f965ce7cp-39, 0x1.f28db670be53bp-40, 0x1.a289ee7e40f74p-42, -0x1.3d35566fdb017p-44,
+	0x1.3b89900580e28p-9, 0x1.9e212e5247ca9p-8, 0x1.e31a2a65ca16ep-8, 0x1.410470d174361p-8, 0x1.f6b30c6fe047bp-10, 0x1.75bb23a8640f2p-12, -0x1.3e762f46f953p-15, -0x1.3ffae5153e15cp-15, -0x1.dd06ff0b20baep-18, 0x1.8950ddfbfe1e5p-21, 0x1.1b5ab5c48835p-21, 0x1.d28e8bfcdf7a8p-25, -0x1.0ab41a575156ap-26, -0x1.2efdb3c6bf949p-28, 0x1.73a3d8e97a5f3p-35, 0x1.6510df76e9062p-33, 0x1.188d41dd6df28p-36, -0x1.f817d21148f99p-39, -0x1.100cdb0543d3ep-40, 0x1.57a472f92d419p-43,
+	0x1.7beba73bbf13p-6, 0x1.6df0c6a19f121p-5, 0x1.23ca29865fc83p-5, 0x1.c336c365e6284p-7, 0x1.8b5a88da28dcp-10, -0x1.b70bed538c6a6p-11, -0x1.57589c14afc05p-12, -0x1.8ff8180a6516fp-18, 0x1.512f32bb6d88p-16, 0x1.c6f52cac0ef34p-19, -0x1.42710e9c61dbdp-21, -0x1.f3d84ead85662p-23, 0x1.99ab5bd06da39p-30, 0x1.4651ba49bf76cp-27, 0x1.a8ed38f45dccdp-31, -0x1.254ddc21ad207p-32, -0x1.8b52ae43a68ffp-35, 0x1.681103c3342p-38, 0x1.100cdb0543d3ep-39, -0x1.268cf4d594815p-42,
+	0x1.e1b8b859246e7p-4, 0x1.42071ac782e2cp-3, 0x1.2be0ed61352dep-4, 0x1.8781f777decb8p-8, -0x1.93b7bafbc615p-8, -0x1.a88c99cccf224p-10, 0x1.13d28120d28bfp-12, 0x1.323837d4c2607p-13, -0x1.bb2d73983fe41p-20, -0x1.1a19e5927a127p-17, -0x1.3404cb9068d4dp-21, 0x1.79d5774496fc9p-22, 0x1.8f4d0c19cbfc1p-25, -0x1.816be7b746bcep-27, -0x1.37dd05c99237ep-29, 0x1.2c9758daf5cdp-32, 0x1.72baa9525149ap-34, -0x1.537dc1b80c933p-38, -0x1.ab81ea75fcdf4p-39, 0x1.9501d0a5ac31dp-42,
+	0x1.62f91f2c40cd1p-2, 0x1.2a59de5f1e7a5p-2, 0x1.6da927262d65ap-5, -0x1.9e6a5f91aaeaap-6, -0x1.a14f3359d9a91p-8, 0x1.f4c570d238647p-10, 0x1.373cdc85833c3p-11, -0x1.ce690d1e22104p-14, -0x1.555b344a119c2p-15, 0x1.4dc54431aad19p-18, 0x1.25aa96f126e99p-19, -0x1.806f9bb4b5446p-23, -0x1.9cebe7ba1e529p-24, 0x1.63bf6d0ea0082p-28, 0x1.e875f063cf6d2p-29, -0x1.04832adfe6181p-33, -0x1.f4fc3ec24455ap-34, 0x1.1ae8cc195fdp-39, 0x1.0b313289be0b9p-38, -0x1.c20204464d8cbp-42,
+	0x1.4e837069df997p-1, 0x1.2a59de5f1e7a5p-2, -0x1.6da927262d65ap-5, -0x1.9e6a5f91aaeaap-6, 0x1.a14f3359d9a91p-8, 0x1.f4c570d238647p-10, -0x1.373cdc85833c3p-11, -0x1.ce690d1e22104p-14, 0x1.555b344a119c2p-15, 0x1.4dc54431aad19p-18, -0x1.25aa96f126e99p-19, -0x1.806f9bb4b5446p-23, 0x1.9cebe7ba1e529p-24, 0x1.63bf6d0ea0082p-28, -0x1.e875f063cf6d2p-29, -0x1.04832adfe6181p-33, 0x1.f4fc3ec24455ap-34, 0x1.1ae8cc195fdp-39, -0x1.0b313289be0b9p-38, 0x1.9501d0a5ac31dp-42,
+	0x1.c3c8e8f4db723p-1, 0x1.42071ac782e2cp-3, -0x1.2be0ed61352dep-4, 0x1.8781f777decb8p-8, 0x1.93b7bafbc615p-8, -0x1.a88c99cccf224p-10, -0x1.13d28120d28bfp-12, 0x1.323837d4c2607p-13, 0x1.bb2d73983fe41p-20, -0x1.1a19e5927a127p-17, 0x1.3404cb9068d4dp-21, 0x1.79d5774496fc9p-22, -0x1.8f4d0c19cbfc1p-25, -0x1.816be7b746bcep-27, 0x1.37dd05c99237ep-29, 0x1.2c9758daf5cdp-32, -0x1.72baa9525149ap-34, -0x1.537dc1b80c933p-38, 0x1.ab81ea75fcdf4p-39, -0x1.268cf4d594815p-42,
+	0x1.f420a2c622076p-1, 0x1.6df0c6a19f121p-5, -0x1.23ca29865fc83p-5, 0x1.c336c365e6284p-7, -0x1.8b5a88da28dcp-10, -0x1.b70bed538c6a6p-11, 0x1.57589c14afc05p-12, -0x1.8ff8180a6516fp-18, -0x1.512f32bb6d88p-16, 0x1.c6f52cac0ef34p-19, 0x1.42710e9c61dbdp-21, -0x1.f3d84ead85662p-23, -0x1.99ab5bd06da39p-30, 0x1.4651ba49bf76cp-27, -0x1.a8ed38f45dccdp-31, -0x1.254ddc21ad207p-32, 0x1.8b52ae43a68ffp-35, 0x1.681103c3342p-38, -0x1.100cdb0543d3ep-39, 0x1.57a472f92d419p-43,
+	0x1.fec4766ffa7f2p-1, 0x1.9e212e5247ca9p-8, -0x1.e31a2a65ca16ep-8, 0x1.410470d174361p-8, -0x1.f6b30c6fe047bp-10, 0x1.75bb23a8640f2p-12, 0x1.3e762f46f953p-15, -0x1.3ffae5153e15cp-15, 0x1.dd06ff0b20baep-18, 0x1.8950ddfbfe1e5p-21, -0x1.1b5ab5c48835p-21, 0x1.d28e8bfcdf7a8p-25, 0x1.0ab41a575156ap-26, -0x1.2efdb3c6bf949p-28, -0x1.73a3d8e97a5f3p-35, 0x1.6510df76e9062p-33, -0x1.188d41dd6df28p-36, -0x1.f817d21148f99p-39, 0x1.100cdb0543d3ep-40, -0x1.3d35566fdb017p-44,
+	0x1.fff0dcbaa6605p-1, 0x1.a5bc363a7bcfcp-12, -0x1.51e6b9251489cp-11, 0x1.46ee35729003cp-11, -0x1.a2eb86bc407ap-12, 0x1.69e473dec5f08p-13, -0x1.8987ad6a6c4e4p-15, 0x1.557dd3a178af4p-18, 0x1.a9aab6e8abe7ap-20, -0x1.ab673257557f7p-21, 0x1.f684af047ea4cp-24, 0x1.eef36378d426cp-27, -0x1.25e6e35ce016ap-27, 0x1.08db48ebe51c7p-30, 0x1.917d2b7df7bf7p-33, -0x1.1a8380fb9f0d4p-34, 0x1.88614f965ce7cp-39, 0x1.f28db670be53bp-40, -0x1.a289ee7e40f74p-42, 0x1.c527a00d82021p-46,
+	0x1.ffffba3ea028ep-1, 0x1.41cf938e4618ep-17, -0x1.5bd5a572b47d6p-16, 0x1.d2301dc38c1eap-16, -0x1.af4002a060c03p-16, 0x1.213f6892ef672p-16, -0x1.1e03dfbe7dd99p-17, 0x1.9a41f05bba5b5p-19, -0x1.88de3a9133466p-21, 0x1.48b4d61c543c5p-24, 0x1.496c87ef12efp-26, -0x1.5c53bee4b6df3p-27, 0x1.e3e8027002014p-30, 0x1.af9e3df232fefp-35, -0x1.7e9213ff6762p-34, 0x1.0f4d8605f42b4p-36, 0x1.c06f3662b352p-42, -0x1.5c3236469d4ecp-41, 0x1.de547e4725acdp-44, -0x1.e35d7785e0023p-48,
+	0x1.ffffffaea1722p-1, 0x1.008e51b1c80e6p-24, -0x1.7e540ab14b8fp-23, 0x1.6589e80a7e793p-22, -0x1.d59f38301648fp-22, 0x1.cafbbbcc8e62bp-22, -0x1.5896c6aef6dcep-22, 0x1.93a8e0d41f945p-23, -0x1.7159b1c902997p-24, 0x1.0363ef965ed22p-25, -0x1.0837b3201be12p-27, 0x1.3f095c8ff5c1bp-30, 0x1.0d9f06c780efbp-35, -0x1.35faf4a24e83ep-34, 0x1.463c6d5353188p-36, -0x1.d25f2e522b222p-40, -0x1.9c8f4683c3b1ep-42, 0x1.493420b278cccp-43, -0x1.7ea9fe9f51571p-46, 0x1.6a8619a46801ap-50,
+	0x1.fffffffff685dp-1, 0x1.6820d77fda3e6p-35, -0x1.951d6ddca037cp-33, 0x1.1eea320110a3p-31, -0x1.1ed4e50aa444cp-30, 0x1.adff70acb14c4p-30, -0x1.f514e8b72d9a6p-30, 0x1.d0355d4b298eep-30, -0x1.5a88a9331dfccp-30, 0x1.a393415c4c6e2p-31, -0x1.9ba498429bfdp-32, 0x1.43d196698d72fp-33, -0x1.8d250d71f8bb1p-35, 0x1.6124613a86d09p-37, -0x1.5dc762bda0599p-40, -0x1.ae7f3e733b81fp-44, 0x1.8a9f4e944be1cp-44, -0x1.7bd9af92da276p-46, 0x1.7ea9fe9f51571p-49, -0x1.5532eaf516982p-53,
+	0x1p+0, 0x1.6827863b97d97p-53, -0x1.952c77030ad4ap-50, 0x1.1eff7ef77d015p-47, -0x1.1eff7ef77d015p-45, 0x1.ae7f3e733b81fp-44, -0x1.f63f1e311ac24p-43, 0x1.d25f2e522b222p-42, -0x1.5dc762bda0599p-41, 0x1.ab81ea75fcdf4p-41, -0x1.ab81ea75fcdf4p-41, 0x1.5dc762bda0599p-41, -0x1.d25f2e522b222p-42, 0x1.f63f1e311ac24p-43, -0x1.ae7f3e733b81fp-44, 0x1.1eff7ef77d015p-45, -0x1.1eff7ef77d015p-47, 0x1.952c77030ad4ap-50, -0x1.6827863b97d97p-53, 0x1.2f49b46814157p-57,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 20 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.e542ba4020225p-62,
+	0x1.e542ba4020225p-62, 0x1.2f49b46814157p-57, 0x1.6827863b97d97p-54, 0x1.0e1da4acb1e32p-51, 0x1.1eff7ef77d015p-49, 0x1.cb3264bf2e688p-48, 0x1.1eff7ef77d015p-46, 0x1.1eff7ef77d015p-45, 0x1.d25f2e522b222p-45, 0x1.36ea1ee17216cp-44, 0x1.5601885e63e5dp-44, 0x1.36ea1ee17216cp-44, 0x1.d25f2e522b222p-45, 0x1.1eff7ef77d015p-45, 0x1.1eff7ef77d015p-46, 0x1.cb3264bf2e688p-48, 0x1.1eff7ef77d015p-49, 0x1.0e1da4acb1e32p-51, 0x1.6827863b97d97p-54, 0x1.2f49b46814157p-57, -0x1.201f9e9613146p-57,
+	0x1.e5405bacb7523p-42, 0x1.2f46be2fd1114p-38, 0x1.68207d75f8af8p-36, 0x1.0e13178443242p-34, 0x1.1ee9130191ab8p-33, 0x1.caeaa4df70894p-33, 0x1.1ea5cf1fcfaa4p-32, 0x1.1e4c1f4822533p-32, 0x1.d0183758446c3p-33, 0x1.33e0d5943e798p-33, 0x1.4f5380b48bf25p-34, 0x1.2ac4f9aca3a1ep-35, 0x1.adefbeb3bfc37p-37, 0x1.e44f2641a2f23p-39, 0x1.8a9f4e944be1cp-41, 0x1.5865cb8f62ce6p-44, -0x1.1eff7ef77d015p-47, -0x1.952c77030ad4ap-48, -0x1.6827863b97d97p-50, -0x1.5532eaf516982p-53, 0x1.44239268d576fp-54,
+	0x1.8794721c52e4bp-30, 0x1.45544eaedae2ep-27, 0x1.00614d96d8131p-25, 0x1.fd3e59c7c5de9p-25, 0x1.64fa72f17df0ep-24, 0x1.76cd1c3c09509p-24, 0x1.30de7d9296764p-24, 0x1.879438e291ecep-25, 0x1.9008761989413p-26, 0x1.437f9bae69016p-27, 0x1.9489041b15cd8p-29, 0x1.6d9afda00a305p-31, 0x1.73698d03b019dp-34, -0x1.9a514785d4b7ep-38, -0x1.94b64a0aff46dp-38, -0x1.734dbf7696868p-40, -0x1.b7773a6af76ap-44, 0x1.e124cd539cdc8p-46, 0x1.4ed4becb672c3p-47, 0x1.6a8619a46801ap-50, -0x1.cb3264bf2e688p-52,
+	0x1.c692405dcf482p-22, 0x1.15c00524e8b7p-19, 0x1.3fce76eae288cp-18, 0x1.cbcbfc7c6d331p-18, 0x1.cc99f6236224cp-18, 0x1.532137cc80527p-18, 0x1.7819f784fc3cdp-19, 0x1.3a91540a5027ap-20, 0x1.8107624e78621p-22, 0x1.342d5931d7f49p-24, 0x1.3e6afd4ea152p-28, -0x1.4fa90116a38b5p-29, -0x1.02cdf1a4790fap-30, -0x1.249a7c7252725p-33, 0x1.2c7378eb16dd6p-37, 0x1.ef12549e1e08ap-38, 0x1.2c7378eb16dd6p-40, -0x1.952c77030ad4ap-45, -0x1.7ea9fe9f51571p-45, -0x1.e35d7785e0023p-48, 0x1.cb3264bf2e688p-50,
+	0x1.fe912f24a1dc7p-16, 0x1.dbb07f391359dp-14, 0x1.9badb99e099fp-13, 0x1.b40abaa1fe87cp-13, 0x1.385cb48473a2cp-13, 0x1.3992d20e9524dp-14, 0x1.b250b3bb355a3p-16, 0x1.7007aad57c646p-18, 0x1.10b9b6e737032p-22, -0x1.147d41dd02769p-22, -0x1.76cb0a7be66cp-24, -0x1.3192951d9e7afp-27, 0x1.1917b61f2e575p-29, 0x1.b42c2be6006acp-31, 0x1.1f473ed73ae09p-34, -0x1.3c2571dc9fb37p-36, -0x1.5e56e27d1c181p-38, -0x1.3c8abcfa60762p-43, 0x1.2af4ceec778cp-43, 0x1.c527a00d82021p-46, -0x1.5865cb8f62ce6p-48,
+	0x1.a507d567f378ep-11, 0x1.2c664aabe12abp-9, 0x1.83c56aeea00d9p-9, 0x1.25e8e22b6fae7p-9, 0x1.1826aa2322359p-10, 0x1.3e602233d9ba9p-12, 0x1.010be24c0173dp-15, -0x1.96da34f7a7c9dp-17, -0x1.6aaa9f896d2bbp-18, -0x1.496e812b851d5p-21, 0x1.4849a02154a58p-23, 0x1.f784cb1eae99ap-25, 0x1.c917997e38966p-29, -0x1.fd1cfb1ac69ffp-30, -0x1.a5f2e24b1c68cp-32, 0x1.07adefd9c7a6p-36, 0x1.f2529ff4b88ccp-37, 0x1.36360b1e544adp-40, -0x1.4ed4becb672c3p-42, -0x1.3d35566fdb017p-44, 0x1.91cc1827489b7p-47,
+	0x1.3d381c77844bbp-7, 0x1.547a753b0ef6bp-6, 0x1.3a2ca0d75618cp-6, 0x1.3489304cde072p-7, 0x1.22b48afd2c0d4p-9, -0x1.5781a5124af25p-14, -0x1.a14654c529a15p-13, -0x1.5ae6ab9fc9cffp-15, 0x1.0dfbe213f172ep-18, 0x1.95b9bb1ada699p-19, 0x1.1d4d90f0d922fp-22, -0x1.b89431bad8c67p-24, -0x1.9afd4bc87e2ddp-26, 0x1.67c376406c8aep-30, 0x1.1109793e5b009p-30, 0x1.ac7aa5c1e46dcp-35, -0x1.d7d64bdd21a38p-36, -0x1.f817d21148f99p-39, 0x1.100cdb0543d3ep-41, 0x1.57a472f92d419p-43, -0x1.7518f1db55b4ep-46,
+	0x1.f35a78d93cde1p-5, 0x1.82bdce8a34a9bp-4, 0x1.cd15d23e363c8p-5, 0x1.9a9f96fab8c4cp-7, -0x1.feeb8f53ed851p-10, -0x1.920b7dc1d9d66p-10, -0x1.115e2ed9613c1p-13, 0x1.61cf7e67b82b9p-14, 0x1.3eb7f89515893p-16, -0x1.4457254b815afp-19, -0x1.3cac26fdfe3f7p-20, 0x1.4fa90116a38b5p-29, 0x1.a2811467911fcp-25, 0x1.dbb0da2194613p-29, -0x1.96b58125281d8p-30, -0x1.bdf7d1182c723p-33, 0x1.28f29a7e5176bp-35, 0x1.0b7a5a9102266p-37, -0x1.36ea1ee17216cp-41, -0x1.268cf4d594815p-42, 0x1.17d2b5648047bp-45,
+	0x1.c3f301f38abd6p-3, 0x1.d515e22bef62fp-3, 0x1.12aca1f6ba11ep-4, -0x1.3820ef7afbf2ep-7, -0x1.00256eb7d14ecp-7, -0x1.5bf26fcec200ep-15, 0x1.3470ae3502824p-11, 0x1.8c2cd2303b576p-15, -0x1.0cb65f31e9b45p-15, -0x1.231e07b67fa8p-18, 0x1.67306c890c629p-20, 0x1.0d9435b25de7dp-22, -0x1.7c08d8bf4bbf3p-25, -0x1.78f7a604516cbp-27, 0x1.41e2114856252p-30, 0x1.aad6e9b1cdad5p-32, -0x1.aed8ee4ae8d9p-36, -0x1.9a37f4be64873p-37, 0x1.ab81ea75fcdf4p-42, 0x1.9501d0a5ac31dp-42, -0x1.5601885e63e5dp-45,
+	0x1p-1, 0x1.3a0dc1a77e65dp-2, 0x0p+0, -0x1.e78c3432e7323p-6, 0x0p+0, 0x1.4dd8f5e17aedap-9, 0x0p+0, -0x1.63b3452adf203p-13, 0x0p+0, 0x1.2f6d83d00fa74p-17, 0x0p+0, -0x1.ab26ad01acf6bp-22, 0x0p+0, 0x1.fc3609829b795p-27, 0x0p+0, -0x1.04832adfe6181p-31, 0x0p+0, 0x1.d783fed4f5055p-37, 0x0p+0, -0x1.c20204464d8cbp-42, 0x1.5601885e63e5dp-45,
+	0x1.8f033f831d50bp-1, 0x1.d515e22bef62fp-3, -0x1.12aca1f6ba11ep-4, -0x1.3820ef7afbf2ep-7, 0x1.00256eb7d14ecp-7, -0x1.5bf26fcec200ep-15, -0x1.3470ae3502824p-11, 0x1.8c2cd2303b576p-15, 0x1.0cb65f31e9b45p-15, -0x1.231e07b67fa8p-18, -0x1.67306c890c629p-20, 0x1.0d9435b25de7dp-22, 0x1.7c08d8bf4bbf3p-25, -0x1.78f7a604516cbp-27, -0x1.41e2114856252p-30, 0x1.aad6e9b1cdad5p-32, 0x1.aed8ee4ae8d9p-36, -0x1.9a37f4be64873p-37, -0x1.ab81ea75fcdf4p-42, 0x1.9501d0a5ac31dp-42, -0x1.17d2b5648047bp-45,
+	0x1.e0ca58726c322p-1, 0x1.82bdce8a34a9bp-4, -0x1.cd15d23e363c8p-5, 0x1.9a9f96fab8c4cp-7, 0x1.feeb8f53ed851p-10, -0x1.920b7dc1d9d66p-10, 0x1.115e2ed9613c1p-13, 0x1.61cf7e67b82b9p-14, -0x1.3eb7f89515893p-16, -0x1.4457254b815afp-19, 0x1.3cac26fdfe3f7p-20, 0x1.4fa90116a38b5p-29, -0x1.a2811467911fcp-25, 0x1.dbb0da2194613p-29, 0x1.96b58125281d8p-30, -0x1.bdf7d1182c723p-33, -0x1.28f29a7e5176bp-35, 0x1.0b7a5a9102266p-37, 0x1.36ea1ee17216cp-41, -0x1.268cf4d594815p-42, 0x1.7518f1db55b4ep-46,
+	0x1.fb0b1f8e21eedp-1, 0x1.547a753b0ef6bp-6, -0x1.3a2ca0d75618cp-6, 0x1.3489304cde072p-7, -0x1.22b48afd2c0d4p-9, -0x1.5781a5124af25p-14, 0x1.a14654c529a15p-13, -0x1.5ae6ab9fc9cffp-15, -0x1.0dfbe213f172ep-18, 0x1.95b9bb1ada699p-19, -0x1.1d4d90f0d922fp-22, -0x1.b89431bad8c67p-24, 0x1.9afd4bc87e2ddp-26, 0x1.67c376406c8aep-30, -0x1.1109793e5b009p-30, 0x1.ac7aa5c1e46dcp-35, 0x1.d7d64bdd21a38p-36, -0x1.f817d21148f99p-39, -0x1.100cdb0543d3ep-41, 0x1.57a472f92d419p-43, -0x1.91cc1827489b7p-47,
+	0x1.ff96be0aa6032p-1, 0x1.2c664aabe12abp-9, -0x1.83c56aeea00d9p-9, 0x1.25e8e22b6fae7p-9, -0x1.1826aa2322359p-10, 0x1.3e602233d9ba9p-12, -0x1.010be24c0173dp-15, -0x1.96da34f7a7c9dp-17, 0x1.6aaa9f896d2bbp-18, -0x1.496e812b851d5p-21, -0x1.4849a02154a58p-23, 0x1.f784cb1eae99ap-25, -0x1.c917997e38966p-29, -0x1.fd1cfb1ac69ffp-30, 0x1.a5f2e24b1c68cp-32, 0x1.07adefd9c7a6p-36, -0x1.f2529ff4b88ccp-37, 0x1.36360b1e544adp-40, 0x1.4ed4becb672c3p-42, -0x1.3d35566fdb017p-44, 0x1.5865cb8f62ce6p-48,
+	0x1.fffc02dda1b6cp-1, 0x1.dbb07f391359dp-14, -0x1.9badb99e099fp-13, 0x1.b40abaa1fe87cp-13, -0x1.385cb48473a2cp-13, 0x1.3992d20e9524dp-14, -0x1.b250b3bb355a3p-16, 0x1.7007aad57c646p-18, -0x1.10b9b6e737032p-22, -0x1.147d41dd02769p-22, 0x1.76cb0a7be66cp-24, -0x1.3192951d9e7afp-27, -0x1.1917b61f2e575p-29, 0x1.b42c2be6006acp-31, -0x1.1f473ed73ae09p-34, -0x1.3c2571dc9fb37p-36, 0x1.5e56e27d1c181p-38, -0x1.3c8abcfa60762p-43, -0x1.2af4ceec778cp-43, 0x1.c527a00d82021p-46, -0x1.cb3264bf2e688p-50,
+	0x1.fffff1cb6dfd1p-1, 0x1.15c00524e8b7p-19, -0x1.3fce76eae288cp-18, 0x1.cbcbfc7c6d331p-18, -0x1.cc99f6236224cp-18, 0x1.532137cc80527p-18, -0x1.7819f784fc3cdp-19, 0x1.3a91540a5027ap-20, -0x1.8107624e78621p-22, 0x1.342d5931d7f49p-24, -0x1.3e6afd4ea152p-28, -0x1.4fa90116a38b5p-29, 0x1.02cdf1a4790fap-30, -0x1.249a7c7252725p-33, -0x1.2c7378eb16dd6p-37, 0x1.ef12549e1e08ap-38, -0x1.2c7378eb16dd6p-40, -0x1.952c77030ad4ap-45, 0x1.7ea9fe9f51571p-45, -0x1.e35d7785e0023p-48, 0x1.cb3264bf2e688p-52,
+	0x1.fffffff3c35c7p-1, 0x1.45544eaedae2ep-27, -0x1.00614d96d8131p-25, 0x1.fd3e59c7c5de9p-25, -0x1.64fa72f17df0ep-24, 0x1.76cd1c3c09509p-24, -0x1.30de7d9296764p-24, 0x1.879438e291ecep-25, -0x1.9008761989413p-26, 0x1.437f9bae69016p-27, -0x1.9489041b15cd8p-29, 0x1.6d9afda00a305p-31, -0x1.73698d03b019dp-34, -0x1.9a514785d4b7ep-38, 0x1.94b64a0aff46dp-38, -0x1.734dbf7696868p-40, 0x1.b7773a6af76ap-44, 0x1.e124cd539cdc8p-46, -0x1.4ed4becb672c3p-47, 0x1.6a8619a46801ap-50, -0x1.44239268d576fp-54,
+	0x1.ffffffffff0d6p-1, 0x1.2f46be2fd1114p-38, -0x1.68207d75f8af8p-36, 0x1.0e13178443242p-34, -0x1.1ee9130191ab8p-33, 0x1.caeaa4df70894p-33, -0x1.1ea5cf1fcfaa4p-32, 0x1.1e4c1f4822533p-32, -0x1.d0183758446c3p-33, 0x1.33e0d5943e798p-33, -0x1.4f5380b48bf25p-34, 0x1.2ac4f9aca3a1ep-35, -0x1.adefbeb3bfc37p-37, 0x1.e44f2641a2f23p-39, -0x1.8a9f4e944be1cp-41, 0x1.5865cb8f62ce6p-44, 0x1.1eff7ef77d015p-47, -0x1.952c77030ad4ap-48, 0x1.6827863b97d97p-50, -0x1.5532eaf516982p-53, 0x1.201f9e9613146p-57,
+	0x1p+0, 0x1.2f49b46814157p-57, -0x1.6827863b97d97p-54, 0x1.0e1da4acb1e32p-51, -0x1.1eff7ef77d015p-49, 0x1.cb3264bf2e688p-48, -0x1.1eff7ef77d015p-46, 0x1.1eff7ef77d015p-45, -0x1.d25f2e522b222p-45, 0x1.36ea1ee17216cp-44, -0x1.5601885e63e5dp-44, 0x1.36ea1ee17216cp-44, -0x1.d25f2e522b222p-45, 0x1.1eff7ef77d015p-45, -0x1.1eff7ef77d015p-46, 0x1.cb3264bf2e688p-48, -0x1.1eff7ef77d015p-49, 0x1.0e1da4acb1e32p-51, -0x1.6827863b97d97p-54, 0x1.2f49b46814157p-57, -0x1.e542ba4020225p-62,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 21 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.71b8ef6dcf572p-66,
+	0x1.71b8ef6dcf572p-66, 0x1.e542ba4020225p-62, 0x1.2f49b46814157p-58, 0x1.e034b2fa1fccap-56, 0x1.0e1da4acb1e32p-53, 0x1.cb3264bf2e688p-52, 0x1.3221987f7445ap-50, 0x1.47ff6c888edcfp-49, 0x1.1eff7ef77d015p-48, 0x1.9e8d7e81ed73ap-48, 0x1.f17697cf1cf13p-48, 0x1.f17697cf1cf13p-48, 0x1.9e8d7e81ed73ap-48, 0x1.1eff7ef77d015p-48, 0x1.47ff6c888edcfp-49, 0x1.3221987f7445ap-50, 0x1.cb3264bf2e688p-52, 0x1.0e1da4acb1e32p-53, 0x1.e034b2fa1fccap-56, 0x1.2f49b46814157p-58, 0x1.e542ba4020225p-62, -0x1.ce272b49432cep-62,
+	0x1.71b7fccc72371p-45, 0x1.e5403d588bae2p-42, 0x1.2f4698469a844p-39, 0x1.e02ad9e5742b8p-38, 0x1.0e12907570cddp-36, 0x1.cb0cb99ceab9bp-36, 0x1.31ef5efc6f5c9p-35, 0x1.4793ccb8f20ep-35, 0x1.1e43274c2a974p-35, 0x1.9c6d64cbe2ecp-36, 0x1.ec5cc0809d453p-37, 0x1.e742e9321d994p-38, 0x1.8d8cb0d199366p-39, 0x1.0774898d2fc03p-40, 0x1.122f84ba276cbp-42, 0x1.9b5d24eb443d9p-45, 0x1.3bb2a5436fe7dp-48, -0x1.51a50dd7de5bep-51, -0x1.862ad16b39d64p-52, -0x1.423e4fae9556dp-54, -0x1.201f9e9613146p-57, 0x1.126741b37fe2ap-58,
+	0x1.c0550bb55f9d1p-33, 0x1.87761e1698194p-30, 0x1.452e65d714e8cp-28, 0x1.559b0cb4371abp-27, 0x1.fcb7503c03bdp-27, 0x1.1d22651ffdb9ap-26, 0x1.f28a33e222206p-27, 0x1.5b24644d19e2fp-27, 0x1.8557a0a401a84p-28, 0x1.605cafb44edccp-29, 0x1.fde68d59c00bfp-31, 0x1.1e961d26de216p-32, 0x1.ce9392b1aa9d9p-35, 0x1.86fa9037a78b8p-38, -0x1.74d7585f3a652p-41, -0x1.e44f2641a2f23p-42, -0x1.88d41c2f8cb36p-44, -0x1.7bd9af92da276p-48, 0x1.02dc687ad5245p-49, 0x1.3fdfbc45c52eap-51, 0x1.44239268d576fp-54, -0x1.9b9ae28d3fd3fp-56,
+	0x1.5f4b05883698bp-24, 0x1.c50aabebb2f54p-22, 0x1.147ab0d639dc2p-20, 0x1.a7bcf06a46763p-20, 0x1.c7d17fc8dda75p-20, 0x1.6c04d6ac7cf0dp-20, 0x1.bc5d59cf6ae6fp-21, 0x1.a2f128ae2d2efp-22, 0x1.2e54b2433b984p-23, 0x1.400617eeffd39p-25, 0x1.ac623c601153ep-28, 0x1.51e44f48fb669p-33, -0x1.1cb52aff1964fp-32, -0x1.5b1947f218b2cp-34, -0x1.3fbff03ddfc54p-37, 0x1.0c29edd5a59ap-40, 0x1.25f2e23de1d52p-41, 0x1.34a0dea7514p-44, -0x1.1eff7ef77d015p-48, -0x1.88bbf11cc601cp-49, -0x1.cb3264bf2e688p-52, 0x1.b55490b613d13p-54,
+	0x1.fbe6917cb036ep-18, 0x1.f776e6232a9f5p-16, 0x1.d3027f0fec141p-15, 0x1.0bca2e99cc5c8p-14, 0x1.a5ac5abe1b1e3p-15, 0x1.dcbfd4855a82ap-16, 0x1.85d6536d117f8p-17, 0x1.baa1aa0c18f0ap-19, 0x1.216355d2e85a8p-21, -0x1.8f4d0c19cbfc1p-27, -0x1.1ad3acedf9f63p-25, -0x1.1f0ce497dd753p-27, -0x1.278b1bca9ccadp-31, 0x1.f93974da5c265p-33, 0x1.230abd260c043p-34, 0x1.0a5ebb70e66bap-38, -0x1.b7ea070427359p-40, -0x1.906cf19e01b43p-42, -0x1.7ea9fe9f51571p-48, 0x1.4c50422c0a018p-47, 0x1.cb3264bf2e688p-50, -0x1.5ddd4091a9743p-52,
+	0x1.0761d09f525a6p-12, 0x1.95134beece6ap-11, 0x1.1d88c6b2188fep-10, 0x1.e2b8bf1ba9ef9p-11, 0x1.0aa836814fc5fp-11, 0x1.81c4ec1db9353p-13, 0x1.3ff9e7959b41dp-15, 0x1.6cb2963a87191p-21, -0x1.276f053132fep-19, -0x1.518589bfe418cp-21, -0x1.31e63394d3034p-25, 0x1.770b03e834429p-26, 0x1.829ba0440ed04p-28, 0x1.b13acd38b6c2ap-34, -0x1.9f8ae52c719e7p-33, -0x1.0757d666e3cd5p-35, 0x1.21e9b0db33acbp-39, 0x1.3cf008182138dp-40, 0x1.36ea1ee17216cp-44, -0x1.97d6dcd8f501dp-46, -0x1.5865cb8f62ce6p-48, 0x1.b55490b613d13p-51,
+	0x1.ed217430ae4e7p-9, 0x1.22e79f2105142p-7, 0x1.2eedabe592d16p-7, 0x1.624544a202c96p-8, 0x1.d61def840437p-10, 0x1.e203dfbebca17p-13, -0x1.0d805cfaf2fa1p-14, -0x1.1329e30dceda7p-15, -0x1.ea603cc3bfbafp-19, 0x1.192d8ef09bd4bp-20, 0x1.86777c5162f3ep-22, 0x1.60768e2f13d1fp-27, -0x1.cd8f0f86cab78p-27, -0x1.2013d7fb3e4f3p-29, 0x1.f08040c66661ap-33, 0x1.93c2574579b63p-34, 0x1.28a3add5009acp-39, -0x1.534b1c292c31dp-39, -0x1.24fa26f1fa46ap-42, 0x1.72138f827f81bp-45, 0x1.91cc1827489b7p-47, -0x1.b55490b613d13p-50,
+	0x1.dea589752ca84p-6, 0x1.a40c71bb5bcb2p-5, 0x1.2d9f313b70ec1p-5, 0x1.9554ad18b9958p-7, 0x1.98599ab76af6ap-11, -0x1.b4eea885b573p-11, -0x1.fb6f2f40f189bp-13, 0x1.48ee0d88a579bp-17, 0x1.07a16a1bce89cp-16, 0x1.be9e39002cc0dp-20, -0x1.2406c028f181dp-21, -0x1.1a2e36b5f7a8dp-23, 0x1.2cb6512d0941ep-27, 0x1.7fffd51af6491p-28, 0x1.52114801901fcp-33, -0x1.6a87fd01df878p-33, -0x1.148b3d4452c6dp-36, 0x1.f58569cfe407fp-39, 0x1.5dc762bda0599p-41, -0x1.eaeaed63f7823p-45, -0x1.7518f1db55b4ep-46, 0x1.6354b593f01ap-49,
+	0x1.09075b3e4427cp-3, 0x1.471c63bd3b85dp-3, 0x1.13b6fae6d50e2p-4, 0x1.d6bd08fbf4d1bp-9, -0x1.6960433ada5bdp-8, -0x1.33a6614885c9dp-10, 0x1.04c7f18242844p-12, 0x1.ae9bafe867ca9p-14, -0x1.37722a9f34ffcp-18, -0x1.7c82186ea06b7p-18, -0x1.9ca1769bfcbb6p-23, 0x1.eb8925797c18cp-23, 0x1.63f12f95962bbp-26, -0x1.eb6891f087ebbp-28, -0x1.1b5da2998cde5p-30, 0x1.84951ae510238p-33, 0x1.44e9691ef1f33p-35, -0x1.e23b5be56ef4p-39, -0x1.2d32cdea6686p-40, 0x1.b9d36f405ec2p-45, 0x1.17d2b5648047bp-45, -0x1.d9c6476feacd5p-49,
+	0x1.6a2d5bf08bf4ap-2, 0x1.1e067f063aa15p-2, 0x1.3e0b42461ad16p-5, -0x1.6e3b829e4d6d3p-6, -0x1.4b7bbc756938cp-8, 0x1.99d57df2e87ep-10, 0x1.c460ff80f29cep-12, -0x1.6080c71802dep-14, -0x1.c6be79b6edf61p-16, 0x1.ddb5fe919f797p-19, 0x1.67306c890c629p-20, -0x1.053a7d7af1bc1p-23, -0x1.d07c9722b1e9bp-25, 0x1.d3bc1e754988dp-29, 0x1.f9d0f6963e3a5p-30, -0x1.575789e6c249bp-34, -0x1.d9ee9fb8cceebp-35, 0x1.9580e04680cc4p-40, 0x1.87e1c196d2775p-40, -0x1.68019d050ad6fp-46, -0x1.5601885e63e5dp-45, 0x1.04937417278a8p-48,
+	0x1.4ae95207ba05bp-1, 0x1.1e067f063aa15p-2, -0x1.3e0b42461ad16p-5, -0x1.6e3b829e4d6d3p-6, 0x1.4b7bbc756938cp-8, 0x1.99d57df2e87ep-10, -0x1.c460ff80f29cep-12, -0x1.6080c71802dep-14, 0x1.c6be79b6edf61p-16, 0x1.ddb5fe919f797p-19, -0x1.67306c890c629p-20, -0x1.053a7d7af1bc1p-23, 0x1.d07c9722b1e9bp-25, 0x1.d3bc1e754988dp-29, -0x1.f9d0f6963e3a5p-30, -0x1.575789e6c249bp-34, 0x1.d9ee9fb8cceebp-35, 0x1.9580e04680cc4p-40, -0x1.87e1c196d2775p-40, -0x1.68019d050ad6fp-46, 0x1.5601885e63e5dp-45, -0x1.d9c6476feacd5p-49,
+	0x1.bdbe29306ef61p-1, 0x1.471c63bd3b85dp-3, -0x1.13b6fae6d50e2p-4, 0x1.d6bd08fbf4d1bp-9, 0x1.6960433ada5bdp-8, -0x1.33a6614885c9dp-10, -0x1.04c7f18242844p-12, 0x1.ae9bafe867ca9p-14, 0x1.37722a9f34ffcp-18, -0x1.7c82186ea06b7p-18, 0x1.9ca1769bfcbb6p-23, 0x1.eb8925797c18cp-23, -0x1.63f12f95962bbp-26, -0x1.eb6891f087ebbp-28, 0x1.1b5da2998cde5p-30, 0x1.84951ae510238p-33, -0x1.44e9691ef1f33p-35, -0x1.e23b5be56ef4p-39, 0x1.2d32cdea6686p-40, 0x1.b9d36f405ec2p-45, -0x1.17d2b5648047bp-45, 0x1.6354b593f01ap-49,
+	0x1.f10ad3b4569acp-1, 0x1.a40c71bb5bcb2p-5, -0x1.2d9f313b70ec1p-5, 0x1.9554ad18b9958p-7, -0x1.98599ab76af6ap-11, -0x1.b4eea885b573p-11, 0x1.fb6f2f40f189bp-13, 0x1.48ee0d88a579bp-17, -0x1.07a16a1bce89cp-16, 0x1.be9e39002cc0dp-20, 0x1.2406c028f181dp-21, -0x1.1a2e36b5f7a8dp-23, -0x1.2cb6512d0941ep-27, 0x1.7fffd51af6491p-28, -0x1.52114801901fcp-33, -0x1.6a87fd01df878p-33, 0x1.148b3d4452c6dp-36, 0x1.f58569cfe407fp-39, -0x1.5dc762bda0599p-41, -0x1.eaeaed63f7823p-45, 0x1.7518f1db55b4ep-46, -0x1.b55490b613d13p-50,
+	0x1.fe12de8bcf51bp-1, 0x1.22e79f2105142p-7, -0x1.2eedabe592d16p-7, 0x1.624544a202c96p-8, -0x1.d61def840437p-10, 0x1.e203dfbebca17p-13, 0x1.0d805cfaf2fa1p-14, -0x1.1329e30dceda7p-15, 0x1.ea603cc3bfbafp-19, 0x1.192d8ef09bd4bp-20, -0x1.86777c5162f3ep-22, 0x1.60768e2f13d1fp-27, 0x1.cd8f0f86cab78p-27, -0x1.2013d7fb3e4f3p-29, -0x1.f08040c66661ap-33, 0x1.93c2574579b63p-34, -0x1.28a3add5009acp-39, -0x1.534b1c292c31dp-39, 0x1.24fa26f1fa46ap-42, 0x1.72138f827f81bp-45, -0x1.91cc1827489b7p-47, 0x1.b55490b613d13p-51,
+	0x1.ffdf13c5ec15bp-1, 0x1.95134beece6ap-11, -0x1.1d88c6b2188fep-10, 0x1.e2b8bf1ba9ef9p-11, -0x1.0aa836814fc5fp-11, 0x1.81c4ec1db9353p-13, -0x1.3ff9e7959b41dp-15, 0x1.6cb2963a87191p-21, 0x1.276f053132fep-19, -0x1.518589bfe418cp-21, 0x1.31e63394d3034p-25, 0x1.770b03e834429p-26, -0x1.829ba0440ed04p-28, 0x1.b13acd38b6c2ap-34, 0x1.9f8ae52c719e7p-33, -0x1.0757d666e3cd5p-35, -0x1.21e9b0db33acbp-39, 0x1.3cf008182138dp-40, -0x1.36ea1ee17216cp-44, -0x1.97d6dcd8f501dp-46, 0x1.5865cb8f62ce6p-48, -0x1.5ddd4091a9743p-52,
+	0x1.ffff020cb741ap-1, 0x1.f776e6232a9f5p-16, -0x1.d3027f0fec141p-15, 0x1.0bca2e99cc5c8p-14, -0x1.a5ac5abe1b1e3p-15, 0x1.dcbfd4855a82ap-16, -0x1.85d6536d117f8p-17, 0x1.baa1aa0c18f0ap-19, -0x1.216355d2e85a8p-21, -0x1.8f4d0c19cbfc1p-27, 0x1.1ad3acedf9f63p-25, -0x1.1f0ce497dd753p-27, 0x1.278b1bca9ccadp-31, 0x1.f93974da5c265p-33, -0x1.230abd260c043p-34, 0x1.0a5ebb70e66bap-38, 0x1.b7ea070427359p-40, -0x1.906cf19e01b43p-42, 0x1.7ea9fe9f51571p-48, 0x1.4c50422c0a018p-47, -0x1.cb3264bf2e688p-50, 0x1.b55490b613d13p-54,
+	0x1.fffffd4169f4fp-1, 0x1.c50aabebb2f54p-22, -0x1.147ab0d639dc2p-20, 0x1.a7bcf06a46763p-20, -0x1.c7d17fc8dda75p-20, 0x1.6c04d6ac7cf0dp-20, -0x1.bc5d59cf6ae6fp-21, 0x1.a2f128ae2d2efp-22, -0x1.2e54b2433b984p-23, 0x1.400617eeffd39p-25, -0x1.ac623c601153ep-28, 0x1.51e44f48fb669p-33, 0x1.1cb52aff1964fp-32, -0x1.5b1947f218b2cp-34, 0x1.3fbff03ddfc54p-37, 0x1.0c29edd5a59ap-40, -0x1.25f2e23de1d52p-41, 0x1.34a0dea7514p-44, 0x1.1eff7ef77d015p-48, -0x1.88bbf11cc601cp-49, 0x1.cb3264bf2e688p-52, -0x1.9b9ae28d3fd3fp-56,
+	0x1.fffffffe3faafp-1, 0x1.87761e1698194p-30, -0x1.452e65d714e8cp-28, 0x1.559b0cb4371abp-27, -0x1.fcb7503c03bdp-27, 0x1.1d22651ffdb9ap-26, -0x1.f28a33e222206p-27, 0x1.5b24644d19e2fp-27, -0x1.8557a0a401a84p-28, 0x1.605cafb44edccp-29, -0x1.fde68d59c00bfp-31, 0x1.1e961d26de216p-32, -0x1.ce9392b1aa9d9p-35, 0x1.86fa9037a78b8p-38, 0x1.74d7585f3a652p-41, -0x1.e44f2641a2f23p-42, 0x1.88d41c2f8cb36p-44, -0x1.7bd9af92da276p-48, -0x1.02dc687ad5245p-49, 0x1.3fdfbc45c52eap-51, -0x1.44239268d576fp-54, 0x1.126741b37fe2ap-58,
+	0x1.ffffffffffe8ep-1, 0x1.e5403d588bae2p-42, -0x1.2f4698469a844p-39, 0x1.e02ad9e5742b8p-38, -0x1.0e12907570cddp-36, 0x1.cb0cb99ceab9bp-36, -0x1.31ef5efc6f5c9p-35, 0x1.4793ccb8f20ep-35, -0x1.1e43274c2a974p-35, 0x1.9c6d64cbe2ecp-36, -0x1.ec5cc0809d453p-37, 0x1.e742e9321d994p-38, -0x1.8d8cb0d199366p-39, 0x1.0774898d2fc03p-40, -0x1.122f84ba276cbp-42, 0x1.9b5d24eb443d9p-45, -0x1.3bb2a5436fe7dp-48, -0x1.51a50dd7de5bep-51, 0x1.862ad16b39d64p-52, -0x1.423e4fae9556dp-54, 0x1.201f9e9613146p-57, -0x1.ce272b49432cep-62,
+	0x1p+0, 0x1.e542ba4020225p-62, -0x1.2f49b46814157p-58, 0x1.e034b2fa1fccap-56, -0x1.0e1da4acb1e32p-53, 0x1.cb3264bf2e688p-52, -0x1.3221987f7445ap-50, 0x1.47ff6c888edcfp-49, -0x1.1eff7ef77d015p-48, 0x1.9e8d7e81ed73ap-48, -0x1.f17697cf1cf13p-48, 0x1.f17697cf1cf13p-48, -0x1.9e8d7e81ed73ap-48, 0x1.1eff7ef77d015p-48, -0x1.47ff6c888edcfp-49, 0x1.3221987f7445ap-50, -0x1.cb3264bf2e688p-52, 0x1.0e1da4acb1e32p-53, -0x1.e034b2fa1fccap-56, 0x1.2f49b46814157p-58, -0x1.e542ba4020225p-62, 0x1.71b8ef6dcf572p-66,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 22 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.0ce396db7f853p-70,
+	0x1.0ce396db7f853p-70, 0x1.71b8ef6dcf572p-66, 0x1.e542ba4020225p-63, 0x1.946245e01ac74p-60, 0x1.e034b2fa1fccap-58, 0x1.b02f6de11c9e9p-56, 0x1.3221987f7445ap-54, 0x1.5ddd4091a9743p-53, 0x1.47ff6c888edcfp-52, 0x1.fe37fe29c1c97p-52, 0x1.4ba46534bdf62p-51, 0x1.69ca9cf3b7f54p-51, 0x1.4ba46534bdf62p-51, 0x1.fe37fe29c1c97p-52, 0x1.47ff6c888edcfp-52, 0x1.5ddd4091a9743p-53, 0x1.3221987f7445ap-54, 0x1.b02f6de11c9e9p-56, 0x1.e034b2fa1fccap-58, 0x1.946245e01ac74p-60, 0x1.e542ba4020225p-63, 0x1.71b8ef6dcf572p-66, -0x1.60eab600175ecp-66,
+	0x1.0ce33a6d43a9bp-48, 0x1.71b7f13eaabbap-45, 0x1.e5401f04600a2p-43, 0x1.945dedd1da9fp-41, 0x1.e02a61d8476cfp-40, 0x1.b01cdbd763f25p-39, 0x1.3207499c5951ap-38, 0x1.5da11e8a906b1p-38, 0x1.478eacbb3febdp-38, 0x1.fcd937ab05143p-39, 0x1.49dc63299570fp-39, 0x1.65e7afc419bb5p-40, 0x1.44845d081be15p-41, 0x1.e84b963df675cp-43, 0x1.2bcf7934d295fp-44, 0x1.21bb3978a0543p-46, 0x1.91cc1827489b7p-49, 0x1.0e1da4acb1e32p-52, -0x1.6827863b97d97p-55, -0x1.61d5fd24176e6p-56, -0x1.10f588c412135p-58, -0x1.ce272b49432cep-62, 0x1.b92563801d367p-63,
+	0x1.e9b69c38d7dcap-36, 0x1.c03df03592d5fp-33, 0x1.8757ca12c2908p-31, 0x1.b160a6b0101c9p-30, 0x1.555f0758fa6c2p-29, 0x1.968d058fd403bp-29, 0x1.7b94d7ecc8a94p-29, 0x1.1c32704af0f77p-29, 0x1.59dcd08060f0ep-30, 0x1.581817685d9f2p-31, 0x1.174fdd889278bp-32, 0x1.6d3de49ce6f95p-34, 0x1.73f6c202c78ebp-36, 0x1.0d5f3fc7bbb78p-38, 0x1.738f58f2b1d64p-42, -0x1.0ff6fd313ab95p-44, -0x1.0bdd656f85bcfp-45, -0x1.844a9cb83fb67p-48, -0x1.2c20efdc53dfep-52, 0x1.030ef4c39127ap-53, 0x1.201f9e9613146p-55, 0x1.126741b37fe2ap-58, -0x1.5d3d997017207p-60,
+	0x1.025a038d7f0b8p-26, 0x1.5e6adb025be8fp-24, 0x1.c38335cd9c5d2p-23, 0x1.6ef2034083b45p-22, 0x1.a511ba50de07fp-22, 0x1.6979a753847fep-22, 0x1.df6b1175514d3p-23, 0x1.f2f15c9227475p-24, 0x1.9818058bc45fep-25, 0x1.01ec683734ed5p-26, 0x1.dccd47ec5e3c6p-29, 0x1.09327c266f81cp-31, -0x1.39b5395babd05p-37, -0x1.a59337cb74947p-36, -0x1.a89c8118a831bp-38, -0x1.3c35d83ba6876p-41, 0x1.853db7660e569p-44, 0x1.42df6ed66ca17p-45, 0x1.27706c1ce2906p-48, -0x1.5ead38985738dp-52, -0x1.7a298024f90acp-53, -0x1.9b9ae28d3fd3fp-56, 0x1.88e54c9e1a048p-58,
+	0x1.deb1982a1d037p-20, 0x1.f66965668f5c8p-18, 0x1.f062bb737bd38p-17, 0x1.3194710626d8dp-16, 0x1.052b3ad82342ap-16, 0x1.45f1723310273p-17, 0x1.2eaa5a11b7226p-18, 0x1.9dc9b45b8c5cbp-20, 0x1.864384f6534acp-22, 0x1.7c192ce749b29p-25, -0x1.4fe1159128a87p-28, -0x1.e945c0b16ebb2p-29, -0x1.85c5f271572e6p-31, -0x1.7914fbcc76635p-36, 0x1.83dee99d6048fp-36, 0x1.6113fadb7ffcap-38, 0x1.8ea87ff6fa0a3p-43, -0x1.142ecf1f92e1fp-43, -0x1.a8849678be3c9p-46, -0x1.423e4fae9556dp-54, 0x1.5865cb8f62ce6p-51, 0x1.b55490b613d13p-54, -0x1.4df61ab9961d7p-56,
+	0x1.36698d1c334ddp-14, 0x1.fee46cb2bf33p-13, 0x1.855794bdb5151p-12, 0x1.6940ee4ccc3fp-12, 0x1.c13f79487064p-13, 0x1.807be7bbe3535p-14, 0x1.b2e69766bd312p-16, 0x1.fc9c2ace7d722p-19, -0x1.5f75047d772a6p-22, -0x1.46ea89770ba09p-22, -0x1.0906aad930ba4p-24, -0x1.0c7a7bf297dep-32, 0x1.59b64ecd6ca8cp-29, 0x1.04a58c25c6686p-31, -0x1.49d6ebb4932a4p-37, -0x1.2b3bdfdd95227p-36, -0x1.28a3add5009acp-39, 0x1.dfe0a9c134071p-43, 0x1.72b4aeaa56cc5p-44, 0x1.19f685b8c2abfp-48, -0x1.cb3264bf2e688p-50, -0x1.5ddd4091a9743p-52, 0x1.bd4823a21d7c9p-55,
+	0x1.66b481dd0b815p-10, 0x1.cc353a1cc4032p-9, 0x1.09966a62182d8p-8, 0x1.6450c4146a548p-9, 0x1.25ee2cbe8d8b7p-10, 0x1.0d6e436916a9ap-12, 0x1.00a7df02b3cb8p-17, -0x1.ead85c4fb78c9p-17, -0x1.18dcad66b8f6dp-18, -0x1.5a9062cba4de2p-23, 0x1.67f376407180ep-23, 0x1.37c8eabd15549p-25, -0x1.0914fbc0e3222p-30, -0x1.92fe137b94ffcp-30, -0x1.58b43505bb73bp-33, 0x1.e66c588184445p-36, 0x1.0bb7213c75ce7p-37, 0x1.952c77030ad4ap-49, -0x1.ba748e68360cbp-43, -0x1.382c5d3120ac1p-46, 0x1.cb3264bf2e688p-49, 0x1.b55490b613d13p-51, -0x1.dd166f52442a1p-54,
+	0x1.aa8f2ad1537b3p-7, 0x1.a1015aef16de7p-6, 0x1.5b5289f31a862p-6, 0x1.2d2fb302baf4fp-7, 0x1.c864158f7061ap-10, -0x1.a981d0407df93p-13, -0x1.739fc04e43124p-13, -0x1.a9ec93288933p-16, 0x1.6565666ff838dp-18, 0x1.20d30fbcb072dp-19, 0x1.08b4434c1b136p-24, -0x1.625ee78130b71p-24, -0x1.959cd4cbe132ap-27, 0x1.d517006ea9d48p-30, 0x1.2dbc6e5730d2ap-31, -0x1.51fdce70b8041p-38, -0x1.1a3494524e315p-36, -0x1.272ce4b3b763fp-40, 0x1.75b202a7956fp-42, 0x1.a1e8cf5669ac9p-45, -0x1.5865cb8f62ce6p-48, -0x1.b55490b613d13p-50, 0x1.a173a167fba4dp-53,
+	0x1.1f8d04c729ff3p-4, 0x1.9a65541f3d257p-4, 0x1.bc328e9cc9262p-5, 0x1.4d13b0c2f6eaep-7, -0x1.1fa56ad9bc611p-9, -0x1.49ef920e39622p-10, -0x1.dba59ac8e5ac5p-15, 0x1.25ffbc13d8bc1p-14, 0x1.857dee37531b6p-17, -0x1.2f8c67ca5196ep-19, -0x1.89baebbeefafcp-21, 0x1.12b7d51a1aa73p-25, 0x1.01e7c9652695ep-25, 0x1.fa0ed625177cfp-31, -0x1.f43ba898da674p-31, -0x1.5b551d70cb9cp-34, 0x1.778e8bf377d58p-36, 0x1.b3f0074c55f73p-39, -0x1.b5393b6d087p-42, -0x1.90ea8622b4cc8p-44, 0x1.7518f1db55b4ep-48, 0x1.6354b593f01ap-49, -0x1.2d7e2d75c3f7p-52,
+	0x1.d9d0284275dcdp-3, 0x1.cb535ca2d3c19p-3, 0x1.e9e1349e7379ap-5, -0x1.372e44b4bf0e8p-7, -0x1.a91323bdcc076p-8, 0x1.7ea056ac0e8d9p-14, 0x1.de5294d249854p-12, 0x1.b5f01ffd00384p-16, -0x1.878e3b8035544p-16, -0x1.4f01b80d7269p-19, 0x1.ef7dac92c0202p-21, 0x1.2abd88434e874p-23, -0x1.f5d7c1f849388p-26, -0x1.8b5bce1bfe271p-28, 0x1.9e7180aaf4f6ep-31, 0x1.a4e5a7086c516p-33, -0x1.18206fec38a43p-36, -0x1.77ed315677f1dp-38, 0x1.306fe8e76a60fp-42, 0x1.23d2c328ef932p-43, -0x1.f17697cf1cf13p-49, -0x1.d9c6476feacd5p-49, 0x1.69ca9cf3b7f54p-52,
+	0x1p-1, 0x1.2ba5481ee816bp-2, 0x0p+0, -0x1.a80f030823c1dp-6, 0x0p+0, 0x1.092fc9f78760ap-9, 0x0p+0, -0x1.028092008aa2cp-13, 0x0p+0, 0x1.943788a29aa1dp-18, 0x0p+0, -0x1.053a7d7af1bc1p-22, 0x0p+0, 0x1.1dd684641eb73p-27, 0x0p+0, -0x1.0dc4c7c798a7ap-32, 0x0p+0, 0x1.be0dc380c0e0bp-38, 0x0p+0, -0x1.4a017a99f49a6p-43, 0x0p+0, 0x1.04937417278a8p-48, -0x1.69ca9cf3b7f54p-52,
+	0x1.898bf5ef6288dp-1, 0x1.cb535ca2d3c19p-3, -0x1.e9e1349e7379ap-5, -0x1.372e44b4bf0e8p-7, 0x1.a91323bdcc076p-8, 0x1.7ea056ac0e8d9p-14, -0x1.de5294d249854p-12, 0x1.b5f01ffd00384p-16, 0x1.878e3b8035544p-16, -0x1.4f01b80d7269p-19, -0x1.ef7dac92c0202p-21, 0x1.2abd88434e874p-23, 0x1.f5d7c1f849388p-26, -0x1.8b5bce1bfe271p-28, -0x1.9e7180aaf4f6ep-31, 0x1.a4e5a7086c516p-33, 0x1.18206fec38a43p-36, -0x1.77ed315677f1dp-38, -0x1.306fe8e76a60fp-42, 0x1.23d2c328ef932p-43, 0x1.f17697cf1cf13p-49, -0x1.d9c6476feacd5p-49, 0x1.2d7e2d75c3f7p-52,
+	0x1.dc0e5f671ac02p-1, 0x1.9a65541f3d257p-4, -0x1.bc328e9cc9262p-5, 0x1.4d13b0c2f6eaep-7, 0x1.1fa56ad9bc611p-9, -0x1.49ef920e39622p-10, 0x1.dba59ac8e5ac5p-15, 0x1.25ffbc13d8bc1p-14, -0x1.857dee37531b6p-17, -0x1.2f8c67ca5196ep-19, 0x1.89baebbeefafcp-21, 0x1.12b7d51a1aa73p-25, -0x1.01e7c9652695ep-25, 0x1.fa0ed625177cfp-31, 0x1.f43ba898da674p-31, -0x1.5b551d70cb9cp-34, -0x1.778e8bf377d58p-36, 0x1.b3f0074c55f73p-39, 0x1.b5393b6d087p-42, -0x1.90ea8622b4cc8p-44, -0x1.7518f1db55b4ep-48, 0x1.6354b593f01ap-49, -0x1.a173a167fba4dp-53,
+	0x1.f955c354bab21p-1, 0x1.a1015aef16de7p-6, -0x1.5b5289f31a862p-6, 0x1.2d2fb302baf4fp-7, -0x1.c864158f7061ap-10, -0x1.a981d0407df93p-13, 0x1.739fc04e43124p-13, -0x1.a9ec93288933p-16, -0x1.6565666ff838dp-18, 0x1.20d30fbcb072dp-19, -0x1.08b4434c1b136p-24, -0x1.625ee78130b71p-24, 0x1.959cd4cbe132ap-27, 0x1.d517006ea9d48p-30, -0x1.2dbc6e5730d2ap-31, -0x1.51fdce70b8041p-38, 0x1.1a3494524e315p-36, -0x1.272ce4b3b763fp-40, -0x1.75b202a7956fp-42, 0x1.a1e8cf5669ac9p-45, 0x1.5865cb8f62ce6p-48, -0x1.b55490b613d13p-50, 0x1.dd166f52442a1p-54,
+	0x1.ff4ca5bf117a4p-1, 0x1.cc353a1cc4032p-9, -0x1.09966a62182d8p-8, 0x1.6450c4146a548p-9, -0x1.25ee2cbe8d8b7p-10, 0x1.0d6e436916a9ap-12, -0x1.00a7df02b3cb8p-17, -0x1.ead85c4fb78c9p-17, 0x1.18dcad66b8f6dp-18, -0x1.5a9062cba4de2p-23, -0x1.67f376407180ep-23, 0x1.37c8eabd15549p-25, 0x1.0914fbc0e3222p-30, -0x1.92fe137b94ffcp-30, 0x1.58b43505bb73bp-33, 0x1.e66c588184445p-36, -0x1.0bb7213c75ce7p-37, 0x1.952c77030ad4ap-49, 0x1.ba748e68360cbp-43, -0x1.382c5d3120ac1p-46, -0x1.cb3264bf2e688p-49, 0x1.b55490b613d13p-51, -0x1.bd4823a21d7c9p-55,
+	0x1.fff64cb3971e6p-1, 0x1.fee46cb2bf33p-13, -0x1.855794bdb5151p-12, 0x1.6940ee4ccc3fp-12, -0x1.c13f79487064p-13, 0x1.807be7bbe3535p-14, -0x1.b2e69766bd312p-16, 0x1.fc9c2ace7d722p-19, 0x1.5f75047d772a6p-22, -0x1.46ea89770ba09p-22, 0x1.0906aad930ba4p-24, -0x1.0c7a7bf297dep-32, -0x1.59b64ecd6ca8cp-29, 0x1.04a58c25c6686p-31, 0x1.49d6ebb4932a4p-37, -0x1.2b3bdfdd95227p-36, 0x1.28a3add5009acp-39, 0x1.dfe0a9c134071p-43, -0x1.72b4aeaa56cc5p-44, 0x1.19f685b8c2abfp-48, 0x1.cb3264bf2e688p-50, -0x1.5ddd4091a9743p-52, 0x1.4df61ab9961d7p-56,
+	0x1.ffffc429ccfacp-1, 0x1.f66965668f5c8p-18, -0x1.f062bb737bd38p-17, 0x1.3194710626d8dp-16, -0x1.052b3ad82342ap-16, 0x1.45f1723310273p-17, -0x1.2eaa5a11b7226p-18, 0x1.9dc9b45b8c5cbp-20, -0x1.864384f6534acp-22, 0x1.7c192ce749b29p-25, 0x1.4fe1159128a87p-28, -0x1.e945c0b16ebb2p-29, 0x1.85c5f271572e6p-31, -0x1.7914fbcc76635p-36, -0x1.83dee99d6048fp-36, 0x1.6113fadb7ffcap-38, -0x1.8ea87ff6fa0a3p-43, -0x1.142ecf1f92e1fp-43, 0x1.a8849678be3c9p-46, -0x1.423e4fae9556dp-54, -0x1.5865cb8f62ce6p-51, 0x1.b55490b613d13p-54, -0x1.88e54c9e1a048p-58,
+	0x1.ffffff7ed2fe4p-1, 0x1.5e6adb025be8fp-24, -0x1.c38335cd9c5d2p-23, 0x1.6ef2034083b45p-22, -0x1.a511ba50de07fp-22, 0x1.6979a753847fep-22, -0x1.df6b1175514d3p-23, 0x1.f2f15c9227475p-24, -0x1.9818058bc45fep-25, 0x1.01ec683734ed5p-26, -0x1.dccd47ec5e3c6p-29, 0x1.09327c266f81cp-31, 0x1.39b5395babd05p-37, -0x1.a59337cb74947p-36, 0x1.a89c8118a831bp-38, -0x1.3c35d83ba6876p-41, -0x1.853db7660e569p-44, 0x1.42df6ed66ca17p-45, -0x1.27706c1ce2906p-48, -0x1.5ead38985738dp-52, 0x1.7a298024f90acp-53, -0x1.9b9ae28d3fd3fp-56, 0x1.5d3d997017207p-60,
+	0x1.ffffffffc2c93p-1, 0x1.c03df03592d5fp-33, -0x1.8757ca12c2908p-31, 0x1.b160a6b0101c9p-30, -0x1.555f0758fa6c2p-29, 0x1.968d058fd403bp-29, -0x1.7b94d7ecc8a94p-29, 0x1.1c32704af0f77p-29, -0x1.59dcd08060f0ep-30, 0x1.581817685d9f2p-31, -0x1.174fdd889278bp-32, 0x1.6d3de49ce6f95p-34, -0x1.73f6c202c78ebp-36, 0x1.0d5f3fc7bbb78p-38, -0x1.738f58f2b1d64p-42, -0x1.0ff6fd313ab95p-44, 0x1.0bdd656f85bcfp-45, -0x1.844a9cb83fb67p-48, 0x1.2c20efdc53dfep-52, 0x1.030ef4c39127ap-53, -0x1.201f9e9613146p-55, 0x1.126741b37fe2ap-58, -0x1.b92563801d367p-63,
+	0x1.fffffffffffdep-1, 0x1.71b7f13eaabbap-45, -0x1.e5401f04600a2p-43, 0x1.945dedd1da9fp-41, -0x1.e02a61d8476cfp-40, 0x1.b01cdbd763f25p-39, -0x1.3207499c5951ap-38, 0x1.5da11e8a906b1p-38, -0x1.478eacbb3febdp-38, 0x1.fcd937ab05143p-39, -0x1.49dc63299570fp-39, 0x1.65e7afc419bb5p-40, -0x1.44845d081be15p-41, 0x1.e84b963df675cp-43, -0x1.2bcf7934d295fp-44, 0x1.21bb3978a0543p-46, -0x1.91cc1827489b7p-49, 0x1.0e1da4acb1e32p-52, 0x1.6827863b97d97p-55, -0x1.61d5fd24176e6p-56, 0x1.10f588c412135p-58, -0x1.ce272b49432cep-62, 0x1.60eab600175ecp-66,
+	0x1p+0, 0x1.71b8ef6dcf572p-66, -0x1.e542ba4020225p-63, 0x1.946245e01ac74p-60, -0x1.e034b2fa1fccap-58, 0x1.b02f6de11c9e9p-56, -0x1.3221987f7445ap-54, 0x1.5ddd4091a9743p-53, -0x1.47ff6c888edcfp-52, 0x1.fe37fe29c1c97p-52, -0x1.4ba46534bdf62p-51, 0x1.69ca9cf3b7f54p-51, -0x1.4ba46534bdf62p-51, 0x1.fe37fe29c1c97p-52, -0x1.47ff6c888edcfp-52, 0x1.5ddd4091a9743p-53, -0x1.3221987f7445ap-54, 0x1.b02f6de11c9e9p-56, -0x1.e034b2fa1fccap-58, 0x1.946245e01ac74p-60, -0x1.e542ba4020225p-63, 0x1.71b8ef6dcf572p-66, -0x1.0ce396db7f853p-70,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 23 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.761b41316381ap-75,
+	0x1.761b41316381ap-75, 0x1.0ce396db7f853p-70, 0x1.71b8ef6dcf572p-67, 0x1.4381d180156c3p-64, 0x1.946245e01ac74p-62, 0x1.802a28c819708p-60, 0x1.201f9e9613146p-58, 0x1.5ddd4091a9743p-57, 0x1.5ddd4091a9743p-56, 0x1.238db5ceb7e0dp-55, 0x1.982ccb549b078p-55, 0x1.e2637bef9ff1ap-55, 0x1.e2637bef9ff1ap-55, 0x1.982ccb549b078p-55, 0x1.238db5ceb7e0dp-55, 0x1.5ddd4091a9743p-56, 0x1.5ddd4091a9743p-57, 0x1.201f9e9613146p-58, 0x1.802a28c819708p-60, 0x1.946245e01ac74p-62, 0x1.4381d180156c3p-64, 0x1.71b8ef6dcf572p-67, 0x1.0ce396db7f853p-70, -0x1.0132bcd1f4692p-70,
+	0x1.761afdf87dcacp-52, 0x1.0ce33639b54e4p-48, 0x1.71b7e5b0e3403p-46, 0x1.4380007578441p-44, 0x1.945dbb4591e2fp-43, 0x1.802187d5aef1fp-42, 0x1.2012ad2a73568p-41, 0x1.5dbdd1b0dc5dfp-41, 0x1.5d9e62d00f47cp-41, 0x1.2324eee16196cp-41, 0x1.97076b2276382p-42, 0x1.dfae0ced777bbp-43, 0x1.dcf89deb4f05dp-44, 0x1.8f01c9c3748c2p-45, 0x1.1674d823ee9e3p-46, 0x1.3e6e5fc4933acp-48, 0x1.1eff7ef77d015p-50, 0x1.7128833048722p-53, 0x1.b02f6de11c9e9p-57, -0x1.61d5fd24176e6p-59, -0x1.2f49b46814157p-60, -0x1.b70b9c5266377p-63, -0x1.60eab600175ecp-66, 0x1.519297d390c9fp-67,
+	0x1.ff763d761be24p-39, 0x1.e9a5ce0531087p-36, 0x1.c026d4b67eeb4p-34, 0x1.04d0f9608c31bp-32, 0x1.b12e1af255e14p-32, 0x1.10e8ce70991c3p-31, 0x1.0ec0a990941c7p-31, 0x1.b11fce091e454p-32, 0x1.1b839fbbabaf4p-32, 0x1.324bc8bc2180ep-33, 0x1.11af64f3c214ep-34, 0x1.928606ebfefcep-36, 0x1.df885d27c8c33p-38, 0x1.bd51fee592134p-40, 0x1.226a2818e928fp-42, 0x1.3c6193e3b8bc9p-46, -0x1.5865cb8f62ce6p-48, -0x1.13be42c5a0428p-49, -0x1.6827863b97d97p-52, -0x1.ada86a3e1c73bp-57, 0x1.e542ba4020225p-58, 0x1.eb099dfdd75fbp-60, 0x1.b92563801d367p-63, -0x1.194f7e85a352fp-64,
+	0x1.6a9b32a5943dp-29, 0x1.01df95e670d59p-26, 0x1.5d8abc0a411f8p-25, 0x1.2bfd3ead06671p-24, 0x1.6d40a299d3a43p-24, 0x1.4eb8c9ce89a8ep-24, 0x1.ddbb670b311fcp-25, 0x1.0e906c9ea386p-25, 0x1.ea0fc90fcfbfap-27, 0x1.61248d5c3a15ap-28, 0x1.8b790bf98333cp-30, 0x1.415f7d4265c3ep-32, 0x1.24b8ff6e6e2e1p-35, -0x1.456d26941221cp-39, -0x1.1761bb47a693ap-39, -0x1.ddb07e90e1656p-42, -0x1.1a36f8957f303p-45, 0x1.ec660985799b5p-48, 0x1.4a243b0bf5dcbp-49, 0x1.08964cb821856p-52, -0x1.802a28c819708p-56, -0x1.570112205fdb5p-57, -0x1.5d3d997017207p-60, 0x1.4e0e663eb1f28p-62,
+	0x1.ace465e1cd5b4p-22, 0x1.daa8301be7074p-20, 0x1.f0efb9fa85ecep-19, 0x1.463874682e416p-18, 0x1.2bd8a8f924cap-18, 0x1.9757ecb16610dp-19, 0x1.a38786a09aaeep-20, 0x1.48c801bdc53ffp-21, 0x1.7e9a9e9269e83p-23, 0x1.2d8eae7617c61p-25, 0x1.91d18e12b1f97p-29, -0x1.a1a886ee114aap-31, -0x1.726195275c67cp-32, -0x1.d9b0245d6ceb4p-35, 0x1.96cb491b5d2fp-43, 0x1.077aaff0d24fbp-39, 0x1.889ab5e2f4cd9p-42, 0x1.801226258ceefp-48, -0x1.3d3ed0bd7e421p-47, -0x1.a3afbde505cabp-50, 0x1.b02f6de11c9e9p-57, 0x1.4e6dd812c3dc4p-55, 0x1.88e54c9e1a048p-58, -0x1.2ca68f386cf3ep-60,
+	0x1.5a05a619ce86ep-16, 0x1.2eeec6bb8ad9cp-14, 0x1.ef3121878ab82p-14, 0x1.f270a92d76f34p-14, 0x1.5627a73c69d17p-14, 0x1.4d480e5789962p-15, 0x1.ca524c9cac689p-17, 0x1.9a8db7de119cp-19, 0x1.2db750a0b743dp-22, -0x1.49a75988cbc25p-24, -0x1.2b8af2765d78bp-25, -0x1.62f53c5d432e3p-28, 0x1.2fcef622127fap-32, 0x1.10b607060182bp-32, 0x1.37596004c2688p-35, -0x1.26d2550c9edcep-39, -0x1.8380de947521ap-40, -0x1.2ea3f66d96ce8p-43, 0x1.5006e063e6a07p-46, 0x1.918ba54a8c172p-48, 0x1.cb3264bf2e688p-53, -0x1.e11038c848ffcp-54, -0x1.4df61ab9961d7p-56, 0x1.a9ebf58fefaedp-59,
+	0x1.eaab52762d308p-12, 0x1.534de90b484c7p-10, 0x1.ac46f351980ffp-10, 0x1.41abec1da67afp-10, 0x1.3728a64ad0ccap-11, 0x1.7c706288cbfe5p-13, 0x1.ce28c3f04f8cdp-16, -0x1.5e5e76bd03c3ep-19, -0x1.34ffb381ab749p-19, -0x1.cc426ca8ad5ccp-22, 0x1.eba119d0b704ep-27, 0x1.6627d9f235b8cp-26, 0x1.a2827f9bf8b07p-29, -0x1.264f42e1264afp-32, -0x1.30c07c5169424p-33, -0x1.59b1e493ad123p-37, 0x1.88d41c2f8cb36p-39, 0x1.41c3cfb650e6bp-41, -0x1.a4ee31af3fdfcp-47, -0x1.08571d5d36813p-46, -0x1.3221987f7445ap-50, 0x1.0665f06d3f172p-52, 0x1.bd4823a21d7c9p-55, -0x1.e6c4865b5b10fp-58,
+	0x1.6338ad64f6627p-8, 0x1.7db89a95b20b1p-7, 0x1.677ab3ab7e5e1p-7, 0x1.76913f2370a3ap-8, 0x1.a83703fb40bfap-10, 0x1.03efdae7d156bp-13, -0x1.4174c7b0e3c42p-14, -0x1.bb0bb4d9a2a36p-16, -0x1.6900ca015ad97p-20, 0x1.1bab970a15dc5p-20, 0x1.f0c68975779abp-23, -0x1.4b0d9254ee7edp-27, -0x1.542ce89527964p-27, -0x1.ca6f068e7c11ap-31, 0x1.f2552ff3919dep-33, 0x1.9dc5d92b54ff9p-35, -0x1.1d75e60ed922bp-39, -0x1.8796b95adb626p-40, -0x1.0714df0d87ebep-44, 0x1.f4fcdfe16c2cfp-46, 0x1.cb3264bf2e688p-49, -0x1.b55490b613d13p-52, -0x1.dd166f52442a1p-54, 0x1.c8583df5a55fep-57,
+	0x1.21f373fe810c9p-5, 0x1.d4763ed9ff1f9p-5, 0x1.3224fd63776ddp-5, 0x1.68b70cd9a52ecp-7, 0x1.fe3fdc03bf5fap-13, -0x1.9cac5e1ac3a7ep-11, -0x1.70ff20083783fp-13, 0x1.20d066692f9a8p-16, 0x1.907ae0ddfb08dp-17, 0x1.76bea1c5effe2p-21, -0x1.d9e5f938ce6e2p-22, -0x1.3669c8d799819p-24, 0x1.47d1e15ed4072p-27, 0x1.ba39d6e29c2a7p-29, -0x1.edda79f720326p-35, -0x1.abb783b3392ffp-34, -0x1.46354089c01bcp-38, 0x1.35890020d5a8ep-39, 0x1.03583610f9a08p-42, -0x1.557085edbbbc3p-45, -0x1.e7e58b0b214fp-48, 0x1.1154da71cc62cp-51, 0x1.a173a167fba4dp-53, -0x1.62ef4ca29d11bp-56,
+	0x1.1f45238cd55fcp-3, 0x1.4a09a5dee0dd3p-3, 0x1.fc4165266a5dbp-5, 0x1.e746eabc6e253p-10, -0x1.4220fabbdafcbp-8, -0x1.c200b0817c8bp-11, 0x1.d7ccc9f6a30eap-13, 0x1.334d4dcfa8219p-14, -0x1.71076829315bfp-18, -0x1.0494167e2a2b8p-18, -0x1.92aa69c1a41b6p-26, 0x1.435a65ef28a8bp-23, 0x1.32bf6ea65fd2p-27, -0x1.391fcb4f90bc6p-28, -0x1.0610f2c9809f4p-31, 0x1.e7d3d1bdc3edfp-34, 0x1.29481ae0690fbp-36, -0x1.348e94a580394p-39, -0x1.07f4178cba30ap-41, 0x1.384737b7c48dep-45, 0x1.89d3382ea1944p-47, -0x1.d9c6476feacd5p-52, -0x1.2d7e2d75c3f7p-52, 0x1.cd6a4a0698fd6p-56,
+	0x1.707915a2087c6p-2, 0x1.1317ebdec511ap-2, 0x1.17ee6735f8d7cp-5, -0x1.469623144cfbcp-6, -0x1.0c77e0adc43a9p-8, 0x1.540f4fcb099f8p-10, 0x1.51a3b45833e59p-12, -0x1.1153c2c14e954p-14, -0x1.393e96002aa9dp-16, 0x1.5c0ca6aada12p-19, 0x1.c960508776451p-21, -0x1.685b663c2ea3p-24, -0x1.11bb811310aa7p-25, 0x1.34d38b0ef1fb6p-29, 0x1.144bab1ca34f4p-30, -0x1.ba12ab61054bap-35, -0x1.e0379b4bced05p-36, 0x1.07a60efc718b7p-40, 0x1.6d53177c19412p-41, -0x1.005e3d648f7a1p-46, -0x1.f17697cf1cf13p-47, 0x1.7b0505f3223dep-53, 0x1.69ca9cf3b7f54p-52, -0x1.f75cadd8a6e5ep-56,
+	0x1.47c3752efbc1dp-1, 0x1.1317ebdec511ap-2, -0x1.17ee6735f8d7cp-5, -0x1.469623144cfbcp-6, 0x1.0c77e0adc43a9p-8, 0x1.540f4fcb099f8p-10, -0x1.51a3b45833e59p-12, -0x1.1153c2c14e954p-14, 0x1.393e96002aa9dp-16, 0x1.5c0ca6aada12p-19, -0x1.c960508776451p-21, -0x1.685b663c2ea3p-24, 0x1.11bb811310aa7p-25, 0x1.34d38b0ef1fb6p-29, -0x1.144bab1ca34f4p-30, -0x1.ba12ab61054bap-35, 0x1.e0379b4bced05p-36, 0x1.07a60efc718b7p-40, -0x1.6d53177c19412p-41, -0x1.005e3d648f7a1p-46, 0x1.f17697cf1cf13p-47, 0x1.7b0505f3223dep-53, -0x1.69ca9cf3b7f54p-52, 0x1.cd6a4a0698fd6p-56,
+	0x1.b82eb71ccaa81p-1, 0x1.4a09a5dee0dd3p-3, -0x1.fc4165266a5dbp-5, 0x1.e746eabc6e253p-10, 0x1.4220fabbdafcbp-8, -0x1.c200b0817c8bp-11, -0x1.d7ccc9f6a30eap-13, 0x1.334d4dcfa8219p-14, 0x1.71076829315bfp-18, -0x1.0494167e2a2b8p-18, 0x1.92aa69c1a41b6p-26, 0x1.435a65ef28a8bp-23, -0x1.32bf6ea65fd2p-27, -0x1.391fcb4f90bc6p-28, 0x1.0610f2c9809f4p-31, 0x1.e7d3d1bdc3edfp-34, -0x1.29481ae0690fbp-36, -0x1.348e94a580394p-39, 0x1.07f4178cba30ap-41, 0x1.384737b7c48dep-45, -0x1.89d3382ea1944p-47, -0x1.d9c6476feacd5p-52, 0x1.2d7e2d75c3f7p-52, -0x1.62ef4ca29d11bp-56,
+	0x1.ede0c8c017ef3p-1, 0x1.d4763ed9ff1f9p-5, -0x1.3224fd63776ddp-5, 0x1.68b70cd9a52ecp-7, -0x1.fe3fdc03bf5fap-13, -0x1.9cac5e1ac3a7ep-11, 0x1.70ff20083783fp-13, 0x1.20d066692f9a8p-16, -0x1.907ae0ddfb08dp-17, 0x1.76bea1c5effe2p-21, 0x1.d9e5f938ce6e2p-22, -0x1.3669c8d799819p-24, -0x1.47d1e15ed4072p-27, 0x1.ba39d6e29c2a7p-29, 0x1.edda79f720326p-35, -0x1.abb783b3392ffp-34, 0x1.46354089c01bcp-38, 0x1.35890020d5a8ep-39, -0x1.03583610f9a08p-42, -0x1.557085edbbbc3p-45, 0x1.e7e58b0b214fp-48, 0x1.1154da71cc62cp-51, -0x1.a173a167fba4dp-53, 0x1.c8583df5a55fep-57,
+	0x1.fd398ea536134p-1, 0x1.7db89a95b20b1p-7, -0x1.677ab3ab7e5e1p-7, 0x1.76913f2370a3ap-8, -0x1.a83703fb40bfap-10, 0x1.03efdae7d156bp-13, 0x1.4174c7b0e3c42p-14, -0x1.bb0bb4d9a2a36p-16, 0x1.6900ca015ad97p-20, 0x1.1bab970a15dc5p-20, -0x1.f0c68975779abp-23, -0x1.4b0d9254ee7edp-27, 0x1.542ce89527964p-27, -0x1.ca6f068e7c11ap-31, -0x1.f2552ff3919dep-33, 0x1.9dc5d92b54ff9p-35, 0x1.1d75e60ed922bp-39, -0x1.8796b95adb626p-40, 0x1.0714df0d87ebep-44, 0x1.f4fcdfe16c2cfp-46, -0x1.cb3264bf2e688p-49, -0x1.b55490b613d13p-52, 0x1.dd166f52442a1p-54, -0x1.e6c4865b5b10fp-58,
+	0x1.ffc2aa95b13a6p-1, 0x1.534de90b484c7p-10, -0x1.ac46f351980ffp-10, 0x1.41abec1da67afp-10, -0x1.3728a64ad0ccap-11, 0x1.7c706288cbfe5p-13, -0x1.ce28c3f04f8cdp-16, -0x1.5e5e76bd03c3ep-19, 0x1.34ffb381ab749p-19, -0x1.cc426ca8ad5ccp-22, -0x1.eba119d0b704ep-27, 0x1.6627d9f235b8cp-26, -0x1.a2827f9bf8b07p-29, -0x1.264f42e1264afp-32, 0x1.30c07c5169424p-33, -0x1.59b1e493ad123p-37, -0x1.88d41c2f8cb36p-39, 0x1.41c3cfb650e6bp-41, 0x1.a4ee31af3fdfcp-47, -0x1.08571d5d36813p-46, 0x1.3221987f7445ap-50, 0x1.0665f06d3f172p-52, -0x1.bd4823a21d7c9p-55, 0x1.a9ebf58fefaedp-59,
+	0x1.fffd4bf4b3cc6p-1, 0x1.2eeec6bb8ad9cp-14, -0x1.ef3121878ab82p-14, 0x1.f270a92d76f34p-14, -0x1.5627a73c69d17p-14, 0x1.4d480e5789962p-15, -0x1.ca524c9cac689p-17, 0x1.9a8db7de119cp-19, -0x1.2db750a0b743dp-22, -0x1.49a75988cbc25p-24, 0x1.2b8af2765d78bp-25, -0x1.62f53c5d432e3p-28, -0x1.2fcef622127fap-32, 0x1.10b607060182bp-32, -0x1.37596004c2688p-35, -0x1.26d2550c9edcep-39, 0x1.8380de947521ap-40, -0x1.2ea3f66d96ce8p-43, -0x1.5006e063e6a07p-46, 0x1.918ba54a8c172p-48, -0x1.cb3264bf2e688p-53, -0x1.e11038c848ffcp-54, 0x1.4df61ab9961d7p-56, -0x1.2ca68f386cf3ep-60,
+	0x1.fffff298dcd0fp-1, 0x1.daa8301be7074p-20, -0x1.f0efb9fa85ecep-19, 0x1.463874682e416p-18, -0x1.2bd8a8f924cap-18, 0x1.9757ecb16610dp-19, -0x1.a38786a09aaeep-20, 0x1.48c801bdc53ffp-21, -0x1.7e9a9e9269e83p-23, 0x1.2d8eae7617c61p-25, -0x1.91d18e12b1f97p-29, -0x1.a1a886ee114aap-31, 0x1.726195275c67cp-32, -0x1.d9b0245d6ceb4p-35, -0x1.96cb491b5d2fp-43, 0x1.077aaff0d24fbp-39, -0x1.889ab5e2f4cd9p-42, 0x1.801226258ceefp-48, 0x1.3d3ed0bd7e421p-47, -0x1.a3afbde505cabp-50, -0x1.b02f6de11c9e9p-57, 0x1.4e6dd812c3dc4p-55, -0x1.88e54c9e1a048p-58, 0x1.4e0e663eb1f28p-62,
+	0x1.ffffffe9564cdp-1, 0x1.01df95e670d59p-26, -0x1.5d8abc0a411f8p-25, 0x1.2bfd3ead06671p-24, -0x1.6d40a299d3a43p-24, 0x1.4eb8c9ce89a8ep-24, -0x1.ddbb670b311fcp-25, 0x1.0e906c9ea386p-25, -0x1.ea0fc90fcfbfap-27, 0x1.61248d5c3a15ap-28, -0x1.8b790bf98333cp-30, 0x1.415f7d4265c3ep-32, -0x1.24b8ff6e6e2e1p-35, -0x1.456d26941221cp-39, 0x1.1761bb47a693ap-39, -0x1.ddb07e90e1656p-42, 0x1.1a36f8957f303p-45, 0x1.ec660985799b5p-48, -0x1.4a243b0bf5dcbp-49, 0x1.08964cb821856p-52, 0x1.802a28c819708p-56, -0x1.570112205fdb5p-57, 0x1.5d3d997017207p-60, -0x1.194f7e85a352fp-64,
+	0x1.fffffffff8022p-1, 0x1.e9a5ce0531087p-36, -0x1.c026d4b67eeb4p-34, 0x1.04d0f9608c31bp-32, -0x1.b12e1af255e14p-32, 0x1.10e8ce70991c3p-31, -0x1.0ec0a990941c7p-31, 0x1.b11fce091e454p-32, -0x1.1b839fbbabaf4p-32, 0x1.324bc8bc2180ep-33, -0x1.11af64f3c214ep-34, 0x1.928606ebfefcep-36, -0x1.df885d27c8c33p-38, 0x1.bd51fee592134p-40, -0x1.226a2818e928fp-42, 0x1.3c6193e3b8bc9p-46, 0x1.5865cb8f62ce6p-48, -0x1.13be42c5a0428p-49, 0x1.6827863b97d97p-52, -0x1.ada86a3e1c73bp-57, -0x1.e542ba4020225p-58, 0x1.eb099dfdd75fbp-60, -0x1.b92563801d367p-63, 0x1.519297d390c9fp-67,
+	0x1.ffffffffffffdp-1, 0x1.0ce33639b54e4p-48, -0x1.71b7e5b0e3403p-46, 0x1.4380007578441p-44, -0x1.945dbb4591e2fp-43, 0x1.802187d5aef1fp-42, -0x1.2012ad2a73568p-41, 0x1.5dbdd1b0dc5dfp-41, -0x1.5d9e62d00f47cp-41, 0x1.2324eee16196cp-41, -0x1.97076b2276382p-42, 0x1.dfae0ced777bbp-43, -0x1.dcf89deb4f05dp-44, 0x1.8f01c9c3748c2p-45, -0x1.1674d823ee9e3p-46, 0x1.3e6e5fc4933acp-48, -0x1.1eff7ef77d015p-50, 0x1.7128833048722p-53, -0x1.b02f6de11c9e9p-57, -0x1.61d5fd24176e6p-59, 0x1.2f49b46814157p-60, -0x1.b70b9c5266377p-63, 0x1.60eab600175ecp-66, -0x1.0132bcd1f4692p-70,
+	0x1p+0, 0x1.0ce396db7f853p-70, -0x1.71b8ef6dcf572p-67, 0x1.4381d180156c3p-64, -0x1.946245e01ac74p-62, 0x1.802a28c819708p-60, -0x1.201f9e9613146p-58, 0x1.5ddd4091a9743p-57, -0x1.5ddd4091a9743p-56, 0x1.238db5ceb7e0dp-55, -0x1.982ccb549b078p-55, 0x1.e2637bef9ff1ap-55, -0x1.e2637bef9ff1ap-55, 0x1.982ccb549b078p-55, -0x1.238db5ceb7e0dp-55, 0x1.5ddd4091a9743p-56, -0x1.5ddd4091a9743p-57, 0x1.201f9e9613146p-58, -0x1.802a28c819708p-60, 0x1.946245e01ac74p-62, -0x1.4381d180156c3p-64, 0x1.71b8ef6dcf572p-67, -0x1.0ce396db7f853p-70, 0x1.761b41316381ap-75,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 24 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.f2cf01972f578p-80,
+	0x1.f2cf01972f578p-80, 0x1.761b41316381ap-75, 0x1.0ce396db7f853p-71, 0x1.ecf6949269c97p-69, 0x1.4381d180156c3p-66, 0x1.4381d180156c3p-64, 0x1.001c1b3010f5bp-62, 0x1.4948b53dcca99p-61, 0x1.5ddd4091a9743p-60, 0x1.36fd8eba5dbcap-59, 0x1.d27c56178c9aep-59, 0x1.28dac26c13a86p-58, 0x1.4197a7f5154bcp-58, 0x1.28dac26c13a86p-58, 0x1.d27c56178c9aep-59, 0x1.36fd8eba5dbcap-59, 0x1.5ddd4091a9743p-60, 0x1.4948b53dcca99p-61, 0x1.001c1b3010f5bp-62, 0x1.4381d180156c3p-64, 0x1.4381d180156c3p-66, 0x1.ecf6949269c97p-69, 0x1.0ce396db7f853p-71, 0x1.761b41316381ap-75, -0x1.6684c924aa06ep-75,
+	0x1.f2ced2d3c7315p-56, 0x1.761afb0c47486p-52, 0x1.0ce3320626f2ep-49, 0x1.ecf522d97a5bap-48, 0x1.437fec3d5b2c1p-46, 0x1.437e06faa0ebfp-45, 0x1.00161a876dd54p-44, 0x1.493945d54dc4p-44, 0x1.5dbc73d39bcc5p-44, 0x1.36c33f2f9acbp-44, 0x1.d1cd677743c63p-45, 0x1.27fc1e5a4299ap-45, 0x1.3fb5447925abdp-46, 0x1.25603224cf6d7p-47, 0x1.c78d6c12ff4f4p-49, 0x1.2869ac09a157cp-50, 0x1.3d10828401914p-52, 0x1.0b8b13423649cp-54, 0x1.402321fc15331p-57, 0x1.4381d180156c3p-61, -0x1.4381d180156c3p-63, -0x1.ecf6949269c97p-65, -0x1.501c7c925f667p-67, -0x1.0132bcd1f4692p-70, 0x1.ecf6949269c97p-72,
+	0x1.ffc8135daa3ddp-42, 0x1.ff6a8c9e2c1e6p-39, 0x1.e994ffd1cd6d2p-37, 0x1.2ab526256d3ep-35, 0x1.04bcc16084da2p-34, 0x1.5a62d8fbf0f27p-34, 0x1.6ba10daa28886p-34, 0x1.351c2a2a9d242p-34, 0x1.b070ef2045d71p-35, 0x1.f6cfaba078466p-36, 0x1.e841061533654p-37, 0x1.8bc65980e82c9p-38, 0x1.09d9c736c2b3fp-39, 0x1.2282c1a77366dp-41, 0x1.eeafee63f511p-44, 0x1.23363e7e93767p-46, 0x1.d98bf7e527dbcp-51, -0x1.87aafb9401efbp-52, -0x1.099d26325996dp-53, -0x1.3aa944c594d64p-56, -0x1.10f588c412135p-61, 0x1.ab7dd4d6f7bcbp-62, 0x1.8d080cc01a4aap-64, 0x1.519297d390c9fp-67, -0x1.af57c2001c904p-69,
+	0x1.e6ce08988a7fdp-32, 0x1.6a1b551636b61p-29, 0x1.01652c72ef895p-27, 0x1.d0e38b7fdd2abp-27, 0x1.2af86db3a5daep-26, 0x1.22d929ff1aa51p-26, 0x1.bb73f5978b48ep-27, 0x1.0e928282d19b1p-27, 0x1.0b2e2d0291498p-28, 0x1.abbc272c65ac9p-30, 0x1.12db58deada15p-31, 0x1.132d27077981cp-33, 0x1.8af4266f87c56p-36, 0x1.1e7ff0f7f290ep-39, -0x1.39313a4d0f868p-42, -0x1.50baaafa6a5eap-43, -0x1.f17697cf1cf13p-46, -0x1.c23167ca7dcfdp-50, 0x1.181ebdbc928cbp-51, 0x1.3becc69714ebbp-53, 0x1.bcd280101d74dp-57, -0x1.8120a41262a56p-60, -0x1.2618ed001379ap-61, -0x1.194f7e85a352fp-64, 0x1.0d96d94011da3p-66,
+	0x1.6e61812799218p-24, 0x1.aa0f2f7c8232cp-22, 0x1.d6a0b1c44d43fp-21, 0x1.47a65f5c3df04p-20, 0x1.41887f6d7a27cp-20, 0x1.d69f70b12f2bep-21, 0x1.0896c441f6826p-21, 0x1.ce667ac04a747p-23, 0x1.37defaf3db079p-24, 0x1.38dde55699b59p-26, 0x1.9bdcfaddb4055p-29, 0x1.28d8c5f15da24p-33, -0x1.81902e5f82c86p-34, -0x1.f4e355065b4bbp-36, -0x1.030e77f93d978p-38, 0x1.4520774e406d6p-43, 0x1.4330bfc2ee7c5p-43, 0x1.92b631d8228afp-46, -0x1.812a44e349817p-54, -0x1.50a8506c324b2p-51, -0x1.84aaa74271bcdp-54, 0x1.c956c2d5d5246p-60, 0x1.3195e642143c6p-59, 0x1.4e0e663eb1f28p-62, -0x1.001c1b3010f5bp-64,
+	0x1.6e205ae064273p-18, 0x1.5352148247518p-16, 0x1.278425fb1b3dap-15, 0x1.3fc66d25245b2p-15, 0x1.de0d21e6f40f2p-16, 0x1.02bb4a23df9d7p-16, 0x1.9a6e14bb4446cp-18, 0x1.cfdcfb2e65cc4p-20, 0x1.485bb76ea04c1p-22, 0x1.88955a1ab2e27p-27, -0x1.80588d6979511p-27, -0x1.d83a3f0af53aap-29, -0x1.93aae4aa015bdp-32, 0x1.9ee2cbde6ba21p-35, 0x1.7b56e8a67f001p-36, 0x1.4a69272e900c2p-39, -0x1.1726827eb8964p-42, -0x1.c9162975d504bp-44, -0x1.17aeb170ad854p-47, 0x1.a08c07608b957p-50, 0x1.952c77030ad4ap-52, 0x1.4948b53dcca99p-57, -0x1.d7798f241f38ap-58, -0x1.2ca68f386cf3ep-60, 0x1.802a28c819708p-63,
+	0x1.3cdc70248dfafp-13, 0x1.d50af81490481p-12, 0x1.405efc9f8f9edp-11, 0x1.08e2962614edap-11, 0x1.2284e18acf0bcp-12, 0x1.ad6c4f0538ea5p-14, 0x1.8c287e9937766p-16, 0x1.0a48b426d3d2fp-19, -0x1.7c76174d8aaffp-21, -0x1.34308c13576f2p-22, -0x1.2e46de9ec8569p-25, 0x1.333c867c082a2p-28, 0x1.29ee1b5baf02ep-29, 0x1.d459637fa5631p-33, -0x1.440305a8a907dp-35, -0x1.981859f1b52f5p-37, -0x1.0ffd4f50855bp-41, 0x1.1409ab0c21898p-42, 0x1.614444ba696cbp-45, -0x1.cc34303220799p-50, -0x1.23c805597ad26p-50, -0x1.14f9d31dfb7bfp-54, 0x1.164d1645526dep-56, 0x1.a9ebf58fefaedp-59, -0x1.d27c56178c9aep-62,
+	0x1.15b40fcd2805bp-9, 0x1.448df83d938f7p-8, 0x1.534edd7449018p-8, 0x1.97ed1c570f257p-9, 0x1.2626441c0704ep-10, 0x1.add11aefc08eep-13, -0x1.4156bf029c69bp-17, -0x1.f36c89ea3f9abp-17, -0x1.8f3fe602022afp-19, 0x1.c8e1171ff8ff5p-24, 0x1.3efcf4f69a8f9p-23, 0x1.52f1cb86201edp-26, -0x1.5d1f176873501p-29, -0x1.11b98f1152504p-30, -0x1.63bf4efd9c7bap-35, 0x1.ac4fd357fd445p-36, 0x1.f432525040441p-39, -0x1.3f31e2f02fec4p-42, -0x1.eb15e4a1ca851p-44, -0x1.6277be0cd7791p-49, 0x1.3221987f7445ap-49, 0x1.d27c56178c9aep-53, -0x1.fce4bb026ad78p-56, -0x1.e6c4865b5b10fp-58, 0x1.d27c56178c9aep-61,
+	0x1.10f77216a748dp-6, 0x1.eb18bca3c4808p-6, 0x1.75081834929cdp-6, 0x1.205dc0a0ca731p-7, 0x1.5adcda8fd9b9ep-10, -0x1.2058d3956d762p-12, -0x1.3e70388dcffe6p-13, -0x1.dc0ad2b656045p-17, 0x1.6dee0da1691efp-18, 0x1.8c17fac577755p-20, -0x1.342746e392c4p-25, -0x1.06a64512bde71p-24, -0x1.66b57366a4ecfp-28, 0x1.9b12f26ec2397p-30, 0x1.3e30e9714663fp-32, -0x1.4b9fe591c96cp-36, -0x1.3d4d382471d7ep-37, -0x1.595eb00461049p-43, 0x1.c12e8b6202fabp-43, 0x1.11c7f0b2d3e14p-46, -0x1.d98bf7e527dbcp-49, -0x1.1154da71cc62cp-51, 0x1.65d0d37db31f9p-55, 0x1.c8583df5a55fep-57, -0x1.84bcf268f52bcp-60,
+	0x1.43f5f4ca421e2p-4, 0x1.ad908d1a6a394p-4, 0x1.a9d82c50c22aap-5, 0x1.0d7b3503ee953p-7, -0x1.2bce2f82176a2p-9, -0x1.0e75947cc72c9p-10, -0x1.8e2e199d09767p-17, 0x1.e07485b633c17p-15, 0x1.d632686ab875fp-18, -0x1.03ff5ea4b36dbp-19, -0x1.ebdfddf173787p-22, 0x1.4659b071f7662p-25, 0x1.3f0a3191f8f1p-26, -0x1.9ef521e18defp-35, -0x1.314743dbed0a1p-31, -0x1.ed3a39f3525e1p-36, 0x1.c9c5aab87e8efp-37, 0x1.648ca0f39f246p-40, -0x1.12b525ad7b80fp-42, -0x1.4b796df6eaf34p-45, 0x1.057cb2423350dp-48, 0x1.e5ec2f033276bp-51, -0x1.7311730718928p-55, -0x1.62ef4ca29d11bp-56, 0x1.101ddce31205p-59,
+	0x1.ed5f1c6b7b5b4p-3, 0x1.c1ad07b73b99p-3, 0x1.b84c63bd528cp-5, -0x1.306ea7eb4207ep-7, -0x1.650a91c013de1p-8, 0x1.576d738d5e73fp-13, 0x1.78b51ab285436p-12, 0x1.d118463ae6413p-17, -0x1.225088487b5b7p-16, -0x1.88ddbfedfd05p-20, 0x1.5baebb0fac2ap-21, 0x1.55c9eb840278bp-24, -0x1.4fb010b37ffc2p-26, -0x1.af490fad1e4d8p-29, 0x1.0b2a099f7345cp-31, 0x1.b27be2ac25fedp-34, -0x1.626e93b72349ep-37, -0x1.6de1bf23de0f1p-39, 0x1.877335751638p-43, 0x1.08f58d11309bbp-44, -0x1.605eab8809d58p-49, -0x1.5389d55479577p-50, 0x1.e2637bef9ff1ap-56, 0x1.cd6a4a0698fd6p-56, -0x1.4197a7f5154bcp-59,
+	0x1p-1, 0x1.1f0dd4bbef074p-2, 0x0p+0, -0x1.753ddef2a11fbp-6, 0x0p+0, 0x1.ad8c9aafa05dbp-10, 0x0p+0, -0x1.81dfa9895fe1dp-14, 0x0p+0, 0x1.167085557b41ap-18, 0x0p+0, -0x1.4ca3234b3ebdep-23, 0x0p+0, 0x1.50e6c63ed96f6p-28, 0x0p+0, -0x1.26b71ceb58dd1p-33, 0x0p+0, 0x1.c3f819b0c2a5fp-39, 0x0p+0, -0x1.33a449abdf5f4p-44, 0x0p+0, 0x1.7b0505f3223dep-50, 0x0p+0, -0x1.f75cadd8a6e5ep-56, 0x1.4197a7f5154bcp-59,
+	0x1.84a838e521293p-1, 0x1.c1ad07b73b99p-3, -0x1.b84c63bd528cp-5, -0x1.306ea7eb4207ep-7, 0x1.650a91c013de1p-8, 0x1.576d738d5e73fp-13, -0x1.78b51ab285436p-12, 0x1.d118463ae6413p-17, 0x1.225088487b5b7p-16, -0x1.88ddbfedfd05p-20, -0x1.5baebb0fac2ap-21, 0x1.55c9eb840278bp-24, 0x1.4fb010b37ffc2p-26, -0x1.af490fad1e4d8p-29, -0x1.0b2a099f7345cp-31, 0x1.b27be2ac25fedp-34, 0x1.626e93b72349ep-37, -0x1.6de1bf23de0f1p-39, -0x1.877335751638p-43, 0x1.08f58d11309bbp-44, 0x1.605eab8809d58p-49, -0x1.5389d55479577p-50, -0x1.e2637bef9ff1ap-56, 0x1.cd6a4a0698fd6p-56, -0x1.101ddce31205p-59,
+	0x1.d7814166b7bc4p-1, 0x1.ad908d1a6a394p-4, -0x1.a9d82c50c22aap-5, 0x1.0d7b3503ee953p-7, 0x1.2bce2f82176a2p-9, -0x1.0e75947cc72c9p-10, 0x1.8e2e199d09767p-17, 0x1.e07485b633c17p-15, -0x1.d632686ab875fp-18, -0x1.03ff5ea4b36dbp-19, 0x1.ebdfddf173787p-22, 0x1.4659b071f7662p-25, -0x1.3f0a3191f8f1p-26, -0x1.9ef521e18defp-35, 0x1.314743dbed0a1p-31, -0x1.ed3a39f3525e1p-36, -0x1.c9c5aab87e8efp-37, 0x1.648ca0f39f246p-40, 0x1.12b525ad7b80fp-42, -0x1.4b796df6eaf34p-45, -0x1.057cb2423350dp-48, 0x1.e5ec2f033276bp-51, 0x1.7311730718928p-55, -0x1.62ef4ca29d11bp-56, 0x1.84bcf268f52bcp-60,
+	0x1.f778446f4ac5cp-1, 0x1.eb18bca3c4808p-6, -0x1.75081834929cdp-6, 0x1.205dc0a0ca731p-7, -0x1.5adcda8fd9b9ep-10, -0x1.2058d3956d762p-12, 0x1.3e70388dcffe6p-13, -0x1.dc0ad2b656045p-17, -0x1.6dee0da1691efp-18, 0x1.8c17fac577755p-20, 0x1.342746e392c4p-25, -0x1.06a64512bde71p-24, 0x1.66b57366a4ecfp-28, 0x1.9b12f26ec2397p-30, -0x1.3e30e9714663fp-32, -0x1.4b9fe591c96cp-36, 0x1.3d4d382471d7ep-37, -0x1.595eb00461049p-43, -0x1.c12e8b6202fabp-43, 0x1.11c7f0b2d3e14p-46, 0x1.d98bf7e527dbcp-49, -0x1.1154da71cc62cp-51, -0x1.65d0d37db31f9p-55, 0x1.c8583df5a55fep-57, -0x1.d27c56178c9aep-61,
+	0x1.feea4bf032d8p-1, 0x1.448df83d938f7p-8, -0x1.534edd7449018p-8, 0x1.97ed1c570f257p-9, -0x1.2626441c0704ep-10, 0x1.add11aefc08eep-13, 0x1.4156bf029c69bp-17, -0x1.f36c89ea3f9abp-17, 0x1.8f3fe602022afp-19, 0x1.c8e1171ff8ff5p-24, -0x1.3efcf4f69a8f9p-23, 0x1.52f1cb86201edp-26, 0x1.5d1f176873501p-29, -0x1.11b98f1152504p-30, 0x1.63bf4efd9c7bap-35, 0x1.ac4fd357fd445p-36, -0x1.f432525040441p-39, -0x1.3f31e2f02fec4p-42, 0x1.eb15e4a1ca851p-44, -0x1.6277be0cd7791p-49, -0x1.3221987f7445ap-49, 0x1.d27c56178c9aep-53, 0x1.fce4bb026ad78p-56, -0x1.e6c4865b5b10fp-58, 0x1.d27c56178c9aep-62,
+	0x1.ffec3238fdb72p-1, 0x1.d50af81490481p-12, -0x1.405efc9f8f9edp-11, 0x1.08e2962614edap-11, -0x1.2284e18acf0bcp-12, 0x1.ad6c4f0538ea5p-14, -0x1.8c287e9937766p-16, 0x1.0a48b426d3d2fp-19, 0x1.7c76174d8aaffp-21, -0x1.34308c13576f2p-22, 0x1.2e46de9ec8569p-25, 0x1.333c867c082a2p-28, -0x1.29ee1b5baf02ep-29, 0x1.d459637fa5631p-33, 0x1.440305a8a907dp-35, -0x1.981859f1b52f5p-37, 0x1.0ffd4f50855bp-41, 0x1.1409ab0c21898p-42, -0x1.614444ba696cbp-45, -0x1.cc34303220799p-50, 0x1.23c805597ad26p-50, -0x1.14f9d31dfb7bfp-54, -0x1.164d1645526dep-56, 0x1.a9ebf58fefaedp-59, -0x1.802a28c819708p-63,
+	0x1.ffff48efd28fdp-1, 0x1.5352148247518p-16, -0x1.278425fb1b3dap-15, 0x1.3fc66d25245b2p-15, -0x1.de0d21e6f40f2p-16, 0x1.02bb4a23df9d7p-16, -0x1.9a6e14bb4446cp-18, 0x1.cfdcfb2e65cc4p-20, -0x1.485bb76ea04c1p-22, 0x1.88955a1ab2e27p-27, 0x1.80588d6979511p-27, -0x1.d83a3f0af53aap-29, 0x1.93aae4aa015bdp-32, 0x1.9ee2cbde6ba21p-35, -0x1.7b56e8a67f001p-36, 0x1.4a69272e900c2p-39, 0x1.1726827eb8964p-42, -0x1.c9162975d504bp-44, 0x1.17aeb170ad854p-47, 0x1.a08c07608b957p-50, -0x1.952c77030ad4ap-52, 0x1.4948b53dcca99p-57, 0x1.d7798f241f38ap-58, -0x1.2ca68f386cf3ep-60, 0x1.001c1b3010f5bp-64,
+	0x1.fffffd233cfdbp-1, 0x1.aa0f2f7c8232cp-22, -0x1.d6a0b1c44d43fp-21, 0x1.47a65f5c3df04p-20, -0x1.41887f6d7a27cp-20, 0x1.d69f70b12f2bep-21, -0x1.0896c441f6826p-21, 0x1.ce667ac04a747p-23, -0x1.37defaf3db079p-24, 0x1.38dde55699b59p-26, -0x1.9bdcfaddb4055p-29, 0x1.28d8c5f15da24p-33, 0x1.81902e5f82c86p-34, -0x1.f4e355065b4bbp-36, 0x1.030e77f93d978p-38, 0x1.4520774e406d6p-43, -0x1.4330bfc2ee7c5p-43, 0x1.92b631d8228afp-46, 0x1.812a44e349817p-54, -0x1.50a8506c324b2p-51, 0x1.84aaa74271bcdp-54, 0x1.c956c2d5d5246p-60, -0x1.3195e642143c6p-59, 0x1.4e0e663eb1f28p-62, -0x1.0d96d94011da3p-66,
+	0x1.fffffffc3263fp-1, 0x1.6a1b551636b61p-29, -0x1.01652c72ef895p-27, 0x1.d0e38b7fdd2abp-27, -0x1.2af86db3a5daep-26, 0x1.22d929ff1aa51p-26, -0x1.bb73f5978b48ep-27, 0x1.0e928282d19b1p-27, -0x1.0b2e2d0291498p-28, 0x1.abbc272c65ac9p-30, -0x1.12db58deada15p-31, 0x1.132d27077981cp-33, -0x1.8af4266f87c56p-36, 0x1.1e7ff0f7f290ep-39, 0x1.39313a4d0f868p-42, -0x1.50baaafa6a5eap-43, 0x1.f17697cf1cf13p-46, -0x1.c23167ca7dcfdp-50, -0x1.181ebdbc928cbp-51, 0x1.3becc69714ebbp-53, -0x1.bcd280101d74dp-57, -0x1.8120a41262a56p-60, 0x1.2618ed001379ap-61, -0x1.194f7e85a352fp-64, 0x1.af57c2001c904p-69,
+	0x1.ffffffffff002p-1, 0x1.ff6a8c9e2c1e6p-39, -0x1.e994ffd1cd6d2p-37, 0x1.2ab526256d3ep-35, -0x1.04bcc16084da2p-34, 0x1.5a62d8fbf0f27p-34, -0x1.6ba10daa28886p-34, 0x1.351c2a2a9d242p-34, -0x1.b070ef2045d71p-35, 0x1.f6cfaba078466p-36, -0x1.e841061533654p-37, 0x1.8bc65980e82c9p-38, -0x1.09d9c736c2b3fp-39, 0x1.2282c1a77366dp-41, -0x1.eeafee63f511p-44, 0x1.23363e7e93767p-46, -0x1.d98bf7e527dbcp-51, -0x1.87aafb9401efbp-52, 0x1.099d26325996dp-53, -0x1.3aa944c594d64p-56, 0x1.10f588c412135p-61, 0x1.ab7dd4d6f7bcbp-62, -0x1.8d080cc01a4aap-64, 0x1.519297d390c9fp-67, -0x1.ecf6949269c97p-72,
+	0x1p+0, 0x1.761afb0c47486p-52, -0x1.0ce3320626f2ep-49, 0x1.ecf522d97a5bap-48, -0x1.437fec3d5b2c1p-46, 0x1.437e06faa0ebfp-45, -0x1.00161a876dd54p-44, 0x1.493945d54dc4p-44, -0x1.5dbc73d39bcc5p-44, 0x1.36c33f2f9acbp-44, -0x1.d1cd677743c63p-45, 0x1.27fc1e5a4299ap-45, -0x1.3fb5447925abdp-46, 0x1.25603224cf6d7p-47, -0x1.c78d6c12ff4f4p-49, 0x1.2869ac09a157cp-50, -0x1.3d10828401914p-52, 0x1.0b8b13423649cp-54, -0x1.402321fc15331p-57, 0x1.4381d180156c3p-61, 0x1.4381d180156c3p-63, -0x1.ecf6949269c97p-65, 0x1.501c7c925f667p-67, -0x1.0132bcd1f4692p-70, 0x1.6684c924aa06ep-75,
+	0x1p+0, 0x1.761b41316381ap-75, -0x1.0ce396db7f853p-71, 0x1.ecf6949269c97p-69, -0x1.4381d180156c3p-66, 0x1.4381d180156c3p-64, -0x1.001c1b3010f5bp-62, 0x1.4948b53dcca99p-61, -0x1.5ddd4091a9743p-60, 0x1.36fd8eba5dbcap-59, -0x1.d27c56178c9aep-59, 0x1.28dac26c13a86p-58, -0x1.4197a7f5154bcp-58, 0x1.28dac26c13a86p-58, -0x1.d27c56178c9aep-59, 0x1.36fd8eba5dbcap-59, -0x1.5ddd4091a9743p-60, 0x1.4948b53dcca99p-61, -0x1.001c1b3010f5bp-62, 0x1.4381d180156c3p-64, -0x1.4381d180156c3p-66, 0x1.ecf6949269c97p-69, -0x1.0ce396db7f853p-71, 0x1.761b41316381ap-75, -0x1.f2cf01972f578p-80,
+	0x1p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+};
+
+static const double LR_gsn_pdfd[5524] = {
+/* 1 */
+	0x1p+0, 0x0p+0,
+	0x0p+0, 0x0p+0,
+/* 2 */
+	0x0p+0, 0x1p+0, 0x0p+0,
+	0x1p+0, -0x1p+0, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0,
+/* 3 */
+	0x0p+0, 0x0p+0, 0x1p-1, 0x0p+0,
+	0x1p-1, 0x1p+0, -0x1p+0, 0x0p+0,
+	0x1p-1, -0x1p+0, 0x1p-1, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 4 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x1.5555555555555p-3, 0x0p+0,
+	0x1.5555555555555p-3, 0x1p-1, 0x1p-1, -0x1p-1, 0x0p+0,
+	0x1.5555555555555p-1, 0x0p+0, -0x1p+0, 0x1p-1, 0x0p+0,
+	0x1.5555555555555p-3, -0x1p-1, 0x1p-1, -0x1.5555555555555p-3, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 5 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.5555555555555p-5, 0x0p+0,
+	0x1.5555555555555p-5, 0x1.5555555555555p-3, 0x1p-2, 0x1.5555555555555p-3, -0x1.5555555555555p-3, 0x0p+0,
+	0x1.d555555555555p-2, 0x1p-1, -0x1p-2, -0x1p-1, 0x1p-2, 0x0p+0,
+	0x1.d555555555555p-2, -0x1p-1, -0x1p-2, 0x1p-1, -0x1.5555555555555p-3, 0x0p+0,
+	0x1.5555555555555p-5, -0x1.5555555555555p-3, 0x1p-2, -0x1.5555555555555p-3, 0x1.5555555555555p-5, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 6 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.1111111111111p-7, 0x0p+0,
+	0x1.1111111111111p-7, 0x1.5555555555555p-5, 0x1.5555555555555p-4, 0x1.5555555555555p-4, 0x1.5555555555555p-5, -0x1.5555555555555p-5, 0x0p+0,
+	0x1.bbbbbbbbbbbbcp-3, 0x1.aaaaaaaaaaaabp-2, 0x1.5555555555555p-3, -0x1.5555555555555p-3, -0x1.5555555555555p-3, 0x1.5555555555555p-4, 0x0p+0,
+	0x1.199999999999ap-1, 0x0p+0, -0x1p-1, 0x0p+0, 0x1p-2, -0x1.5555555555555p-4, 0x0p+0,
+	0x1.bbbbbbbbbbbbcp-3, -0x1.aaaaaaaaaaaabp-2, 0x1.5555555555555p-3, 0x1.5555555555555p-3, -0x1.5555555555555p-3, 0x1.5555555555555p-5, 0x0p+0,
+	0x1.1111111111111p-7, -0x1.5555555555555p-5, 0x1.5555555555555p-4, -0x1.5555555555555p-4, 0x1.5555555555555p-5, -0x1.1111111111111p-7, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 7 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.6c16c16c16c17p-10, 0x0p+0,
+	0x1.6c16c16c16c17p-10, 0x1.1111111111111p-7, 0x1.5555555555555p-6, 0x1.c71c71c71c71cp-6, 0x1.5555555555555p-6, 0x1.1111111111111p-7, -0x1.1111111111111p-7, 0x0p+0,
+	0x1.4444444444444p-4, 0x1.aaaaaaaaaaaabp-3, 0x1.8p-3, 0x1.c71c71c71c71cp-6, -0x1p-4, -0x1.5555555555555p-5, 0x1.5555555555555p-6, 0x0p+0,
+	0x1.ad82d82d82d83p-2, 0x1.5555555555555p-2, -0x1.aaaaaaaaaaaabp-3, -0x1.c71c71c71c71cp-3, 0x1.5555555555555p-5, 0x1.5555555555555p-4, -0x1.c71c71c71c71cp-6, 0x0p+0,
+	0x1.ad82d82d82d83p-2, -0x1.5555555555555p-2, -0x1.aaaaaaaaaaaabp-3, 0x1.c71c71c71c71cp-3, 0x1.5555555555555p-5, -0x1.5555555555555p-4, 0x1.5555555555555p-6, 0x0p+0,
+	0x1.4444444444444p-4, -0x1.aaaaaaaaaaaabp-3, 0x1.8p-3, -0x1.c71c71c71c71cp-6, -0x1p-4, 0x1.5555555555555p-5, -0x1.1111111111111p-7, 0x0p+0,
+	0x1.6c16c16c16c17p-10, -0x1.1111111111111p-7, 0x1.5555555555555p-6, -0x1.c71c71c71c71cp-6, 0x1.5555555555555p-6, -0x1.1111111111111p-7, 0x1.6c16c16c16c17p-10, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 8 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.a01a01a01a01ap-13, 0x0p+0,
+	0x1.a01a01a01a01ap-13, 0x1.6c16c16c16c17p-10, 0x1.1111111111111p-8, 0x1.c71c71c71c71cp-8, 0x1.c71c71c71c71cp-8, 0x1.1111111111111p-8, 0x1.6c16c16c16c17p-10, -0x1.6c16c16c16c17p-10, 0x0p+0,
+	0x1.8618618618618p-6, 0x1.3e93e93e93e94p-4, 0x1.999999999999ap-4, 0x1.c71c71c71c71cp-5, 0x0p+0, -0x1.1111111111111p-6, -0x1.1111111111111p-7, 0x1.1111111111111p-8, 0x0p+0,
+	0x1.e3f63f63f63f6p-3, 0x1.5c71c71c71c72p-2, 0x1p-4, -0x1.0e38e38e38e39p-3, -0x1p-4, 0x1.5555555555555p-6, 0x1.5555555555555p-6, -0x1.c71c71c71c71cp-8, 0x0p+0,
+	0x1.eadeadeadeadfp-2, 0x0p+0, -0x1.5555555555555p-2, 0x0p+0, 0x1.c71c71c71c71cp-4, 0x0p+0, -0x1.c71c71c71c71cp-6, 0x1.c71c71c71c71cp-8, 0x0p+0,
+	0x1.e3f63f63f63f6p-3, -0x1.5c71c71c71c72p-2, 0x1p-4, 0x1.0e38e38e38e39p-3, -0x1p-4, -0x1.5555555555555p-6, 0x1.5555555555555p-6, -0x1.1111111111111p-8, 0x0p+0,
+	0x1.8618618618618p-6, -0x1.3e93e93e93e94p-4, 0x1.999999999999ap-4, -0x1.c71c71c71c71cp-5, 0x0p+0, 0x1.1111111111111p-6, -0x1.1111111111111p-7, 0x1.6c16c16c16c17p-10, 0x0p+0,
+	0x1.a01a01a01a01ap-13, -0x1.6c16c16c16c17p-10, 0x1.1111111111111p-8, -0x1.c71c71c71c71cp-8, 0x1.c71c71c71c71cp-8, -0x1.1111111111111p-8, 0x1.6c16c16c16c17p-10, -0x1.a01a01a01a01ap-13, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 9 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.a01a01a01a01ap-16, 0x0p+0,
+	0x1.a01a01a01a01ap-16, 0x1.a01a01a01a01ap-13, 0x1.6c16c16c16c17p-11, 0x1.6c16c16c16c17p-10, 0x1.c71c71c71c71cp-10, 0x1.6c16c16c16c17p-10, 0x1.6c16c16c16c17p-11, 0x1.a01a01a01a01ap-13, -0x1.a01a01a01a01ap-13, 0x0p+0,
+	0x1.9179179179179p-8, 0x1.82d82d82d82d8p-6, 0x1.38e38e38e38e4p-5, 0x1.05b05b05b05bp-5, 0x1.8e38e38e38e39p-7, -0x1.6c16c16c16c17p-10, -0x1.c71c71c71c71cp-9, -0x1.6c16c16c16c17p-10, 0x1.6c16c16c16c17p-11, 0x0p+0,
+	0x1.b41d41d41d41dp-4, 0x1.b333333333333p-3, 0x1.0cccccccccccdp-3, -0x1.999999999999ap-7, -0x1.8p-5, -0x1.999999999999ap-7, 0x1.999999999999ap-8, 0x1.1111111111111p-8, -0x1.6c16c16c16c17p-10, 0x0p+0,
+	0x1.8cac4ac4ac4acp-2, 0x1.f1c71c71c71c7p-3, -0x1.5c71c71c71c72p-3, -0x1.0e38e38e38e39p-3, 0x1.0e38e38e38e39p-5, 0x1.1c71c71c71c72p-5, -0x1.c71c71c71c71cp-9, -0x1.c71c71c71c71cp-8, 0x1.c71c71c71c71cp-10, 0x0p+0,
+	0x1.8cac4ac4ac4acp-2, -0x1.f1c71c71c71c7p-3, -0x1.5c71c71c71c72p-3, 0x1.0e38e38e38e39p-3, 0x1.0e38e38e38e39p-5, -0x1.1c71c71c71c72p-5, -0x1.c71c71c71c71cp-9, 0x1.c71c71c71c71cp-8, -0x1.6c16c16c16c17p-10, 0x0p+0,
+	0x1.b41d41d41d41dp-4, -0x1.b333333333333p-3, 0x1.0cccccccccccdp-3, 0x1.999999999999ap-7, -0x1.8p-5, 0x1.999999999999ap-7, 0x1.999999999999ap-8, -0x1.1111111111111p-8, 0x1.6c16c16c16c17p-11, 0x0p+0,
+	0x1.9179179179179p-8, -0x1.82d82d82d82d8p-6, 0x1.38e38e38e38e4p-5, -0x1.05b05b05b05bp-5, 0x1.8e38e38e38e39p-7, 0x1.6c16c16c16c17p-10, -0x1.c71c71c71c71cp-9, 0x1.6c16c16c16c17p-10, -0x1.a01a01a01a01ap-13, 0x0p+0,
+	0x1.a01a01a01a01ap-16, -0x1.a01a01a01a01ap-13, 0x1.6c16c16c16c17p-11, -0x1.6c16c16c16c17p-10, 0x1.c71c71c71c71cp-10, -0x1.6c16c16c16c17p-10, 0x1.6c16c16c16c17p-11, -0x1.a01a01a01a01ap-13, 0x1.a01a01a01a01ap-16, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 10 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.71de3a556c734p-19, 0x0p+0,
+	0x1.71de3a556c734p-19, 0x1.a01a01a01a01ap-16, 0x1.a01a01a01a01ap-14, 0x1.e573ac901e574p-13, 0x1.6c16c16c16c17p-12, 0x1.6c16c16c16c17p-12, 0x1.e573ac901e574p-13, 0x1.a01a01a01a01ap-14, 0x1.a01a01a01a01ap-16, -0x1.a01a01a01a01ap-16, 0x0p+0,
+	0x1.6aa4e331c155p-10, 0x1.8fd8fd8fd8fd9p-8, 0x1.7f97f97f97f98p-7, 0x1.999999999999ap-7, 0x1.f49f49f49f49fp-8, 0x1.1111111111111p-9, -0x1.e573ac901e574p-12, -0x1.3813813813814p-11, -0x1.a01a01a01a01ap-13, 0x1.a01a01a01a01ap-14, 0x0p+0,
+	0x1.49c66382a9f1cp-5, 0x1.9b05b05b05b06p-4, 0x1.82d82d82d82d8p-4, 0x1.fc3518a6dfc35p-6, -0x1.6c16c16c16c17p-7, -0x1.82d82d82d82d8p-7, -0x1.e573ac901e574p-10, 0x1.6c16c16c16c17p-10, 0x1.6c16c16c16c17p-11, -0x1.e573ac901e574p-13, 0x0p+0,
+	0x1.f1f83bf58674ep-3, 0x1.1fa4fa4fa4fa5p-2, 0x1.f49f49f49f49fp-7, -0x1.9b7f0d4629b7fp-4, -0x1.e93e93e93e93fp-6, 0x1.05b05b05b05bp-6, 0x1.01e573ac901e5p-7, -0x1.6c16c16c16c17p-10, -0x1.6c16c16c16c17p-10, 0x1.6c16c16c16c17p-12, 0x0p+0,
+	0x1.b8bf6f853136ap-2, 0x0p+0, -0x1.f1c71c71c71c7p-3, 0x0p+0, 0x1.0e38e38e38e39p-4, 0x0p+0, -0x1.7b425ed097b42p-7, 0x0p+0, 0x1.c71c71c71c71cp-10, -0x1.6c16c16c16c17p-12, 0x0p+0,
+	0x1.f1f83bf58674ep-3, -0x1.1fa4fa4fa4fa5p-2, 0x1.f49f49f49f49fp-7, 0x1.9b7f0d4629b7fp-4, -0x1.e93e93e93e93fp-6, -0x1.05b05b05b05bp-6, 0x1.01e573ac901e5p-7, 0x1.6c16c16c16c17p-10, -0x1.6c16c16c16c17p-10, 0x1.e573ac901e574p-13, 0x0p+0,
+	0x1.49c66382a9f1cp-5, -0x1.9b05b05b05b06p-4, 0x1.82d82d82d82d8p-4, -0x1.fc3518a6dfc35p-6, -0x1.6c16c16c16c17p-7, 0x1.82d82d82d82d8p-7, -0x1.e573ac901e574p-10, -0x1.6c16c16c16c17p-10, 0x1.6c16c16c16c17p-11, -0x1.a01a01a01a01ap-14, 0x0p+0,
+	0x1.6aa4e331c155p-10, -0x1.8fd8fd8fd8fd9p-8, 0x1.7f97f97f97f98p-7, -0x1.999999999999ap-7, 0x1.f49f49f49f49fp-8, -0x1.1111111111111p-9, -0x1.e573ac901e574p-12, 0x1.3813813813814p-11, -0x1.a01a01a01a01ap-13, 0x1.a01a01a01a01ap-16, 0x0p+0,
+	0x1.71de3a556c734p-19, -0x1.a01a01a01a01ap-16, 0x1.a01a01a01a01ap-14, -0x1.e573ac901e574p-13, 0x1.6c16c16c16c17p-12, -0x1.6c16c16c16c17p-12, 0x1.e573ac901e574p-13, -0x1.a01a01a01a01ap-14, 0x1.a01a01a01a01ap-16, -0x1.71de3a556c734p-19, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 11 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.27e4fb7789f5cp-22, 0x0p+0,
+	0x1.27e4fb7789f5cp-22, 0x1.71de3a556c734p-19, 0x1.a01a01a01a01ap-17, 0x1.1566abc011567p-15, 0x1.e573ac901e574p-15, 0x1.23456789abcdfp-14, 0x1.e573ac901e574p-15, 0x1.1566abc011567p-15, 0x1.a01a01a01a01ap-17, 0x1.71de3a556c734p-19, -0x1.71de3a556c734p-19, 0x0p+0,
+	0x1.24b745c4013a6p-12, 0x1.69ebf414969ecp-10, 0x1.8e38e38e38e39p-9, 0x1.fb1fb1fb1fb2p-9, 0x1.9203cae759204p-9, 0x1.7e4b17e4b17e5p-10, 0x1.2f684bda12f68p-12, -0x1.a01a01a01a01ap-14, -0x1.6c16c16c16c17p-14, -0x1.a01a01a01a01ap-16, 0x1.a01a01a01a01ap-17, 0x0p+0,
+	0x1.affe8e21c5aa9p-7, 0x1.3e713c691be71p-5, 0x1.8208208208208p-5, 0x1.c3dc3dc3dc3dcp-6, 0x1.2f684bda12f68p-8, -0x1.eb851eb851eb8p-9, -0x1.2f684bda12f68p-9, -0x1.a01a01a01a01ap-13, 0x1.041041041041p-12, 0x1.a01a01a01a01ap-14, -0x1.1566abc011567p-15, 0x0p+0,
+	0x1.00e602ff79ec4p-3, 0x1.9f86a314dbf87p-3, 0x1.71c71c71c71c7p-4, -0x1.b05b05b05b05bp-6, -0x1.0d4629b7f0d46p-5, -0x1.eb851eb851eb8p-9, 0x1.2f684bda12f68p-8, 0x1.6c16c16c16c17p-10, -0x1.6c16c16c16c17p-12, -0x1.e573ac901e574p-13, 0x1.e573ac901e574p-15, 0x0p+0,
+	0x1.71c3c9bf7424cp-2, 0x1.7f86a314dbf87p-3, -0x1.1fa4fa4fa4fa5p-3, -0x1.60b60b60b60b6p-4, 0x1.9b7f0d4629b7fp-6, 0x1.3a06d3a06d3ap-6, -0x1.5ceb240795cebp-9, -0x1.6c16c16c16c17p-9, 0x1.6c16c16c16c17p-13, 0x1.6c16c16c16c17p-12, -0x1.23456789abcdfp-14, 0x0p+0,
+	0x1.71c3c9bf7424cp-2, -0x1.7f86a314dbf87p-3, -0x1.1fa4fa4fa4fa5p-3, 0x1.60b60b60b60b6p-4, 0x1.9b7f0d4629b7fp-6, -0x1.3a06d3a06d3ap-6, -0x1.5ceb240795cebp-9, 0x1.6c16c16c16c17p-9, 0x1.6c16c16c16c17p-13, -0x1.6c16c16c16c17p-12, 0x1.e573ac901e574p-15, 0x0p+0,
+	0x1.00e602ff79ec4p-3, -0x1.9f86a314dbf87p-3, 0x1.71c71c71c71c7p-4, 0x1.b05b05b05b05bp-6, -0x1.0d4629b7f0d46p-5, 0x1.eb851eb851eb8p-9, 0x1.2f684bda12f68p-8, -0x1.6c16c16c16c17p-10, -0x1.6c16c16c16c17p-12, 0x1.e573ac901e574p-13, -0x1.1566abc011567p-15, 0x0p+0,
+	0x1.affe8e21c5aa9p-7, -0x1.3e713c691be71p-5, 0x1.8208208208208p-5, -0x1.c3dc3dc3dc3dcp-6, 0x1.2f684bda12f68p-8, 0x1.eb851eb851eb8p-9, -0x1.2f684bda12f68p-9, 0x1.a01a01a01a01ap-13, 0x1.041041041041p-12, -0x1.a01a01a01a01ap-14, 0x1.a01a01a01a01ap-17, 0x0p+0,
+	0x1.24b745c4013a6p-12, -0x1.69ebf414969ecp-10, 0x1.8e38e38e38e39p-9, -0x1.fb1fb1fb1fb2p-9, 0x1.9203cae759204p-9, -0x1.7e4b17e4b17e5p-10, 0x1.2f684bda12f68p-12, 0x1.a01a01a01a01ap-14, -0x1.6c16c16c16c17p-14, 0x1.a01a01a01a01ap-16, -0x1.71de3a556c734p-19, 0x0p+0,
+	0x1.27e4fb7789f5cp-22, -0x1.71de3a556c734p-19, 0x1.a01a01a01a01ap-17, -0x1.1566abc011567p-15, 0x1.e573ac901e574p-15, -0x1.23456789abcdfp-14, 0x1.e573ac901e574p-15, -0x1.1566abc011567p-15, 0x1.a01a01a01a01ap-17, -0x1.71de3a556c734p-19, 0x1.27e4fb7789f5cp-22, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 12 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.ae64567f544e4p-26, 0x0p+0,
+	0x1.ae64567f544e4p-26, 0x1.27e4fb7789f5cp-22, 0x1.71de3a556c734p-20, 0x1.1566abc011567p-18, 0x1.1566abc011567p-17, 0x1.845c8a0ce5129p-17, 0x1.845c8a0ce5129p-17, 0x1.1566abc011567p-17, 0x1.1566abc011567p-18, 0x1.71de3a556c734p-20, 0x1.27e4fb7789f5cp-22, -0x1.27e4fb7789f5cp-22, 0x0p+0,
+	0x1.abdebffd954fcp-15, 0x1.246d4c852357ep-12, 0x1.693304f76be88p-11, 0x1.0865dbb310866p-10, 0x1.f6ca174c1f6cap-11, 0x1.3b8b302a7a1f2p-11, 0x1.e573ac901e574p-13, 0x1.1566abc011567p-15, -0x1.1566abc011567p-16, -0x1.71de3a556c734p-17, -0x1.71de3a556c734p-19, 0x1.71de3a556c734p-20, 0x0p+0,
+	0x1.f53413a4864eap-9, 0x1.a6d8d3f3a5a0cp-7, 0x1.3321dcc877322p-6, 0x1.e186186186186p-7, 0x1.8478478478478p-8, 0x1.47ae147ae147bp-12, -0x1.c71c71c71c71cp-11, -0x1.8618618618618p-12, -0x1.a01a01a01a01ap-17, 0x1.3813813813814p-15, 0x1.a01a01a01a01ap-17, -0x1.1566abc011567p-18, 0x0p+0,
+	0x1.c43706ee1b199p-5, 0x1.cbcc343abb233p-4, 0x1.4fea53fa94feap-4, 0x1.d75d75d75d75dp-7, -0x1.ba1ba1ba1ba1cp-7, -0x1.eb851eb851eb8p-8, 0x0p+0, 0x1.041041041041p-10, 0x1.a01a01a01a01ap-13, -0x1.1566abc011567p-14, -0x1.1566abc011567p-15, 0x1.1566abc011567p-17, 0x0p+0,
+	0x1.f3a1737f2b893p-3, 0x1.e2a1907f6e5d5p-3, -0x1p-7, -0x1.3b05b05b05b06p-4, -0x1.e93e93e93e93fp-7, 0x1.7c048d159e26bp-7, 0x1.f49f49f49f49fp-9, -0x1.1111111111111p-10, -0x1.1111111111111p-11, 0x1.e573ac901e574p-15, 0x1.e573ac901e574p-15, -0x1.845c8a0ce5129p-17, 0x0p+0,
+	0x1.9361392df310dp-2, 0x0p+0, -0x1.7f86a314dbf87p-3, 0x0p+0, 0x1.60b60b60b60b6p-5, 0x0p+0, -0x1.a2b3c4d5e6f81p-8, 0x0p+0, 0x1.6c16c16c16c17p-11, 0x0p+0, -0x1.23456789abcdfp-14, 0x1.845c8a0ce5129p-17, 0x0p+0,
+	0x1.f3a1737f2b893p-3, -0x1.e2a1907f6e5d5p-3, -0x1p-7, 0x1.3b05b05b05b06p-4, -0x1.e93e93e93e93fp-7, -0x1.7c048d159e26bp-7, 0x1.f49f49f49f49fp-9, 0x1.1111111111111p-10, -0x1.1111111111111p-11, -0x1.e573ac901e574p-15, 0x1.e573ac901e574p-15, -0x1.1566abc011567p-17, 0x0p+0,
+	0x1.c43706ee1b199p-5, -0x1.cbcc343abb233p-4, 0x1.4fea53fa94feap-4, -0x1.d75d75d75d75dp-7, -0x1.ba1ba1ba1ba1cp-7, 0x1.eb851eb851eb8p-8, 0x0p+0, -0x1.041041041041p-10, 0x1.a01a01a01a01ap-13, 0x1.1566abc011567p-14, -0x1.1566abc011567p-15, 0x1.1566abc011567p-18, 0x0p+0,
+	0x1.f53413a4864eap-9, -0x1.a6d8d3f3a5a0cp-7, 0x1.3321dcc877322p-6, -0x1.e186186186186p-7, 0x1.8478478478478p-8, -0x1.47ae147ae147bp-12, -0x1.c71c71c71c71cp-11, 0x1.8618618618618p-12, -0x1.a01a01a01a01ap-17, -0x1.3813813813814p-15, 0x1.a01a01a01a01ap-17, -0x1.71de3a556c734p-20, 0x0p+0,
+	0x1.abdebffd954fcp-15, -0x1.246d4c852357ep-12, 0x1.693304f76be88p-11, -0x1.0865dbb310866p-10, 0x1.f6ca174c1f6cap-11, -0x1.3b8b302a7a1f2p-11, 0x1.e573ac901e574p-13, -0x1.1566abc011567p-15, -0x1.1566abc011567p-16, 0x1.71de3a556c734p-17, -0x1.71de3a556c734p-19, 0x1.27e4fb7789f5cp-22, 0x0p+0,
+	0x1.ae64567f544e4p-26, -0x1.27e4fb7789f5cp-22, 0x1.71de3a556c734p-20, -0x1.1566abc011567p-18, 0x1.1566abc011567p-17, -0x1.845c8a0ce5129p-17, 0x1.845c8a0ce5129p-17, -0x1.1566abc011567p-17, 0x1.1566abc011567p-18, -0x1.71de3a556c734p-20, 0x1.27e4fb7789f5cp-22, -0x1.ae64567f544e4p-26, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 13 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.1eed8eff8d898p-29, 0x0p+0,
+	0x1.1eed8eff8d898p-29, 0x1.ae64567f544e4p-26, 0x1.27e4fb7789f5cp-23, 0x1.ed284dc73b445p-22, 0x1.1566abc011567p-20, 0x1.bbd779334ef0bp-20, 0x1.02e85c0898b71p-19, 0x1.bbd779334ef0bp-20, 0x1.1566abc011567p-20, 0x1.ed284dc73b445p-22, 0x1.27e4fb7789f5cp-23, 0x1.ae64567f544e4p-26, -0x1.ae64567f544e4p-26, 0x0p+0,
+	0x1.1e046dfb5de68p-17, 0x1.aba8f372c5654p-15, 0x1.2423534645757p-13, 0x1.e0a2c7cdac431p-13, 0x1.075075075075p-12, 0x1.8ec396e418ec4p-13, 0x1.9ca252adb363cp-14, 0x1.0787eff676deep-15, 0x1.a01a01a01a01ap-19, -0x1.3439309c850abp-19, -0x1.4ce19ae67b348p-20, -0x1.27e4fb7789f5cp-22, 0x1.27e4fb7789f5cp-23, 0x0p+0,
+	0x1.05be817cddb56p-10, 0x1.ee8498a48ff96p-9, 0x1.9db5698f7c86p-8, 0x1.8a75b0d64fc3dp-8, 0x1.c0795ceb24079p-9, 0x1.047f36e25d14cp-10, -0x1.948b0fcd6e9ep-15, -0x1.4969ebf41496ap-13, -0x1.a8c536fe1a8c5p-15, 0x1.ed284dc73b445p-22, 0x1.43a2730abee4dp-18, 0x1.71de3a556c734p-20, -0x1.ed284dc73b445p-22, 0x0p+0,
+	0x1.5c76e67629531p-6, 0x1.a4e3c5b3d2b4ap-5, 0x1.96f119bc466f1p-5, 0x1.59827bb5f442dp-6, -0x1.4514514514514p-14, -0x1.fd130463796adp-9, -0x1.5555555555555p-10, 0x1.041041041041p-13, 0x1.6596596596596p-13, 0x1.88fc1dfac33a7p-16, -0x1.5ac056b015acp-17, -0x1.1566abc011567p-18, 0x1.1566abc011567p-20, 0x0p+0,
+	0x1.1b8c714756a82p-3, 0x1.8293b1c3a4c2dp-3, 0x1.f976ecc421977p-5, -0x1.ea8dc54e1bfe3p-6, -0x1.75f15f15f15f1p-6, -0x1.2dac7460dfa79p-12, 0x1.a12f684bda12fp-9, 0x1.1e11e11e11e12p-11, -0x1.0a90a90a90a91p-12, -0x1.4f3164dd6a487p-14, 0x1.a01a01a01a01ap-17, 0x1.1566abc011567p-17, -0x1.bbd779334ef0bp-20, 0x0p+0,
+	0x1.5b6a5e46bb907p-2, 0x1.3320fedcba987p-3, -0x1.e2a1907f6e5d5p-4, -0x1.ea08d971254b4p-5, 0x1.3b05b05b05b06p-6, 0x1.7c048d159e26bp-7, -0x1.fab0bc1cd2de4p-10, -0x1.7e4b17e4b17e5p-10, 0x1.1111111111111p-13, 0x1.1b2e24a967083p-13, -0x1.845c8a0ce5129p-18, -0x1.845c8a0ce5129p-17, 0x1.02e85c0898b71p-19, 0x0p+0,
+	0x1.5b6a5e46bb907p-2, -0x1.3320fedcba987p-3, -0x1.e2a1907f6e5d5p-4, 0x1.ea08d971254b4p-5, 0x1.3b05b05b05b06p-6, -0x1.7c048d159e26bp-7, -0x1.fab0bc1cd2de4p-10, 0x1.7e4b17e4b17e5p-10, 0x1.1111111111111p-13, -0x1.1b2e24a967083p-13, -0x1.845c8a0ce5129p-18, 0x1.845c8a0ce5129p-17, -0x1.bbd779334ef0bp-20, 0x0p+0,
+	0x1.1b8c714756a82p-3, -0x1.8293b1c3a4c2dp-3, 0x1.f976ecc421977p-5, 0x1.ea8dc54e1bfe3p-6, -0x1.75f15f15f15f1p-6, 0x1.2dac7460dfa79p-12, 0x1.a12f684bda12fp-9, -0x1.1e11e11e11e12p-11, -0x1.0a90a90a90a91p-12, 0x1.4f3164dd6a487p-14, 0x1.a01a01a01a01ap-17, -0x1.1566abc011567p-17, 0x1.1566abc011567p-20, 0x0p+0,
+	0x1.5c76e67629531p-6, -0x1.a4e3c5b3d2b4ap-5, 0x1.96f119bc466f1p-5, -0x1.59827bb5f442dp-6, -0x1.4514514514514p-14, 0x1.fd130463796adp-9, -0x1.5555555555555p-10, -0x1.041041041041p-13, 0x1.6596596596596p-13, -0x1.88fc1dfac33a7p-16, -0x1.5ac056b015acp-17, 0x1.1566abc011567p-18, -0x1.ed284dc73b445p-22, 0x0p+0,
+	0x1.05be817cddb56p-10, -0x1.ee8498a48ff96p-9, 0x1.9db5698f7c86p-8, -0x1.8a75b0d64fc3dp-8, 0x1.c0795ceb24079p-9, -0x1.047f36e25d14cp-10, -0x1.948b0fcd6e9ep-15, 0x1.4969ebf41496ap-13, -0x1.a8c536fe1a8c5p-15, -0x1.ed284dc73b445p-22, 0x1.43a2730abee4dp-18, -0x1.71de3a556c734p-20, 0x1.27e4fb7789f5cp-23, 0x0p+0,
+	0x1.1e046dfb5de68p-17, -0x1.aba8f372c5654p-15, 0x1.2423534645757p-13, -0x1.e0a2c7cdac431p-13, 0x1.075075075075p-12, -0x1.8ec396e418ec4p-13, 0x1.9ca252adb363cp-14, -0x1.0787eff676deep-15, 0x1.a01a01a01a01ap-19, 0x1.3439309c850abp-19, -0x1.4ce19ae67b348p-20, 0x1.27e4fb7789f5cp-22, -0x1.ae64567f544e4p-26, 0x0p+0,
+	0x1.1eed8eff8d898p-29, -0x1.ae64567f544e4p-26, 0x1.27e4fb7789f5cp-23, -0x1.ed284dc73b445p-22, 0x1.1566abc011567p-20, -0x1.bbd779334ef0bp-20, 0x1.02e85c0898b71p-19, -0x1.bbd779334ef0bp-20, 0x1.1566abc011567p-20, -0x1.ed284dc73b445p-22, 0x1.27e4fb7789f5cp-23, -0x1.ae64567f544e4p-26, 0x1.1eed8eff8d898p-29, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 14 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.6124613a86d09p-33, 0x0p+0,
+	0x1.6124613a86d09p-33, 0x1.1eed8eff8d898p-29, 0x1.ae64567f544e4p-27, 0x1.8a86a49f629d1p-25, 0x1.ed284dc73b445p-24, 0x1.bbd779334ef0bp-23, 0x1.27e4fb7789f5cp-22, 0x1.27e4fb7789f5cp-22, 0x1.bbd779334ef0bp-23, 0x1.ed284dc73b445p-24, 0x1.8a86a49f629d1p-25, 0x1.ae64567f544e4p-27, 0x1.1eed8eff8d898p-29, -0x1.1eed8eff8d898p-29, 0x0p+0,
+	0x1.6089e14ffd35ap-20, 0x1.1df27f226dedap-17, 0x1.ab7326e7f57abp-16, 0x1.8521cd5f34c3ep-15, 0x1.dfac33a6c8a57p-15, 0x1.a391b092809f8p-15, 0x1.0787eff676deep-15, 0x1.ce55c8eac79p-17, 0x1.f3526859b8cecp-19, 0x1.ed284dc73b445p-23, -0x1.27e4fb7789f5cp-22, -0x1.0cfeb60f94b0ep-23, -0x1.ae64567f544e4p-26, 0x1.ae64567f544e4p-27, 0x0p+0,
+	0x1.f2588d7c6e462p-13, 0x1.038278a0e6f99p-10, 0x1.e7d5f4d6c4e3cp-10, 0x1.0db834a386e6ep-9, 0x1.7b709a97e261bp-10, 0x1.4c72a5082e60cp-11, 0x1.18de5ab277f45p-13, -0x1.5f5fea9df3d3ep-16, -0x1.8b4be7f1b24e6p-16, -0x1.90b0bf31e0278p-18, 0x1.27e4fb7789f5cp-22, 0x1.27e4fb7789f5cp-21, 0x1.27e4fb7789f5cp-23, -0x1.8a86a49f629d1p-25, 0x0p+0,
+	0x1.df36f978361cdp-8, 0x1.4c1afe5e5b77cp-6, 0x1.85fb7c2989b51p-6, 0x1.d9a33b631e7dcp-7, 0x1.edca1f00c0a3cp-9, -0x1.6ee7ff910a21bp-11, -0x1.aa3715386ff8cp-11, -0x1.77a5b33ec225p-13, 0x1.26bd167c126bdp-15, 0x1.9c3fb1048b8b1p-16, 0x1.3439309c850abp-19, -0x1.71de3a556c734p-20, -0x1.ed284dc73b445p-22, 0x1.ed284dc73b445p-24, 0x0p+0,
+	0x1.166ceb552c45dp-4, 0x1.dffb28f122fb7p-4, 0x1.195ac056b015bp-4, 0x1.06ba32bf9dc1p-8, -0x1.a208208208208p-7, -0x1.2a236f03bd08ap-8, 0x1.3a3e4e8f93a3ep-11, 0x1.4fea53fa94feap-11, 0x1.ba1ba1ba1ba1cp-15, -0x1.8bdfda6f6e135p-15, -0x1.5ac056b015acp-17, 0x1.1566abc011567p-19, 0x1.1566abc011567p-20, -0x1.bbd779334ef0bp-23, 0x0p+0,
+	0x1.ef2ec41e6c4f4p-3, 0x1.9b484b462078dp-3, -0x1.3dcacb9ba8a98p-6, -0x1.ea3e049654c6p-5, -0x1.e983ed942e984p-8, 0x1.1396062d2f9fcp-7, 0x1.03a14b25c36d4p-9, -0x1.7f2903a14b25cp-11, -0x1.06aa0439dd377p-12, 0x1.664f4882c10fap-15, 0x1.689f1279b0239p-16, -0x1.bbd779334ef0bp-20, -0x1.bbd779334ef0bp-20, 0x1.27e4fb7789f5cp-22, 0x0p+0,
+	0x1.7623c7fd6787ep-2, 0x0p+0, -0x1.3320fedcba987p-3, 0x0p+0, 0x1.ea08d971254b4p-6, 0x0p+0, -0x1.fab0bc1cd2de4p-9, 0x0p+0, 0x1.7e4b17e4b17e5p-12, 0x0p+0, -0x1.c516a10f0b406p-16, 0x0p+0, 0x1.02e85c0898b71p-19, -0x1.27e4fb7789f5cp-22, 0x0p+0,
+	0x1.ef2ec41e6c4f4p-3, -0x1.9b484b462078dp-3, -0x1.3dcacb9ba8a98p-6, 0x1.ea3e049654c6p-5, -0x1.e983ed942e984p-8, -0x1.1396062d2f9fcp-7, 0x1.03a14b25c36d4p-9, 0x1.7f2903a14b25cp-11, -0x1.06aa0439dd377p-12, -0x1.664f4882c10fap-15, 0x1.689f1279b0239p-16, 0x1.bbd779334ef0bp-20, -0x1.bbd779334ef0bp-20, 0x1.bbd779334ef0bp-23, 0x0p+0,
+	0x1.166ceb552c45dp-4, -0x1.dffb28f122fb7p-4, 0x1.195ac056b015bp-4, -0x1.06ba32bf9dc1p-8, -0x1.a208208208208p-7, 0x1.2a236f03bd08ap-8, 0x1.3a3e4e8f93a3ep-11, -0x1.4fea53fa94feap-11, 0x1.ba1ba1ba1ba1cp-15, 0x1.8bdfda6f6e135p-15, -0x1.5ac056b015acp-17, -0x1.1566abc011567p-19, 0x1.1566abc011567p-20, -0x1.ed284dc73b445p-24, 0x0p+0,
+	0x1.df36f978361cdp-8, -0x1.4c1afe5e5b77cp-6, 0x1.85fb7c2989b51p-6, -0x1.d9a33b631e7dcp-7, 0x1.edca1f00c0a3cp-9, 0x1.6ee7ff910a21bp-11, -0x1.aa3715386ff8cp-11, 0x1.77a5b33ec225p-13, 0x1.26bd167c126bdp-15, -0x1.9c3fb1048b8b1p-16, 0x1.3439309c850abp-19, 0x1.71de3a556c734p-20, -0x1.ed284dc73b445p-22, 0x1.8a86a49f629d1p-25, 0x0p+0,
+	0x1.f2588d7c6e462p-13, -0x1.038278a0e6f99p-10, 0x1.e7d5f4d6c4e3cp-10, -0x1.0db834a386e6ep-9, 0x1.7b709a97e261bp-10, -0x1.4c72a5082e60cp-11, 0x1.18de5ab277f45p-13, 0x1.5f5fea9df3d3ep-16, -0x1.8b4be7f1b24e6p-16, 0x1.90b0bf31e0278p-18, 0x1.27e4fb7789f5cp-22, -0x1.27e4fb7789f5cp-21, 0x1.27e4fb7789f5cp-23, -0x1.ae64567f544e4p-27, 0x0p+0,
+	0x1.6089e14ffd35ap-20, -0x1.1df27f226dedap-17, 0x1.ab7326e7f57abp-16, -0x1.8521cd5f34c3ep-15, 0x1.dfac33a6c8a57p-15, -0x1.a391b092809f8p-15, 0x1.0787eff676deep-15, -0x1.ce55c8eac79p-17, 0x1.f3526859b8cecp-19, -0x1.ed284dc73b445p-23, -0x1.27e4fb7789f5cp-22, 0x1.0cfeb60f94b0ep-23, -0x1.ae64567f544e4p-26, 0x1.1eed8eff8d898p-29, 0x0p+0,
+	0x1.6124613a86d09p-33, -0x1.1eed8eff8d898p-29, 0x1.ae64567f544e4p-27, -0x1.8a86a49f629d1p-25, 0x1.ed284dc73b445p-24, -0x1.bbd779334ef0bp-23, 0x1.27e4fb7789f5cp-22, -0x1.27e4fb7789f5cp-22, 0x1.bbd779334ef0bp-23, -0x1.ed284dc73b445p-24, 0x1.8a86a49f629d1p-25, -0x1.ae64567f544e4p-27, 0x1.1eed8eff8d898p-29, -0x1.6124613a86d09p-33, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 15 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.93974a8c07c9dp-37, 0x0p+0,
+	0x1.93974a8c07c9dp-37, 0x1.6124613a86d09p-33, 0x1.1eed8eff8d898p-30, 0x1.1eed8eff8d898p-28, 0x1.8a86a49f629d1p-27, 0x1.8a86a49f629d1p-26, 0x1.27e4fb7789f5cp-25, 0x1.522a43f65486ap-25, 0x1.27e4fb7789f5cp-25, 0x1.8a86a49f629d1p-26, 0x1.8a86a49f629d1p-27, 0x1.1eed8eff8d898p-28, 0x1.1eed8eff8d898p-30, 0x1.6124613a86d09p-33, -0x1.6124613a86d09p-33, 0x0p+0,
+	0x1.9338b3168ef8p-23, 0x1.607ed82cf3616p-20, 0x1.1de090497df4dp-18, 0x1.1cd391936e602p-17, 0x1.84bf2bb60ceb4p-17, 0x1.7ef7b2ccb7397p-17, 0x1.168e90bb88e06p-17, 0x1.2a894fff769edp-18, 0x1.c516a10f0b406p-20, 0x1.a32f0ee958c6ep-22, 0x1.8a86a49f629d1p-27, -0x1.f61fba3f37b09p-26, -0x1.8a86a49f629d1p-27, -0x1.1eed8eff8d898p-29, 0x1.1eed8eff8d898p-30, 0x0p+0,
+	0x1.b498bd05f0bb4p-15, 0x1.ef9779b9ce4bbp-13, 0x1.014693a2a21dcp-11, 0x1.40c570276e094p-11, 0x1.07a3ad6e0a13dp-11, 0x1.238f60c889b07p-12, 0x1.984cb7feb31e6p-14, 0x1.eb656ac1f2d3ap-17, -0x1.23456789abcdfp-18, -0x1.96dad9c45db1fp-19, -0x1.4ce19ae67b348p-21, 0x1.ae64567f544e4p-25, 0x1.e430e14f3ed8p-25, 0x1.ae64567f544e4p-27, -0x1.1eed8eff8d898p-28, 0x0p+0,
+	0x1.2a4f30ee3b31ap-9, 0x1.cfa4350c52aaap-8, 0x1.3be2d6d44d082p-7, 0x1.df52d1257c891p-8, 0x1.96352e3a3cc41p-9, 0x1.e682e9214bebp-12, -0x1.d23c6dbb7b01ap-13, -0x1.1bacf482e367fp-13, -0x1.4bb9b5eb03aa9p-16, 0x1.b5ad5ea0d1663p-18, 0x1.99efe70d9c773p-19, 0x1.8a86a49f629d1p-23, -0x1.5935d00b76497p-23, -0x1.8a86a49f629d1p-25, 0x1.8a86a49f629d1p-27, 0x0p+0,
+	0x1.e353214f2456ap-6, 0x1.f0f2f77b51c81p-5, 0x1.8cf469598c1d8p-5, 0x1.ea4a58cb79c11p-7, -0x1.564622034f9d4p-9, -0x1.b12eed01c6a12p-9, -0x1.505de96ccfb09p-11, 0x1.a71e822926a2bp-13, 0x1.add3c0ca4587ep-14, 0x1.05fd6951d77c5p-19, -0x1.e1995bf48fe0bp-18, -0x1.3439309c850abp-20, 0x1.3439309c850abp-22, 0x1.ed284dc73b445p-24, -0x1.8a86a49f629d1p-26, 0x0p+0,
+	0x1.2db70d686a5dp-3, 0x1.63f84e73d62c5p-3, 0x1.56956d9b1df62p-5, -0x1.e111eefccdaacp-6, -0x1.058aa577243f1p-6, 0x1.153d0f8cb487p-10, 0x1.1b1a7e74b4181p-9, 0x1.9ddf5a4d6a53p-13, -0x1.6789abcdf0123p-13, -0x1.1a9a322bab434p-15, 0x1.2dac7460dfa79p-17, 0x1.845c8a0ce5129p-19, -0x1.4ce19ae67b348p-22, -0x1.bbd779334ef0bp-23, 0x1.27e4fb7789f5cp-25, 0x0p+0,
+	0x1.488cf7751bda9p-2, 0x1.fa3197b8c580fp-4, -0x1.9b484b462078dp-4, -0x1.648a31e1b2046p-5, 0x1.ea3e049654c6p-7, 0x1.e9ee43de8d8ddp-8, -0x1.6f72b2e6ea2a6p-10, -0x1.b5e5bb017a745p-11, 0x1.7f2903a14b25cp-14, 0x1.1ea5d39bcda62p-14, -0x1.1ea5d39bcda62p-18, -0x1.27e4fb7789f5cp-18, 0x1.27e4fb7789f5cp-23, 0x1.27e4fb7789f5cp-22, -0x1.522a43f65486ap-25, 0x0p+0,
+	0x1.488cf7751bda9p-2, -0x1.fa3197b8c580fp-4, -0x1.9b484b462078dp-4, 0x1.648a31e1b2046p-5, 0x1.ea3e049654c6p-7, -0x1.e9ee43de8d8ddp-8, -0x1.6f72b2e6ea2a6p-10, 0x1.b5e5bb017a745p-11, 0x1.7f2903a14b25cp-14, -0x1.1ea5d39bcda62p-14, -0x1.1ea5d39bcda62p-18, 0x1.27e4fb7789f5cp-18, 0x1.27e4fb7789f5cp-23, -0x1.27e4fb7789f5cp-22, 0x1.27e4fb7789f5cp-25, 0x0p+0,
+	0x1.2db70d686a5dp-3, -0x1.63f84e73d62c5p-3, 0x1.56956d9b1df62p-5, 0x1.e111eefccdaacp-6, -0x1.058aa577243f1p-6, -0x1.153d0f8cb487p-10, 0x1.1b1a7e74b4181p-9, -0x1.9ddf5a4d6a53p-13, -0x1.6789abcdf0123p-13, 0x1.1a9a322bab434p-15, 0x1.2dac7460dfa79p-17, -0x1.845c8a0ce5129p-19, -0x1.4ce19ae67b348p-22, 0x1.bbd779334ef0bp-23, -0x1.8a86a49f629d1p-26, 0x0p+0,
+	0x1.e353214f2456ap-6, -0x1.f0f2f77b51c81p-5, 0x1.8cf469598c1d8p-5, -0x1.ea4a58cb79c11p-7, -0x1.564622034f9d4p-9, 0x1.b12eed01c6a12p-9, -0x1.505de96ccfb09p-11, -0x1.a71e822926a2bp-13, 0x1.add3c0ca4587ep-14, -0x1.05fd6951d77c5p-19, -0x1.e1995bf48fe0bp-18, 0x1.3439309c850abp-20, 0x1.3439309c850abp-22, -0x1.ed284dc73b445p-24, 0x1.8a86a49f629d1p-27, 0x0p+0,
+	0x1.2a4f30ee3b31ap-9, -0x1.cfa4350c52aaap-8, 0x1.3be2d6d44d082p-7, -0x1.df52d1257c891p-8, 0x1.96352e3a3cc41p-9, -0x1.e682e9214bebp-12, -0x1.d23c6dbb7b01ap-13, 0x1.1bacf482e367fp-13, -0x1.4bb9b5eb03aa9p-16, -0x1.b5ad5ea0d1663p-18, 0x1.99efe70d9c773p-19, -0x1.8a86a49f629d1p-23, -0x1.5935d00b76497p-23, 0x1.8a86a49f629d1p-25, -0x1.1eed8eff8d898p-28, 0x0p+0,
+	0x1.b498bd05f0bb4p-15, -0x1.ef9779b9ce4bbp-13, 0x1.014693a2a21dcp-11, -0x1.40c570276e094p-11, 0x1.07a3ad6e0a13dp-11, -0x1.238f60c889b07p-12, 0x1.984cb7feb31e6p-14, -0x1.eb656ac1f2d3ap-17, -0x1.23456789abcdfp-18, 0x1.96dad9c45db1fp-19, -0x1.4ce19ae67b348p-21, -0x1.ae64567f544e4p-25, 0x1.e430e14f3ed8p-25, -0x1.ae64567f544e4p-27, 0x1.1eed8eff8d898p-30, 0x0p+0,
+	0x1.9338b3168ef8p-23, -0x1.607ed82cf3616p-20, 0x1.1de090497df4dp-18, -0x1.1cd391936e602p-17, 0x1.84bf2bb60ceb4p-17, -0x1.7ef7b2ccb7397p-17, 0x1.168e90bb88e06p-17, -0x1.2a894fff769edp-18, 0x1.c516a10f0b406p-20, -0x1.a32f0ee958c6ep-22, 0x1.8a86a49f629d1p-27, 0x1.f61fba3f37b09p-26, -0x1.8a86a49f629d1p-27, 0x1.1eed8eff8d898p-29, -0x1.6124613a86d09p-33, 0x0p+0,
+	0x1.93974a8c07c9dp-37, -0x1.6124613a86d09p-33, 0x1.1eed8eff8d898p-30, -0x1.1eed8eff8d898p-28, 0x1.8a86a49f629d1p-27, -0x1.8a86a49f629d1p-26, 0x1.27e4fb7789f5cp-25, -0x1.522a43f65486ap-25, 0x1.27e4fb7789f5cp-25, -0x1.8a86a49f629d1p-26, 0x1.8a86a49f629d1p-27, -0x1.1eed8eff8d898p-28, 0x1.1eed8eff8d898p-30, -0x1.6124613a86d09p-33, 0x1.93974a8c07c9dp-37, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 16 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.ae7f3e733b81fp-41, 0x0p+0,
+	0x1.ae7f3e733b81fp-41, 0x1.93974a8c07c9dp-37, 0x1.6124613a86d09p-34, 0x1.7e9213ff6762p-32, 0x1.1eed8eff8d898p-30, 0x1.3b9eea191bb0dp-29, 0x1.07046dbf97136p-28, 0x1.522a43f65486ap-28, 0x1.522a43f65486ap-28, 0x1.07046dbf97136p-28, 0x1.3b9eea191bb0dp-29, 0x1.1eed8eff8d898p-30, 0x1.7e9213ff6762p-32, 0x1.6124613a86d09p-34, 0x1.93974a8c07c9dp-37, -0x1.93974a8c07c9dp-37, 0x0p+0,
+	0x1.ae496e8b6d1a8p-26, 0x1.933264b964c7ep-23, 0x1.6073cf09e98d3p-21, 0x1.7d1381eb67fa9p-20, 0x1.1cafb3e18e6e7p-19, 0x1.36b06e70b7421p-19, 0x1.fd9894a334b58p-20, 0x1.3d079fb6ef3e3p-20, 0x1.27e4fb7789f5cp-21, 0x1.8a86a49f629d1p-23, 0x1.3b9eea191bb0dp-25, 0x0p+0, -0x1.7e9213ff6762p-29, -0x1.08db48ebe51c7p-30, -0x1.6124613a86d09p-33, 0x1.6124613a86d09p-34, 0x0p+0,
+	0x1.62bcd33e641fp-17, 0x1.b3058452da2c5p-15, 0x1.ecd67c097464fp-14, 0x1.540e6e02bed7cp-13, 0x1.3c5221e1204fcp-13, 0x1.9c1ab4651c99ep-14, 0x1.74ca2eed8548ep-15, 0x1.aad599084b706p-17, 0x1.5620c2c237843p-20, -0x1.67980e0bf08c7p-21, -0x1.6f66fc813a3bdp-22, -0x1.ed284dc73b445p-25, 0x1.c64d77bf4ac46p-28, 0x1.66a8f2bf70ebep-28, 0x1.1eed8eff8d898p-30, -0x1.7e9213ff6762p-32, 0x0p+0,
+	0x1.5406c62d57fap-11, 0x1.237ccdfa236ebp-9, 0x1.c027793e84384p-9, 0x1.8fbde7782e886p-9, 0x1.b73a23208ec7fp-10, 0x1.103d024bc8327p-11, 0x1.03ef6076584e2p-15, -0x1.7f13e0fd0bc08p-15, -0x1.3a634b2f02952p-16, -0x1.cc47c00f4861ep-20, 0x1.00711e34667fbp-20, 0x1.66a8f2bf70ebep-22, 0x1.7e9213ff6762p-27, -0x1.1eed8eff8d898p-26, -0x1.1eed8eff8d898p-28, 0x1.1eed8eff8d898p-30, 0x0p+0,
+	0x1.78e812606fe0bp-7, 0x1.be093b315cf07p-6, 0x1.b6fe70d9c772cp-6, 0x1.a7fa44db4bcf5p-7, 0x1.f541e07176f92p-10, -0x1.2b64867f04f3cp-10, -0x1.4954dc194abfp-11, -0x1.f66afb690224ep-15, 0x1.6165bb5605055p-15, 0x1.c7c90caf222cfp-17, -0x1.eab10ff3090cfp-22, -0x1.f3526859b8cecp-21, -0x1.dcb806eb41d31p-24, 0x1.27e4fb7789f5cp-25, 0x1.8a86a49f629d1p-27, -0x1.3b9eea191bb0dp-29, 0x0p+0,
+	0x1.41ed18cfa7f27p-4, 0x1.e299527d0ba45p-4, 0x1.cf77212a0374ap-5, -0x1.21fa93f7a0d1fp-9, -0x1.6b1b8db14545ap-7, -0x1.5e0301f12a124p-9, 0x1.7d33a33015edcp-11, 0x1.a3a6d336c004dp-12, -0x1.27e4fb7789f5cp-21, -0x1.fe9f9910f44c9p-16, -0x1.de5cdace0df8p-19, 0x1.8a86a49f629d1p-20, 0x1.69a616e76fbaap-22, -0x1.8a86a49f629d1p-25, -0x1.8a86a49f629d1p-26, 0x1.07046dbf97136p-28, 0x0p+0,
+	0x1.e7ad22347bf2cp-3, 0x1.6362e181cd583p-3, -0x1.9b7e0a5dcdaf6p-6, -0x1.8462016274f7ep-5, -0x1.d004e98d2cbc1p-9, 0x1.955486350bb4ep-8, 0x1.1869fffceaf2bp-10, -0x1.0ac2323b853e7p-11, -0x1.0eaec8ca6a848p-13, 0x1.e9e1efa96892cp-16, 0x1.565bf08e1c396p-17, -0x1.43a2730abee4dp-20, -0x1.46b78053fdaa1p-21, 0x1.27e4fb7789f5cp-25, 0x1.27e4fb7789f5cp-25, -0x1.522a43f65486ap-28, 0x0p+0,
+	0x1.5e743b27952d7p-2, 0x0p+0, -0x1.fa3197b8c580fp-4, 0x0p+0, 0x1.648a31e1b2046p-6, 0x0p+0, -0x1.469ed7e9b3b3ep-9, 0x0p+0, 0x1.b5e5bb017a745p-13, 0x0p+0, -0x1.caa2ec2c7c3cfp-17, 0x0p+0, 0x1.8a86a49f629d1p-21, 0x0p+0, -0x1.522a43f65486ap-25, 0x1.522a43f65486ap-28, 0x0p+0,
+	0x1.e7ad22347bf2cp-3, -0x1.6362e181cd583p-3, -0x1.9b7e0a5dcdaf6p-6, 0x1.8462016274f7ep-5, -0x1.d004e98d2cbc1p-9, -0x1.955486350bb4ep-8, 0x1.1869fffceaf2bp-10, 0x1.0ac2323b853e7p-11, -0x1.0eaec8ca6a848p-13, -0x1.e9e1efa96892cp-16, 0x1.565bf08e1c396p-17, 0x1.43a2730abee4dp-20, -0x1.46b78053fdaa1p-21, -0x1.27e4fb7789f5cp-25, 0x1.27e4fb7789f5cp-25, -0x1.07046dbf97136p-28, 0x0p+0,
+	0x1.41ed18cfa7f27p-4, -0x1.e299527d0ba45p-4, 0x1.cf77212a0374ap-5, 0x1.21fa93f7a0d1fp-9, -0x1.6b1b8db14545ap-7, 0x1.5e0301f12a124p-9, 0x1.7d33a33015edcp-11, -0x1.a3a6d336c004dp-12, -0x1.27e4fb7789f5cp-21, 0x1.fe9f9910f44c9p-16, -0x1.de5cdace0df8p-19, -0x1.8a86a49f629d1p-20, 0x1.69a616e76fbaap-22, 0x1.8a86a49f629d1p-25, -0x1.8a86a49f629d1p-26, 0x1.3b9eea191bb0dp-29, 0x0p+0,
+	0x1.78e812606fe0bp-7, -0x1.be093b315cf07p-6, 0x1.b6fe70d9c772cp-6, -0x1.a7fa44db4bcf5p-7, 0x1.f541e07176f92p-10, 0x1.2b64867f04f3cp-10, -0x1.4954dc194abfp-11, 0x1.f66afb690224ep-15, 0x1.6165bb5605055p-15, -0x1.c7c90caf222cfp-17, -0x1.eab10ff3090cfp-22, 0x1.f3526859b8cecp-21, -0x1.dcb806eb41d31p-24, -0x1.27e4fb7789f5cp-25, 0x1.8a86a49f629d1p-27, -0x1.1eed8eff8d898p-30, 0x0p+0,
+	0x1.5406c62d57fap-11, -0x1.237ccdfa236ebp-9, 0x1.c027793e84384p-9, -0x1.8fbde7782e886p-9, 0x1.b73a23208ec7fp-10, -0x1.103d024bc8327p-11, 0x1.03ef6076584e2p-15, 0x1.7f13e0fd0bc08p-15, -0x1.3a634b2f02952p-16, 0x1.cc47c00f4861ep-20, 0x1.00711e34667fbp-20, -0x1.66a8f2bf70ebep-22, 0x1.7e9213ff6762p-27, 0x1.1eed8eff8d898p-26, -0x1.1eed8eff8d898p-28, 0x1.7e9213ff6762p-32, 0x0p+0,
+	0x1.62bcd33e641fp-17, -0x1.b3058452da2c5p-15, 0x1.ecd67c097464fp-14, -0x1.540e6e02bed7cp-13, 0x1.3c5221e1204fcp-13, -0x1.9c1ab4651c99ep-14, 0x1.74ca2eed8548ep-15, -0x1.aad599084b706p-17, 0x1.5620c2c237843p-20, 0x1.67980e0bf08c7p-21, -0x1.6f66fc813a3bdp-22, 0x1.ed284dc73b445p-25, 0x1.c64d77bf4ac46p-28, -0x1.66a8f2bf70ebep-28, 0x1.1eed8eff8d898p-30, -0x1.6124613a86d09p-34, 0x0p+0,
+	0x1.ae496e8b6d1a8p-26, -0x1.933264b964c7ep-23, 0x1.6073cf09e98d3p-21, -0x1.7d1381eb67fa9p-20, 0x1.1cafb3e18e6e7p-19, -0x1.36b06e70b7421p-19, 0x1.fd9894a334b58p-20, -0x1.3d079fb6ef3e3p-20, 0x1.27e4fb7789f5cp-21, -0x1.8a86a49f629d1p-23, 0x1.3b9eea191bb0dp-25, 0x0p+0, -0x1.7e9213ff6762p-29, 0x1.08db48ebe51c7p-30, -0x1.6124613a86d09p-33, 0x1.93974a8c07c9dp-37, 0x0p+0,
+	0x1.ae7f3e733b81fp-41, -0x1.93974a8c07c9dp-37, 0x1.6124613a86d09p-34, -0x1.7e9213ff6762p-32, 0x1.1eed8eff8d898p-30, -0x1.3b9eea191bb0dp-29, 0x1.07046dbf97136p-28, -0x1.522a43f65486ap-28, 0x1.522a43f65486ap-28, -0x1.07046dbf97136p-28, 0x1.3b9eea191bb0dp-29, -0x1.1eed8eff8d898p-30, 0x1.7e9213ff6762p-32, -0x1.6124613a86d09p-34, 0x1.93974a8c07c9dp-37, -0x1.ae7f3e733b81fp-41, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 17 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.ae7f3e733b81fp-45, 0x0p+0,
+	0x1.ae7f3e733b81fp-45, 0x1.ae7f3e733b81fp-41, 0x1.93974a8c07c9dp-38, 0x1.d6db2c4e09162p-36, 0x1.7e9213ff6762p-34, 0x1.cb15b198e2759p-33, 0x1.a4d3e2cc24ebcp-32, 0x1.2c9758daf5cdp-31, 0x1.522a43f65486ap-31, 0x1.2c9758daf5cdp-31, 0x1.a4d3e2cc24ebcp-32, 0x1.cb15b198e2759p-33, 0x1.7e9213ff6762p-34, 0x1.d6db2c4e09162p-36, 0x1.93974a8c07c9dp-38, 0x1.ae7f3e733b81fp-41, -0x1.ae7f3e733b81fp-41, 0x0p+0,
+	0x1.ae62a80015dbp-29, 0x1.ae46118cf0341p-26, 0x1.932c165c3a97cp-24, 0x1.d5e107de7fa15p-23, 0x1.7cfb98ca28042p-22, 0x1.c746237f7d946p-22, 0x1.9dd75e48414eep-22, 0x1.229c5267b0a3bp-22, 0x1.3bb57572f8e9bp-23, 0x1.04ab3f0de127cp-24, 0x1.350b9a8deb1d2p-26, 0x1.ae64567f544e4p-29, -0x1.7e9213ff6762p-34, -0x1.08db48ebe51c7p-32, -0x1.47eaec91c654p-34, -0x1.93974a8c07c9dp-37, 0x1.93974a8c07c9dp-38, 0x0p+0,
+	0x1.0cfe9ef03f163p-19, 0x1.61e5ae871e688p-17, 0x1.b17251ee20c78p-16, 0x1.46b90d9ceb0bep-15, 0x1.511446fee807dp-15, 0x1.f2ff04e8f689ap-16, 0x1.0c4375f664953p-16, 0x1.97d8797756715p-18, 0x1.8334a5116d88ap-20, 0x1.5935d00b76497p-24, -0x1.6e94928fd4296p-24, -0x1.27e4fb7789f5cp-25, -0x1.48c5892f7cd83p-28, 0x1.8d48ed61d7aabp-31, 0x1.e59205b0795edp-32, 0x1.6124613a86d09p-34, -0x1.d6db2c4e09162p-36, 0x0p+0,
+	0x1.660a5ce7830fap-13, 0x1.4e7bd2e05e699p-11, 0x1.1cb0b7e8d806p-10, 0x1.2080839425b8cp-10, 0x1.7a7d0098029aep-11, 0x1.3fbfe5838898p-12, 0x1.264ce4fedb7fp-14, -0x1.01f4211066cf5p-19, -0x1.e9c9473f1e9c9p-18, -0x1.2a768689e8ef7p-19, -0x1.c0c5f4dbb35f7p-24, 0x1.fa9b707b35e6cp-24, 0x1.1833fda590384p-25, 0x1.7e9213ff6762p-32, -0x1.ae64567f544e4p-30, -0x1.7e9213ff6762p-32, 0x1.7e9213ff6762p-34, 0x0p+0,
+	0x1.0b71ae10862bep-8, 0x1.63a7a5fd9a611p-7, 0x1.9999a17218829p-7, 0x1.fea202429e8fap-8, 0x1.440acafd402d3p-9, 0x1.8cfe5539013aap-15, -0x1.22575a6df0b35p-12, -0x1.8af214b7a4dfep-14, -0x1.dd5c69afd9918p-20, 0x1.c5dbe4615af1ap-18, 0x1.9aa803c0d5c75p-20, -0x1.13b8476992022p-23, -0x1.c46f41264b832p-24, -0x1.42cb40df7f3abp-27, 0x1.f61fba3f37b09p-29, 0x1.1eed8eff8d898p-30, -0x1.cb15b198e2759p-33, 0x0p+0,
+	0x1.3239b5c451307p-5, 0x1.12d0168399f65p-4, 0x1.731703b0b4683p-5, 0x1.454a8ba6d4f9ap-7, -0x1.f078e9d93403cp-9, -0x1.549ca165f683dp-9, -0x1.0b1653978a208p-12, 0x1.9604db055bd07p-13, 0x1.e27432a3e0496p-15, -0x1.3e3d9bca910bbp-18, -0x1.27680c90355adp-18, -0x1.2f4ab4f4209bfp-22, 0x1.ad753b32d4adap-23, 0x1.27e4fb7789f5cp-25, -0x1.8a86a49f629d1p-28, -0x1.3b9eea191bb0dp-29, 0x1.a4d3e2cc24ebcp-32, 0x0p+0,
+	0x1.39f5d6b7dab5fp-3, 0x1.46b695cca7f98p-3, 0x1.c858e10d1e181p-6, -0x1.be2419909c32ep-6, -0x1.72425822faeadp-7, 0x1.8b5d52165cf1p-10, 0x1.82e404c915d4p-10, 0x1.9a931d3adb5aap-15, -0x1.dc959bd6e540dp-14, -0x1.df28b16fe8d9ep-17, 0x1.9033d04a8b8c8p-18, 0x1.4ff6a82fb9f9cp-20, -0x1.dec60fc6c1014p-23, -0x1.385542538367p-24, 0x1.8a86a49f629d1p-28, 0x1.07046dbf97136p-28, -0x1.2c9758daf5cdp-31, 0x0p+0,
+	0x1.3862cf328d72fp-2, 0x1.aa76a8355cd03p-4, -0x1.6362e181cd583p-4, -0x1.0ce1636b8c0e1p-5, 0x1.8462016274f7ep-7, 0x1.4ba23f42ac7cbp-8, -0x1.0e385978b2789p-10, -0x1.0ac2323b853e7p-11, 0x1.0ac2323b853e7p-14, 0x1.3aecac5a9ea78p-15, -0x1.87e7f2eded423p-19, -0x1.23456789abcdfp-19, 0x1.af83440e53dbcp-24, 0x1.bbd779334ef0bp-24, -0x1.522a43f65486ap-29, -0x1.522a43f65486ap-28, 0x1.522a43f65486ap-31, 0x0p+0,
+	0x1.3862cf328d72fp-2, -0x1.aa76a8355cd03p-4, -0x1.6362e181cd583p-4, 0x1.0ce1636b8c0e1p-5, 0x1.8462016274f7ep-7, -0x1.4ba23f42ac7cbp-8, -0x1.0e385978b2789p-10, 0x1.0ac2323b853e7p-11, 0x1.0ac2323b853e7p-14, -0x1.3aecac5a9ea78p-15, -0x1.87e7f2eded423p-19, 0x1.23456789abcdfp-19, 0x1.af83440e53dbcp-24, -0x1.bbd779334ef0bp-24, -0x1.522a43f65486ap-29, 0x1.522a43f65486ap-28, -0x1.2c9758daf5cdp-31, 0x0p+0,
+	0x1.39f5d6b7dab5fp-3, -0x1.46b695cca7f98p-3, 0x1.c858e10d1e181p-6, 0x1.be2419909c32ep-6, -0x1.72425822faeadp-7, -0x1.8b5d52165cf1p-10, 0x1.82e404c915d4p-10, -0x1.9a931d3adb5aap-15, -0x1.dc959bd6e540dp-14, 0x1.df28b16fe8d9ep-17, 0x1.9033d04a8b8c8p-18, -0x1.4ff6a82fb9f9cp-20, -0x1.dec60fc6c1014p-23, 0x1.385542538367p-24, 0x1.8a86a49f629d1p-28, -0x1.07046dbf97136p-28, 0x1.a4d3e2cc24ebcp-32, 0x0p+0,
+	0x1.3239b5c451307p-5, -0x1.12d0168399f65p-4, 0x1.731703b0b4683p-5, -0x1.454a8ba6d4f9ap-7, -0x1.f078e9d93403cp-9, 0x1.549ca165f683dp-9, -0x1.0b1653978a208p-12, -0x1.9604db055bd07p-13, 0x1.e27432a3e0496p-15, 0x1.3e3d9bca910bbp-18, -0x1.27680c90355adp-18, 0x1.2f4ab4f4209bfp-22, 0x1.ad753b32d4adap-23, -0x1.27e4fb7789f5cp-25, -0x1.8a86a49f629d1p-28, 0x1.3b9eea191bb0dp-29, -0x1.cb15b198e2759p-33, 0x0p+0,
+	0x1.0b71ae10862bep-8, -0x1.63a7a5fd9a611p-7, 0x1.9999a17218829p-7, -0x1.fea202429e8fap-8, 0x1.440acafd402d3p-9, -0x1.8cfe5539013aap-15, -0x1.22575a6df0b35p-12, 0x1.8af214b7a4dfep-14, -0x1.dd5c69afd9918p-20, -0x1.c5dbe4615af1ap-18, 0x1.9aa803c0d5c75p-20, 0x1.13b8476992022p-23, -0x1.c46f41264b832p-24, 0x1.42cb40df7f3abp-27, 0x1.f61fba3f37b09p-29, -0x1.1eed8eff8d898p-30, 0x1.7e9213ff6762p-34, 0x0p+0,
+	0x1.660a5ce7830fap-13, -0x1.4e7bd2e05e699p-11, 0x1.1cb0b7e8d806p-10, -0x1.2080839425b8cp-10, 0x1.7a7d0098029aep-11, -0x1.3fbfe5838898p-12, 0x1.264ce4fedb7fp-14, 0x1.01f4211066cf5p-19, -0x1.e9c9473f1e9c9p-18, 0x1.2a768689e8ef7p-19, -0x1.c0c5f4dbb35f7p-24, -0x1.fa9b707b35e6cp-24, 0x1.1833fda590384p-25, -0x1.7e9213ff6762p-32, -0x1.ae64567f544e4p-30, 0x1.7e9213ff6762p-32, -0x1.d6db2c4e09162p-36, 0x0p+0,
+	0x1.0cfe9ef03f163p-19, -0x1.61e5ae871e688p-17, 0x1.b17251ee20c78p-16, -0x1.46b90d9ceb0bep-15, 0x1.511446fee807dp-15, -0x1.f2ff04e8f689ap-16, 0x1.0c4375f664953p-16, -0x1.97d8797756715p-18, 0x1.8334a5116d88ap-20, -0x1.5935d00b76497p-24, -0x1.6e94928fd4296p-24, 0x1.27e4fb7789f5cp-25, -0x1.48c5892f7cd83p-28, -0x1.8d48ed61d7aabp-31, 0x1.e59205b0795edp-32, -0x1.6124613a86d09p-34, 0x1.93974a8c07c9dp-38, 0x0p+0,
+	0x1.ae62a80015dbp-29, -0x1.ae46118cf0341p-26, 0x1.932c165c3a97cp-24, -0x1.d5e107de7fa15p-23, 0x1.7cfb98ca28042p-22, -0x1.c746237f7d946p-22, 0x1.9dd75e48414eep-22, -0x1.229c5267b0a3bp-22, 0x1.3bb57572f8e9bp-23, -0x1.04ab3f0de127cp-24, 0x1.350b9a8deb1d2p-26, -0x1.ae64567f544e4p-29, -0x1.7e9213ff6762p-34, 0x1.08db48ebe51c7p-32, -0x1.47eaec91c654p-34, 0x1.93974a8c07c9dp-37, -0x1.ae7f3e733b81fp-41, 0x0p+0,
+	0x1.ae7f3e733b81fp-45, -0x1.ae7f3e733b81fp-41, 0x1.93974a8c07c9dp-38, -0x1.d6db2c4e09162p-36, 0x1.7e9213ff6762p-34, -0x1.cb15b198e2759p-33, 0x1.a4d3e2cc24ebcp-32, -0x1.2c9758daf5cdp-31, 0x1.522a43f65486ap-31, -0x1.2c9758daf5cdp-31, 0x1.a4d3e2cc24ebcp-32, -0x1.cb15b198e2759p-33, 0x1.7e9213ff6762p-34, -0x1.d6db2c4e09162p-36, 0x1.93974a8c07c9dp-38, -0x1.ae7f3e733b81fp-41, 0x1.ae7f3e733b81fp-45, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 18 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.952c77030ad4ap-49, 0x0p+0,
+	0x1.952c77030ad4ap-49, 0x1.ae7f3e733b81fp-45, 0x1.ae7f3e733b81fp-42, 0x1.0d0f870805313p-39, 0x1.d6db2c4e09162p-38, 0x1.320e7665ec4e6p-36, 0x1.320e7665ec4e6p-35, 0x1.e0f227c4bc7b3p-35, 0x1.2c9758daf5cdp-34, 0x1.2c9758daf5cdp-34, 0x1.e0f227c4bc7b3p-35, 0x1.320e7665ec4e6p-35, 0x1.320e7665ec4e6p-36, 0x1.d6db2c4e09162p-38, 0x1.0d0f870805313p-39, 0x1.ae7f3e733b81fp-42, 0x1.ae7f3e733b81fp-45, -0x1.ae7f3e733b81fp-45, 0x0p+0,
+	0x1.951e3872dbb94p-32, 0x1.ae60f980d767cp-29, 0x1.ae42b48e734d9p-27, 0x1.0cc3daaa0aefcp-25, 0x1.d5d251051d31p-25, 0x1.30b62620b9a49p-24, 0x1.2f5dd5db86fabp-24, 0x1.d87de611c72bp-25, 0x1.220606bb4328cp-25, 0x1.1774b49b90849p-26, 0x1.9d501a2d11f9ep-28, 0x1.b7f4ca3283b0bp-30, 0x1.0bcca7992ec49p-32, -0x1.d6db2c4e09162p-37, -0x1.505368ca067d8p-36, -0x1.78af56a4d411bp-38, -0x1.ae7f3e733b81fp-41, 0x1.ae7f3e733b81fp-42, 0x0p+0,
+	0x1.7eb9523f6845fp-22, 0x1.0c9306463f10cp-19, 0x1.610e8b7e57f06p-18, 0x1.1fea193a8308ap-17, 0x1.44e32c950c8c4p-17, 0x1.0b483fd7762cap-17, 0x1.47ebf2e750623p-18, 0x1.2b32652171c91p-19, 0x1.85aeb450db672p-21, 0x1.351aa21f29431p-23, 0x1.0e88365eaa055p-29, -0x1.42cb40df7f3abp-27, -0x1.ae64567f544e4p-29, -0x1.8d48ed61d7aabp-32, 0x1.2eb177e905d76p-34, 0x1.2eb177e905d76p-35, 0x1.93974a8c07c9dp-38, -0x1.0d0f870805313p-39, 0x0p+0,
+	0x1.5ed31817334dfp-15, 0x1.61d6626bc2134p-13, 0x1.48f43c2641effp-12, 0x1.728e93817f593p-12, 0x1.164abb273e606p-12, 0x1.1defc9b9a9aebp-13, 0x1.80bff19bf6e9dp-15, 0x1.03b251b84bd43p-17, -0x1.0c6944ffc4ec8p-20, -0x1.04b4a3c8a7ff7p-20, -0x1.eecd21aa07693p-23, -0x1.de3698ff413a8p-30, 0x1.b45e9ecf51ebcp-27, 0x1.8b72123589a19p-29, -0x1.d6db2c4e09162p-36, -0x1.2648fbb0c5addp-33, -0x1.d6db2c4e09162p-36, 0x1.d6db2c4e09162p-38, 0x0p+0,
+	0x1.5cdd51e5ce243p-10, 0x1.00415b294a136p-8, 0x1.4ebfe8cf947a8p-8, 0x1.f2af6346a757dp-9, 0x1.b681e15d95217p-10, 0x1.6f1277becc0a6p-12, -0x1.682ace7b35eb8p-15, -0x1.9fe784342d3a5p-15, -0x1.82e273af21a97p-17, 0x1.49490b665ca3cp-21, 0x1.e278ec850c545p-21, 0x1.3f0ed3ad80b83p-23, -0x1.60aeaa6f734e5p-26, -0x1.6ca33b0f6e896p-27, -0x1.7e9213ff6762p-31, 0x1.7e9213ff6762p-32, 0x1.7e9213ff6762p-34, -0x1.320e7665ec4e6p-36, 0x0p+0,
+	0x1.075aea5141edbp-6, 0x1.10cb8002406afp-5, 0x1.ccb64387cd546p-6, 0x1.6640cf1ae85f6p-7, 0x1.17e62a1616c75p-11, -0x1.4834aebc2e7ap-10, -0x1.ce6b78f92361p-12, 0x1.a93758750a7c1p-19, 0x1.2dbef2b097203p-15, 0x1.ba1ba1ba1ba1cp-18, -0x1.34d7001191988p-20, -0x1.21817e2ed94fp-21, -0x1.b926d8a8e99dp-27, 0x1.937e11175f095p-26, 0x1.ae64567f544e4p-29, -0x1.58504532a9d83p-31, -0x1.cb15b198e2759p-33, 0x1.320e7665ec4e6p-35, 0x0p+0,
+	0x1.65a0e41ab043ap-4, 0x1.daced28d8cd3bp-4, 0x1.7a9d1515b5fcbp-5, -0x1.7d1c331b0e4b2p-8, -0x1.3064afb20357dp-7, -0x1.89d362ade30fcp-10, 0x1.66dcdc4b6dfd9p-11, 0x1.033c57d1b27dcp-12, -0x1.2f6013b6a4f9dp-16, -0x1.3f06fb2e97bb5p-16, -0x1.0007e93bb3767p-20, 0x1.f9e5b7e4e9627p-21, 0x1.128638f32c15dp-23, -0x1.1774b49b90849p-25, -0x1.07046dbf97136p-27, 0x1.a4d3e2cc24ebcp-31, 0x1.a4d3e2cc24ebcp-32, -0x1.e0f227c4bc7b3p-35, 0x0p+0,
+	0x1.deb15f6e8d4fbp-3, 0x1.36cfc7ad403p-3, -0x1.c5ed06c7e645ap-6, -0x1.38fb6683633edp-5, -0x1.6e7ab519efa55p-10, 0x1.2f74f09bc65abp-8, 0x1.3663e3a6c700ap-11, -0x1.777decb7e02bcp-12, -0x1.246b640f32f41p-14, 0x1.4a5fe9cf4bc6cp-16, 0x1.5bc57a2bad7e6p-18, -0x1.b1914ce9d309fp-21, -0x1.322b27c105dc9p-22, 0x1.ab673257557f7p-26, 0x1.b0198fbac156bp-27, -0x1.2c9758daf5cdp-31, -0x1.2c9758daf5cdp-31, 0x1.2c9758daf5cdp-34, 0x0p+0,
+	0x1.4ac2f980d2014p-2, 0x0p+0, -0x1.aa76a8355cd03p-4, 0x0p+0, 0x1.0ce1636b8c0e1p-6, 0x0p+0, -0x1.ba2da9ae3b50fp-10, 0x0p+0, 0x1.0ac2323b853e7p-13, 0x0p+0, -0x1.f7e113c4310bfp-18, 0x0p+0, 0x1.845c8a0ce5129p-22, 0x0p+0, -0x1.fb3f65f17ec9ep-27, 0x0p+0, 0x1.522a43f65486ap-31, -0x1.2c9758daf5cdp-34, 0x0p+0,
+	0x1.deb15f6e8d4fbp-3, -0x1.36cfc7ad403p-3, -0x1.c5ed06c7e645ap-6, 0x1.38fb6683633edp-5, -0x1.6e7ab519efa55p-10, -0x1.2f74f09bc65abp-8, 0x1.3663e3a6c700ap-11, 0x1.777decb7e02bcp-12, -0x1.246b640f32f41p-14, -0x1.4a5fe9cf4bc6cp-16, 0x1.5bc57a2bad7e6p-18, 0x1.b1914ce9d309fp-21, -0x1.322b27c105dc9p-22, -0x1.ab673257557f7p-26, 0x1.b0198fbac156bp-27, 0x1.2c9758daf5cdp-31, -0x1.2c9758daf5cdp-31, 0x1.e0f227c4bc7b3p-35, 0x0p+0,
+	0x1.65a0e41ab043ap-4, -0x1.daced28d8cd3bp-4, 0x1.7a9d1515b5fcbp-5, 0x1.7d1c331b0e4b2p-8, -0x1.3064afb20357dp-7, 0x1.89d362ade30fcp-10, 0x1.66dcdc4b6dfd9p-11, -0x1.033c57d1b27dcp-12, -0x1.2f6013b6a4f9dp-16, 0x1.3f06fb2e97bb5p-16, -0x1.0007e93bb3767p-20, -0x1.f9e5b7e4e9627p-21, 0x1.128638f32c15dp-23, 0x1.1774b49b90849p-25, -0x1.07046dbf97136p-27, -0x1.a4d3e2cc24ebcp-31, 0x1.a4d3e2cc24ebcp-32, -0x1.320e7665ec4e6p-35, 0x0p+0,
+	0x1.075aea5141edbp-6, -0x1.10cb8002406afp-5, 0x1.ccb64387cd546p-6, -0x1.6640cf1ae85f6p-7, 0x1.17e62a1616c75p-11, 0x1.4834aebc2e7ap-10, -0x1.ce6b78f92361p-12, -0x1.a93758750a7c1p-19, 0x1.2dbef2b097203p-15, -0x1.ba1ba1ba1ba1cp-18, -0x1.34d7001191988p-20, 0x1.21817e2ed94fp-21, -0x1.b926d8a8e99dp-27, -0x1.937e11175f095p-26, 0x1.ae64567f544e4p-29, 0x1.58504532a9d83p-31, -0x1.cb15b198e2759p-33, 0x1.320e7665ec4e6p-36, 0x0p+0,
+	0x1.5cdd51e5ce243p-10, -0x1.00415b294a136p-8, 0x1.4ebfe8cf947a8p-8, -0x1.f2af6346a757dp-9, 0x1.b681e15d95217p-10, -0x1.6f1277becc0a6p-12, -0x1.682ace7b35eb8p-15, 0x1.9fe784342d3a5p-15, -0x1.82e273af21a97p-17, -0x1.49490b665ca3cp-21, 0x1.e278ec850c545p-21, -0x1.3f0ed3ad80b83p-23, -0x1.60aeaa6f734e5p-26, 0x1.6ca33b0f6e896p-27, -0x1.7e9213ff6762p-31, -0x1.7e9213ff6762p-32, 0x1.7e9213ff6762p-34, -0x1.d6db2c4e09162p-38, 0x0p+0,
+	0x1.5ed31817334dfp-15, -0x1.61d6626bc2134p-13, 0x1.48f43c2641effp-12, -0x1.728e93817f593p-12, 0x1.164abb273e606p-12, -0x1.1defc9b9a9aebp-13, 0x1.80bff19bf6e9dp-15, -0x1.03b251b84bd43p-17, -0x1.0c6944ffc4ec8p-20, 0x1.04b4a3c8a7ff7p-20, -0x1.eecd21aa07693p-23, 0x1.de3698ff413a8p-30, 0x1.b45e9ecf51ebcp-27, -0x1.8b72123589a19p-29, -0x1.d6db2c4e09162p-36, 0x1.2648fbb0c5addp-33, -0x1.d6db2c4e09162p-36, 0x1.0d0f870805313p-39, 0x0p+0,
+	0x1.7eb9523f6845fp-22, -0x1.0c9306463f10cp-19, 0x1.610e8b7e57f06p-18, -0x1.1fea193a8308ap-17, 0x1.44e32c950c8c4p-17, -0x1.0b483fd7762cap-17, 0x1.47ebf2e750623p-18, -0x1.2b32652171c91p-19, 0x1.85aeb450db672p-21, -0x1.351aa21f29431p-23, 0x1.0e88365eaa055p-29, 0x1.42cb40df7f3abp-27, -0x1.ae64567f544e4p-29, 0x1.8d48ed61d7aabp-32, 0x1.2eb177e905d76p-34, -0x1.2eb177e905d76p-35, 0x1.93974a8c07c9dp-38, -0x1.ae7f3e733b81fp-42, 0x0p+0,
+	0x1.951e3872dbb94p-32, -0x1.ae60f980d767cp-29, 0x1.ae42b48e734d9p-27, -0x1.0cc3daaa0aefcp-25, 0x1.d5d251051d31p-25, -0x1.30b62620b9a49p-24, 0x1.2f5dd5db86fabp-24, -0x1.d87de611c72bp-25, 0x1.220606bb4328cp-25, -0x1.1774b49b90849p-26, 0x1.9d501a2d11f9ep-28, -0x1.b7f4ca3283b0bp-30, 0x1.0bcca7992ec49p-32, 0x1.d6db2c4e09162p-37, -0x1.505368ca067d8p-36, 0x1.78af56a4d411bp-38, -0x1.ae7f3e733b81fp-41, 0x1.ae7f3e733b81fp-45, 0x0p+0,
+	0x1.952c77030ad4ap-49, -0x1.ae7f3e733b81fp-45, 0x1.ae7f3e733b81fp-42, -0x1.0d0f870805313p-39, 0x1.d6db2c4e09162p-38, -0x1.320e7665ec4e6p-36, 0x1.320e7665ec4e6p-35, -0x1.e0f227c4bc7b3p-35, 0x1.2c9758daf5cdp-34, -0x1.2c9758daf5cdp-34, 0x1.e0f227c4bc7b3p-35, -0x1.320e7665ec4e6p-35, 0x1.320e7665ec4e6p-36, -0x1.d6db2c4e09162p-38, 0x1.0d0f870805313p-39, -0x1.ae7f3e733b81fp-42, 0x1.ae7f3e733b81fp-45, -0x1.952c77030ad4ap-49, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 19 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.6827863b97d97p-53, 0x0p+0,
+	0x1.6827863b97d97p-53, 0x1.952c77030ad4ap-49, 0x1.ae7f3e733b81fp-46, 0x1.1eff7ef77d015p-43, 0x1.0d0f870805313p-41, 0x1.78af56a4d411bp-40, 0x1.98134887e5bddp-39, 0x1.5dc762bda0599p-38, 0x1.e0f227c4bc7b3p-38, 0x1.0b313289be0b9p-37, 0x1.e0f227c4bc7b3p-38, 0x1.5dc762bda0599p-38, 0x1.98134887e5bddp-39, 0x1.78af56a4d411bp-40, 0x1.0d0f870805313p-41, 0x1.1eff7ef77d015p-43, 0x1.ae7f3e733b81fp-46, 0x1.952c77030ad4ap-49, -0x1.952c77030ad4ap-49, 0x0p+0,
+	0x1.6820d77fda3e6p-35, 0x1.951d6ddca037cp-32, 0x1.ae5f4b0198f48p-30, 0x1.1ed4e50aa444cp-28, 0x1.0cbfa66beecfbp-27, 0x1.77cfae896233dp-27, 0x1.962eb1a1c45dp-27, 0x1.5a88a9331dfccp-27, 0x1.d805a987d5fbep-28, 0x1.0146df29a17e2p-28, 0x1.bd402ed1227ep-30, 0x1.29dbca157a8c4p-31, 0x1.1eed8eff8d898p-33, 0x1.320e7665ec4e6p-36, -0x1.93974a8c07c9dp-40, -0x1.8a9f4e944be1cp-40, -0x1.93974a8c07c9dp-42, -0x1.ae7f3e733b81fp-45, 0x1.ae7f3e733b81fp-46, 0x0p+0,
+	0x1.008e51b1c80e6p-24, 0x1.7e540ab14b8fp-22, 0x1.0c276e07dedaep-20, 0x1.d59f38301648fp-20, 0x1.1edd555fd8fdbp-19, 0x1.027115033925ap-19, 0x1.6133c4b99ba1cp-20, 0x1.7159b1c902997p-21, 0x1.23d06d892aac7p-22, 0x1.4a459fe822d96p-24, 0x1.b6acdf45f1ea6p-27, -0x1.946e8a2b41679p-32, -0x1.f7b7cd87bf965p-31, -0x1.1d74dfa8e8b57p-32, -0x1.b5393b6d087p-36, 0x1.9c8f4683c3b1ep-38, 0x1.5dc762bda0599p-39, 0x1.ae7f3e733b81fp-42, -0x1.1eff7ef77d015p-43, 0x0p+0,
+	0x1.41cf938e4618ep-17, 0x1.5bd5a572b47d6p-15, 0x1.5da41652a917p-14, 0x1.af4002a060c03p-14, 0x1.698f42b7ab40fp-14, 0x1.ad05cf9dbcc66p-15, 0x1.66f9b250430ffp-16, 0x1.88de3a9133466p-18, 0x1.71cb70dfdec3ep-21, -0x1.9bc7a9ead7aacp-23, -0x1.def3267a7b72fp-24, -0x1.6aee01d40180fp-26, 0x1.5eb09254c96f2p-31, 0x1.4ebfd17f7a75cp-30, 0x1.fcb15b4b29d11p-33, -0x1.c06f3662b352p-38, -0x1.71f559ab0723bp-37, -0x1.0d0f870805313p-39, 0x1.0d0f870805313p-41, 0x0p+0,
+	0x1.a5bc363a7bcfcp-12, 0x1.51e6b9251489cp-10, 0x1.ea65502bd805ap-10, 0x1.a2eb86bc407ap-10, 0x1.c45d90d6776cap-11, 0x1.2725c20fd13abp-12, 0x1.2ace192d49995p-15, -0x1.a9aab6e8abe7ap-17, -0x1.e0d418a2402f6p-18, -0x1.3a12ed62cf27p-20, 0x1.5447546311daap-23, 0x1.b8da550b5021ep-24, 0x1.ae64567f544e4p-27, -0x1.5f4d860e38c78p-29, -0x1.08db48ebe51c7p-30, -0x1.88614f965ce7cp-35, 0x1.08db48ebe51c7p-35, 0x1.d6db2c4e09162p-38, -0x1.78af56a4d411bp-40, 0x0p+0,
+	0x1.9e212e5247ca9p-8, 0x1.e31a2a65ca16ep-7, 0x1.e186a93a2e511p-7, 0x1.f6b30c6fe047bp-8, 0x1.d329ec927d12ep-10, -0x1.ddb146ea75fc7p-13, -0x1.17fb887296531p-12, -0x1.dd06ff0b20baep-15, 0x1.ba7af9bb7de21p-18, 0x1.62316335aa424p-18, 0x1.40c2003dd9a43p-21, -0x1.900e2782fa01fp-23, -0x1.ec5c4422f7517p-25, 0x1.452f5dcc4b134p-31, 0x1.4ebfd17f7a75cp-29, 0x1.188d41dd6df28p-32, -0x1.0bcca7992ec49p-34, -0x1.320e7665ec4e6p-36, 0x1.98134887e5bddp-39, 0x0p+0,
+	0x1.6df0c6a19f121p-5, 0x1.23ca29865fc83p-4, 0x1.5269128c6c9e3p-5, 0x1.8b5a88da28dcp-8, -0x1.1267745437c28p-8, -0x1.0182750f83d04p-9, -0x1.5df9150918741p-15, 0x1.512f32bb6d88p-13, 0x1.ffd3d24190d1ap-16, -0x1.930d52437a52cp-18, -0x1.57a4b6174bb63p-19, 0x1.334084dc523abp-26, 0x1.0922675beb908p-23, 0x1.73cf91d5d2134p-27, -0x1.12f8fe5f924e7p-28, -0x1.8b52ae43a68ffp-31, 0x1.7e9213ff6762p-34, 0x1.320e7665ec4e6p-35, -0x1.5dc762bda0599p-38, 0x0p+0,
+	0x1.42071ac782e2cp-3, 0x1.2be0ed61352dep-3, 0x1.25a17999e718ap-6, -0x1.93b7bafbc615p-6, -0x1.0957e02001756p-7, 0x1.9dbbc1b13bd1ep-10, 0x1.0bf130da2a147p-10, -0x1.bb2d73983fe41p-17, -0x1.3d5d2244c954cp-14, -0x1.8105fe74830ap-18, 0x1.03c2c1ff27cdap-18, 0x1.2b79c91358fd1p-21, -0x1.3927ac44e9797p-23, -0x1.10e165105ff0ep-25, 0x1.19cde34d46703p-28, 0x1.72baa9525149ap-30, -0x1.68b59dd38d5c6p-34, -0x1.e0f227c4bc7b3p-35, 0x1.e0f227c4bc7b3p-38, 0x0p+0,
+	0x1.2a59de5f1e7a5p-2, 0x1.6da927262d65ap-4, -0x1.36cfc7ad403p-4, -0x1.a14f3359d9a91p-6, 0x1.38fb6683633edp-7, 0x1.d2db4ac844da4p-9, -0x1.949beb7a5dce4p-11, -0x1.555b344a119c2p-12, 0x1.777decb7e02bcp-15, 0x1.6f153cad70a4p-16, -0x1.084cbb0c3c9fp-19, -0x1.35b0edcb96bdfp-20, 0x1.210b889be206ap-24, 0x1.ab673257557f7p-25, -0x1.e875f063cf6d2p-30, -0x1.f4fc3ec24455ap-30, 0x1.2c9758daf5cdp-35, 0x1.2c9758daf5cdp-34, -0x1.0b313289be0b9p-37, 0x0p+0,
+	0x1.2a59de5f1e7a5p-2, -0x1.6da927262d65ap-4, -0x1.36cfc7ad403p-4, 0x1.a14f3359d9a91p-6, 0x1.38fb6683633edp-7, -0x1.d2db4ac844da4p-9, -0x1.949beb7a5dce4p-11, 0x1.555b344a119c2p-12, 0x1.777decb7e02bcp-15, -0x1.6f153cad70a4p-16, -0x1.084cbb0c3c9fp-19, 0x1.35b0edcb96bdfp-20, 0x1.210b889be206ap-24, -0x1.ab673257557f7p-25, -0x1.e875f063cf6d2p-30, 0x1.f4fc3ec24455ap-30, 0x1.2c9758daf5cdp-35, -0x1.2c9758daf5cdp-34, 0x1.e0f227c4bc7b3p-38, 0x0p+0,
+	0x1.42071ac782e2cp-3, -0x1.2be0ed61352dep-3, 0x1.25a17999e718ap-6, 0x1.93b7bafbc615p-6, -0x1.0957e02001756p-7, -0x1.9dbbc1b13bd1ep-10, 0x1.0bf130da2a147p-10, 0x1.bb2d73983fe41p-17, -0x1.3d5d2244c954cp-14, 0x1.8105fe74830ap-18, 0x1.03c2c1ff27cdap-18, -0x1.2b79c91358fd1p-21, -0x1.3927ac44e9797p-23, 0x1.10e165105ff0ep-25, 0x1.19cde34d46703p-28, -0x1.72baa9525149ap-30, -0x1.68b59dd38d5c6p-34, 0x1.e0f227c4bc7b3p-35, -0x1.5dc762bda0599p-38, 0x0p+0,
+	0x1.6df0c6a19f121p-5, -0x1.23ca29865fc83p-4, 0x1.5269128c6c9e3p-5, -0x1.8b5a88da28dcp-8, -0x1.1267745437c28p-8, 0x1.0182750f83d04p-9, -0x1.5df9150918741p-15, -0x1.512f32bb6d88p-13, 0x1.ffd3d24190d1ap-16, 0x1.930d52437a52cp-18, -0x1.57a4b6174bb63p-19, -0x1.334084dc523abp-26, 0x1.0922675beb908p-23, -0x1.73cf91d5d2134p-27, -0x1.12f8fe5f924e7p-28, 0x1.8b52ae43a68ffp-31, 0x1.7e9213ff6762p-34, -0x1.320e7665ec4e6p-35, 0x1.98134887e5bddp-39, 0x0p+0,
+	0x1.9e212e5247ca9p-8, -0x1.e31a2a65ca16ep-7, 0x1.e186a93a2e511p-7, -0x1.f6b30c6fe047bp-8, 0x1.d329ec927d12ep-10, 0x1.ddb146ea75fc7p-13, -0x1.17fb887296531p-12, 0x1.dd06ff0b20baep-15, 0x1.ba7af9bb7de21p-18, -0x1.62316335aa424p-18, 0x1.40c2003dd9a43p-21, 0x1.900e2782fa01fp-23, -0x1.ec5c4422f7517p-25, -0x1.452f5dcc4b134p-31, 0x1.4ebfd17f7a75cp-29, -0x1.188d41dd6df28p-32, -0x1.0bcca7992ec49p-34, 0x1.320e7665ec4e6p-36, -0x1.78af56a4d411bp-40, 0x0p+0,
+	0x1.a5bc363a7bcfcp-12, -0x1.51e6b9251489cp-10, 0x1.ea65502bd805ap-10, -0x1.a2eb86bc407ap-10, 0x1.c45d90d6776cap-11, -0x1.2725c20fd13abp-12, 0x1.2ace192d49995p-15, 0x1.a9aab6e8abe7ap-17, -0x1.e0d418a2402f6p-18, 0x1.3a12ed62cf27p-20, 0x1.5447546311daap-23, -0x1.b8da550b5021ep-24, 0x1.ae64567f544e4p-27, 0x1.5f4d860e38c78p-29, -0x1.08db48ebe51c7p-30, 0x1.88614f965ce7cp-35, 0x1.08db48ebe51c7p-35, -0x1.d6db2c4e09162p-38, 0x1.0d0f870805313p-41, 0x0p+0,
+	0x1.41cf938e4618ep-17, -0x1.5bd5a572b47d6p-15, 0x1.5da41652a917p-14, -0x1.af4002a060c03p-14, 0x1.698f42b7ab40fp-14, -0x1.ad05cf9dbcc66p-15, 0x1.66f9b250430ffp-16, -0x1.88de3a9133466p-18, 0x1.71cb70dfdec3ep-21, 0x1.9bc7a9ead7aacp-23, -0x1.def3267a7b72fp-24, 0x1.6aee01d40180fp-26, 0x1.5eb09254c96f2p-31, -0x1.4ebfd17f7a75cp-30, 0x1.fcb15b4b29d11p-33, 0x1.c06f3662b352p-38, -0x1.71f559ab0723bp-37, 0x1.0d0f870805313p-39, -0x1.1eff7ef77d015p-43, 0x0p+0,
+	0x1.008e51b1c80e6p-24, -0x1.7e540ab14b8fp-22, 0x1.0c276e07dedaep-20, -0x1.d59f38301648fp-20, 0x1.1edd555fd8fdbp-19, -0x1.027115033925ap-19, 0x1.6133c4b99ba1cp-20, -0x1.7159b1c902997p-21, 0x1.23d06d892aac7p-22, -0x1.4a459fe822d96p-24, 0x1.b6acdf45f1ea6p-27, 0x1.946e8a2b41679p-32, -0x1.f7b7cd87bf965p-31, 0x1.1d74dfa8e8b57p-32, -0x1.b5393b6d087p-36, -0x1.9c8f4683c3b1ep-38, 0x1.5dc762bda0599p-39, -0x1.ae7f3e733b81fp-42, 0x1.ae7f3e733b81fp-46, 0x0p+0,
+	0x1.6820d77fda3e6p-35, -0x1.951d6ddca037cp-32, 0x1.ae5f4b0198f48p-30, -0x1.1ed4e50aa444cp-28, 0x1.0cbfa66beecfbp-27, -0x1.77cfae896233dp-27, 0x1.962eb1a1c45dp-27, -0x1.5a88a9331dfccp-27, 0x1.d805a987d5fbep-28, -0x1.0146df29a17e2p-28, 0x1.bd402ed1227ep-30, -0x1.29dbca157a8c4p-31, 0x1.1eed8eff8d898p-33, -0x1.320e7665ec4e6p-36, -0x1.93974a8c07c9dp-40, 0x1.8a9f4e944be1cp-40, -0x1.93974a8c07c9dp-42, 0x1.ae7f3e733b81fp-45, -0x1.952c77030ad4ap-49, 0x0p+0,
+	0x1.6827863b97d97p-53, -0x1.952c77030ad4ap-49, 0x1.ae7f3e733b81fp-46, -0x1.1eff7ef77d015p-43, 0x1.0d0f870805313p-41, -0x1.78af56a4d411bp-40, 0x1.98134887e5bddp-39, -0x1.5dc762bda0599p-38, 0x1.e0f227c4bc7b3p-38, -0x1.0b313289be0b9p-37, 0x1.e0f227c4bc7b3p-38, -0x1.5dc762bda0599p-38, 0x1.98134887e5bddp-39, -0x1.78af56a4d411bp-40, 0x1.0d0f870805313p-41, -0x1.1eff7ef77d015p-43, 0x1.ae7f3e733b81fp-46, -0x1.952c77030ad4ap-49, 0x1.6827863b97d97p-53, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 20 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.2f49b46814157p-57, 0x0p+0,
+	0x1.2f49b46814157p-57, 0x1.6827863b97d97p-53, 0x1.952c77030ad4ap-50, 0x1.1eff7ef77d015p-47, 0x1.1eff7ef77d015p-45, 0x1.ae7f3e733b81fp-44, 0x1.f63f1e311ac24p-43, 0x1.d25f2e522b222p-42, 0x1.5dc762bda0599p-41, 0x1.ab81ea75fcdf4p-41, 0x1.ab81ea75fcdf4p-41, 0x1.5dc762bda0599p-41, 0x1.d25f2e522b222p-42, 0x1.f63f1e311ac24p-43, 0x1.ae7f3e733b81fp-44, 0x1.1eff7ef77d015p-45, 0x1.1eff7ef77d015p-47, 0x1.952c77030ad4ap-50, 0x1.6827863b97d97p-53, -0x1.6827863b97d97p-53, 0x0p+0,
+	0x1.2f46be2fd1114p-38, 0x1.68207d75f8af8p-35, 0x1.951ca34664b64p-33, 0x1.1ee9130191ab8p-31, 0x1.1ed2a70ba655cp-30, 0x1.adf8b6afb77f6p-30, 0x1.f50536be3c119p-30, 0x1.d0183758446c3p-30, 0x1.5a5cf046c648bp-30, 0x1.a32860e1aeeeep-31, 0x1.9aced74d60fe9p-32, 0x1.4273cf06cfd29p-33, 0x1.89804f155464cp-35, 0x1.594b64c1c2659p-37, 0x1.42df6ed66ca17p-40, -0x1.1eff7ef77d015p-43, -0x1.ae7f3e733b81fp-44, -0x1.952c77030ad4ap-46, -0x1.952c77030ad4ap-49, 0x1.952c77030ad4ap-50, 0x0p+0,
+	0x1.45544eaedae2ep-27, 0x1.00614d96d8131p-24, 0x1.7deec355d466fp-23, 0x1.64fa72f17df0ep-22, 0x1.d480634b0ba4bp-22, 0x1.c94dbc5be1b16p-22, 0x1.56a1b1c63faf4p-22, 0x1.9008761989413p-23, 0x1.6bef8f2436218p-24, 0x1.f9ab4521db40ep-26, 0x1.f6b51cbc0e027p-28, 0x1.168f29c2c4135p-30, -0x1.4d620a1cbcd56p-34, -0x1.621f80c99f5ep-34, -0x1.5c18e37f2d1e1p-36, -0x1.b7773a6af76ap-40, 0x1.ff371a28d6aa5p-42, 0x1.78af56a4d411bp-43, 0x1.ae7f3e733b81fp-46, -0x1.1eff7ef77d015p-47, 0x0p+0,
+	0x1.15c00524e8b7p-19, 0x1.3fce76eae288cp-17, 0x1.58d8fd5d51e64p-16, 0x1.cc99f6236224cp-16, 0x1.a7e985bfa0671p-16, 0x1.1a1379a3bd2d9p-16, 0x1.133f29890622bp-17, 0x1.8107624e78621p-19, 0x1.5ab3045812f33p-21, 0x1.8e05bca249a68p-25, -0x1.cd88617f20df8p-26, -0x1.8434ea76b5977p-27, -0x1.db7b0a39c5f9cp-30, 0x1.06e509cdb401bp-33, 0x1.d0212f543c281p-34, 0x1.2c7378eb16dd6p-36, -0x1.ae7f3e733b81fp-41, -0x1.ae7f3e733b81fp-41, -0x1.1eff7ef77d015p-43, 0x1.1eff7ef77d015p-45, 0x0p+0,
+	0x1.dbb07f391359dp-14, 0x1.9badb99e099fp-12, 0x1.47080bf97ee5dp-11, 0x1.385cb48473a2cp-11, 0x1.87f786923a6ep-12, 0x1.45bc86cc6803ap-13, 0x1.4206b57accd7dp-15, 0x1.10b9b6e737032p-19, -0x1.370cea18a2c56p-19, -0x1.d47dcd1ae007p-21, -0x1.a4298d08b9e9p-24, 0x1.a5a3912ec583p-26, 0x1.6263e3aae056cp-27, 0x1.f6bcadf8a708fp-31, -0x1.28631abed5b83p-32, -0x1.5e56e27d1c181p-34, -0x1.505368ca067d8p-39, 0x1.505368ca067d8p-39, 0x1.0d0f870805313p-41, -0x1.ae7f3e733b81fp-44, 0x0p+0,
+	0x1.2c664aabe12abp-9, 0x1.83c56aeea00d9p-8, 0x1.b8dd53412785bp-8, 0x1.1826aa2322359p-8, 0x1.8df82ac0d0293p-10, 0x1.8191d372022dcp-13, -0x1.63feee58b2d0ap-14, -0x1.6aaa9f896d2bbp-15, -0x1.729c5150f5c1p-18, 0x1.9a5c0829a9ceep-20, 0x1.5a2b4ba51809ap-21, 0x1.56d1b31eaa70dp-25, -0x1.9da78c05c161fp-26, -0x1.71348601b8dbbp-28, 0x1.ee6621b856574p-33, 0x1.f2529ff4b88ccp-33, 0x1.49996bd0398f8p-36, -0x1.78af56a4d411bp-38, -0x1.78af56a4d411bp-40, 0x1.f63f1e311ac24p-43, 0x0p+0,
+	0x1.547a753b0ef6bp-6, 0x1.3a2ca0d75618cp-5, 0x1.cecdc8734d0abp-6, 0x1.22b48afd2c0d4p-7, -0x1.ad620e56ddaeep-12, -0x1.38f4bf93df38fp-10, -0x1.2f89d62bd095fp-12, 0x1.0dfbe213f172ep-15, 0x1.c870f27e35b6cp-16, 0x1.64a0f52d0f6bap-19, -0x1.2ee5e23075087p-20, -0x1.343df8d65ea26p-22, 0x1.244ed0145830ep-26, 0x1.ddd0942d1f411p-27, 0x1.91b2fb65c626ep-31, -0x1.d7d64bdd21a38p-32, -0x1.0bcca7992ec49p-34, 0x1.320e7665ec4e6p-37, 0x1.98134887e5bddp-39, -0x1.d25f2e522b222p-42, 0x0p+0,
+	0x1.82bdce8a34a9bp-4, 0x1.cd15d23e363c8p-4, 0x1.33f7b13c0a939p-5, -0x1.feeb8f53ed851p-8, -0x1.f68e5d32504cp-8, -0x1.9a0d464611da1p-11, 0x1.35958e9ac1262p-11, 0x1.3eb7f89515893p-13, -0x1.6ce209f4f1864p-16, -0x1.8bd730bd7dcf4p-17, 0x1.cd88617f20df8p-26, 0x1.39e0cf4dacd7dp-21, 0x1.827fb13b488fp-25, -0x1.63ded1008319dp-26, -0x1.a2185406a9ab1p-29, 0x1.28f29a7e5176bp-31, 0x1.1c32003a1248dp-33, -0x1.5dc762bda0599p-37, -0x1.5dc762bda0599p-38, 0x1.5dc762bda0599p-41, 0x0p+0,
+	0x1.d515e22bef62fp-3, 0x1.12aca1f6ba11ep-3, -0x1.d431673879ec5p-6, -0x1.00256eb7d14ecp-5, -0x1.b2ef0bc272812p-13, 0x1.cea9054f83c35p-9, 0x1.5aa737ea33ec7p-12, -0x1.0cb65f31e9b45p-12, -0x1.4781c8ad4f9dp-15, 0x1.c0fc87ab4f7b4p-17, 0x1.72abc9d5411ecp-19, -0x1.1d06a28f78cf6p-21, -0x1.324936e382285p-23, 0x1.19a5cf1f4b607p-26, 0x1.90297b16b0d28p-28, -0x1.aed8ee4ae8d9p-32, -0x1.b3db740a4acfap-33, 0x1.e0f227c4bc7b3p-38, 0x1.e0f227c4bc7b3p-38, -0x1.ab81ea75fcdf4p-41, 0x0p+0,
+	0x1.3a0dc1a77e65dp-2, 0x0p+0, -0x1.6da927262d65ap-4, 0x0p+0, 0x1.a14f3359d9a91p-7, 0x0p+0, -0x1.373cdc85833c3p-10, 0x0p+0, 0x1.555b344a119c2p-14, 0x0p+0, -0x1.25aa96f126e99p-18, 0x0p+0, 0x1.9cebe7ba1e529p-23, 0x0p+0, -0x1.e875f063cf6d2p-28, 0x0p+0, 0x1.f4fc3ec24455ap-33, 0x0p+0, -0x1.0b313289be0b9p-37, 0x1.ab81ea75fcdf4p-41, 0x0p+0,
+	0x1.d515e22bef62fp-3, -0x1.12aca1f6ba11ep-3, -0x1.d431673879ec5p-6, 0x1.00256eb7d14ecp-5, -0x1.b2ef0bc272812p-13, -0x1.cea9054f83c35p-9, 0x1.5aa737ea33ec7p-12, 0x1.0cb65f31e9b45p-12, -0x1.4781c8ad4f9dp-15, -0x1.c0fc87ab4f7b4p-17, 0x1.72abc9d5411ecp-19, 0x1.1d06a28f78cf6p-21, -0x1.324936e382285p-23, -0x1.19a5cf1f4b607p-26, 0x1.90297b16b0d28p-28, 0x1.aed8ee4ae8d9p-32, -0x1.b3db740a4acfap-33, -0x1.e0f227c4bc7b3p-38, 0x1.e0f227c4bc7b3p-38, -0x1.5dc762bda0599p-41, 0x0p+0,
+	0x1.82bdce8a34a9bp-4, -0x1.cd15d23e363c8p-4, 0x1.33f7b13c0a939p-5, 0x1.feeb8f53ed851p-8, -0x1.f68e5d32504cp-8, 0x1.9a0d464611da1p-11, 0x1.35958e9ac1262p-11, -0x1.3eb7f89515893p-13, -0x1.6ce209f4f1864p-16, 0x1.8bd730bd7dcf4p-17, 0x1.cd88617f20df8p-26, -0x1.39e0cf4dacd7dp-21, 0x1.827fb13b488fp-25, 0x1.63ded1008319dp-26, -0x1.a2185406a9ab1p-29, -0x1.28f29a7e5176bp-31, 0x1.1c32003a1248dp-33, 0x1.5dc762bda0599p-37, -0x1.5dc762bda0599p-38, 0x1.d25f2e522b222p-42, 0x0p+0,
+	0x1.547a753b0ef6bp-6, -0x1.3a2ca0d75618cp-5, 0x1.cecdc8734d0abp-6, -0x1.22b48afd2c0d4p-7, -0x1.ad620e56ddaeep-12, 0x1.38f4bf93df38fp-10, -0x1.2f89d62bd095fp-12, -0x1.0dfbe213f172ep-15, 0x1.c870f27e35b6cp-16, -0x1.64a0f52d0f6bap-19, -0x1.2ee5e23075087p-20, 0x1.343df8d65ea26p-22, 0x1.244ed0145830ep-26, -0x1.ddd0942d1f411p-27, 0x1.91b2fb65c626ep-31, 0x1.d7d64bdd21a38p-32, -0x1.0bcca7992ec49p-34, -0x1.320e7665ec4e6p-37, 0x1.98134887e5bddp-39, -0x1.f63f1e311ac24p-43, 0x0p+0,
+	0x1.2c664aabe12abp-9, -0x1.83c56aeea00d9p-8, 0x1.b8dd53412785bp-8, -0x1.1826aa2322359p-8, 0x1.8df82ac0d0293p-10, -0x1.8191d372022dcp-13, -0x1.63feee58b2d0ap-14, 0x1.6aaa9f896d2bbp-15, -0x1.729c5150f5c1p-18, -0x1.9a5c0829a9ceep-20, 0x1.5a2b4ba51809ap-21, -0x1.56d1b31eaa70dp-25, -0x1.9da78c05c161fp-26, 0x1.71348601b8dbbp-28, 0x1.ee6621b856574p-33, -0x1.f2529ff4b88ccp-33, 0x1.49996bd0398f8p-36, 0x1.78af56a4d411bp-38, -0x1.78af56a4d411bp-40, 0x1.ae7f3e733b81fp-44, 0x0p+0,
+	0x1.dbb07f391359dp-14, -0x1.9badb99e099fp-12, 0x1.47080bf97ee5dp-11, -0x1.385cb48473a2cp-11, 0x1.87f786923a6ep-12, -0x1.45bc86cc6803ap-13, 0x1.4206b57accd7dp-15, -0x1.10b9b6e737032p-19, -0x1.370cea18a2c56p-19, 0x1.d47dcd1ae007p-21, -0x1.a4298d08b9e9p-24, -0x1.a5a3912ec583p-26, 0x1.6263e3aae056cp-27, -0x1.f6bcadf8a708fp-31, -0x1.28631abed5b83p-32, 0x1.5e56e27d1c181p-34, -0x1.505368ca067d8p-39, -0x1.505368ca067d8p-39, 0x1.0d0f870805313p-41, -0x1.1eff7ef77d015p-45, 0x0p+0,
+	0x1.15c00524e8b7p-19, -0x1.3fce76eae288cp-17, 0x1.58d8fd5d51e64p-16, -0x1.cc99f6236224cp-16, 0x1.a7e985bfa0671p-16, -0x1.1a1379a3bd2d9p-16, 0x1.133f29890622bp-17, -0x1.8107624e78621p-19, 0x1.5ab3045812f33p-21, -0x1.8e05bca249a68p-25, -0x1.cd88617f20df8p-26, 0x1.8434ea76b5977p-27, -0x1.db7b0a39c5f9cp-30, -0x1.06e509cdb401bp-33, 0x1.d0212f543c281p-34, -0x1.2c7378eb16dd6p-36, -0x1.ae7f3e733b81fp-41, 0x1.ae7f3e733b81fp-41, -0x1.1eff7ef77d015p-43, 0x1.1eff7ef77d015p-47, 0x0p+0,
+	0x1.45544eaedae2ep-27, -0x1.00614d96d8131p-24, 0x1.7deec355d466fp-23, -0x1.64fa72f17df0ep-22, 0x1.d480634b0ba4bp-22, -0x1.c94dbc5be1b16p-22, 0x1.56a1b1c63faf4p-22, -0x1.9008761989413p-23, 0x1.6bef8f2436218p-24, -0x1.f9ab4521db40ep-26, 0x1.f6b51cbc0e027p-28, -0x1.168f29c2c4135p-30, -0x1.4d620a1cbcd56p-34, 0x1.621f80c99f5ep-34, -0x1.5c18e37f2d1e1p-36, 0x1.b7773a6af76ap-40, 0x1.ff371a28d6aa5p-42, -0x1.78af56a4d411bp-43, 0x1.ae7f3e733b81fp-46, -0x1.952c77030ad4ap-50, 0x0p+0,
+	0x1.2f46be2fd1114p-38, -0x1.68207d75f8af8p-35, 0x1.951ca34664b64p-33, -0x1.1ee9130191ab8p-31, 0x1.1ed2a70ba655cp-30, -0x1.adf8b6afb77f6p-30, 0x1.f50536be3c119p-30, -0x1.d0183758446c3p-30, 0x1.5a5cf046c648bp-30, -0x1.a32860e1aeeeep-31, 0x1.9aced74d60fe9p-32, -0x1.4273cf06cfd29p-33, 0x1.89804f155464cp-35, -0x1.594b64c1c2659p-37, 0x1.42df6ed66ca17p-40, 0x1.1eff7ef77d015p-43, -0x1.ae7f3e733b81fp-44, 0x1.952c77030ad4ap-46, -0x1.952c77030ad4ap-49, 0x1.6827863b97d97p-53, 0x0p+0,
+	0x1.2f49b46814157p-57, -0x1.6827863b97d97p-53, 0x1.952c77030ad4ap-50, -0x1.1eff7ef77d015p-47, 0x1.1eff7ef77d015p-45, -0x1.ae7f3e733b81fp-44, 0x1.f63f1e311ac24p-43, -0x1.d25f2e522b222p-42, 0x1.5dc762bda0599p-41, -0x1.ab81ea75fcdf4p-41, 0x1.ab81ea75fcdf4p-41, -0x1.5dc762bda0599p-41, 0x1.d25f2e522b222p-42, -0x1.f63f1e311ac24p-43, 0x1.ae7f3e733b81fp-44, -0x1.1eff7ef77d015p-45, 0x1.1eff7ef77d015p-47, -0x1.952c77030ad4ap-50, 0x1.6827863b97d97p-53, -0x1.2f49b46814157p-57, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 21 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.e542ba4020225p-62, 0x0p+0,
+	0x1.e542ba4020225p-62, 0x1.2f49b46814157p-57, 0x1.6827863b97d97p-54, 0x1.0e1da4acb1e32p-51, 0x1.1eff7ef77d015p-49, 0x1.cb3264bf2e688p-48, 0x1.1eff7ef77d015p-46, 0x1.1eff7ef77d015p-45, 0x1.d25f2e522b222p-45, 0x1.36ea1ee17216cp-44, 0x1.5601885e63e5dp-44, 0x1.36ea1ee17216cp-44, 0x1.d25f2e522b222p-45, 0x1.1eff7ef77d015p-45, 0x1.1eff7ef77d015p-46, 0x1.cb3264bf2e688p-48, 0x1.1eff7ef77d015p-49, 0x1.0e1da4acb1e32p-51, 0x1.6827863b97d97p-54, 0x1.2f49b46814157p-57, -0x1.2f49b46814157p-57, 0x0p+0,
+	0x1.e5403d588bae2p-42, 0x1.2f4698469a844p-38, 0x1.6820236c1720ap-36, 0x1.0e12907570cddp-34, 0x1.1ee7f40212b41p-33, 0x1.cae70e7aa70aep-33, 0x1.1ea15321d3cc4p-32, 0x1.1e43274c2a974p-32, 0x1.cffb11655f498p-33, 0x1.33b9f850624b4p-33, 0x1.4efe005274596p-34, 0x1.2a29849d32e8dp-35, 0x1.ac1d5f856d985p-37, 0x1.dfd32845c4fe3p-39, 0x1.81a7529c8ff9cp-41, 0x1.3bb2a5436fe7dp-44, -0x1.66bf5eb55c41ap-47, -0x1.b6f02b98a1111p-48, -0x1.7ea9fe9f51571p-50, -0x1.6827863b97d97p-53, 0x1.6827863b97d97p-54, 0x0p+0,
+	0x1.87761e1698194p-30, 0x1.452e65d714e8cp-27, 0x1.003449872954p-25, 0x1.fcb7503c03bdp-25, 0x1.646afe67fd28p-24, 0x1.75e7a6e999985p-24, 0x1.2fbfd7c376a69p-24, 0x1.8557a0a401a84p-25, 0x1.8c6845aad8b85p-26, 0x1.3eb0185818077p-27, 0x1.8a0e6815716dfp-29, 0x1.5aeeae053ff63p-31, 0x1.3dab952d38216p-34, -0x1.463c6d5353188p-37, -0x1.c60a33dd88c31p-38, -0x1.88d41c2f8cb36p-40, -0x1.93974a8c07c9dp-44, 0x1.2337f58a2fc8dp-45, 0x1.7bd9af92da276p-47, 0x1.952c77030ad4ap-50, -0x1.0e1da4acb1e32p-51, 0x0p+0,
+	0x1.c50aabebb2f54p-22, 0x1.147ab0d639dc2p-19, 0x1.3dcdb44fb4d8ap-18, 0x1.c7d17fc8dda75p-18, 0x1.c7060c579c2dp-18, 0x1.4d46035b902d3p-18, 0x1.6e93039867891p-19, 0x1.2e54b2433b984p-20, 0x1.6806daecdfcep-22, 0x1.0bbd65bc0ad47p-24, 0x1.d099ed0459adp-30, -0x1.ab0fc07ea6176p-29, -0x1.1a048a74b4114p-30, -0x1.17c7f23623cc9p-33, 0x1.f6ce9df09680cp-37, 0x1.25f2e23de1d52p-37, 0x1.47eaec91c654p-40, -0x1.42df6ed66ca17p-44, -0x1.d25f2e522b222p-45, -0x1.1eff7ef77d015p-47, 0x1.1eff7ef77d015p-49, 0x0p+0,
+	0x1.f776e6232a9f5p-16, 0x1.d3027f0fec141p-14, 0x1.91af45e6b28acp-13, 0x1.a5ac5abe1b1e3p-13, 0x1.29f7e4d35891ap-13, 0x1.2460be91cd1fap-14, 0x1.834d74ca95d29p-16, 0x1.216355d2e85a8p-18, -0x1.c136ad9d057bap-24, -0x1.618898297873cp-22, -0x1.8ab1ba50d0812p-24, -0x1.bb50a9afeb303p-28, 0x1.9a7eaef16adf2p-29, 0x1.fd52cb0295076p-31, 0x1.f3719f73b009cp-35, -0x1.b7ea070427359p-36, -0x1.a973c0b7e1cf7p-38, -0x1.ae7f3e733b81fp-44, 0x1.8a9f4e944be1cp-43, 0x1.1eff7ef77d015p-45, -0x1.cb3264bf2e688p-48, 0x0p+0,
+	0x1.95134beece6ap-11, 0x1.1d88c6b2188fep-9, 0x1.6a0a8f54bf73ap-9, 0x1.0aa836814fc5fp-9, 0x1.e236272527827p-11, 0x1.dff6db6068e2bp-13, 0x1.3f1c43733635fp-18, -0x1.276f053132fep-16, -0x1.7bb63af7e09bep-18, -0x1.7e5fc07a07c41p-22, 0x1.01d792afa3edcp-22, 0x1.21f4b8330b1c3p-24, 0x1.5fffc6be147e2p-30, -0x1.6b998886e36aap-29, -0x1.edc4b200eb20fp-32, 0x1.21e9b0db33acbp-35, 0x1.50bf0899a34c6p-36, 0x1.5dc762bda0599p-40, -0x1.e44f2641a2f23p-42, -0x1.ae7f3e733b81fp-44, 0x1.1eff7ef77d015p-46, 0x0p+0,
+	0x1.22e79f2105142p-7, 0x1.2eedabe592d16p-6, 0x1.09b3f37982171p-6, 0x1.d61def840437p-8, 0x1.2d426bd735e4fp-10, -0x1.94408b786c772p-12, -0x1.e1894d5829fe4p-13, -0x1.ea603cc3bfbafp-16, 0x1.3c5340ceaf4f5p-17, 0x1.e8155b65bbb0ep-19, 0x1.e4a30380bb40bp-24, -0x1.5a2b4ba51809ap-23, -0x1.d4203ef84540ap-26, 0x1.b27038ad99957p-29, 0x1.7a8631d1221adp-30, 0x1.28a3add5009acp-35, -0x1.687fcdebbef4fp-35, -0x1.49996bd0398f8p-38, 0x1.b7773a6af76ap-41, 0x1.f63f1e311ac24p-43, -0x1.1eff7ef77d015p-45, 0x0p+0,
+	0x1.a40c71bb5bcb2p-5, 0x1.2d9f313b70ec1p-4, 0x1.2fff81d28b302p-5, 0x1.98599ab76af6ap-9, -0x1.111529539167ep-8, -0x1.7c936370b5274p-10, 0x1.1fd04bd790ca7p-14, 0x1.07a16a1bce89cp-13, 0x1.f67200203258fp-17, -0x1.6d0870332de24p-18, -0x1.83ff8b3a34882p-20, 0x1.c31179c38de2cp-24, 0x1.37ffdd25e81b5p-24, 0x1.27cf1f015e1bcp-29, -0x1.53df7d31c18f1p-29, -0x1.148b3d4452c6dp-32, 0x1.0a6ee03671244p-34, 0x1.89804f155464cp-37, -0x1.237b7cf35af55p-40, -0x1.d25f2e522b222p-42, 0x1.d25f2e522b222p-45, 0x0p+0,
+	0x1.471c63bd3b85dp-3, 0x1.13b6fae6d50e2p-3, 0x1.610dc6bcf79d4p-7, -0x1.6960433ada5bdp-6, -0x1.808ff99aa73c4p-8, 0x1.872bea4363c66p-10, 0x1.78c839eb5ad14p-11, -0x1.37722a9f34ffcp-15, -0x1.ac125b7c7478ep-15, -0x1.01e4ea217df52p-19, 0x1.51ee49c38551p-19, 0x1.0af4e3b030a0cp-22, -0x1.8f44f6936e6f8p-24, -0x1.efe3dc8cb685p-27, 0x1.6c4bc936bf215p-29, 0x1.44e9691ef1f33p-31, -0x1.002f88d1e2f1ap-34, -0x1.52d927a7b356cp-36, 0x1.06558a0e38433p-40, 0x1.5dc762bda0599p-41, -0x1.36ea1ee17216cp-44, 0x0p+0,
+	0x1.1e067f063aa15p-2, 0x1.3e0b42461ad16p-4, -0x1.12aca1f6ba11ep-4, -0x1.4b7bbc756938cp-6, 0x1.00256eb7d14ecp-7, 0x1.5348bfa0b5f5ap-9, -0x1.3470ae3502824p-11, -0x1.c6be79b6edf61p-13, 0x1.0cb65f31e9b45p-15, 0x1.c0fc87ab4f7b4p-17, -0x1.67306c890c629p-20, -0x1.5c5d715a056f4p-21, 0x1.7c08d8bf4bbf3p-25, 0x1.ba96d7c37673p-26, -0x1.41e2114856252p-30, -0x1.d9ee9fb8cceebp-31, 0x1.aed8ee4ae8d9p-36, 0x1.b8ddf9c9acc64p-36, -0x1.ab81ea75fcdf4p-42, -0x1.ab81ea75fcdf4p-41, 0x1.5601885e63e5dp-44, 0x0p+0,
+	0x1.1e067f063aa15p-2, -0x1.3e0b42461ad16p-4, -0x1.12aca1f6ba11ep-4, 0x1.4b7bbc756938cp-6, 0x1.00256eb7d14ecp-7, -0x1.5348bfa0b5f5ap-9, -0x1.3470ae3502824p-11, 0x1.c6be79b6edf61p-13, 0x1.0cb65f31e9b45p-15, -0x1.c0fc87ab4f7b4p-17, -0x1.67306c890c629p-20, 0x1.5c5d715a056f4p-21, 0x1.7c08d8bf4bbf3p-25, -0x1.ba96d7c37673p-26, -0x1.41e2114856252p-30, 0x1.d9ee9fb8cceebp-31, 0x1.aed8ee4ae8d9p-36, -0x1.b8ddf9c9acc64p-36, -0x1.ab81ea75fcdf4p-42, 0x1.ab81ea75fcdf4p-41, -0x1.36ea1ee17216cp-44, 0x0p+0,
+	0x1.471c63bd3b85dp-3, -0x1.13b6fae6d50e2p-3, 0x1.610dc6bcf79d4p-7, 0x1.6960433ada5bdp-6, -0x1.808ff99aa73c4p-8, -0x1.872bea4363c66p-10, 0x1.78c839eb5ad14p-11, 0x1.37722a9f34ffcp-15, -0x1.ac125b7c7478ep-15, 0x1.01e4ea217df52p-19, 0x1.51ee49c38551p-19, -0x1.0af4e3b030a0cp-22, -0x1.8f44f6936e6f8p-24, 0x1.efe3dc8cb685p-27, 0x1.6c4bc936bf215p-29, -0x1.44e9691ef1f33p-31, -0x1.002f88d1e2f1ap-34, 0x1.52d927a7b356cp-36, 0x1.06558a0e38433p-40, -0x1.5dc762bda0599p-41, 0x1.d25f2e522b222p-45, 0x0p+0,
+	0x1.a40c71bb5bcb2p-5, -0x1.2d9f313b70ec1p-4, 0x1.2fff81d28b302p-5, -0x1.98599ab76af6ap-9, -0x1.111529539167ep-8, 0x1.7c936370b5274p-10, 0x1.1fd04bd790ca7p-14, -0x1.07a16a1bce89cp-13, 0x1.f67200203258fp-17, 0x1.6d0870332de24p-18, -0x1.83ff8b3a34882p-20, -0x1.c31179c38de2cp-24, 0x1.37ffdd25e81b5p-24, -0x1.27cf1f015e1bcp-29, -0x1.53df7d31c18f1p-29, 0x1.148b3d4452c6dp-32, 0x1.0a6ee03671244p-34, -0x1.89804f155464cp-37, -0x1.237b7cf35af55p-40, 0x1.d25f2e522b222p-42, -0x1.1eff7ef77d015p-45, 0x0p+0,
+	0x1.22e79f2105142p-7, -0x1.2eedabe592d16p-6, 0x1.09b3f37982171p-6, -0x1.d61def840437p-8, 0x1.2d426bd735e4fp-10, 0x1.94408b786c772p-12, -0x1.e1894d5829fe4p-13, 0x1.ea603cc3bfbafp-16, 0x1.3c5340ceaf4f5p-17, -0x1.e8155b65bbb0ep-19, 0x1.e4a30380bb40bp-24, 0x1.5a2b4ba51809ap-23, -0x1.d4203ef84540ap-26, -0x1.b27038ad99957p-29, 0x1.7a8631d1221adp-30, -0x1.28a3add5009acp-35, -0x1.687fcdebbef4fp-35, 0x1.49996bd0398f8p-38, 0x1.b7773a6af76ap-41, -0x1.f63f1e311ac24p-43, 0x1.1eff7ef77d015p-46, 0x0p+0,
+	0x1.95134beece6ap-11, -0x1.1d88c6b2188fep-9, 0x1.6a0a8f54bf73ap-9, -0x1.0aa836814fc5fp-9, 0x1.e236272527827p-11, -0x1.dff6db6068e2bp-13, 0x1.3f1c43733635fp-18, 0x1.276f053132fep-16, -0x1.7bb63af7e09bep-18, 0x1.7e5fc07a07c41p-22, 0x1.01d792afa3edcp-22, -0x1.21f4b8330b1c3p-24, 0x1.5fffc6be147e2p-30, 0x1.6b998886e36aap-29, -0x1.edc4b200eb20fp-32, -0x1.21e9b0db33acbp-35, 0x1.50bf0899a34c6p-36, -0x1.5dc762bda0599p-40, -0x1.e44f2641a2f23p-42, 0x1.ae7f3e733b81fp-44, -0x1.cb3264bf2e688p-48, 0x0p+0,
+	0x1.f776e6232a9f5p-16, -0x1.d3027f0fec141p-14, 0x1.91af45e6b28acp-13, -0x1.a5ac5abe1b1e3p-13, 0x1.29f7e4d35891ap-13, -0x1.2460be91cd1fap-14, 0x1.834d74ca95d29p-16, -0x1.216355d2e85a8p-18, -0x1.c136ad9d057bap-24, 0x1.618898297873cp-22, -0x1.8ab1ba50d0812p-24, 0x1.bb50a9afeb303p-28, 0x1.9a7eaef16adf2p-29, -0x1.fd52cb0295076p-31, 0x1.f3719f73b009cp-35, 0x1.b7ea070427359p-36, -0x1.a973c0b7e1cf7p-38, 0x1.ae7f3e733b81fp-44, 0x1.8a9f4e944be1cp-43, -0x1.1eff7ef77d015p-45, 0x1.1eff7ef77d015p-49, 0x0p+0,
+	0x1.c50aabebb2f54p-22, -0x1.147ab0d639dc2p-19, 0x1.3dcdb44fb4d8ap-18, -0x1.c7d17fc8dda75p-18, 0x1.c7060c579c2dp-18, -0x1.4d46035b902d3p-18, 0x1.6e93039867891p-19, -0x1.2e54b2433b984p-20, 0x1.6806daecdfcep-22, -0x1.0bbd65bc0ad47p-24, 0x1.d099ed0459adp-30, 0x1.ab0fc07ea6176p-29, -0x1.1a048a74b4114p-30, 0x1.17c7f23623cc9p-33, 0x1.f6ce9df09680cp-37, -0x1.25f2e23de1d52p-37, 0x1.47eaec91c654p-40, 0x1.42df6ed66ca17p-44, -0x1.d25f2e522b222p-45, 0x1.1eff7ef77d015p-47, -0x1.0e1da4acb1e32p-51, 0x0p+0,
+	0x1.87761e1698194p-30, -0x1.452e65d714e8cp-27, 0x1.003449872954p-25, -0x1.fcb7503c03bdp-25, 0x1.646afe67fd28p-24, -0x1.75e7a6e999985p-24, 0x1.2fbfd7c376a69p-24, -0x1.8557a0a401a84p-25, 0x1.8c6845aad8b85p-26, -0x1.3eb0185818077p-27, 0x1.8a0e6815716dfp-29, -0x1.5aeeae053ff63p-31, 0x1.3dab952d38216p-34, 0x1.463c6d5353188p-37, -0x1.c60a33dd88c31p-38, 0x1.88d41c2f8cb36p-40, -0x1.93974a8c07c9dp-44, -0x1.2337f58a2fc8dp-45, 0x1.7bd9af92da276p-47, -0x1.952c77030ad4ap-50, 0x1.6827863b97d97p-54, 0x0p+0,
+	0x1.e5403d588bae2p-42, -0x1.2f4698469a844p-38, 0x1.6820236c1720ap-36, -0x1.0e12907570cddp-34, 0x1.1ee7f40212b41p-33, -0x1.cae70e7aa70aep-33, 0x1.1ea15321d3cc4p-32, -0x1.1e43274c2a974p-32, 0x1.cffb11655f498p-33, -0x1.33b9f850624b4p-33, 0x1.4efe005274596p-34, -0x1.2a29849d32e8dp-35, 0x1.ac1d5f856d985p-37, -0x1.dfd32845c4fe3p-39, 0x1.81a7529c8ff9cp-41, -0x1.3bb2a5436fe7dp-44, -0x1.66bf5eb55c41ap-47, 0x1.b6f02b98a1111p-48, -0x1.7ea9fe9f51571p-50, 0x1.6827863b97d97p-53, -0x1.2f49b46814157p-57, 0x0p+0,
+	0x1.e542ba4020225p-62, -0x1.2f49b46814157p-57, 0x1.6827863b97d97p-54, -0x1.0e1da4acb1e32p-51, 0x1.1eff7ef77d015p-49, -0x1.cb3264bf2e688p-48, 0x1.1eff7ef77d015p-46, -0x1.1eff7ef77d015p-45, 0x1.d25f2e522b222p-45, -0x1.36ea1ee17216cp-44, 0x1.5601885e63e5dp-44, -0x1.36ea1ee17216cp-44, 0x1.d25f2e522b222p-45, -0x1.1eff7ef77d015p-45, 0x1.1eff7ef77d015p-46, -0x1.cb3264bf2e688p-48, 0x1.1eff7ef77d015p-49, -0x1.0e1da4acb1e32p-51, 0x1.6827863b97d97p-54, -0x1.2f49b46814157p-57, 0x1.e542ba4020225p-62, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 22 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.71b8ef6dcf572p-66, 0x0p+0,
+	0x1.71b8ef6dcf572p-66, 0x1.e542ba4020225p-62, 0x1.2f49b46814157p-58, 0x1.e034b2fa1fccap-56, 0x1.0e1da4acb1e32p-53, 0x1.cb3264bf2e688p-52, 0x1.3221987f7445ap-50, 0x1.47ff6c888edcfp-49, 0x1.1eff7ef77d015p-48, 0x1.9e8d7e81ed73ap-48, 0x1.f17697cf1cf13p-48, 0x1.f17697cf1cf13p-48, 0x1.9e8d7e81ed73ap-48, 0x1.1eff7ef77d015p-48, 0x1.47ff6c888edcfp-49, 0x1.3221987f7445ap-50, 0x1.cb3264bf2e688p-52, 0x1.0e1da4acb1e32p-53, 0x1.e034b2fa1fccap-56, 0x1.2f49b46814157p-58, 0x1.e542ba4020225p-62, -0x1.e542ba4020225p-62, 0x0p+0,
+	0x1.71b7f13eaabbap-45, 0x1.e5401f04600a2p-42, 0x1.2f46725d63f74p-39, 0x1.e02a61d8476cfp-38, 0x1.0e1209669e777p-36, 0x1.cb0aee6a85fa8p-36, 0x1.31ecfab93e5dbp-35, 0x1.478eacbb3febdp-35, 0x1.1e3a2f5032db6p-35, 0x1.9c537bf3facd2p-36, 0x1.ec1e91ada3619p-37, 0x1.e6c68b8c29d2p-38, 0x1.8cbd6a12583fbp-39, 0x1.06558a0e38433p-40, 0x1.0f9f85e1164efp-42, 0x1.91cc1827489b7p-45, 0x1.1eff7ef77d015p-48, -0x1.952c77030ad4ap-51, -0x1.a42e1c9adbd31p-52, -0x1.5532eaf516982p-54, -0x1.2f49b46814157p-57, 0x1.2f49b46814157p-58, 0x0p+0,
+	0x1.c03df03592d5fp-33, 0x1.8757ca12c2908p-30, 0x1.45087d040c157p-28, 0x1.555f0758fa6c2p-27, 0x1.fc3046f3c9049p-27, 0x1.1cafa1f1967efp-26, 0x1.f158448325b1p-27, 0x1.59dcd08060f0ep-27, 0x1.831b1a5569531p-28, 0x1.5d23d4eab716ep-29, 0x1.f6351a57bd96dp-31, 0x1.16f9118215abp-32, 0x1.b5bac7a4910a3p-35, 0x1.451d6dd45b9b7p-38, -0x1.fdef1abc4e1b7p-41, -0x1.0bdd656f85bcfp-41, -0x1.9c8f4683c3b1ep-44, -0x1.51a50dd7de5bep-48, 0x1.33a1c2a83c5f1p-49, 0x1.6827863b97d97p-51, 0x1.6827863b97d97p-54, -0x1.e034b2fa1fccap-56, 0x0p+0,
+	0x1.5e6adb025be8fp-24, 0x1.c38335cd9c5d2p-22, 0x1.1335827062c73p-20, 0x1.a511ba50de07fp-20, 0x1.c3d81128659fdp-20, 0x1.67904d17fcf9ep-20, 0x1.b49330ffe25e7p-21, 0x1.9818058bc45fep-22, 0x1.2229f53e1b8afp-23, 0x1.2a004cf3bae5cp-25, 0x1.6ca56ab4d9526p-28, -0x1.d68fd60981b88p-34, -0x1.56879d554eb8ap-32, -0x1.7388f0f5932b7p-34, -0x1.28727ab7ec1efp-37, 0x1.853db7660e569p-40, 0x1.570d65c3d36b9p-41, 0x1.4c5e79a07ee27p-44, -0x1.a06db334e7937p-48, -0x1.d8b3e02e374d7p-49, -0x1.0e1da4acb1e32p-51, 0x1.0e1da4acb1e32p-53, 0x0p+0,
+	0x1.f66965668f5c8p-18, 0x1.f062bb737bd38p-16, 0x1.ca5ea9893a453p-15, 0x1.052b3ad82342ap-14, 0x1.976dcebfd430fp-15, 0x1.c5ff871a92b39p-16, 0x1.6a107dd01ad11p-17, 0x1.864384f6534acp-19, 0x1.ab9c528432e8ep-22, -0x1.a3d95af572d29p-25, -0x1.505ff479fc20bp-25, -0x1.245475d50162dp-27, -0x1.32610c962030bp-32, 0x1.53630c69b43fdp-32, 0x1.4b02bb2dc7fcep-34, 0x1.8ea87ff6fa0a3p-39, -0x1.2571bc118c101p-39, -0x1.dd952947d6042p-42, -0x1.7ea9fe9f51571p-50, 0x1.ae7f3e733b81fp-47, 0x1.1eff7ef77d015p-49, -0x1.cb3264bf2e688p-52, 0x0p+0,
+	0x1.fee46cb2bf33p-13, 0x1.855794bdb5151p-11, 0x1.0ef0b2b9992f4p-10, 0x1.c13f79487064p-11, 0x1.e09ae1aadc282p-12, 0x1.462cf18d0de4dp-13, 0x1.bd08a574adc3ep-16, -0x1.5f75047d772a6p-19, -0x1.6fc7daa5ed14ap-19, -0x1.4b48558f7ce8dp-21, -0x1.71286a6d90d13p-29, 0x1.0348bb1a117e9p-25, 0x1.a78d03bd62699p-28, -0x1.209c0e3e00c5p-33, -0x1.188821dfbbd05p-32, -0x1.28a3add5009acp-35, 0x1.fddeb45d47478p-39, 0x1.a10b447fa1a5ep-40, 0x1.4ed4becb672c3p-44, -0x1.1eff7ef77d015p-45, -0x1.cb3264bf2e688p-48, 0x1.3221987f7445ap-50, 0x0p+0,
+	0x1.cc353a1cc4032p-9, 0x1.09966a62182d8p-7, 0x1.0b3c930f4fbf6p-7, 0x1.25ee2cbe8d8b7p-8, 0x1.50c9d4435c541p-10, 0x1.80fbce840db14p-15, -0x1.ad7d50c5c09bp-14, -0x1.18dcad66b8f6dp-15, -0x1.85e26f251979ep-20, 0x1.c1f053d08de11p-20, 0x1.acb442c3fd545p-22, -0x1.8d9f79a154b33p-27, -0x1.476e6fd4690fdp-26, -0x1.2d9dae6504054p-29, 0x1.c80592f96c001p-32, 0x1.0bb7213c75ce7p-33, 0x1.ae7f3e733b81fp-45, -0x1.f1c320353cce4p-39, -0x1.72b4aeaa56cc5p-42, 0x1.1eff7ef77d015p-44, 0x1.1eff7ef77d015p-46, -0x1.47ff6c888edcfp-49, 0x0p+0,
+	0x1.a1015aef16de7p-6, 0x1.5b5289f31a862p-5, 0x1.c3c78c84186f6p-6, 0x1.c864158f7061ap-8, -0x1.09f122284ebbcp-10, -0x1.16b7d03ab24dbp-10, -0x1.74af00c3780cap-13, 0x1.6565666ff838dp-15, 0x1.44ed71b446812p-16, 0x1.4ae1541f21d84p-21, -0x1.e7427e51a2fbcp-21, -0x1.30359f98e8e5fp-23, 0x1.7d22b059e9fcbp-26, 0x1.0804e08c4ab85p-27, -0x1.3cddf189ac83dp-34, -0x1.1a3494524e315p-32, -0x1.399fb2fef2da3p-36, 0x1.a46842fc881cep-38, 0x1.f04476369d7cep-41, -0x1.ae7f3e733b81fp-44, -0x1.1eff7ef77d015p-45, 0x1.1eff7ef77d015p-48, 0x0p+0,
+	0x1.9a65541f3d257p-4, 0x1.bc328e9cc9262p-4, 0x1.f39d892472606p-6, -0x1.1fa56ad9bc611p-7, -0x1.9c6b7691c7baap-8, -0x1.64bc3416ac414p-12, 0x1.013fc4915da49p-11, 0x1.857dee37531b6p-14, -0x1.557df4c39bc9bp-16, -0x1.ec29a6aeab9bbp-18, 0x1.79bcc503e4a5ep-22, 0x1.82dbae17b9e0cp-22, 0x1.9b2c0dfe23158p-27, -0x1.b5b43385bf1a6p-27, -0x1.459fcb99bee24p-30, 0x1.778e8bf377d58p-32, 0x1.cf2f07c11b56ap-35, -0x1.ebe062daa97dfp-38, -0x1.dc167f4936b2dp-40, 0x1.d25f2e522b222p-44, 0x1.d25f2e522b222p-45, -0x1.9e8d7e81ed73ap-48, 0x0p+0,
+	0x1.cb535ca2d3c19p-3, 0x1.e9e1349e7379ap-4, -0x1.d2c5670f1e95bp-6, -0x1.a91323bdcc076p-6, 0x1.de486c571231p-12, 0x1.66bdef9db723fp-9, 0x1.7f321bfd60314p-13, -0x1.878e3b8035544p-13, -0x1.78e1ef0f20b62p-16, 0x1.35ae8bdbb8141p-17, 0x1.9ac49b5c8bfap-20, -0x1.7861d17a36ea6p-22, -0x1.413a9776be7fcp-24, 0x1.6aa3509596581p-27, 0x1.8a974c97e58c5p-29, -0x1.18206fec38a43p-32, -0x1.8f6c046bdf70fp-34, 0x1.567de60457ad1p-38, 0x1.5a8a47c09c7ebp-39, -0x1.36ea1ee17216cp-44, -0x1.36ea1ee17216cp-44, 0x1.f17697cf1cf13p-48, 0x0p+0,
+	0x1.2ba5481ee816bp-2, 0x0p+0, -0x1.3e0b42461ad16p-4, 0x0p+0, 0x1.4b7bbc756938cp-7, 0x0p+0, -0x1.c460ff80f29cep-11, 0x0p+0, 0x1.c6be79b6edf61p-15, 0x0p+0, -0x1.67306c890c629p-19, 0x0p+0, 0x1.d07c9722b1e9bp-24, 0x0p+0, -0x1.f9d0f6963e3a5p-29, 0x0p+0, 0x1.d9ee9fb8cceebp-34, 0x0p+0, -0x1.87e1c196d2775p-39, 0x0p+0, 0x1.5601885e63e5dp-44, -0x1.f17697cf1cf13p-48, 0x0p+0,
+	0x1.cb535ca2d3c19p-3, -0x1.e9e1349e7379ap-4, -0x1.d2c5670f1e95bp-6, 0x1.a91323bdcc076p-6, 0x1.de486c571231p-12, -0x1.66bdef9db723fp-9, 0x1.7f321bfd60314p-13, 0x1.878e3b8035544p-13, -0x1.78e1ef0f20b62p-16, -0x1.35ae8bdbb8141p-17, 0x1.9ac49b5c8bfap-20, 0x1.7861d17a36ea6p-22, -0x1.413a9776be7fcp-24, -0x1.6aa3509596581p-27, 0x1.8a974c97e58c5p-29, 0x1.18206fec38a43p-32, -0x1.8f6c046bdf70fp-34, -0x1.567de60457ad1p-38, 0x1.5a8a47c09c7ebp-39, 0x1.36ea1ee17216cp-44, -0x1.36ea1ee17216cp-44, 0x1.9e8d7e81ed73ap-48, 0x0p+0,
+	0x1.9a65541f3d257p-4, -0x1.bc328e9cc9262p-4, 0x1.f39d892472606p-6, 0x1.1fa56ad9bc611p-7, -0x1.9c6b7691c7baap-8, 0x1.64bc3416ac414p-12, 0x1.013fc4915da49p-11, -0x1.857dee37531b6p-14, -0x1.557df4c39bc9bp-16, 0x1.ec29a6aeab9bbp-18, 0x1.79bcc503e4a5ep-22, -0x1.82dbae17b9e0cp-22, 0x1.9b2c0dfe23158p-27, 0x1.b5b43385bf1a6p-27, -0x1.459fcb99bee24p-30, -0x1.778e8bf377d58p-32, 0x1.cf2f07c11b56ap-35, 0x1.ebe062daa97dfp-38, -0x1.dc167f4936b2dp-40, -0x1.d25f2e522b222p-44, 0x1.d25f2e522b222p-45, -0x1.1eff7ef77d015p-48, 0x0p+0,
+	0x1.a1015aef16de7p-6, -0x1.5b5289f31a862p-5, 0x1.c3c78c84186f6p-6, -0x1.c864158f7061ap-8, -0x1.09f122284ebbcp-10, 0x1.16b7d03ab24dbp-10, -0x1.74af00c3780cap-13, -0x1.6565666ff838dp-15, 0x1.44ed71b446812p-16, -0x1.4ae1541f21d84p-21, -0x1.e7427e51a2fbcp-21, 0x1.30359f98e8e5fp-23, 0x1.7d22b059e9fcbp-26, -0x1.0804e08c4ab85p-27, -0x1.3cddf189ac83dp-34, 0x1.1a3494524e315p-32, -0x1.399fb2fef2da3p-36, -0x1.a46842fc881cep-38, 0x1.f04476369d7cep-41, 0x1.ae7f3e733b81fp-44, -0x1.1eff7ef77d015p-45, 0x1.47ff6c888edcfp-49, 0x0p+0,
+	0x1.cc353a1cc4032p-9, -0x1.09966a62182d8p-7, 0x1.0b3c930f4fbf6p-7, -0x1.25ee2cbe8d8b7p-8, 0x1.50c9d4435c541p-10, -0x1.80fbce840db14p-15, -0x1.ad7d50c5c09bp-14, 0x1.18dcad66b8f6dp-15, -0x1.85e26f251979ep-20, -0x1.c1f053d08de11p-20, 0x1.acb442c3fd545p-22, 0x1.8d9f79a154b33p-27, -0x1.476e6fd4690fdp-26, 0x1.2d9dae6504054p-29, 0x1.c80592f96c001p-32, -0x1.0bb7213c75ce7p-33, 0x1.ae7f3e733b81fp-45, 0x1.f1c320353cce4p-39, -0x1.72b4aeaa56cc5p-42, -0x1.1eff7ef77d015p-44, 0x1.1eff7ef77d015p-46, -0x1.3221987f7445ap-50, 0x0p+0,
+	0x1.fee46cb2bf33p-13, -0x1.855794bdb5151p-11, 0x1.0ef0b2b9992f4p-10, -0x1.c13f79487064p-11, 0x1.e09ae1aadc282p-12, -0x1.462cf18d0de4dp-13, 0x1.bd08a574adc3ep-16, 0x1.5f75047d772a6p-19, -0x1.6fc7daa5ed14ap-19, 0x1.4b48558f7ce8dp-21, -0x1.71286a6d90d13p-29, -0x1.0348bb1a117e9p-25, 0x1.a78d03bd62699p-28, 0x1.209c0e3e00c5p-33, -0x1.188821dfbbd05p-32, 0x1.28a3add5009acp-35, 0x1.fddeb45d47478p-39, -0x1.a10b447fa1a5ep-40, 0x1.4ed4becb672c3p-44, 0x1.1eff7ef77d015p-45, -0x1.cb3264bf2e688p-48, 0x1.cb3264bf2e688p-52, 0x0p+0,
+	0x1.f66965668f5c8p-18, -0x1.f062bb737bd38p-16, 0x1.ca5ea9893a453p-15, -0x1.052b3ad82342ap-14, 0x1.976dcebfd430fp-15, -0x1.c5ff871a92b39p-16, 0x1.6a107dd01ad11p-17, -0x1.864384f6534acp-19, 0x1.ab9c528432e8ep-22, 0x1.a3d95af572d29p-25, -0x1.505ff479fc20bp-25, 0x1.245475d50162dp-27, -0x1.32610c962030bp-32, -0x1.53630c69b43fdp-32, 0x1.4b02bb2dc7fcep-34, -0x1.8ea87ff6fa0a3p-39, -0x1.2571bc118c101p-39, 0x1.dd952947d6042p-42, -0x1.7ea9fe9f51571p-50, -0x1.ae7f3e733b81fp-47, 0x1.1eff7ef77d015p-49, -0x1.0e1da4acb1e32p-53, 0x0p+0,
+	0x1.5e6adb025be8fp-24, -0x1.c38335cd9c5d2p-22, 0x1.1335827062c73p-20, -0x1.a511ba50de07fp-20, 0x1.c3d81128659fdp-20, -0x1.67904d17fcf9ep-20, 0x1.b49330ffe25e7p-21, -0x1.9818058bc45fep-22, 0x1.2229f53e1b8afp-23, -0x1.2a004cf3bae5cp-25, 0x1.6ca56ab4d9526p-28, 0x1.d68fd60981b88p-34, -0x1.56879d554eb8ap-32, 0x1.7388f0f5932b7p-34, -0x1.28727ab7ec1efp-37, -0x1.853db7660e569p-40, 0x1.570d65c3d36b9p-41, -0x1.4c5e79a07ee27p-44, -0x1.a06db334e7937p-48, 0x1.d8b3e02e374d7p-49, -0x1.0e1da4acb1e32p-51, 0x1.e034b2fa1fccap-56, 0x0p+0,
+	0x1.c03df03592d5fp-33, -0x1.8757ca12c2908p-30, 0x1.45087d040c157p-28, -0x1.555f0758fa6c2p-27, 0x1.fc3046f3c9049p-27, -0x1.1cafa1f1967efp-26, 0x1.f158448325b1p-27, -0x1.59dcd08060f0ep-27, 0x1.831b1a5569531p-28, -0x1.5d23d4eab716ep-29, 0x1.f6351a57bd96dp-31, -0x1.16f9118215abp-32, 0x1.b5bac7a4910a3p-35, -0x1.451d6dd45b9b7p-38, -0x1.fdef1abc4e1b7p-41, 0x1.0bdd656f85bcfp-41, -0x1.9c8f4683c3b1ep-44, 0x1.51a50dd7de5bep-48, 0x1.33a1c2a83c5f1p-49, -0x1.6827863b97d97p-51, 0x1.6827863b97d97p-54, -0x1.2f49b46814157p-58, 0x0p+0,
+	0x1.71b7f13eaabbap-45, -0x1.e5401f04600a2p-42, 0x1.2f46725d63f74p-39, -0x1.e02a61d8476cfp-38, 0x1.0e1209669e777p-36, -0x1.cb0aee6a85fa8p-36, 0x1.31ecfab93e5dbp-35, -0x1.478eacbb3febdp-35, 0x1.1e3a2f5032db6p-35, -0x1.9c537bf3facd2p-36, 0x1.ec1e91ada3619p-37, -0x1.e6c68b8c29d2p-38, 0x1.8cbd6a12583fbp-39, -0x1.06558a0e38433p-40, 0x1.0f9f85e1164efp-42, -0x1.91cc1827489b7p-45, 0x1.1eff7ef77d015p-48, 0x1.952c77030ad4ap-51, -0x1.a42e1c9adbd31p-52, 0x1.5532eaf516982p-54, -0x1.2f49b46814157p-57, 0x1.e542ba4020225p-62, 0x0p+0,
+	0x1.71b8ef6dcf572p-66, -0x1.e542ba4020225p-62, 0x1.2f49b46814157p-58, -0x1.e034b2fa1fccap-56, 0x1.0e1da4acb1e32p-53, -0x1.cb3264bf2e688p-52, 0x1.3221987f7445ap-50, -0x1.47ff6c888edcfp-49, 0x1.1eff7ef77d015p-48, -0x1.9e8d7e81ed73ap-48, 0x1.f17697cf1cf13p-48, -0x1.f17697cf1cf13p-48, 0x1.9e8d7e81ed73ap-48, -0x1.1eff7ef77d015p-48, 0x1.47ff6c888edcfp-49, -0x1.3221987f7445ap-50, 0x1.cb3264bf2e688p-52, -0x1.0e1da4acb1e32p-53, 0x1.e034b2fa1fccap-56, -0x1.2f49b46814157p-58, 0x1.e542ba4020225p-62, -0x1.71b8ef6dcf572p-66, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 23 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.0ce396db7f853p-70, 0x0p+0,
+	0x1.0ce396db7f853p-70, 0x1.71b8ef6dcf572p-66, 0x1.e542ba4020225p-63, 0x1.946245e01ac74p-60, 0x1.e034b2fa1fccap-58, 0x1.b02f6de11c9e9p-56, 0x1.3221987f7445ap-54, 0x1.5ddd4091a9743p-53, 0x1.47ff6c888edcfp-52, 0x1.fe37fe29c1c97p-52, 0x1.4ba46534bdf62p-51, 0x1.69ca9cf3b7f54p-51, 0x1.4ba46534bdf62p-51, 0x1.fe37fe29c1c97p-52, 0x1.47ff6c888edcfp-52, 0x1.5ddd4091a9743p-53, 0x1.3221987f7445ap-54, 0x1.b02f6de11c9e9p-56, 0x1.e034b2fa1fccap-58, 0x1.946245e01ac74p-60, 0x1.e542ba4020225p-63, 0x1.71b8ef6dcf572p-66, -0x1.71b8ef6dcf572p-66, 0x0p+0,
+	0x1.0ce33639b54e4p-48, 0x1.71b7e5b0e3403p-45, 0x1.e54000b034662p-43, 0x1.945dbb4591e2fp-41, 0x1.e029e9cb1aae7p-40, 0x1.b01c03bfad01cp-39, 0x1.3206177ac0d23p-38, 0x1.5d9e62d00f47cp-38, 0x1.47898cbd8dc99p-38, 0x1.fcc945eb13c62p-39, 0x1.49c7a8e342251p-39, 0x1.65ba76707b445p-40, 0x1.443173eeceb1dp-41, 0x1.e74c7a3ee194ep-43, 0x1.2a8779c84a071p-44, 0x1.1eff7ef77d015p-46, 0x1.883b0b634cf94p-49, 0x1.e6355b9d40326p-53, -0x1.a42e1c9adbd31p-55, -0x1.7b1c2182191adp-56, -0x1.201f9e9613146p-58, -0x1.e542ba4020225p-62, 0x1.e542ba4020225p-63, 0x0p+0,
+	0x1.e9a5ce0531087p-36, 0x1.c026d4b67eeb4p-33, 0x1.87397610d24a8p-31, 0x1.b12e1af255e14p-30, 0x1.5523020cbf633p-29, 0x1.9620fe58de2abp-29, 0x1.7afbd447fa7c9p-29, 0x1.1b839fbbabaf4p-29, 0x1.589541d3a5b1p-30, 0x1.561b3e30b29a1p-31, 0x1.14bc24c23f4ddp-32, 0x1.67a645ddd6927p-34, 0x1.69d29f1a86afap-36, 0x1.fc39c62b9807ap-39, 0x1.289b7aa57d30cp-42, -0x1.5865cb8f62ce6p-44, -0x1.24fa26f1fa46ap-45, -0x1.952c77030ad4ap-48, -0x1.fe37fe29c1c97p-53, 0x1.2f49b46814157p-53, 0x1.423e4fae9556dp-55, 0x1.2f49b46814157p-58, -0x1.946245e01ac74p-60, 0x0p+0,
+	0x1.01df95e670d59p-26, 0x1.5d8abc0a411f8p-24, 0x1.c1fbde03899a9p-23, 0x1.6d40a299d3a43p-22, 0x1.a266fc422c132p-22, 0x1.664c8d4864d7dp-22, 0x1.d97cbe159e2a9p-23, 0x1.ea0fc90fcfbfap-24, 0x1.8d491f07c1585p-25, 0x1.ee574ef7e400bp-27, 0x1.b9e34c3b4bed5p-29, 0x1.b7157f25a5452p-32, -0x1.0868af584ebb7p-35, -0x1.e8eb07bd63825p-36, -0x1.bfd576a7d34f1p-38, -0x1.1a36f8957f303p-41, 0x1.0596350ee89a8p-43, 0x1.7368c26d74984p-45, 0x1.3a327b1aa7ce6p-48, -0x1.e034b2fa1fccap-52, -0x1.c23167ca7dcfdp-53, -0x1.e034b2fa1fccap-56, 0x1.e034b2fa1fccap-58, 0x0p+0,
+	0x1.daa8301be7074p-20, 0x1.f0efb9fa85ecep-18, 0x1.e954ae9c4562p-17, 0x1.2bd8a8f924cap-16, 0x1.fd2de7ddbf95p-17, 0x1.3aa5a4f874033p-17, 0x1.1faf01860c97fp-18, 0x1.7e9a9e9269e83p-20, 0x1.53408444dabedp-22, 0x1.f645f1975e77cp-26, -0x1.1f23dcc3abe35p-27, -0x1.15c92fdd854ddp-28, -0x1.80df1d8be87f2p-31, 0x1.63f1dff7f1892p-39, 0x1.ee0609e38a556p-36, 0x1.889ab5e2f4cd9p-38, 0x1.98134887e5bddp-44, -0x1.64e6aad52e0a5p-43, -0x1.f260b17ff6e0bp-46, 0x1.0e1da4acb1e32p-52, 0x1.b6f02b98a1111p-51, 0x1.0e1da4acb1e32p-53, -0x1.b02f6de11c9e9p-56, 0x0p+0,
+	0x1.2eeec6bb8ad9cp-14, 0x1.ef3121878ab82p-13, 0x1.75d47ee219367p-12, 0x1.5627a73c69d17p-12, 0x1.a09a11ed6bfbap-13, 0x1.57bdb975814e7p-14, 0x1.673c00e24f688p-16, 0x1.2db750a0b743dp-19, -0x1.72dc44b9e53a9p-21, -0x1.766daf13f4d6ep-22, -0x1.e81133003c5f8p-25, 0x1.c7b671331bbf6p-29, 0x1.bb27cb69c2746p-29, 0x1.106e34042a1b7p-31, -0x1.14652fbbd4ef1p-35, -0x1.8380de947521ap-36, -0x1.418e35d4703b6p-39, 0x1.7a07bc7063748p-42, 0x1.dcd5d448865b8p-44, 0x1.1eff7ef77d015p-48, -0x1.3bb2a5436fe7dp-49, -0x1.cb3264bf2e688p-52, 0x1.3221987f7445ap-54, 0x0p+0,
+	0x1.534de90b484c7p-10, 0x1.ac46f351980ffp-9, 0x1.e281e22c79b87p-9, 0x1.3728a64ad0ccap-9, 0x1.db8c7b2afefdep-11, 0x1.5a9e92f43ba9ap-13, -0x1.3292a7e5634b6p-16, -0x1.34ffb381ab749p-16, -0x1.02e55d1ee1843p-18, 0x1.3344b02272631p-23, 0x1.ec76cbad09dep-23, 0x1.39e1dfb4fa845p-25, -0x1.de40ccadde39dp-29, -0x1.0aa86cc73c19fp-29, -0x1.4416c64a72411p-33, 0x1.88d41c2f8cb36p-35, 0x1.55e00cb1b5f51p-37, -0x1.d98bf7e527dbcp-43, -0x1.39e772deb0b97p-42, -0x1.7ea9fe9f51571p-46, 0x1.5865cb8f62ce6p-48, 0x1.3221987f7445ap-50, -0x1.5ddd4091a9743p-53, 0x0p+0,
+	0x1.7db89a95b20b1p-7, 0x1.677ab3ab7e5e1p-6, 0x1.18ecef5a947acp-6, 0x1.a83703fb40bfap-8, 0x1.44ebd1a1c5ac5p-11, -0x1.e22f2b8955a63p-12, -0x1.83aa3e3e6e4efp-13, -0x1.6900ca015ad97p-17, 0x1.3f2109eb5897dp-17, 0x1.367c15e96ac0bp-19, -0x1.c732a934c7ee6p-24, -0x1.fe435cdfbb616p-24, -0x1.747a3553c4ce5p-27, 0x1.b40a89f51f6a2p-29, 0x1.83e97b989faf9p-31, -0x1.1d75e60ed922bp-35, -0x1.a01024f089188p-36, -0x1.27f77aef38e95p-40, 0x1.297624edd83abp-41, 0x1.1eff7ef77d015p-44, -0x1.1eff7ef77d015p-47, -0x1.47ff6c888edcfp-49, 0x1.47ff6c888edcfp-52, 0x0p+0,
+	0x1.d4763ed9ff1f9p-5, 0x1.3224fd63776ddp-4, 0x1.0e8949a33be31p-5, 0x1.fe3fdc03bf5fap-11, -0x1.01ebbad0ba48fp-8, -0x1.14bf580629a2fp-10, 0x1.f96cb338134e5p-14, 0x1.907ae0ddfb08dp-14, 0x1.a59675feadfdep-18, -0x1.282fbbc38104dp-18, -0x1.aad1742873122p-21, 0x1.ebbad20e3e0abp-24, 0x1.674efe981ee28p-25, -0x1.b01f2ab83c2c2p-31, -0x1.90fc0b78059cfp-30, -0x1.46354089c01bcp-34, 0x1.48e19022e3036p-35, 0x1.23c33cd318d49p-38, -0x1.95759f0a4eef8p-41, -0x1.30ef76e6f4d16p-43, 0x1.66bf5eb55c41ap-47, 0x1.1eff7ef77d015p-48, -0x1.fe37fe29c1c97p-52, 0x0p+0,
+	0x1.4a09a5dee0dd3p-3, 0x1.fc4165266a5dbp-4, 0x1.6d75300d529bep-8, -0x1.4220fabbdafcbp-6, -0x1.19406e50edd6ep-8, 0x1.61d99778fa4afp-10, 0x1.0ce3a415b31d6p-11, -0x1.71076829315bfp-15, -0x1.2526994def71p-15, -0x1.f75504320d224p-23, 0x1.bc9c4c28d7e7fp-20, 0x1.cc1f25f98fbafp-24, -0x1.fcd3aa614b322p-25, -0x1.ca9da8e0a116bp-28, 0x1.c95694a1e7af1p-30, 0x1.29481ae0690fbp-32, -0x1.47d77defd83cep-35, -0x1.28f29a7e5176bp-37, 0x1.72d4922a39687p-41, 0x1.ec48063a49f95p-43, -0x1.36ea1ee17216cp-47, -0x1.9e8d7e81ed73ap-48, 0x1.4ba46534bdf62p-51, 0x0p+0,
+	0x1.1317ebdec511ap-2, 0x1.17ee6735f8d7cp-4, -0x1.e9e1349e7379ap-5, -0x1.0c77e0adc43a9p-6, 0x1.a91323bdcc076p-8, 0x1.fa758e844dd86p-10, -0x1.de5294d249854p-12, -0x1.393e96002aa9dp-13, 0x1.878e3b8035544p-16, 0x1.1ddc3254a9eb2p-17, -0x1.ef7dac92c0202p-21, -0x1.9a99419c98ffbp-22, 0x1.f5d7c1f849388p-26, 0x1.e3846b721dcabp-27, -0x1.9e7180aaf4f6ep-31, -0x1.e0379b4bced05p-32, 0x1.18206fec38a43p-36, 0x1.9afd7a6b9c694p-37, -0x1.306fe8e76a60fp-42, -0x1.36ea1ee17216cp-42, 0x1.f17697cf1cf13p-49, 0x1.f17697cf1cf13p-48, -0x1.69ca9cf3b7f54p-51, 0x0p+0,
+	0x1.1317ebdec511ap-2, -0x1.17ee6735f8d7cp-4, -0x1.e9e1349e7379ap-5, 0x1.0c77e0adc43a9p-6, 0x1.a91323bdcc076p-8, -0x1.fa758e844dd86p-10, -0x1.de5294d249854p-12, 0x1.393e96002aa9dp-13, 0x1.878e3b8035544p-16, -0x1.1ddc3254a9eb2p-17, -0x1.ef7dac92c0202p-21, 0x1.9a99419c98ffbp-22, 0x1.f5d7c1f849388p-26, -0x1.e3846b721dcabp-27, -0x1.9e7180aaf4f6ep-31, 0x1.e0379b4bced05p-32, 0x1.18206fec38a43p-36, -0x1.9afd7a6b9c694p-37, -0x1.306fe8e76a60fp-42, 0x1.36ea1ee17216cp-42, 0x1.f17697cf1cf13p-49, -0x1.f17697cf1cf13p-48, 0x1.4ba46534bdf62p-51, 0x0p+0,
+	0x1.4a09a5dee0dd3p-3, -0x1.fc4165266a5dbp-4, 0x1.6d75300d529bep-8, 0x1.4220fabbdafcbp-6, -0x1.19406e50edd6ep-8, -0x1.61d99778fa4afp-10, 0x1.0ce3a415b31d6p-11, 0x1.71076829315bfp-15, -0x1.2526994def71p-15, 0x1.f75504320d224p-23, 0x1.bc9c4c28d7e7fp-20, -0x1.cc1f25f98fbafp-24, -0x1.fcd3aa614b322p-25, 0x1.ca9da8e0a116bp-28, 0x1.c95694a1e7af1p-30, -0x1.29481ae0690fbp-32, -0x1.47d77defd83cep-35, 0x1.28f29a7e5176bp-37, 0x1.72d4922a39687p-41, -0x1.ec48063a49f95p-43, -0x1.36ea1ee17216cp-47, 0x1.9e8d7e81ed73ap-48, -0x1.fe37fe29c1c97p-52, 0x0p+0,
+	0x1.d4763ed9ff1f9p-5, -0x1.3224fd63776ddp-4, 0x1.0e8949a33be31p-5, -0x1.fe3fdc03bf5fap-11, -0x1.01ebbad0ba48fp-8, 0x1.14bf580629a2fp-10, 0x1.f96cb338134e5p-14, -0x1.907ae0ddfb08dp-14, 0x1.a59675feadfdep-18, 0x1.282fbbc38104dp-18, -0x1.aad1742873122p-21, -0x1.ebbad20e3e0abp-24, 0x1.674efe981ee28p-25, 0x1.b01f2ab83c2c2p-31, -0x1.90fc0b78059cfp-30, 0x1.46354089c01bcp-34, 0x1.48e19022e3036p-35, -0x1.23c33cd318d49p-38, -0x1.95759f0a4eef8p-41, 0x1.30ef76e6f4d16p-43, 0x1.66bf5eb55c41ap-47, -0x1.1eff7ef77d015p-48, 0x1.47ff6c888edcfp-52, 0x0p+0,
+	0x1.7db89a95b20b1p-7, -0x1.677ab3ab7e5e1p-6, 0x1.18ecef5a947acp-6, -0x1.a83703fb40bfap-8, 0x1.44ebd1a1c5ac5p-11, 0x1.e22f2b8955a63p-12, -0x1.83aa3e3e6e4efp-13, 0x1.6900ca015ad97p-17, 0x1.3f2109eb5897dp-17, -0x1.367c15e96ac0bp-19, -0x1.c732a934c7ee6p-24, 0x1.fe435cdfbb616p-24, -0x1.747a3553c4ce5p-27, -0x1.b40a89f51f6a2p-29, 0x1.83e97b989faf9p-31, 0x1.1d75e60ed922bp-35, -0x1.a01024f089188p-36, 0x1.27f77aef38e95p-40, 0x1.297624edd83abp-41, -0x1.1eff7ef77d015p-44, -0x1.1eff7ef77d015p-47, 0x1.47ff6c888edcfp-49, -0x1.5ddd4091a9743p-53, 0x0p+0,
+	0x1.534de90b484c7p-10, -0x1.ac46f351980ffp-9, 0x1.e281e22c79b87p-9, -0x1.3728a64ad0ccap-9, 0x1.db8c7b2afefdep-11, -0x1.5a9e92f43ba9ap-13, -0x1.3292a7e5634b6p-16, 0x1.34ffb381ab749p-16, -0x1.02e55d1ee1843p-18, -0x1.3344b02272631p-23, 0x1.ec76cbad09dep-23, -0x1.39e1dfb4fa845p-25, -0x1.de40ccadde39dp-29, 0x1.0aa86cc73c19fp-29, -0x1.4416c64a72411p-33, -0x1.88d41c2f8cb36p-35, 0x1.55e00cb1b5f51p-37, 0x1.d98bf7e527dbcp-43, -0x1.39e772deb0b97p-42, 0x1.7ea9fe9f51571p-46, 0x1.5865cb8f62ce6p-48, -0x1.3221987f7445ap-50, 0x1.3221987f7445ap-54, 0x0p+0,
+	0x1.2eeec6bb8ad9cp-14, -0x1.ef3121878ab82p-13, 0x1.75d47ee219367p-12, -0x1.5627a73c69d17p-12, 0x1.a09a11ed6bfbap-13, -0x1.57bdb975814e7p-14, 0x1.673c00e24f688p-16, -0x1.2db750a0b743dp-19, -0x1.72dc44b9e53a9p-21, 0x1.766daf13f4d6ep-22, -0x1.e81133003c5f8p-25, -0x1.c7b671331bbf6p-29, 0x1.bb27cb69c2746p-29, -0x1.106e34042a1b7p-31, -0x1.14652fbbd4ef1p-35, 0x1.8380de947521ap-36, -0x1.418e35d4703b6p-39, -0x1.7a07bc7063748p-42, 0x1.dcd5d448865b8p-44, -0x1.1eff7ef77d015p-48, -0x1.3bb2a5436fe7dp-49, 0x1.cb3264bf2e688p-52, -0x1.b02f6de11c9e9p-56, 0x0p+0,
+	0x1.daa8301be7074p-20, -0x1.f0efb9fa85ecep-18, 0x1.e954ae9c4562p-17, -0x1.2bd8a8f924cap-16, 0x1.fd2de7ddbf95p-17, -0x1.3aa5a4f874033p-17, 0x1.1faf01860c97fp-18, -0x1.7e9a9e9269e83p-20, 0x1.53408444dabedp-22, -0x1.f645f1975e77cp-26, -0x1.1f23dcc3abe35p-27, 0x1.15c92fdd854ddp-28, -0x1.80df1d8be87f2p-31, -0x1.63f1dff7f1892p-39, 0x1.ee0609e38a556p-36, -0x1.889ab5e2f4cd9p-38, 0x1.98134887e5bddp-44, 0x1.64e6aad52e0a5p-43, -0x1.f260b17ff6e0bp-46, -0x1.0e1da4acb1e32p-52, 0x1.b6f02b98a1111p-51, -0x1.0e1da4acb1e32p-53, 0x1.e034b2fa1fccap-58, 0x0p+0,
+	0x1.01df95e670d59p-26, -0x1.5d8abc0a411f8p-24, 0x1.c1fbde03899a9p-23, -0x1.6d40a299d3a43p-22, 0x1.a266fc422c132p-22, -0x1.664c8d4864d7dp-22, 0x1.d97cbe159e2a9p-23, -0x1.ea0fc90fcfbfap-24, 0x1.8d491f07c1585p-25, -0x1.ee574ef7e400bp-27, 0x1.b9e34c3b4bed5p-29, -0x1.b7157f25a5452p-32, -0x1.0868af584ebb7p-35, 0x1.e8eb07bd63825p-36, -0x1.bfd576a7d34f1p-38, 0x1.1a36f8957f303p-41, 0x1.0596350ee89a8p-43, -0x1.7368c26d74984p-45, 0x1.3a327b1aa7ce6p-48, 0x1.e034b2fa1fccap-52, -0x1.c23167ca7dcfdp-53, 0x1.e034b2fa1fccap-56, -0x1.946245e01ac74p-60, 0x0p+0,
+	0x1.e9a5ce0531087p-36, -0x1.c026d4b67eeb4p-33, 0x1.87397610d24a8p-31, -0x1.b12e1af255e14p-30, 0x1.5523020cbf633p-29, -0x1.9620fe58de2abp-29, 0x1.7afbd447fa7c9p-29, -0x1.1b839fbbabaf4p-29, 0x1.589541d3a5b1p-30, -0x1.561b3e30b29a1p-31, 0x1.14bc24c23f4ddp-32, -0x1.67a645ddd6927p-34, 0x1.69d29f1a86afap-36, -0x1.fc39c62b9807ap-39, 0x1.289b7aa57d30cp-42, 0x1.5865cb8f62ce6p-44, -0x1.24fa26f1fa46ap-45, 0x1.952c77030ad4ap-48, -0x1.fe37fe29c1c97p-53, -0x1.2f49b46814157p-53, 0x1.423e4fae9556dp-55, -0x1.2f49b46814157p-58, 0x1.e542ba4020225p-63, 0x0p+0,
+	0x1.0ce33639b54e4p-48, -0x1.71b7e5b0e3403p-45, 0x1.e54000b034662p-43, -0x1.945dbb4591e2fp-41, 0x1.e029e9cb1aae7p-40, -0x1.b01c03bfad01cp-39, 0x1.3206177ac0d23p-38, -0x1.5d9e62d00f47cp-38, 0x1.47898cbd8dc99p-38, -0x1.fcc945eb13c62p-39, 0x1.49c7a8e342251p-39, -0x1.65ba76707b445p-40, 0x1.443173eeceb1dp-41, -0x1.e74c7a3ee194ep-43, 0x1.2a8779c84a071p-44, -0x1.1eff7ef77d015p-46, 0x1.883b0b634cf94p-49, -0x1.e6355b9d40326p-53, -0x1.a42e1c9adbd31p-55, 0x1.7b1c2182191adp-56, -0x1.201f9e9613146p-58, 0x1.e542ba4020225p-62, -0x1.71b8ef6dcf572p-66, 0x0p+0,
+	0x1.0ce396db7f853p-70, -0x1.71b8ef6dcf572p-66, 0x1.e542ba4020225p-63, -0x1.946245e01ac74p-60, 0x1.e034b2fa1fccap-58, -0x1.b02f6de11c9e9p-56, 0x1.3221987f7445ap-54, -0x1.5ddd4091a9743p-53, 0x1.47ff6c888edcfp-52, -0x1.fe37fe29c1c97p-52, 0x1.4ba46534bdf62p-51, -0x1.69ca9cf3b7f54p-51, 0x1.4ba46534bdf62p-51, -0x1.fe37fe29c1c97p-52, 0x1.47ff6c888edcfp-52, -0x1.5ddd4091a9743p-53, 0x1.3221987f7445ap-54, -0x1.b02f6de11c9e9p-56, 0x1.e034b2fa1fccap-58, -0x1.946245e01ac74p-60, 0x1.e542ba4020225p-63, -0x1.71b8ef6dcf572p-66, 0x1.0ce396db7f853p-70, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+/* 24 */
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x1.761b41316381ap-75, 0x0p+0,
+	0x1.761b41316381ap-75, 0x1.0ce396db7f853p-70, 0x1.71b8ef6dcf572p-67, 0x1.4381d180156c3p-64, 0x1.946245e01ac74p-62, 0x1.802a28c819708p-60, 0x1.201f9e9613146p-58, 0x1.5ddd4091a9743p-57, 0x1.5ddd4091a9743p-56, 0x1.238db5ceb7e0dp-55, 0x1.982ccb549b078p-55, 0x1.e2637bef9ff1ap-55, 0x1.e2637bef9ff1ap-55, 0x1.982ccb549b078p-55, 0x1.238db5ceb7e0dp-55, 0x1.5ddd4091a9743p-56, 0x1.5ddd4091a9743p-57, 0x1.201f9e9613146p-58, 0x1.802a28c819708p-60, 0x1.946245e01ac74p-62, 0x1.4381d180156c3p-64, 0x1.71b8ef6dcf572p-67, 0x1.0ce396db7f853p-70, -0x1.0ce396db7f853p-70, 0x0p+0,
+	0x1.761afb0c47486p-52, 0x1.0ce3320626f2ep-48, 0x1.71b7da231bc4cp-46, 0x1.437fec3d5b2c1p-44, 0x1.945d88b94926fp-43, 0x1.802127cb24bfep-42, 0x1.20121d1aa40b8p-41, 0x1.5dbc73d39bcc5p-41, 0x1.5d9ba7158e246p-41, 0x1.232060aa8a5bep-41, 0x1.96faa9bc1b934p-42, 0x1.df8fe6b5b881bp-43, 0x1.dcbc517bd111dp-44, 0x1.8e9bbe909f656p-45, 0x1.15e3114907424p-46, 0x1.3d10828401914p-48, 0x1.1c43c47659ae6p-50, 0x1.6827863b97d97p-53, 0x1.802a28c819708p-57, -0x1.946245e01ac74p-59, -0x1.4381d180156c3p-60, -0x1.ce272b49432cep-63, -0x1.71b8ef6dcf572p-66, 0x1.71b8ef6dcf572p-67, 0x0p+0,
+	0x1.ff6a8c9e2c1e6p-39, 0x1.e994ffd1cd6d2p-36, 0x1.c00fb93823dd1p-34, 0x1.04bcc16084da2p-32, 0x1.b0fb8f3aed2fp-32, 0x1.10b8ca3f9e665p-31, 0x1.0e78a4e5497fap-31, 0x1.b070ef2045d71p-32, 0x1.1ad4d08a43a79p-32, 0x1.3128a3cd401f4p-33, 0x1.10185d889f9eap-34, 0x1.8ec6aad2240dep-36, 0x1.d8147ab01b872p-38, 0x1.b0d9f097766eep-40, 0x1.1102da96aa3f1p-42, 0x1.d98bf7e527dbcp-47, -0x1.a025ab4d420ebp-48, -0x1.2ad0caf8a4c9ap-49, -0x1.75a901aaa0be7p-52, -0x1.5532eaf516982p-57, 0x1.188a93ad1293dp-57, 0x1.10f588c412135p-59, 0x1.e542ba4020225p-63, -0x1.4381d180156c3p-64, 0x0p+0,
+	0x1.6a1b551636b61p-29, 0x1.01652c72ef895p-26, 0x1.5caaa89fe5ep-25, 0x1.2af86db3a5daep-24, 0x1.6b8f747ee14e5p-24, 0x1.4c96f831a876bp-24, 0x1.d9806464eecf5p-25, 0x1.0b2e2d0291498p-25, 0x1.e133ac11f2622p-27, 0x1.57922f165909ap-28, 0x1.7a5e15aa47127p-30, 0x1.28371cd3a5d41p-32, 0x1.d18fe792ea2b6p-36, -0x1.120b13036d95bp-38, -0x1.3baf004ac3b8cp-39, -0x1.f17697cf1cf13p-42, -0x1.de547e4725acdp-46, 0x1.3b22957424de5p-47, 0x1.77292bd368d7ep-49, 0x1.1603900a1269p-52, -0x1.f97ad75821791p-56, -0x1.946245e01ac74p-57, -0x1.946245e01ac74p-60, 0x1.946245e01ac74p-62, 0x0p+0,
+	0x1.aa0f2f7c8232cp-22, 0x1.d6a0b1c44d43fp-20, 0x1.eb798f0a5ce86p-19, 0x1.41887f6d7a27cp-18, 0x1.2623a66ebd7b7p-18, 0x1.8ce22662f1c39p-19, 0x1.9499ab684125ep-20, 0x1.37defaf3db079p-21, 0x1.5ff9a2016cec4p-23, 0x1.016a1cca90835p-25, 0x1.982a102be0bf2p-30, -0x1.212c22c7a2165p-30, -0x1.96f8b5152a2d8p-32, -0x1.c55951f42bc92p-35, 0x1.30ce6fd95c669p-39, 0x1.4330bfc2ee7c5p-39, 0x1.abe194f5a4b3ap-42, -0x1.b14f8d7fb2b1ap-50, -0x1.8fc7df807bb94p-47, -0x1.e5d551130e2cp-50, 0x1.2c20efdc53dfep-55, 0x1.a42e1c9adbd31p-55, 0x1.e034b2fa1fccap-58, -0x1.802a28c819708p-60, 0x0p+0,
+	0x1.5352148247518p-16, 0x1.278425fb1b3dap-14, 0x1.dfa9a3b7b688bp-14, 0x1.de0d21e6f40f2p-14, 0x1.436a1cacd784dp-14, 0x1.33d28f8c73351p-15, 0x1.95e15bc89912bp-17, 0x1.485bb76ea04c1p-19, 0x1.b9a8055e093ecp-24, -0x1.e06eb0c3d7a55p-24, -0x1.44a80b5788985p-25, -0x1.2ec02b7f8104dp-28, 0x1.511845a4b773bp-31, 0x1.4bec0b91af201p-32, 0x1.35c294bba70b5p-35, -0x1.1726827eb8964p-38, -0x1.e5a78c0d3255p-40, -0x1.3aa4879ec335fp-43, 0x1.eea648c2a5c18p-46, 0x1.fa7794c3cd89dp-48, 0x1.b02f6de11c9e9p-53, -0x1.44239268d576fp-53, -0x1.b02f6de11c9e9p-56, 0x1.201f9e9613146p-58, 0x0p+0,
+	0x1.d50af81490481p-12, 0x1.405efc9f8f9edp-10, 0x1.8d53e1391f647p-10, 0x1.2284e18acf0bcp-10, 0x1.0c63b16343927p-11, 0x1.291e5ef2e998cp-13, 0x1.d1ff3b43f2b11p-17, -0x1.7c76174d8aaffp-18, -0x1.5ab69d95c25dp-19, -0x1.79d896467a6c3p-22, 0x1.a67338ea8b39fp-25, 0x1.bee5290986844p-26, 0x1.7c88a0d7b6608p-29, -0x1.1b82a4f393e6dp-31, -0x1.7e96d45299dc6p-33, -0x1.0ffd4f50855bp-37, 0x1.254a45bce3a21p-38, 0x1.8d6ccd51b69a5p-41, -0x1.113efc9dc3483p-45, -0x1.6cba06afd987p-46, -0x1.6b87e5175a12bp-50, 0x1.7ea9fe9f51571p-52, 0x1.3221987f7445ap-54, -0x1.5ddd4091a9743p-57, 0x0p+0,
+	0x1.448df83d938f7p-8, 0x1.534edd7449018p-7, 0x1.31f1d5414b5c1p-7, 0x1.2626441c0704ep-8, 0x1.0ca2b0d5d8594p-10, -0x1.e2021e83ea9e9p-15, -0x1.b4fef8acf7a76p-14, -0x1.8f3fe602022afp-16, 0x1.00fe9d01fc0fap-20, 0x1.8ebc323441338p-20, 0x1.d20c77d86c2a6p-23, -0x1.05d7518e567c1p-25, -0x1.bccd887c25c26p-27, -0x1.3747651de8ec3p-31, 0x1.918ad6227d701p-32, 0x1.f432525040441p-35, -0x1.5325011f32ebp-38, -0x1.143c509b01eaep-39, -0x1.a4ee31af3fdfcp-45, 0x1.7ea9fe9f51571p-45, 0x1.3221987f7445ap-48, -0x1.5ddd4091a9743p-51, -0x1.5ddd4091a9743p-53, 0x1.5ddd4091a9743p-56, 0x0p+0,
+	0x1.eb18bca3c4808p-6, 0x1.75081834929cdp-5, 0x1.b08ca0f12fac9p-6, 0x1.5adcda8fd9b9ep-8, -0x1.686f087ac8d3ap-10, -0x1.dda854d4b7fd9p-11, -0x1.a089785f8b43cp-14, 0x1.6dee0da1691efp-15, 0x1.bd9afa1e2664p-17, -0x1.8131189c7774fp-22, -0x1.69249ef9c51dbp-21, -0x1.0d08168cfbb1bp-24, 0x1.4dff64f9fdcebp-26, 0x1.166acc431d977p-28, -0x1.36e5e738acd54p-32, -0x1.3d4d382471d7ep-33, -0x1.6ef49b04a714dp-39, 0x1.f9545cce435ap-39, 0x1.451d6dd45b9b7p-42, -0x1.27f77aef38e95p-44, -0x1.66bf5eb55c41ap-47, 0x1.ebff22ccd64b6p-51, 0x1.47ff6c888edcfp-52, -0x1.238db5ceb7e0dp-55, 0x0p+0,
+	0x1.ad908d1a6a394p-4, 0x1.a9d82c50c22aap-4, 0x1.9438cf85e5dfdp-6, -0x1.2bce2f82176a2p-7, -0x1.5212f99bf8f7bp-8, -0x1.2aa29335c718dp-14, 0x1.a465f4ff6d495p-12, 0x1.d632686ab875fp-15, -0x1.247f4a7949db6p-16, -0x1.336beab6e82b5p-18, 0x1.c0bb529cb42c6p-22, 0x1.de8f4a5af5697p-23, -0x1.51272b8743523p-31, -0x1.0b1e5b606f68dp-27, -0x1.ce6696541d383p-32, 0x1.c9c5aab87e8efp-33, 0x1.7ad56b02d916ap-36, -0x1.350bca632af11p-38, -0x1.89a032953700ep-41, 0x1.46dbded2c025p-44, 0x1.3ee2feda191dep-46, -0x1.fe37fe29c1c97p-51, -0x1.fe37fe29c1c97p-52, 0x1.982ccb549b078p-55, 0x0p+0,
+	0x1.c1ad07b73b99p-3, 0x1.b84c63bd528cp-4, -0x1.c8a5fbe0e30bdp-6, -0x1.650a91c013de1p-6, 0x1.ad48d070b610ep-11, 0x1.1a87d405e3f28p-9, 0x1.96f53d7389791p-14, -0x1.225088487b5b7p-13, -0x1.b9f977ebbca5ap-17, 0x1.b29a69d397349p-18, 0x1.d5f5a3d58365ep-21, -0x1.f788190d3ffa3p-23, -0x1.5e6b5cbca89efp-25, 0x1.d38990d709ba1p-28, 0x1.97542481639eep-30, -0x1.626e93b72349ep-33, -0x1.84bfdb161bfp-35, 0x1.b8619c23b8ffp-39, 0x1.3aa3978469b8ep-40, -0x1.b876566a0c4aep-45, -0x1.bda4e7fedf42cp-46, 0x1.4ba46534bdf62p-51, 0x1.4ba46534bdf62p-51, -0x1.e2637bef9ff1ap-55, 0x0p+0,
+	0x1.1f0dd4bbef074p-2, 0x0p+0, -0x1.17ee6735f8d7cp-4, 0x0p+0, 0x1.0c77e0adc43a9p-7, 0x0p+0, -0x1.51a3b45833e59p-11, 0x0p+0, 0x1.393e96002aa9dp-15, 0x0p+0, -0x1.c960508776451p-20, 0x0p+0, 0x1.11bb811310aa7p-24, 0x0p+0, -0x1.144bab1ca34f4p-29, 0x0p+0, 0x1.e0379b4bced05p-35, 0x0p+0, -0x1.6d53177c19412p-40, 0x0p+0, 0x1.f17697cf1cf13p-46, 0x0p+0, -0x1.69ca9cf3b7f54p-51, 0x1.e2637bef9ff1ap-55, 0x0p+0,
+	0x1.c1ad07b73b99p-3, -0x1.b84c63bd528cp-4, -0x1.c8a5fbe0e30bdp-6, 0x1.650a91c013de1p-6, 0x1.ad48d070b610ep-11, -0x1.1a87d405e3f28p-9, 0x1.96f53d7389791p-14, 0x1.225088487b5b7p-13, -0x1.b9f977ebbca5ap-17, -0x1.b29a69d397349p-18, 0x1.d5f5a3d58365ep-21, 0x1.f788190d3ffa3p-23, -0x1.5e6b5cbca89efp-25, -0x1.d38990d709ba1p-28, 0x1.97542481639eep-30, 0x1.626e93b72349ep-33, -0x1.84bfdb161bfp-35, -0x1.b8619c23b8ffp-39, 0x1.3aa3978469b8ep-40, 0x1.b876566a0c4aep-45, -0x1.bda4e7fedf42cp-46, -0x1.4ba46534bdf62p-51, 0x1.4ba46534bdf62p-51, -0x1.982ccb549b078p-55, 0x0p+0,
+	0x1.ad908d1a6a394p-4, -0x1.a9d82c50c22aap-4, 0x1.9438cf85e5dfdp-6, 0x1.2bce2f82176a2p-7, -0x1.5212f99bf8f7bp-8, 0x1.2aa29335c718dp-14, 0x1.a465f4ff6d495p-12, -0x1.d632686ab875fp-15, -0x1.247f4a7949db6p-16, 0x1.336beab6e82b5p-18, 0x1.c0bb529cb42c6p-22, -0x1.de8f4a5af5697p-23, -0x1.51272b8743523p-31, 0x1.0b1e5b606f68dp-27, -0x1.ce6696541d383p-32, -0x1.c9c5aab87e8efp-33, 0x1.7ad56b02d916ap-36, 0x1.350bca632af11p-38, -0x1.89a032953700ep-41, -0x1.46dbded2c025p-44, 0x1.3ee2feda191dep-46, 0x1.fe37fe29c1c97p-51, -0x1.fe37fe29c1c97p-52, 0x1.238db5ceb7e0dp-55, 0x0p+0,
+	0x1.eb18bca3c4808p-6, -0x1.75081834929cdp-5, 0x1.b08ca0f12fac9p-6, -0x1.5adcda8fd9b9ep-8, -0x1.686f087ac8d3ap-10, 0x1.dda854d4b7fd9p-11, -0x1.a089785f8b43cp-14, -0x1.6dee0da1691efp-15, 0x1.bd9afa1e2664p-17, 0x1.8131189c7774fp-22, -0x1.69249ef9c51dbp-21, 0x1.0d08168cfbb1bp-24, 0x1.4dff64f9fdcebp-26, -0x1.166acc431d977p-28, -0x1.36e5e738acd54p-32, 0x1.3d4d382471d7ep-33, -0x1.6ef49b04a714dp-39, -0x1.f9545cce435ap-39, 0x1.451d6dd45b9b7p-42, 0x1.27f77aef38e95p-44, -0x1.66bf5eb55c41ap-47, -0x1.ebff22ccd64b6p-51, 0x1.47ff6c888edcfp-52, -0x1.5ddd4091a9743p-56, 0x0p+0,
+	0x1.448df83d938f7p-8, -0x1.534edd7449018p-7, 0x1.31f1d5414b5c1p-7, -0x1.2626441c0704ep-8, 0x1.0ca2b0d5d8594p-10, 0x1.e2021e83ea9e9p-15, -0x1.b4fef8acf7a76p-14, 0x1.8f3fe602022afp-16, 0x1.00fe9d01fc0fap-20, -0x1.8ebc323441338p-20, 0x1.d20c77d86c2a6p-23, 0x1.05d7518e567c1p-25, -0x1.bccd887c25c26p-27, 0x1.3747651de8ec3p-31, 0x1.918ad6227d701p-32, -0x1.f432525040441p-35, -0x1.5325011f32ebp-38, 0x1.143c509b01eaep-39, -0x1.a4ee31af3fdfcp-45, -0x1.7ea9fe9f51571p-45, 0x1.3221987f7445ap-48, 0x1.5ddd4091a9743p-51, -0x1.5ddd4091a9743p-53, 0x1.5ddd4091a9743p-57, 0x0p+0,
+	0x1.d50af81490481p-12, -0x1.405efc9f8f9edp-10, 0x1.8d53e1391f647p-10, -0x1.2284e18acf0bcp-10, 0x1.0c63b16343927p-11, -0x1.291e5ef2e998cp-13, 0x1.d1ff3b43f2b11p-17, 0x1.7c76174d8aaffp-18, -0x1.5ab69d95c25dp-19, 0x1.79d896467a6c3p-22, 0x1.a67338ea8b39fp-25, -0x1.bee5290986844p-26, 0x1.7c88a0d7b6608p-29, 0x1.1b82a4f393e6dp-31, -0x1.7e96d45299dc6p-33, 0x1.0ffd4f50855bp-37, 0x1.254a45bce3a21p-38, -0x1.8d6ccd51b69a5p-41, -0x1.113efc9dc3483p-45, 0x1.6cba06afd987p-46, -0x1.6b87e5175a12bp-50, -0x1.7ea9fe9f51571p-52, 0x1.3221987f7445ap-54, -0x1.201f9e9613146p-58, 0x0p+0,
+	0x1.5352148247518p-16, -0x1.278425fb1b3dap-14, 0x1.dfa9a3b7b688bp-14, -0x1.de0d21e6f40f2p-14, 0x1.436a1cacd784dp-14, -0x1.33d28f8c73351p-15, 0x1.95e15bc89912bp-17, -0x1.485bb76ea04c1p-19, 0x1.b9a8055e093ecp-24, 0x1.e06eb0c3d7a55p-24, -0x1.44a80b5788985p-25, 0x1.2ec02b7f8104dp-28, 0x1.511845a4b773bp-31, -0x1.4bec0b91af201p-32, 0x1.35c294bba70b5p-35, 0x1.1726827eb8964p-38, -0x1.e5a78c0d3255p-40, 0x1.3aa4879ec335fp-43, 0x1.eea648c2a5c18p-46, -0x1.fa7794c3cd89dp-48, 0x1.b02f6de11c9e9p-53, 0x1.44239268d576fp-53, -0x1.b02f6de11c9e9p-56, 0x1.802a28c819708p-60, 0x0p+0,
+	0x1.aa0f2f7c8232cp-22, -0x1.d6a0b1c44d43fp-20, 0x1.eb798f0a5ce86p-19, -0x1.41887f6d7a27cp-18, 0x1.2623a66ebd7b7p-18, -0x1.8ce22662f1c39p-19, 0x1.9499ab684125ep-20, -0x1.37defaf3db079p-21, 0x1.5ff9a2016cec4p-23, -0x1.016a1cca90835p-25, 0x1.982a102be0bf2p-30, 0x1.212c22c7a2165p-30, -0x1.96f8b5152a2d8p-32, 0x1.c55951f42bc92p-35, 0x1.30ce6fd95c669p-39, -0x1.4330bfc2ee7c5p-39, 0x1.abe194f5a4b3ap-42, 0x1.b14f8d7fb2b1ap-50, -0x1.8fc7df807bb94p-47, 0x1.e5d551130e2cp-50, 0x1.2c20efdc53dfep-55, -0x1.a42e1c9adbd31p-55, 0x1.e034b2fa1fccap-58, -0x1.946245e01ac74p-62, 0x0p+0,
+	0x1.6a1b551636b61p-29, -0x1.01652c72ef895p-26, 0x1.5caaa89fe5ep-25, -0x1.2af86db3a5daep-24, 0x1.6b8f747ee14e5p-24, -0x1.4c96f831a876bp-24, 0x1.d9806464eecf5p-25, -0x1.0b2e2d0291498p-25, 0x1.e133ac11f2622p-27, -0x1.57922f165909ap-28, 0x1.7a5e15aa47127p-30, -0x1.28371cd3a5d41p-32, 0x1.d18fe792ea2b6p-36, 0x1.120b13036d95bp-38, -0x1.3baf004ac3b8cp-39, 0x1.f17697cf1cf13p-42, -0x1.de547e4725acdp-46, -0x1.3b22957424de5p-47, 0x1.77292bd368d7ep-49, -0x1.1603900a1269p-52, -0x1.f97ad75821791p-56, 0x1.946245e01ac74p-57, -0x1.946245e01ac74p-60, 0x1.4381d180156c3p-64, 0x0p+0,
+	0x1.ff6a8c9e2c1e6p-39, -0x1.e994ffd1cd6d2p-36, 0x1.c00fb93823dd1p-34, -0x1.04bcc16084da2p-32, 0x1.b0fb8f3aed2fp-32, -0x1.10b8ca3f9e665p-31, 0x1.0e78a4e5497fap-31, -0x1.b070ef2045d71p-32, 0x1.1ad4d08a43a79p-32, -0x1.3128a3cd401f4p-33, 0x1.10185d889f9eap-34, -0x1.8ec6aad2240dep-36, 0x1.d8147ab01b872p-38, -0x1.b0d9f097766eep-40, 0x1.1102da96aa3f1p-42, -0x1.d98bf7e527dbcp-47, -0x1.a025ab4d420ebp-48, 0x1.2ad0caf8a4c9ap-49, -0x1.75a901aaa0be7p-52, 0x1.5532eaf516982p-57, 0x1.188a93ad1293dp-57, -0x1.10f588c412135p-59, 0x1.e542ba4020225p-63, -0x1.71b8ef6dcf572p-67, 0x0p+0,
+	0x1.761afb0c47486p-52, -0x1.0ce3320626f2ep-48, 0x1.71b7da231bc4cp-46, -0x1.437fec3d5b2c1p-44, 0x1.945d88b94926fp-43, -0x1.802127cb24bfep-42, 0x1.20121d1aa40b8p-41, -0x1.5dbc73d39bcc5p-41, 0x1.5d9ba7158e246p-41, -0x1.232060aa8a5bep-41, 0x1.96faa9bc1b934p-42, -0x1.df8fe6b5b881bp-43, 0x1.dcbc517bd111dp-44, -0x1.8e9bbe909f656p-45, 0x1.15e3114907424p-46, -0x1.3d10828401914p-48, 0x1.1c43c47659ae6p-50, -0x1.6827863b97d97p-53, 0x1.802a28c819708p-57, 0x1.946245e01ac74p-59, -0x1.4381d180156c3p-60, 0x1.ce272b49432cep-63, -0x1.71b8ef6dcf572p-66, 0x1.0ce396db7f853p-70, 0x0p+0,
+	0x1.761b41316381ap-75, -0x1.0ce396db7f853p-70, 0x1.71b8ef6dcf572p-67, -0x1.4381d180156c3p-64, 0x1.946245e01ac74p-62, -0x1.802a28c819708p-60, 0x1.201f9e9613146p-58, -0x1.5ddd4091a9743p-57, 0x1.5ddd4091a9743p-56, -0x1.238db5ceb7e0dp-55, 0x1.982ccb549b078p-55, -0x1.e2637bef9ff1ap-55, 0x1.e2637bef9ff1ap-55, -0x1.982ccb549b078p-55, 0x1.238db5ceb7e0dp-55, -0x1.5ddd4091a9743p-56, 0x1.5ddd4091a9743p-57, -0x1.201f9e9613146p-58, 0x1.802a28c819708p-60, -0x1.946245e01ac74p-62, 0x1.4381d180156c3p-64, -0x1.71b8ef6dcf572p-67, 0x1.0ce396db7f853p-70, -0x1.761b41316381ap-75, 0x0p+0,
+	0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0,
+};
+
+static const float  LR_gsn_cdff[5524] = {
+/* 1 */
+	0x0p+0f, 0x1p+0f,
+	0x1p+0f, 0x0p+0f,
+/* 2 */
+	0x0p+0f, 0x0p+0f, 0x1p-1f,
+	0x1p-1f, 0x1p+0f, -0x1p-1f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f,
+/* 3 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.555556p-3f,
+	0x1.555556p-3f, 0x1p-1f, 0x1p-1f, -0x1.555556p-2f,
+	0x1.aaaaaap-1f, 0x1p-1f, -0x1p-1f, 0x1.555556p-3f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 4 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.555556p-5f,
+	0x1.555556p-5f, 0x1.555556p-3f, 0x1p-2f, 0x1.555556p-3f, -0x1p-3f,
+	0x1p-1f, 0x1.555556p-1f, 0x0p+0f, -0x1.555556p-2f, 0x1p-3f,
+	0x1.eaaaaap-1f, 0x1.555556p-3f, -0x1p-2f, 0x1.555556p-3f, -0x1.555556p-5f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 5 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.111112p-7f,
+	0x1.111112p-7f, 0x1.555556p-5f, 0x1.555556p-4f, 0x1.555556p-4f, 0x1.555556p-5f, -0x1.111112p-5f,
+	0x1.ccccccp-3f, 0x1.d55556p-2f, 0x1p-2f, -0x1.555556p-4f, -0x1p-3f, 0x1.99999ap-5f,
+	0x1.8cccccp-1f, 0x1.d55556p-2f, -0x1p-2f, -0x1.555556p-4f, 0x1p-3f, -0x1.111112p-5f,
+	0x1.fbbbbcp-1f, 0x1.555556p-5f, -0x1.555556p-4f, 0x1.555556p-4f, -0x1.555556p-5f, 0x1.111112p-7f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 6 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.6c16c2p-10f,
+	0x1.6c16c2p-10f, 0x1.111112p-7f, 0x1.555556p-6f, 0x1.c71c72p-6f, 0x1.555556p-6f, 0x1.111112p-7f, -0x1.c71c72p-8f,
+	0x1.49f4ap-4f, 0x1.bbbbbcp-3f, 0x1.aaaaaap-3f, 0x1.c71c72p-5f, -0x1.555556p-5f, -0x1.111112p-5f, 0x1.c71c72p-7f,
+	0x1p-1f, 0x1.19999ap-1f, 0x0p+0f, -0x1.555556p-3f, 0x0p+0f, 0x1.99999ap-5f, -0x1.c71c72p-7f,
+	0x1.d6c16cp-1f, 0x1.bbbbbcp-3f, -0x1.aaaaaap-3f, 0x1.c71c72p-5f, 0x1.555556p-5f, -0x1.111112p-5f, 0x1.c71c72p-8f,
+	0x1.ff49f4p-1f, 0x1.111112p-7f, -0x1.555556p-6f, 0x1.c71c72p-6f, -0x1.555556p-6f, 0x1.111112p-7f, -0x1.6c16c2p-10f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 7 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.a01a02p-13f,
+	0x1.a01a02p-13f, 0x1.6c16c2p-10f, 0x1.111112p-8f, 0x1.c71c72p-8f, 0x1.c71c72p-8f, 0x1.111112p-8f, 0x1.6c16c2p-10f, -0x1.381382p-10f,
+	0x1.895896p-6f, 0x1.444444p-4f, 0x1.aaaaaap-4f, 0x1p-4f, 0x1.c71c72p-8f, -0x1.99999ap-7f, -0x1.c71c72p-8f, 0x1.861862p-9f,
+	0x1.0a90aap-2f, 0x1.ad82d8p-2f, 0x1.555556p-3f, -0x1.1c71c8p-4f, -0x1.c71c72p-5f, 0x1.111112p-7f, 0x1.c71c72p-7f, -0x1.041042p-8f,
+	0x1.7ab7acp-1f, 0x1.ad82d8p-2f, -0x1.555556p-3f, -0x1.1c71c8p-4f, 0x1.c71c72p-5f, 0x1.111112p-7f, -0x1.c71c72p-7f, 0x1.861862p-9f,
+	0x1.f3b53cp-1f, 0x1.444444p-4f, -0x1.aaaaaap-4f, 0x1p-4f, -0x1.c71c72p-8f, -0x1.99999ap-7f, 0x1.c71c72p-8f, -0x1.381382p-10f,
+	0x1.ffe5fep-1f, 0x1.6c16c2p-10f, -0x1.111112p-8f, 0x1.c71c72p-8f, -0x1.c71c72p-8f, 0x1.111112p-8f, -0x1.6c16c2p-10f, 0x1.a01a02p-13f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 8 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.a01a02p-16f,
+	0x1.a01a02p-16f, 0x1.a01a02p-13f, 0x1.6c16c2p-11f, 0x1.6c16c2p-10f, 0x1.c71c72p-10f, 0x1.6c16c2p-10f, 0x1.6c16c2p-11f, 0x1.a01a02p-13f, -0x1.6c16c2p-13f,
+	0x1.931932p-8f, 0x1.861862p-6f, 0x1.3e93eap-5f, 0x1.111112p-5f, 0x1.c71c72p-7f, 0x0p+0f, -0x1.6c16c2p-9f, -0x1.381382p-10f, 0x1.111112p-11f,
+	0x1.cd4ed4p-4f, 0x1.e3f64p-3f, 0x1.5c71c8p-3f, 0x1.555556p-6f, -0x1.0e38e4p-5f, -0x1.99999ap-7f, 0x1.c71c72p-9f, 0x1.861862p-9f, -0x1.c71c72p-11f,
+	0x1p-1f, 0x1.eadeaep-2f, 0x0p+0f, -0x1.c71c72p-4f, 0x0p+0f, 0x1.6c16c2p-6f, 0x0p+0f, -0x1.041042p-8f, 0x1.c71c72p-11f,
+	0x1.c65626p-1f, 0x1.e3f64p-3f, -0x1.5c71c8p-3f, 0x1.555556p-6f, 0x1.0e38e4p-5f, -0x1.99999ap-7f, -0x1.c71c72p-9f, 0x1.861862p-9f, -0x1.111112p-11f,
+	0x1.fcd9cep-1f, 0x1.861862p-6f, -0x1.3e93eap-5f, 0x1.111112p-5f, -0x1.c71c72p-7f, 0x0p+0f, 0x1.6c16c2p-9f, -0x1.381382p-10f, 0x1.6c16c2p-13f,
+	0x1.fffccp-1f, 0x1.a01a02p-13f, -0x1.6c16c2p-11f, 0x1.6c16c2p-10f, -0x1.c71c72p-10f, 0x1.6c16c2p-10f, -0x1.6c16c2p-11f, 0x1.a01a02p-13f, -0x1.a01a02p-16f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 9 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.71de3ap-19f,
+	0x1.71de3ap-19f, 0x1.a01a02p-16f, 0x1.a01a02p-14f, 0x1.e573acp-13f, 0x1.6c16c2p-12f, 0x1.6c16c2p-12f, 0x1.e573acp-13f, 0x1.a01a02p-14f, 0x1.a01a02p-16f, -0x1.71de3ap-16f,
+	0x1.6b5dd2p-10f, 0x1.917918p-8f, 0x1.82d82ep-7f, 0x1.a12f68p-7f, 0x1.05b05cp-7f, 0x1.3e93eap-9f, -0x1.e573acp-13f, -0x1.041042p-11f, -0x1.6c16c2p-13f, 0x1.43a274p-14f,
+	0x1.552152p-5f, 0x1.b41d42p-4f, 0x1.b33334p-4f, 0x1.666666p-5f, -0x1.99999ap-9f, -0x1.333334p-7f, -0x1.111112p-9f, 0x1.d41d42p-11f, 0x1.111112p-11f, -0x1.43a274p-13f,
+	0x1.23a048p-2f, 0x1.8cac4ap-2f, 0x1.f1c71cp-4f, -0x1.d097b4p-5f, -0x1.0e38e4p-5f, 0x1.b05b06p-8f, 0x1.7b425ep-8f, -0x1.041042p-11f, -0x1.c71c72p-11f, 0x1.948b1p-13f,
+	0x1.6e2fdcp-1f, 0x1.8cac4ap-2f, -0x1.f1c71cp-4f, -0x1.d097b4p-5f, 0x1.0e38e4p-5f, 0x1.b05b06p-8f, -0x1.7b425ep-8f, -0x1.041042p-11f, 0x1.c71c72p-11f, -0x1.43a274p-13f,
+	0x1.eaadeap-1f, 0x1.b41d42p-4f, -0x1.b33334p-4f, 0x1.666666p-5f, 0x1.99999ap-9f, -0x1.333334p-7f, 0x1.111112p-9f, 0x1.d41d42p-11f, -0x1.111112p-11f, 0x1.43a274p-14f,
+	0x1.ff4a52p-1f, 0x1.917918p-8f, -0x1.82d82ep-7f, 0x1.a12f68p-7f, -0x1.05b05cp-7f, 0x1.3e93eap-9f, 0x1.e573acp-13f, -0x1.041042p-11f, 0x1.6c16c2p-13f, -0x1.71de3ap-16f,
+	0x1.ffffa4p-1f, 0x1.a01a02p-16f, -0x1.a01a02p-14f, 0x1.e573acp-13f, -0x1.6c16c2p-12f, 0x1.6c16c2p-12f, -0x1.e573acp-13f, 0x1.a01a02p-14f, -0x1.a01a02p-16f, 0x1.71de3ap-19f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 10 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.27e4fcp-22f,
+	0x1.27e4fcp-22f, 0x1.71de3ap-19f, 0x1.a01a02p-17f, 0x1.1566acp-15f, 0x1.e573acp-15f, 0x1.234568p-14f, 0x1.e573acp-15f, 0x1.1566acp-15f, 0x1.a01a02p-17f, 0x1.71de3ap-19f, -0x1.4ce19ap-19f,
+	0x1.25014p-12f, 0x1.6aa4e4p-10f, 0x1.8fd8fep-9f, 0x1.ff754cp-9f, 0x1.99999ap-9f, 0x1.907f6ep-10f, 0x1.6c16c2p-12f, -0x1.1566acp-14f, -0x1.381382p-14f, -0x1.71de3ap-16f, 0x1.4ce19ap-17f,
+	0x1.b92698p-7f, 0x1.49c664p-5f, 0x1.9b05bp-5f, 0x1.01e574p-5f, 0x1.fc3518p-8f, -0x1.234568p-9f, -0x1.01e574p-9f, -0x1.1566acp-12f, 0x1.6c16c2p-13f, 0x1.43a274p-14f, -0x1.845c8ap-16f,
+	0x1.1c786cp-3f, 0x1.f1f83cp-3f, 0x1.1fa4fap-3f, 0x1.4dbf86p-8f, -0x1.9b7f0ep-6f, -0x1.876544p-8f, 0x1.5ceb24p-9f, 0x1.26bd16p-10f, -0x1.6c16c2p-13f, -0x1.43a274p-13f, 0x1.234568p-15f,
+	0x1p-1f, 0x1.b8bf7p-2f, 0x0p+0f, -0x1.4bda12p-4f, 0x0p+0f, 0x1.b05b06p-7f, 0x0p+0f, -0x1.b1706cp-10f, 0x0p+0f, 0x1.948b1p-13f, -0x1.234568p-15f,
+	0x1.b8e1e4p-1f, 0x1.f1f83cp-3f, -0x1.1fa4fap-3f, 0x1.4dbf86p-8f, 0x1.9b7f0ep-6f, -0x1.876544p-8f, -0x1.5ceb24p-9f, 0x1.26bd16p-10f, 0x1.6c16c2p-13f, -0x1.43a274p-13f, 0x1.845c8ap-16f,
+	0x1.f91b66p-1f, 0x1.49c664p-5f, -0x1.9b05bp-5f, 0x1.01e574p-5f, -0x1.fc3518p-8f, -0x1.234568p-9f, 0x1.01e574p-9f, -0x1.1566acp-12f, -0x1.6c16c2p-13f, 0x1.43a274p-14f, -0x1.4ce19ap-17f,
+	0x1.ffdb6p-1f, 0x1.6aa4e4p-10f, -0x1.8fd8fep-9f, 0x1.ff754cp-9f, -0x1.99999ap-9f, 0x1.907f6ep-10f, -0x1.6c16c2p-12f, -0x1.1566acp-14f, 0x1.381382p-14f, -0x1.71de3ap-16f, 0x1.4ce19ap-19f,
+	0x1.fffff6p-1f, 0x1.71de3ap-19f, -0x1.a01a02p-17f, 0x1.1566acp-15f, -0x1.e573acp-15f, 0x1.234568p-14f, -0x1.e573acp-15f, 0x1.1566acp-15f, -0x1.a01a02p-17f, 0x1.71de3ap-19f, -0x1.27e4fcp-22f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 11 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.ae6456p-26f,
+	0x1.ae6456p-26f, 0x1.27e4fcp-22f, 0x1.71de3ap-20f, 0x1.1566acp-18f, 0x1.1566acp-17f, 0x1.845c8ap-17f, 0x1.845c8ap-17f, 0x1.1566acp-17f, 0x1.1566acp-18f, 0x1.71de3ap-20f, 0x1.27e4fcp-22f, -0x1.0cfeb6p-22f,
+	0x1.ac148cp-15f, 0x1.24b746p-12f, 0x1.69ebf4p-11f, 0x1.097b42p-10f, 0x1.fb1fb2p-11f, 0x1.419ca2p-11f, 0x1.fdb976p-13f, 0x1.5ac056p-15f, -0x1.a01a02p-17f, -0x1.43a274p-17f, -0x1.4ce19ap-19f, 0x1.2e9e8cp-20f,
+	0x1.fbe466p-9f, 0x1.affe8ep-7f, 0x1.3e713cp-6f, 0x1.015acp-6f, 0x1.c3dc3ep-8f, 0x1.e573acp-11f, -0x1.47ae14p-11f, -0x1.5ac056p-12f, -0x1.a01a02p-16f, 0x1.ce55c8p-16f, 0x1.4ce19ap-17f, -0x1.937e12p-19f,
+	0x1.e3f54ep-5f, 0x1.00e602p-3f, 0x1.9f86a4p-4f, 0x1.ed097cp-6f, -0x1.b05b06p-8f, -0x1.aed6aap-8f, -0x1.47ae14p-11f, 0x1.5ac056p-11f, 0x1.6c16c2p-13f, -0x1.43a274p-15f, -0x1.845c8ap-16f, 0x1.610e4ep-18f,
+	0x1.364f64p-2f, 0x1.71c3cap-2f, 0x1.7f86a4p-4f, -0x1.7f86a4p-5f, -0x1.60b60cp-6f, 0x1.493272p-8f, 0x1.a2b3c4p-9f, -0x1.8ec396p-12f, -0x1.6c16c2p-12f, 0x1.43a274p-16f, 0x1.234568p-15f, -0x1.a7aac6p-18f,
+	0x1.64d84ep-1f, 0x1.71c3cap-2f, -0x1.7f86a4p-4f, -0x1.7f86a4p-5f, 0x1.60b60cp-6f, 0x1.493272p-8f, -0x1.a2b3c4p-9f, -0x1.8ec396p-12f, 0x1.6c16c2p-12f, 0x1.43a274p-16f, -0x1.234568p-15f, 0x1.610e4ep-18f,
+	0x1.e1c0acp-1f, 0x1.00e602p-3f, -0x1.9f86a4p-4f, 0x1.ed097cp-6f, 0x1.b05b06p-8f, -0x1.aed6aap-8f, 0x1.47ae14p-11f, 0x1.5ac056p-11f, -0x1.6c16c2p-13f, -0x1.43a274p-15f, 0x1.845c8ap-16f, -0x1.937e12p-19f,
+	0x1.fe041cp-1f, 0x1.affe8ep-7f, -0x1.3e713cp-6f, 0x1.015acp-6f, -0x1.c3dc3ep-8f, 0x1.e573acp-11f, 0x1.47ae14p-11f, -0x1.5ac056p-12f, 0x1.a01a02p-16f, 0x1.ce55c8p-16f, -0x1.4ce19ap-17f, 0x1.2e9e8cp-20f,
+	0x1.fff95p-1f, 0x1.24b746p-12f, -0x1.69ebf4p-11f, 0x1.097b42p-10f, -0x1.fb1fb2p-11f, 0x1.419ca2p-11f, -0x1.fdb976p-13f, 0x1.5ac056p-15f, 0x1.a01a02p-17f, -0x1.43a274p-17f, 0x1.4ce19ap-19f, -0x1.0cfeb6p-22f,
+	0x1p+0f, 0x1.27e4fcp-22f, -0x1.71de3ap-20f, 0x1.1566acp-18f, -0x1.1566acp-17f, 0x1.845c8ap-17f, -0x1.845c8ap-17f, 0x1.1566acp-17f, -0x1.1566acp-18f, 0x1.71de3ap-20f, -0x1.27e4fcp-22f, 0x1.ae6456p-26f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 12 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.1eed8ep-29f,
+	0x1.1eed8ep-29f, 0x1.ae6456p-26f, 0x1.27e4fcp-23f, 0x1.ed284ep-22f, 0x1.1566acp-20f, 0x1.bbd77ap-20f, 0x1.02e85cp-19f, 0x1.bbd77ap-20f, 0x1.1566acp-20f, 0x1.ed284ep-22f, 0x1.27e4fcp-23f, 0x1.ae6456p-26f, -0x1.8a86a4p-26f,
+	0x1.1e165cp-17f, 0x1.abdecp-15f, 0x1.246d4cp-13f, 0x1.e1995cp-13f, 0x1.0865dcp-12f, 0x1.923b46p-13f, 0x1.a4b996p-14f, 0x1.1566acp-15f, 0x1.1566acp-18f, -0x1.ed284ep-20f, -0x1.27e4fcp-20f, -0x1.0cfeb6p-22f, 0x1.ed284ep-24f,
+	0x1.07faaep-10f, 0x1.f53414p-9f, 0x1.a6d8d4p-8f, 0x1.99827cp-8f, 0x1.e18618p-9f, 0x1.36c6ap-10f, 0x1.b4e81cp-15f, -0x1.041042p-13f, -0x1.861862p-15f, -0x1.71de3ap-20f, 0x1.f35268p-19f, 0x1.2e9e8cp-20f, -0x1.71de3ap-22f,
+	0x1.6cf692p-6f, 0x1.c43706p-5f, 0x1.cbcc34p-5f, 0x1.bfe31ap-6f, 0x1.d75d76p-9f, -0x1.61afb4p-9f, -0x1.47ae14p-10f, 0x0p+0f, 0x1.041042p-13f, 0x1.71de3ap-16f, -0x1.bbd77ap-18f, -0x1.937e12p-19f, 0x1.71de3ap-21f,
+	0x1.492b44p-3f, 0x1.f3a174p-3f, 0x1.e2a19p-4f, -0x1.555556p-9f, -0x1.3b05bp-6f, -0x1.876544p-9f, 0x1.fab0bcp-10f, 0x1.1e11e2p-11f, -0x1.111112p-13f, -0x1.e573acp-15f, 0x1.845c8ap-18f, 0x1.610e4ep-18f, -0x1.02e85cp-20f,
+	0x1p-1f, 0x1.93613ap-2f, 0x0p+0f, -0x1.ff5e2ep-5f, 0x0p+0f, 0x1.1a2b3cp-7f, 0x0p+0f, -0x1.de844ep-11f, 0x0p+0f, 0x1.43a274p-14f, 0x0p+0f, -0x1.a7aac6p-18f, 0x1.02e85cp-20f,
+	0x1.adb53p-1f, 0x1.f3a174p-3f, -0x1.e2a19p-4f, -0x1.555556p-9f, 0x1.3b05bp-6f, -0x1.876544p-9f, -0x1.fab0bcp-10f, 0x1.1e11e2p-11f, 0x1.111112p-13f, -0x1.e573acp-15f, -0x1.845c8ap-18f, 0x1.610e4ep-18f, -0x1.71de3ap-21f,
+	0x1.f4984cp-1f, 0x1.c43706p-5f, -0x1.cbcc34p-5f, 0x1.bfe31ap-6f, -0x1.d75d76p-9f, -0x1.61afb4p-9f, 0x1.47ae14p-10f, 0x0p+0f, -0x1.041042p-13f, 0x1.71de3ap-16f, 0x1.bbd77ap-18f, -0x1.937e12p-19f, 0x1.71de3ap-22f,
+	0x1.ff7c02p-1f, 0x1.f53414p-9f, -0x1.a6d8d4p-8f, 0x1.99827cp-8f, -0x1.e18618p-9f, 0x1.36c6ap-10f, -0x1.b4e81cp-15f, -0x1.041042p-13f, 0x1.861862p-15f, -0x1.71de3ap-20f, -0x1.f35268p-19f, 0x1.2e9e8cp-20f, -0x1.ed284ep-24f,
+	0x1.fffee2p-1f, 0x1.abdecp-15f, -0x1.246d4cp-13f, 0x1.e1995cp-13f, -0x1.0865dcp-12f, 0x1.923b46p-13f, -0x1.a4b996p-14f, 0x1.1566acp-15f, -0x1.1566acp-18f, -0x1.ed284ep-20f, 0x1.27e4fcp-20f, -0x1.0cfeb6p-22f, 0x1.8a86a4p-26f,
+	0x1p+0f, 0x1.ae6456p-26f, -0x1.27e4fcp-23f, 0x1.ed284ep-22f, -0x1.1566acp-20f, 0x1.bbd77ap-20f, -0x1.02e85cp-19f, 0x1.bbd77ap-20f, -0x1.1566acp-20f, 0x1.ed284ep-22f, -0x1.27e4fcp-23f, 0x1.ae6456p-26f, -0x1.1eed8ep-29f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 13 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.612462p-33f,
+	0x1.612462p-33f, 0x1.1eed8ep-29f, 0x1.ae6456p-27f, 0x1.8a86a4p-25f, 0x1.ed284ep-24f, 0x1.bbd77ap-23f, 0x1.27e4fcp-22f, 0x1.27e4fcp-22f, 0x1.bbd77ap-23f, 0x1.ed284ep-24f, 0x1.8a86a4p-25f, 0x1.ae6456p-27f, 0x1.1eed8ep-29f, -0x1.08db48p-29f,
+	0x1.6094eap-20f, 0x1.1e046ep-17f, 0x1.aba8f4p-16f, 0x1.85847p-15f, 0x1.e0a2c8p-15f, 0x1.a54d88p-15f, 0x1.09d7bap-15f, 0x1.d794fp-17f, 0x1.0787fp-18f, 0x1.71de3ap-22f, -0x1.ed284ep-23f, -0x1.e430e2p-24f, -0x1.8a86a4p-26f, 0x1.6c2d84p-27f,
+	0x1.f519b8p-13f, 0x1.05be82p-10f, 0x1.ee8498p-10f, 0x1.13ce46p-9f, 0x1.8a75bp-10f, 0x1.66c77ep-11f, 0x1.5b544ap-13f, -0x1.ce55c8p-18f, -0x1.4969ecp-16f, -0x1.7992dcp-18f, 0x1.8a86a4p-25f, 0x1.d6bdbep-22f, 0x1.ed284ep-24f, -0x1.2f7b44p-25f,
+	0x1.eedfc8p-8f, 0x1.5c76e6p-6f, 0x1.a4e3c6p-6f, 0x1.0f4b66p-6f, 0x1.59827cp-8f, -0x1.041042p-16f, -0x1.536202p-11f, -0x1.861862p-13f, 0x1.041042p-16f, 0x1.3ddafap-16f, 0x1.3a634cp-19f, -0x1.f85d96p-21f, -0x1.71de3ap-22f, 0x1.556aacp-24f,
+	0x1.355ae8p-4f, 0x1.1b8c72p-3f, 0x1.8293b2p-4f, 0x1.50f9f4p-6f, -0x1.ea8dc6p-8f, -0x1.2b278p-8f, -0x1.923b46p-15f, 0x1.dcc878p-12f, 0x1.1e11e2p-14f, -0x1.d9e4bap-16f, -0x1.0c2784p-17f, 0x1.2e9e8cp-20f, 0x1.71de3ap-21f, -0x1.112224p-23f,
+	0x1.44ee1cp-2f, 0x1.5b6a5ep-2f, 0x1.3320fep-4f, -0x1.41c10ap-5f, -0x1.ea08dap-7f, 0x1.f8091ap-9f, 0x1.fab0bcp-10f, -0x1.21899p-12f, -0x1.7e4b18p-13f, 0x1.e573acp-17f, 0x1.c516a2p-17f, -0x1.1a71d8p-21f, -0x1.02e85cp-20f, 0x1.3ea7d4p-23f,
+	0x1.5d88f2p-1f, 0x1.5b6a5ep-2f, -0x1.3320fep-4f, -0x1.41c10ap-5f, 0x1.ea08dap-7f, 0x1.f8091ap-9f, -0x1.fab0bcp-10f, -0x1.21899p-12f, 0x1.7e4b18p-13f, 0x1.e573acp-17f, -0x1.c516a2p-17f, -0x1.1a71d8p-21f, 0x1.02e85cp-20f, -0x1.112224p-23f,
+	0x1.d954a4p-1f, 0x1.1b8c72p-3f, -0x1.8293b2p-4f, 0x1.50f9f4p-6f, 0x1.ea8dc6p-8f, -0x1.2b278p-8f, 0x1.923b46p-15f, 0x1.dcc878p-12f, -0x1.1e11e2p-14f, -0x1.d9e4bap-16f, 0x1.0c2784p-17f, 0x1.2e9e8cp-20f, -0x1.71de3ap-21f, 0x1.556aacp-24f,
+	0x1.fc224p-1f, 0x1.5c76e6p-6f, -0x1.a4e3c6p-6f, 0x1.0f4b66p-6f, -0x1.59827cp-8f, -0x1.041042p-16f, 0x1.536202p-11f, -0x1.861862p-13f, -0x1.041042p-16f, 0x1.3ddafap-16f, -0x1.3a634cp-19f, -0x1.f85d96p-21f, 0x1.71de3ap-22f, -0x1.2f7b44p-25f,
+	0x1.ffe0aep-1f, 0x1.05be82p-10f, -0x1.ee8498p-10f, 0x1.13ce46p-9f, -0x1.8a75bp-10f, 0x1.66c77ep-11f, -0x1.5b544ap-13f, -0x1.ce55c8p-18f, 0x1.4969ecp-16f, -0x1.7992dcp-18f, -0x1.8a86a4p-25f, 0x1.d6bdbep-22f, -0x1.ed284ep-24f, 0x1.6c2d84p-27f,
+	0x1.ffffd4p-1f, 0x1.1e046ep-17f, -0x1.aba8f4p-16f, 0x1.85847p-15f, -0x1.e0a2c8p-15f, 0x1.a54d88p-15f, -0x1.09d7bap-15f, 0x1.d794fp-17f, -0x1.0787fp-18f, 0x1.71de3ap-22f, 0x1.ed284ep-23f, -0x1.e430e2p-24f, 0x1.8a86a4p-26f, -0x1.08db48p-29f,
+	0x1p+0f, 0x1.1eed8ep-29f, -0x1.ae6456p-27f, 0x1.8a86a4p-25f, -0x1.ed284ep-24f, 0x1.bbd77ap-23f, -0x1.27e4fcp-22f, 0x1.27e4fcp-22f, -0x1.bbd77ap-23f, 0x1.ed284ep-24f, -0x1.8a86a4p-25f, 0x1.ae6456p-27f, -0x1.1eed8ep-29f, 0x1.612462p-33f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 14 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.93974ap-37f,
+	0x1.93974ap-37f, 0x1.612462p-33f, 0x1.1eed8ep-30f, 0x1.1eed8ep-28f, 0x1.8a86a4p-27f, 0x1.8a86a4p-26f, 0x1.27e4fcp-25f, 0x1.522a44p-25f, 0x1.27e4fcp-25f, 0x1.8a86a4p-26f, 0x1.8a86a4p-27f, 0x1.1eed8ep-28f, 0x1.1eed8ep-30f, 0x1.612462p-33f, -0x1.47eaecp-33f,
+	0x1.933f02p-23f, 0x1.6089e2p-20f, 0x1.1df28p-18f, 0x1.1cf77p-17f, 0x1.8521cep-17f, 0x1.7fbcf6p-17f, 0x1.17b676p-17f, 0x1.2d2da4p-18f, 0x1.ce55c8p-20f, 0x1.bbd77ap-22f, 0x1.8a86a4p-26f, -0x1.ae6456p-26f, -0x1.66a8f2p-27f, -0x1.08db48p-29f, 0x1.ebe062p-31f,
+	0x1.b62bfcp-15f, 0x1.f2588ep-13f, 0x1.038278p-11f, 0x1.45394ep-11f, 0x1.0db834p-11f, 0x1.2f8d48p-12f, 0x1.bb4386p-14f, 0x1.40fe1ep-16f, -0x1.5f5feap-19f, -0x1.5f5feap-19f, -0x1.408d66p-21f, 0x1.ae6456p-26f, 0x1.8a86a4p-25f, 0x1.6c2d84p-27f, -0x1.c2e306p-29f,
+	0x1.3127ep-9f, 0x1.df36fap-8f, 0x1.4c1afep-7f, 0x1.03fcfep-7f, 0x1.d9a33cp-9f, 0x1.8b0818p-11f, -0x1.e93554p-14f, -0x1.e71a62p-14f, -0x1.77a5b4p-16f, 0x1.05fd6ap-18f, 0x1.49cc8ep-19f, 0x1.c0533p-23f, -0x1.ed284ep-24f, -0x1.2f7b44p-25f, 0x1.19cde4p-27f,
+	0x1.04bc0ep-5f, 0x1.166cecp-4f, 0x1.dffb28p-5f, 0x1.7723acp-6f, 0x1.06ba32p-10f, -0x1.4e6ce6p-9f, -0x1.8d8494p-11f, 0x1.6722a2p-14f, 0x1.4fea54p-14f, 0x1.88fc1ep-18f, -0x1.3cb316p-18f, -0x1.f85d96p-21f, 0x1.71de3ap-23f, 0x1.556aacp-24f, -0x1.fb3f66p-27f,
+	0x1.6ee612p-3f, 0x1.ef2ec4p-3f, 0x1.9b484cp-4f, -0x1.a7b91p-8f, -0x1.ea3e04p-7f, -0x1.879cbep-10f, 0x1.6f72b2p-10f, 0x1.28b856p-12f, -0x1.7f2904p-14f, -0x1.d2f55cp-16f, 0x1.1ea5d4p-18f, 0x1.064524p-19f, -0x1.27e4fcp-23f, -0x1.112224p-23f, 0x1.522a44p-26f,
+	0x1p-1f, 0x1.7623c8p-2f, 0x0p+0f, -0x1.998154p-5f, 0x0p+0f, 0x1.880714p-8f, 0x0p+0f, -0x1.21899p-11f, 0x0p+0f, 0x1.53d0f8p-15f, 0x0p+0f, -0x1.4984d2p-19f, 0x0p+0f, 0x1.3ea7d4p-23f, -0x1.522a44p-26f,
+	0x1.a4467cp-1f, 0x1.ef2ec4p-3f, -0x1.9b484cp-4f, -0x1.a7b91p-8f, 0x1.ea3e04p-7f, -0x1.879cbep-10f, -0x1.6f72b2p-10f, 0x1.28b856p-12f, 0x1.7f2904p-14f, -0x1.d2f55cp-16f, -0x1.1ea5d4p-18f, 0x1.064524p-19f, 0x1.27e4fcp-23f, -0x1.112224p-23f, 0x1.fb3f66p-27f,
+	0x1.efb44p-1f, 0x1.166cecp-4f, -0x1.dffb28p-5f, 0x1.7723acp-6f, -0x1.06ba32p-10f, -0x1.4e6ce6p-9f, 0x1.8d8494p-11f, 0x1.6722a2p-14f, -0x1.4fea54p-14f, 0x1.88fc1ep-18f, 0x1.3cb316p-18f, -0x1.f85d96p-21f, -0x1.71de3ap-23f, 0x1.556aacp-24f, -0x1.19cde4p-27f,
+	0x1.feced8p-1f, 0x1.df36fap-8f, -0x1.4c1afep-7f, 0x1.03fcfep-7f, -0x1.d9a33cp-9f, 0x1.8b0818p-11f, 0x1.e93554p-14f, -0x1.e71a62p-14f, 0x1.77a5b4p-16f, 0x1.05fd6ap-18f, -0x1.49cc8ep-19f, 0x1.c0533p-23f, 0x1.ed284ep-24f, -0x1.2f7b44p-25f, 0x1.c2e306p-29f,
+	0x1.fff928p-1f, 0x1.f2588ep-13f, -0x1.038278p-11f, 0x1.45394ep-11f, -0x1.0db834p-11f, 0x1.2f8d48p-12f, -0x1.bb4386p-14f, 0x1.40fe1ep-16f, 0x1.5f5feap-19f, -0x1.5f5feap-19f, 0x1.408d66p-21f, 0x1.ae6456p-26f, -0x1.8a86a4p-25f, 0x1.6c2d84p-27f, -0x1.ebe062p-31f,
+	0x1.fffffap-1f, 0x1.6089e2p-20f, -0x1.1df28p-18f, 0x1.1cf77p-17f, -0x1.8521cep-17f, 0x1.7fbcf6p-17f, -0x1.17b676p-17f, 0x1.2d2da4p-18f, -0x1.ce55c8p-20f, 0x1.bbd77ap-22f, -0x1.8a86a4p-26f, -0x1.ae6456p-26f, 0x1.66a8f2p-27f, -0x1.08db48p-29f, 0x1.47eaecp-33f,
+	0x1p+0f, 0x1.612462p-33f, -0x1.1eed8ep-30f, 0x1.1eed8ep-28f, -0x1.8a86a4p-27f, 0x1.8a86a4p-26f, -0x1.27e4fcp-25f, 0x1.522a44p-25f, -0x1.27e4fcp-25f, 0x1.8a86a4p-26f, -0x1.8a86a4p-27f, 0x1.1eed8ep-28f, -0x1.1eed8ep-30f, 0x1.612462p-33f, -0x1.93974ap-37f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 15 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.ae7f3ep-41f,
+	0x1.ae7f3ep-41f, 0x1.93974ap-37f, 0x1.612462p-34f, 0x1.7e9214p-32f, 0x1.1eed8ep-30f, 0x1.3b9eeap-29f, 0x1.07046ep-28f, 0x1.522a44p-28f, 0x1.522a44p-28f, 0x1.07046ep-28f, 0x1.3b9eeap-29f, 0x1.1eed8ep-30f, 0x1.7e9214p-32f, 0x1.612462p-34f, 0x1.93974ap-37f, -0x1.78af56p-37f,
+	0x1.ae4cccp-26f, 0x1.9338b4p-23f, 0x1.607ed8p-21f, 0x1.7d2b6cp-20f, 0x1.1cd392p-19f, 0x1.36ff56p-19f, 0x1.fe9f9ap-20f, 0x1.3e59cap-20f, 0x1.2a895p-21f, 0x1.92bec8p-23f, 0x1.4f58d8p-25f, 0x1.1eed8ep-30f, -0x1.4ebfd2p-29f, -0x1.e59206p-31f, -0x1.47eaecp-33f, 0x1.320e76p-34f,
+	0x1.6393fap-17f, 0x1.b498bep-15f, 0x1.ef977ap-14f, 0x1.5708c4p-13f, 0x1.40c57p-13f, 0x1.a5d2bp-14f, 0x1.84bf2cp-15f, 0x1.d2a0d2p-17f, 0x1.eb656ap-20f, -0x1.02e85cp-21f, -0x1.457be2p-22f, -0x1.e430e2p-25f, 0x1.1eed8ep-28f, 0x1.29f6b2p-28f, 0x1.ebe062p-31f, -0x1.320e76p-32f,
+	0x1.599516p-11f, 0x1.2a4f3p-9f, 0x1.cfa436p-9f, 0x1.a52e74p-9f, 0x1.df52d2p-10f, 0x1.44f758p-11f, 0x1.445746p-14f, -0x1.0a6bacp-15f, -0x1.1bacf4p-16f, -0x1.26ddf8p-19f, 0x1.5e244cp-21f, 0x1.2a22d6p-22f, 0x1.07046ep-26f, -0x1.a8dfc4p-27f, -0x1.c2e306p-29f, 0x1.a4d3e2p-31f,
+	0x1.8e8164p-7f, 0x1.e35322p-6f, 0x1.f0f2f8p-6f, 0x1.08a2fp-6f, 0x1.ea4a58p-9f, -0x1.11d1b4p-11f, -0x1.20c9f4p-11f, -0x1.806b54p-14f, 0x1.a71e82p-16f, 0x1.7e118ep-17f, 0x1.a32f0ep-23f, -0x1.5e40fep-21f, -0x1.9af6ecp-24f, 0x1.7b5a14p-26f, 0x1.19cde4p-27f, -0x1.a4d3e2p-30f,
+	0x1.73bd46p-4f, 0x1.2db70ep-3f, 0x1.63f84ep-4f, 0x1.c8c73cp-7f, -0x1.e111eep-8f, -0x1.a2777p-9f, 0x1.71a6cp-13f, 0x1.438bfep-12f, 0x1.9ddf5ap-16f, -0x1.3f96d2p-16f, -0x1.c429eap-19f, 0x1.b6cc4cp-21f, 0x1.02e85cp-22f, -0x1.99b334p-26f, -0x1.fb3f66p-27f, 0x1.3b9eeap-29f,
+	0x1.50c5e2p-2f, 0x1.488cf8p-2f, 0x1.fa3198p-5f, -0x1.123032p-5f, -0x1.648a32p-7f, 0x1.88319ep-9f, 0x1.469ed8p-10f, -0x1.a3f0ccp-13f, -0x1.b5e5bcp-14f, 0x1.54963cp-17f, 0x1.caa2ecp-18f, -0x1.a0f134p-22f, -0x1.8a86a4p-22f, 0x1.6c2d84p-27f, 0x1.522a44p-26f, -0x1.68b59ep-29f,
+	0x1.579d0ep-1f, 0x1.488cf8p-2f, -0x1.fa3198p-5f, -0x1.123032p-5f, 0x1.648a32p-7f, 0x1.88319ep-9f, -0x1.469ed8p-10f, -0x1.a3f0ccp-13f, 0x1.b5e5bcp-14f, 0x1.54963cp-17f, -0x1.caa2ecp-18f, -0x1.a0f134p-22f, 0x1.8a86a4p-22f, 0x1.6c2d84p-27f, -0x1.522a44p-26f, 0x1.3b9eeap-29f,
+	0x1.d18858p-1f, 0x1.2db70ep-3f, -0x1.63f84ep-4f, 0x1.c8c73cp-7f, 0x1.e111eep-8f, -0x1.a2777p-9f, -0x1.71a6cp-13f, 0x1.438bfep-12f, -0x1.9ddf5ap-16f, -0x1.3f96d2p-16f, 0x1.c429eap-19f, 0x1.b6cc4cp-21f, -0x1.02e85cp-22f, -0x1.99b334p-26f, 0x1.fb3f66p-27f, -0x1.a4d3e2p-30f,
+	0x1.f9c5fap-1f, 0x1.e35322p-6f, -0x1.f0f2f8p-6f, 0x1.08a2fp-6f, -0x1.ea4a58p-9f, -0x1.11d1b4p-11f, 0x1.20c9f4p-11f, -0x1.806b54p-14f, -0x1.a71e82p-16f, 0x1.7e118ep-17f, -0x1.a32f0ep-23f, -0x1.5e40fep-21f, 0x1.9af6ecp-24f, 0x1.7b5a14p-26f, -0x1.19cde4p-27f, 0x1.a4d3e2p-31f,
+	0x1.ffa99ap-1f, 0x1.2a4f3p-9f, -0x1.cfa436p-9f, 0x1.a52e74p-9f, -0x1.df52d2p-10f, 0x1.44f758p-11f, -0x1.445746p-14f, -0x1.0a6bacp-15f, 0x1.1bacf4p-16f, -0x1.26ddf8p-19f, -0x1.5e244cp-21f, 0x1.2a22d6p-22f, -0x1.07046ep-26f, -0x1.a8dfc4p-27f, 0x1.c2e306p-29f, -0x1.320e76p-32f,
+	0x1.fffe9cp-1f, 0x1.b498bep-15f, -0x1.ef977ap-14f, 0x1.5708c4p-13f, -0x1.40c57p-13f, 0x1.a5d2bp-14f, -0x1.84bf2cp-15f, 0x1.d2a0d2p-17f, -0x1.eb656ap-20f, -0x1.02e85cp-21f, 0x1.457be2p-22f, -0x1.e430e2p-25f, -0x1.1eed8ep-28f, 0x1.29f6b2p-28f, -0x1.ebe062p-31f, 0x1.320e76p-34f,
+	0x1p+0f, 0x1.9338b4p-23f, -0x1.607ed8p-21f, 0x1.7d2b6cp-20f, -0x1.1cd392p-19f, 0x1.36ff56p-19f, -0x1.fe9f9ap-20f, 0x1.3e59cap-20f, -0x1.2a895p-21f, 0x1.92bec8p-23f, -0x1.4f58d8p-25f, 0x1.1eed8ep-30f, 0x1.4ebfd2p-29f, -0x1.e59206p-31f, 0x1.47eaecp-33f, -0x1.78af56p-37f,
+	0x1p+0f, 0x1.93974ap-37f, -0x1.612462p-34f, 0x1.7e9214p-32f, -0x1.1eed8ep-30f, 0x1.3b9eeap-29f, -0x1.07046ep-28f, 0x1.522a44p-28f, -0x1.522a44p-28f, 0x1.07046ep-28f, -0x1.3b9eeap-29f, 0x1.1eed8ep-30f, -0x1.7e9214p-32f, 0x1.612462p-34f, -0x1.93974ap-37f, 0x1.ae7f3ep-41f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 16 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.ae7f3ep-45f,
+	0x1.ae7f3ep-45f, 0x1.ae7f3ep-41f, 0x1.93974ap-38f, 0x1.d6db2cp-36f, 0x1.7e9214p-34f, 0x1.cb15b2p-33f, 0x1.a4d3e2p-32f, 0x1.2c9758p-31f, 0x1.522a44p-31f, 0x1.2c9758p-31f, 0x1.a4d3e2p-32f, 0x1.cb15b2p-33f, 0x1.7e9214p-34f, 0x1.d6db2cp-36f, 0x1.93974ap-38f, 0x1.ae7f3ep-41f, -0x1.93974ap-41f,
+	0x1.ae6456p-29f, 0x1.ae496ep-26f, 0x1.933264p-24f, 0x1.d5efbep-23f, 0x1.7d1382p-22f, 0x1.c77f86p-22f, 0x1.9e4094p-22f, 0x1.23329ep-22f, 0x1.3d07ap-23f, 0x1.07046ep-24f, 0x1.3b9eeap-26f, 0x1.cb15b2p-29f, 0x0p+0f, -0x1.d6db2cp-33f, -0x1.2eb178p-34f, -0x1.78af56p-37f, 0x1.612462p-38f,
+	0x1.0d6a38p-19f, 0x1.62bcd4p-17f, 0x1.b30584p-16f, 0x1.488efep-15f, 0x1.540e6ep-15f, 0x1.fa1d04p-16f, 0x1.12bc78p-16f, 0x1.aa0ba4p-18f, 0x1.aad59ap-20f, 0x1.301d1ep-23f, -0x1.1facd8p-24f, -0x1.0b33ap-25f, -0x1.48c58ap-28f, 0x1.179222p-31f, 0x1.99e5a8p-32f, 0x1.320e76p-34f, -0x1.7e9214p-36f,
+	0x1.6a4006p-13f, 0x1.5406c6p-11f, 0x1.237ccep-10f, 0x1.2ac4fcp-10f, 0x1.8fbde8p-11f, 0x1.5f61b6p-12f, 0x1.6afc04p-14f, 0x1.291192p-18f, -0x1.7f13ep-18f, -0x1.1774b4p-19f, -0x1.703966p-23f, 0x1.7501ap-24f, 0x1.de3698p-26f, 0x1.d6db2cp-31f, -0x1.47eaecp-30f, -0x1.320e76p-32f, 0x1.1eed8ep-34f,
+	0x1.16c3aep-8f, 0x1.78e812p-7f, 0x1.be093cp-7f, 0x1.24a9ap-7f, 0x1.a7fa44p-9f, 0x1.91018p-12f, -0x1.8f30b4p-13f, -0x1.7860fcp-14f, -0x1.f66afcp-18f, 0x1.3a218ap-18f, 0x1.6ca0d6p-20f, -0x1.64dddep-25f, -0x1.4ce19ap-24f, -0x1.255d8ep-27f, 0x1.522a44p-29f, 0x1.a4d3e2p-31f, -0x1.3b9eeap-33f,
+	0x1.55122cp-5f, 0x1.41ed18p-4f, 0x1.e29952p-5f, 0x1.34fa16p-6f, -0x1.21fa94p-11f, -0x1.227c72p-9f, -0x1.d2aeaep-12f, 0x1.b3a8bap-14f, 0x1.a3a6d4p-15f, -0x1.07046ep-24f, -0x1.987faep-19f, -0x1.5be67p-22f, 0x1.07046ep-23f, 0x1.bd1b3p-26f, -0x1.c2e306p-29f, -0x1.a4d3e2p-30f, 0x1.07046ep-32f,
+	0x1.8f3a62p-3f, 0x1.e7ad22p-3f, 0x1.6362e2p-4f, -0x1.125406p-7f, -0x1.846202p-7f, -0x1.733722p-11f, 0x1.0e385ap-10f, 0x1.407924p-13f, -0x1.0ac232p-14f, -0x1.e136bap-17f, 0x1.87e7f2p-19f, 0x1.f1fa18p-21f, -0x1.af8344p-24f, -0x1.921cecp-25f, 0x1.522a44p-29f, 0x1.3b9eeap-29f, -0x1.522a44p-32f,
+	0x1p-1f, 0x1.5e743cp-2f, 0x0p+0f, -0x1.517666p-5f, 0x0p+0f, 0x1.1d3b5cp-8f, 0x0p+0f, -0x1.7547d2p-12f, 0x0p+0f, 0x1.853dfcp-16f, 0x0p+0f, -0x1.4d8dc4p-20f, 0x0p+0f, 0x1.e59206p-25f, 0x0p+0f, -0x1.68b59ep-29f, 0x1.522a44p-32f,
+	0x1.9c3168p-1f, 0x1.e7ad22p-3f, -0x1.6362e2p-4f, -0x1.125406p-7f, 0x1.846202p-7f, -0x1.733722p-11f, -0x1.0e385ap-10f, 0x1.407924p-13f, 0x1.0ac232p-14f, -0x1.e136bap-17f, -0x1.87e7f2p-19f, 0x1.f1fa18p-21f, 0x1.af8344p-24f, -0x1.921cecp-25f, -0x1.522a44p-29f, 0x1.3b9eeap-29f, -0x1.07046ep-32f,
+	0x1.eaaedep-1f, 0x1.41ed18p-4f, -0x1.e29952p-5f, 0x1.34fa16p-6f, 0x1.21fa94p-11f, -0x1.227c72p-9f, 0x1.d2aeaep-12f, 0x1.b3a8bap-14f, -0x1.a3a6d4p-15f, -0x1.07046ep-24f, 0x1.987faep-19f, -0x1.5be67p-22f, -0x1.07046ep-23f, 0x1.bd1b3p-26f, 0x1.c2e306p-29f, -0x1.a4d3e2p-30f, 0x1.3b9eeap-33f,
+	0x1.fdd278p-1f, 0x1.78e812p-7f, -0x1.be093cp-7f, 0x1.24a9ap-7f, -0x1.a7fa44p-9f, 0x1.91018p-12f, 0x1.8f30b4p-13f, -0x1.7860fcp-14f, 0x1.f66afcp-18f, 0x1.3a218ap-18f, -0x1.6ca0d6p-20f, -0x1.64dddep-25f, 0x1.4ce19ap-24f, -0x1.255d8ep-27f, -0x1.522a44p-29f, 0x1.a4d3e2p-31f, -0x1.1eed8ep-34f,
+	0x1.ffe95cp-1f, 0x1.5406c6p-11f, -0x1.237ccep-10f, 0x1.2ac4fcp-10f, -0x1.8fbde8p-11f, 0x1.5f61b6p-12f, -0x1.6afc04p-14f, 0x1.291192p-18f, 0x1.7f13ep-18f, -0x1.1774b4p-19f, 0x1.703966p-23f, 0x1.7501ap-24f, -0x1.de3698p-26f, 0x1.d6db2cp-31f, 0x1.47eaecp-30f, -0x1.320e76p-32f, 0x1.7e9214p-36f,
+	0x1.ffffbcp-1f, 0x1.62bcd4p-17f, -0x1.b30584p-16f, 0x1.488efep-15f, -0x1.540e6ep-15f, 0x1.fa1d04p-16f, -0x1.12bc78p-16f, 0x1.aa0ba4p-18f, -0x1.aad59ap-20f, 0x1.301d1ep-23f, 0x1.1facd8p-24f, -0x1.0b33ap-25f, 0x1.48c58ap-28f, 0x1.179222p-31f, -0x1.99e5a8p-32f, 0x1.320e76p-34f, -0x1.612462p-38f,
+	0x1p+0f, 0x1.ae496ep-26f, -0x1.933264p-24f, 0x1.d5efbep-23f, -0x1.7d1382p-22f, 0x1.c77f86p-22f, -0x1.9e4094p-22f, 0x1.23329ep-22f, -0x1.3d07ap-23f, 0x1.07046ep-24f, -0x1.3b9eeap-26f, 0x1.cb15b2p-29f, 0x0p+0f, -0x1.d6db2cp-33f, 0x1.2eb178p-34f, -0x1.78af56p-37f, 0x1.93974ap-41f,
+	0x1p+0f, 0x1.ae7f3ep-41f, -0x1.93974ap-38f, 0x1.d6db2cp-36f, -0x1.7e9214p-34f, 0x1.cb15b2p-33f, -0x1.a4d3e2p-32f, 0x1.2c9758p-31f, -0x1.522a44p-31f, 0x1.2c9758p-31f, -0x1.a4d3e2p-32f, 0x1.cb15b2p-33f, -0x1.7e9214p-34f, 0x1.d6db2cp-36f, -0x1.93974ap-38f, 0x1.ae7f3ep-41f, -0x1.ae7f3ep-45f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 17 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.952c78p-49f,
+	0x1.952c78p-49f, 0x1.ae7f3ep-45f, 0x1.ae7f3ep-42f, 0x1.0d0f88p-39f, 0x1.d6db2cp-38f, 0x1.320e76p-36f, 0x1.320e76p-35f, 0x1.e0f228p-35f, 0x1.2c9758p-34f, 0x1.2c9758p-34f, 0x1.e0f228p-35f, 0x1.320e76p-35f, 0x1.320e76p-36f, 0x1.d6db2cp-38f, 0x1.0d0f88p-39f, 0x1.ae7f3ep-42f, 0x1.ae7f3ep-45f, -0x1.952c78p-45f,
+	0x1.951f04p-32f, 0x1.ae62a8p-29f, 0x1.ae4612p-27f, 0x1.0cc80ep-25f, 0x1.d5e108p-25f, 0x1.30c948p-24f, 0x1.2f8418p-24f, 0x1.d8f622p-25f, 0x1.229c52p-25f, 0x1.18a14cp-26f, 0x1.a111fep-28f, 0x1.c1853ep-30f, 0x1.1eed8ep-32f, -0x1.d6db2cp-38f, -0x1.2eb178p-36f, -0x1.5dc762p-38f, -0x1.93974ap-41f, 0x1.7bd9bp-42f,
+	0x1.7f1e9ap-22f, 0x1.0cfe9ep-19f, 0x1.61e5aep-18f, 0x1.20f6e2p-17f, 0x1.46b90ep-17f, 0x1.0da9d2p-17f, 0x1.4caa04p-18f, 0x1.32963ep-19f, 0x1.97d87ap-21f, 0x1.582eccp-23f, 0x1.142b0cp-27f, -0x1.0a9a9ap-27f, -0x1.8a86a4p-29f, -0x1.94a45ap-32f, 0x1.c60a34p-35f, 0x1.02f88cp-35f, 0x1.612462p-38f, -0x1.bb28a2p-40f,
+	0x1.61d156p-15f, 0x1.660a5cp-13f, 0x1.4e7bd2p-12f, 0x1.7b964ap-12f, 0x1.208084p-12f, 0x1.2eca66p-13f, 0x1.aa5532p-15f, 0x1.5057e2p-17f, -0x1.01f422p-22f, -0x1.b35d94p-21f, -0x1.dd8a7p-23f, -0x1.46616cp-27f, 0x1.51bcf6p-27f, 0x1.58dd86p-29f, 0x1.b5393cp-36f, -0x1.cb15b2p-34f, -0x1.7e9214p-36f, 0x1.681104p-38f,
+	0x1.67ebdcp-10f, 0x1.0b71aep-8f, 0x1.63a7a6p-8f, 0x1.111116p-8f, 0x1.fea202p-10f, 0x1.033bd6p-11f, 0x1.08a98ep-17f, -0x1.4bd18cp-15f, -0x1.8af214p-17f, -0x1.a85226p-23f, 0x1.6b165p-21f, 0x1.2aa8bcp-23f, -0x1.6fa06p-27f, -0x1.166bdap-27f, -0x1.70e84ap-31f, 0x1.0bcca8p-32f, 0x1.1eed8ep-34f, -0x1.b0146ap-37f,
+	0x1.1dd9a8p-6f, 0x1.3239b6p-5f, 0x1.12d016p-5f, 0x1.eec95ap-7f, 0x1.454a8cp-9f, -0x1.8d2d88p-11f, -0x1.c6262cp-12f, -0x1.313e16p-15f, 0x1.9604dcp-16f, 0x1.acd91p-18f, -0x1.fd2f6p-22f, -0x1.adae9ep-22f, -0x1.94639cp-26f, 0x1.084824p-26f, 0x1.522a44p-29f, -0x1.a4d3e2p-32f, -0x1.3b9eeap-33f, 0x1.8c12b8p-36f,
+	0x1.ad174ep-4f, 0x1.39f5d6p-3f, 0x1.46b696p-4f, 0x1.303b4p-7f, -0x1.be241ap-8f, -0x1.283514p-9f, 0x1.07938cp-12f, 0x1.ba292ap-13f, 0x1.9a931ep-18f, -0x1.a7a16ep-17f, -0x1.7f53c2p-20f, 0x1.230e68p-21f, 0x1.bff38ap-24f, -0x1.26a144p-26f, -0x1.64f3bap-28f, 0x1.a4d3e2p-32f, 0x1.07046ep-32f, -0x1.1ae8ccp-35f,
+	0x1.5a9e84p-2f, 0x1.3862dp-2f, 0x1.aa76a8p-5f, -0x1.d9d92cp-6f, -0x1.0ce164p-7f, 0x1.36b4cep-9f, 0x1.ba2daap-11f, -0x1.34d2bp-13f, -0x1.0ac232p-14f, 0x1.da3cccp-18f, 0x1.f7e114p-19f, -0x1.1d05c8p-22f, -0x1.845c8ap-23f, 0x1.098bdcp-27f, 0x1.fb3f66p-28f, -0x1.68b59ep-33f, -0x1.522a44p-32f, 0x1.3e45e6p-35f,
+	0x1.52b0bep-1f, 0x1.3862dp-2f, -0x1.aa76a8p-5f, -0x1.d9d92cp-6f, 0x1.0ce164p-7f, 0x1.36b4cep-9f, -0x1.ba2daap-11f, -0x1.34d2bp-13f, 0x1.0ac232p-14f, 0x1.da3cccp-18f, -0x1.f7e114p-19f, -0x1.1d05c8p-22f, 0x1.845c8ap-23f, 0x1.098bdcp-27f, -0x1.fb3f66p-28f, -0x1.68b59ep-33f, 0x1.522a44p-32f, -0x1.1ae8ccp-35f,
+	0x1.ca5d16p-1f, 0x1.39f5d6p-3f, -0x1.46b696p-4f, 0x1.303b4p-7f, 0x1.be241ap-8f, -0x1.283514p-9f, -0x1.07938cp-12f, 0x1.ba292ap-13f, -0x1.9a931ep-18f, -0x1.a7a16ep-17f, 0x1.7f53c2p-20f, 0x1.230e68p-21f, -0x1.bff38ap-24f, -0x1.26a144p-26f, 0x1.64f3bap-28f, 0x1.a4d3e2p-32f, -0x1.07046ep-32f, 0x1.8c12b8p-36f,
+	0x1.f71132p-1f, 0x1.3239b6p-5f, -0x1.12d016p-5f, 0x1.eec95ap-7f, -0x1.454a8cp-9f, -0x1.8d2d88p-11f, 0x1.c6262cp-12f, -0x1.313e16p-15f, -0x1.9604dcp-16f, 0x1.acd91p-18f, 0x1.fd2f6p-22f, -0x1.adae9ep-22f, 0x1.94639cp-26f, 0x1.084824p-26f, -0x1.522a44p-29f, -0x1.a4d3e2p-32f, 0x1.3b9eeap-33f, -0x1.b0146ap-37f,
+	0x1.ff4c0ap-1f, 0x1.0b71aep-8f, -0x1.63a7a6p-8f, 0x1.111116p-8f, -0x1.fea202p-10f, 0x1.033bd6p-11f, -0x1.08a98ep-17f, -0x1.4bd18cp-15f, 0x1.8af214p-17f, -0x1.a85226p-23f, -0x1.6b165p-21f, 0x1.2aa8bcp-23f, 0x1.6fa06p-27f, -0x1.166bdap-27f, 0x1.70e84ap-31f, 0x1.0bcca8p-32f, -0x1.1eed8ep-34f, 0x1.681104p-38f,
+	0x1.fffa78p-1f, 0x1.660a5cp-13f, -0x1.4e7bd2p-12f, 0x1.7b964ap-12f, -0x1.208084p-12f, 0x1.2eca66p-13f, -0x1.aa5532p-15f, 0x1.5057e2p-17f, 0x1.01f422p-22f, -0x1.b35d94p-21f, 0x1.dd8a7p-23f, -0x1.46616cp-27f, -0x1.51bcf6p-27f, 0x1.58dd86p-29f, -0x1.b5393cp-36f, -0x1.cb15b2p-34f, 0x1.7e9214p-36f, -0x1.bb28a2p-40f,
+	0x1.fffff4p-1f, 0x1.0cfe9ep-19f, -0x1.61e5aep-18f, 0x1.20f6e2p-17f, -0x1.46b90ep-17f, 0x1.0da9d2p-17f, -0x1.4caa04p-18f, 0x1.32963ep-19f, -0x1.97d87ap-21f, 0x1.582eccp-23f, -0x1.142b0cp-27f, -0x1.0a9a9ap-27f, 0x1.8a86a4p-29f, -0x1.94a45ap-32f, -0x1.c60a34p-35f, 0x1.02f88cp-35f, -0x1.612462p-38f, 0x1.7bd9bp-42f,
+	0x1p+0f, 0x1.ae62a8p-29f, -0x1.ae4612p-27f, 0x1.0cc80ep-25f, -0x1.d5e108p-25f, 0x1.30c948p-24f, -0x1.2f8418p-24f, 0x1.d8f622p-25f, -0x1.229c52p-25f, 0x1.18a14cp-26f, -0x1.a111fep-28f, 0x1.c1853ep-30f, -0x1.1eed8ep-32f, -0x1.d6db2cp-38f, 0x1.2eb178p-36f, -0x1.5dc762p-38f, 0x1.93974ap-41f, -0x1.952c78p-45f,
+	0x1p+0f, 0x1.ae7f3ep-45f, -0x1.ae7f3ep-42f, 0x1.0d0f88p-39f, -0x1.d6db2cp-38f, 0x1.320e76p-36f, -0x1.320e76p-35f, 0x1.e0f228p-35f, -0x1.2c9758p-34f, 0x1.2c9758p-34f, -0x1.e0f228p-35f, 0x1.320e76p-35f, -0x1.320e76p-36f, 0x1.d6db2cp-38f, -0x1.0d0f88p-39f, 0x1.ae7f3ep-42f, -0x1.ae7f3ep-45f, 0x1.952c78p-49f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 18 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.682786p-53f,
+	0x1.682786p-53f, 0x1.952c78p-49f, 0x1.ae7f3ep-46f, 0x1.1eff7ep-43f, 0x1.0d0f88p-41f, 0x1.78af56p-40f, 0x1.981348p-39f, 0x1.5dc762p-38f, 0x1.e0f228p-38f, 0x1.0b3132p-37f, 0x1.e0f228p-38f, 0x1.5dc762p-38f, 0x1.981348p-39f, 0x1.78af56p-40f, 0x1.0d0f88p-41f, 0x1.1eff7ep-43f, 0x1.ae7f3ep-46f, 0x1.952c78p-49f, -0x1.7ea9fep-49f,
+	0x1.682132p-35f, 0x1.951e38p-32f, 0x1.ae60fap-30f, 0x1.1ed724p-28f, 0x1.0cc3dap-27f, 0x1.77db74p-27f, 0x1.964832p-27f, 0x1.5ab462p-27f, 0x1.d87de6p-28f, 0x1.01cc78p-28f, 0x1.bf212p-30f, 0x1.2c9758p-31f, 0x1.254ddcp-33f, 0x1.49996cp-36f, -0x1.0d0f88p-40f, -0x1.66bf5ep-40f, -0x1.78af56p-42f, -0x1.952c78p-45f, 0x1.7ea9fep-46f,
+	0x1.00bb56p-24f, 0x1.7eb952p-22f, 0x1.0c9306p-20f, 0x1.d6be1p-20f, 0x1.1fea1ap-19f, 0x1.03e8fp-19f, 0x1.646056p-20f, 0x1.76c484p-21f, 0x1.2b3266p-22f, 0x1.5a6268p-24f, 0x1.ee9104p-27f, 0x1.89805p-33f, -0x1.ae6456p-31f, -0x1.08db48p-32f, -0x1.c60a34p-36f, 0x1.42df6ep-38f, 0x1.2eb178p-39f, 0x1.7bd9bp-42f, -0x1.de547ep-44f,
+	0x1.43d10ap-17f, 0x1.5ed318p-15f, 0x1.61d662p-14f, 0x1.b69afap-14f, 0x1.728e94p-14f, 0x1.bd445ep-15f, 0x1.7d3fb8p-16f, 0x1.b7b6cap-18f, 0x1.03b252p-20f, -0x1.dd2cecp-24f, -0x1.a12106p-24f, -0x1.67db02p-26f, -0x1.3ecf1p-33f, 0x1.0c89p-30f, 0x1.c3f014p-33f, -0x1.f63f1ep-40f, -0x1.2648fcp-37f, -0x1.bb28a2p-40f, 0x1.a289eep-42f,
+	0x1.afdabep-12f, 0x1.5cdd52p-10f, 0x1.00415cp-9f, 0x1.be5536p-10f, 0x1.f2af64p-11f, 0x1.5ece4ep-12f, 0x1.e96df4p-15f, -0x1.9b9ea2p-18f, -0x1.9fe784p-18f, -0x1.57e5bcp-20f, 0x1.076da2p-24f, 0x1.5ee394p-24f, 0x1.a9691ap-27f, -0x1.b2120cp-30f, -0x1.a0ba8cp-31f, -0x1.981348p-35f, 0x1.7e9214p-36f, 0x1.681104p-38f, -0x1.100cdcp-40f,
+	0x1.b91edap-8f, 0x1.075aeap-6f, 0x1.10cb8p-6f, 0x1.33242ep-7f, 0x1.6640dp-9f, 0x1.bfd6aap-14f, -0x1.b59b94p-13f, -0x1.083d6ap-14f, 0x1.a93758p-22f, 0x1.0c37f4p-18f, 0x1.61afb4p-21f, -0x1.c138bap-24f, -0x1.8201fep-25f, -0x1.0f7a5ep-30f, 0x1.cd225cp-30f, 0x1.cb15b2p-33f, -0x1.585046p-35f, -0x1.b0146ap-37f, 0x1.100cdcp-39f,
+	0x1.a514a2p-5f, 0x1.65a0e4p-4f, 0x1.daced2p-5f, 0x1.f8d172p-7f, -0x1.7d1c34p-10f, -0x1.e7078p-10f, -0x1.068cecp-12f, 0x1.9a20fcp-14f, 0x1.033c58p-15f, -0x1.0daabcp-19f, -0x1.fe7192p-20f, -0x1.74689ap-24f, 0x1.5143dp-24f, 0x1.51e046p-27f, -0x1.3f60cep-29f, -0x1.188d42p-31f, 0x1.a4d3e2p-35f, 0x1.8c12b8p-36f, -0x1.ab81eap-39f,
+	0x1.ab4c44p-3f, 0x1.deb16p-3f, 0x1.36cfc8p-4f, -0x1.2e9e04p-7f, -0x1.38fb66p-7f, -0x1.252ef8p-12f, 0x1.949becp-11f, 0x1.62bb4ep-14f, -0x1.777decp-15f, -0x1.03edaep-17f, 0x1.084cbcp-19f, 0x1.f9d96cp-22f, -0x1.210b88p-24f, -0x1.78d2a8p-26f, 0x1.e875fp-30f, 0x1.cce81p-31f, -0x1.2c9758p-35f, -0x1.1ae8ccp-35f, 0x1.0b3132p-38f,
+	0x1p-1f, 0x1.4ac2fap-2f, 0x0p+0f, -0x1.1c4f1ap-5f, 0x0p+0f, 0x1.ae356cp-9f, 0x0p+0f, -0x1.f958c2p-13f, 0x0p+0f, 0x1.da3cccp-17f, 0x0p+0f, -0x1.6e7526p-21f, 0x0p+0f, 0x1.ddfbbep-26f, 0x0p+0f, -0x1.0e8836p-30f, 0x0p+0f, 0x1.3e45e6p-35f, -0x1.0b3132p-38f,
+	0x1.952cfp-1f, 0x1.deb16p-3f, -0x1.36cfc8p-4f, -0x1.2e9e04p-7f, 0x1.38fb66p-7f, -0x1.252ef8p-12f, -0x1.949becp-11f, 0x1.62bb4ep-14f, 0x1.777decp-15f, -0x1.03edaep-17f, -0x1.084cbcp-19f, 0x1.f9d96cp-22f, 0x1.210b88p-24f, -0x1.78d2a8p-26f, -0x1.e875fp-30f, 0x1.cce81p-31f, 0x1.2c9758p-35f, -0x1.1ae8ccp-35f, 0x1.ab81eap-39f,
+	0x1.e5aeb6p-1f, 0x1.65a0e4p-4f, -0x1.daced2p-5f, 0x1.f8d172p-7f, 0x1.7d1c34p-10f, -0x1.e7078p-10f, 0x1.068cecp-12f, 0x1.9a20fcp-14f, -0x1.033c58p-15f, -0x1.0daabcp-19f, 0x1.fe7192p-20f, -0x1.74689ap-24f, -0x1.5143dp-24f, 0x1.51e046p-27f, 0x1.3f60cep-29f, -0x1.188d42p-31f, -0x1.a4d3e2p-35f, 0x1.8c12b8p-36f, -0x1.100cdcp-39f,
+	0x1.fc8dc2p-1f, 0x1.075aeap-6f, -0x1.10cb8p-6f, 0x1.33242ep-7f, -0x1.6640dp-9f, 0x1.bfd6aap-14f, 0x1.b59b94p-13f, -0x1.083d6ap-14f, -0x1.a93758p-22f, 0x1.0c37f4p-18f, -0x1.61afb4p-21f, -0x1.c138bap-24f, 0x1.8201fep-25f, -0x1.0f7a5ep-30f, -0x1.cd225cp-30f, 0x1.cb15b2p-33f, 0x1.585046p-35f, -0x1.b0146ap-37f, 0x1.100cdcp-40f,
+	0x1.ffca04p-1f, 0x1.5cdd52p-10f, -0x1.00415cp-9f, 0x1.be5536p-10f, -0x1.f2af64p-11f, 0x1.5ece4ep-12f, -0x1.e96df4p-15f, -0x1.9b9ea2p-18f, 0x1.9fe784p-18f, -0x1.57e5bcp-20f, -0x1.076da2p-24f, 0x1.5ee394p-24f, -0x1.a9691ap-27f, -0x1.b2120cp-30f, 0x1.a0ba8cp-31f, -0x1.981348p-35f, -0x1.7e9214p-36f, 0x1.681104p-38f, -0x1.a289eep-42f,
+	0x1.fffebcp-1f, 0x1.5ed318p-15f, -0x1.61d662p-14f, 0x1.b69afap-14f, -0x1.728e94p-14f, 0x1.bd445ep-15f, -0x1.7d3fb8p-16f, 0x1.b7b6cap-18f, -0x1.03b252p-20f, -0x1.dd2cecp-24f, 0x1.a12106p-24f, -0x1.67db02p-26f, 0x1.3ecf1p-33f, 0x1.0c89p-30f, -0x1.c3f014p-33f, -0x1.f63f1ep-40f, 0x1.2648fcp-37f, -0x1.bb28a2p-40f, 0x1.de547ep-44f,
+	0x1.fffffep-1f, 0x1.7eb952p-22f, -0x1.0c9306p-20f, 0x1.d6be1p-20f, -0x1.1fea1ap-19f, 0x1.03e8fp-19f, -0x1.646056p-20f, 0x1.76c484p-21f, -0x1.2b3266p-22f, 0x1.5a6268p-24f, -0x1.ee9104p-27f, 0x1.89805p-33f, 0x1.ae6456p-31f, -0x1.08db48p-32f, 0x1.c60a34p-36f, 0x1.42df6ep-38f, -0x1.2eb178p-39f, 0x1.7bd9bp-42f, -0x1.7ea9fep-46f,
+	0x1p+0f, 0x1.951e38p-32f, -0x1.ae60fap-30f, 0x1.1ed724p-28f, -0x1.0cc3dap-27f, 0x1.77db74p-27f, -0x1.964832p-27f, 0x1.5ab462p-27f, -0x1.d87de6p-28f, 0x1.01cc78p-28f, -0x1.bf212p-30f, 0x1.2c9758p-31f, -0x1.254ddcp-33f, 0x1.49996cp-36f, 0x1.0d0f88p-40f, -0x1.66bf5ep-40f, 0x1.78af56p-42f, -0x1.952c78p-45f, 0x1.7ea9fep-49f,
+	0x1p+0f, 0x1.952c78p-49f, -0x1.ae7f3ep-46f, 0x1.1eff7ep-43f, -0x1.0d0f88p-41f, 0x1.78af56p-40f, -0x1.981348p-39f, 0x1.5dc762p-38f, -0x1.e0f228p-38f, 0x1.0b3132p-37f, -0x1.e0f228p-38f, 0x1.5dc762p-38f, -0x1.981348p-39f, 0x1.78af56p-40f, -0x1.0d0f88p-41f, 0x1.1eff7ep-43f, -0x1.ae7f3ep-46f, 0x1.952c78p-49f, -0x1.682786p-53f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 19 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.2f49b4p-57f,
+	0x1.2f49b4p-57f, 0x1.682786p-53f, 0x1.952c78p-50f, 0x1.1eff7ep-47f, 0x1.1eff7ep-45f, 0x1.ae7f3ep-44f, 0x1.f63f1ep-43f, 0x1.d25f2ep-42f, 0x1.5dc762p-41f, 0x1.ab81eap-41f, 0x1.ab81eap-41f, 0x1.5dc762p-41f, 0x1.d25f2ep-42f, 0x1.f63f1ep-43f, 0x1.ae7f3ep-44f, 0x1.1eff7ep-45f, 0x1.1eff7ep-47f, 0x1.952c78p-50f, 0x1.682786p-53f, -0x1.5532eap-53f,
+	0x1.2f46e4p-38f, 0x1.6820d8p-35f, 0x1.951d6ep-33f, 0x1.1eea32p-31f, 0x1.1ed4e6p-30f, 0x1.adff7p-30f, 0x1.f514e8p-30f, 0x1.d0355ep-30f, 0x1.5a88aap-30f, 0x1.a39342p-31f, 0x1.9ba498p-32f, 0x1.43d196p-33f, 0x1.8d250ep-35f, 0x1.612462p-37f, 0x1.5dc762p-40f, -0x1.ae7f3ep-44f, -0x1.8a9f4ep-44f, -0x1.7bd9bp-46f, -0x1.7ea9fep-49f, 0x1.6a861ap-50f,
+	0x1.457a38p-27f, 0x1.008e52p-24f, 0x1.7e540ap-23f, 0x1.6589e8p-22f, 0x1.d59f38p-22f, 0x1.cafbbcp-22f, 0x1.5896c6p-22f, 0x1.93a8ep-23f, 0x1.7159b2p-24f, 0x1.0363fp-25f, 0x1.0837b4p-27f, 0x1.3f095cp-30f, -0x1.0d9f06p-35f, -0x1.35faf4p-34f, -0x1.463c6ep-36f, -0x1.d25f2ep-40f, 0x1.9c8f46p-42f, 0x1.49342p-43f, 0x1.7ea9fep-46f, -0x1.e35d78p-48f,
+	0x1.17058p-19f, 0x1.41cf94p-17f, 0x1.5bd5a6p-16f, 0x1.d2301ep-16f, 0x1.af4002p-16f, 0x1.213f68p-16f, 0x1.1e03ep-17f, 0x1.9a41fp-19f, 0x1.88de3ap-21f, 0x1.48b4d6p-24f, -0x1.496c88p-26f, -0x1.5c53bep-27f, -0x1.e3e802p-30f, 0x1.af9e3ep-35f, 0x1.7e9214p-34f, 0x1.0f4d86p-36f, -0x1.c06f36p-42f, -0x1.5c3236p-41f, -0x1.de547ep-44f, 0x1.c527ap-46f,
+	0x1.e468acp-14f, 0x1.a5bc36p-12f, 0x1.51e6bap-11f, 0x1.46ee36p-11f, 0x1.a2eb86p-12f, 0x1.69e474p-13f, 0x1.8987aep-15f, 0x1.557dd4p-18f, -0x1.a9aab6p-20f, -0x1.ab6732p-21f, -0x1.f684bp-24f, 0x1.eef364p-27f, 0x1.25e6e4p-27f, 0x1.08db48p-30f, -0x1.917d2cp-33f, -0x1.1a838p-34f, -0x1.88615p-39f, 0x1.f28db6p-40f, 0x1.a289eep-42f, -0x1.3d3556p-44f,
+	0x1.3b899p-9f, 0x1.9e212ep-8f, 0x1.e31a2ap-8f, 0x1.41047p-8f, 0x1.f6b30cp-10f, 0x1.75bb24p-12f, -0x1.3e763p-15f, -0x1.3ffae6p-15f, -0x1.dd07p-18f, 0x1.8950dep-21f, 0x1.1b5ab6p-21f, 0x1.d28e8cp-25f, -0x1.0ab41ap-26f, -0x1.2efdb4p-28f, 0x1.73a3d8p-35f, 0x1.6510ep-33f, 0x1.188d42p-36f, -0x1.f817d2p-39f, -0x1.100cdcp-40f, 0x1.57a472p-43f,
+	0x1.7beba8p-6f, 0x1.6df0c6p-5f, 0x1.23ca2ap-5f, 0x1.c336c4p-7f, 0x1.8b5a88p-10f, -0x1.b70beep-11f, -0x1.57589cp-12f, -0x1.8ff818p-18f, 0x1.512f32p-16f, 0x1.c6f52cp-19f, -0x1.42710ep-21f, -0x1.f3d84ep-23f, 0x1.99ab5cp-30f, 0x1.4651bap-27f, 0x1.a8ed38p-31f, -0x1.254ddcp-32f, -0x1.8b52aep-35f, 0x1.681104p-38f, 0x1.100cdcp-39f, -0x1.268cf4p-42f,
+	0x1.e1b8b8p-4f, 0x1.42071ap-3f, 0x1.2be0eep-4f, 0x1.8781f8p-8f, -0x1.93b7bap-8f, -0x1.a88c9ap-10f, 0x1.13d282p-12f, 0x1.323838p-13f, -0x1.bb2d74p-20f, -0x1.1a19e6p-17f, -0x1.3404ccp-21f, 0x1.79d578p-22f, 0x1.8f4d0cp-25f, -0x1.816be8p-27f, -0x1.37dd06p-29f, 0x1.2c9758p-32f, 0x1.72baaap-34f, -0x1.537dc2p-38f, -0x1.ab81eap-39f, 0x1.9501dp-42f,
+	0x1.62f92p-2f, 0x1.2a59dep-2f, 0x1.6da928p-5f, -0x1.9e6a6p-6f, -0x1.a14f34p-8f, 0x1.f4c57p-10f, 0x1.373cdcp-11f, -0x1.ce690ep-14f, -0x1.555b34p-15f, 0x1.4dc544p-18f, 0x1.25aa96p-19f, -0x1.806f9cp-23f, -0x1.9cebe8p-24f, 0x1.63bf6ep-28f, 0x1.e875fp-29f, -0x1.04832ap-33f, -0x1.f4fc3ep-34f, 0x1.1ae8ccp-39f, 0x1.0b3132p-38f, -0x1.c20204p-42f,
+	0x1.4e837p-1f, 0x1.2a59dep-2f, -0x1.6da928p-5f, -0x1.9e6a6p-6f, 0x1.a14f34p-8f, 0x1.f4c57p-10f, -0x1.373cdcp-11f, -0x1.ce690ep-14f, 0x1.555b34p-15f, 0x1.4dc544p-18f, -0x1.25aa96p-19f, -0x1.806f9cp-23f, 0x1.9cebe8p-24f, 0x1.63bf6ep-28f, -0x1.e875fp-29f, -0x1.04832ap-33f, 0x1.f4fc3ep-34f, 0x1.1ae8ccp-39f, -0x1.0b3132p-38f, 0x1.9501dp-42f,
+	0x1.c3c8e8p-1f, 0x1.42071ap-3f, -0x1.2be0eep-4f, 0x1.8781f8p-8f, 0x1.93b7bap-8f, -0x1.a88c9ap-10f, -0x1.13d282p-12f, 0x1.323838p-13f, 0x1.bb2d74p-20f, -0x1.1a19e6p-17f, 0x1.3404ccp-21f, 0x1.79d578p-22f, -0x1.8f4d0cp-25f, -0x1.816be8p-27f, 0x1.37dd06p-29f, 0x1.2c9758p-32f, -0x1.72baaap-34f, -0x1.537dc2p-38f, 0x1.ab81eap-39f, -0x1.268cf4p-42f,
+	0x1.f420a2p-1f, 0x1.6df0c6p-5f, -0x1.23ca2ap-5f, 0x1.c336c4p-7f, -0x1.8b5a88p-10f, -0x1.b70beep-11f, 0x1.57589cp-12f, -0x1.8ff818p-18f, -0x1.512f32p-16f, 0x1.c6f52cp-19f, 0x1.42710ep-21f, -0x1.f3d84ep-23f, -0x1.99ab5cp-30f, 0x1.4651bap-27f, -0x1.a8ed38p-31f, -0x1.254ddcp-32f, 0x1.8b52aep-35f, 0x1.681104p-38f, -0x1.100cdcp-39f, 0x1.57a472p-43f,
+	0x1.fec476p-1f, 0x1.9e212ep-8f, -0x1.e31a2ap-8f, 0x1.41047p-8f, -0x1.f6b30cp-10f, 0x1.75bb24p-12f, 0x1.3e763p-15f, -0x1.3ffae6p-15f, 0x1.dd07p-18f, 0x1.8950dep-21f, -0x1.1b5ab6p-21f, 0x1.d28e8cp-25f, 0x1.0ab41ap-26f, -0x1.2efdb4p-28f, -0x1.73a3d8p-35f, 0x1.6510ep-33f, -0x1.188d42p-36f, -0x1.f817d2p-39f, 0x1.100cdcp-40f, -0x1.3d3556p-44f,
+	0x1.fff0dcp-1f, 0x1.a5bc36p-12f, -0x1.51e6bap-11f, 0x1.46ee36p-11f, -0x1.a2eb86p-12f, 0x1.69e474p-13f, -0x1.8987aep-15f, 0x1.557dd4p-18f, 0x1.a9aab6p-20f, -0x1.ab6732p-21f, 0x1.f684bp-24f, 0x1.eef364p-27f, -0x1.25e6e4p-27f, 0x1.08db48p-30f, 0x1.917d2cp-33f, -0x1.1a838p-34f, 0x1.88615p-39f, 0x1.f28db6p-40f, -0x1.a289eep-42f, 0x1.c527ap-46f,
+	0x1.ffffbap-1f, 0x1.41cf94p-17f, -0x1.5bd5a6p-16f, 0x1.d2301ep-16f, -0x1.af4002p-16f, 0x1.213f68p-16f, -0x1.1e03ep-17f, 0x1.9a41fp-19f, -0x1.88de3ap-21f, 0x1.48b4d6p-24f, 0x1.496c88p-26f, -0x1.5c53bep-27f, 0x1.e3e802p-30f, 0x1.af9e3ep-35f, -0x1.7e9214p-34f, 0x1.0f4d86p-36f, 0x1.c06f36p-42f, -0x1.5c3236p-41f, 0x1.de547ep-44f, -0x1.e35d78p-48f,
+	0x1p+0f, 0x1.008e52p-24f, -0x1.7e540ap-23f, 0x1.6589e8p-22f, -0x1.d59f38p-22f, 0x1.cafbbcp-22f, -0x1.5896c6p-22f, 0x1.93a8ep-23f, -0x1.7159b2p-24f, 0x1.0363fp-25f, -0x1.0837b4p-27f, 0x1.3f095cp-30f, 0x1.0d9f06p-35f, -0x1.35faf4p-34f, 0x1.463c6ep-36f, -0x1.d25f2ep-40f, -0x1.9c8f46p-42f, 0x1.49342p-43f, -0x1.7ea9fep-46f, 0x1.6a861ap-50f,
+	0x1p+0f, 0x1.6820d8p-35f, -0x1.951d6ep-33f, 0x1.1eea32p-31f, -0x1.1ed4e6p-30f, 0x1.adff7p-30f, -0x1.f514e8p-30f, 0x1.d0355ep-30f, -0x1.5a88aap-30f, 0x1.a39342p-31f, -0x1.9ba498p-32f, 0x1.43d196p-33f, -0x1.8d250ep-35f, 0x1.612462p-37f, -0x1.5dc762p-40f, -0x1.ae7f3ep-44f, 0x1.8a9f4ep-44f, -0x1.7bd9bp-46f, 0x1.7ea9fep-49f, -0x1.5532eap-53f,
+	0x1p+0f, 0x1.682786p-53f, -0x1.952c78p-50f, 0x1.1eff7ep-47f, -0x1.1eff7ep-45f, 0x1.ae7f3ep-44f, -0x1.f63f1ep-43f, 0x1.d25f2ep-42f, -0x1.5dc762p-41f, 0x1.ab81eap-41f, -0x1.ab81eap-41f, 0x1.5dc762p-41f, -0x1.d25f2ep-42f, 0x1.f63f1ep-43f, -0x1.ae7f3ep-44f, 0x1.1eff7ep-45f, -0x1.1eff7ep-47f, 0x1.952c78p-50f, -0x1.682786p-53f, 0x1.2f49b4p-57f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 20 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.e542bap-62f,
+	0x1.e542bap-62f, 0x1.2f49b4p-57f, 0x1.682786p-54f, 0x1.0e1da4p-51f, 0x1.1eff7ep-49f, 0x1.cb3264p-48f, 0x1.1eff7ep-46f, 0x1.1eff7ep-45f, 0x1.d25f2ep-45f, 0x1.36ea1ep-44f, 0x1.560188p-44f, 0x1.36ea1ep-44f, 0x1.d25f2ep-45f, 0x1.1eff7ep-45f, 0x1.1eff7ep-46f, 0x1.cb3264p-48f, 0x1.1eff7ep-49f, 0x1.0e1da4p-51f, 0x1.682786p-54f, 0x1.2f49b4p-57f, -0x1.201f9ep-57f,
+	0x1.e5405cp-42f, 0x1.2f46bep-38f, 0x1.68207ep-36f, 0x1.0e1318p-34f, 0x1.1ee914p-33f, 0x1.caeaa4p-33f, 0x1.1ea5dp-32f, 0x1.1e4c2p-32f, 0x1.d01838p-33f, 0x1.33e0d6p-33f, 0x1.4f538p-34f, 0x1.2ac4fap-35f, 0x1.adefbep-37f, 0x1.e44f26p-39f, 0x1.8a9f4ep-41f, 0x1.5865ccp-44f, -0x1.1eff7ep-47f, -0x1.952c78p-48f, -0x1.682786p-50f, -0x1.5532eap-53f, 0x1.442392p-54f,
+	0x1.879472p-30f, 0x1.45544ep-27f, 0x1.00614ep-25f, 0x1.fd3e5ap-25f, 0x1.64fa72p-24f, 0x1.76cd1cp-24f, 0x1.30de7ep-24f, 0x1.879438p-25f, 0x1.900876p-26f, 0x1.437f9cp-27f, 0x1.948904p-29f, 0x1.6d9afep-31f, 0x1.73698ep-34f, -0x1.9a5148p-38f, -0x1.94b64ap-38f, -0x1.734dcp-40f, -0x1.b7773ap-44f, 0x1.e124cep-46f, 0x1.4ed4bep-47f, 0x1.6a861ap-50f, -0x1.cb3264p-52f,
+	0x1.c6924p-22f, 0x1.15c006p-19f, 0x1.3fce76p-18f, 0x1.cbcbfcp-18f, 0x1.cc99f6p-18f, 0x1.532138p-18f, 0x1.7819f8p-19f, 0x1.3a9154p-20f, 0x1.810762p-22f, 0x1.342d5ap-24f, 0x1.3e6afep-28f, -0x1.4fa902p-29f, -0x1.02cdf2p-30f, -0x1.249a7cp-33f, 0x1.2c7378p-37f, 0x1.ef1254p-38f, 0x1.2c7378p-40f, -0x1.952c78p-45f, -0x1.7ea9fep-45f, -0x1.e35d78p-48f, 0x1.cb3264p-50f,
+	0x1.fe913p-16f, 0x1.dbb08p-14f, 0x1.9badbap-13f, 0x1.b40abap-13f, 0x1.385cb4p-13f, 0x1.3992d2p-14f, 0x1.b250b4p-16f, 0x1.7007aap-18f, 0x1.10b9b6p-22f, -0x1.147d42p-22f, -0x1.76cb0ap-24f, -0x1.319296p-27f, 0x1.1917b6p-29f, 0x1.b42c2cp-31f, 0x1.1f473ep-34f, -0x1.3c2572p-36f, -0x1.5e56e2p-38f, -0x1.3c8abcp-43f, 0x1.2af4cep-43f, 0x1.c527ap-46f, -0x1.5865ccp-48f,
+	0x1.a507d6p-11f, 0x1.2c664ap-9f, 0x1.83c56ap-9f, 0x1.25e8e2p-9f, 0x1.1826aap-10f, 0x1.3e6022p-12f, 0x1.010be2p-15f, -0x1.96da34p-17f, -0x1.6aaaap-18f, -0x1.496e82p-21f, 0x1.4849ap-23f, 0x1.f784ccp-25f, 0x1.c9179ap-29f, -0x1.fd1cfcp-30f, -0x1.a5f2e2p-32f, 0x1.07adfp-36f, 0x1.f252ap-37f, 0x1.36360cp-40f, -0x1.4ed4bep-42f, -0x1.3d3556p-44f, 0x1.91cc18p-47f,
+	0x1.3d381cp-7f, 0x1.547a76p-6f, 0x1.3a2cap-6f, 0x1.34893p-7f, 0x1.22b48ap-9f, -0x1.5781a6p-14f, -0x1.a14654p-13f, -0x1.5ae6acp-15f, 0x1.0dfbe2p-18f, 0x1.95b9bcp-19f, 0x1.1d4d9p-22f, -0x1.b89432p-24f, -0x1.9afd4cp-26f, 0x1.67c376p-30f, 0x1.11097ap-30f, 0x1.ac7aa6p-35f, -0x1.d7d64cp-36f, -0x1.f817d2p-39f, 0x1.100cdcp-41f, 0x1.57a472p-43f, -0x1.7518f2p-46f,
+	0x1.f35a78p-5f, 0x1.82bdcep-4f, 0x1.cd15d2p-5f, 0x1.9a9f96p-7f, -0x1.feeb9p-10f, -0x1.920b7ep-10f, -0x1.115e2ep-13f, 0x1.61cf7ep-14f, 0x1.3eb7f8p-16f, -0x1.445726p-19f, -0x1.3cac26p-20f, 0x1.4fa902p-29f, 0x1.a28114p-25f, 0x1.dbb0dap-29f, -0x1.96b582p-30f, -0x1.bdf7d2p-33f, 0x1.28f29ap-35f, 0x1.0b7a5ap-37f, -0x1.36ea1ep-41f, -0x1.268cf4p-42f, 0x1.17d2b6p-45f,
+	0x1.c3f302p-3f, 0x1.d515e2p-3f, 0x1.12aca2p-4f, -0x1.3820fp-7f, -0x1.00256ep-7f, -0x1.5bf27p-15f, 0x1.3470aep-11f, 0x1.8c2cd2p-15f, -0x1.0cb66p-15f, -0x1.231e08p-18f, 0x1.67306cp-20f, 0x1.0d9436p-22f, -0x1.7c08d8p-25f, -0x1.78f7a6p-27f, 0x1.41e212p-30f, 0x1.aad6eap-32f, -0x1.aed8eep-36f, -0x1.9a37f4p-37f, 0x1.ab81eap-42f, 0x1.9501dp-42f, -0x1.560188p-45f,
+	0x1p-1f, 0x1.3a0dc2p-2f, 0x0p+0f, -0x1.e78c34p-6f, 0x0p+0f, 0x1.4dd8f6p-9f, 0x0p+0f, -0x1.63b346p-13f, 0x0p+0f, 0x1.2f6d84p-17f, 0x0p+0f, -0x1.ab26aep-22f, 0x0p+0f, 0x1.fc360ap-27f, 0x0p+0f, -0x1.04832ap-31f, 0x0p+0f, 0x1.d783fep-37f, 0x0p+0f, -0x1.c20204p-42f, 0x1.560188p-45f,
+	0x1.8f034p-1f, 0x1.d515e2p-3f, -0x1.12aca2p-4f, -0x1.3820fp-7f, 0x1.00256ep-7f, -0x1.5bf27p-15f, -0x1.3470aep-11f, 0x1.8c2cd2p-15f, 0x1.0cb66p-15f, -0x1.231e08p-18f, -0x1.67306cp-20f, 0x1.0d9436p-22f, 0x1.7c08d8p-25f, -0x1.78f7a6p-27f, -0x1.41e212p-30f, 0x1.aad6eap-32f, 0x1.aed8eep-36f, -0x1.9a37f4p-37f, -0x1.ab81eap-42f, 0x1.9501dp-42f, -0x1.17d2b6p-45f,
+	0x1.e0ca58p-1f, 0x1.82bdcep-4f, -0x1.cd15d2p-5f, 0x1.9a9f96p-7f, 0x1.feeb9p-10f, -0x1.920b7ep-10f, 0x1.115e2ep-13f, 0x1.61cf7ep-14f, -0x1.3eb7f8p-16f, -0x1.445726p-19f, 0x1.3cac26p-20f, 0x1.4fa902p-29f, -0x1.a28114p-25f, 0x1.dbb0dap-29f, 0x1.96b582p-30f, -0x1.bdf7d2p-33f, -0x1.28f29ap-35f, 0x1.0b7a5ap-37f, 0x1.36ea1ep-41f, -0x1.268cf4p-42f, 0x1.7518f2p-46f,
+	0x1.fb0b2p-1f, 0x1.547a76p-6f, -0x1.3a2cap-6f, 0x1.34893p-7f, -0x1.22b48ap-9f, -0x1.5781a6p-14f, 0x1.a14654p-13f, -0x1.5ae6acp-15f, -0x1.0dfbe2p-18f, 0x1.95b9bcp-19f, -0x1.1d4d9p-22f, -0x1.b89432p-24f, 0x1.9afd4cp-26f, 0x1.67c376p-30f, -0x1.11097ap-30f, 0x1.ac7aa6p-35f, 0x1.d7d64cp-36f, -0x1.f817d2p-39f, -0x1.100cdcp-41f, 0x1.57a472p-43f, -0x1.91cc18p-47f,
+	0x1.ff96bep-1f, 0x1.2c664ap-9f, -0x1.83c56ap-9f, 0x1.25e8e2p-9f, -0x1.1826aap-10f, 0x1.3e6022p-12f, -0x1.010be2p-15f, -0x1.96da34p-17f, 0x1.6aaaap-18f, -0x1.496e82p-21f, -0x1.4849ap-23f, 0x1.f784ccp-25f, -0x1.c9179ap-29f, -0x1.fd1cfcp-30f, 0x1.a5f2e2p-32f, 0x1.07adfp-36f, -0x1.f252ap-37f, 0x1.36360cp-40f, 0x1.4ed4bep-42f, -0x1.3d3556p-44f, 0x1.5865ccp-48f,
+	0x1.fffc02p-1f, 0x1.dbb08p-14f, -0x1.9badbap-13f, 0x1.b40abap-13f, -0x1.385cb4p-13f, 0x1.3992d2p-14f, -0x1.b250b4p-16f, 0x1.7007aap-18f, -0x1.10b9b6p-22f, -0x1.147d42p-22f, 0x1.76cb0ap-24f, -0x1.319296p-27f, -0x1.1917b6p-29f, 0x1.b42c2cp-31f, -0x1.1f473ep-34f, -0x1.3c2572p-36f, 0x1.5e56e2p-38f, -0x1.3c8abcp-43f, -0x1.2af4cep-43f, 0x1.c527ap-46f, -0x1.cb3264p-50f,
+	0x1.fffff2p-1f, 0x1.15c006p-19f, -0x1.3fce76p-18f, 0x1.cbcbfcp-18f, -0x1.cc99f6p-18f, 0x1.532138p-18f, -0x1.7819f8p-19f, 0x1.3a9154p-20f, -0x1.810762p-22f, 0x1.342d5ap-24f, -0x1.3e6afep-28f, -0x1.4fa902p-29f, 0x1.02cdf2p-30f, -0x1.249a7cp-33f, -0x1.2c7378p-37f, 0x1.ef1254p-38f, -0x1.2c7378p-40f, -0x1.952c78p-45f, 0x1.7ea9fep-45f, -0x1.e35d78p-48f, 0x1.cb3264p-52f,
+	0x1p+0f, 0x1.45544ep-27f, -0x1.00614ep-25f, 0x1.fd3e5ap-25f, -0x1.64fa72p-24f, 0x1.76cd1cp-24f, -0x1.30de7ep-24f, 0x1.879438p-25f, -0x1.900876p-26f, 0x1.437f9cp-27f, -0x1.948904p-29f, 0x1.6d9afep-31f, -0x1.73698ep-34f, -0x1.9a5148p-38f, 0x1.94b64ap-38f, -0x1.734dcp-40f, 0x1.b7773ap-44f, 0x1.e124cep-46f, -0x1.4ed4bep-47f, 0x1.6a861ap-50f, -0x1.442392p-54f,
+	0x1p+0f, 0x1.2f46bep-38f, -0x1.68207ep-36f, 0x1.0e1318p-34f, -0x1.1ee914p-33f, 0x1.caeaa4p-33f, -0x1.1ea5dp-32f, 0x1.1e4c2p-32f, -0x1.d01838p-33f, 0x1.33e0d6p-33f, -0x1.4f538p-34f, 0x1.2ac4fap-35f, -0x1.adefbep-37f, 0x1.e44f26p-39f, -0x1.8a9f4ep-41f, 0x1.5865ccp-44f, 0x1.1eff7ep-47f, -0x1.952c78p-48f, 0x1.682786p-50f, -0x1.5532eap-53f, 0x1.201f9ep-57f,
+	0x1p+0f, 0x1.2f49b4p-57f, -0x1.682786p-54f, 0x1.0e1da4p-51f, -0x1.1eff7ep-49f, 0x1.cb3264p-48f, -0x1.1eff7ep-46f, 0x1.1eff7ep-45f, -0x1.d25f2ep-45f, 0x1.36ea1ep-44f, -0x1.560188p-44f, 0x1.36ea1ep-44f, -0x1.d25f2ep-45f, 0x1.1eff7ep-45f, -0x1.1eff7ep-46f, 0x1.cb3264p-48f, -0x1.1eff7ep-49f, 0x1.0e1da4p-51f, -0x1.682786p-54f, 0x1.2f49b4p-57f, -0x1.e542bap-62f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 21 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.71b8fp-66f,
+	0x1.71b8fp-66f, 0x1.e542bap-62f, 0x1.2f49b4p-58f, 0x1.e034b2p-56f, 0x1.0e1da4p-53f, 0x1.cb3264p-52f, 0x1.322198p-50f, 0x1.47ff6cp-49f, 0x1.1eff7ep-48f, 0x1.9e8d7ep-48f, 0x1.f17698p-48f, 0x1.f17698p-48f, 0x1.9e8d7ep-48f, 0x1.1eff7ep-48f, 0x1.47ff6cp-49f, 0x1.322198p-50f, 0x1.cb3264p-52f, 0x1.0e1da4p-53f, 0x1.e034b2p-56f, 0x1.2f49b4p-58f, 0x1.e542bap-62f, -0x1.ce272cp-62f,
+	0x1.71b7fcp-45f, 0x1.e5403ep-42f, 0x1.2f4698p-39f, 0x1.e02adap-38f, 0x1.0e129p-36f, 0x1.cb0cbap-36f, 0x1.31ef5ep-35f, 0x1.4793ccp-35f, 0x1.1e4328p-35f, 0x1.9c6d64p-36f, 0x1.ec5ccp-37f, 0x1.e742eap-38f, 0x1.8d8cbp-39f, 0x1.07748ap-40f, 0x1.122f84p-42f, 0x1.9b5d24p-45f, 0x1.3bb2a6p-48f, -0x1.51a50ep-51f, -0x1.862ad2p-52f, -0x1.423e5p-54f, -0x1.201f9ep-57f, 0x1.126742p-58f,
+	0x1.c0550cp-33f, 0x1.87761ep-30f, 0x1.452e66p-28f, 0x1.559b0cp-27f, 0x1.fcb75p-27f, 0x1.1d2266p-26f, 0x1.f28a34p-27f, 0x1.5b2464p-27f, 0x1.8557ap-28f, 0x1.605cbp-29f, 0x1.fde68ep-31f, 0x1.1e961ep-32f, 0x1.ce9392p-35f, 0x1.86fa9p-38f, -0x1.74d758p-41f, -0x1.e44f26p-42f, -0x1.88d41cp-44f, -0x1.7bd9bp-48f, 0x1.02dc68p-49f, 0x1.3fdfbcp-51f, 0x1.442392p-54f, -0x1.9b9ae2p-56f,
+	0x1.5f4b06p-24f, 0x1.c50aacp-22f, 0x1.147abp-20f, 0x1.a7bcfp-20f, 0x1.c7d18p-20f, 0x1.6c04d6p-20f, 0x1.bc5d5ap-21f, 0x1.a2f128p-22f, 0x1.2e54b2p-23f, 0x1.400618p-25f, 0x1.ac623cp-28f, 0x1.51e45p-33f, -0x1.1cb52ap-32f, -0x1.5b1948p-34f, -0x1.3fbffp-37f, 0x1.0c29eep-40f, 0x1.25f2e2p-41f, 0x1.34a0dep-44f, -0x1.1eff7ep-48f, -0x1.88bbf2p-49f, -0x1.cb3264p-52f, 0x1.b5549p-54f,
+	0x1.fbe692p-18f, 0x1.f776e6p-16f, 0x1.d3028p-15f, 0x1.0bca2ep-14f, 0x1.a5ac5ap-15f, 0x1.dcbfd4p-16f, 0x1.85d654p-17f, 0x1.baa1aap-19f, 0x1.216356p-21f, -0x1.8f4d0cp-27f, -0x1.1ad3acp-25f, -0x1.1f0ce4p-27f, -0x1.278b1cp-31f, 0x1.f93974p-33f, 0x1.230abep-34f, 0x1.0a5ebcp-38f, -0x1.b7ea08p-40f, -0x1.906cf2p-42f, -0x1.7ea9fep-48f, 0x1.4c5042p-47f, 0x1.cb3264p-50f, -0x1.5ddd4p-52f,
+	0x1.0761dp-12f, 0x1.95134cp-11f, 0x1.1d88c6p-10f, 0x1.e2b8cp-11f, 0x1.0aa836p-11f, 0x1.81c4ecp-13f, 0x1.3ff9e8p-15f, 0x1.6cb296p-21f, -0x1.276f06p-19f, -0x1.51858ap-21f, -0x1.31e634p-25f, 0x1.770b04p-26f, 0x1.829bap-28f, 0x1.b13acep-34f, -0x1.9f8ae6p-33f, -0x1.0757d6p-35f, 0x1.21e9bp-39f, 0x1.3cf008p-40f, 0x1.36ea1ep-44f, -0x1.97d6dcp-46f, -0x1.5865ccp-48f, 0x1.b5549p-51f,
+	0x1.ed2174p-9f, 0x1.22e7ap-7f, 0x1.2eedacp-7f, 0x1.624544p-8f, 0x1.d61dfp-10f, 0x1.e203ep-13f, -0x1.0d805cp-14f, -0x1.1329e4p-15f, -0x1.ea603cp-19f, 0x1.192d8ep-20f, 0x1.86777cp-22f, 0x1.60768ep-27f, -0x1.cd8f1p-27f, -0x1.2013d8p-29f, 0x1.f0804p-33f, 0x1.93c258p-34f, 0x1.28a3aep-39f, -0x1.534b1cp-39f, -0x1.24fa26p-42f, 0x1.72139p-45f, 0x1.91cc18p-47f, -0x1.b5549p-50f,
+	0x1.dea58ap-6f, 0x1.a40c72p-5f, 0x1.2d9f32p-5f, 0x1.9554aep-7f, 0x1.98599ap-11f, -0x1.b4eea8p-11f, -0x1.fb6f3p-13f, 0x1.48ee0ep-17f, 0x1.07a16ap-16f, 0x1.be9e3ap-20f, -0x1.2406cp-21f, -0x1.1a2e36p-23f, 0x1.2cb652p-27f, 0x1.7fffd6p-28f, 0x1.521148p-33f, -0x1.6a87fep-33f, -0x1.148b3ep-36f, 0x1.f5856ap-39f, 0x1.5dc762p-41f, -0x1.eaeaeep-45f, -0x1.7518f2p-46f, 0x1.6354b6p-49f,
+	0x1.09075cp-3f, 0x1.471c64p-3f, 0x1.13b6fap-4f, 0x1.d6bd08p-9f, -0x1.696044p-8f, -0x1.33a662p-10f, 0x1.04c7f2p-12f, 0x1.ae9bbp-14f, -0x1.37722ap-18f, -0x1.7c8218p-18f, -0x1.9ca176p-23f, 0x1.eb8926p-23f, 0x1.63f13p-26f, -0x1.eb6892p-28f, -0x1.1b5da2p-30f, 0x1.84951ap-33f, 0x1.44e96ap-35f, -0x1.e23b5cp-39f, -0x1.2d32cep-40f, 0x1.b9d37p-45f, 0x1.17d2b6p-45f, -0x1.d9c648p-49f,
+	0x1.6a2d5cp-2f, 0x1.1e068p-2f, 0x1.3e0b42p-5f, -0x1.6e3b82p-6f, -0x1.4b7bbcp-8f, 0x1.99d57ep-10f, 0x1.c461p-12f, -0x1.6080c8p-14f, -0x1.c6be7ap-16f, 0x1.ddb5fep-19f, 0x1.67306cp-20f, -0x1.053a7ep-23f, -0x1.d07c98p-25f, 0x1.d3bc1ep-29f, 0x1.f9d0f6p-30f, -0x1.57578ap-34f, -0x1.d9eeap-35f, 0x1.9580ep-40f, 0x1.87e1c2p-40f, -0x1.68019ep-46f, -0x1.560188p-45f, 0x1.049374p-48f,
+	0x1.4ae952p-1f, 0x1.1e068p-2f, -0x1.3e0b42p-5f, -0x1.6e3b82p-6f, 0x1.4b7bbcp-8f, 0x1.99d57ep-10f, -0x1.c461p-12f, -0x1.6080c8p-14f, 0x1.c6be7ap-16f, 0x1.ddb5fep-19f, -0x1.67306cp-20f, -0x1.053a7ep-23f, 0x1.d07c98p-25f, 0x1.d3bc1ep-29f, -0x1.f9d0f6p-30f, -0x1.57578ap-34f, 0x1.d9eeap-35f, 0x1.9580ep-40f, -0x1.87e1c2p-40f, -0x1.68019ep-46f, 0x1.560188p-45f, -0x1.d9c648p-49f,
+	0x1.bdbe2ap-1f, 0x1.471c64p-3f, -0x1.13b6fap-4f, 0x1.d6bd08p-9f, 0x1.696044p-8f, -0x1.33a662p-10f, -0x1.04c7f2p-12f, 0x1.ae9bbp-14f, 0x1.37722ap-18f, -0x1.7c8218p-18f, 0x1.9ca176p-23f, 0x1.eb8926p-23f, -0x1.63f13p-26f, -0x1.eb6892p-28f, 0x1.1b5da2p-30f, 0x1.84951ap-33f, -0x1.44e96ap-35f, -0x1.e23b5cp-39f, 0x1.2d32cep-40f, 0x1.b9d37p-45f, -0x1.17d2b6p-45f, 0x1.6354b6p-49f,
+	0x1.f10ad4p-1f, 0x1.a40c72p-5f, -0x1.2d9f32p-5f, 0x1.9554aep-7f, -0x1.98599ap-11f, -0x1.b4eea8p-11f, 0x1.fb6f3p-13f, 0x1.48ee0ep-17f, -0x1.07a16ap-16f, 0x1.be9e3ap-20f, 0x1.2406cp-21f, -0x1.1a2e36p-23f, -0x1.2cb652p-27f, 0x1.7fffd6p-28f, -0x1.521148p-33f, -0x1.6a87fep-33f, 0x1.148b3ep-36f, 0x1.f5856ap-39f, -0x1.5dc762p-41f, -0x1.eaeaeep-45f, 0x1.7518f2p-46f, -0x1.b5549p-50f,
+	0x1.fe12dep-1f, 0x1.22e7ap-7f, -0x1.2eedacp-7f, 0x1.624544p-8f, -0x1.d61dfp-10f, 0x1.e203ep-13f, 0x1.0d805cp-14f, -0x1.1329e4p-15f, 0x1.ea603cp-19f, 0x1.192d8ep-20f, -0x1.86777cp-22f, 0x1.60768ep-27f, 0x1.cd8f1p-27f, -0x1.2013d8p-29f, -0x1.f0804p-33f, 0x1.93c258p-34f, -0x1.28a3aep-39f, -0x1.534b1cp-39f, 0x1.24fa26p-42f, 0x1.72139p-45f, -0x1.91cc18p-47f, 0x1.b5549p-51f,
+	0x1.ffdf14p-1f, 0x1.95134cp-11f, -0x1.1d88c6p-10f, 0x1.e2b8cp-11f, -0x1.0aa836p-11f, 0x1.81c4ecp-13f, -0x1.3ff9e8p-15f, 0x1.6cb296p-21f, 0x1.276f06p-19f, -0x1.51858ap-21f, 0x1.31e634p-25f, 0x1.770b04p-26f, -0x1.829bap-28f, 0x1.b13acep-34f, 0x1.9f8ae6p-33f, -0x1.0757d6p-35f, -0x1.21e9bp-39f, 0x1.3cf008p-40f, -0x1.36ea1ep-44f, -0x1.97d6dcp-46f, 0x1.5865ccp-48f, -0x1.5ddd4p-52f,
+	0x1.ffff02p-1f, 0x1.f776e6p-16f, -0x1.d3028p-15f, 0x1.0bca2ep-14f, -0x1.a5ac5ap-15f, 0x1.dcbfd4p-16f, -0x1.85d654p-17f, 0x1.baa1aap-19f, -0x1.216356p-21f, -0x1.8f4d0cp-27f, 0x1.1ad3acp-25f, -0x1.1f0ce4p-27f, 0x1.278b1cp-31f, 0x1.f93974p-33f, -0x1.230abep-34f, 0x1.0a5ebcp-38f, 0x1.b7ea08p-40f, -0x1.906cf2p-42f, 0x1.7ea9fep-48f, 0x1.4c5042p-47f, -0x1.cb3264p-50f, 0x1.b5549p-54f,
+	0x1.fffffep-1f, 0x1.c50aacp-22f, -0x1.147abp-20f, 0x1.a7bcfp-20f, -0x1.c7d18p-20f, 0x1.6c04d6p-20f, -0x1.bc5d5ap-21f, 0x1.a2f128p-22f, -0x1.2e54b2p-23f, 0x1.400618p-25f, -0x1.ac623cp-28f, 0x1.51e45p-33f, 0x1.1cb52ap-32f, -0x1.5b1948p-34f, 0x1.3fbffp-37f, 0x1.0c29eep-40f, -0x1.25f2e2p-41f, 0x1.34a0dep-44f, 0x1.1eff7ep-48f, -0x1.88bbf2p-49f, 0x1.cb3264p-52f, -0x1.9b9ae2p-56f,
+	0x1p+0f, 0x1.87761ep-30f, -0x1.452e66p-28f, 0x1.559b0cp-27f, -0x1.fcb75p-27f, 0x1.1d2266p-26f, -0x1.f28a34p-27f, 0x1.5b2464p-27f, -0x1.8557ap-28f, 0x1.605cbp-29f, -0x1.fde68ep-31f, 0x1.1e961ep-32f, -0x1.ce9392p-35f, 0x1.86fa9p-38f, 0x1.74d758p-41f, -0x1.e44f26p-42f, 0x1.88d41cp-44f, -0x1.7bd9bp-48f, -0x1.02dc68p-49f, 0x1.3fdfbcp-51f, -0x1.442392p-54f, 0x1.126742p-58f,
+	0x1p+0f, 0x1.e5403ep-42f, -0x1.2f4698p-39f, 0x1.e02adap-38f, -0x1.0e129p-36f, 0x1.cb0cbap-36f, -0x1.31ef5ep-35f, 0x1.4793ccp-35f, -0x1.1e4328p-35f, 0x1.9c6d64p-36f, -0x1.ec5ccp-37f, 0x1.e742eap-38f, -0x1.8d8cbp-39f, 0x1.07748ap-40f, -0x1.122f84p-42f, 0x1.9b5d24p-45f, -0x1.3bb2a6p-48f, -0x1.51a50ep-51f, 0x1.862ad2p-52f, -0x1.423e5p-54f, 0x1.201f9ep-57f, -0x1.ce272cp-62f,
+	0x1p+0f, 0x1.e542bap-62f, -0x1.2f49b4p-58f, 0x1.e034b2p-56f, -0x1.0e1da4p-53f, 0x1.cb3264p-52f, -0x1.322198p-50f, 0x1.47ff6cp-49f, -0x1.1eff7ep-48f, 0x1.9e8d7ep-48f, -0x1.f17698p-48f, 0x1.f17698p-48f, -0x1.9e8d7ep-48f, 0x1.1eff7ep-48f, -0x1.47ff6cp-49f, 0x1.322198p-50f, -0x1.cb3264p-52f, 0x1.0e1da4p-53f, -0x1.e034b2p-56f, 0x1.2f49b4p-58f, -0x1.e542bap-62f, 0x1.71b8fp-66f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 22 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.0ce396p-70f,
+	0x1.0ce396p-70f, 0x1.71b8fp-66f, 0x1.e542bap-63f, 0x1.946246p-60f, 0x1.e034b2p-58f, 0x1.b02f6ep-56f, 0x1.322198p-54f, 0x1.5ddd4p-53f, 0x1.47ff6cp-52f, 0x1.fe37fep-52f, 0x1.4ba466p-51f, 0x1.69ca9cp-51f, 0x1.4ba466p-51f, 0x1.fe37fep-52f, 0x1.47ff6cp-52f, 0x1.5ddd4p-53f, 0x1.322198p-54f, 0x1.b02f6ep-56f, 0x1.e034b2p-58f, 0x1.946246p-60f, 0x1.e542bap-63f, 0x1.71b8fp-66f, -0x1.60eab6p-66f,
+	0x1.0ce33ap-48f, 0x1.71b7f2p-45f, 0x1.e5402p-43f, 0x1.945deep-41f, 0x1.e02a62p-40f, 0x1.b01cdcp-39f, 0x1.32074ap-38f, 0x1.5da11ep-38f, 0x1.478eacp-38f, 0x1.fcd938p-39f, 0x1.49dc64p-39f, 0x1.65e7bp-40f, 0x1.44845ep-41f, 0x1.e84b96p-43f, 0x1.2bcf7ap-44f, 0x1.21bb3ap-46f, 0x1.91cc18p-49f, 0x1.0e1da4p-52f, -0x1.682786p-55f, -0x1.61d5fep-56f, -0x1.10f588p-58f, -0x1.ce272cp-62f, 0x1.b92564p-63f,
+	0x1.e9b69cp-36f, 0x1.c03dfp-33f, 0x1.8757cap-31f, 0x1.b160a6p-30f, 0x1.555f08p-29f, 0x1.968d06p-29f, 0x1.7b94d8p-29f, 0x1.1c327p-29f, 0x1.59dcdp-30f, 0x1.581818p-31f, 0x1.174fdep-32f, 0x1.6d3de4p-34f, 0x1.73f6c2p-36f, 0x1.0d5f4p-38f, 0x1.738f58p-42f, -0x1.0ff6fep-44f, -0x1.0bdd66p-45f, -0x1.844a9cp-48f, -0x1.2c20fp-52f, 0x1.030ef4p-53f, 0x1.201f9ep-55f, 0x1.126742p-58f, -0x1.5d3d9ap-60f,
+	0x1.025a04p-26f, 0x1.5e6adcp-24f, 0x1.c38336p-23f, 0x1.6ef204p-22f, 0x1.a511bap-22f, 0x1.6979a8p-22f, 0x1.df6b12p-23f, 0x1.f2f15cp-24f, 0x1.981806p-25f, 0x1.01ec68p-26f, 0x1.dccd48p-29f, 0x1.09327cp-31f, -0x1.39b53ap-37f, -0x1.a59338p-36f, -0x1.a89c82p-38f, -0x1.3c35d8p-41f, 0x1.853db8p-44f, 0x1.42df6ep-45f, 0x1.27706cp-48f, -0x1.5ead38p-52f, -0x1.7a298p-53f, -0x1.9b9ae2p-56f, 0x1.88e54cp-58f,
+	0x1.deb198p-20f, 0x1.f66966p-18f, 0x1.f062bcp-17f, 0x1.319472p-16f, 0x1.052b3ap-16f, 0x1.45f172p-17f, 0x1.2eaa5ap-18f, 0x1.9dc9b4p-20f, 0x1.864384p-22f, 0x1.7c192cp-25f, -0x1.4fe116p-28f, -0x1.e945cp-29f, -0x1.85c5f2p-31f, -0x1.7914fcp-36f, 0x1.83deeap-36f, 0x1.6113fap-38f, 0x1.8ea88p-43f, -0x1.142edp-43f, -0x1.a88496p-46f, -0x1.423e5p-54f, 0x1.5865ccp-51f, 0x1.b5549p-54f, -0x1.4df61ap-56f,
+	0x1.36698ep-14f, 0x1.fee46cp-13f, 0x1.855794p-12f, 0x1.6940eep-12f, 0x1.c13f7ap-13f, 0x1.807be8p-14f, 0x1.b2e698p-16f, 0x1.fc9c2ap-19f, -0x1.5f7504p-22f, -0x1.46ea8ap-22f, -0x1.0906aap-24f, -0x1.0c7a7cp-32f, 0x1.59b64ep-29f, 0x1.04a58cp-31f, -0x1.49d6ecp-37f, -0x1.2b3bep-36f, -0x1.28a3aep-39f, 0x1.dfe0aap-43f, 0x1.72b4aep-44f, 0x1.19f686p-48f, -0x1.cb3264p-50f, -0x1.5ddd4p-52f, 0x1.bd4824p-55f,
+	0x1.66b482p-10f, 0x1.cc353ap-9f, 0x1.09966ap-8f, 0x1.6450c4p-9f, 0x1.25ee2cp-10f, 0x1.0d6e44p-12f, 0x1.00a7ep-17f, -0x1.ead85cp-17f, -0x1.18dcaep-18f, -0x1.5a9062p-23f, 0x1.67f376p-23f, 0x1.37c8eap-25f, -0x1.0914fcp-30f, -0x1.92fe14p-30f, -0x1.58b436p-33f, 0x1.e66c58p-36f, 0x1.0bb722p-37f, 0x1.952c78p-49f, -0x1.ba748ep-43f, -0x1.382c5ep-46f, 0x1.cb3264p-49f, 0x1.b5549p-51f, -0x1.dd167p-54f,
+	0x1.aa8f2ap-7f, 0x1.a1015ap-6f, 0x1.5b528ap-6f, 0x1.2d2fb4p-7f, 0x1.c86416p-10f, -0x1.a981dp-13f, -0x1.739fcp-13f, -0x1.a9ec94p-16f, 0x1.656566p-18f, 0x1.20d31p-19f, 0x1.08b444p-24f, -0x1.625ee8p-24f, -0x1.959cd4p-27f, 0x1.d517p-30f, 0x1.2dbc6ep-31f, -0x1.51fdcep-38f, -0x1.1a3494p-36f, -0x1.272ce4p-40f, 0x1.75b202p-42f, 0x1.a1e8dp-45f, -0x1.5865ccp-48f, -0x1.b5549p-50f, 0x1.a173a2p-53f,
+	0x1.1f8d04p-4f, 0x1.9a6554p-4f, 0x1.bc328ep-5f, 0x1.4d13bp-7f, -0x1.1fa56ap-9f, -0x1.49ef92p-10f, -0x1.dba59ap-15f, 0x1.25ffbcp-14f, 0x1.857deep-17f, -0x1.2f8c68p-19f, -0x1.89baecp-21f, 0x1.12b7d6p-25f, 0x1.01e7cap-25f, 0x1.fa0ed6p-31f, -0x1.f43ba8p-31f, -0x1.5b551ep-34f, 0x1.778e8cp-36f, 0x1.b3f008p-39f, -0x1.b5393cp-42f, -0x1.90ea86p-44f, 0x1.7518f2p-48f, 0x1.6354b6p-49f, -0x1.2d7e2ep-52f,
+	0x1.d9d028p-3f, 0x1.cb535cp-3f, 0x1.e9e134p-5f, -0x1.372e44p-7f, -0x1.a91324p-8f, 0x1.7ea056p-14f, 0x1.de5294p-12f, 0x1.b5f02p-16f, -0x1.878e3cp-16f, -0x1.4f01b8p-19f, 0x1.ef7dacp-21f, 0x1.2abd88p-23f, -0x1.f5d7c2p-26f, -0x1.8b5bcep-28f, 0x1.9e718p-31f, 0x1.a4e5a8p-33f, -0x1.18207p-36f, -0x1.77ed32p-38f, 0x1.306fe8p-42f, 0x1.23d2c4p-43f, -0x1.f17698p-49f, -0x1.d9c648p-49f, 0x1.69ca9cp-52f,
+	0x1p-1f, 0x1.2ba548p-2f, 0x0p+0f, -0x1.a80f04p-6f, 0x0p+0f, 0x1.092fcap-9f, 0x0p+0f, -0x1.028092p-13f, 0x0p+0f, 0x1.943788p-18f, 0x0p+0f, -0x1.053a7ep-22f, 0x0p+0f, 0x1.1dd684p-27f, 0x0p+0f, -0x1.0dc4c8p-32f, 0x0p+0f, 0x1.be0dc4p-38f, 0x0p+0f, -0x1.4a017ap-43f, 0x0p+0f, 0x1.049374p-48f, -0x1.69ca9cp-52f,
+	0x1.898bf6p-1f, 0x1.cb535cp-3f, -0x1.e9e134p-5f, -0x1.372e44p-7f, 0x1.a91324p-8f, 0x1.7ea056p-14f, -0x1.de5294p-12f, 0x1.b5f02p-16f, 0x1.878e3cp-16f, -0x1.4f01b8p-19f, -0x1.ef7dacp-21f, 0x1.2abd88p-23f, 0x1.f5d7c2p-26f, -0x1.8b5bcep-28f, -0x1.9e718p-31f, 0x1.a4e5a8p-33f, 0x1.18207p-36f, -0x1.77ed32p-38f, -0x1.306fe8p-42f, 0x1.23d2c4p-43f, 0x1.f17698p-49f, -0x1.d9c648p-49f, 0x1.2d7e2ep-52f,
+	0x1.dc0e6p-1f, 0x1.9a6554p-4f, -0x1.bc328ep-5f, 0x1.4d13bp-7f, 0x1.1fa56ap-9f, -0x1.49ef92p-10f, 0x1.dba59ap-15f, 0x1.25ffbcp-14f, -0x1.857deep-17f, -0x1.2f8c68p-19f, 0x1.89baecp-21f, 0x1.12b7d6p-25f, -0x1.01e7cap-25f, 0x1.fa0ed6p-31f, 0x1.f43ba8p-31f, -0x1.5b551ep-34f, -0x1.778e8cp-36f, 0x1.b3f008p-39f, 0x1.b5393cp-42f, -0x1.90ea86p-44f, -0x1.7518f2p-48f, 0x1.6354b6p-49f, -0x1.a173a2p-53f,
+	0x1.f955c4p-1f, 0x1.a1015ap-6f, -0x1.5b528ap-6f, 0x1.2d2fb4p-7f, -0x1.c86416p-10f, -0x1.a981dp-13f, 0x1.739fcp-13f, -0x1.a9ec94p-16f, -0x1.656566p-18f, 0x1.20d31p-19f, -0x1.08b444p-24f, -0x1.625ee8p-24f, 0x1.959cd4p-27f, 0x1.d517p-30f, -0x1.2dbc6ep-31f, -0x1.51fdcep-38f, 0x1.1a3494p-36f, -0x1.272ce4p-40f, -0x1.75b202p-42f, 0x1.a1e8dp-45f, 0x1.5865ccp-48f, -0x1.b5549p-50f, 0x1.dd167p-54f,
+	0x1.ff4ca6p-1f, 0x1.cc353ap-9f, -0x1.09966ap-8f, 0x1.6450c4p-9f, -0x1.25ee2cp-10f, 0x1.0d6e44p-12f, -0x1.00a7ep-17f, -0x1.ead85cp-17f, 0x1.18dcaep-18f, -0x1.5a9062p-23f, -0x1.67f376p-23f, 0x1.37c8eap-25f, 0x1.0914fcp-30f, -0x1.92fe14p-30f, 0x1.58b436p-33f, 0x1.e66c58p-36f, -0x1.0bb722p-37f, 0x1.952c78p-49f, 0x1.ba748ep-43f, -0x1.382c5ep-46f, -0x1.cb3264p-49f, 0x1.b5549p-51f, -0x1.bd4824p-55f,
+	0x1.fff64cp-1f, 0x1.fee46cp-13f, -0x1.855794p-12f, 0x1.6940eep-12f, -0x1.c13f7ap-13f, 0x1.807be8p-14f, -0x1.b2e698p-16f, 0x1.fc9c2ap-19f, 0x1.5f7504p-22f, -0x1.46ea8ap-22f, 0x1.0906aap-24f, -0x1.0c7a7cp-32f, -0x1.59b64ep-29f, 0x1.04a58cp-31f, 0x1.49d6ecp-37f, -0x1.2b3bep-36f, 0x1.28a3aep-39f, 0x1.dfe0aap-43f, -0x1.72b4aep-44f, 0x1.19f686p-48f, 0x1.cb3264p-50f, -0x1.5ddd4p-52f, 0x1.4df61ap-56f,
+	0x1.ffffc4p-1f, 0x1.f66966p-18f, -0x1.f062bcp-17f, 0x1.319472p-16f, -0x1.052b3ap-16f, 0x1.45f172p-17f, -0x1.2eaa5ap-18f, 0x1.9dc9b4p-20f, -0x1.864384p-22f, 0x1.7c192cp-25f, 0x1.4fe116p-28f, -0x1.e945cp-29f, 0x1.85c5f2p-31f, -0x1.7914fcp-36f, -0x1.83deeap-36f, 0x1.6113fap-38f, -0x1.8ea88p-43f, -0x1.142edp-43f, 0x1.a88496p-46f, -0x1.423e5p-54f, -0x1.5865ccp-51f, 0x1.b5549p-54f, -0x1.88e54cp-58f,
+	0x1p+0f, 0x1.5e6adcp-24f, -0x1.c38336p-23f, 0x1.6ef204p-22f, -0x1.a511bap-22f, 0x1.6979a8p-22f, -0x1.df6b12p-23f, 0x1.f2f15cp-24f, -0x1.981806p-25f, 0x1.01ec68p-26f, -0x1.dccd48p-29f, 0x1.09327cp-31f, 0x1.39b53ap-37f, -0x1.a59338p-36f, 0x1.a89c82p-38f, -0x1.3c35d8p-41f, -0x1.853db8p-44f, 0x1.42df6ep-45f, -0x1.27706cp-48f, -0x1.5ead38p-52f, 0x1.7a298p-53f, -0x1.9b9ae2p-56f, 0x1.5d3d9ap-60f,
+	0x1p+0f, 0x1.c03dfp-33f, -0x1.8757cap-31f, 0x1.b160a6p-30f, -0x1.555f08p-29f, 0x1.968d06p-29f, -0x1.7b94d8p-29f, 0x1.1c327p-29f, -0x1.59dcdp-30f, 0x1.581818p-31f, -0x1.174fdep-32f, 0x1.6d3de4p-34f, -0x1.73f6c2p-36f, 0x1.0d5f4p-38f, -0x1.738f58p-42f, -0x1.0ff6fep-44f, 0x1.0bdd66p-45f, -0x1.844a9cp-48f, 0x1.2c20fp-52f, 0x1.030ef4p-53f, -0x1.201f9ep-55f, 0x1.126742p-58f, -0x1.b92564p-63f,
+	0x1p+0f, 0x1.71b7f2p-45f, -0x1.e5402p-43f, 0x1.945deep-41f, -0x1.e02a62p-40f, 0x1.b01cdcp-39f, -0x1.32074ap-38f, 0x1.5da11ep-38f, -0x1.478eacp-38f, 0x1.fcd938p-39f, -0x1.49dc64p-39f, 0x1.65e7bp-40f, -0x1.44845ep-41f, 0x1.e84b96p-43f, -0x1.2bcf7ap-44f, 0x1.21bb3ap-46f, -0x1.91cc18p-49f, 0x1.0e1da4p-52f, 0x1.682786p-55f, -0x1.61d5fep-56f, 0x1.10f588p-58f, -0x1.ce272cp-62f, 0x1.60eab6p-66f,
+	0x1p+0f, 0x1.71b8fp-66f, -0x1.e542bap-63f, 0x1.946246p-60f, -0x1.e034b2p-58f, 0x1.b02f6ep-56f, -0x1.322198p-54f, 0x1.5ddd4p-53f, -0x1.47ff6cp-52f, 0x1.fe37fep-52f, -0x1.4ba466p-51f, 0x1.69ca9cp-51f, -0x1.4ba466p-51f, 0x1.fe37fep-52f, -0x1.47ff6cp-52f, 0x1.5ddd4p-53f, -0x1.322198p-54f, 0x1.b02f6ep-56f, -0x1.e034b2p-58f, 0x1.946246p-60f, -0x1.e542bap-63f, 0x1.71b8fp-66f, -0x1.0ce396p-70f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 23 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.761b42p-75f,
+	0x1.761b42p-75f, 0x1.0ce396p-70f, 0x1.71b8fp-67f, 0x1.4381d2p-64f, 0x1.946246p-62f, 0x1.802a28p-60f, 0x1.201f9ep-58f, 0x1.5ddd4p-57f, 0x1.5ddd4p-56f, 0x1.238db6p-55f, 0x1.982cccp-55f, 0x1.e2637cp-55f, 0x1.e2637cp-55f, 0x1.982cccp-55f, 0x1.238db6p-55f, 0x1.5ddd4p-56f, 0x1.5ddd4p-57f, 0x1.201f9ep-58f, 0x1.802a28p-60f, 0x1.946246p-62f, 0x1.4381d2p-64f, 0x1.71b8fp-67f, 0x1.0ce396p-70f, -0x1.0132bcp-70f,
+	0x1.761afep-52f, 0x1.0ce336p-48f, 0x1.71b7e6p-46f, 0x1.438p-44f, 0x1.945dbcp-43f, 0x1.802188p-42f, 0x1.2012aep-41f, 0x1.5dbdd2p-41f, 0x1.5d9e62p-41f, 0x1.2324eep-41f, 0x1.97076cp-42f, 0x1.dfae0cp-43f, 0x1.dcf89ep-44f, 0x1.8f01cap-45f, 0x1.1674d8p-46f, 0x1.3e6e6p-48f, 0x1.1eff7ep-50f, 0x1.712884p-53f, 0x1.b02f6ep-57f, -0x1.61d5fep-59f, -0x1.2f49b4p-60f, -0x1.b70b9cp-63f, -0x1.60eab6p-66f, 0x1.519298p-67f,
+	0x1.ff763ep-39f, 0x1.e9a5cep-36f, 0x1.c026d4p-34f, 0x1.04d0fap-32f, 0x1.b12e1ap-32f, 0x1.10e8cep-31f, 0x1.0ec0aap-31f, 0x1.b11fcep-32f, 0x1.1b83ap-32f, 0x1.324bc8p-33f, 0x1.11af64p-34f, 0x1.928606p-36f, 0x1.df885ep-38f, 0x1.bd51fep-40f, 0x1.226a28p-42f, 0x1.3c6194p-46f, -0x1.5865ccp-48f, -0x1.13be42p-49f, -0x1.682786p-52f, -0x1.ada86ap-57f, 0x1.e542bap-58f, 0x1.eb099ep-60f, 0x1.b92564p-63f, -0x1.194f7ep-64f,
+	0x1.6a9b32p-29f, 0x1.01df96p-26f, 0x1.5d8abcp-25f, 0x1.2bfd3ep-24f, 0x1.6d40a2p-24f, 0x1.4eb8cap-24f, 0x1.ddbb68p-25f, 0x1.0e906cp-25f, 0x1.ea0fcap-27f, 0x1.61248ep-28f, 0x1.8b790cp-30f, 0x1.415f7ep-32f, 0x1.24b9p-35f, -0x1.456d26p-39f, -0x1.1761bcp-39f, -0x1.ddb07ep-42f, -0x1.1a36f8p-45f, 0x1.ec660ap-48f, 0x1.4a243cp-49f, 0x1.08964cp-52f, -0x1.802a28p-56f, -0x1.570112p-57f, -0x1.5d3d9ap-60f, 0x1.4e0e66p-62f,
+	0x1.ace466p-22f, 0x1.daa83p-20f, 0x1.f0efbap-19f, 0x1.463874p-18f, 0x1.2bd8a8p-18f, 0x1.9757ecp-19f, 0x1.a38786p-20f, 0x1.48c802p-21f, 0x1.7e9a9ep-23f, 0x1.2d8eaep-25f, 0x1.91d18ep-29f, -0x1.a1a886p-31f, -0x1.726196p-32f, -0x1.d9b024p-35f, 0x1.96cb4ap-43f, 0x1.077abp-39f, 0x1.889ab6p-42f, 0x1.801226p-48f, -0x1.3d3edp-47f, -0x1.a3afbep-50f, 0x1.b02f6ep-57f, 0x1.4e6dd8p-55f, 0x1.88e54cp-58f, -0x1.2ca69p-60f,
+	0x1.5a05a6p-16f, 0x1.2eeec6p-14f, 0x1.ef3122p-14f, 0x1.f270aap-14f, 0x1.5627a8p-14f, 0x1.4d480ep-15f, 0x1.ca524cp-17f, 0x1.9a8db8p-19f, 0x1.2db75p-22f, -0x1.49a75ap-24f, -0x1.2b8af2p-25f, -0x1.62f53cp-28f, 0x1.2fcef6p-32f, 0x1.10b608p-32f, 0x1.37596p-35f, -0x1.26d256p-39f, -0x1.8380dep-40f, -0x1.2ea3f6p-43f, 0x1.5006ep-46f, 0x1.918ba6p-48f, 0x1.cb3264p-53f, -0x1.e11038p-54f, -0x1.4df61ap-56f, 0x1.a9ebf6p-59f,
+	0x1.eaab52p-12f, 0x1.534deap-10f, 0x1.ac46f4p-10f, 0x1.41abecp-10f, 0x1.3728a6p-11f, 0x1.7c7062p-13f, 0x1.ce28c4p-16f, -0x1.5e5e76p-19f, -0x1.34ffb4p-19f, -0x1.cc426cp-22f, 0x1.eba11ap-27f, 0x1.6627dap-26f, 0x1.a2828p-29f, -0x1.264f42p-32f, -0x1.30c07cp-33f, -0x1.59b1e4p-37f, 0x1.88d41cp-39f, 0x1.41c3dp-41f, -0x1.a4ee32p-47f, -0x1.08571ep-46f, -0x1.322198p-50f, 0x1.0665fp-52f, 0x1.bd4824p-55f, -0x1.e6c486p-58f,
+	0x1.6338aep-8f, 0x1.7db89ap-7f, 0x1.677ab4p-7f, 0x1.76914p-8f, 0x1.a83704p-10f, 0x1.03efdap-13f, -0x1.4174c8p-14f, -0x1.bb0bb4p-16f, -0x1.6900cap-20f, 0x1.1bab98p-20f, 0x1.f0c68ap-23f, -0x1.4b0d92p-27f, -0x1.542ce8p-27f, -0x1.ca6f06p-31f, 0x1.f2553p-33f, 0x1.9dc5dap-35f, -0x1.1d75e6p-39f, -0x1.8796bap-40f, -0x1.0714ep-44f, 0x1.f4fcep-46f, 0x1.cb3264p-49f, -0x1.b5549p-52f, -0x1.dd167p-54f, 0x1.c8583ep-57f,
+	0x1.21f374p-5f, 0x1.d4763ep-5f, 0x1.3224fep-5f, 0x1.68b70cp-7f, 0x1.fe3fdcp-13f, -0x1.9cac5ep-11f, -0x1.70ff2p-13f, 0x1.20d066p-16f, 0x1.907aep-17f, 0x1.76bea2p-21f, -0x1.d9e5fap-22f, -0x1.3669c8p-24f, 0x1.47d1e2p-27f, 0x1.ba39d6p-29f, -0x1.edda7ap-35f, -0x1.abb784p-34f, -0x1.46354p-38f, 0x1.3589p-39f, 0x1.035836p-42f, -0x1.557086p-45f, -0x1.e7e58cp-48f, 0x1.1154dap-51f, 0x1.a173a2p-53f, -0x1.62ef4cp-56f,
+	0x1.1f4524p-3f, 0x1.4a09a6p-3f, 0x1.fc4166p-5f, 0x1.e746eap-10f, -0x1.4220fap-8f, -0x1.c200bp-11f, 0x1.d7cccap-13f, 0x1.334d4ep-14f, -0x1.710768p-18f, -0x1.049416p-18f, -0x1.92aa6ap-26f, 0x1.435a66p-23f, 0x1.32bf6ep-27f, -0x1.391fccp-28f, -0x1.0610f2p-31f, 0x1.e7d3d2p-34f, 0x1.29481ap-36f, -0x1.348e94p-39f, -0x1.07f418p-41f, 0x1.384738p-45f, 0x1.89d338p-47f, -0x1.d9c648p-52f, -0x1.2d7e2ep-52f, 0x1.cd6a4ap-56f,
+	0x1.707916p-2f, 0x1.1317ecp-2f, 0x1.17ee68p-5f, -0x1.469624p-6f, -0x1.0c77ep-8f, 0x1.540f5p-10f, 0x1.51a3b4p-12f, -0x1.1153c2p-14f, -0x1.393e96p-16f, 0x1.5c0ca6p-19f, 0x1.c9605p-21f, -0x1.685b66p-24f, -0x1.11bb82p-25f, 0x1.34d38cp-29f, 0x1.144bacp-30f, -0x1.ba12acp-35f, -0x1.e0379cp-36f, 0x1.07a60ep-40f, 0x1.6d5318p-41f, -0x1.005e3ep-46f, -0x1.f17698p-47f, 0x1.7b0506p-53f, 0x1.69ca9cp-52f, -0x1.f75caep-56f,
+	0x1.47c376p-1f, 0x1.1317ecp-2f, -0x1.17ee68p-5f, -0x1.469624p-6f, 0x1.0c77ep-8f, 0x1.540f5p-10f, -0x1.51a3b4p-12f, -0x1.1153c2p-14f, 0x1.393e96p-16f, 0x1.5c0ca6p-19f, -0x1.c9605p-21f, -0x1.685b66p-24f, 0x1.11bb82p-25f, 0x1.34d38cp-29f, -0x1.144bacp-30f, -0x1.ba12acp-35f, 0x1.e0379cp-36f, 0x1.07a60ep-40f, -0x1.6d5318p-41f, -0x1.005e3ep-46f, 0x1.f17698p-47f, 0x1.7b0506p-53f, -0x1.69ca9cp-52f, 0x1.cd6a4ap-56f,
+	0x1.b82eb8p-1f, 0x1.4a09a6p-3f, -0x1.fc4166p-5f, 0x1.e746eap-10f, 0x1.4220fap-8f, -0x1.c200bp-11f, -0x1.d7cccap-13f, 0x1.334d4ep-14f, 0x1.710768p-18f, -0x1.049416p-18f, 0x1.92aa6ap-26f, 0x1.435a66p-23f, -0x1.32bf6ep-27f, -0x1.391fccp-28f, 0x1.0610f2p-31f, 0x1.e7d3d2p-34f, -0x1.29481ap-36f, -0x1.348e94p-39f, 0x1.07f418p-41f, 0x1.384738p-45f, -0x1.89d338p-47f, -0x1.d9c648p-52f, 0x1.2d7e2ep-52f, -0x1.62ef4cp-56f,
+	0x1.ede0c8p-1f, 0x1.d4763ep-5f, -0x1.3224fep-5f, 0x1.68b70cp-7f, -0x1.fe3fdcp-13f, -0x1.9cac5ep-11f, 0x1.70ff2p-13f, 0x1.20d066p-16f, -0x1.907aep-17f, 0x1.76bea2p-21f, 0x1.d9e5fap-22f, -0x1.3669c8p-24f, -0x1.47d1e2p-27f, 0x1.ba39d6p-29f, 0x1.edda7ap-35f, -0x1.abb784p-34f, 0x1.46354p-38f, 0x1.3589p-39f, -0x1.035836p-42f, -0x1.557086p-45f, 0x1.e7e58cp-48f, 0x1.1154dap-51f, -0x1.a173a2p-53f, 0x1.c8583ep-57f,
+	0x1.fd398ep-1f, 0x1.7db89ap-7f, -0x1.677ab4p-7f, 0x1.76914p-8f, -0x1.a83704p-10f, 0x1.03efdap-13f, 0x1.4174c8p-14f, -0x1.bb0bb4p-16f, 0x1.6900cap-20f, 0x1.1bab98p-20f, -0x1.f0c68ap-23f, -0x1.4b0d92p-27f, 0x1.542ce8p-27f, -0x1.ca6f06p-31f, -0x1.f2553p-33f, 0x1.9dc5dap-35f, 0x1.1d75e6p-39f, -0x1.8796bap-40f, 0x1.0714ep-44f, 0x1.f4fcep-46f, -0x1.cb3264p-49f, -0x1.b5549p-52f, 0x1.dd167p-54f, -0x1.e6c486p-58f,
+	0x1.ffc2aap-1f, 0x1.534deap-10f, -0x1.ac46f4p-10f, 0x1.41abecp-10f, -0x1.3728a6p-11f, 0x1.7c7062p-13f, -0x1.ce28c4p-16f, -0x1.5e5e76p-19f, 0x1.34ffb4p-19f, -0x1.cc426cp-22f, -0x1.eba11ap-27f, 0x1.6627dap-26f, -0x1.a2828p-29f, -0x1.264f42p-32f, 0x1.30c07cp-33f, -0x1.59b1e4p-37f, -0x1.88d41cp-39f, 0x1.41c3dp-41f, 0x1.a4ee32p-47f, -0x1.08571ep-46f, 0x1.322198p-50f, 0x1.0665fp-52f, -0x1.bd4824p-55f, 0x1.a9ebf6p-59f,
+	0x1.fffd4cp-1f, 0x1.2eeec6p-14f, -0x1.ef3122p-14f, 0x1.f270aap-14f, -0x1.5627a8p-14f, 0x1.4d480ep-15f, -0x1.ca524cp-17f, 0x1.9a8db8p-19f, -0x1.2db75p-22f, -0x1.49a75ap-24f, 0x1.2b8af2p-25f, -0x1.62f53cp-28f, -0x1.2fcef6p-32f, 0x1.10b608p-32f, -0x1.37596p-35f, -0x1.26d256p-39f, 0x1.8380dep-40f, -0x1.2ea3f6p-43f, -0x1.5006ep-46f, 0x1.918ba6p-48f, -0x1.cb3264p-53f, -0x1.e11038p-54f, 0x1.4df61ap-56f, -0x1.2ca69p-60f,
+	0x1.fffff2p-1f, 0x1.daa83p-20f, -0x1.f0efbap-19f, 0x1.463874p-18f, -0x1.2bd8a8p-18f, 0x1.9757ecp-19f, -0x1.a38786p-20f, 0x1.48c802p-21f, -0x1.7e9a9ep-23f, 0x1.2d8eaep-25f, -0x1.91d18ep-29f, -0x1.a1a886p-31f, 0x1.726196p-32f, -0x1.d9b024p-35f, -0x1.96cb4ap-43f, 0x1.077abp-39f, -0x1.889ab6p-42f, 0x1.801226p-48f, 0x1.3d3edp-47f, -0x1.a3afbep-50f, -0x1.b02f6ep-57f, 0x1.4e6dd8p-55f, -0x1.88e54cp-58f, 0x1.4e0e66p-62f,
+	0x1p+0f, 0x1.01df96p-26f, -0x1.5d8abcp-25f, 0x1.2bfd3ep-24f, -0x1.6d40a2p-24f, 0x1.4eb8cap-24f, -0x1.ddbb68p-25f, 0x1.0e906cp-25f, -0x1.ea0fcap-27f, 0x1.61248ep-28f, -0x1.8b790cp-30f, 0x1.415f7ep-32f, -0x1.24b9p-35f, -0x1.456d26p-39f, 0x1.1761bcp-39f, -0x1.ddb07ep-42f, 0x1.1a36f8p-45f, 0x1.ec660ap-48f, -0x1.4a243cp-49f, 0x1.08964cp-52f, 0x1.802a28p-56f, -0x1.570112p-57f, 0x1.5d3d9ap-60f, -0x1.194f7ep-64f,
+	0x1p+0f, 0x1.e9a5cep-36f, -0x1.c026d4p-34f, 0x1.04d0fap-32f, -0x1.b12e1ap-32f, 0x1.10e8cep-31f, -0x1.0ec0aap-31f, 0x1.b11fcep-32f, -0x1.1b83ap-32f, 0x1.324bc8p-33f, -0x1.11af64p-34f, 0x1.928606p-36f, -0x1.df885ep-38f, 0x1.bd51fep-40f, -0x1.226a28p-42f, 0x1.3c6194p-46f, 0x1.5865ccp-48f, -0x1.13be42p-49f, 0x1.682786p-52f, -0x1.ada86ap-57f, -0x1.e542bap-58f, 0x1.eb099ep-60f, -0x1.b92564p-63f, 0x1.519298p-67f,
+	0x1p+0f, 0x1.0ce336p-48f, -0x1.71b7e6p-46f, 0x1.438p-44f, -0x1.945dbcp-43f, 0x1.802188p-42f, -0x1.2012aep-41f, 0x1.5dbdd2p-41f, -0x1.5d9e62p-41f, 0x1.2324eep-41f, -0x1.97076cp-42f, 0x1.dfae0cp-43f, -0x1.dcf89ep-44f, 0x1.8f01cap-45f, -0x1.1674d8p-46f, 0x1.3e6e6p-48f, -0x1.1eff7ep-50f, 0x1.712884p-53f, -0x1.b02f6ep-57f, -0x1.61d5fep-59f, 0x1.2f49b4p-60f, -0x1.b70b9cp-63f, 0x1.60eab6p-66f, -0x1.0132bcp-70f,
+	0x1p+0f, 0x1.0ce396p-70f, -0x1.71b8fp-67f, 0x1.4381d2p-64f, -0x1.946246p-62f, 0x1.802a28p-60f, -0x1.201f9ep-58f, 0x1.5ddd4p-57f, -0x1.5ddd4p-56f, 0x1.238db6p-55f, -0x1.982cccp-55f, 0x1.e2637cp-55f, -0x1.e2637cp-55f, 0x1.982cccp-55f, -0x1.238db6p-55f, 0x1.5ddd4p-56f, -0x1.5ddd4p-57f, 0x1.201f9ep-58f, -0x1.802a28p-60f, 0x1.946246p-62f, -0x1.4381d2p-64f, 0x1.71b8fp-67f, -0x1.0ce396p-70f, 0x1.761b42p-75f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 24 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.f2cf02p-80f,
+	0x1.f2cf02p-80f, 0x1.761b42p-75f, 0x1.0ce396p-71f, 0x1.ecf694p-69f, 0x1.4381d2p-66f, 0x1.4381d2p-64f, 0x1.001c1cp-62f, 0x1.4948b6p-61f, 0x1.5ddd4p-60f, 0x1.36fd8ep-59f, 0x1.d27c56p-59f, 0x1.28dac2p-58f, 0x1.4197a8p-58f, 0x1.28dac2p-58f, 0x1.d27c56p-59f, 0x1.36fd8ep-59f, 0x1.5ddd4p-60f, 0x1.4948b6p-61f, 0x1.001c1cp-62f, 0x1.4381d2p-64f, 0x1.4381d2p-66f, 0x1.ecf694p-69f, 0x1.0ce396p-71f, 0x1.761b42p-75f, -0x1.6684cap-75f,
+	0x1.f2ced2p-56f, 0x1.761afcp-52f, 0x1.0ce332p-49f, 0x1.ecf522p-48f, 0x1.437fecp-46f, 0x1.437e06p-45f, 0x1.00161ap-44f, 0x1.493946p-44f, 0x1.5dbc74p-44f, 0x1.36c34p-44f, 0x1.d1cd68p-45f, 0x1.27fc1ep-45f, 0x1.3fb544p-46f, 0x1.256032p-47f, 0x1.c78d6cp-49f, 0x1.2869acp-50f, 0x1.3d1082p-52f, 0x1.0b8b14p-54f, 0x1.402322p-57f, 0x1.4381d2p-61f, -0x1.4381d2p-63f, -0x1.ecf694p-65f, -0x1.501c7cp-67f, -0x1.0132bcp-70f, 0x1.ecf694p-72f,
+	0x1.ffc814p-42f, 0x1.ff6a8cp-39f, 0x1.e995p-37f, 0x1.2ab526p-35f, 0x1.04bcc2p-34f, 0x1.5a62d8p-34f, 0x1.6ba10ep-34f, 0x1.351c2ap-34f, 0x1.b070fp-35f, 0x1.f6cfacp-36f, 0x1.e84106p-37f, 0x1.8bc65ap-38f, 0x1.09d9c8p-39f, 0x1.2282c2p-41f, 0x1.eeafeep-44f, 0x1.23363ep-46f, 0x1.d98bf8p-51f, -0x1.87aafcp-52f, -0x1.099d26p-53f, -0x1.3aa944p-56f, -0x1.10f588p-61f, 0x1.ab7dd4p-62f, 0x1.8d080cp-64f, 0x1.519298p-67f, -0x1.af57c2p-69f,
+	0x1.e6ce08p-32f, 0x1.6a1b56p-29f, 0x1.01652cp-27f, 0x1.d0e38cp-27f, 0x1.2af86ep-26f, 0x1.22d92ap-26f, 0x1.bb73f6p-27f, 0x1.0e9282p-27f, 0x1.0b2e2ep-28f, 0x1.abbc28p-30f, 0x1.12db58p-31f, 0x1.132d28p-33f, 0x1.8af426p-36f, 0x1.1e7ffp-39f, -0x1.39313ap-42f, -0x1.50baaap-43f, -0x1.f17698p-46f, -0x1.c23168p-50f, 0x1.181ebep-51f, 0x1.3becc6p-53f, 0x1.bcd28p-57f, -0x1.8120a4p-60f, -0x1.2618eep-61f, -0x1.194f7ep-64f, 0x1.0d96dap-66f,
+	0x1.6e6182p-24f, 0x1.aa0f3p-22f, 0x1.d6a0b2p-21f, 0x1.47a66p-20f, 0x1.41888p-20f, 0x1.d69f7p-21f, 0x1.0896c4p-21f, 0x1.ce667ap-23f, 0x1.37defap-24f, 0x1.38dde6p-26f, 0x1.9bdcfap-29f, 0x1.28d8c6p-33f, -0x1.81902ep-34f, -0x1.f4e356p-36f, -0x1.030e78p-38f, 0x1.452078p-43f, 0x1.4330cp-43f, 0x1.92b632p-46f, -0x1.812a44p-54f, -0x1.50a85p-51f, -0x1.84aaa8p-54f, 0x1.c956c2p-60f, 0x1.3195e6p-59f, 0x1.4e0e66p-62f, -0x1.001c1cp-64f,
+	0x1.6e205ap-18f, 0x1.535214p-16f, 0x1.278426p-15f, 0x1.3fc66ep-15f, 0x1.de0d22p-16f, 0x1.02bb4ap-16f, 0x1.9a6e14p-18f, 0x1.cfdcfcp-20f, 0x1.485bb8p-22f, 0x1.88955ap-27f, -0x1.80588ep-27f, -0x1.d83a4p-29f, -0x1.93aae4p-32f, 0x1.9ee2ccp-35f, 0x1.7b56e8p-36f, 0x1.4a6928p-39f, -0x1.172682p-42f, -0x1.c9162ap-44f, -0x1.17aeb2p-47f, 0x1.a08c08p-50f, 0x1.952c78p-52f, 0x1.4948b6p-57f, -0x1.d7799p-58f, -0x1.2ca69p-60f, 0x1.802a28p-63f,
+	0x1.3cdc7p-13f, 0x1.d50af8p-12f, 0x1.405efcp-11f, 0x1.08e296p-11f, 0x1.2284e2p-12f, 0x1.ad6c5p-14f, 0x1.8c287ep-16f, 0x1.0a48b4p-19f, -0x1.7c7618p-21f, -0x1.34308cp-22f, -0x1.2e46dep-25f, 0x1.333c86p-28f, 0x1.29ee1cp-29f, 0x1.d45964p-33f, -0x1.440306p-35f, -0x1.98185ap-37f, -0x1.0ffd5p-41f, 0x1.1409acp-42f, 0x1.614444p-45f, -0x1.cc343p-50f, -0x1.23c806p-50f, -0x1.14f9d4p-54f, 0x1.164d16p-56f, 0x1.a9ebf6p-59f, -0x1.d27c56p-62f,
+	0x1.15b41p-9f, 0x1.448df8p-8f, 0x1.534edep-8f, 0x1.97ed1cp-9f, 0x1.262644p-10f, 0x1.add11ap-13f, -0x1.4156cp-17f, -0x1.f36c8ap-17f, -0x1.8f3fe6p-19f, 0x1.c8e118p-24f, 0x1.3efcf4p-23f, 0x1.52f1ccp-26f, -0x1.5d1f18p-29f, -0x1.11b99p-30f, -0x1.63bf4ep-35f, 0x1.ac4fd4p-36f, 0x1.f43252p-39f, -0x1.3f31e2p-42f, -0x1.eb15e4p-44f, -0x1.6277bep-49f, 0x1.322198p-49f, 0x1.d27c56p-53f, -0x1.fce4bcp-56f, -0x1.e6c486p-58f, 0x1.d27c56p-61f,
+	0x1.10f772p-6f, 0x1.eb18bcp-6f, 0x1.750818p-6f, 0x1.205dcp-7f, 0x1.5adcdap-10f, -0x1.2058d4p-12f, -0x1.3e7038p-13f, -0x1.dc0ad2p-17f, 0x1.6dee0ep-18f, 0x1.8c17fap-20f, -0x1.342746p-25f, -0x1.06a646p-24f, -0x1.66b574p-28f, 0x1.9b12f2p-30f, 0x1.3e30eap-32f, -0x1.4b9fe6p-36f, -0x1.3d4d38p-37f, -0x1.595ebp-43f, 0x1.c12e8cp-43f, 0x1.11c7fp-46f, -0x1.d98bf8p-49f, -0x1.1154dap-51f, 0x1.65d0d4p-55f, 0x1.c8583ep-57f, -0x1.84bcf2p-60f,
+	0x1.43f5f4p-4f, 0x1.ad908ep-4f, 0x1.a9d82cp-5f, 0x1.0d7b36p-7f, -0x1.2bce3p-9f, -0x1.0e7594p-10f, -0x1.8e2e1ap-17f, 0x1.e07486p-15f, 0x1.d63268p-18f, -0x1.03ff5ep-19f, -0x1.ebdfdep-22f, 0x1.4659bp-25f, 0x1.3f0a32p-26f, -0x1.9ef522p-35f, -0x1.314744p-31f, -0x1.ed3a3ap-36f, 0x1.c9c5aap-37f, 0x1.648cap-40f, -0x1.12b526p-42f, -0x1.4b796ep-45f, 0x1.057cb2p-48f, 0x1.e5ec3p-51f, -0x1.731174p-55f, -0x1.62ef4cp-56f, 0x1.101ddcp-59f,
+	0x1.ed5f1cp-3f, 0x1.c1ad08p-3f, 0x1.b84c64p-5f, -0x1.306ea8p-7f, -0x1.650a92p-8f, 0x1.576d74p-13f, 0x1.78b51ap-12f, 0x1.d11846p-17f, -0x1.225088p-16f, -0x1.88ddcp-20f, 0x1.5baebcp-21f, 0x1.55c9ecp-24f, -0x1.4fb01p-26f, -0x1.af491p-29f, 0x1.0b2a0ap-31f, 0x1.b27be2p-34f, -0x1.626e94p-37f, -0x1.6de1cp-39f, 0x1.877336p-43f, 0x1.08f58ep-44f, -0x1.605eacp-49f, -0x1.5389d6p-50f, 0x1.e2637cp-56f, 0x1.cd6a4ap-56f, -0x1.4197a8p-59f,
+	0x1p-1f, 0x1.1f0dd4p-2f, 0x0p+0f, -0x1.753ddep-6f, 0x0p+0f, 0x1.ad8c9ap-10f, 0x0p+0f, -0x1.81dfaap-14f, 0x0p+0f, 0x1.167086p-18f, 0x0p+0f, -0x1.4ca324p-23f, 0x0p+0f, 0x1.50e6c6p-28f, 0x0p+0f, -0x1.26b71cp-33f, 0x0p+0f, 0x1.c3f81ap-39f, 0x0p+0f, -0x1.33a44ap-44f, 0x0p+0f, 0x1.7b0506p-50f, 0x0p+0f, -0x1.f75caep-56f, 0x1.4197a8p-59f,
+	0x1.84a838p-1f, 0x1.c1ad08p-3f, -0x1.b84c64p-5f, -0x1.306ea8p-7f, 0x1.650a92p-8f, 0x1.576d74p-13f, -0x1.78b51ap-12f, 0x1.d11846p-17f, 0x1.225088p-16f, -0x1.88ddcp-20f, -0x1.5baebcp-21f, 0x1.55c9ecp-24f, 0x1.4fb01p-26f, -0x1.af491p-29f, -0x1.0b2a0ap-31f, 0x1.b27be2p-34f, 0x1.626e94p-37f, -0x1.6de1cp-39f, -0x1.877336p-43f, 0x1.08f58ep-44f, 0x1.605eacp-49f, -0x1.5389d6p-50f, -0x1.e2637cp-56f, 0x1.cd6a4ap-56f, -0x1.101ddcp-59f,
+	0x1.d78142p-1f, 0x1.ad908ep-4f, -0x1.a9d82cp-5f, 0x1.0d7b36p-7f, 0x1.2bce3p-9f, -0x1.0e7594p-10f, 0x1.8e2e1ap-17f, 0x1.e07486p-15f, -0x1.d63268p-18f, -0x1.03ff5ep-19f, 0x1.ebdfdep-22f, 0x1.4659bp-25f, -0x1.3f0a32p-26f, -0x1.9ef522p-35f, 0x1.314744p-31f, -0x1.ed3a3ap-36f, -0x1.c9c5aap-37f, 0x1.648cap-40f, 0x1.12b526p-42f, -0x1.4b796ep-45f, -0x1.057cb2p-48f, 0x1.e5ec3p-51f, 0x1.731174p-55f, -0x1.62ef4cp-56f, 0x1.84bcf2p-60f,
+	0x1.f77844p-1f, 0x1.eb18bcp-6f, -0x1.750818p-6f, 0x1.205dcp-7f, -0x1.5adcdap-10f, -0x1.2058d4p-12f, 0x1.3e7038p-13f, -0x1.dc0ad2p-17f, -0x1.6dee0ep-18f, 0x1.8c17fap-20f, 0x1.342746p-25f, -0x1.06a646p-24f, 0x1.66b574p-28f, 0x1.9b12f2p-30f, -0x1.3e30eap-32f, -0x1.4b9fe6p-36f, 0x1.3d4d38p-37f, -0x1.595ebp-43f, -0x1.c12e8cp-43f, 0x1.11c7fp-46f, 0x1.d98bf8p-49f, -0x1.1154dap-51f, -0x1.65d0d4p-55f, 0x1.c8583ep-57f, -0x1.d27c56p-61f,
+	0x1.feea4cp-1f, 0x1.448df8p-8f, -0x1.534edep-8f, 0x1.97ed1cp-9f, -0x1.262644p-10f, 0x1.add11ap-13f, 0x1.4156cp-17f, -0x1.f36c8ap-17f, 0x1.8f3fe6p-19f, 0x1.c8e118p-24f, -0x1.3efcf4p-23f, 0x1.52f1ccp-26f, 0x1.5d1f18p-29f, -0x1.11b99p-30f, 0x1.63bf4ep-35f, 0x1.ac4fd4p-36f, -0x1.f43252p-39f, -0x1.3f31e2p-42f, 0x1.eb15e4p-44f, -0x1.6277bep-49f, -0x1.322198p-49f, 0x1.d27c56p-53f, 0x1.fce4bcp-56f, -0x1.e6c486p-58f, 0x1.d27c56p-62f,
+	0x1.ffec32p-1f, 0x1.d50af8p-12f, -0x1.405efcp-11f, 0x1.08e296p-11f, -0x1.2284e2p-12f, 0x1.ad6c5p-14f, -0x1.8c287ep-16f, 0x1.0a48b4p-19f, 0x1.7c7618p-21f, -0x1.34308cp-22f, 0x1.2e46dep-25f, 0x1.333c86p-28f, -0x1.29ee1cp-29f, 0x1.d45964p-33f, 0x1.440306p-35f, -0x1.98185ap-37f, 0x1.0ffd5p-41f, 0x1.1409acp-42f, -0x1.614444p-45f, -0x1.cc343p-50f, 0x1.23c806p-50f, -0x1.14f9d4p-54f, -0x1.164d16p-56f, 0x1.a9ebf6p-59f, -0x1.802a28p-63f,
+	0x1.ffff48p-1f, 0x1.535214p-16f, -0x1.278426p-15f, 0x1.3fc66ep-15f, -0x1.de0d22p-16f, 0x1.02bb4ap-16f, -0x1.9a6e14p-18f, 0x1.cfdcfcp-20f, -0x1.485bb8p-22f, 0x1.88955ap-27f, 0x1.80588ep-27f, -0x1.d83a4p-29f, 0x1.93aae4p-32f, 0x1.9ee2ccp-35f, -0x1.7b56e8p-36f, 0x1.4a6928p-39f, 0x1.172682p-42f, -0x1.c9162ap-44f, 0x1.17aeb2p-47f, 0x1.a08c08p-50f, -0x1.952c78p-52f, 0x1.4948b6p-57f, 0x1.d7799p-58f, -0x1.2ca69p-60f, 0x1.001c1cp-64f,
+	0x1.fffffep-1f, 0x1.aa0f3p-22f, -0x1.d6a0b2p-21f, 0x1.47a66p-20f, -0x1.41888p-20f, 0x1.d69f7p-21f, -0x1.0896c4p-21f, 0x1.ce667ap-23f, -0x1.37defap-24f, 0x1.38dde6p-26f, -0x1.9bdcfap-29f, 0x1.28d8c6p-33f, 0x1.81902ep-34f, -0x1.f4e356p-36f, 0x1.030e78p-38f, 0x1.452078p-43f, -0x1.4330cp-43f, 0x1.92b632p-46f, 0x1.812a44p-54f, -0x1.50a85p-51f, 0x1.84aaa8p-54f, 0x1.c956c2p-60f, -0x1.3195e6p-59f, 0x1.4e0e66p-62f, -0x1.0d96dap-66f,
+	0x1p+0f, 0x1.6a1b56p-29f, -0x1.01652cp-27f, 0x1.d0e38cp-27f, -0x1.2af86ep-26f, 0x1.22d92ap-26f, -0x1.bb73f6p-27f, 0x1.0e9282p-27f, -0x1.0b2e2ep-28f, 0x1.abbc28p-30f, -0x1.12db58p-31f, 0x1.132d28p-33f, -0x1.8af426p-36f, 0x1.1e7ffp-39f, 0x1.39313ap-42f, -0x1.50baaap-43f, 0x1.f17698p-46f, -0x1.c23168p-50f, -0x1.181ebep-51f, 0x1.3becc6p-53f, -0x1.bcd28p-57f, -0x1.8120a4p-60f, 0x1.2618eep-61f, -0x1.194f7ep-64f, 0x1.af57c2p-69f,
+	0x1p+0f, 0x1.ff6a8cp-39f, -0x1.e995p-37f, 0x1.2ab526p-35f, -0x1.04bcc2p-34f, 0x1.5a62d8p-34f, -0x1.6ba10ep-34f, 0x1.351c2ap-34f, -0x1.b070fp-35f, 0x1.f6cfacp-36f, -0x1.e84106p-37f, 0x1.8bc65ap-38f, -0x1.09d9c8p-39f, 0x1.2282c2p-41f, -0x1.eeafeep-44f, 0x1.23363ep-46f, -0x1.d98bf8p-51f, -0x1.87aafcp-52f, 0x1.099d26p-53f, -0x1.3aa944p-56f, 0x1.10f588p-61f, 0x1.ab7dd4p-62f, -0x1.8d080cp-64f, 0x1.519298p-67f, -0x1.ecf694p-72f,
+	0x1p+0f, 0x1.761afcp-52f, -0x1.0ce332p-49f, 0x1.ecf522p-48f, -0x1.437fecp-46f, 0x1.437e06p-45f, -0x1.00161ap-44f, 0x1.493946p-44f, -0x1.5dbc74p-44f, 0x1.36c34p-44f, -0x1.d1cd68p-45f, 0x1.27fc1ep-45f, -0x1.3fb544p-46f, 0x1.256032p-47f, -0x1.c78d6cp-49f, 0x1.2869acp-50f, -0x1.3d1082p-52f, 0x1.0b8b14p-54f, -0x1.402322p-57f, 0x1.4381d2p-61f, 0x1.4381d2p-63f, -0x1.ecf694p-65f, 0x1.501c7cp-67f, -0x1.0132bcp-70f, 0x1.6684cap-75f,
+	0x1p+0f, 0x1.761b42p-75f, -0x1.0ce396p-71f, 0x1.ecf694p-69f, -0x1.4381d2p-66f, 0x1.4381d2p-64f, -0x1.001c1cp-62f, 0x1.4948b6p-61f, -0x1.5ddd4p-60f, 0x1.36fd8ep-59f, -0x1.d27c56p-59f, 0x1.28dac2p-58f, -0x1.4197a8p-58f, 0x1.28dac2p-58f, -0x1.d27c56p-59f, 0x1.36fd8ep-59f, -0x1.5ddd4p-60f, 0x1.4948b6p-61f, -0x1.001c1cp-62f, 0x1.4381d2p-64f, -0x1.4381d2p-66f, 0x1.ecf694p-69f, -0x1.0ce396p-71f, 0x1.761b42p-75f, -0x1.f2cf02p-80f,
+	0x1p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+};
+
+static const float  LR_gsn_pdff[5524] = {
+/* 1 */
+	0x1p+0f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f,
+/* 2 */
+	0x0p+0f, 0x1p+0f, 0x0p+0f,
+	0x1p+0f, -0x1p+0f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 3 */
+	0x0p+0f, 0x0p+0f, 0x1p-1f, 0x0p+0f,
+	0x1p-1f, 0x1p+0f, -0x1p+0f, 0x0p+0f,
+	0x1p-1f, -0x1p+0f, 0x1p-1f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 4 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.555556p-3f, 0x0p+0f,
+	0x1.555556p-3f, 0x1p-1f, 0x1p-1f, -0x1p-1f, 0x0p+0f,
+	0x1.555556p-1f, 0x0p+0f, -0x1p+0f, 0x1p-1f, 0x0p+0f,
+	0x1.555556p-3f, -0x1p-1f, 0x1p-1f, -0x1.555556p-3f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 5 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.555556p-5f, 0x0p+0f,
+	0x1.555556p-5f, 0x1.555556p-3f, 0x1p-2f, 0x1.555556p-3f, -0x1.555556p-3f, 0x0p+0f,
+	0x1.d55556p-2f, 0x1p-1f, -0x1p-2f, -0x1p-1f, 0x1p-2f, 0x0p+0f,
+	0x1.d55556p-2f, -0x1p-1f, -0x1p-2f, 0x1p-1f, -0x1.555556p-3f, 0x0p+0f,
+	0x1.555556p-5f, -0x1.555556p-3f, 0x1p-2f, -0x1.555556p-3f, 0x1.555556p-5f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 6 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.111112p-7f, 0x0p+0f,
+	0x1.111112p-7f, 0x1.555556p-5f, 0x1.555556p-4f, 0x1.555556p-4f, 0x1.555556p-5f, -0x1.555556p-5f, 0x0p+0f,
+	0x1.bbbbbcp-3f, 0x1.aaaaaap-2f, 0x1.555556p-3f, -0x1.555556p-3f, -0x1.555556p-3f, 0x1.555556p-4f, 0x0p+0f,
+	0x1.19999ap-1f, 0x0p+0f, -0x1p-1f, 0x0p+0f, 0x1p-2f, -0x1.555556p-4f, 0x0p+0f,
+	0x1.bbbbbcp-3f, -0x1.aaaaaap-2f, 0x1.555556p-3f, 0x1.555556p-3f, -0x1.555556p-3f, 0x1.555556p-5f, 0x0p+0f,
+	0x1.111112p-7f, -0x1.555556p-5f, 0x1.555556p-4f, -0x1.555556p-4f, 0x1.555556p-5f, -0x1.111112p-7f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 7 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.6c16c2p-10f, 0x0p+0f,
+	0x1.6c16c2p-10f, 0x1.111112p-7f, 0x1.555556p-6f, 0x1.c71c72p-6f, 0x1.555556p-6f, 0x1.111112p-7f, -0x1.111112p-7f, 0x0p+0f,
+	0x1.444444p-4f, 0x1.aaaaaap-3f, 0x1.8p-3f, 0x1.c71c72p-6f, -0x1p-4f, -0x1.555556p-5f, 0x1.555556p-6f, 0x0p+0f,
+	0x1.ad82d8p-2f, 0x1.555556p-2f, -0x1.aaaaaap-3f, -0x1.c71c72p-3f, 0x1.555556p-5f, 0x1.555556p-4f, -0x1.c71c72p-6f, 0x0p+0f,
+	0x1.ad82d8p-2f, -0x1.555556p-2f, -0x1.aaaaaap-3f, 0x1.c71c72p-3f, 0x1.555556p-5f, -0x1.555556p-4f, 0x1.555556p-6f, 0x0p+0f,
+	0x1.444444p-4f, -0x1.aaaaaap-3f, 0x1.8p-3f, -0x1.c71c72p-6f, -0x1p-4f, 0x1.555556p-5f, -0x1.111112p-7f, 0x0p+0f,
+	0x1.6c16c2p-10f, -0x1.111112p-7f, 0x1.555556p-6f, -0x1.c71c72p-6f, 0x1.555556p-6f, -0x1.111112p-7f, 0x1.6c16c2p-10f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 8 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.a01a02p-13f, 0x0p+0f,
+	0x1.a01a02p-13f, 0x1.6c16c2p-10f, 0x1.111112p-8f, 0x1.c71c72p-8f, 0x1.c71c72p-8f, 0x1.111112p-8f, 0x1.6c16c2p-10f, -0x1.6c16c2p-10f, 0x0p+0f,
+	0x1.861862p-6f, 0x1.3e93eap-4f, 0x1.99999ap-4f, 0x1.c71c72p-5f, 0x0p+0f, -0x1.111112p-6f, -0x1.111112p-7f, 0x1.111112p-8f, 0x0p+0f,
+	0x1.e3f64p-3f, 0x1.5c71c8p-2f, 0x1p-4f, -0x1.0e38e4p-3f, -0x1p-4f, 0x1.555556p-6f, 0x1.555556p-6f, -0x1.c71c72p-8f, 0x0p+0f,
+	0x1.eadeaep-2f, 0x0p+0f, -0x1.555556p-2f, 0x0p+0f, 0x1.c71c72p-4f, 0x0p+0f, -0x1.c71c72p-6f, 0x1.c71c72p-8f, 0x0p+0f,
+	0x1.e3f64p-3f, -0x1.5c71c8p-2f, 0x1p-4f, 0x1.0e38e4p-3f, -0x1p-4f, -0x1.555556p-6f, 0x1.555556p-6f, -0x1.111112p-8f, 0x0p+0f,
+	0x1.861862p-6f, -0x1.3e93eap-4f, 0x1.99999ap-4f, -0x1.c71c72p-5f, 0x0p+0f, 0x1.111112p-6f, -0x1.111112p-7f, 0x1.6c16c2p-10f, 0x0p+0f,
+	0x1.a01a02p-13f, -0x1.6c16c2p-10f, 0x1.111112p-8f, -0x1.c71c72p-8f, 0x1.c71c72p-8f, -0x1.111112p-8f, 0x1.6c16c2p-10f, -0x1.a01a02p-13f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 9 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.a01a02p-16f, 0x0p+0f,
+	0x1.a01a02p-16f, 0x1.a01a02p-13f, 0x1.6c16c2p-11f, 0x1.6c16c2p-10f, 0x1.c71c72p-10f, 0x1.6c16c2p-10f, 0x1.6c16c2p-11f, 0x1.a01a02p-13f, -0x1.a01a02p-13f, 0x0p+0f,
+	0x1.917918p-8f, 0x1.82d82ep-6f, 0x1.38e38ep-5f, 0x1.05b05cp-5f, 0x1.8e38e4p-7f, -0x1.6c16c2p-10f, -0x1.c71c72p-9f, -0x1.6c16c2p-10f, 0x1.6c16c2p-11f, 0x0p+0f,
+	0x1.b41d42p-4f, 0x1.b33334p-3f, 0x1.0cccccp-3f, -0x1.99999ap-7f, -0x1.8p-5f, -0x1.99999ap-7f, 0x1.99999ap-8f, 0x1.111112p-8f, -0x1.6c16c2p-10f, 0x0p+0f,
+	0x1.8cac4ap-2f, 0x1.f1c71cp-3f, -0x1.5c71c8p-3f, -0x1.0e38e4p-3f, 0x1.0e38e4p-5f, 0x1.1c71c8p-5f, -0x1.c71c72p-9f, -0x1.c71c72p-8f, 0x1.c71c72p-10f, 0x0p+0f,
+	0x1.8cac4ap-2f, -0x1.f1c71cp-3f, -0x1.5c71c8p-3f, 0x1.0e38e4p-3f, 0x1.0e38e4p-5f, -0x1.1c71c8p-5f, -0x1.c71c72p-9f, 0x1.c71c72p-8f, -0x1.6c16c2p-10f, 0x0p+0f,
+	0x1.b41d42p-4f, -0x1.b33334p-3f, 0x1.0cccccp-3f, 0x1.99999ap-7f, -0x1.8p-5f, 0x1.99999ap-7f, 0x1.99999ap-8f, -0x1.111112p-8f, 0x1.6c16c2p-11f, 0x0p+0f,
+	0x1.917918p-8f, -0x1.82d82ep-6f, 0x1.38e38ep-5f, -0x1.05b05cp-5f, 0x1.8e38e4p-7f, 0x1.6c16c2p-10f, -0x1.c71c72p-9f, 0x1.6c16c2p-10f, -0x1.a01a02p-13f, 0x0p+0f,
+	0x1.a01a02p-16f, -0x1.a01a02p-13f, 0x1.6c16c2p-11f, -0x1.6c16c2p-10f, 0x1.c71c72p-10f, -0x1.6c16c2p-10f, 0x1.6c16c2p-11f, -0x1.a01a02p-13f, 0x1.a01a02p-16f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 10 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.71de3ap-19f, 0x0p+0f,
+	0x1.71de3ap-19f, 0x1.a01a02p-16f, 0x1.a01a02p-14f, 0x1.e573acp-13f, 0x1.6c16c2p-12f, 0x1.6c16c2p-12f, 0x1.e573acp-13f, 0x1.a01a02p-14f, 0x1.a01a02p-16f, -0x1.a01a02p-16f, 0x0p+0f,
+	0x1.6aa4e4p-10f, 0x1.8fd8fep-8f, 0x1.7f97fap-7f, 0x1.99999ap-7f, 0x1.f49f4ap-8f, 0x1.111112p-9f, -0x1.e573acp-12f, -0x1.381382p-11f, -0x1.a01a02p-13f, 0x1.a01a02p-14f, 0x0p+0f,
+	0x1.49c664p-5f, 0x1.9b05bp-4f, 0x1.82d82ep-4f, 0x1.fc3518p-6f, -0x1.6c16c2p-7f, -0x1.82d82ep-7f, -0x1.e573acp-10f, 0x1.6c16c2p-10f, 0x1.6c16c2p-11f, -0x1.e573acp-13f, 0x0p+0f,
+	0x1.f1f83cp-3f, 0x1.1fa4fap-2f, 0x1.f49f4ap-7f, -0x1.9b7f0ep-4f, -0x1.e93e94p-6f, 0x1.05b05cp-6f, 0x1.01e574p-7f, -0x1.6c16c2p-10f, -0x1.6c16c2p-10f, 0x1.6c16c2p-12f, 0x0p+0f,
+	0x1.b8bf7p-2f, 0x0p+0f, -0x1.f1c71cp-3f, 0x0p+0f, 0x1.0e38e4p-4f, 0x0p+0f, -0x1.7b425ep-7f, 0x0p+0f, 0x1.c71c72p-10f, -0x1.6c16c2p-12f, 0x0p+0f,
+	0x1.f1f83cp-3f, -0x1.1fa4fap-2f, 0x1.f49f4ap-7f, 0x1.9b7f0ep-4f, -0x1.e93e94p-6f, -0x1.05b05cp-6f, 0x1.01e574p-7f, 0x1.6c16c2p-10f, -0x1.6c16c2p-10f, 0x1.e573acp-13f, 0x0p+0f,
+	0x1.49c664p-5f, -0x1.9b05bp-4f, 0x1.82d82ep-4f, -0x1.fc3518p-6f, -0x1.6c16c2p-7f, 0x1.82d82ep-7f, -0x1.e573acp-10f, -0x1.6c16c2p-10f, 0x1.6c16c2p-11f, -0x1.a01a02p-14f, 0x0p+0f,
+	0x1.6aa4e4p-10f, -0x1.8fd8fep-8f, 0x1.7f97fap-7f, -0x1.99999ap-7f, 0x1.f49f4ap-8f, -0x1.111112p-9f, -0x1.e573acp-12f, 0x1.381382p-11f, -0x1.a01a02p-13f, 0x1.a01a02p-16f, 0x0p+0f,
+	0x1.71de3ap-19f, -0x1.a01a02p-16f, 0x1.a01a02p-14f, -0x1.e573acp-13f, 0x1.6c16c2p-12f, -0x1.6c16c2p-12f, 0x1.e573acp-13f, -0x1.a01a02p-14f, 0x1.a01a02p-16f, -0x1.71de3ap-19f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 11 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.27e4fcp-22f, 0x0p+0f,
+	0x1.27e4fcp-22f, 0x1.71de3ap-19f, 0x1.a01a02p-17f, 0x1.1566acp-15f, 0x1.e573acp-15f, 0x1.234568p-14f, 0x1.e573acp-15f, 0x1.1566acp-15f, 0x1.a01a02p-17f, 0x1.71de3ap-19f, -0x1.71de3ap-19f, 0x0p+0f,
+	0x1.24b746p-12f, 0x1.69ebf4p-10f, 0x1.8e38e4p-9f, 0x1.fb1fb2p-9f, 0x1.9203cap-9f, 0x1.7e4b18p-10f, 0x1.2f684cp-12f, -0x1.a01a02p-14f, -0x1.6c16c2p-14f, -0x1.a01a02p-16f, 0x1.a01a02p-17f, 0x0p+0f,
+	0x1.affe8ep-7f, 0x1.3e713cp-5f, 0x1.82082p-5f, 0x1.c3dc3ep-6f, 0x1.2f684cp-8f, -0x1.eb851ep-9f, -0x1.2f684cp-9f, -0x1.a01a02p-13f, 0x1.041042p-12f, 0x1.a01a02p-14f, -0x1.1566acp-15f, 0x0p+0f,
+	0x1.00e602p-3f, 0x1.9f86a4p-3f, 0x1.71c71cp-4f, -0x1.b05b06p-6f, -0x1.0d462ap-5f, -0x1.eb851ep-9f, 0x1.2f684cp-8f, 0x1.6c16c2p-10f, -0x1.6c16c2p-12f, -0x1.e573acp-13f, 0x1.e573acp-15f, 0x0p+0f,
+	0x1.71c3cap-2f, 0x1.7f86a4p-3f, -0x1.1fa4fap-3f, -0x1.60b60cp-4f, 0x1.9b7f0ep-6f, 0x1.3a06d4p-6f, -0x1.5ceb24p-9f, -0x1.6c16c2p-9f, 0x1.6c16c2p-13f, 0x1.6c16c2p-12f, -0x1.234568p-14f, 0x0p+0f,
+	0x1.71c3cap-2f, -0x1.7f86a4p-3f, -0x1.1fa4fap-3f, 0x1.60b60cp-4f, 0x1.9b7f0ep-6f, -0x1.3a06d4p-6f, -0x1.5ceb24p-9f, 0x1.6c16c2p-9f, 0x1.6c16c2p-13f, -0x1.6c16c2p-12f, 0x1.e573acp-15f, 0x0p+0f,
+	0x1.00e602p-3f, -0x1.9f86a4p-3f, 0x1.71c71cp-4f, 0x1.b05b06p-6f, -0x1.0d462ap-5f, 0x1.eb851ep-9f, 0x1.2f684cp-8f, -0x1.6c16c2p-10f, -0x1.6c16c2p-12f, 0x1.e573acp-13f, -0x1.1566acp-15f, 0x0p+0f,
+	0x1.affe8ep-7f, -0x1.3e713cp-5f, 0x1.82082p-5f, -0x1.c3dc3ep-6f, 0x1.2f684cp-8f, 0x1.eb851ep-9f, -0x1.2f684cp-9f, 0x1.a01a02p-13f, 0x1.041042p-12f, -0x1.a01a02p-14f, 0x1.a01a02p-17f, 0x0p+0f,
+	0x1.24b746p-12f, -0x1.69ebf4p-10f, 0x1.8e38e4p-9f, -0x1.fb1fb2p-9f, 0x1.9203cap-9f, -0x1.7e4b18p-10f, 0x1.2f684cp-12f, 0x1.a01a02p-14f, -0x1.6c16c2p-14f, 0x1.a01a02p-16f, -0x1.71de3ap-19f, 0x0p+0f,
+	0x1.27e4fcp-22f, -0x1.71de3ap-19f, 0x1.a01a02p-17f, -0x1.1566acp-15f, 0x1.e573acp-15f, -0x1.234568p-14f, 0x1.e573acp-15f, -0x1.1566acp-15f, 0x1.a01a02p-17f, -0x1.71de3ap-19f, 0x1.27e4fcp-22f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 12 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.ae6456p-26f, 0x0p+0f,
+	0x1.ae6456p-26f, 0x1.27e4fcp-22f, 0x1.71de3ap-20f, 0x1.1566acp-18f, 0x1.1566acp-17f, 0x1.845c8ap-17f, 0x1.845c8ap-17f, 0x1.1566acp-17f, 0x1.1566acp-18f, 0x1.71de3ap-20f, 0x1.27e4fcp-22f, -0x1.27e4fcp-22f, 0x0p+0f,
+	0x1.abdecp-15f, 0x1.246d4cp-12f, 0x1.693304p-11f, 0x1.0865dcp-10f, 0x1.f6ca18p-11f, 0x1.3b8b3p-11f, 0x1.e573acp-13f, 0x1.1566acp-15f, -0x1.1566acp-16f, -0x1.71de3ap-17f, -0x1.71de3ap-19f, 0x1.71de3ap-20f, 0x0p+0f,
+	0x1.f53414p-9f, 0x1.a6d8d4p-7f, 0x1.3321dcp-6f, 0x1.e18618p-7f, 0x1.847848p-8f, 0x1.47ae14p-12f, -0x1.c71c72p-11f, -0x1.861862p-12f, -0x1.a01a02p-17f, 0x1.381382p-15f, 0x1.a01a02p-17f, -0x1.1566acp-18f, 0x0p+0f,
+	0x1.c43706p-5f, 0x1.cbcc34p-4f, 0x1.4fea54p-4f, 0x1.d75d76p-7f, -0x1.ba1ba2p-7f, -0x1.eb851ep-8f, 0x0p+0f, 0x1.041042p-10f, 0x1.a01a02p-13f, -0x1.1566acp-14f, -0x1.1566acp-15f, 0x1.1566acp-17f, 0x0p+0f,
+	0x1.f3a174p-3f, 0x1.e2a19p-3f, -0x1p-7f, -0x1.3b05bp-4f, -0x1.e93e94p-7f, 0x1.7c048ep-7f, 0x1.f49f4ap-9f, -0x1.111112p-10f, -0x1.111112p-11f, 0x1.e573acp-15f, 0x1.e573acp-15f, -0x1.845c8ap-17f, 0x0p+0f,
+	0x1.93613ap-2f, 0x0p+0f, -0x1.7f86a4p-3f, 0x0p+0f, 0x1.60b60cp-5f, 0x0p+0f, -0x1.a2b3c4p-8f, 0x0p+0f, 0x1.6c16c2p-11f, 0x0p+0f, -0x1.234568p-14f, 0x1.845c8ap-17f, 0x0p+0f,
+	0x1.f3a174p-3f, -0x1.e2a19p-3f, -0x1p-7f, 0x1.3b05bp-4f, -0x1.e93e94p-7f, -0x1.7c048ep-7f, 0x1.f49f4ap-9f, 0x1.111112p-10f, -0x1.111112p-11f, -0x1.e573acp-15f, 0x1.e573acp-15f, -0x1.1566acp-17f, 0x0p+0f,
+	0x1.c43706p-5f, -0x1.cbcc34p-4f, 0x1.4fea54p-4f, -0x1.d75d76p-7f, -0x1.ba1ba2p-7f, 0x1.eb851ep-8f, 0x0p+0f, -0x1.041042p-10f, 0x1.a01a02p-13f, 0x1.1566acp-14f, -0x1.1566acp-15f, 0x1.1566acp-18f, 0x0p+0f,
+	0x1.f53414p-9f, -0x1.a6d8d4p-7f, 0x1.3321dcp-6f, -0x1.e18618p-7f, 0x1.847848p-8f, -0x1.47ae14p-12f, -0x1.c71c72p-11f, 0x1.861862p-12f, -0x1.a01a02p-17f, -0x1.381382p-15f, 0x1.a01a02p-17f, -0x1.71de3ap-20f, 0x0p+0f,
+	0x1.abdecp-15f, -0x1.246d4cp-12f, 0x1.693304p-11f, -0x1.0865dcp-10f, 0x1.f6ca18p-11f, -0x1.3b8b3p-11f, 0x1.e573acp-13f, -0x1.1566acp-15f, -0x1.1566acp-16f, 0x1.71de3ap-17f, -0x1.71de3ap-19f, 0x1.27e4fcp-22f, 0x0p+0f,
+	0x1.ae6456p-26f, -0x1.27e4fcp-22f, 0x1.71de3ap-20f, -0x1.1566acp-18f, 0x1.1566acp-17f, -0x1.845c8ap-17f, 0x1.845c8ap-17f, -0x1.1566acp-17f, 0x1.1566acp-18f, -0x1.71de3ap-20f, 0x1.27e4fcp-22f, -0x1.ae6456p-26f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 13 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.1eed8ep-29f, 0x0p+0f,
+	0x1.1eed8ep-29f, 0x1.ae6456p-26f, 0x1.27e4fcp-23f, 0x1.ed284ep-22f, 0x1.1566acp-20f, 0x1.bbd77ap-20f, 0x1.02e85cp-19f, 0x1.bbd77ap-20f, 0x1.1566acp-20f, 0x1.ed284ep-22f, 0x1.27e4fcp-23f, 0x1.ae6456p-26f, -0x1.ae6456p-26f, 0x0p+0f,
+	0x1.1e046ep-17f, 0x1.aba8f4p-15f, 0x1.242354p-13f, 0x1.e0a2c8p-13f, 0x1.075076p-12f, 0x1.8ec396p-13f, 0x1.9ca252p-14f, 0x1.0787fp-15f, 0x1.a01a02p-19f, -0x1.34393p-19f, -0x1.4ce19ap-20f, -0x1.27e4fcp-22f, 0x1.27e4fcp-23f, 0x0p+0f,
+	0x1.05be82p-10f, 0x1.ee8498p-9f, 0x1.9db56ap-8f, 0x1.8a75bp-8f, 0x1.c0795cp-9f, 0x1.047f36p-10f, -0x1.948b1p-15f, -0x1.4969ecp-13f, -0x1.a8c536p-15f, 0x1.ed284ep-22f, 0x1.43a274p-18f, 0x1.71de3ap-20f, -0x1.ed284ep-22f, 0x0p+0f,
+	0x1.5c76e6p-6f, 0x1.a4e3c6p-5f, 0x1.96f11ap-5f, 0x1.59827cp-6f, -0x1.451452p-14f, -0x1.fd1304p-9f, -0x1.555556p-10f, 0x1.041042p-13f, 0x1.65965ap-13f, 0x1.88fc1ep-16f, -0x1.5ac056p-17f, -0x1.1566acp-18f, 0x1.1566acp-20f, 0x0p+0f,
+	0x1.1b8c72p-3f, 0x1.8293b2p-3f, 0x1.f976ecp-5f, -0x1.ea8dc6p-6f, -0x1.75f16p-6f, -0x1.2dac74p-12f, 0x1.a12f68p-9f, 0x1.1e11e2p-11f, -0x1.0a90aap-12f, -0x1.4f3164p-14f, 0x1.a01a02p-17f, 0x1.1566acp-17f, -0x1.bbd77ap-20f, 0x0p+0f,
+	0x1.5b6a5ep-2f, 0x1.3320fep-3f, -0x1.e2a19p-4f, -0x1.ea08dap-5f, 0x1.3b05bp-6f, 0x1.7c048ep-7f, -0x1.fab0bcp-10f, -0x1.7e4b18p-10f, 0x1.111112p-13f, 0x1.1b2e24p-13f, -0x1.845c8ap-18f, -0x1.845c8ap-17f, 0x1.02e85cp-19f, 0x0p+0f,
+	0x1.5b6a5ep-2f, -0x1.3320fep-3f, -0x1.e2a19p-4f, 0x1.ea08dap-5f, 0x1.3b05bp-6f, -0x1.7c048ep-7f, -0x1.fab0bcp-10f, 0x1.7e4b18p-10f, 0x1.111112p-13f, -0x1.1b2e24p-13f, -0x1.845c8ap-18f, 0x1.845c8ap-17f, -0x1.bbd77ap-20f, 0x0p+0f,
+	0x1.1b8c72p-3f, -0x1.8293b2p-3f, 0x1.f976ecp-5f, 0x1.ea8dc6p-6f, -0x1.75f16p-6f, 0x1.2dac74p-12f, 0x1.a12f68p-9f, -0x1.1e11e2p-11f, -0x1.0a90aap-12f, 0x1.4f3164p-14f, 0x1.a01a02p-17f, -0x1.1566acp-17f, 0x1.1566acp-20f, 0x0p+0f,
+	0x1.5c76e6p-6f, -0x1.a4e3c6p-5f, 0x1.96f11ap-5f, -0x1.59827cp-6f, -0x1.451452p-14f, 0x1.fd1304p-9f, -0x1.555556p-10f, -0x1.041042p-13f, 0x1.65965ap-13f, -0x1.88fc1ep-16f, -0x1.5ac056p-17f, 0x1.1566acp-18f, -0x1.ed284ep-22f, 0x0p+0f,
+	0x1.05be82p-10f, -0x1.ee8498p-9f, 0x1.9db56ap-8f, -0x1.8a75bp-8f, 0x1.c0795cp-9f, -0x1.047f36p-10f, -0x1.948b1p-15f, 0x1.4969ecp-13f, -0x1.a8c536p-15f, -0x1.ed284ep-22f, 0x1.43a274p-18f, -0x1.71de3ap-20f, 0x1.27e4fcp-23f, 0x0p+0f,
+	0x1.1e046ep-17f, -0x1.aba8f4p-15f, 0x1.242354p-13f, -0x1.e0a2c8p-13f, 0x1.075076p-12f, -0x1.8ec396p-13f, 0x1.9ca252p-14f, -0x1.0787fp-15f, 0x1.a01a02p-19f, 0x1.34393p-19f, -0x1.4ce19ap-20f, 0x1.27e4fcp-22f, -0x1.ae6456p-26f, 0x0p+0f,
+	0x1.1eed8ep-29f, -0x1.ae6456p-26f, 0x1.27e4fcp-23f, -0x1.ed284ep-22f, 0x1.1566acp-20f, -0x1.bbd77ap-20f, 0x1.02e85cp-19f, -0x1.bbd77ap-20f, 0x1.1566acp-20f, -0x1.ed284ep-22f, 0x1.27e4fcp-23f, -0x1.ae6456p-26f, 0x1.1eed8ep-29f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 14 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.612462p-33f, 0x0p+0f,
+	0x1.612462p-33f, 0x1.1eed8ep-29f, 0x1.ae6456p-27f, 0x1.8a86a4p-25f, 0x1.ed284ep-24f, 0x1.bbd77ap-23f, 0x1.27e4fcp-22f, 0x1.27e4fcp-22f, 0x1.bbd77ap-23f, 0x1.ed284ep-24f, 0x1.8a86a4p-25f, 0x1.ae6456p-27f, 0x1.1eed8ep-29f, -0x1.1eed8ep-29f, 0x0p+0f,
+	0x1.6089e2p-20f, 0x1.1df28p-17f, 0x1.ab7326p-16f, 0x1.8521cep-15f, 0x1.dfac34p-15f, 0x1.a391bp-15f, 0x1.0787fp-15f, 0x1.ce55c8p-17f, 0x1.f35268p-19f, 0x1.ed284ep-23f, -0x1.27e4fcp-22f, -0x1.0cfeb6p-23f, -0x1.ae6456p-26f, 0x1.ae6456p-27f, 0x0p+0f,
+	0x1.f2588ep-13f, 0x1.038278p-10f, 0x1.e7d5f4p-10f, 0x1.0db834p-9f, 0x1.7b709ap-10f, 0x1.4c72a6p-11f, 0x1.18de5ap-13f, -0x1.5f5feap-16f, -0x1.8b4be8p-16f, -0x1.90b0cp-18f, 0x1.27e4fcp-22f, 0x1.27e4fcp-21f, 0x1.27e4fcp-23f, -0x1.8a86a4p-25f, 0x0p+0f,
+	0x1.df36fap-8f, 0x1.4c1afep-6f, 0x1.85fb7cp-6f, 0x1.d9a33cp-7f, 0x1.edca2p-9f, -0x1.6ee8p-11f, -0x1.aa3716p-11f, -0x1.77a5b4p-13f, 0x1.26bd16p-15f, 0x1.9c3fb2p-16f, 0x1.34393p-19f, -0x1.71de3ap-20f, -0x1.ed284ep-22f, 0x1.ed284ep-24f, 0x0p+0f,
+	0x1.166cecp-4f, 0x1.dffb28p-4f, 0x1.195acp-4f, 0x1.06ba32p-8f, -0x1.a2082p-7f, -0x1.2a237p-8f, 0x1.3a3e4ep-11f, 0x1.4fea54p-11f, 0x1.ba1ba2p-15f, -0x1.8bdfdap-15f, -0x1.5ac056p-17f, 0x1.1566acp-19f, 0x1.1566acp-20f, -0x1.bbd77ap-23f, 0x0p+0f,
+	0x1.ef2ec4p-3f, 0x1.9b484cp-3f, -0x1.3dcaccp-6f, -0x1.ea3e04p-5f, -0x1.e983eep-8f, 0x1.139606p-7f, 0x1.03a14cp-9f, -0x1.7f2904p-11f, -0x1.06aa04p-12f, 0x1.664f48p-15f, 0x1.689f12p-16f, -0x1.bbd77ap-20f, -0x1.bbd77ap-20f, 0x1.27e4fcp-22f, 0x0p+0f,
+	0x1.7623c8p-2f, 0x0p+0f, -0x1.3320fep-3f, 0x0p+0f, 0x1.ea08dap-6f, 0x0p+0f, -0x1.fab0bcp-9f, 0x0p+0f, 0x1.7e4b18p-12f, 0x0p+0f, -0x1.c516a2p-16f, 0x0p+0f, 0x1.02e85cp-19f, -0x1.27e4fcp-22f, 0x0p+0f,
+	0x1.ef2ec4p-3f, -0x1.9b484cp-3f, -0x1.3dcaccp-6f, 0x1.ea3e04p-5f, -0x1.e983eep-8f, -0x1.139606p-7f, 0x1.03a14cp-9f, 0x1.7f2904p-11f, -0x1.06aa04p-12f, -0x1.664f48p-15f, 0x1.689f12p-16f, 0x1.bbd77ap-20f, -0x1.bbd77ap-20f, 0x1.bbd77ap-23f, 0x0p+0f,
+	0x1.166cecp-4f, -0x1.dffb28p-4f, 0x1.195acp-4f, -0x1.06ba32p-8f, -0x1.a2082p-7f, 0x1.2a237p-8f, 0x1.3a3e4ep-11f, -0x1.4fea54p-11f, 0x1.ba1ba2p-15f, 0x1.8bdfdap-15f, -0x1.5ac056p-17f, -0x1.1566acp-19f, 0x1.1566acp-20f, -0x1.ed284ep-24f, 0x0p+0f,
+	0x1.df36fap-8f, -0x1.4c1afep-6f, 0x1.85fb7cp-6f, -0x1.d9a33cp-7f, 0x1.edca2p-9f, 0x1.6ee8p-11f, -0x1.aa3716p-11f, 0x1.77a5b4p-13f, 0x1.26bd16p-15f, -0x1.9c3fb2p-16f, 0x1.34393p-19f, 0x1.71de3ap-20f, -0x1.ed284ep-22f, 0x1.8a86a4p-25f, 0x0p+0f,
+	0x1.f2588ep-13f, -0x1.038278p-10f, 0x1.e7d5f4p-10f, -0x1.0db834p-9f, 0x1.7b709ap-10f, -0x1.4c72a6p-11f, 0x1.18de5ap-13f, 0x1.5f5feap-16f, -0x1.8b4be8p-16f, 0x1.90b0cp-18f, 0x1.27e4fcp-22f, -0x1.27e4fcp-21f, 0x1.27e4fcp-23f, -0x1.ae6456p-27f, 0x0p+0f,
+	0x1.6089e2p-20f, -0x1.1df28p-17f, 0x1.ab7326p-16f, -0x1.8521cep-15f, 0x1.dfac34p-15f, -0x1.a391bp-15f, 0x1.0787fp-15f, -0x1.ce55c8p-17f, 0x1.f35268p-19f, -0x1.ed284ep-23f, -0x1.27e4fcp-22f, 0x1.0cfeb6p-23f, -0x1.ae6456p-26f, 0x1.1eed8ep-29f, 0x0p+0f,
+	0x1.612462p-33f, -0x1.1eed8ep-29f, 0x1.ae6456p-27f, -0x1.8a86a4p-25f, 0x1.ed284ep-24f, -0x1.bbd77ap-23f, 0x1.27e4fcp-22f, -0x1.27e4fcp-22f, 0x1.bbd77ap-23f, -0x1.ed284ep-24f, 0x1.8a86a4p-25f, -0x1.ae6456p-27f, 0x1.1eed8ep-29f, -0x1.612462p-33f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 15 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.93974ap-37f, 0x0p+0f,
+	0x1.93974ap-37f, 0x1.612462p-33f, 0x1.1eed8ep-30f, 0x1.1eed8ep-28f, 0x1.8a86a4p-27f, 0x1.8a86a4p-26f, 0x1.27e4fcp-25f, 0x1.522a44p-25f, 0x1.27e4fcp-25f, 0x1.8a86a4p-26f, 0x1.8a86a4p-27f, 0x1.1eed8ep-28f, 0x1.1eed8ep-30f, 0x1.612462p-33f, -0x1.612462p-33f, 0x0p+0f,
+	0x1.9338b4p-23f, 0x1.607ed8p-20f, 0x1.1de09p-18f, 0x1.1cd392p-17f, 0x1.84bf2cp-17f, 0x1.7ef7b2p-17f, 0x1.168e9p-17f, 0x1.2a895p-18f, 0x1.c516a2p-20f, 0x1.a32f0ep-22f, 0x1.8a86a4p-27f, -0x1.f61fbap-26f, -0x1.8a86a4p-27f, -0x1.1eed8ep-29f, 0x1.1eed8ep-30f, 0x0p+0f,
+	0x1.b498bep-15f, 0x1.ef977ap-13f, 0x1.014694p-11f, 0x1.40c57p-11f, 0x1.07a3aep-11f, 0x1.238f6p-12f, 0x1.984cb8p-14f, 0x1.eb656ap-17f, -0x1.234568p-18f, -0x1.96dadap-19f, -0x1.4ce19ap-21f, 0x1.ae6456p-25f, 0x1.e430e2p-25f, 0x1.ae6456p-27f, -0x1.1eed8ep-28f, 0x0p+0f,
+	0x1.2a4f3p-9f, 0x1.cfa436p-8f, 0x1.3be2d6p-7f, 0x1.df52d2p-8f, 0x1.96352ep-9f, 0x1.e682eap-12f, -0x1.d23c6ep-13f, -0x1.1bacf4p-13f, -0x1.4bb9b6p-16f, 0x1.b5ad5ep-18f, 0x1.99efe8p-19f, 0x1.8a86a4p-23f, -0x1.5935dp-23f, -0x1.8a86a4p-25f, 0x1.8a86a4p-27f, 0x0p+0f,
+	0x1.e35322p-6f, 0x1.f0f2f8p-5f, 0x1.8cf46ap-5f, 0x1.ea4a58p-7f, -0x1.564622p-9f, -0x1.b12eeep-9f, -0x1.505deap-11f, 0x1.a71e82p-13f, 0x1.add3cp-14f, 0x1.05fd6ap-19f, -0x1.e1995cp-18f, -0x1.34393p-20f, 0x1.34393p-22f, 0x1.ed284ep-24f, -0x1.8a86a4p-26f, 0x0p+0f,
+	0x1.2db70ep-3f, 0x1.63f84ep-3f, 0x1.56956ep-5f, -0x1.e111eep-6f, -0x1.058aa6p-6f, 0x1.153d1p-10f, 0x1.1b1a7ep-9f, 0x1.9ddf5ap-13f, -0x1.6789acp-13f, -0x1.1a9a32p-15f, 0x1.2dac74p-17f, 0x1.845c8ap-19f, -0x1.4ce19ap-22f, -0x1.bbd77ap-23f, 0x1.27e4fcp-25f, 0x0p+0f,
+	0x1.488cf8p-2f, 0x1.fa3198p-4f, -0x1.9b484cp-4f, -0x1.648a32p-5f, 0x1.ea3e04p-7f, 0x1.e9ee44p-8f, -0x1.6f72b2p-10f, -0x1.b5e5bcp-11f, 0x1.7f2904p-14f, 0x1.1ea5d4p-14f, -0x1.1ea5d4p-18f, -0x1.27e4fcp-18f, 0x1.27e4fcp-23f, 0x1.27e4fcp-22f, -0x1.522a44p-25f, 0x0p+0f,
+	0x1.488cf8p-2f, -0x1.fa3198p-4f, -0x1.9b484cp-4f, 0x1.648a32p-5f, 0x1.ea3e04p-7f, -0x1.e9ee44p-8f, -0x1.6f72b2p-10f, 0x1.b5e5bcp-11f, 0x1.7f2904p-14f, -0x1.1ea5d4p-14f, -0x1.1ea5d4p-18f, 0x1.27e4fcp-18f, 0x1.27e4fcp-23f, -0x1.27e4fcp-22f, 0x1.27e4fcp-25f, 0x0p+0f,
+	0x1.2db70ep-3f, -0x1.63f84ep-3f, 0x1.56956ep-5f, 0x1.e111eep-6f, -0x1.058aa6p-6f, -0x1.153d1p-10f, 0x1.1b1a7ep-9f, -0x1.9ddf5ap-13f, -0x1.6789acp-13f, 0x1.1a9a32p-15f, 0x1.2dac74p-17f, -0x1.845c8ap-19f, -0x1.4ce19ap-22f, 0x1.bbd77ap-23f, -0x1.8a86a4p-26f, 0x0p+0f,
+	0x1.e35322p-6f, -0x1.f0f2f8p-5f, 0x1.8cf46ap-5f, -0x1.ea4a58p-7f, -0x1.564622p-9f, 0x1.b12eeep-9f, -0x1.505deap-11f, -0x1.a71e82p-13f, 0x1.add3cp-14f, -0x1.05fd6ap-19f, -0x1.e1995cp-18f, 0x1.34393p-20f, 0x1.34393p-22f, -0x1.ed284ep-24f, 0x1.8a86a4p-27f, 0x0p+0f,
+	0x1.2a4f3p-9f, -0x1.cfa436p-8f, 0x1.3be2d6p-7f, -0x1.df52d2p-8f, 0x1.96352ep-9f, -0x1.e682eap-12f, -0x1.d23c6ep-13f, 0x1.1bacf4p-13f, -0x1.4bb9b6p-16f, -0x1.b5ad5ep-18f, 0x1.99efe8p-19f, -0x1.8a86a4p-23f, -0x1.5935dp-23f, 0x1.8a86a4p-25f, -0x1.1eed8ep-28f, 0x0p+0f,
+	0x1.b498bep-15f, -0x1.ef977ap-13f, 0x1.014694p-11f, -0x1.40c57p-11f, 0x1.07a3aep-11f, -0x1.238f6p-12f, 0x1.984cb8p-14f, -0x1.eb656ap-17f, -0x1.234568p-18f, 0x1.96dadap-19f, -0x1.4ce19ap-21f, -0x1.ae6456p-25f, 0x1.e430e2p-25f, -0x1.ae6456p-27f, 0x1.1eed8ep-30f, 0x0p+0f,
+	0x1.9338b4p-23f, -0x1.607ed8p-20f, 0x1.1de09p-18f, -0x1.1cd392p-17f, 0x1.84bf2cp-17f, -0x1.7ef7b2p-17f, 0x1.168e9p-17f, -0x1.2a895p-18f, 0x1.c516a2p-20f, -0x1.a32f0ep-22f, 0x1.8a86a4p-27f, 0x1.f61fbap-26f, -0x1.8a86a4p-27f, 0x1.1eed8ep-29f, -0x1.612462p-33f, 0x0p+0f,
+	0x1.93974ap-37f, -0x1.612462p-33f, 0x1.1eed8ep-30f, -0x1.1eed8ep-28f, 0x1.8a86a4p-27f, -0x1.8a86a4p-26f, 0x1.27e4fcp-25f, -0x1.522a44p-25f, 0x1.27e4fcp-25f, -0x1.8a86a4p-26f, 0x1.8a86a4p-27f, -0x1.1eed8ep-28f, 0x1.1eed8ep-30f, -0x1.612462p-33f, 0x1.93974ap-37f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 16 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.ae7f3ep-41f, 0x0p+0f,
+	0x1.ae7f3ep-41f, 0x1.93974ap-37f, 0x1.612462p-34f, 0x1.7e9214p-32f, 0x1.1eed8ep-30f, 0x1.3b9eeap-29f, 0x1.07046ep-28f, 0x1.522a44p-28f, 0x1.522a44p-28f, 0x1.07046ep-28f, 0x1.3b9eeap-29f, 0x1.1eed8ep-30f, 0x1.7e9214p-32f, 0x1.612462p-34f, 0x1.93974ap-37f, -0x1.93974ap-37f, 0x0p+0f,
+	0x1.ae496ep-26f, 0x1.933264p-23f, 0x1.6073dp-21f, 0x1.7d1382p-20f, 0x1.1cafb4p-19f, 0x1.36b06ep-19f, 0x1.fd9894p-20f, 0x1.3d07ap-20f, 0x1.27e4fcp-21f, 0x1.8a86a4p-23f, 0x1.3b9eeap-25f, 0x0p+0f, -0x1.7e9214p-29f, -0x1.08db48p-30f, -0x1.612462p-33f, 0x1.612462p-34f, 0x0p+0f,
+	0x1.62bcd4p-17f, 0x1.b30584p-15f, 0x1.ecd67cp-14f, 0x1.540e6ep-13f, 0x1.3c5222p-13f, 0x1.9c1ab4p-14f, 0x1.74ca2ep-15f, 0x1.aad59ap-17f, 0x1.5620c2p-20f, -0x1.67980ep-21f, -0x1.6f66fcp-22f, -0x1.ed284ep-25f, 0x1.c64d78p-28f, 0x1.66a8f2p-28f, 0x1.1eed8ep-30f, -0x1.7e9214p-32f, 0x0p+0f,
+	0x1.5406c6p-11f, 0x1.237ccep-9f, 0x1.c0277ap-9f, 0x1.8fbde8p-9f, 0x1.b73a24p-10f, 0x1.103d02p-11f, 0x1.03ef6p-15f, -0x1.7f13ep-15f, -0x1.3a634cp-16f, -0x1.cc47cp-20f, 0x1.00711ep-20f, 0x1.66a8f2p-22f, 0x1.7e9214p-27f, -0x1.1eed8ep-26f, -0x1.1eed8ep-28f, 0x1.1eed8ep-30f, 0x0p+0f,
+	0x1.78e812p-7f, 0x1.be093cp-6f, 0x1.b6fe7p-6f, 0x1.a7fa44p-7f, 0x1.f541ep-10f, -0x1.2b6486p-10f, -0x1.4954dcp-11f, -0x1.f66afcp-15f, 0x1.6165bcp-15f, 0x1.c7c90cp-17f, -0x1.eab11p-22f, -0x1.f35268p-21f, -0x1.dcb806p-24f, 0x1.27e4fcp-25f, 0x1.8a86a4p-27f, -0x1.3b9eeap-29f, 0x0p+0f,
+	0x1.41ed18p-4f, 0x1.e29952p-4f, 0x1.cf7722p-5f, -0x1.21fa94p-9f, -0x1.6b1b8ep-7f, -0x1.5e0302p-9f, 0x1.7d33a4p-11f, 0x1.a3a6d4p-12f, -0x1.27e4fcp-21f, -0x1.fe9f9ap-16f, -0x1.de5cdap-19f, 0x1.8a86a4p-20f, 0x1.69a616p-22f, -0x1.8a86a4p-25f, -0x1.8a86a4p-26f, 0x1.07046ep-28f, 0x0p+0f,
+	0x1.e7ad22p-3f, 0x1.6362e2p-3f, -0x1.9b7e0ap-6f, -0x1.846202p-5f, -0x1.d004eap-9f, 0x1.955486p-8f, 0x1.186ap-10f, -0x1.0ac232p-11f, -0x1.0eaec8p-13f, 0x1.e9e1fp-16f, 0x1.565bfp-17f, -0x1.43a274p-20f, -0x1.46b78p-21f, 0x1.27e4fcp-25f, 0x1.27e4fcp-25f, -0x1.522a44p-28f, 0x0p+0f,
+	0x1.5e743cp-2f, 0x0p+0f, -0x1.fa3198p-4f, 0x0p+0f, 0x1.648a32p-6f, 0x0p+0f, -0x1.469ed8p-9f, 0x0p+0f, 0x1.b5e5bcp-13f, 0x0p+0f, -0x1.caa2ecp-17f, 0x0p+0f, 0x1.8a86a4p-21f, 0x0p+0f, -0x1.522a44p-25f, 0x1.522a44p-28f, 0x0p+0f,
+	0x1.e7ad22p-3f, -0x1.6362e2p-3f, -0x1.9b7e0ap-6f, 0x1.846202p-5f, -0x1.d004eap-9f, -0x1.955486p-8f, 0x1.186ap-10f, 0x1.0ac232p-11f, -0x1.0eaec8p-13f, -0x1.e9e1fp-16f, 0x1.565bfp-17f, 0x1.43a274p-20f, -0x1.46b78p-21f, -0x1.27e4fcp-25f, 0x1.27e4fcp-25f, -0x1.07046ep-28f, 0x0p+0f,
+	0x1.41ed18p-4f, -0x1.e29952p-4f, 0x1.cf7722p-5f, 0x1.21fa94p-9f, -0x1.6b1b8ep-7f, 0x1.5e0302p-9f, 0x1.7d33a4p-11f, -0x1.a3a6d4p-12f, -0x1.27e4fcp-21f, 0x1.fe9f9ap-16f, -0x1.de5cdap-19f, -0x1.8a86a4p-20f, 0x1.69a616p-22f, 0x1.8a86a4p-25f, -0x1.8a86a4p-26f, 0x1.3b9eeap-29f, 0x0p+0f,
+	0x1.78e812p-7f, -0x1.be093cp-6f, 0x1.b6fe7p-6f, -0x1.a7fa44p-7f, 0x1.f541ep-10f, 0x1.2b6486p-10f, -0x1.4954dcp-11f, 0x1.f66afcp-15f, 0x1.6165bcp-15f, -0x1.c7c90cp-17f, -0x1.eab11p-22f, 0x1.f35268p-21f, -0x1.dcb806p-24f, -0x1.27e4fcp-25f, 0x1.8a86a4p-27f, -0x1.1eed8ep-30f, 0x0p+0f,
+	0x1.5406c6p-11f, -0x1.237ccep-9f, 0x1.c0277ap-9f, -0x1.8fbde8p-9f, 0x1.b73a24p-10f, -0x1.103d02p-11f, 0x1.03ef6p-15f, 0x1.7f13ep-15f, -0x1.3a634cp-16f, 0x1.cc47cp-20f, 0x1.00711ep-20f, -0x1.66a8f2p-22f, 0x1.7e9214p-27f, 0x1.1eed8ep-26f, -0x1.1eed8ep-28f, 0x1.7e9214p-32f, 0x0p+0f,
+	0x1.62bcd4p-17f, -0x1.b30584p-15f, 0x1.ecd67cp-14f, -0x1.540e6ep-13f, 0x1.3c5222p-13f, -0x1.9c1ab4p-14f, 0x1.74ca2ep-15f, -0x1.aad59ap-17f, 0x1.5620c2p-20f, 0x1.67980ep-21f, -0x1.6f66fcp-22f, 0x1.ed284ep-25f, 0x1.c64d78p-28f, -0x1.66a8f2p-28f, 0x1.1eed8ep-30f, -0x1.612462p-34f, 0x0p+0f,
+	0x1.ae496ep-26f, -0x1.933264p-23f, 0x1.6073dp-21f, -0x1.7d1382p-20f, 0x1.1cafb4p-19f, -0x1.36b06ep-19f, 0x1.fd9894p-20f, -0x1.3d07ap-20f, 0x1.27e4fcp-21f, -0x1.8a86a4p-23f, 0x1.3b9eeap-25f, 0x0p+0f, -0x1.7e9214p-29f, 0x1.08db48p-30f, -0x1.612462p-33f, 0x1.93974ap-37f, 0x0p+0f,
+	0x1.ae7f3ep-41f, -0x1.93974ap-37f, 0x1.612462p-34f, -0x1.7e9214p-32f, 0x1.1eed8ep-30f, -0x1.3b9eeap-29f, 0x1.07046ep-28f, -0x1.522a44p-28f, 0x1.522a44p-28f, -0x1.07046ep-28f, 0x1.3b9eeap-29f, -0x1.1eed8ep-30f, 0x1.7e9214p-32f, -0x1.612462p-34f, 0x1.93974ap-37f, -0x1.ae7f3ep-41f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 17 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.ae7f3ep-45f, 0x0p+0f,
+	0x1.ae7f3ep-45f, 0x1.ae7f3ep-41f, 0x1.93974ap-38f, 0x1.d6db2cp-36f, 0x1.7e9214p-34f, 0x1.cb15b2p-33f, 0x1.a4d3e2p-32f, 0x1.2c9758p-31f, 0x1.522a44p-31f, 0x1.2c9758p-31f, 0x1.a4d3e2p-32f, 0x1.cb15b2p-33f, 0x1.7e9214p-34f, 0x1.d6db2cp-36f, 0x1.93974ap-38f, 0x1.ae7f3ep-41f, -0x1.ae7f3ep-41f, 0x0p+0f,
+	0x1.ae62a8p-29f, 0x1.ae4612p-26f, 0x1.932c16p-24f, 0x1.d5e108p-23f, 0x1.7cfb98p-22f, 0x1.c74624p-22f, 0x1.9dd75ep-22f, 0x1.229c52p-22f, 0x1.3bb576p-23f, 0x1.04ab4p-24f, 0x1.350b9ap-26f, 0x1.ae6456p-29f, -0x1.7e9214p-34f, -0x1.08db48p-32f, -0x1.47eaecp-34f, -0x1.93974ap-37f, 0x1.93974ap-38f, 0x0p+0f,
+	0x1.0cfe9ep-19f, 0x1.61e5aep-17f, 0x1.b17252p-16f, 0x1.46b90ep-15f, 0x1.511446p-15f, 0x1.f2ff04p-16f, 0x1.0c4376p-16f, 0x1.97d87ap-18f, 0x1.8334a6p-20f, 0x1.5935dp-24f, -0x1.6e9492p-24f, -0x1.27e4fcp-25f, -0x1.48c58ap-28f, 0x1.8d48eep-31f, 0x1.e59206p-32f, 0x1.612462p-34f, -0x1.d6db2cp-36f, 0x0p+0f,
+	0x1.660a5cp-13f, 0x1.4e7bd2p-11f, 0x1.1cb0b8p-10f, 0x1.208084p-10f, 0x1.7a7dp-11f, 0x1.3fbfe6p-12f, 0x1.264ce4p-14f, -0x1.01f422p-19f, -0x1.e9c948p-18f, -0x1.2a7686p-19f, -0x1.c0c5f4p-24f, 0x1.fa9b7p-24f, 0x1.1833fep-25f, 0x1.7e9214p-32f, -0x1.ae6456p-30f, -0x1.7e9214p-32f, 0x1.7e9214p-34f, 0x0p+0f,
+	0x1.0b71aep-8f, 0x1.63a7a6p-7f, 0x1.9999a2p-7f, 0x1.fea202p-8f, 0x1.440acap-9f, 0x1.8cfe56p-15f, -0x1.22575ap-12f, -0x1.8af214p-14f, -0x1.dd5c6ap-20f, 0x1.c5dbe4p-18f, 0x1.9aa804p-20f, -0x1.13b848p-23f, -0x1.c46f42p-24f, -0x1.42cb4p-27f, 0x1.f61fbap-29f, 0x1.1eed8ep-30f, -0x1.cb15b2p-33f, 0x0p+0f,
+	0x1.3239b6p-5f, 0x1.12d016p-4f, 0x1.731704p-5f, 0x1.454a8cp-7f, -0x1.f078eap-9f, -0x1.549ca2p-9f, -0x1.0b1654p-12f, 0x1.9604dcp-13f, 0x1.e27432p-15f, -0x1.3e3d9cp-18f, -0x1.27680cp-18f, -0x1.2f4ab4p-22f, 0x1.ad753cp-23f, 0x1.27e4fcp-25f, -0x1.8a86a4p-28f, -0x1.3b9eeap-29f, 0x1.a4d3e2p-32f, 0x0p+0f,
+	0x1.39f5d6p-3f, 0x1.46b696p-3f, 0x1.c858e2p-6f, -0x1.be241ap-6f, -0x1.724258p-7f, 0x1.8b5d52p-10f, 0x1.82e404p-10f, 0x1.9a931ep-15f, -0x1.dc959cp-14f, -0x1.df28b2p-17f, 0x1.9033dp-18f, 0x1.4ff6a8p-20f, -0x1.dec61p-23f, -0x1.385542p-24f, 0x1.8a86a4p-28f, 0x1.07046ep-28f, -0x1.2c9758p-31f, 0x0p+0f,
+	0x1.3862dp-2f, 0x1.aa76a8p-4f, -0x1.6362e2p-4f, -0x1.0ce164p-5f, 0x1.846202p-7f, 0x1.4ba24p-8f, -0x1.0e385ap-10f, -0x1.0ac232p-11f, 0x1.0ac232p-14f, 0x1.3aecacp-15f, -0x1.87e7f2p-19f, -0x1.234568p-19f, 0x1.af8344p-24f, 0x1.bbd77ap-24f, -0x1.522a44p-29f, -0x1.522a44p-28f, 0x1.522a44p-31f, 0x0p+0f,
+	0x1.3862dp-2f, -0x1.aa76a8p-4f, -0x1.6362e2p-4f, 0x1.0ce164p-5f, 0x1.846202p-7f, -0x1.4ba24p-8f, -0x1.0e385ap-10f, 0x1.0ac232p-11f, 0x1.0ac232p-14f, -0x1.3aecacp-15f, -0x1.87e7f2p-19f, 0x1.234568p-19f, 0x1.af8344p-24f, -0x1.bbd77ap-24f, -0x1.522a44p-29f, 0x1.522a44p-28f, -0x1.2c9758p-31f, 0x0p+0f,
+	0x1.39f5d6p-3f, -0x1.46b696p-3f, 0x1.c858e2p-6f, 0x1.be241ap-6f, -0x1.724258p-7f, -0x1.8b5d52p-10f, 0x1.82e404p-10f, -0x1.9a931ep-15f, -0x1.dc959cp-14f, 0x1.df28b2p-17f, 0x1.9033dp-18f, -0x1.4ff6a8p-20f, -0x1.dec61p-23f, 0x1.385542p-24f, 0x1.8a86a4p-28f, -0x1.07046ep-28f, 0x1.a4d3e2p-32f, 0x0p+0f,
+	0x1.3239b6p-5f, -0x1.12d016p-4f, 0x1.731704p-5f, -0x1.454a8cp-7f, -0x1.f078eap-9f, 0x1.549ca2p-9f, -0x1.0b1654p-12f, -0x1.9604dcp-13f, 0x1.e27432p-15f, 0x1.3e3d9cp-18f, -0x1.27680cp-18f, 0x1.2f4ab4p-22f, 0x1.ad753cp-23f, -0x1.27e4fcp-25f, -0x1.8a86a4p-28f, 0x1.3b9eeap-29f, -0x1.cb15b2p-33f, 0x0p+0f,
+	0x1.0b71aep-8f, -0x1.63a7a6p-7f, 0x1.9999a2p-7f, -0x1.fea202p-8f, 0x1.440acap-9f, -0x1.8cfe56p-15f, -0x1.22575ap-12f, 0x1.8af214p-14f, -0x1.dd5c6ap-20f, -0x1.c5dbe4p-18f, 0x1.9aa804p-20f, 0x1.13b848p-23f, -0x1.c46f42p-24f, 0x1.42cb4p-27f, 0x1.f61fbap-29f, -0x1.1eed8ep-30f, 0x1.7e9214p-34f, 0x0p+0f,
+	0x1.660a5cp-13f, -0x1.4e7bd2p-11f, 0x1.1cb0b8p-10f, -0x1.208084p-10f, 0x1.7a7dp-11f, -0x1.3fbfe6p-12f, 0x1.264ce4p-14f, 0x1.01f422p-19f, -0x1.e9c948p-18f, 0x1.2a7686p-19f, -0x1.c0c5f4p-24f, -0x1.fa9b7p-24f, 0x1.1833fep-25f, -0x1.7e9214p-32f, -0x1.ae6456p-30f, 0x1.7e9214p-32f, -0x1.d6db2cp-36f, 0x0p+0f,
+	0x1.0cfe9ep-19f, -0x1.61e5aep-17f, 0x1.b17252p-16f, -0x1.46b90ep-15f, 0x1.511446p-15f, -0x1.f2ff04p-16f, 0x1.0c4376p-16f, -0x1.97d87ap-18f, 0x1.8334a6p-20f, -0x1.5935dp-24f, -0x1.6e9492p-24f, 0x1.27e4fcp-25f, -0x1.48c58ap-28f, -0x1.8d48eep-31f, 0x1.e59206p-32f, -0x1.612462p-34f, 0x1.93974ap-38f, 0x0p+0f,
+	0x1.ae62a8p-29f, -0x1.ae4612p-26f, 0x1.932c16p-24f, -0x1.d5e108p-23f, 0x1.7cfb98p-22f, -0x1.c74624p-22f, 0x1.9dd75ep-22f, -0x1.229c52p-22f, 0x1.3bb576p-23f, -0x1.04ab4p-24f, 0x1.350b9ap-26f, -0x1.ae6456p-29f, -0x1.7e9214p-34f, 0x1.08db48p-32f, -0x1.47eaecp-34f, 0x1.93974ap-37f, -0x1.ae7f3ep-41f, 0x0p+0f,
+	0x1.ae7f3ep-45f, -0x1.ae7f3ep-41f, 0x1.93974ap-38f, -0x1.d6db2cp-36f, 0x1.7e9214p-34f, -0x1.cb15b2p-33f, 0x1.a4d3e2p-32f, -0x1.2c9758p-31f, 0x1.522a44p-31f, -0x1.2c9758p-31f, 0x1.a4d3e2p-32f, -0x1.cb15b2p-33f, 0x1.7e9214p-34f, -0x1.d6db2cp-36f, 0x1.93974ap-38f, -0x1.ae7f3ep-41f, 0x1.ae7f3ep-45f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 18 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.952c78p-49f, 0x0p+0f,
+	0x1.952c78p-49f, 0x1.ae7f3ep-45f, 0x1.ae7f3ep-42f, 0x1.0d0f88p-39f, 0x1.d6db2cp-38f, 0x1.320e76p-36f, 0x1.320e76p-35f, 0x1.e0f228p-35f, 0x1.2c9758p-34f, 0x1.2c9758p-34f, 0x1.e0f228p-35f, 0x1.320e76p-35f, 0x1.320e76p-36f, 0x1.d6db2cp-38f, 0x1.0d0f88p-39f, 0x1.ae7f3ep-42f, 0x1.ae7f3ep-45f, -0x1.ae7f3ep-45f, 0x0p+0f,
+	0x1.951e38p-32f, 0x1.ae60fap-29f, 0x1.ae42b4p-27f, 0x1.0cc3dap-25f, 0x1.d5d252p-25f, 0x1.30b626p-24f, 0x1.2f5dd6p-24f, 0x1.d87de6p-25f, 0x1.220606p-25f, 0x1.1774b4p-26f, 0x1.9d501ap-28f, 0x1.b7f4cap-30f, 0x1.0bcca8p-32f, -0x1.d6db2cp-37f, -0x1.505368p-36f, -0x1.78af56p-38f, -0x1.ae7f3ep-41f, 0x1.ae7f3ep-42f, 0x0p+0f,
+	0x1.7eb952p-22f, 0x1.0c9306p-19f, 0x1.610e8cp-18f, 0x1.1fea1ap-17f, 0x1.44e32cp-17f, 0x1.0b484p-17f, 0x1.47ebf2p-18f, 0x1.2b3266p-19f, 0x1.85aeb4p-21f, 0x1.351aa2p-23f, 0x1.0e8836p-29f, -0x1.42cb4p-27f, -0x1.ae6456p-29f, -0x1.8d48eep-32f, 0x1.2eb178p-34f, 0x1.2eb178p-35f, 0x1.93974ap-38f, -0x1.0d0f88p-39f, 0x0p+0f,
+	0x1.5ed318p-15f, 0x1.61d662p-13f, 0x1.48f43cp-12f, 0x1.728e94p-12f, 0x1.164abcp-12f, 0x1.1defcap-13f, 0x1.80bff2p-15f, 0x1.03b252p-17f, -0x1.0c6944p-20f, -0x1.04b4a4p-20f, -0x1.eecd22p-23f, -0x1.de3698p-30f, 0x1.b45e9ep-27f, 0x1.8b7212p-29f, -0x1.d6db2cp-36f, -0x1.2648fcp-33f, -0x1.d6db2cp-36f, 0x1.d6db2cp-38f, 0x0p+0f,
+	0x1.5cdd52p-10f, 0x1.00415cp-8f, 0x1.4ebfe8p-8f, 0x1.f2af64p-9f, 0x1.b681e2p-10f, 0x1.6f1278p-12f, -0x1.682acep-15f, -0x1.9fe784p-15f, -0x1.82e274p-17f, 0x1.49490cp-21f, 0x1.e278ecp-21f, 0x1.3f0ed4p-23f, -0x1.60aeaap-26f, -0x1.6ca33cp-27f, -0x1.7e9214p-31f, 0x1.7e9214p-32f, 0x1.7e9214p-34f, -0x1.320e76p-36f, 0x0p+0f,
+	0x1.075aeap-6f, 0x1.10cb8p-5f, 0x1.ccb644p-6f, 0x1.6640dp-7f, 0x1.17e62ap-11f, -0x1.4834aep-10f, -0x1.ce6b78p-12f, 0x1.a93758p-19f, 0x1.2dbef2p-15f, 0x1.ba1ba2p-18f, -0x1.34d7p-20f, -0x1.21817ep-21f, -0x1.b926d8p-27f, 0x1.937e12p-26f, 0x1.ae6456p-29f, -0x1.585046p-31f, -0x1.cb15b2p-33f, 0x1.320e76p-35f, 0x0p+0f,
+	0x1.65a0e4p-4f, 0x1.daced2p-4f, 0x1.7a9d16p-5f, -0x1.7d1c34p-8f, -0x1.3064bp-7f, -0x1.89d362p-10f, 0x1.66dcdcp-11f, 0x1.033c58p-12f, -0x1.2f6014p-16f, -0x1.3f06fcp-16f, -0x1.0007eap-20f, 0x1.f9e5b8p-21f, 0x1.128638p-23f, -0x1.1774b4p-25f, -0x1.07046ep-27f, 0x1.a4d3e2p-31f, 0x1.a4d3e2p-32f, -0x1.e0f228p-35f, 0x0p+0f,
+	0x1.deb16p-3f, 0x1.36cfc8p-3f, -0x1.c5ed06p-6f, -0x1.38fb66p-5f, -0x1.6e7ab6p-10f, 0x1.2f74fp-8f, 0x1.3663e4p-11f, -0x1.777decp-12f, -0x1.246b64p-14f, 0x1.4a5feap-16f, 0x1.5bc57ap-18f, -0x1.b1914cp-21f, -0x1.322b28p-22f, 0x1.ab6732p-26f, 0x1.b0199p-27f, -0x1.2c9758p-31f, -0x1.2c9758p-31f, 0x1.2c9758p-34f, 0x0p+0f,
+	0x1.4ac2fap-2f, 0x0p+0f, -0x1.aa76a8p-4f, 0x0p+0f, 0x1.0ce164p-6f, 0x0p+0f, -0x1.ba2daap-10f, 0x0p+0f, 0x1.0ac232p-13f, 0x0p+0f, -0x1.f7e114p-18f, 0x0p+0f, 0x1.845c8ap-22f, 0x0p+0f, -0x1.fb3f66p-27f, 0x0p+0f, 0x1.522a44p-31f, -0x1.2c9758p-34f, 0x0p+0f,
+	0x1.deb16p-3f, -0x1.36cfc8p-3f, -0x1.c5ed06p-6f, 0x1.38fb66p-5f, -0x1.6e7ab6p-10f, -0x1.2f74fp-8f, 0x1.3663e4p-11f, 0x1.777decp-12f, -0x1.246b64p-14f, -0x1.4a5feap-16f, 0x1.5bc57ap-18f, 0x1.b1914cp-21f, -0x1.322b28p-22f, -0x1.ab6732p-26f, 0x1.b0199p-27f, 0x1.2c9758p-31f, -0x1.2c9758p-31f, 0x1.e0f228p-35f, 0x0p+0f,
+	0x1.65a0e4p-4f, -0x1.daced2p-4f, 0x1.7a9d16p-5f, 0x1.7d1c34p-8f, -0x1.3064bp-7f, 0x1.89d362p-10f, 0x1.66dcdcp-11f, -0x1.033c58p-12f, -0x1.2f6014p-16f, 0x1.3f06fcp-16f, -0x1.0007eap-20f, -0x1.f9e5b8p-21f, 0x1.128638p-23f, 0x1.1774b4p-25f, -0x1.07046ep-27f, -0x1.a4d3e2p-31f, 0x1.a4d3e2p-32f, -0x1.320e76p-35f, 0x0p+0f,
+	0x1.075aeap-6f, -0x1.10cb8p-5f, 0x1.ccb644p-6f, -0x1.6640dp-7f, 0x1.17e62ap-11f, 0x1.4834aep-10f, -0x1.ce6b78p-12f, -0x1.a93758p-19f, 0x1.2dbef2p-15f, -0x1.ba1ba2p-18f, -0x1.34d7p-20f, 0x1.21817ep-21f, -0x1.b926d8p-27f, -0x1.937e12p-26f, 0x1.ae6456p-29f, 0x1.585046p-31f, -0x1.cb15b2p-33f, 0x1.320e76p-36f, 0x0p+0f,
+	0x1.5cdd52p-10f, -0x1.00415cp-8f, 0x1.4ebfe8p-8f, -0x1.f2af64p-9f, 0x1.b681e2p-10f, -0x1.6f1278p-12f, -0x1.682acep-15f, 0x1.9fe784p-15f, -0x1.82e274p-17f, -0x1.49490cp-21f, 0x1.e278ecp-21f, -0x1.3f0ed4p-23f, -0x1.60aeaap-26f, 0x1.6ca33cp-27f, -0x1.7e9214p-31f, -0x1.7e9214p-32f, 0x1.7e9214p-34f, -0x1.d6db2cp-38f, 0x0p+0f,
+	0x1.5ed318p-15f, -0x1.61d662p-13f, 0x1.48f43cp-12f, -0x1.728e94p-12f, 0x1.164abcp-12f, -0x1.1defcap-13f, 0x1.80bff2p-15f, -0x1.03b252p-17f, -0x1.0c6944p-20f, 0x1.04b4a4p-20f, -0x1.eecd22p-23f, 0x1.de3698p-30f, 0x1.b45e9ep-27f, -0x1.8b7212p-29f, -0x1.d6db2cp-36f, 0x1.2648fcp-33f, -0x1.d6db2cp-36f, 0x1.0d0f88p-39f, 0x0p+0f,
+	0x1.7eb952p-22f, -0x1.0c9306p-19f, 0x1.610e8cp-18f, -0x1.1fea1ap-17f, 0x1.44e32cp-17f, -0x1.0b484p-17f, 0x1.47ebf2p-18f, -0x1.2b3266p-19f, 0x1.85aeb4p-21f, -0x1.351aa2p-23f, 0x1.0e8836p-29f, 0x1.42cb4p-27f, -0x1.ae6456p-29f, 0x1.8d48eep-32f, 0x1.2eb178p-34f, -0x1.2eb178p-35f, 0x1.93974ap-38f, -0x1.ae7f3ep-42f, 0x0p+0f,
+	0x1.951e38p-32f, -0x1.ae60fap-29f, 0x1.ae42b4p-27f, -0x1.0cc3dap-25f, 0x1.d5d252p-25f, -0x1.30b626p-24f, 0x1.2f5dd6p-24f, -0x1.d87de6p-25f, 0x1.220606p-25f, -0x1.1774b4p-26f, 0x1.9d501ap-28f, -0x1.b7f4cap-30f, 0x1.0bcca8p-32f, 0x1.d6db2cp-37f, -0x1.505368p-36f, 0x1.78af56p-38f, -0x1.ae7f3ep-41f, 0x1.ae7f3ep-45f, 0x0p+0f,
+	0x1.952c78p-49f, -0x1.ae7f3ep-45f, 0x1.ae7f3ep-42f, -0x1.0d0f88p-39f, 0x1.d6db2cp-38f, -0x1.320e76p-36f, 0x1.320e76p-35f, -0x1.e0f228p-35f, 0x1.2c9758p-34f, -0x1.2c9758p-34f, 0x1.e0f228p-35f, -0x1.320e76p-35f, 0x1.320e76p-36f, -0x1.d6db2cp-38f, 0x1.0d0f88p-39f, -0x1.ae7f3ep-42f, 0x1.ae7f3ep-45f, -0x1.952c78p-49f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 19 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.682786p-53f, 0x0p+0f,
+	0x1.682786p-53f, 0x1.952c78p-49f, 0x1.ae7f3ep-46f, 0x1.1eff7ep-43f, 0x1.0d0f88p-41f, 0x1.78af56p-40f, 0x1.981348p-39f, 0x1.5dc762p-38f, 0x1.e0f228p-38f, 0x1.0b3132p-37f, 0x1.e0f228p-38f, 0x1.5dc762p-38f, 0x1.981348p-39f, 0x1.78af56p-40f, 0x1.0d0f88p-41f, 0x1.1eff7ep-43f, 0x1.ae7f3ep-46f, 0x1.952c78p-49f, -0x1.952c78p-49f, 0x0p+0f,
+	0x1.6820d8p-35f, 0x1.951d6ep-32f, 0x1.ae5f4cp-30f, 0x1.1ed4e6p-28f, 0x1.0cbfa6p-27f, 0x1.77cfaep-27f, 0x1.962eb2p-27f, 0x1.5a88aap-27f, 0x1.d805aap-28f, 0x1.0146ep-28f, 0x1.bd402ep-30f, 0x1.29dbcap-31f, 0x1.1eed8ep-33f, 0x1.320e76p-36f, -0x1.93974ap-40f, -0x1.8a9f4ep-40f, -0x1.93974ap-42f, -0x1.ae7f3ep-45f, 0x1.ae7f3ep-46f, 0x0p+0f,
+	0x1.008e52p-24f, 0x1.7e540ap-22f, 0x1.0c276ep-20f, 0x1.d59f38p-20f, 0x1.1edd56p-19f, 0x1.027116p-19f, 0x1.6133c4p-20f, 0x1.7159b2p-21f, 0x1.23d06ep-22f, 0x1.4a45ap-24f, 0x1.b6acep-27f, -0x1.946e8ap-32f, -0x1.f7b7cep-31f, -0x1.1d74ep-32f, -0x1.b5393cp-36f, 0x1.9c8f46p-38f, 0x1.5dc762p-39f, 0x1.ae7f3ep-42f, -0x1.1eff7ep-43f, 0x0p+0f,
+	0x1.41cf94p-17f, 0x1.5bd5a6p-15f, 0x1.5da416p-14f, 0x1.af4002p-14f, 0x1.698f42p-14f, 0x1.ad05dp-15f, 0x1.66f9b2p-16f, 0x1.88de3ap-18f, 0x1.71cb7p-21f, -0x1.9bc7aap-23f, -0x1.def326p-24f, -0x1.6aee02p-26f, 0x1.5eb092p-31f, 0x1.4ebfd2p-30f, 0x1.fcb15cp-33f, -0x1.c06f36p-38f, -0x1.71f55ap-37f, -0x1.0d0f88p-39f, 0x1.0d0f88p-41f, 0x0p+0f,
+	0x1.a5bc36p-12f, 0x1.51e6bap-10f, 0x1.ea655p-10f, 0x1.a2eb86p-10f, 0x1.c45d9p-11f, 0x1.2725c2p-12f, 0x1.2ace1ap-15f, -0x1.a9aab6p-17f, -0x1.e0d418p-18f, -0x1.3a12eep-20f, 0x1.544754p-23f, 0x1.b8da56p-24f, 0x1.ae6456p-27f, -0x1.5f4d86p-29f, -0x1.08db48p-30f, -0x1.88615p-35f, 0x1.08db48p-35f, 0x1.d6db2cp-38f, -0x1.78af56p-40f, 0x0p+0f,
+	0x1.9e212ep-8f, 0x1.e31a2ap-7f, 0x1.e186aap-7f, 0x1.f6b30cp-8f, 0x1.d329ecp-10f, -0x1.ddb146p-13f, -0x1.17fb88p-12f, -0x1.dd07p-15f, 0x1.ba7afap-18f, 0x1.623164p-18f, 0x1.40c2p-21f, -0x1.900e28p-23f, -0x1.ec5c44p-25f, 0x1.452f5ep-31f, 0x1.4ebfd2p-29f, 0x1.188d42p-32f, -0x1.0bcca8p-34f, -0x1.320e76p-36f, 0x1.981348p-39f, 0x0p+0f,
+	0x1.6df0c6p-5f, 0x1.23ca2ap-4f, 0x1.526912p-5f, 0x1.8b5a88p-8f, -0x1.126774p-8f, -0x1.018276p-9f, -0x1.5df916p-15f, 0x1.512f32p-13f, 0x1.ffd3d2p-16f, -0x1.930d52p-18f, -0x1.57a4b6p-19f, 0x1.334084p-26f, 0x1.092268p-23f, 0x1.73cf92p-27f, -0x1.12f8fep-28f, -0x1.8b52aep-31f, 0x1.7e9214p-34f, 0x1.320e76p-35f, -0x1.5dc762p-38f, 0x0p+0f,
+	0x1.42071ap-3f, 0x1.2be0eep-3f, 0x1.25a17ap-6f, -0x1.93b7bap-6f, -0x1.0957ep-7f, 0x1.9dbbc2p-10f, 0x1.0bf13p-10f, -0x1.bb2d74p-17f, -0x1.3d5d22p-14f, -0x1.8105fep-18f, 0x1.03c2c2p-18f, 0x1.2b79cap-21f, -0x1.3927acp-23f, -0x1.10e166p-25f, 0x1.19cde4p-28f, 0x1.72baaap-30f, -0x1.68b59ep-34f, -0x1.e0f228p-35f, 0x1.e0f228p-38f, 0x0p+0f,
+	0x1.2a59dep-2f, 0x1.6da928p-4f, -0x1.36cfc8p-4f, -0x1.a14f34p-6f, 0x1.38fb66p-7f, 0x1.d2db4ap-9f, -0x1.949becp-11f, -0x1.555b34p-12f, 0x1.777decp-15f, 0x1.6f153cp-16f, -0x1.084cbcp-19f, -0x1.35b0eep-20f, 0x1.210b88p-24f, 0x1.ab6732p-25f, -0x1.e875fp-30f, -0x1.f4fc3ep-30f, 0x1.2c9758p-35f, 0x1.2c9758p-34f, -0x1.0b3132p-37f, 0x0p+0f,
+	0x1.2a59dep-2f, -0x1.6da928p-4f, -0x1.36cfc8p-4f, 0x1.a14f34p-6f, 0x1.38fb66p-7f, -0x1.d2db4ap-9f, -0x1.949becp-11f, 0x1.555b34p-12f, 0x1.777decp-15f, -0x1.6f153cp-16f, -0x1.084cbcp-19f, 0x1.35b0eep-20f, 0x1.210b88p-24f, -0x1.ab6732p-25f, -0x1.e875fp-30f, 0x1.f4fc3ep-30f, 0x1.2c9758p-35f, -0x1.2c9758p-34f, 0x1.e0f228p-38f, 0x0p+0f,
+	0x1.42071ap-3f, -0x1.2be0eep-3f, 0x1.25a17ap-6f, 0x1.93b7bap-6f, -0x1.0957ep-7f, -0x1.9dbbc2p-10f, 0x1.0bf13p-10f, 0x1.bb2d74p-17f, -0x1.3d5d22p-14f, 0x1.8105fep-18f, 0x1.03c2c2p-18f, -0x1.2b79cap-21f, -0x1.3927acp-23f, 0x1.10e166p-25f, 0x1.19cde4p-28f, -0x1.72baaap-30f, -0x1.68b59ep-34f, 0x1.e0f228p-35f, -0x1.5dc762p-38f, 0x0p+0f,
+	0x1.6df0c6p-5f, -0x1.23ca2ap-4f, 0x1.526912p-5f, -0x1.8b5a88p-8f, -0x1.126774p-8f, 0x1.018276p-9f, -0x1.5df916p-15f, -0x1.512f32p-13f, 0x1.ffd3d2p-16f, 0x1.930d52p-18f, -0x1.57a4b6p-19f, -0x1.334084p-26f, 0x1.092268p-23f, -0x1.73cf92p-27f, -0x1.12f8fep-28f, 0x1.8b52aep-31f, 0x1.7e9214p-34f, -0x1.320e76p-35f, 0x1.981348p-39f, 0x0p+0f,
+	0x1.9e212ep-8f, -0x1.e31a2ap-7f, 0x1.e186aap-7f, -0x1.f6b30cp-8f, 0x1.d329ecp-10f, 0x1.ddb146p-13f, -0x1.17fb88p-12f, 0x1.dd07p-15f, 0x1.ba7afap-18f, -0x1.623164p-18f, 0x1.40c2p-21f, 0x1.900e28p-23f, -0x1.ec5c44p-25f, -0x1.452f5ep-31f, 0x1.4ebfd2p-29f, -0x1.188d42p-32f, -0x1.0bcca8p-34f, 0x1.320e76p-36f, -0x1.78af56p-40f, 0x0p+0f,
+	0x1.a5bc36p-12f, -0x1.51e6bap-10f, 0x1.ea655p-10f, -0x1.a2eb86p-10f, 0x1.c45d9p-11f, -0x1.2725c2p-12f, 0x1.2ace1ap-15f, 0x1.a9aab6p-17f, -0x1.e0d418p-18f, 0x1.3a12eep-20f, 0x1.544754p-23f, -0x1.b8da56p-24f, 0x1.ae6456p-27f, 0x1.5f4d86p-29f, -0x1.08db48p-30f, 0x1.88615p-35f, 0x1.08db48p-35f, -0x1.d6db2cp-38f, 0x1.0d0f88p-41f, 0x0p+0f,
+	0x1.41cf94p-17f, -0x1.5bd5a6p-15f, 0x1.5da416p-14f, -0x1.af4002p-14f, 0x1.698f42p-14f, -0x1.ad05dp-15f, 0x1.66f9b2p-16f, -0x1.88de3ap-18f, 0x1.71cb7p-21f, 0x1.9bc7aap-23f, -0x1.def326p-24f, 0x1.6aee02p-26f, 0x1.5eb092p-31f, -0x1.4ebfd2p-30f, 0x1.fcb15cp-33f, 0x1.c06f36p-38f, -0x1.71f55ap-37f, 0x1.0d0f88p-39f, -0x1.1eff7ep-43f, 0x0p+0f,
+	0x1.008e52p-24f, -0x1.7e540ap-22f, 0x1.0c276ep-20f, -0x1.d59f38p-20f, 0x1.1edd56p-19f, -0x1.027116p-19f, 0x1.6133c4p-20f, -0x1.7159b2p-21f, 0x1.23d06ep-22f, -0x1.4a45ap-24f, 0x1.b6acep-27f, 0x1.946e8ap-32f, -0x1.f7b7cep-31f, 0x1.1d74ep-32f, -0x1.b5393cp-36f, -0x1.9c8f46p-38f, 0x1.5dc762p-39f, -0x1.ae7f3ep-42f, 0x1.ae7f3ep-46f, 0x0p+0f,
+	0x1.6820d8p-35f, -0x1.951d6ep-32f, 0x1.ae5f4cp-30f, -0x1.1ed4e6p-28f, 0x1.0cbfa6p-27f, -0x1.77cfaep-27f, 0x1.962eb2p-27f, -0x1.5a88aap-27f, 0x1.d805aap-28f, -0x1.0146ep-28f, 0x1.bd402ep-30f, -0x1.29dbcap-31f, 0x1.1eed8ep-33f, -0x1.320e76p-36f, -0x1.93974ap-40f, 0x1.8a9f4ep-40f, -0x1.93974ap-42f, 0x1.ae7f3ep-45f, -0x1.952c78p-49f, 0x0p+0f,
+	0x1.682786p-53f, -0x1.952c78p-49f, 0x1.ae7f3ep-46f, -0x1.1eff7ep-43f, 0x1.0d0f88p-41f, -0x1.78af56p-40f, 0x1.981348p-39f, -0x1.5dc762p-38f, 0x1.e0f228p-38f, -0x1.0b3132p-37f, 0x1.e0f228p-38f, -0x1.5dc762p-38f, 0x1.981348p-39f, -0x1.78af56p-40f, 0x1.0d0f88p-41f, -0x1.1eff7ep-43f, 0x1.ae7f3ep-46f, -0x1.952c78p-49f, 0x1.682786p-53f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 20 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.2f49b4p-57f, 0x0p+0f,
+	0x1.2f49b4p-57f, 0x1.682786p-53f, 0x1.952c78p-50f, 0x1.1eff7ep-47f, 0x1.1eff7ep-45f, 0x1.ae7f3ep-44f, 0x1.f63f1ep-43f, 0x1.d25f2ep-42f, 0x1.5dc762p-41f, 0x1.ab81eap-41f, 0x1.ab81eap-41f, 0x1.5dc762p-41f, 0x1.d25f2ep-42f, 0x1.f63f1ep-43f, 0x1.ae7f3ep-44f, 0x1.1eff7ep-45f, 0x1.1eff7ep-47f, 0x1.952c78p-50f, 0x1.682786p-53f, -0x1.682786p-53f, 0x0p+0f,
+	0x1.2f46bep-38f, 0x1.68207ep-35f, 0x1.951ca4p-33f, 0x1.1ee914p-31f, 0x1.1ed2a8p-30f, 0x1.adf8b6p-30f, 0x1.f50536p-30f, 0x1.d01838p-30f, 0x1.5a5cfp-30f, 0x1.a3286p-31f, 0x1.9aced8p-32f, 0x1.4273dp-33f, 0x1.89805p-35f, 0x1.594b64p-37f, 0x1.42df6ep-40f, -0x1.1eff7ep-43f, -0x1.ae7f3ep-44f, -0x1.952c78p-46f, -0x1.952c78p-49f, 0x1.952c78p-50f, 0x0p+0f,
+	0x1.45544ep-27f, 0x1.00614ep-24f, 0x1.7deec4p-23f, 0x1.64fa72p-22f, 0x1.d48064p-22f, 0x1.c94dbcp-22f, 0x1.56a1b2p-22f, 0x1.900876p-23f, 0x1.6bef9p-24f, 0x1.f9ab46p-26f, 0x1.f6b51cp-28f, 0x1.168f2ap-30f, -0x1.4d620ap-34f, -0x1.621f8p-34f, -0x1.5c18e4p-36f, -0x1.b7773ap-40f, 0x1.ff371ap-42f, 0x1.78af56p-43f, 0x1.ae7f3ep-46f, -0x1.1eff7ep-47f, 0x0p+0f,
+	0x1.15c006p-19f, 0x1.3fce76p-17f, 0x1.58d8fep-16f, 0x1.cc99f6p-16f, 0x1.a7e986p-16f, 0x1.1a137ap-16f, 0x1.133f2ap-17f, 0x1.810762p-19f, 0x1.5ab304p-21f, 0x1.8e05bcp-25f, -0x1.cd8862p-26f, -0x1.8434eap-27f, -0x1.db7b0ap-30f, 0x1.06e50ap-33f, 0x1.d0213p-34f, 0x1.2c7378p-36f, -0x1.ae7f3ep-41f, -0x1.ae7f3ep-41f, -0x1.1eff7ep-43f, 0x1.1eff7ep-45f, 0x0p+0f,
+	0x1.dbb08p-14f, 0x1.9badbap-12f, 0x1.47080cp-11f, 0x1.385cb4p-11f, 0x1.87f786p-12f, 0x1.45bc86p-13f, 0x1.4206b6p-15f, 0x1.10b9b6p-19f, -0x1.370ceap-19f, -0x1.d47dcep-21f, -0x1.a4298ep-24f, 0x1.a5a392p-26f, 0x1.6263e4p-27f, 0x1.f6bcaep-31f, -0x1.28631ap-32f, -0x1.5e56e2p-34f, -0x1.505368p-39f, 0x1.505368p-39f, 0x1.0d0f88p-41f, -0x1.ae7f3ep-44f, 0x0p+0f,
+	0x1.2c664ap-9f, 0x1.83c56ap-8f, 0x1.b8dd54p-8f, 0x1.1826aap-8f, 0x1.8df82ap-10f, 0x1.8191d4p-13f, -0x1.63feeep-14f, -0x1.6aaaap-15f, -0x1.729c52p-18f, 0x1.9a5c08p-20f, 0x1.5a2b4cp-21f, 0x1.56d1b4p-25f, -0x1.9da78cp-26f, -0x1.713486p-28f, 0x1.ee6622p-33f, 0x1.f252ap-33f, 0x1.49996cp-36f, -0x1.78af56p-38f, -0x1.78af56p-40f, 0x1.f63f1ep-43f, 0x0p+0f,
+	0x1.547a76p-6f, 0x1.3a2cap-5f, 0x1.cecdc8p-6f, 0x1.22b48ap-7f, -0x1.ad620ep-12f, -0x1.38f4cp-10f, -0x1.2f89d6p-12f, 0x1.0dfbe2p-15f, 0x1.c870f2p-16f, 0x1.64a0f6p-19f, -0x1.2ee5e2p-20f, -0x1.343df8p-22f, 0x1.244edp-26f, 0x1.ddd094p-27f, 0x1.91b2fcp-31f, -0x1.d7d64cp-32f, -0x1.0bcca8p-34f, 0x1.320e76p-37f, 0x1.981348p-39f, -0x1.d25f2ep-42f, 0x0p+0f,
+	0x1.82bdcep-4f, 0x1.cd15d2p-4f, 0x1.33f7b2p-5f, -0x1.feeb9p-8f, -0x1.f68e5ep-8f, -0x1.9a0d46p-11f, 0x1.35958ep-11f, 0x1.3eb7f8p-13f, -0x1.6ce20ap-16f, -0x1.8bd73p-17f, 0x1.cd8862p-26f, 0x1.39e0dp-21f, 0x1.827fb2p-25f, -0x1.63ded2p-26f, -0x1.a21854p-29f, 0x1.28f29ap-31f, 0x1.1c32p-33f, -0x1.5dc762p-37f, -0x1.5dc762p-38f, 0x1.5dc762p-41f, 0x0p+0f,
+	0x1.d515e2p-3f, 0x1.12aca2p-3f, -0x1.d43168p-6f, -0x1.00256ep-5f, -0x1.b2ef0cp-13f, 0x1.cea906p-9f, 0x1.5aa738p-12f, -0x1.0cb66p-12f, -0x1.4781c8p-15f, 0x1.c0fc88p-17f, 0x1.72abcap-19f, -0x1.1d06a2p-21f, -0x1.324936p-23f, 0x1.19a5dp-26f, 0x1.90297cp-28f, -0x1.aed8eep-32f, -0x1.b3db74p-33f, 0x1.e0f228p-38f, 0x1.e0f228p-38f, -0x1.ab81eap-41f, 0x0p+0f,
+	0x1.3a0dc2p-2f, 0x0p+0f, -0x1.6da928p-4f, 0x0p+0f, 0x1.a14f34p-7f, 0x0p+0f, -0x1.373cdcp-10f, 0x0p+0f, 0x1.555b34p-14f, 0x0p+0f, -0x1.25aa96p-18f, 0x0p+0f, 0x1.9cebe8p-23f, 0x0p+0f, -0x1.e875fp-28f, 0x0p+0f, 0x1.f4fc3ep-33f, 0x0p+0f, -0x1.0b3132p-37f, 0x1.ab81eap-41f, 0x0p+0f,
+	0x1.d515e2p-3f, -0x1.12aca2p-3f, -0x1.d43168p-6f, 0x1.00256ep-5f, -0x1.b2ef0cp-13f, -0x1.cea906p-9f, 0x1.5aa738p-12f, 0x1.0cb66p-12f, -0x1.4781c8p-15f, -0x1.c0fc88p-17f, 0x1.72abcap-19f, 0x1.1d06a2p-21f, -0x1.324936p-23f, -0x1.19a5dp-26f, 0x1.90297cp-28f, 0x1.aed8eep-32f, -0x1.b3db74p-33f, -0x1.e0f228p-38f, 0x1.e0f228p-38f, -0x1.5dc762p-41f, 0x0p+0f,
+	0x1.82bdcep-4f, -0x1.cd15d2p-4f, 0x1.33f7b2p-5f, 0x1.feeb9p-8f, -0x1.f68e5ep-8f, 0x1.9a0d46p-11f, 0x1.35958ep-11f, -0x1.3eb7f8p-13f, -0x1.6ce20ap-16f, 0x1.8bd73p-17f, 0x1.cd8862p-26f, -0x1.39e0dp-21f, 0x1.827fb2p-25f, 0x1.63ded2p-26f, -0x1.a21854p-29f, -0x1.28f29ap-31f, 0x1.1c32p-33f, 0x1.5dc762p-37f, -0x1.5dc762p-38f, 0x1.d25f2ep-42f, 0x0p+0f,
+	0x1.547a76p-6f, -0x1.3a2cap-5f, 0x1.cecdc8p-6f, -0x1.22b48ap-7f, -0x1.ad620ep-12f, 0x1.38f4cp-10f, -0x1.2f89d6p-12f, -0x1.0dfbe2p-15f, 0x1.c870f2p-16f, -0x1.64a0f6p-19f, -0x1.2ee5e2p-20f, 0x1.343df8p-22f, 0x1.244edp-26f, -0x1.ddd094p-27f, 0x1.91b2fcp-31f, 0x1.d7d64cp-32f, -0x1.0bcca8p-34f, -0x1.320e76p-37f, 0x1.981348p-39f, -0x1.f63f1ep-43f, 0x0p+0f,
+	0x1.2c664ap-9f, -0x1.83c56ap-8f, 0x1.b8dd54p-8f, -0x1.1826aap-8f, 0x1.8df82ap-10f, -0x1.8191d4p-13f, -0x1.63feeep-14f, 0x1.6aaaap-15f, -0x1.729c52p-18f, -0x1.9a5c08p-20f, 0x1.5a2b4cp-21f, -0x1.56d1b4p-25f, -0x1.9da78cp-26f, 0x1.713486p-28f, 0x1.ee6622p-33f, -0x1.f252ap-33f, 0x1.49996cp-36f, 0x1.78af56p-38f, -0x1.78af56p-40f, 0x1.ae7f3ep-44f, 0x0p+0f,
+	0x1.dbb08p-14f, -0x1.9badbap-12f, 0x1.47080cp-11f, -0x1.385cb4p-11f, 0x1.87f786p-12f, -0x1.45bc86p-13f, 0x1.4206b6p-15f, -0x1.10b9b6p-19f, -0x1.370ceap-19f, 0x1.d47dcep-21f, -0x1.a4298ep-24f, -0x1.a5a392p-26f, 0x1.6263e4p-27f, -0x1.f6bcaep-31f, -0x1.28631ap-32f, 0x1.5e56e2p-34f, -0x1.505368p-39f, -0x1.505368p-39f, 0x1.0d0f88p-41f, -0x1.1eff7ep-45f, 0x0p+0f,
+	0x1.15c006p-19f, -0x1.3fce76p-17f, 0x1.58d8fep-16f, -0x1.cc99f6p-16f, 0x1.a7e986p-16f, -0x1.1a137ap-16f, 0x1.133f2ap-17f, -0x1.810762p-19f, 0x1.5ab304p-21f, -0x1.8e05bcp-25f, -0x1.cd8862p-26f, 0x1.8434eap-27f, -0x1.db7b0ap-30f, -0x1.06e50ap-33f, 0x1.d0213p-34f, -0x1.2c7378p-36f, -0x1.ae7f3ep-41f, 0x1.ae7f3ep-41f, -0x1.1eff7ep-43f, 0x1.1eff7ep-47f, 0x0p+0f,
+	0x1.45544ep-27f, -0x1.00614ep-24f, 0x1.7deec4p-23f, -0x1.64fa72p-22f, 0x1.d48064p-22f, -0x1.c94dbcp-22f, 0x1.56a1b2p-22f, -0x1.900876p-23f, 0x1.6bef9p-24f, -0x1.f9ab46p-26f, 0x1.f6b51cp-28f, -0x1.168f2ap-30f, -0x1.4d620ap-34f, 0x1.621f8p-34f, -0x1.5c18e4p-36f, 0x1.b7773ap-40f, 0x1.ff371ap-42f, -0x1.78af56p-43f, 0x1.ae7f3ep-46f, -0x1.952c78p-50f, 0x0p+0f,
+	0x1.2f46bep-38f, -0x1.68207ep-35f, 0x1.951ca4p-33f, -0x1.1ee914p-31f, 0x1.1ed2a8p-30f, -0x1.adf8b6p-30f, 0x1.f50536p-30f, -0x1.d01838p-30f, 0x1.5a5cfp-30f, -0x1.a3286p-31f, 0x1.9aced8p-32f, -0x1.4273dp-33f, 0x1.89805p-35f, -0x1.594b64p-37f, 0x1.42df6ep-40f, 0x1.1eff7ep-43f, -0x1.ae7f3ep-44f, 0x1.952c78p-46f, -0x1.952c78p-49f, 0x1.682786p-53f, 0x0p+0f,
+	0x1.2f49b4p-57f, -0x1.682786p-53f, 0x1.952c78p-50f, -0x1.1eff7ep-47f, 0x1.1eff7ep-45f, -0x1.ae7f3ep-44f, 0x1.f63f1ep-43f, -0x1.d25f2ep-42f, 0x1.5dc762p-41f, -0x1.ab81eap-41f, 0x1.ab81eap-41f, -0x1.5dc762p-41f, 0x1.d25f2ep-42f, -0x1.f63f1ep-43f, 0x1.ae7f3ep-44f, -0x1.1eff7ep-45f, 0x1.1eff7ep-47f, -0x1.952c78p-50f, 0x1.682786p-53f, -0x1.2f49b4p-57f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 21 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.e542bap-62f, 0x0p+0f,
+	0x1.e542bap-62f, 0x1.2f49b4p-57f, 0x1.682786p-54f, 0x1.0e1da4p-51f, 0x1.1eff7ep-49f, 0x1.cb3264p-48f, 0x1.1eff7ep-46f, 0x1.1eff7ep-45f, 0x1.d25f2ep-45f, 0x1.36ea1ep-44f, 0x1.560188p-44f, 0x1.36ea1ep-44f, 0x1.d25f2ep-45f, 0x1.1eff7ep-45f, 0x1.1eff7ep-46f, 0x1.cb3264p-48f, 0x1.1eff7ep-49f, 0x1.0e1da4p-51f, 0x1.682786p-54f, 0x1.2f49b4p-57f, -0x1.2f49b4p-57f, 0x0p+0f,
+	0x1.e5403ep-42f, 0x1.2f4698p-38f, 0x1.682024p-36f, 0x1.0e129p-34f, 0x1.1ee7f4p-33f, 0x1.cae70ep-33f, 0x1.1ea154p-32f, 0x1.1e4328p-32f, 0x1.cffb12p-33f, 0x1.33b9f8p-33f, 0x1.4efep-34f, 0x1.2a2984p-35f, 0x1.ac1d6p-37f, 0x1.dfd328p-39f, 0x1.81a752p-41f, 0x1.3bb2a6p-44f, -0x1.66bf5ep-47f, -0x1.b6f02cp-48f, -0x1.7ea9fep-50f, -0x1.682786p-53f, 0x1.682786p-54f, 0x0p+0f,
+	0x1.87761ep-30f, 0x1.452e66p-27f, 0x1.00344ap-25f, 0x1.fcb75p-25f, 0x1.646afep-24f, 0x1.75e7a6p-24f, 0x1.2fbfd8p-24f, 0x1.8557ap-25f, 0x1.8c6846p-26f, 0x1.3eb018p-27f, 0x1.8a0e68p-29f, 0x1.5aeeaep-31f, 0x1.3dab96p-34f, -0x1.463c6ep-37f, -0x1.c60a34p-38f, -0x1.88d41cp-40f, -0x1.93974ap-44f, 0x1.2337f6p-45f, 0x1.7bd9bp-47f, 0x1.952c78p-50f, -0x1.0e1da4p-51f, 0x0p+0f,
+	0x1.c50aacp-22f, 0x1.147abp-19f, 0x1.3dcdb4p-18f, 0x1.c7d18p-18f, 0x1.c7060cp-18f, 0x1.4d4604p-18f, 0x1.6e9304p-19f, 0x1.2e54b2p-20f, 0x1.6806dap-22f, 0x1.0bbd66p-24f, 0x1.d099eep-30f, -0x1.ab0fcp-29f, -0x1.1a048ap-30f, -0x1.17c7f2p-33f, 0x1.f6ce9ep-37f, 0x1.25f2e2p-37f, 0x1.47eaecp-40f, -0x1.42df6ep-44f, -0x1.d25f2ep-45f, -0x1.1eff7ep-47f, 0x1.1eff7ep-49f, 0x0p+0f,
+	0x1.f776e6p-16f, 0x1.d3028p-14f, 0x1.91af46p-13f, 0x1.a5ac5ap-13f, 0x1.29f7e4p-13f, 0x1.2460bep-14f, 0x1.834d74p-16f, 0x1.216356p-18f, -0x1.c136aep-24f, -0x1.618898p-22f, -0x1.8ab1bap-24f, -0x1.bb50aap-28f, 0x1.9a7eaep-29f, 0x1.fd52ccp-31f, 0x1.f371ap-35f, -0x1.b7ea08p-36f, -0x1.a973cp-38f, -0x1.ae7f3ep-44f, 0x1.8a9f4ep-43f, 0x1.1eff7ep-45f, -0x1.cb3264p-48f, 0x0p+0f,
+	0x1.95134cp-11f, 0x1.1d88c6p-9f, 0x1.6a0a9p-9f, 0x1.0aa836p-9f, 0x1.e23628p-11f, 0x1.dff6dcp-13f, 0x1.3f1c44p-18f, -0x1.276f06p-16f, -0x1.7bb63ap-18f, -0x1.7e5fcp-22f, 0x1.01d792p-22f, 0x1.21f4b8p-24f, 0x1.5fffc6p-30f, -0x1.6b9988p-29f, -0x1.edc4b2p-32f, 0x1.21e9bp-35f, 0x1.50bf08p-36f, 0x1.5dc762p-40f, -0x1.e44f26p-42f, -0x1.ae7f3ep-44f, 0x1.1eff7ep-46f, 0x0p+0f,
+	0x1.22e7ap-7f, 0x1.2eedacp-6f, 0x1.09b3f4p-6f, 0x1.d61dfp-8f, 0x1.2d426cp-10f, -0x1.94408cp-12f, -0x1.e1894ep-13f, -0x1.ea603cp-16f, 0x1.3c534p-17f, 0x1.e8155cp-19f, 0x1.e4a304p-24f, -0x1.5a2b4cp-23f, -0x1.d4203ep-26f, 0x1.b27038p-29f, 0x1.7a8632p-30f, 0x1.28a3aep-35f, -0x1.687fcep-35f, -0x1.49996cp-38f, 0x1.b7773ap-41f, 0x1.f63f1ep-43f, -0x1.1eff7ep-45f, 0x0p+0f,
+	0x1.a40c72p-5f, 0x1.2d9f32p-4f, 0x1.2fff82p-5f, 0x1.98599ap-9f, -0x1.11152ap-8f, -0x1.7c9364p-10f, 0x1.1fd04cp-14f, 0x1.07a16ap-13f, 0x1.f672p-17f, -0x1.6d087p-18f, -0x1.83ff8cp-20f, 0x1.c3117ap-24f, 0x1.37ffdep-24f, 0x1.27cf2p-29f, -0x1.53df7ep-29f, -0x1.148b3ep-32f, 0x1.0a6eep-34f, 0x1.89805p-37f, -0x1.237b7cp-40f, -0x1.d25f2ep-42f, 0x1.d25f2ep-45f, 0x0p+0f,
+	0x1.471c64p-3f, 0x1.13b6fap-3f, 0x1.610dc6p-7f, -0x1.696044p-6f, -0x1.808ffap-8f, 0x1.872beap-10f, 0x1.78c83ap-11f, -0x1.37722ap-15f, -0x1.ac125cp-15f, -0x1.01e4eap-19f, 0x1.51ee4ap-19f, 0x1.0af4e4p-22f, -0x1.8f44f6p-24f, -0x1.efe3dcp-27f, 0x1.6c4bcap-29f, 0x1.44e96ap-31f, -0x1.002f88p-34f, -0x1.52d928p-36f, 0x1.06558ap-40f, 0x1.5dc762p-41f, -0x1.36ea1ep-44f, 0x0p+0f,
+	0x1.1e068p-2f, 0x1.3e0b42p-4f, -0x1.12aca2p-4f, -0x1.4b7bbcp-6f, 0x1.00256ep-7f, 0x1.5348cp-9f, -0x1.3470aep-11f, -0x1.c6be7ap-13f, 0x1.0cb66p-15f, 0x1.c0fc88p-17f, -0x1.67306cp-20f, -0x1.5c5d72p-21f, 0x1.7c08d8p-25f, 0x1.ba96d8p-26f, -0x1.41e212p-30f, -0x1.d9eeap-31f, 0x1.aed8eep-36f, 0x1.b8ddfap-36f, -0x1.ab81eap-42f, -0x1.ab81eap-41f, 0x1.560188p-44f, 0x0p+0f,
+	0x1.1e068p-2f, -0x1.3e0b42p-4f, -0x1.12aca2p-4f, 0x1.4b7bbcp-6f, 0x1.00256ep-7f, -0x1.5348cp-9f, -0x1.3470aep-11f, 0x1.c6be7ap-13f, 0x1.0cb66p-15f, -0x1.c0fc88p-17f, -0x1.67306cp-20f, 0x1.5c5d72p-21f, 0x1.7c08d8p-25f, -0x1.ba96d8p-26f, -0x1.41e212p-30f, 0x1.d9eeap-31f, 0x1.aed8eep-36f, -0x1.b8ddfap-36f, -0x1.ab81eap-42f, 0x1.ab81eap-41f, -0x1.36ea1ep-44f, 0x0p+0f,
+	0x1.471c64p-3f, -0x1.13b6fap-3f, 0x1.610dc6p-7f, 0x1.696044p-6f, -0x1.808ffap-8f, -0x1.872beap-10f, 0x1.78c83ap-11f, 0x1.37722ap-15f, -0x1.ac125cp-15f, 0x1.01e4eap-19f, 0x1.51ee4ap-19f, -0x1.0af4e4p-22f, -0x1.8f44f6p-24f, 0x1.efe3dcp-27f, 0x1.6c4bcap-29f, -0x1.44e96ap-31f, -0x1.002f88p-34f, 0x1.52d928p-36f, 0x1.06558ap-40f, -0x1.5dc762p-41f, 0x1.d25f2ep-45f, 0x0p+0f,
+	0x1.a40c72p-5f, -0x1.2d9f32p-4f, 0x1.2fff82p-5f, -0x1.98599ap-9f, -0x1.11152ap-8f, 0x1.7c9364p-10f, 0x1.1fd04cp-14f, -0x1.07a16ap-13f, 0x1.f672p-17f, 0x1.6d087p-18f, -0x1.83ff8cp-20f, -0x1.c3117ap-24f, 0x1.37ffdep-24f, -0x1.27cf2p-29f, -0x1.53df7ep-29f, 0x1.148b3ep-32f, 0x1.0a6eep-34f, -0x1.89805p-37f, -0x1.237b7cp-40f, 0x1.d25f2ep-42f, -0x1.1eff7ep-45f, 0x0p+0f,
+	0x1.22e7ap-7f, -0x1.2eedacp-6f, 0x1.09b3f4p-6f, -0x1.d61dfp-8f, 0x1.2d426cp-10f, 0x1.94408cp-12f, -0x1.e1894ep-13f, 0x1.ea603cp-16f, 0x1.3c534p-17f, -0x1.e8155cp-19f, 0x1.e4a304p-24f, 0x1.5a2b4cp-23f, -0x1.d4203ep-26f, -0x1.b27038p-29f, 0x1.7a8632p-30f, -0x1.28a3aep-35f, -0x1.687fcep-35f, 0x1.49996cp-38f, 0x1.b7773ap-41f, -0x1.f63f1ep-43f, 0x1.1eff7ep-46f, 0x0p+0f,
+	0x1.95134cp-11f, -0x1.1d88c6p-9f, 0x1.6a0a9p-9f, -0x1.0aa836p-9f, 0x1.e23628p-11f, -0x1.dff6dcp-13f, 0x1.3f1c44p-18f, 0x1.276f06p-16f, -0x1.7bb63ap-18f, 0x1.7e5fcp-22f, 0x1.01d792p-22f, -0x1.21f4b8p-24f, 0x1.5fffc6p-30f, 0x1.6b9988p-29f, -0x1.edc4b2p-32f, -0x1.21e9bp-35f, 0x1.50bf08p-36f, -0x1.5dc762p-40f, -0x1.e44f26p-42f, 0x1.ae7f3ep-44f, -0x1.cb3264p-48f, 0x0p+0f,
+	0x1.f776e6p-16f, -0x1.d3028p-14f, 0x1.91af46p-13f, -0x1.a5ac5ap-13f, 0x1.29f7e4p-13f, -0x1.2460bep-14f, 0x1.834d74p-16f, -0x1.216356p-18f, -0x1.c136aep-24f, 0x1.618898p-22f, -0x1.8ab1bap-24f, 0x1.bb50aap-28f, 0x1.9a7eaep-29f, -0x1.fd52ccp-31f, 0x1.f371ap-35f, 0x1.b7ea08p-36f, -0x1.a973cp-38f, 0x1.ae7f3ep-44f, 0x1.8a9f4ep-43f, -0x1.1eff7ep-45f, 0x1.1eff7ep-49f, 0x0p+0f,
+	0x1.c50aacp-22f, -0x1.147abp-19f, 0x1.3dcdb4p-18f, -0x1.c7d18p-18f, 0x1.c7060cp-18f, -0x1.4d4604p-18f, 0x1.6e9304p-19f, -0x1.2e54b2p-20f, 0x1.6806dap-22f, -0x1.0bbd66p-24f, 0x1.d099eep-30f, 0x1.ab0fcp-29f, -0x1.1a048ap-30f, 0x1.17c7f2p-33f, 0x1.f6ce9ep-37f, -0x1.25f2e2p-37f, 0x1.47eaecp-40f, 0x1.42df6ep-44f, -0x1.d25f2ep-45f, 0x1.1eff7ep-47f, -0x1.0e1da4p-51f, 0x0p+0f,
+	0x1.87761ep-30f, -0x1.452e66p-27f, 0x1.00344ap-25f, -0x1.fcb75p-25f, 0x1.646afep-24f, -0x1.75e7a6p-24f, 0x1.2fbfd8p-24f, -0x1.8557ap-25f, 0x1.8c6846p-26f, -0x1.3eb018p-27f, 0x1.8a0e68p-29f, -0x1.5aeeaep-31f, 0x1.3dab96p-34f, 0x1.463c6ep-37f, -0x1.c60a34p-38f, 0x1.88d41cp-40f, -0x1.93974ap-44f, -0x1.2337f6p-45f, 0x1.7bd9bp-47f, -0x1.952c78p-50f, 0x1.682786p-54f, 0x0p+0f,
+	0x1.e5403ep-42f, -0x1.2f4698p-38f, 0x1.682024p-36f, -0x1.0e129p-34f, 0x1.1ee7f4p-33f, -0x1.cae70ep-33f, 0x1.1ea154p-32f, -0x1.1e4328p-32f, 0x1.cffb12p-33f, -0x1.33b9f8p-33f, 0x1.4efep-34f, -0x1.2a2984p-35f, 0x1.ac1d6p-37f, -0x1.dfd328p-39f, 0x1.81a752p-41f, -0x1.3bb2a6p-44f, -0x1.66bf5ep-47f, 0x1.b6f02cp-48f, -0x1.7ea9fep-50f, 0x1.682786p-53f, -0x1.2f49b4p-57f, 0x0p+0f,
+	0x1.e542bap-62f, -0x1.2f49b4p-57f, 0x1.682786p-54f, -0x1.0e1da4p-51f, 0x1.1eff7ep-49f, -0x1.cb3264p-48f, 0x1.1eff7ep-46f, -0x1.1eff7ep-45f, 0x1.d25f2ep-45f, -0x1.36ea1ep-44f, 0x1.560188p-44f, -0x1.36ea1ep-44f, 0x1.d25f2ep-45f, -0x1.1eff7ep-45f, 0x1.1eff7ep-46f, -0x1.cb3264p-48f, 0x1.1eff7ep-49f, -0x1.0e1da4p-51f, 0x1.682786p-54f, -0x1.2f49b4p-57f, 0x1.e542bap-62f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 22 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.71b8fp-66f, 0x0p+0f,
+	0x1.71b8fp-66f, 0x1.e542bap-62f, 0x1.2f49b4p-58f, 0x1.e034b2p-56f, 0x1.0e1da4p-53f, 0x1.cb3264p-52f, 0x1.322198p-50f, 0x1.47ff6cp-49f, 0x1.1eff7ep-48f, 0x1.9e8d7ep-48f, 0x1.f17698p-48f, 0x1.f17698p-48f, 0x1.9e8d7ep-48f, 0x1.1eff7ep-48f, 0x1.47ff6cp-49f, 0x1.322198p-50f, 0x1.cb3264p-52f, 0x1.0e1da4p-53f, 0x1.e034b2p-56f, 0x1.2f49b4p-58f, 0x1.e542bap-62f, -0x1.e542bap-62f, 0x0p+0f,
+	0x1.71b7f2p-45f, 0x1.e5402p-42f, 0x1.2f4672p-39f, 0x1.e02a62p-38f, 0x1.0e120ap-36f, 0x1.cb0aeep-36f, 0x1.31ecfap-35f, 0x1.478eacp-35f, 0x1.1e3a3p-35f, 0x1.9c537cp-36f, 0x1.ec1e92p-37f, 0x1.e6c68cp-38f, 0x1.8cbd6ap-39f, 0x1.06558ap-40f, 0x1.0f9f86p-42f, 0x1.91cc18p-45f, 0x1.1eff7ep-48f, -0x1.952c78p-51f, -0x1.a42e1cp-52f, -0x1.5532eap-54f, -0x1.2f49b4p-57f, 0x1.2f49b4p-58f, 0x0p+0f,
+	0x1.c03dfp-33f, 0x1.8757cap-30f, 0x1.45087ep-28f, 0x1.555f08p-27f, 0x1.fc3046p-27f, 0x1.1cafa2p-26f, 0x1.f15844p-27f, 0x1.59dcdp-27f, 0x1.831b1ap-28f, 0x1.5d23d4p-29f, 0x1.f6351ap-31f, 0x1.16f912p-32f, 0x1.b5bac8p-35f, 0x1.451d6ep-38f, -0x1.fdef1ap-41f, -0x1.0bdd66p-41f, -0x1.9c8f46p-44f, -0x1.51a50ep-48f, 0x1.33a1c2p-49f, 0x1.682786p-51f, 0x1.682786p-54f, -0x1.e034b2p-56f, 0x0p+0f,
+	0x1.5e6adcp-24f, 0x1.c38336p-22f, 0x1.133582p-20f, 0x1.a511bap-20f, 0x1.c3d812p-20f, 0x1.67904ep-20f, 0x1.b4933p-21f, 0x1.981806p-22f, 0x1.2229f6p-23f, 0x1.2a004cp-25f, 0x1.6ca56ap-28f, -0x1.d68fd6p-34f, -0x1.56879ep-32f, -0x1.7388fp-34f, -0x1.28727ap-37f, 0x1.853db8p-40f, 0x1.570d66p-41f, 0x1.4c5e7ap-44f, -0x1.a06db4p-48f, -0x1.d8b3ep-49f, -0x1.0e1da4p-51f, 0x1.0e1da4p-53f, 0x0p+0f,
+	0x1.f66966p-18f, 0x1.f062bcp-16f, 0x1.ca5eaap-15f, 0x1.052b3ap-14f, 0x1.976dcep-15f, 0x1.c5ff88p-16f, 0x1.6a107ep-17f, 0x1.864384p-19f, 0x1.ab9c52p-22f, -0x1.a3d95ap-25f, -0x1.505ff4p-25f, -0x1.245476p-27f, -0x1.32610cp-32f, 0x1.53630cp-32f, 0x1.4b02bcp-34f, 0x1.8ea88p-39f, -0x1.2571bcp-39f, -0x1.dd952ap-42f, -0x1.7ea9fep-50f, 0x1.ae7f3ep-47f, 0x1.1eff7ep-49f, -0x1.cb3264p-52f, 0x0p+0f,
+	0x1.fee46cp-13f, 0x1.855794p-11f, 0x1.0ef0b2p-10f, 0x1.c13f7ap-11f, 0x1.e09ae2p-12f, 0x1.462cf2p-13f, 0x1.bd08a6p-16f, -0x1.5f7504p-19f, -0x1.6fc7dap-19f, -0x1.4b4856p-21f, -0x1.71286ap-29f, 0x1.0348bcp-25f, 0x1.a78d04p-28f, -0x1.209c0ep-33f, -0x1.188822p-32f, -0x1.28a3aep-35f, 0x1.fddeb4p-39f, 0x1.a10b44p-40f, 0x1.4ed4bep-44f, -0x1.1eff7ep-45f, -0x1.cb3264p-48f, 0x1.322198p-50f, 0x0p+0f,
+	0x1.cc353ap-9f, 0x1.09966ap-7f, 0x1.0b3c94p-7f, 0x1.25ee2cp-8f, 0x1.50c9d4p-10f, 0x1.80fbcep-15f, -0x1.ad7d5p-14f, -0x1.18dcaep-15f, -0x1.85e27p-20f, 0x1.c1f054p-20f, 0x1.acb442p-22f, -0x1.8d9f7ap-27f, -0x1.476e7p-26f, -0x1.2d9daep-29f, 0x1.c80592p-32f, 0x1.0bb722p-33f, 0x1.ae7f3ep-45f, -0x1.f1c32p-39f, -0x1.72b4aep-42f, 0x1.1eff7ep-44f, 0x1.1eff7ep-46f, -0x1.47ff6cp-49f, 0x0p+0f,
+	0x1.a1015ap-6f, 0x1.5b528ap-5f, 0x1.c3c78cp-6f, 0x1.c86416p-8f, -0x1.09f122p-10f, -0x1.16b7dp-10f, -0x1.74afp-13f, 0x1.656566p-15f, 0x1.44ed72p-16f, 0x1.4ae154p-21f, -0x1.e7427ep-21f, -0x1.3035ap-23f, 0x1.7d22bp-26f, 0x1.0804ep-27f, -0x1.3cddf2p-34f, -0x1.1a3494p-32f, -0x1.399fb2p-36f, 0x1.a46842p-38f, 0x1.f04476p-41f, -0x1.ae7f3ep-44f, -0x1.1eff7ep-45f, 0x1.1eff7ep-48f, 0x0p+0f,
+	0x1.9a6554p-4f, 0x1.bc328ep-4f, 0x1.f39d8ap-6f, -0x1.1fa56ap-7f, -0x1.9c6b76p-8f, -0x1.64bc34p-12f, 0x1.013fc4p-11f, 0x1.857deep-14f, -0x1.557df4p-16f, -0x1.ec29a6p-18f, 0x1.79bcc6p-22f, 0x1.82dbaep-22f, 0x1.9b2c0ep-27f, -0x1.b5b434p-27f, -0x1.459fccp-30f, 0x1.778e8cp-32f, 0x1.cf2f08p-35f, -0x1.ebe062p-38f, -0x1.dc168p-40f, 0x1.d25f2ep-44f, 0x1.d25f2ep-45f, -0x1.9e8d7ep-48f, 0x0p+0f,
+	0x1.cb535cp-3f, 0x1.e9e134p-4f, -0x1.d2c568p-6f, -0x1.a91324p-6f, 0x1.de486cp-12f, 0x1.66bdfp-9f, 0x1.7f321cp-13f, -0x1.878e3cp-13f, -0x1.78e1fp-16f, 0x1.35ae8cp-17f, 0x1.9ac49cp-20f, -0x1.7861d2p-22f, -0x1.413a98p-24f, 0x1.6aa35p-27f, 0x1.8a974cp-29f, -0x1.18207p-32f, -0x1.8f6c04p-34f, 0x1.567de6p-38f, 0x1.5a8a48p-39f, -0x1.36ea1ep-44f, -0x1.36ea1ep-44f, 0x1.f17698p-48f, 0x0p+0f,
+	0x1.2ba548p-2f, 0x0p+0f, -0x1.3e0b42p-4f, 0x0p+0f, 0x1.4b7bbcp-7f, 0x0p+0f, -0x1.c461p-11f, 0x0p+0f, 0x1.c6be7ap-15f, 0x0p+0f, -0x1.67306cp-19f, 0x0p+0f, 0x1.d07c98p-24f, 0x0p+0f, -0x1.f9d0f6p-29f, 0x0p+0f, 0x1.d9eeap-34f, 0x0p+0f, -0x1.87e1c2p-39f, 0x0p+0f, 0x1.560188p-44f, -0x1.f17698p-48f, 0x0p+0f,
+	0x1.cb535cp-3f, -0x1.e9e134p-4f, -0x1.d2c568p-6f, 0x1.a91324p-6f, 0x1.de486cp-12f, -0x1.66bdfp-9f, 0x1.7f321cp-13f, 0x1.878e3cp-13f, -0x1.78e1fp-16f, -0x1.35ae8cp-17f, 0x1.9ac49cp-20f, 0x1.7861d2p-22f, -0x1.413a98p-24f, -0x1.6aa35p-27f, 0x1.8a974cp-29f, 0x1.18207p-32f, -0x1.8f6c04p-34f, -0x1.567de6p-38f, 0x1.5a8a48p-39f, 0x1.36ea1ep-44f, -0x1.36ea1ep-44f, 0x1.9e8d7ep-48f, 0x0p+0f,
+	0x1.9a6554p-4f, -0x1.bc328ep-4f, 0x1.f39d8ap-6f, 0x1.1fa56ap-7f, -0x1.9c6b76p-8f, 0x1.64bc34p-12f, 0x1.013fc4p-11f, -0x1.857deep-14f, -0x1.557df4p-16f, 0x1.ec29a6p-18f, 0x1.79bcc6p-22f, -0x1.82dbaep-22f, 0x1.9b2c0ep-27f, 0x1.b5b434p-27f, -0x1.459fccp-30f, -0x1.778e8cp-32f, 0x1.cf2f08p-35f, 0x1.ebe062p-38f, -0x1.dc168p-40f, -0x1.d25f2ep-44f, 0x1.d25f2ep-45f, -0x1.1eff7ep-48f, 0x0p+0f,
+	0x1.a1015ap-6f, -0x1.5b528ap-5f, 0x1.c3c78cp-6f, -0x1.c86416p-8f, -0x1.09f122p-10f, 0x1.16b7dp-10f, -0x1.74afp-13f, -0x1.656566p-15f, 0x1.44ed72p-16f, -0x1.4ae154p-21f, -0x1.e7427ep-21f, 0x1.3035ap-23f, 0x1.7d22bp-26f, -0x1.0804ep-27f, -0x1.3cddf2p-34f, 0x1.1a3494p-32f, -0x1.399fb2p-36f, -0x1.a46842p-38f, 0x1.f04476p-41f, 0x1.ae7f3ep-44f, -0x1.1eff7ep-45f, 0x1.47ff6cp-49f, 0x0p+0f,
+	0x1.cc353ap-9f, -0x1.09966ap-7f, 0x1.0b3c94p-7f, -0x1.25ee2cp-8f, 0x1.50c9d4p-10f, -0x1.80fbcep-15f, -0x1.ad7d5p-14f, 0x1.18dcaep-15f, -0x1.85e27p-20f, -0x1.c1f054p-20f, 0x1.acb442p-22f, 0x1.8d9f7ap-27f, -0x1.476e7p-26f, 0x1.2d9daep-29f, 0x1.c80592p-32f, -0x1.0bb722p-33f, 0x1.ae7f3ep-45f, 0x1.f1c32p-39f, -0x1.72b4aep-42f, -0x1.1eff7ep-44f, 0x1.1eff7ep-46f, -0x1.322198p-50f, 0x0p+0f,
+	0x1.fee46cp-13f, -0x1.855794p-11f, 0x1.0ef0b2p-10f, -0x1.c13f7ap-11f, 0x1.e09ae2p-12f, -0x1.462cf2p-13f, 0x1.bd08a6p-16f, 0x1.5f7504p-19f, -0x1.6fc7dap-19f, 0x1.4b4856p-21f, -0x1.71286ap-29f, -0x1.0348bcp-25f, 0x1.a78d04p-28f, 0x1.209c0ep-33f, -0x1.188822p-32f, 0x1.28a3aep-35f, 0x1.fddeb4p-39f, -0x1.a10b44p-40f, 0x1.4ed4bep-44f, 0x1.1eff7ep-45f, -0x1.cb3264p-48f, 0x1.cb3264p-52f, 0x0p+0f,
+	0x1.f66966p-18f, -0x1.f062bcp-16f, 0x1.ca5eaap-15f, -0x1.052b3ap-14f, 0x1.976dcep-15f, -0x1.c5ff88p-16f, 0x1.6a107ep-17f, -0x1.864384p-19f, 0x1.ab9c52p-22f, 0x1.a3d95ap-25f, -0x1.505ff4p-25f, 0x1.245476p-27f, -0x1.32610cp-32f, -0x1.53630cp-32f, 0x1.4b02bcp-34f, -0x1.8ea88p-39f, -0x1.2571bcp-39f, 0x1.dd952ap-42f, -0x1.7ea9fep-50f, -0x1.ae7f3ep-47f, 0x1.1eff7ep-49f, -0x1.0e1da4p-53f, 0x0p+0f,
+	0x1.5e6adcp-24f, -0x1.c38336p-22f, 0x1.133582p-20f, -0x1.a511bap-20f, 0x1.c3d812p-20f, -0x1.67904ep-20f, 0x1.b4933p-21f, -0x1.981806p-22f, 0x1.2229f6p-23f, -0x1.2a004cp-25f, 0x1.6ca56ap-28f, 0x1.d68fd6p-34f, -0x1.56879ep-32f, 0x1.7388fp-34f, -0x1.28727ap-37f, -0x1.853db8p-40f, 0x1.570d66p-41f, -0x1.4c5e7ap-44f, -0x1.a06db4p-48f, 0x1.d8b3ep-49f, -0x1.0e1da4p-51f, 0x1.e034b2p-56f, 0x0p+0f,
+	0x1.c03dfp-33f, -0x1.8757cap-30f, 0x1.45087ep-28f, -0x1.555f08p-27f, 0x1.fc3046p-27f, -0x1.1cafa2p-26f, 0x1.f15844p-27f, -0x1.59dcdp-27f, 0x1.831b1ap-28f, -0x1.5d23d4p-29f, 0x1.f6351ap-31f, -0x1.16f912p-32f, 0x1.b5bac8p-35f, -0x1.451d6ep-38f, -0x1.fdef1ap-41f, 0x1.0bdd66p-41f, -0x1.9c8f46p-44f, 0x1.51a50ep-48f, 0x1.33a1c2p-49f, -0x1.682786p-51f, 0x1.682786p-54f, -0x1.2f49b4p-58f, 0x0p+0f,
+	0x1.71b7f2p-45f, -0x1.e5402p-42f, 0x1.2f4672p-39f, -0x1.e02a62p-38f, 0x1.0e120ap-36f, -0x1.cb0aeep-36f, 0x1.31ecfap-35f, -0x1.478eacp-35f, 0x1.1e3a3p-35f, -0x1.9c537cp-36f, 0x1.ec1e92p-37f, -0x1.e6c68cp-38f, 0x1.8cbd6ap-39f, -0x1.06558ap-40f, 0x1.0f9f86p-42f, -0x1.91cc18p-45f, 0x1.1eff7ep-48f, 0x1.952c78p-51f, -0x1.a42e1cp-52f, 0x1.5532eap-54f, -0x1.2f49b4p-57f, 0x1.e542bap-62f, 0x0p+0f,
+	0x1.71b8fp-66f, -0x1.e542bap-62f, 0x1.2f49b4p-58f, -0x1.e034b2p-56f, 0x1.0e1da4p-53f, -0x1.cb3264p-52f, 0x1.322198p-50f, -0x1.47ff6cp-49f, 0x1.1eff7ep-48f, -0x1.9e8d7ep-48f, 0x1.f17698p-48f, -0x1.f17698p-48f, 0x1.9e8d7ep-48f, -0x1.1eff7ep-48f, 0x1.47ff6cp-49f, -0x1.322198p-50f, 0x1.cb3264p-52f, -0x1.0e1da4p-53f, 0x1.e034b2p-56f, -0x1.2f49b4p-58f, 0x1.e542bap-62f, -0x1.71b8fp-66f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 23 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.0ce396p-70f, 0x0p+0f,
+	0x1.0ce396p-70f, 0x1.71b8fp-66f, 0x1.e542bap-63f, 0x1.946246p-60f, 0x1.e034b2p-58f, 0x1.b02f6ep-56f, 0x1.322198p-54f, 0x1.5ddd4p-53f, 0x1.47ff6cp-52f, 0x1.fe37fep-52f, 0x1.4ba466p-51f, 0x1.69ca9cp-51f, 0x1.4ba466p-51f, 0x1.fe37fep-52f, 0x1.47ff6cp-52f, 0x1.5ddd4p-53f, 0x1.322198p-54f, 0x1.b02f6ep-56f, 0x1.e034b2p-58f, 0x1.946246p-60f, 0x1.e542bap-63f, 0x1.71b8fp-66f, -0x1.71b8fp-66f, 0x0p+0f,
+	0x1.0ce336p-48f, 0x1.71b7e6p-45f, 0x1.e54p-43f, 0x1.945dbcp-41f, 0x1.e029eap-40f, 0x1.b01c04p-39f, 0x1.320618p-38f, 0x1.5d9e62p-38f, 0x1.47898cp-38f, 0x1.fcc946p-39f, 0x1.49c7a8p-39f, 0x1.65ba76p-40f, 0x1.443174p-41f, 0x1.e74c7ap-43f, 0x1.2a877ap-44f, 0x1.1eff7ep-46f, 0x1.883b0cp-49f, 0x1.e6355cp-53f, -0x1.a42e1cp-55f, -0x1.7b1c22p-56f, -0x1.201f9ep-58f, -0x1.e542bap-62f, 0x1.e542bap-63f, 0x0p+0f,
+	0x1.e9a5cep-36f, 0x1.c026d4p-33f, 0x1.873976p-31f, 0x1.b12e1ap-30f, 0x1.552302p-29f, 0x1.9620fep-29f, 0x1.7afbd4p-29f, 0x1.1b83ap-29f, 0x1.589542p-30f, 0x1.561b3ep-31f, 0x1.14bc24p-32f, 0x1.67a646p-34f, 0x1.69d2ap-36f, 0x1.fc39c6p-39f, 0x1.289b7ap-42f, -0x1.5865ccp-44f, -0x1.24fa26p-45f, -0x1.952c78p-48f, -0x1.fe37fep-53f, 0x1.2f49b4p-53f, 0x1.423e5p-55f, 0x1.2f49b4p-58f, -0x1.946246p-60f, 0x0p+0f,
+	0x1.01df96p-26f, 0x1.5d8abcp-24f, 0x1.c1fbdep-23f, 0x1.6d40a2p-22f, 0x1.a266fcp-22f, 0x1.664c8ep-22f, 0x1.d97cbep-23f, 0x1.ea0fcap-24f, 0x1.8d492p-25f, 0x1.ee574ep-27f, 0x1.b9e34cp-29f, 0x1.b7158p-32f, -0x1.0868bp-35f, -0x1.e8eb08p-36f, -0x1.bfd576p-38f, -0x1.1a36f8p-41f, 0x1.059636p-43f, 0x1.7368c2p-45f, 0x1.3a327cp-48f, -0x1.e034b2p-52f, -0x1.c23168p-53f, -0x1.e034b2p-56f, 0x1.e034b2p-58f, 0x0p+0f,
+	0x1.daa83p-20f, 0x1.f0efbap-18f, 0x1.e954aep-17f, 0x1.2bd8a8p-16f, 0x1.fd2de8p-17f, 0x1.3aa5a4p-17f, 0x1.1faf02p-18f, 0x1.7e9a9ep-20f, 0x1.534084p-22f, 0x1.f645f2p-26f, -0x1.1f23dcp-27f, -0x1.15c93p-28f, -0x1.80df1ep-31f, 0x1.63f1ep-39f, 0x1.ee060ap-36f, 0x1.889ab6p-38f, 0x1.981348p-44f, -0x1.64e6aap-43f, -0x1.f260b2p-46f, 0x1.0e1da4p-52f, 0x1.b6f02cp-51f, 0x1.0e1da4p-53f, -0x1.b02f6ep-56f, 0x0p+0f,
+	0x1.2eeec6p-14f, 0x1.ef3122p-13f, 0x1.75d47ep-12f, 0x1.5627a8p-12f, 0x1.a09a12p-13f, 0x1.57bdbap-14f, 0x1.673cp-16f, 0x1.2db75p-19f, -0x1.72dc44p-21f, -0x1.766dbp-22f, -0x1.e81134p-25f, 0x1.c7b672p-29f, 0x1.bb27ccp-29f, 0x1.106e34p-31f, -0x1.14653p-35f, -0x1.8380dep-36f, -0x1.418e36p-39f, 0x1.7a07bcp-42f, 0x1.dcd5d4p-44f, 0x1.1eff7ep-48f, -0x1.3bb2a6p-49f, -0x1.cb3264p-52f, 0x1.322198p-54f, 0x0p+0f,
+	0x1.534deap-10f, 0x1.ac46f4p-9f, 0x1.e281e2p-9f, 0x1.3728a6p-9f, 0x1.db8c7cp-11f, 0x1.5a9e92p-13f, -0x1.3292a8p-16f, -0x1.34ffb4p-16f, -0x1.02e55ep-18f, 0x1.3344bp-23f, 0x1.ec76ccp-23f, 0x1.39e1ep-25f, -0x1.de40ccp-29f, -0x1.0aa86cp-29f, -0x1.4416c6p-33f, 0x1.88d41cp-35f, 0x1.55e00cp-37f, -0x1.d98bf8p-43f, -0x1.39e772p-42f, -0x1.7ea9fep-46f, 0x1.5865ccp-48f, 0x1.322198p-50f, -0x1.5ddd4p-53f, 0x0p+0f,
+	0x1.7db89ap-7f, 0x1.677ab4p-6f, 0x1.18ecfp-6f, 0x1.a83704p-8f, 0x1.44ebd2p-11f, -0x1.e22f2cp-12f, -0x1.83aa3ep-13f, -0x1.6900cap-17f, 0x1.3f210ap-17f, 0x1.367c16p-19f, -0x1.c732aap-24f, -0x1.fe435cp-24f, -0x1.747a36p-27f, 0x1.b40a8ap-29f, 0x1.83e97cp-31f, -0x1.1d75e6p-35f, -0x1.a01024p-36f, -0x1.27f77ap-40f, 0x1.297624p-41f, 0x1.1eff7ep-44f, -0x1.1eff7ep-47f, -0x1.47ff6cp-49f, 0x1.47ff6cp-52f, 0x0p+0f,
+	0x1.d4763ep-5f, 0x1.3224fep-4f, 0x1.0e894ap-5f, 0x1.fe3fdcp-11f, -0x1.01ebbap-8f, -0x1.14bf58p-10f, 0x1.f96cb4p-14f, 0x1.907aep-14f, 0x1.a59676p-18f, -0x1.282fbcp-18f, -0x1.aad174p-21f, 0x1.ebbad2p-24f, 0x1.674efep-25f, -0x1.b01f2ap-31f, -0x1.90fc0cp-30f, -0x1.46354p-34f, 0x1.48e19p-35f, 0x1.23c33cp-38f, -0x1.9575ap-41f, -0x1.30ef76p-43f, 0x1.66bf5ep-47f, 0x1.1eff7ep-48f, -0x1.fe37fep-52f, 0x0p+0f,
+	0x1.4a09a6p-3f, 0x1.fc4166p-4f, 0x1.6d753p-8f, -0x1.4220fap-6f, -0x1.19406ep-8f, 0x1.61d998p-10f, 0x1.0ce3a4p-11f, -0x1.710768p-15f, -0x1.25269ap-15f, -0x1.f75504p-23f, 0x1.bc9c4cp-20f, 0x1.cc1f26p-24f, -0x1.fcd3aap-25f, -0x1.ca9da8p-28f, 0x1.c95694p-30f, 0x1.29481ap-32f, -0x1.47d77ep-35f, -0x1.28f29ap-37f, 0x1.72d492p-41f, 0x1.ec4806p-43f, -0x1.36ea1ep-47f, -0x1.9e8d7ep-48f, 0x1.4ba466p-51f, 0x0p+0f,
+	0x1.1317ecp-2f, 0x1.17ee68p-4f, -0x1.e9e134p-5f, -0x1.0c77ep-6f, 0x1.a91324p-8f, 0x1.fa758ep-10f, -0x1.de5294p-12f, -0x1.393e96p-13f, 0x1.878e3cp-16f, 0x1.1ddc32p-17f, -0x1.ef7dacp-21f, -0x1.9a9942p-22f, 0x1.f5d7c2p-26f, 0x1.e3846cp-27f, -0x1.9e718p-31f, -0x1.e0379cp-32f, 0x1.18207p-36f, 0x1.9afd7ap-37f, -0x1.306fe8p-42f, -0x1.36ea1ep-42f, 0x1.f17698p-49f, 0x1.f17698p-48f, -0x1.69ca9cp-51f, 0x0p+0f,
+	0x1.1317ecp-2f, -0x1.17ee68p-4f, -0x1.e9e134p-5f, 0x1.0c77ep-6f, 0x1.a91324p-8f, -0x1.fa758ep-10f, -0x1.de5294p-12f, 0x1.393e96p-13f, 0x1.878e3cp-16f, -0x1.1ddc32p-17f, -0x1.ef7dacp-21f, 0x1.9a9942p-22f, 0x1.f5d7c2p-26f, -0x1.e3846cp-27f, -0x1.9e718p-31f, 0x1.e0379cp-32f, 0x1.18207p-36f, -0x1.9afd7ap-37f, -0x1.306fe8p-42f, 0x1.36ea1ep-42f, 0x1.f17698p-49f, -0x1.f17698p-48f, 0x1.4ba466p-51f, 0x0p+0f,
+	0x1.4a09a6p-3f, -0x1.fc4166p-4f, 0x1.6d753p-8f, 0x1.4220fap-6f, -0x1.19406ep-8f, -0x1.61d998p-10f, 0x1.0ce3a4p-11f, 0x1.710768p-15f, -0x1.25269ap-15f, 0x1.f75504p-23f, 0x1.bc9c4cp-20f, -0x1.cc1f26p-24f, -0x1.fcd3aap-25f, 0x1.ca9da8p-28f, 0x1.c95694p-30f, -0x1.29481ap-32f, -0x1.47d77ep-35f, 0x1.28f29ap-37f, 0x1.72d492p-41f, -0x1.ec4806p-43f, -0x1.36ea1ep-47f, 0x1.9e8d7ep-48f, -0x1.fe37fep-52f, 0x0p+0f,
+	0x1.d4763ep-5f, -0x1.3224fep-4f, 0x1.0e894ap-5f, -0x1.fe3fdcp-11f, -0x1.01ebbap-8f, 0x1.14bf58p-10f, 0x1.f96cb4p-14f, -0x1.907aep-14f, 0x1.a59676p-18f, 0x1.282fbcp-18f, -0x1.aad174p-21f, -0x1.ebbad2p-24f, 0x1.674efep-25f, 0x1.b01f2ap-31f, -0x1.90fc0cp-30f, 0x1.46354p-34f, 0x1.48e19p-35f, -0x1.23c33cp-38f, -0x1.9575ap-41f, 0x1.30ef76p-43f, 0x1.66bf5ep-47f, -0x1.1eff7ep-48f, 0x1.47ff6cp-52f, 0x0p+0f,
+	0x1.7db89ap-7f, -0x1.677ab4p-6f, 0x1.18ecfp-6f, -0x1.a83704p-8f, 0x1.44ebd2p-11f, 0x1.e22f2cp-12f, -0x1.83aa3ep-13f, 0x1.6900cap-17f, 0x1.3f210ap-17f, -0x1.367c16p-19f, -0x1.c732aap-24f, 0x1.fe435cp-24f, -0x1.747a36p-27f, -0x1.b40a8ap-29f, 0x1.83e97cp-31f, 0x1.1d75e6p-35f, -0x1.a01024p-36f, 0x1.27f77ap-40f, 0x1.297624p-41f, -0x1.1eff7ep-44f, -0x1.1eff7ep-47f, 0x1.47ff6cp-49f, -0x1.5ddd4p-53f, 0x0p+0f,
+	0x1.534deap-10f, -0x1.ac46f4p-9f, 0x1.e281e2p-9f, -0x1.3728a6p-9f, 0x1.db8c7cp-11f, -0x1.5a9e92p-13f, -0x1.3292a8p-16f, 0x1.34ffb4p-16f, -0x1.02e55ep-18f, -0x1.3344bp-23f, 0x1.ec76ccp-23f, -0x1.39e1ep-25f, -0x1.de40ccp-29f, 0x1.0aa86cp-29f, -0x1.4416c6p-33f, -0x1.88d41cp-35f, 0x1.55e00cp-37f, 0x1.d98bf8p-43f, -0x1.39e772p-42f, 0x1.7ea9fep-46f, 0x1.5865ccp-48f, -0x1.322198p-50f, 0x1.322198p-54f, 0x0p+0f,
+	0x1.2eeec6p-14f, -0x1.ef3122p-13f, 0x1.75d47ep-12f, -0x1.5627a8p-12f, 0x1.a09a12p-13f, -0x1.57bdbap-14f, 0x1.673cp-16f, -0x1.2db75p-19f, -0x1.72dc44p-21f, 0x1.766dbp-22f, -0x1.e81134p-25f, -0x1.c7b672p-29f, 0x1.bb27ccp-29f, -0x1.106e34p-31f, -0x1.14653p-35f, 0x1.8380dep-36f, -0x1.418e36p-39f, -0x1.7a07bcp-42f, 0x1.dcd5d4p-44f, -0x1.1eff7ep-48f, -0x1.3bb2a6p-49f, 0x1.cb3264p-52f, -0x1.b02f6ep-56f, 0x0p+0f,
+	0x1.daa83p-20f, -0x1.f0efbap-18f, 0x1.e954aep-17f, -0x1.2bd8a8p-16f, 0x1.fd2de8p-17f, -0x1.3aa5a4p-17f, 0x1.1faf02p-18f, -0x1.7e9a9ep-20f, 0x1.534084p-22f, -0x1.f645f2p-26f, -0x1.1f23dcp-27f, 0x1.15c93p-28f, -0x1.80df1ep-31f, -0x1.63f1ep-39f, 0x1.ee060ap-36f, -0x1.889ab6p-38f, 0x1.981348p-44f, 0x1.64e6aap-43f, -0x1.f260b2p-46f, -0x1.0e1da4p-52f, 0x1.b6f02cp-51f, -0x1.0e1da4p-53f, 0x1.e034b2p-58f, 0x0p+0f,
+	0x1.01df96p-26f, -0x1.5d8abcp-24f, 0x1.c1fbdep-23f, -0x1.6d40a2p-22f, 0x1.a266fcp-22f, -0x1.664c8ep-22f, 0x1.d97cbep-23f, -0x1.ea0fcap-24f, 0x1.8d492p-25f, -0x1.ee574ep-27f, 0x1.b9e34cp-29f, -0x1.b7158p-32f, -0x1.0868bp-35f, 0x1.e8eb08p-36f, -0x1.bfd576p-38f, 0x1.1a36f8p-41f, 0x1.059636p-43f, -0x1.7368c2p-45f, 0x1.3a327cp-48f, 0x1.e034b2p-52f, -0x1.c23168p-53f, 0x1.e034b2p-56f, -0x1.946246p-60f, 0x0p+0f,
+	0x1.e9a5cep-36f, -0x1.c026d4p-33f, 0x1.873976p-31f, -0x1.b12e1ap-30f, 0x1.552302p-29f, -0x1.9620fep-29f, 0x1.7afbd4p-29f, -0x1.1b83ap-29f, 0x1.589542p-30f, -0x1.561b3ep-31f, 0x1.14bc24p-32f, -0x1.67a646p-34f, 0x1.69d2ap-36f, -0x1.fc39c6p-39f, 0x1.289b7ap-42f, 0x1.5865ccp-44f, -0x1.24fa26p-45f, 0x1.952c78p-48f, -0x1.fe37fep-53f, -0x1.2f49b4p-53f, 0x1.423e5p-55f, -0x1.2f49b4p-58f, 0x1.e542bap-63f, 0x0p+0f,
+	0x1.0ce336p-48f, -0x1.71b7e6p-45f, 0x1.e54p-43f, -0x1.945dbcp-41f, 0x1.e029eap-40f, -0x1.b01c04p-39f, 0x1.320618p-38f, -0x1.5d9e62p-38f, 0x1.47898cp-38f, -0x1.fcc946p-39f, 0x1.49c7a8p-39f, -0x1.65ba76p-40f, 0x1.443174p-41f, -0x1.e74c7ap-43f, 0x1.2a877ap-44f, -0x1.1eff7ep-46f, 0x1.883b0cp-49f, -0x1.e6355cp-53f, -0x1.a42e1cp-55f, 0x1.7b1c22p-56f, -0x1.201f9ep-58f, 0x1.e542bap-62f, -0x1.71b8fp-66f, 0x0p+0f,
+	0x1.0ce396p-70f, -0x1.71b8fp-66f, 0x1.e542bap-63f, -0x1.946246p-60f, 0x1.e034b2p-58f, -0x1.b02f6ep-56f, 0x1.322198p-54f, -0x1.5ddd4p-53f, 0x1.47ff6cp-52f, -0x1.fe37fep-52f, 0x1.4ba466p-51f, -0x1.69ca9cp-51f, 0x1.4ba466p-51f, -0x1.fe37fep-52f, 0x1.47ff6cp-52f, -0x1.5ddd4p-53f, 0x1.322198p-54f, -0x1.b02f6ep-56f, 0x1.e034b2p-58f, -0x1.946246p-60f, 0x1.e542bap-63f, -0x1.71b8fp-66f, 0x1.0ce396p-70f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+/* 24 */
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x1.761b42p-75f, 0x0p+0f,
+	0x1.761b42p-75f, 0x1.0ce396p-70f, 0x1.71b8fp-67f, 0x1.4381d2p-64f, 0x1.946246p-62f, 0x1.802a28p-60f, 0x1.201f9ep-58f, 0x1.5ddd4p-57f, 0x1.5ddd4p-56f, 0x1.238db6p-55f, 0x1.982cccp-55f, 0x1.e2637cp-55f, 0x1.e2637cp-55f, 0x1.982cccp-55f, 0x1.238db6p-55f, 0x1.5ddd4p-56f, 0x1.5ddd4p-57f, 0x1.201f9ep-58f, 0x1.802a28p-60f, 0x1.946246p-62f, 0x1.4381d2p-64f, 0x1.71b8fp-67f, 0x1.0ce396p-70f, -0x1.0ce396p-70f, 0x0p+0f,
+	0x1.761afcp-52f, 0x1.0ce332p-48f, 0x1.71b7dap-46f, 0x1.437fecp-44f, 0x1.945d88p-43f, 0x1.802128p-42f, 0x1.20121ep-41f, 0x1.5dbc74p-41f, 0x1.5d9ba8p-41f, 0x1.23206p-41f, 0x1.96faaap-42f, 0x1.df8fe6p-43f, 0x1.dcbc52p-44f, 0x1.8e9bbep-45f, 0x1.15e312p-46f, 0x1.3d1082p-48f, 0x1.1c43c4p-50f, 0x1.682786p-53f, 0x1.802a28p-57f, -0x1.946246p-59f, -0x1.4381d2p-60f, -0x1.ce272cp-63f, -0x1.71b8fp-66f, 0x1.71b8fp-67f, 0x0p+0f,
+	0x1.ff6a8cp-39f, 0x1.e995p-36f, 0x1.c00fbap-34f, 0x1.04bcc2p-32f, 0x1.b0fb9p-32f, 0x1.10b8cap-31f, 0x1.0e78a4p-31f, 0x1.b070fp-32f, 0x1.1ad4dp-32f, 0x1.3128a4p-33f, 0x1.10185ep-34f, 0x1.8ec6aap-36f, 0x1.d8147ap-38f, 0x1.b0d9fp-40f, 0x1.1102dap-42f, 0x1.d98bf8p-47f, -0x1.a025acp-48f, -0x1.2ad0cap-49f, -0x1.75a902p-52f, -0x1.5532eap-57f, 0x1.188a94p-57f, 0x1.10f588p-59f, 0x1.e542bap-63f, -0x1.4381d2p-64f, 0x0p+0f,
+	0x1.6a1b56p-29f, 0x1.01652cp-26f, 0x1.5caaa8p-25f, 0x1.2af86ep-24f, 0x1.6b8f74p-24f, 0x1.4c96f8p-24f, 0x1.d98064p-25f, 0x1.0b2e2ep-25f, 0x1.e133acp-27f, 0x1.57923p-28f, 0x1.7a5e16p-30f, 0x1.28371cp-32f, 0x1.d18fe8p-36f, -0x1.120b14p-38f, -0x1.3bafp-39f, -0x1.f17698p-42f, -0x1.de547ep-46f, 0x1.3b2296p-47f, 0x1.77292cp-49f, 0x1.16039p-52f, -0x1.f97ad8p-56f, -0x1.946246p-57f, -0x1.946246p-60f, 0x1.946246p-62f, 0x0p+0f,
+	0x1.aa0f3p-22f, 0x1.d6a0b2p-20f, 0x1.eb799p-19f, 0x1.41888p-18f, 0x1.2623a6p-18f, 0x1.8ce226p-19f, 0x1.9499acp-20f, 0x1.37defap-21f, 0x1.5ff9a2p-23f, 0x1.016a1cp-25f, 0x1.982a1p-30f, -0x1.212c22p-30f, -0x1.96f8b6p-32f, -0x1.c55952p-35f, 0x1.30ce7p-39f, 0x1.4330cp-39f, 0x1.abe194p-42f, -0x1.b14f8ep-50f, -0x1.8fc7ep-47f, -0x1.e5d552p-50f, 0x1.2c20fp-55f, 0x1.a42e1cp-55f, 0x1.e034b2p-58f, -0x1.802a28p-60f, 0x0p+0f,
+	0x1.535214p-16f, 0x1.278426p-14f, 0x1.dfa9a4p-14f, 0x1.de0d22p-14f, 0x1.436a1cp-14f, 0x1.33d29p-15f, 0x1.95e15cp-17f, 0x1.485bb8p-19f, 0x1.b9a806p-24f, -0x1.e06ebp-24f, -0x1.44a80cp-25f, -0x1.2ec02cp-28f, 0x1.511846p-31f, 0x1.4bec0cp-32f, 0x1.35c294p-35f, -0x1.172682p-38f, -0x1.e5a78cp-40f, -0x1.3aa488p-43f, 0x1.eea648p-46f, 0x1.fa7794p-48f, 0x1.b02f6ep-53f, -0x1.442392p-53f, -0x1.b02f6ep-56f, 0x1.201f9ep-58f, 0x0p+0f,
+	0x1.d50af8p-12f, 0x1.405efcp-10f, 0x1.8d53e2p-10f, 0x1.2284e2p-10f, 0x1.0c63b2p-11f, 0x1.291e5ep-13f, 0x1.d1ff3cp-17f, -0x1.7c7618p-18f, -0x1.5ab69ep-19f, -0x1.79d896p-22f, 0x1.a67338p-25f, 0x1.bee52ap-26f, 0x1.7c88ap-29f, -0x1.1b82a4p-31f, -0x1.7e96d4p-33f, -0x1.0ffd5p-37f, 0x1.254a46p-38f, 0x1.8d6ccep-41f, -0x1.113efcp-45f, -0x1.6cba06p-46f, -0x1.6b87e6p-50f, 0x1.7ea9fep-52f, 0x1.322198p-54f, -0x1.5ddd4p-57f, 0x0p+0f,
+	0x1.448df8p-8f, 0x1.534edep-7f, 0x1.31f1d6p-7f, 0x1.262644p-8f, 0x1.0ca2bp-10f, -0x1.e2021ep-15f, -0x1.b4fef8p-14f, -0x1.8f3fe6p-16f, 0x1.00fe9ep-20f, 0x1.8ebc32p-20f, 0x1.d20c78p-23f, -0x1.05d752p-25f, -0x1.bccd88p-27f, -0x1.374766p-31f, 0x1.918ad6p-32f, 0x1.f43252p-35f, -0x1.532502p-38f, -0x1.143c5p-39f, -0x1.a4ee32p-45f, 0x1.7ea9fep-45f, 0x1.322198p-48f, -0x1.5ddd4p-51f, -0x1.5ddd4p-53f, 0x1.5ddd4p-56f, 0x0p+0f,
+	0x1.eb18bcp-6f, 0x1.750818p-5f, 0x1.b08cap-6f, 0x1.5adcdap-8f, -0x1.686f08p-10f, -0x1.dda854p-11f, -0x1.a08978p-14f, 0x1.6dee0ep-15f, 0x1.bd9afap-17f, -0x1.813118p-22f, -0x1.69249ep-21f, -0x1.0d0816p-24f, 0x1.4dff64p-26f, 0x1.166accp-28f, -0x1.36e5e8p-32f, -0x1.3d4d38p-33f, -0x1.6ef49cp-39f, 0x1.f9545cp-39f, 0x1.451d6ep-42f, -0x1.27f77ap-44f, -0x1.66bf5ep-47f, 0x1.ebff22p-51f, 0x1.47ff6cp-52f, -0x1.238db6p-55f, 0x0p+0f,
+	0x1.ad908ep-4f, 0x1.a9d82cp-4f, 0x1.9438dp-6f, -0x1.2bce3p-7f, -0x1.5212fap-8f, -0x1.2aa294p-14f, 0x1.a465f4p-12f, 0x1.d63268p-15f, -0x1.247f4ap-16f, -0x1.336beap-18f, 0x1.c0bb52p-22f, 0x1.de8f4ap-23f, -0x1.51272cp-31f, -0x1.0b1e5cp-27f, -0x1.ce6696p-32f, 0x1.c9c5aap-33f, 0x1.7ad56cp-36f, -0x1.350bcap-38f, -0x1.89a032p-41f, 0x1.46dbdep-44f, 0x1.3ee2fep-46f, -0x1.fe37fep-51f, -0x1.fe37fep-52f, 0x1.982cccp-55f, 0x0p+0f,
+	0x1.c1ad08p-3f, 0x1.b84c64p-4f, -0x1.c8a5fcp-6f, -0x1.650a92p-6f, 0x1.ad48dp-11f, 0x1.1a87d4p-9f, 0x1.96f53ep-14f, -0x1.225088p-13f, -0x1.b9f978p-17f, 0x1.b29a6ap-18f, 0x1.d5f5a4p-21f, -0x1.f7881ap-23f, -0x1.5e6b5cp-25f, 0x1.d3899p-28f, 0x1.975424p-30f, -0x1.626e94p-33f, -0x1.84bfdcp-35f, 0x1.b8619cp-39f, 0x1.3aa398p-40f, -0x1.b87656p-45f, -0x1.bda4e8p-46f, 0x1.4ba466p-51f, 0x1.4ba466p-51f, -0x1.e2637cp-55f, 0x0p+0f,
+	0x1.1f0dd4p-2f, 0x0p+0f, -0x1.17ee68p-4f, 0x0p+0f, 0x1.0c77ep-7f, 0x0p+0f, -0x1.51a3b4p-11f, 0x0p+0f, 0x1.393e96p-15f, 0x0p+0f, -0x1.c9605p-20f, 0x0p+0f, 0x1.11bb82p-24f, 0x0p+0f, -0x1.144bacp-29f, 0x0p+0f, 0x1.e0379cp-35f, 0x0p+0f, -0x1.6d5318p-40f, 0x0p+0f, 0x1.f17698p-46f, 0x0p+0f, -0x1.69ca9cp-51f, 0x1.e2637cp-55f, 0x0p+0f,
+	0x1.c1ad08p-3f, -0x1.b84c64p-4f, -0x1.c8a5fcp-6f, 0x1.650a92p-6f, 0x1.ad48dp-11f, -0x1.1a87d4p-9f, 0x1.96f53ep-14f, 0x1.225088p-13f, -0x1.b9f978p-17f, -0x1.b29a6ap-18f, 0x1.d5f5a4p-21f, 0x1.f7881ap-23f, -0x1.5e6b5cp-25f, -0x1.d3899p-28f, 0x1.975424p-30f, 0x1.626e94p-33f, -0x1.84bfdcp-35f, -0x1.b8619cp-39f, 0x1.3aa398p-40f, 0x1.b87656p-45f, -0x1.bda4e8p-46f, -0x1.4ba466p-51f, 0x1.4ba466p-51f, -0x1.982cccp-55f, 0x0p+0f,
+	0x1.ad908ep-4f, -0x1.a9d82cp-4f, 0x1.9438dp-6f, 0x1.2bce3p-7f, -0x1.5212fap-8f, 0x1.2aa294p-14f, 0x1.a465f4p-12f, -0x1.d63268p-15f, -0x1.247f4ap-16f, 0x1.336beap-18f, 0x1.c0bb52p-22f, -0x1.de8f4ap-23f, -0x1.51272cp-31f, 0x1.0b1e5cp-27f, -0x1.ce6696p-32f, -0x1.c9c5aap-33f, 0x1.7ad56cp-36f, 0x1.350bcap-38f, -0x1.89a032p-41f, -0x1.46dbdep-44f, 0x1.3ee2fep-46f, 0x1.fe37fep-51f, -0x1.fe37fep-52f, 0x1.238db6p-55f, 0x0p+0f,
+	0x1.eb18bcp-6f, -0x1.750818p-5f, 0x1.b08cap-6f, -0x1.5adcdap-8f, -0x1.686f08p-10f, 0x1.dda854p-11f, -0x1.a08978p-14f, -0x1.6dee0ep-15f, 0x1.bd9afap-17f, 0x1.813118p-22f, -0x1.69249ep-21f, 0x1.0d0816p-24f, 0x1.4dff64p-26f, -0x1.166accp-28f, -0x1.36e5e8p-32f, 0x1.3d4d38p-33f, -0x1.6ef49cp-39f, -0x1.f9545cp-39f, 0x1.451d6ep-42f, 0x1.27f77ap-44f, -0x1.66bf5ep-47f, -0x1.ebff22p-51f, 0x1.47ff6cp-52f, -0x1.5ddd4p-56f, 0x0p+0f,
+	0x1.448df8p-8f, -0x1.534edep-7f, 0x1.31f1d6p-7f, -0x1.262644p-8f, 0x1.0ca2bp-10f, 0x1.e2021ep-15f, -0x1.b4fef8p-14f, 0x1.8f3fe6p-16f, 0x1.00fe9ep-20f, -0x1.8ebc32p-20f, 0x1.d20c78p-23f, 0x1.05d752p-25f, -0x1.bccd88p-27f, 0x1.374766p-31f, 0x1.918ad6p-32f, -0x1.f43252p-35f, -0x1.532502p-38f, 0x1.143c5p-39f, -0x1.a4ee32p-45f, -0x1.7ea9fep-45f, 0x1.322198p-48f, 0x1.5ddd4p-51f, -0x1.5ddd4p-53f, 0x1.5ddd4p-57f, 0x0p+0f,
+	0x1.d50af8p-12f, -0x1.405efcp-10f, 0x1.8d53e2p-10f, -0x1.2284e2p-10f, 0x1.0c63b2p-11f, -0x1.291e5ep-13f, 0x1.d1ff3cp-17f, 0x1.7c7618p-18f, -0x1.5ab69ep-19f, 0x1.79d896p-22f, 0x1.a67338p-25f, -0x1.bee52ap-26f, 0x1.7c88ap-29f, 0x1.1b82a4p-31f, -0x1.7e96d4p-33f, 0x1.0ffd5p-37f, 0x1.254a46p-38f, -0x1.8d6ccep-41f, -0x1.113efcp-45f, 0x1.6cba06p-46f, -0x1.6b87e6p-50f, -0x1.7ea9fep-52f, 0x1.322198p-54f, -0x1.201f9ep-58f, 0x0p+0f,
+	0x1.535214p-16f, -0x1.278426p-14f, 0x1.dfa9a4p-14f, -0x1.de0d22p-14f, 0x1.436a1cp-14f, -0x1.33d29p-15f, 0x1.95e15cp-17f, -0x1.485bb8p-19f, 0x1.b9a806p-24f, 0x1.e06ebp-24f, -0x1.44a80cp-25f, 0x1.2ec02cp-28f, 0x1.511846p-31f, -0x1.4bec0cp-32f, 0x1.35c294p-35f, 0x1.172682p-38f, -0x1.e5a78cp-40f, 0x1.3aa488p-43f, 0x1.eea648p-46f, -0x1.fa7794p-48f, 0x1.b02f6ep-53f, 0x1.442392p-53f, -0x1.b02f6ep-56f, 0x1.802a28p-60f, 0x0p+0f,
+	0x1.aa0f3p-22f, -0x1.d6a0b2p-20f, 0x1.eb799p-19f, -0x1.41888p-18f, 0x1.2623a6p-18f, -0x1.8ce226p-19f, 0x1.9499acp-20f, -0x1.37defap-21f, 0x1.5ff9a2p-23f, -0x1.016a1cp-25f, 0x1.982a1p-30f, 0x1.212c22p-30f, -0x1.96f8b6p-32f, 0x1.c55952p-35f, 0x1.30ce7p-39f, -0x1.4330cp-39f, 0x1.abe194p-42f, 0x1.b14f8ep-50f, -0x1.8fc7ep-47f, 0x1.e5d552p-50f, 0x1.2c20fp-55f, -0x1.a42e1cp-55f, 0x1.e034b2p-58f, -0x1.946246p-62f, 0x0p+0f,
+	0x1.6a1b56p-29f, -0x1.01652cp-26f, 0x1.5caaa8p-25f, -0x1.2af86ep-24f, 0x1.6b8f74p-24f, -0x1.4c96f8p-24f, 0x1.d98064p-25f, -0x1.0b2e2ep-25f, 0x1.e133acp-27f, -0x1.57923p-28f, 0x1.7a5e16p-30f, -0x1.28371cp-32f, 0x1.d18fe8p-36f, 0x1.120b14p-38f, -0x1.3bafp-39f, 0x1.f17698p-42f, -0x1.de547ep-46f, -0x1.3b2296p-47f, 0x1.77292cp-49f, -0x1.16039p-52f, -0x1.f97ad8p-56f, 0x1.946246p-57f, -0x1.946246p-60f, 0x1.4381d2p-64f, 0x0p+0f,
+	0x1.ff6a8cp-39f, -0x1.e995p-36f, 0x1.c00fbap-34f, -0x1.04bcc2p-32f, 0x1.b0fb9p-32f, -0x1.10b8cap-31f, 0x1.0e78a4p-31f, -0x1.b070fp-32f, 0x1.1ad4dp-32f, -0x1.3128a4p-33f, 0x1.10185ep-34f, -0x1.8ec6aap-36f, 0x1.d8147ap-38f, -0x1.b0d9fp-40f, 0x1.1102dap-42f, -0x1.d98bf8p-47f, -0x1.a025acp-48f, 0x1.2ad0cap-49f, -0x1.75a902p-52f, 0x1.5532eap-57f, 0x1.188a94p-57f, -0x1.10f588p-59f, 0x1.e542bap-63f, -0x1.71b8fp-67f, 0x0p+0f,
+	0x1.761afcp-52f, -0x1.0ce332p-48f, 0x1.71b7dap-46f, -0x1.437fecp-44f, 0x1.945d88p-43f, -0x1.802128p-42f, 0x1.20121ep-41f, -0x1.5dbc74p-41f, 0x1.5d9ba8p-41f, -0x1.23206p-41f, 0x1.96faaap-42f, -0x1.df8fe6p-43f, 0x1.dcbc52p-44f, -0x1.8e9bbep-45f, 0x1.15e312p-46f, -0x1.3d1082p-48f, 0x1.1c43c4p-50f, -0x1.682786p-53f, 0x1.802a28p-57f, 0x1.946246p-59f, -0x1.4381d2p-60f, 0x1.ce272cp-63f, -0x1.71b8fp-66f, 0x1.0ce396p-70f, 0x0p+0f,
+	0x1.761b42p-75f, -0x1.0ce396p-70f, 0x1.71b8fp-67f, -0x1.4381d2p-64f, 0x1.946246p-62f, -0x1.802a28p-60f, 0x1.201f9ep-58f, -0x1.5ddd4p-57f, 0x1.5ddd4p-56f, -0x1.238db6p-55f, 0x1.982cccp-55f, -0x1.e2637cp-55f, 0x1.e2637cp-55f, -0x1.982cccp-55f, 0x1.238db6p-55f, -0x1.5ddd4p-56f, 0x1.5ddd4p-57f, -0x1.201f9ep-58f, 0x1.802a28p-60f, -0x1.946246p-62f, 0x1.4381d2p-64f, -0x1.71b8fp-67f, 0x1.0ce396p-70f, -0x1.761b42p-75f, 0x0p+0f,
+	0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+};
@@ -0,0 +1,357 @@
+/*!
+\file	LRibin.c
+\brief	Set of LibRan integer binning functions
+
+This set of LibRan functions will set-up or take-down the `LR_ibin` object
+for tallying integer values, such as the output of the discrete
+distributions from \c LRi_RAN() .
+Unlike the `LR_bin` object the range of values need not be known ahead
+of time, and there is one bin for each distinct value.
+
+Values in a small range [0,nd) are tallied directly in an array,
+which is the common case for the Poisson, geometric, and binomial
+distributions.  Any other values are tallied in an open addressing
+hash table, so only the values actually seen take any memory
+even for a heavy tail.
+
+Partial tallies (e.g. one per thread) can be combined with
+\c LR_ibin_merge() , and the results extracted in order with
+\c LR_ibin_export() .
+
+\code
+#include <stdio.h>
+#include <stdlib.h>
+#include "libran.h"
+...
+LR_obj *o = LR_new(poisson, LR_int);
+LR_set(o, 'p', 12.5);
+LR_ibin *b = LR_ibin_new(0);
+...
+// tally samples
+for (int i = 0; i < 10000; i++) {
+	LR_ibin_add(b, LRi_RAN(o));
+}
+...
+// view results
+size_t m = LR_ibin_size(b);
+int *k = malloc(m * sizeof(int));
+long *c = malloc(m * sizeof(long));
+LR_ibin_export(b, k, c);
+for (size_t i = 0; i < m; i++) {
+	fprint("%d : %ld\n", k[i], c[i]);
+}
+...
+LR_ibin_rm(&b);
+\endcode
+
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>	/* malloc,calloc,qsort,free */
+#include "libran.h"
+
+/* default number of dense bins, and initial hash table slots */
+#define LR_IBIN_DENSE	256
+#define LR_IBIN_CAP	64
+
+/* the home slot for k (a multiplicative hash) */
+static inline size_t LR_ibin_hash(const LR_ibin *b, int k) {
+	unsigned int	h = (unsigned int) k * 0x9E3779B1u;
+	return (size_t) (h ^ (h >> 16)) & (b->cap - 1);
+}
+
+/* double the hash table */
+static int LR_ibin_grow(LR_ibin *b) {
+	size_t	cap = b->cap, j;
+	int	*keys = b->keys;
+	long	*vals = b->vals;
+
+	b->cap = 2 * cap;
+	b->keys = (int *) malloc(b->cap * sizeof(int));
+	b->vals = (long *) calloc(b->cap, sizeof(long));
+	if (!b->keys || !b->vals) {
+		free((void *) b->keys);
+		free((void *) b->vals);
+		b->cap = cap;
+		b->keys = keys;
+		b->vals = vals;
+		return b->errno = LRerr_AllocFail;
+	}
+	for (size_t i = 0; i < cap; i++) {
+		if (!vals[i])
+			continue;
+		for (j = LR_ibin_hash(b, keys[i]); b->vals[j];
+			j = (j + 1) & (b->cap - 1));
+		b->keys[j] = keys[i];
+		b->vals[j] = vals[i];
+	}
+	free((void *) keys);
+	free((void *) vals);
+	return LRerr_OK;
+}
+
+/* add n to the hash table count for k */
+static int LR_ibin_hadd(LR_ibin *b, int k, long n) {
+	size_t	j;
+
+	for (j = LR_ibin_hash(b, k); b->vals[j]; j = (j + 1) & (b->cap - 1)) {
+		if (b->keys[j] == k) {
+			b->vals[j] += n;
+			return LRerr_OK;
+		}
+	}
+	/* a new key - keep the table at most half full */
+	if (2 * (b->used + 1) > b->cap) {
+		if (LR_ibin_grow(b))
+			return b->errno;
+		for (j = LR_ibin_hash(b, k); b->vals[j];
+			j = (j + 1) & (b->cap - 1));
+	}
+	b->keys[j] = k;
+	b->vals[j] = n;
+	b->used++;
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_ibin_new(int nd) - create new integer binning object
+
+This routine creates a new `LR_ibin` object with \e nd dense bins
+for the values [0,nd), any other values are tallied in the hash table.
+
+@param	nd	number of dense bins (0 for the default of 256)
+@return	LR_ibin object if successful, else NULL
+*/
+LR_ibin *LR_ibin_new(int nd) {
+	LR_ibin *ptr = (void *) NULL;
+
+	if (nd < 0)
+		return ptr;
+	if (!(ptr = (LR_ibin *) malloc(sizeof(LR_ibin))))
+		return ptr;
+	ptr->c = 0;
+	ptr->nd = (nd ? nd : LR_IBIN_DENSE);
+	ptr->cap = LR_IBIN_CAP;
+	ptr->used = 0;
+	ptr->errno = 0;
+
+	if (!(ptr->dense = (long *) calloc(ptr->nd, sizeof(long))))
+		goto bad0;
+	if (!(ptr->keys = (int *) malloc(ptr->cap * sizeof(int))))
+		goto bad1;
+	if (!(ptr->vals = (long *) calloc(ptr->cap, sizeof(long))))
+		goto bad2;
+
+	return ptr;
+
+bad2:
+	free((void *) ptr->keys);
+bad1:
+	free((void *) ptr->dense);
+bad0:
+	free((void *) ptr);
+	return (void *) NULL;
+}
+
+/*!
+@brief	LR_ibin_rm(LR_ibin **b) - remove integer binning object
+
+@param	b	LR_ibin object address
+@return	0 if successful, else non-zero if failed
+*/
+int LR_ibin_rm(LR_ibin **b) {
+	if (b && *b) {
+		free((void *) (*b)->vals);
+		free((void *) (*b)->keys);
+		free((void *) (*b)->dense);
+		free((void *) *b);
+		*b = (LR_ibin *) NULL;
+		return LRerr_OK;
+	}
+	return LRerr_BinGeneric;
+}
+
+/*!
+@brief	LR_ibin_add(LR_ibin *b, int k) - collect value to be binned.
+
+@param	b	LR_ibin object
+@param	k	value to count
+@return	0 if successful, else non-zero if failed
+*/
+int LR_ibin_add(LR_ibin *b, int k) {
+	if ((unsigned int) k < (unsigned int) b->nd) {
+		b->dense[k]++;
+	} else if (LR_ibin_hadd(b, k, 1)) {
+		return b->errno;
+	}
+	b->c++;
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_ibin_add_n(LR_ibin *b, const int *k, size_t n) - collect
+an array of values to be binned.
+
+This is the batch version of \c LR_ibin_add() with the same results.
+
+@param	b	LR_ibin object
+@param	k	array of values to count
+@param	n	number of values
+@return	0 if successful, else non-zero if failed
+*/
+int LR_ibin_add_n(LR_ibin *b, const int *k, size_t n) {
+	long	*dense = b->dense, bad = 0;
+	unsigned int nd = (unsigned int) b->nd;
+
+	for (size_t i = 0; i < n; i++) {
+		if ((unsigned int) k[i] < nd)
+			dense[k[i]]++;
+		else if (LR_ibin_hadd(b, k[i], 1))
+			bad++;
+	}
+	b->c += n - bad;
+	return (bad ? b->errno : LRerr_OK);
+}
+
+/*!
+@brief	LR_ibin_get(const LR_ibin *b, int k) - the count for a value
+
+@param	b	LR_ibin object
+@param	k	value
+@return	number of times \e k was tallied
+*/
+long LR_ibin_get(const LR_ibin *b, int k) {
+	size_t	j;
+
+	if ((unsigned int) k < (unsigned int) b->nd)
+		return b->dense[k];
+	for (j = LR_ibin_hash(b, k); b->vals[j]; j = (j + 1) & (b->cap - 1))
+		if (b->keys[j] == k)
+			return b->vals[j];
+	return 0;
+}
+
+/*!
+@brief	LR_ibin_size(const LR_ibin *b) - the number of distinct values
+tallied
+
+This is the length of the arrays needed by \c LR_ibin_export() .
+
+@param	b	LR_ibin object
+@return	number of distinct values
+*/
+size_t LR_ibin_size(const LR_ibin *b) {
+	size_t	m = b->used;
+
+	for (int i = 0; i < b->nd; i++)
+		m += (b->dense[i] != 0);
+	return m;
+}
+
+/*!
+@brief	LR_ibin_merge(LR_ibin *dst, const LR_ibin *src) - add the tallies
+of one integer binning object to another
+
+The objects need not have the same number of dense bins.
+
+@param	dst	LR_ibin object to add to
+@param	src	LR_ibin object to add
+@return	0 if successful, else non-zero if failed
+*/
+int LR_ibin_merge(LR_ibin *dst, const LR_ibin *src) {
+	if (!dst || !src)
+		return LRerr_BinGeneric;
+
+	for (int i = 0; i < src->nd; i++) {
+		if (!src->dense[i])
+			continue;
+		if (i < dst->nd)
+			dst->dense[i] += src->dense[i];
+		else if (LR_ibin_hadd(dst, i, src->dense[i]))
+			return dst->errno;
+	}
+	for (size_t j = 0; j < src->cap; j++) {
+		if (!src->vals[j])
+			continue;
+		if ((unsigned int) src->keys[j] < (unsigned int) dst->nd)
+			dst->dense[src->keys[j]] += src->vals[j];
+		else if (LR_ibin_hadd(dst, src->keys[j], src->vals[j]))
+			return dst->errno;
+	}
+	dst->c += src->c;
+
+	return LRerr_OK;
+}
+
+/* for qsort() */
+typedef struct {
+	int	k;
+	long	v;
+} LR_ibin_kv;
+static int LR_ibin_cmp(const void *a, const void *b) {
+	int	x = ((const LR_ibin_kv *) a)->k, y = ((const LR_ibin_kv *) b)->k;
+	return (x > y) - (x < y);
+}
+
+/*!
+@brief	LR_ibin_export(const LR_ibin *b, int *keys, long *counts) -
+extract the tallies in order
+
+The distinct values tallied are stored in increasing order in \e keys
+and their counts in \e counts , both arrays must have at least
+\c LR_ibin_size() elements.
+
+@param	b	LR_ibin object
+@param	keys	array for the values
+@param	counts	array for the counts
+@return	0 if successful, else non-zero if failed
+*/
+int LR_ibin_export(const LR_ibin *b, int *keys, long *counts) {
+	LR_ibin_kv	*kv = (LR_ibin_kv *) NULL;
+	size_t		m = 0, h = 0;
+
+	if (!b || !keys || !counts)
+		return LRerr_BinGeneric;
+	/* sort the hash table entries */
+	if (b->used) {
+		if (!(kv = (LR_ibin_kv *) malloc(b->used * sizeof(LR_ibin_kv))))
+			return LRerr_AllocFail;
+		for (size_t j = 0; j < b->cap; j++) {
+			if (b->vals[j]) {
+				kv[h].k = b->keys[j];
+				kv[h].v = b->vals[j];
+				h++;
+			}
+		}
+		qsort(kv, h, sizeof(LR_ibin_kv), LR_ibin_cmp);
+	}
+	/* the negative values, the dense values, then the rest */
+	for (h = 0; h < b->used && kv[h].k < 0; h++, m++) {
+		keys[m] = kv[h].k;
+		counts[m] = kv[h].v;
+	}
+	for (int i = 0; i < b->nd; i++) {
+		if (b->dense[i]) {
+			keys[m] = i;
+			counts[m] = b->dense[i];
+			m++;
+		}
+	}
+	for (; h < b->used; h++, m++) {
+		keys[m] = kv[h].k;
+		counts[m] = kv[h].v;
+	}
+	free((void *) kv);
+
+	return LRerr_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
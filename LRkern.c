@@ -0,0 +1,327 @@
+/*!
+\file	LRkern.c
+\brief	LibRan batch kernels for each instruction set
+
+The batch methods (\c LR_drand_n() , \c LR_frand_n() , and the
+\c LRd_RAN_n() and \c LRf_RAN_n() methods of \e unif , \e nexp ,
+\e gausbm , \e cauchy , and the \e gsn types) spend their time in a few short loops.
+Those loops (LRkernisa.h) are compiled several times here, for the
+baseline instruction set and, with GCC or Clang on x86-64, for SSE4.2,
+AVX2 (with FMA), and AVX-512, so a portable build of the library
+still uses the widest vectors the CPU has.
+
+The kernels are chosen at the first batch call, the widest the CPU
+supports unless the \c LR_ISA environment variable names another
+( \e generic , \e sse4.2 , \e avx2 , or \e avx512 , ignored if the CPU
+lacks it).  \c LR_isa() gives the choice and \c LR_isa_set() changes it.
+Every instruction set gives the same uniforms, bit for bit, as
+\c LR_drand() and \c LR_frand() , and the transforms differ only by
+rounding (FMA contractions).
+
+The urand uniforms are made \c LR_KERN_LANES at a time: the first
+states are stepped one at a time, and then each from the one
+\c LR_KERN_LANES before it, with the multiplier and increment raised to
+that step.  This removes the serial dependence of the generator.
+
+\code
+#include "libran.h"
+...
+LR_obj *o = LR_new(unif, LR_double);
+double x[4096];
+...
+LR_drand_n(o, x, 4096);
+printf("kernels: %s\n", LR_isa());
+\endcode
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math.h>
+#include <limits.h>	/* ULONG_MAX */
+#include <stdlib.h>	/* getenv */
+#include <string.h>	/* strcmp */
+#include <pthread.h>
+#include "libran.h"
+#include "LRmathf.h"
+#include "LRmathd.h"
+#include "LRkern.h"
+
+/* the urand states that are stepped together */
+#define	LR_KERN_LANES	16
+#define	LR_KERN_LMASK	0x7fffffffffffffffUL
+#define	LR_KERN_IMASK	0x7fffffffU
+
+/* the urand state y as a uniform, exactly as LR_drand() and LR_frand()
+ * (y is split so the conversion needs no 64 bit integer conversions) */
+static inline double LR_kern_l2u(unsigned long y) {
+	const double	two32 = 4294967296.0, two52 = 4503599627370496.0,
+			scale = 1.0 / 9223372036854775808.0,
+			dmax = 1. - 1. / 9007199254740992.;
+	double		x = (double) (int) (y >> 32) * two32
+		+ (LR_l2d((y & 0xffffffffUL) | 0x4330000000000000UL) - two52);
+
+	x = x * scale;
+	return (x < dmax ? x : dmax);
+}
+static inline float LR_kern_i2u(unsigned int y) {
+	const float	scale = 1.0f / 2147483648.0f,
+			fmax = 1.f - 1.f / 16777216.f;
+	float		x = (float) (int) y * scale;
+
+	return (x < fmax ? x : fmax);
+}
+
+/* each instruction set's kernels, as LR_KERN(kern) */
+#define	LR_KERN_NAME	"generic"
+#define	LR_KERN(f)	LR_kern_gen_##f
+#define	LR_KERN_ATTR
+#include "LRkernisa.h"
+#undef	LR_KERN_NAME
+#undef	LR_KERN
+#undef	LR_KERN_ATTR
+
+#ifdef LR_HAVE_ISA
+#  define	LR_KERN_NAME	"sse4.2"
+#  define	LR_KERN(f)	LR_kern_sse42_##f
+#  define	LR_KERN_ATTR	__attribute__((target("sse4.2")))
+#  include "LRkernisa.h"
+#  undef	LR_KERN_NAME
+#  undef	LR_KERN
+#  undef	LR_KERN_ATTR
+
+#  define	LR_KERN_NAME	"avx2"
+#  define	LR_KERN(f)	LR_kern_avx2_##f
+#  define	LR_KERN_ATTR	__attribute__((target("avx2,fma")))
+#  include "LRkernisa.h"
+#  undef	LR_KERN_NAME
+#  undef	LR_KERN
+#  undef	LR_KERN_ATTR
+
+#  define	LR_KERN_NAME	"avx512"
+#  define	LR_KERN(f)	LR_kern_avx512_##f
+#  define	LR_KERN_ATTR	\
+	__attribute__((target("avx512f,avx512dq,avx512vl,avx2,fma")))
+#  include "LRkernisa.h"
+#  undef	LR_KERN_NAME
+#  undef	LR_KERN
+#  undef	LR_KERN_ATTR
+#endif
+
+/* widest first */
+static const LR_kern *lr_kerns[] = {
+#ifdef LR_HAVE_ISA
+	&LR_kern_avx512_kern,
+	&LR_kern_avx2_kern,
+	&LR_kern_sse42_kern,
+#endif
+	&LR_kern_gen_kern,
+	(LR_kern *) NULL
+};
+
+/* all the names, whether compiled or not */
+static const char *lr_isas[] = {
+	"avx512", "avx2", "sse4.2", "generic", (char *) NULL
+};
+
+static pthread_once_t lr_kern_once = PTHREAD_ONCE_INIT;
+static const LR_kern * volatile lr_kern = &LR_kern_gen_kern;
+/* whether the kernels can step urand, & the constants to do so */
+static int lr_kern_urand = 0;
+static unsigned long lr_la, lr_lc, lr_lak, lr_lck;
+static unsigned int lr_ia, lr_ic, lr_iak, lr_ick;
+
+static int LR_kern_cpu(const LR_kern *k) {
+#ifdef LR_HAVE_ISA
+	if (k == &LR_kern_avx512_kern)
+		return __builtin_cpu_supports("avx512f")
+			&& __builtin_cpu_supports("avx512dq")
+			&& __builtin_cpu_supports("avx512vl")
+			&& __builtin_cpu_supports("avx2")
+			&& __builtin_cpu_supports("fma");
+	if (k == &LR_kern_avx2_kern)
+		return __builtin_cpu_supports("avx2")
+			&& __builtin_cpu_supports("fma");
+	if (k == &LR_kern_sse42_kern)
+		return __builtin_cpu_supports("sse4.2");
+#endif
+	return 1;
+}
+
+/* the supported kernels by name (NULL for the widest), else NULL */
+static const LR_kern *LR_kern_find(const char *name) {
+	for (int i = 0; lr_kerns[i]; i++) {
+		if (LR_kern_cpu(lr_kerns[i])
+		&& (!name || !strcmp(name, lr_kerns[i]->name)))
+			return lr_kerns[i];
+	}
+	return (LR_kern *) NULL;
+}
+
+/* the LR_ISA kernels if supported, else the widest */
+static const LR_kern *LR_kern_default(void) {
+	const LR_kern	*k = (LR_kern *) NULL;
+	char		*env = getenv("LR_ISA");
+
+	if (env)
+		k = LR_kern_find(env);
+	return (k ? k : LR_kern_find(NULL));
+}
+
+static void LR_kern_init(void) {
+#ifdef LR_HAVE_ISA
+	__builtin_cpu_init();
+#endif
+	lr_kern = LR_kern_default();
+
+	/* the kernels assume urand is mod 2^63 and 2^31 (as on LP64) */
+#if ULONG_MAX > 0xffffffffUL
+	lr_kern_urand = (LR_lgetval("LR_IRAND_LMAX2") == 0x4000000000000000L
+		&& LR_igetval("LR_IRAND_IMAX2") == 0x40000000);
+#endif
+	lr_la = lr_lak = LR_lgetval("LR_LA");
+	lr_lc = lr_lck = LR_lgetval("LR_LC");
+	lr_ia = lr_iak = LR_igetval("LR_IA");
+	lr_ic = lr_ick = LR_igetval("LR_IC");
+	/* y -> a y + c, LR_KERN_LANES times, is y -> a^k y + c (a^{k-1}+...+1) */
+	for (int i = 1; i < LR_KERN_LANES; i++) {
+		lr_lck = (lr_la * lr_lck + lr_lc) & LR_KERN_LMASK;
+		lr_lak = (lr_la * lr_lak) & LR_KERN_LMASK;
+		lr_ick = (lr_ia * lr_ick + lr_ic) & LR_KERN_IMASK;
+		lr_iak = (lr_ia * lr_iak) & LR_KERN_IMASK;
+	}
+}
+
+/*!
+@brief	LR_kern_get() - the batch kernels in use (internal)
+
+@return	LR_kern table
+*/
+const LR_kern *LR_kern_get(void) {
+	(void) pthread_once(&lr_kern_once, LR_kern_init);
+	return lr_kern;
+}
+
+/*!
+@brief	LR_isa() - the instruction set of the batch kernels
+
+@return	its name: "generic", "sse4.2", "avx2", or "avx512"
+*/
+const char *LR_isa(void) {
+	return LR_kern_get()->name;
+}
+
+/*!
+@brief	LR_isa_set(const char *name) - choose the batch kernels
+
+Uses the kernels for the named instruction set, or, with \e name
+NULL, the choice made at the first use (from the CPU and \c LR_ISA ).
+This affects every object and should be called before the threads that
+use the library start.
+
+@param	name	"generic", "sse4.2", "avx2", "avx512", or NULL
+@return	0 if successful, else LRerr_InvalidInputValue if not a known
+	instruction set, or LRerr_UnmetPreconditions if this CPU lacks it
+*/
+int LR_isa_set(const char *name) {
+	const LR_kern	*k;
+
+	(void) LR_kern_get();
+	if (!name) {
+		lr_kern = LR_kern_default();
+		return LRerr_OK;
+	}
+	if ((k = LR_kern_find(name))) {
+		lr_kern = k;
+		return LRerr_OK;
+	}
+	for (int i = 0; lr_isas[i]; i++) {
+		if (!strcmp(name, lr_isas[i]))
+			return LRerr_UnmetPreconditions;
+	}
+	return LRerr_InvalidInputValue;
+}
+
+/*!
+@brief	LR_drand_n(LR_obj *o, double *x, long n) - a batch of uniforms
+
+Fills \e x with the next \e n double uniforms [0,1) of the object,
+the same sequence as \e n calls of its \e ud (normally \c LR_drand() ),
+made by the batch kernels when \e ud is \c LR_drand() .
+
+@param	o	LR_obj object
+@param	x	array of at least \e n values
+@param	n	number of uniforms
+@return	0 if successful, else LRerr_InvalidInputValue
+*/
+int LR_drand_n(LR_obj *o, double *x, long n) {
+	const LR_kern	*k;
+	unsigned long	y;
+
+	if (!o)
+		return LRerr_InvalidInputValue;
+	if (n < 0 || (n && !x))
+		return o->errno = LRerr_InvalidInputValue;
+	if (n == 0)
+		return LRerr_OK;
+	k = LR_kern_get();
+	if (o->ud != LR_drand || !lr_kern_urand) {
+		for (long i = 0; i < n; i++)
+			x[i] = o->ud(o);
+		return LRerr_OK;
+	}
+	LR_COUNT(o, uniforms, n);
+	y = (unsigned long) o->iy.l;
+	for (long i = 0; i < n && i < LR_KERN_LANES; i++) {
+		y = (lr_la * y + lr_lc) & LR_KERN_LMASK;
+		x[i] = LR_l2d(y);
+	}
+	o->iy.l = (long) k->drand(x, n, lr_lak, lr_lck);
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_frand_n(LR_obj *o, float *x, long n) - a batch of uniforms
+
+Fills \e x with the next \e n float uniforms [0,1) of the object,
+the same sequence as \e n calls of its \e uf (normally \c LR_frand() ),
+made by the batch kernels when \e uf is \c LR_frand() .
+
+@param	o	LR_obj object
+@param	x	array of at least \e n values
+@param	n	number of uniforms
+@return	0 if successful, else LRerr_InvalidInputValue
+*/
+int LR_frand_n(LR_obj *o, float *x, long n) {
+	const LR_kern	*k;
+	unsigned int	y;
+
+	if (!o)
+		return LRerr_InvalidInputValue;
+	if (n < 0 || (n && !x))
+		return o->errno = LRerr_InvalidInputValue;
+	if (n == 0)
+		return LRerr_OK;
+	k = LR_kern_get();
+	if (o->uf != LR_frand || !lr_kern_urand) {
+		for (long i = 0; i < n; i++)
+			x[i] = o->uf(o);
+		return LRerr_OK;
+	}
+	LR_COUNT(o, uniforms, n);
+	y = (unsigned int) o->iy.i;
+	for (long i = 0; i < n && i < LR_KERN_LANES; i++) {
+		y = (lr_ia * y + lr_ic) & LR_KERN_IMASK;
+		x[i] = LR_i2f(y);
+	}
+	o->iy.i = (int) k->frand(x, n, lr_iak, lr_ick);
+	return LRerr_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
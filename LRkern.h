@@ -0,0 +1,60 @@
+/*!	\file LRkern.h
+ *	\brief The batch kernels for each instruction set (internal)
+
+The inner loops of the batch methods (\c LR_drand_n() , \c LR_frand_n() ,
+and the \c LR?_*_RAN_n() methods) are compiled once for each instruction
+set (see LRkern.c and LRkernisa.h), and \c LR_kern_get() gives the table
+of those selected at first use.
+
+This header is not installed.
+ */
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+
+#ifndef 	_LRKERN_H_
+#  define	_LRKERN_H_
+#  ifdef __cplusplus
+extern "C" {
+#  endif
+
+/*!
+\struct	LR_kern
+\brief	the batch kernels for one instruction set
+
+The transforms work in place on the uniforms in \e x , and the
+double \e nexp , \e gausbm , and \e cauchy ones are the fast math
+versions (see \c LR_fast()).  The \e gausbm ones make \e np pairs.
+The \e gsn ones make \e nv variates \f$ a + s (u_1 + \cdots + u_k - c) \f$
+from the \e k consecutive uniforms each in \e u .
+*/
+typedef struct {
+	const char *	name;	/*!< name - of the instruction set */
+	/*!< urand uniforms from the first states, returning the last */
+	unsigned long (*drand)(double *x, long n, unsigned long a,
+		unsigned long c);
+	unsigned int (*frand)(float *x, long n, unsigned int a,
+		unsigned int c);
+	/*!< transforms of the uniforms */
+	void (*dunif)(double *x, long n, double a, double s);
+	void (*dnexp)(double *x, long n, double s);
+	void (*dgausbm)(double *x, long np, double m, double s);
+	void (*dcauchy)(double *x, long n, double m, double s);
+	void (*funif)(float *x, long n, float a, float s);
+	void (*fnexp)(float *x, long n, float s);
+	void (*fgausbm)(float *x, long np, float m, float s);
+	void (*fcauchy)(float *x, long n, float m, float s);
+	/*!< sums of k uniforms each (the gsn types) */
+	void (*dgsn)(double *x, const double *u, long nv, int k, double a,
+		double s, double c);
+	void (*fgsn)(float *x, const float *u, long nv, int k, float a,
+		float s, float c);
+} LR_kern;
+
+const LR_kern *LR_kern_get(void);
+
+#  ifdef __cplusplus
+}
+#  endif
+#endif	/* _LRKERN_H_ */
@@ -0,0 +1,139 @@
+/*!	\file LRkernisa.h
+ *	\brief The batch kernel loops, compiled once per instruction set (internal)
+
+LRkern.c includes this once for each instruction set, with
+\c LR_KERN(name) adding the set's suffix to each function name and
+\c LR_KERN_ATTR giving its \c target attribute, so it has no include
+guard.  The loops are written to be vectorized (see LRmathf.h and
+LRmathd.h), and the compiler uses the widest vectors of each set.
+
+This header is not installed.
+ */
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+
+/* the urand sequence is y' = a y + c (mod 2^63), so from the first
+ * LR_KERN_LANES states (as bits in x) a and c step LR_KERN_LANES ahead */
+static LR_KERN_ATTR unsigned long LR_KERN(drand)(double *x, long n,
+unsigned long a, unsigned long c) {
+	unsigned long	last;
+
+	for (long i = LR_KERN_LANES; i < n; i++)
+		x[i] = LR_l2d((a * LR_d2l(x[i - LR_KERN_LANES]) + c)
+			& LR_KERN_LMASK);
+	last = LR_d2l(x[n - 1]);
+	for (long i = 0; i < n; i++)
+		x[i] = LR_kern_l2u(LR_d2l(x[i]));
+	return last;
+}
+
+/* and y' = a y + c (mod 2^31) */
+static LR_KERN_ATTR unsigned int LR_KERN(frand)(float *x, long n,
+unsigned int a, unsigned int c) {
+	unsigned int	last;
+
+	for (long i = LR_KERN_LANES; i < n; i++)
+		x[i] = LR_i2f((a * (unsigned int) LR_f2i(x[i - LR_KERN_LANES])
+			+ c) & LR_KERN_IMASK);
+	last = LR_f2i(x[n - 1]);
+	for (long i = 0; i < n; i++)
+		x[i] = LR_kern_i2u(LR_f2i(x[i]));
+	return last;
+}
+
+static LR_KERN_ATTR void LR_KERN(dunif)(double *x, long n, double a,
+double s) {
+	for (long i = 0; i < n; i++)
+		x[i] = a + x[i] * s;
+}
+
+static LR_KERN_ATTR void LR_KERN(dnexp)(double *x, long n, double s) {
+	for (long i = 0; i < n; i++)
+		x[i] = s*LR_logd(x[i]);
+}
+
+static LR_KERN_ATTR void LR_KERN(dgausbm)(double *x, long np, double m,
+double s) {
+	double	one = 1.0, ntwo = -2.0, twopi = 2.0 * M_PI, c, z1, z2;
+
+	for (long i = 0; i < np; i++) {
+		c = sqrt(ntwo * LR_logd(one - x[2*i]));
+		LR_sincosd(twopi * x[2*i+1], &z1, &z2);
+		x[2*i] = m + s * (c * z1);
+		x[2*i+1] = m + s * (c * z2);
+	}
+}
+
+static LR_KERN_ATTR void LR_KERN(dcauchy)(double *x, long n, double m,
+double s) {
+	double	pi = M_PI;
+
+	for (long i = 0; i < n; i++)
+		x[i] = m + s*LR_tand(pi * x[i]);
+}
+
+static LR_KERN_ATTR void LR_KERN(funif)(float *x, long n, float a,
+float s) {
+	for (long i = 0; i < n; i++)
+		x[i] = a + x[i] * s;
+}
+
+static LR_KERN_ATTR void LR_KERN(fnexp)(float *x, long n, float s) {
+	for (long i = 0; i < n; i++)
+		x[i] = s*LR_logf(x[i]);
+}
+
+static LR_KERN_ATTR void LR_KERN(fgausbm)(float *x, long np, float m,
+float s) {
+	float	one = 1.0, ntwo = -2.0, twopi = 2.0 * M_PI, c, z1, z2;
+
+	for (long i = 0; i < np; i++) {
+		c = sqrtf(ntwo * LR_logf(one - x[2*i]));
+		LR_sincosf(twopi * x[2*i+1], &z1, &z2);
+		x[2*i] = m + s * (c * z1);
+		x[2*i+1] = m + s * (c * z2);
+	}
+}
+
+static LR_KERN_ATTR void LR_KERN(fcauchy)(float *x, long n, float m,
+float s) {
+	float	pi = M_PI;
+
+	for (long i = 0; i < n; i++)
+		x[i] = m + s*LR_tanf(pi * x[i]);
+}
+
+/* summed in the same order as the scalar methods, so the same but for FMA */
+static LR_KERN_ATTR void LR_KERN(dgsn)(double *x, const double *u, long nv,
+int k, double a, double s, double c) {
+	for (long v = 0; v < nv; v++)
+		x[v] = u[v*k];
+	for (int i = 1; i < k; i++) {
+		for (long v = 0; v < nv; v++)
+			x[v] += u[v*k + i];
+	}
+	for (long v = 0; v < nv; v++)
+		x[v] = a + s*(x[v] - c);
+}
+
+static LR_KERN_ATTR void LR_KERN(fgsn)(float *x, const float *u, long nv,
+int k, float a, float s, float c) {
+	for (long v = 0; v < nv; v++)
+		x[v] = u[v*k];
+	for (int i = 1; i < k; i++) {
+		for (long v = 0; v < nv; v++)
+			x[v] += u[v*k + i];
+	}
+	for (long v = 0; v < nv; v++)
+		x[v] = a + s*(x[v] - c);
+}
+
+static const LR_kern LR_KERN(kern) = {
+	LR_KERN_NAME,
+	LR_KERN(drand), LR_KERN(frand),
+	LR_KERN(dunif), LR_KERN(dnexp), LR_KERN(dgausbm), LR_KERN(dcauchy),
+	LR_KERN(funif), LR_KERN(fnexp), LR_KERN(fgausbm), LR_KERN(fcauchy),
+	LR_KERN(dgsn), LR_KERN(fgsn)
+};
@@ -0,0 +1,491 @@
+/*!
+\file	LRkll.c
+\brief	A streaming quantile sketch (KLL) for sample percentiles
+
+The `LR_kll` object estimates the quantiles (percentiles) of a stream of
+any number of values in a small fixed amount of memory without
+choosing bin boundaries ahead of time.  It is the KLL sketch of
+Karnin, Lang, and Liberty, "Optimal Quantile Approximation in Streams",
+IEEE FOCS (2016).
+
+The sketch keeps a stack of levels of sampled values, where each value at
+level \e h stands in for \f$ 2^h \f$ of the original values.  New values
+go into level 0, and when the sketch is full the lowest full level is
+\e compacted: it is sorted, and every other value (starting randomly with
+the first or second) is promoted to the next level, the rest discarded.
+The level capacities shrink by a factor of 2/3 going down from the top
+(to no fewer than 8),
+so the sketch holds at most about \e 3k values (plus 8 per level)
+for the size parameter \e k , however many values are added.
+
+Rank error
+----------
+
+The estimated rank (the fraction of the values \f$ \le x \f$) of any
+value is within \f$ \pm\epsilon \f$ of the true rank where
+\f$ \epsilon \approx 1.7/k \f$ with 99% confidence
+for all values at once (the default \e k = 200 gives about 0.85%,
+which is also given by \c LR_kll_eps() ), independent of the number
+of values.  (The median error is about half that.)
+So a sample quantile for probability \e p lies between
+the true sample quantiles for \f$ p \pm \epsilon \f$ .
+The minimum and maximum values are kept exactly.
+
+The compactions are randomized with the sketch's own simple generator
+(so the results are repeatable), which is independent of any `LR_obj`.
+
+Sketches of partial streams (e.g. one per thread) can be combined with
+\c LR_kll_merge() with the same error bound.
+
+\code
+#include <stdio.h>
+#include "libran.h"
+...
+LR_kll *s = LR_kll_new(0);
+...
+for (long i = 0; i < 1000000000l; i++) {
+	LR_kll_add(s, LRd_RAN(o));
+}
+...
+// compare the sample quantiles to the distribution CDF
+double p[] = {.001, .01, .5, .99, .999}, xq[5], fq[5];
+LR_kll_compare(s, o, 5, p, xq, fq);
+for (int i = 0; i < 5; i++) {
+	printf("%g : %g  CDF = %g +/- %g\n", p[i], xq[i], fq[i], LR_kll_eps(s));
+}
+...
+LR_kll_rm(&s);
+\endcode
+
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>	/* malloc,realloc,qsort,free */
+#include <string.h>	/* memcpy */
+#include <math.h>	/* isnan(),ceil() */
+#include "libran.h"
+
+#define LR_KLL_K	200	/* default size parameter */
+#define LR_KLL_MINCAP	8	/* smallest level capacity */
+#define LR_KLL_ERR	1.7	/* rank error * k (99% confidence) */
+
+/* for qsort() */
+static int LR_kll_cmp(const void *a, const void *b) {
+	double	x = *((const double *) a), y = *((const double *) b);
+	return (x > y) - (x < y);
+}
+
+/* a random bit for the compactions (xorshift64) */
+static inline int LR_kll_bit(LR_kll *s) {
+	s->rng ^= s->rng << 13;
+	s->rng ^= s->rng >> 7;
+	s->rng ^= s->rng << 17;
+	return (int) (s->rng >> 63);
+}
+
+/* set the capacity of each level, and the total, for nlev levels */
+static void LR_kll_setcap(LR_kll *s, int nlev) {
+	double	c = (double) s->k, r = 2.0/3.0;
+
+	s->nlev = nlev;
+	s->tot = 0;
+	for (int h = nlev - 1; h >= 0; h--, c *= r) {
+		s->cap[h] = (c < LR_KLL_MINCAP ? LR_KLL_MINCAP : (int) ceil(c));
+		s->tot += s->cap[h];
+	}
+}
+
+/* make room for m values in level h */
+static int LR_kll_room(LR_kll *s, int h, int m) {
+	double	*p;
+	int	sz;
+
+	if (s->len[h] + m <= s->sz[h])
+		return LRerr_OK;
+	sz = 2 * (s->len[h] + m);
+	if (sz < s->k)
+		sz = s->k;
+	if (!(p = (double *) realloc(s->lev[h], sz * sizeof(double))))
+		return s->errno = LRerr_AllocFail;
+	s->lev[h] = p;
+	s->sz[h] = sz;
+	return LRerr_OK;
+}
+
+/* compact level h into level h+1 */
+static int LR_kll_compact(LR_kll *s, int h) {
+	double	*v;
+	int	len = s->len[h], odd = len & 1, m = len / 2, r;
+
+	if (h + 1 == s->nlev) {
+		if (s->nlev == LR_KLL_LEVELS)
+			return s->errno = LRerr_TooManyValues;
+		LR_kll_setcap(s, s->nlev + 1);
+	}
+	if (LR_kll_room(s, h + 1, m))
+		return s->errno;
+	v = s->lev[h];
+	qsort(v, len, sizeof(double), LR_kll_cmp);
+	/* keep the smallest if odd, promote every other of the rest */
+	r = odd + LR_kll_bit(s);
+	for (int i = 0; i < m; i++)
+		s->lev[h + 1][s->len[h + 1] + i] = v[r + 2 * i];
+	s->len[h + 1] += m;
+	s->len[h] = odd;
+	s->size -= m;
+	return LRerr_OK;
+}
+
+/* compact until within capacity */
+static int LR_kll_compress(LR_kll *s) {
+	while (s->size >= s->tot) {
+		int h;
+		for (h = 0; h < s->nlev - 1; h++)
+			if (s->len[h] >= s->cap[h])
+				break;
+		if (LR_kll_compact(s, h))
+			return s->errno;
+	}
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_kll_new(int k) - create new quantile sketch
+
+@param	k	size parameter (0 for the default of 200), the rank
+		error is about 1.7/k
+@return	LR_kll object if successful, else NULL
+*/
+LR_kll *LR_kll_new(int k) {
+	LR_kll *ptr = (void *) NULL;
+
+	if (k < 0 || (k && k < 8))
+		return ptr;
+	if (!(ptr = (LR_kll *) calloc(1, sizeof(LR_kll))))
+		return ptr;
+	ptr->k = (k ? k : LR_KLL_K);
+	LR_kll_setcap(ptr, 1);
+	ptr->n = 0;
+	ptr->size = 0;
+	ptr->min = INFINITY;
+	ptr->max = -INFINITY;
+	ptr->rng = 0x9E3779B97F4A7C15ul;
+	ptr->errno = 0;
+	if (LR_kll_room(ptr, 0, ptr->k)) {
+		free((void *) ptr);
+		return (LR_kll *) NULL;
+	}
+	return ptr;
+}
+
+/*!
+@brief	LR_kll_rm(LR_kll **s) - remove quantile sketch
+
+@param	s	LR_kll object address
+@return	0 if successful, else non-zero if failed
+*/
+int LR_kll_rm(LR_kll **s) {
+	if (s && *s) {
+		for (int h = 0; h < LR_KLL_LEVELS; h++)
+			free((void *) (*s)->lev[h]);
+		free((void *) *s);
+		*s = (LR_kll *) NULL;
+		return LRerr_OK;
+	}
+	return LRerr_Unspecified;
+}
+
+/*!
+@brief	LR_kll_add(LR_kll *s, double x) - add a value
+
+@param	s	LR_kll object
+@param	x	value
+@return	0 if successful, else non-zero if failed
+*/
+int LR_kll_add(LR_kll *s, double x) {
+	if (isnan(x))
+		return s->errno = LRerr_InvalidInputValue;
+	if (LR_kll_room(s, 0, 1))
+		return s->errno;
+	s->lev[0][s->len[0]++] = x;
+	s->size++;
+	s->n++;
+	s->min = (x < s->min ? x : s->min);
+	s->max = (x > s->max ? x : s->max);
+	return LR_kll_compress(s);
+}
+
+/*!
+@brief	LR_kll_add_n(LR_kll *s, const double *x, size_t n) - add
+an array of values
+
+This is the batch version of \c LR_kll_add() , which copies as
+many values into level 0 at a time as there is room for.
+NaN values are not added and raise an error, but the remaining
+values are still added.
+
+@param	s	LR_kll object
+@param	x	array of values
+@param	n	number of values
+@return	0 if successful, else non-zero if failed
+*/
+int LR_kll_add_n(LR_kll *s, const double *x, size_t n) {
+	size_t	k, m;
+	int	ret = LRerr_OK, j;
+	double	lo = s->min, hi = s->max, *v;
+
+	for (k = 0; k < n; k += m) {
+		m = (size_t) (s->tot - s->size);
+		m = (n - k < m ? n - k : m);
+		if (LR_kll_room(s, 0, (int) m))
+			return s->errno;
+		v = s->lev[0] + s->len[0];
+		j = 0;
+		for (size_t i = 0; i < m; i++) {
+			double y = x[k + i];
+			if (isnan(y)) {
+				ret = LRerr_InvalidInputValue;
+				continue;
+			}
+			lo = (y < lo ? y : lo);
+			hi = (y > hi ? y : hi);
+			v[j++] = y;
+		}
+		s->len[0] += j;
+		s->size += j;
+		s->n += j;
+		s->min = lo;
+		s->max = hi;
+		if (LR_kll_compress(s))
+			return s->errno;
+	}
+	if (ret)
+		s->errno = ret;
+	return ret;
+}
+
+/*!
+@brief	LR_kll_merge(LR_kll *dst, const LR_kll *src) - add a sketch
+to another
+
+The result is a sketch of both streams with the same rank error bound.
+They need not have the same size parameter, but the result has that
+of \e dst .
+
+@param	dst	LR_kll object to add to
+@param	src	LR_kll object to add
+@return	0 if successful, else non-zero if failed
+*/
+int LR_kll_merge(LR_kll *dst, const LR_kll *src) {
+	if (!dst || !src)
+		return LRerr_Unspecified;
+	for (int h = 0; h < src->nlev; h++) {
+		if (!src->len[h])
+			continue;
+		if (LR_kll_room(dst, h, src->len[h]))
+			return dst->errno;
+		(void) memcpy(dst->lev[h] + dst->len[h], src->lev[h],
+			src->len[h] * sizeof(double));
+		dst->len[h] += src->len[h];
+		dst->size += src->len[h];
+	}
+	if (src->nlev > dst->nlev)
+		LR_kll_setcap(dst, src->nlev);
+	dst->n += src->n;
+	dst->min = (src->min < dst->min ? src->min : dst->min);
+	dst->max = (src->max > dst->max ? src->max : dst->max);
+	return LR_kll_compress(dst);
+}
+
+/* all the values with their weights sorted by value */
+typedef struct {
+	double	x;
+	long	w;
+} LR_kll_xw;
+static int LR_kll_xwcmp(const void *a, const void *b) {
+	double	x = ((const LR_kll_xw *) a)->x, y = ((const LR_kll_xw *) b)->x;
+	return (x > y) - (x < y);
+}
+static LR_kll_xw *LR_kll_sorted(const LR_kll *s) {
+	LR_kll_xw *xw;
+	long	m = 0;
+
+	if (!(xw = (LR_kll_xw *) malloc((s->size + 1) * sizeof(LR_kll_xw))))
+		return xw;
+	for (int h = 0; h < s->nlev; h++) {
+		for (int i = 0; i < s->len[h]; i++, m++) {
+			xw[m].x = s->lev[h][i];
+			xw[m].w = 1l << h;
+		}
+	}
+	qsort(xw, m, sizeof(LR_kll_xw), LR_kll_xwcmp);
+	return xw;
+}
+
+/* the sample quantile from the sorted values */
+static double LR_kll_q(const LR_kll *s, const LR_kll_xw *xw, double p) {
+	double	t = p * (double) s->n, c = 0.0;
+
+	if (!(p > 0.0))
+		return s->min;
+	if (p >= 1.0)
+		return s->max;
+	for (long i = 0; i < s->size; i++) {
+		c += (double) xw[i].w;
+		if (c >= t)
+			return xw[i].x;
+	}
+	return s->max;
+}
+
+/*!
+@brief	LR_kll_quantile(const LR_kll *s, double p) - the sample quantile
+
+The estimate of the smallest value \e x such that a fraction \e p of
+the values are \f$ \le x \f$ .  The quantiles for 0 and 1 are the exact
+minimum and maximum values.
+
+@param	s	LR_kll object
+@param	p	probability [0,1]
+@return	sample quantile, or NAN if none
+*/
+double LR_kll_quantile(const LR_kll *s, double p) {
+	LR_kll_xw *xw;
+	double	q;
+
+	if (!s || !s->n || isnan(p) || p < 0.0 || p > 1.0)
+		return NAN;
+	if (!(xw = LR_kll_sorted(s)))
+		return NAN;
+	q = LR_kll_q(s, xw, p);
+	free((void *) xw);
+	return q;
+}
+
+/*!
+@brief	LR_kll_rank(const LR_kll *s, double x) - the sample rank
+
+The estimate of the fraction of the values \f$ \le x \f$ , i.e. the
+empirical CDF.
+
+@param	s	LR_kll object
+@param	x	value
+@return	rank [0,1], or NAN if none
+*/
+double LR_kll_rank(const LR_kll *s, double x) {
+	long	c = 0;
+
+	if (!s || !s->n || isnan(x))
+		return NAN;
+	for (int h = 0; h < s->nlev; h++)
+		for (int i = 0; i < s->len[h]; i++)
+			c += (s->lev[h][i] <= x ? 1l << h : 0);
+	return (double) c / (double) s->n;
+}
+
+/*!
+@brief	LR_kll_eps(const LR_kll *s) - the rank error bound
+
+The sketch's ranks are within this of the true sample ranks with
+99% confidence (0 while the values are all kept).
+
+@param	s	LR_kll object
+@return	rank error
+*/
+double LR_kll_eps(const LR_kll *s) {
+	return (s->nlev > 1 ? LR_KLL_ERR / s->k : 0.0);
+}
+
+/* the CDF of o at x for any data type */
+static double LR_kll_cdf(LR_obj *o, double x) {
+	if (o->d == LR_double)
+		return o->ops->cdfd(o, x);
+	else if (o->d == LR_float)
+		return (double) o->ops->cdff(o, (float) x);
+	return (double) o->ops->cdfi(o, (int) x);
+}
+
+/*!
+@brief	LR_kll_compare(const LR_kll *s, LR_obj *o, int m, const double *p,
+double *xq, double *fq) - the sample quantiles and the distribution CDF
+
+For each of the \e m probabilities \e p[i] the sample quantile
+is stored in \e xq[i] and the `LR_obj` distribution's CDF at that value
+in \e fq[i] .  If the samples are from the distribution then each
+\e fq[i] should be within about \c LR_kll_eps() of \e p[i] (plus
+the sampling error \f$ \sqrt{p(1-p)/n} \f$).
+
+@param	s	LR_kll object
+@param	o	LR_obj object
+@param	m	number of probabilities
+@param	p	array of probabilities
+@param	xq	array for the sample quantiles
+@param	fq	array for the CDF values
+@return	0 if successful, else non-zero if failed
+*/
+int LR_kll_compare(const LR_kll *s, LR_obj *o, int m, const double *p,
+	double *xq, double *fq) {
+	LR_kll_xw *xw;
+
+	if (!s || !o || !p || !xq || !fq)
+		return LRerr_Unspecified;
+	if (!s->n)
+		return LRerr_UnmetPreconditions;
+	if (!(xw = LR_kll_sorted(s)))
+		return LRerr_AllocFail;
+	for (int i = 0; i < m; i++) {
+		if (isnan(p[i]) || p[i] < 0.0 || p[i] > 1.0) {
+			xq[i] = fq[i] = NAN;
+			continue;
+		}
+		xq[i] = LR_kll_q(s, xw, p[i]);
+		fq[i] = LR_kll_cdf(o, xq[i]);
+	}
+	free((void *) xw);
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_kll_ksdist(const LR_kll *s, LR_obj *o) - the largest difference
+between the sample ranks and the distribution CDF
+
+This is the Kolmogorov-Smirnov distance
+\f$ D = \sup_x |F_n(x) - F(x)| \f$ between the sketch's empirical CDF
+\f$ F_n \f$ and the `LR_obj` distribution's CDF \f$ F \f$ , checked
+at each value kept in the sketch, so it may differ from that of all
+the samples by up to \c LR_kll_eps() .
+
+@param	s	LR_kll object
+@param	o	LR_obj object
+@return	distance [0,1], or NAN if failed
+*/
+double LR_kll_ksdist(const LR_kll *s, LR_obj *o) {
+	LR_kll_xw *xw;
+	double	d = 0.0, c = 0.0, n, f, t;
+
+	if (!s || !o || !s->n)
+		return NAN;
+	if (!(xw = LR_kll_sorted(s)))
+		return NAN;
+	n = (double) s->n;
+	for (long i = 0; i < s->size; i++) {
+		f = LR_kll_cdf(o, xw[i].x);
+		t = fabs(c / n - f);	/* just below x */
+		d = (t > d ? t : d);
+		c += (double) xw[i].w;
+		t = fabs(c / n - f);	/* at x */
+		d = (t > d ? t : d);
+	}
+	free((void *) xw);
+	return d;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,176 @@
+/*!
+\file	LRlogd.c
+\brief 	The logarithmic (series) distribution with 0 < \e p < 1.
+
+The pseudo-random numbers are distributed from the logarithmic
+distribution, which is a discrete distribution on the positive
+integers \f$ k = 1, 2, \ldots \f$, with the probability of each falling
+as \f$ p^k/k \f$.  It arises as the number of items of a species
+in a sample (Fisher's log-series) and as the limit of the negative
+binomial distribution with the zero class left out.
+
+The attribute \e p is greater than zero and less than one.
+The mean is \f$ -p/((1-p)\log(1-p)) \f$ , so as \e p approaches
+one the distribution grows a very long tail.
+
+\manonly
+   PDF(k) = -p^k / (k log(1-p)), 0<k
+   CDF(k) = -(p + p^2/2 + ... + p^k/k) / log(1-p), 0<k
+\endmanonly
+
+\f{eqnarray*}{
+\mbox{PDF}(k) &=
+\left\{ \begin{array}{ll}
+                0, &    k \le 0 \\
+        	\frac{-1}{\log(1-p)} \frac{p^k}{k}, &    0 < k .
+        \end{array} \right.
+\\
+\\
+\mbox{CDF}(k) &=
+\left\{ \begin{array}{ll}
+                0, &    k \le 0 \\
+        	\frac{-1}{\log(1-p)} \sum_{j=1}^k \frac{p^j}{j}, &    0 < k .
+        \end{array} \right.
+\f}
+
+The variates are generated with Kemp's LK algorithm
+(A.W. Kemp, "Efficient Generation of Logarithmically Distributed
+Pseudo-Random Variables", Applied Statistics 30, 249-253 (1981)),
+which needs one uniform for all the variates of 1 with \f$ u \ge p \f$
+and only a second one otherwise, however close \e p is to one.
+
+The PDF and CDF need no tables, so there is nothing to set up but
+\f$ \log(1-p) \f$ and \f$ \log(p) \f$ .  The CDF sums the series for
+the smaller \e k and otherwise the tail beyond \e k , whichever
+converges first.
+
+The default is \f$ p = \frac{1}{2} \f$.
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math.h>
+#include <float.h>
+#include <limits.h>	/* INT_MAX */
+#include "libran.h"
+#include "LRmathf.h"
+
+/* int */
+/*!
+@brief	LRi_logd_RAN(LR_obj *o) - int logarithmic distributed variate.
+Default values: \e p = 1/2.
+
+The random variate is generated with Kemp's LK algorithm.  The first
+uniform \e v gives the variate 1 if \f$ v \ge p \f$, else a second
+uniform gives \f$ q = 1 - (1-p)^u \f$ and the variate is
+\f$ 1 + \lfloor \log(v)/\log(q) \rfloor \f$, where the cases 1 and 2
+need no logarithm.
+
+@param o        LR_obj object
+@return int
+*/
+int LRi_logd_RAN(LR_obj *o) {
+	float zero = 0.0, r = o->rc[0].f, v, q, lq, t;
+
+	do {
+		v = o->uf(o);
+	} while (v == zero);
+
+	if (v >= o->p)
+		return 1;
+
+	q = - expm1f(r * o->uf(o));
+	if (v > q)
+		return 1;
+	if (v > q * q)
+		return 2;
+
+	/* for p next to 1 q may round to 1, keep the cast defined */
+	if ((lq = LR_logf(q)) >= zero)
+		return INT_MAX;
+	t = LR_logf(v) / lq;
+	return (t < (float) INT_MAX ? 1 + (int) t : INT_MAX);
+}
+
+/*!
+@brief	LRi_logd_PDF(LR_obj *o, int x) - logarithmic
+probablity (or mass) distribution function
+
+@param o	LR_obj object
+@param x	value
+@return float PDF at x
+*/
+float LRi_logd_PDF(LR_obj *o, int x) {
+	float zero = 0.0;
+
+	if (x <= 0)	return zero;
+
+	return o->dc[1].f * expf(x * o->dc[0].f) / x;
+}
+
+/*!
+@brief	LRi_logd_CDF(LR_obj *o, int x) - logarithmic distribution
+cumulative distribution function
+
+@param o	LR_obj object
+@param x	value
+@return float CDF at x
+*/
+float LRi_logd_CDF(LR_obj *o, int x) {
+	float zero = 0.0, one = 1.0;
+	double p = o->p, t, s = 0.0;
+
+	if (x <= 0)	return zero;
+
+	/* the tail takes about -log(eps)/(1-p) terms */
+	if (x * (1.0 - p) < - log(FLT_EPSILON)) {
+		t = 1.0;
+		for (int nn = 1; nn <= x; nn++) {
+			t *= p;
+			s += t / nn;
+		}
+		return o->dc[1].f * s;
+	} else {
+		/* until the rest of the tail, at most t p/(n(1-p)),
+		 * no longer counts */
+		t = exp(x * (double) o->dc[0].f);
+		for (long nn = x + 1; ; nn++) {
+			t *= p;
+			s += t / nn;
+			if (t * p <= FLT_EPSILON * s * nn * (1.0 - p))
+				break;
+		}
+		return one - o->dc[1].f * s;
+	}
+}
+
+/*!
+@brief	LRi_logd_QUANT(LR_obj *o, float u) - logarithmic distribution
+quantile (inverse cumulative distribution function)
+
+Sums the PDF up from 1 until it reaches \e u .
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return int smallest k where the CDF is at least u
+*/
+int LRi_logd_QUANT(LR_obj *o, float u) {
+	double	p = o->p, t = o->dc[1].f * p, s = t;
+	int	kk = 1;
+
+	while (s < u && t > DBL_EPSILON * s) {
+		kk++;
+		t *= p * (kk - 1) / kk;
+		s += t;
+	}
+	return kk;
+}
+
+#ifdef __cplusplus
+}
+#endif
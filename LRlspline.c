@@ -207,9 +207,24 @@ random variate.
 @return double if OK else NaN
 */
 double LRd_lspline_RAN(LR_obj *o) {
+	return LRd_lspline_QUANT(o, o->ud(o));
+}
+
+/*!
+@brief	LRd_lspline_QUANT(LR_obj *o, double u) - double linear spline quantile
+(inverse cumulative distribution function)
+
+Solves the quadratic of the interval in the form that has no
+cancellation and allows a zero slope.
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return double x where the CDF is u if OK, else NaN
+*/
+double LRd_lspline_QUANT(LR_obj *o, double u) {
 	LR_pcs *aux = (LR_pcs *) o->aux;
-	double x, y, dy, slope, zero = 0.0, two = 2.0;
-	int i = 0;
+	double x = u, y, dy, slope, zero = 0.0, two = 2.0;
+	int i = 1;
 
 	/* must have successfully normalized */
 	if (!(aux->flags & LR_AUX_NORM)) {
@@ -217,9 +232,8 @@ double LRd_lspline_RAN(LR_obj *o) {
 		return NAN;
 	}
 
-	x = o->ud(o);
 	/* find interval */
-	while (x >= aux->sc[i])	i++;
+	while (x >= aux->sc[i] && i < aux->nn)	i++;
 
 	/* use inverse method to return variate */
 	slope = ((aux->c[i] - aux->c[i-1]) * aux->norm) /
@@ -227,14 +241,11 @@ double LRd_lspline_RAN(LR_obj *o) {
 
 	y = aux->c[i-1] * aux->norm;
 	x -= aux->sc[i-1];
-	dy = (sqrt(y*y + two*slope*(x)) - y)/slope;
+	if (x <= zero)
+		return aux->bdrs[i-1];
+	dy = two*x/(sqrt(y*y + two*slope*x) + y);
 
-	y = aux->bdrs[i-1] + dy;
-/*
-	printf(">>>>>% 8.5f % 8.5f % 8.5f\n",
-		y, aux->sc[i-1] + x, LRd_CDF(o, y));
-*/
-	return y;
+	return aux->bdrs[i-1] + dy;
 }
 
 /*!
@@ -316,9 +327,24 @@ double LRd_lspline_CDF(LR_obj *o, double x) {
 @return float if OK else NaN
 */
 float LRf_lspline_RAN(LR_obj *o) {
+	return LRf_lspline_QUANT(o, o->uf(o));
+}
+
+/*!
+@brief	LRf_lspline_QUANT(LR_obj *o, float u) - float linear spline quantile
+(inverse cumulative distribution function)
+
+Solves the quadratic of the interval in the form that has no
+cancellation and allows a zero slope.
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return float x where the CDF is u if OK, else NaN
+*/
+float LRf_lspline_QUANT(LR_obj *o, float u) {
 	LR_pcs *aux = (LR_pcs *) o->aux;
-	float x, y, dy, slope, zero = 0.0, two = 2.0;
-	int i = 0;
+	float x = u, y, dy, slope, zero = 0.0, two = 2.0;
+	int i = 1;
 
 	/* must have successfully normalized */
 	if (!(aux->flags & LR_AUX_NORM)) {
@@ -326,9 +352,8 @@ float LRf_lspline_RAN(LR_obj *o) {
 		return NAN;
 	}
 
-	x = o->uf(o);
 	/* find interval */
-	while (x >= aux->sc[i])	i++;
+	while (x >= aux->sc[i] && i < aux->nn)	i++;
 
 	/* use inverse method to return variate */
 	slope = ((aux->c[i] - aux->c[i-1]) * aux->norm) /
@@ -336,14 +361,11 @@ float LRf_lspline_RAN(LR_obj *o) {
 
 	y = aux->c[i-1] * aux->norm;
 	x -= aux->sc[i-1];
-	dy = (sqrtf(y*y + two*slope*(x)) - y)/slope;
+	if (x <= zero)
+		return aux->bdrs[i-1];
+	dy = two*x/(sqrtf(y*y + two*slope*x) + y);
 
-	y = aux->bdrs[i-1] + dy;
-/*
-	printf(">>>>>% 8.5f % 8.5f % 8.5f\n",
-		y, aux->sc[i-1] + x, LRf_CDF(o, y));
-*/
-	return y;
+	return aux->bdrs[i-1] + dy;
 }
 
 /*!
@@ -10,6 +10,11 @@ remove the object.
 Lastly there is a check method to correct any of the parameter values
 where possible.  (E.g. the interval boundaries b > a, width s > 0, etc.)
 
+Besides \c LR_new() the object can be created within an arena with
+\c LR_new_in() (see LRarena.c), or initialized in the caller's own
+storage with \c LR_init() .  Either way \c LR_rm() releases whatever
+it can.
+
 The following code segment sets up a `LR_obj` object to generate
 uniform distributed random variates on the interval (a=1, b=3).
 
@@ -43,27 +48,140 @@ extern "C" {
 
 #include <stdio.h>
 #include <stdarg.h>
-#include <stdlib.h>	/* calloc,free */
-#include <string.h>	/* memcpy */
+#include <stdlib.h>	/* calloc,posix_memalign,free */
+#include <string.h>	/* memset */
 #include <math.h>	/* NAN */
 #include "libran.h"
 #include "urand/urand.h"
 
-/*!
-@brief	LR_new(LR_type t, LR_data_type d) - create the LR object
-and preset some default parameter values.
+/* the shared per-type dispatch tables
+ *	type name, RAN (f,d,i), PDF (f,d,i), CDF (f,d,i), batch RAN (f,d),
+ *	QUANT (f,d,i)
+ */
+static const LR_ops unif_ops = { "unif",
+	LRf_unif_RAN,	LRd_unif_RAN,	NULL,
+	LRf_unif_PDF,	LRd_unif_PDF,	NULL,
+	LRf_unif_CDF,	LRd_unif_CDF,	NULL,
+	LRf_unif_RAN_n,	LRd_unif_RAN_n,
+	LRf_unif_QUANT,	LRd_unif_QUANT,	NULL };
+static const LR_ops piece_ops = { "piece",
+	LRf_piece_RAN,	LRd_piece_RAN,	NULL,
+	LRf_piece_PDF,	LRd_piece_PDF,	NULL,
+	LRf_piece_CDF,	LRd_piece_CDF,	NULL,
+	NULL,	NULL,
+	LRf_piece_QUANT,	LRd_piece_QUANT,	NULL };
+static const LR_ops lspline_ops = { "lspline",
+	LRf_lspline_RAN,	LRd_lspline_RAN,	NULL,
+	LRf_lspline_PDF,	LRd_lspline_PDF,	NULL,
+	LRf_lspline_CDF,	LRd_lspline_CDF,	NULL,
+	NULL,	NULL,
+	LRf_lspline_QUANT,	LRd_lspline_QUANT,	NULL };
+static const LR_ops uinvcdf_ops = { "uinvcdf",
+	LRf_uinvcdf_RAN,	LRd_uinvcdf_RAN,	NULL,
+	LRf_uinvcdf_PDF,	LRd_uinvcdf_PDF,	NULL,
+	LRf_uinvcdf_CDF,	LRd_uinvcdf_CDF,	NULL,
+	NULL,	NULL,
+	LRf_uinvcdf_QUANT,	LRd_uinvcdf_QUANT,	NULL };
+static const LR_ops nexp_ops = { "nexp",
+	LRf_nexp_RAN,	LRd_nexp_RAN,	NULL,
+	LRf_nexp_PDF,	LRd_nexp_PDF,	NULL,
+	LRf_nexp_CDF,	LRd_nexp_CDF,	NULL,
+	LRf_nexp_RAN_n,	LRd_nexp_RAN_n,
+	LRf_nexp_QUANT,	LRd_nexp_QUANT,	NULL };
+static const LR_ops erlang_ops = { "erlang",
+	LRf_erlang_RAN,	LRd_erlang_RAN,	NULL,
+	LRf_erlang_PDF,	LRd_erlang_PDF,	NULL,
+	LRf_erlang_CDF,	LRd_erlang_CDF,	NULL,
+	NULL,	NULL,
+	LRf_erlang_QUANT,	LRd_erlang_QUANT,	NULL };
+static const LR_ops gausbm_ops = { "gausbm",
+	LRf_gausbm_RAN,	LRd_gausbm_RAN,	NULL,
+	LRf_gaus_PDF,	LRd_gaus_PDF,	NULL,
+	LRf_gaus_CDF,	LRd_gaus_CDF,	NULL,
+	LRf_gausbm_RAN_n,	LRd_gausbm_RAN_n,
+	LRf_gaus_QUANT,	LRd_gaus_QUANT,	NULL };
+static const LR_ops gausmar_ops = { "gausmar",
+	LRf_gausmar_RAN,	LRd_gausmar_RAN,	NULL,
+	LRf_gaus_PDF,	LRd_gaus_PDF,	NULL,
+	LRf_gaus_CDF,	LRd_gaus_CDF,	NULL,
+	NULL,	NULL,
+	LRf_gaus_QUANT,	LRd_gaus_QUANT,	NULL };
+static const LR_ops gsn2_ops = { "gsn2",
+	LRf_gsn2_RAN,	LRd_gsn2_RAN,	NULL,
+	LRf_gsn2_PDF,	LRd_gsn2_PDF,	NULL,
+	LRf_gsn2_CDF,	LRd_gsn2_CDF,	NULL,
+	LRf_gsn2_RAN_n,	LRd_gsn2_RAN_n,
+	LRf_gsn2_QUANT,	LRd_gsn2_QUANT,	NULL };
+static const LR_ops gsn4_ops = { "gsn4",
+	LRf_gsn4_RAN,	LRd_gsn4_RAN,	NULL,
+	LRf_gsn4_PDF,	LRd_gsn4_PDF,	NULL,
+	LRf_gsn4_CDF,	LRd_gsn4_CDF,	NULL,
+	LRf_gsn4_RAN_n,	LRd_gsn4_RAN_n,
+	LRf_gsn4_QUANT,	LRd_gsn4_QUANT,	NULL };
+static const LR_ops gsn12_ops = { "gsn12",
+	LRf_gsn12_RAN,	LRd_gsn12_RAN,	NULL,
+	LRf_gsn12_PDF,	LRd_gsn12_PDF,	NULL,
+	LRf_gsn12_CDF,	LRd_gsn12_CDF,	NULL,
+	LRf_gsn12_RAN_n,	LRd_gsn12_RAN_n,
+	LRf_gsn12_QUANT,	LRd_gsn12_QUANT,	NULL };
+static const LR_ops gsnN_ops = { "gsnN",
+	LRf_gsnN_RAN,	LRd_gsnN_RAN,	NULL,
+	LRf_gsnN_PDF,	LRd_gsnN_PDF,	NULL,
+	LRf_gsnN_CDF,	LRd_gsnN_CDF,	NULL,
+	LRf_gsnN_RAN_n,	LRd_gsnN_RAN_n,
+	LRf_gsnN_QUANT,	LRd_gsnN_QUANT,	NULL };
+static const LR_ops cauchy_ops = { "cauchy",
+	LRf_cauchy_RAN,	LRd_cauchy_RAN,	NULL,
+	LRf_cauchy_PDF,	LRd_cauchy_PDF,	NULL,
+	LRf_cauchy_CDF,	LRd_cauchy_CDF,	NULL,
+	LRf_cauchy_RAN_n,	LRd_cauchy_RAN_n,
+	LRf_cauchy_QUANT,	LRd_cauchy_QUANT,	NULL };
+static const LR_ops cauchymar_ops = { "cauchymar",
+	LRf_cauchymar_RAN,	LRd_cauchymar_RAN,	NULL,
+	LRf_cauchy_PDF,	LRd_cauchy_PDF,	NULL,
+	LRf_cauchy_CDF,	LRd_cauchy_CDF,	NULL,
+	NULL,	NULL,
+	LRf_cauchy_QUANT,	LRd_cauchy_QUANT,	NULL };
+static const LR_ops poisson_ops = { "poisson",
+	NULL,	NULL,	LRi_poisson_RAN,
+	NULL,	NULL,	LRi_poisson_PDF,
+	NULL,	NULL,	LRi_poisson_CDF,
+	NULL,	NULL,
+	NULL,	NULL,	LRi_poisson_QUANT };
+static const LR_ops geometric_ops = { "geometric",
+	NULL,	NULL,	LRi_geometric_RAN,
+	NULL,	NULL,	LRi_geometric_PDF,
+	NULL,	NULL,	LRi_geometric_CDF,
+	NULL,	NULL,
+	NULL,	NULL,	LRi_geometric_QUANT };
+static const LR_ops logd_ops = { "logd",
+	NULL,	NULL,	LRi_logd_RAN,
+	NULL,	NULL,	LRi_logd_PDF,
+	NULL,	NULL,	LRi_logd_CDF,
+	NULL,	NULL,
+	NULL,	NULL,	LRi_logd_QUANT };
+static const LR_ops binomial_ops = { "binomial",
+	NULL,	NULL,	LRi_binomial_RAN,
+	NULL,	NULL,	LRi_binomial_PDF,
+	NULL,	NULL,	LRi_binomial_CDF,
+	NULL,	NULL,
+	NULL,	NULL,	LRi_binomial_QUANT };
 
-@param	t	LR_type (e.g. LR_gausbm)
-@param	d	LR_data_type (e.g. LR_double)
-@return	LR_obj *
-*/
-LR_obj *LR_new(LR_type t, LR_data_type d) {
-	LR_obj *ptr = (void *) NULL;
-	if (!(ptr = (LR_obj *) calloc(sizeof(LR_obj),1)))
-		return ptr;
+/* allocate an auxiliary object from the arena or else the heap */
+static void *LR_aux_alloc(LR_arena *arena, size_t n) {
+	if (arena)
+		return LR_arena_alloc(arena, n);
+	return calloc(n, 1);
+}
+
+/* set the default values based on LR_type (object is zeroed) */
+static int LR_setup(LR_obj *ptr, LR_type t, LR_data_type d, LR_arena *arena) {
 	ptr->errno = 0;
 	ptr->d = d;
 	ptr->aux = (void *) NULL;
+#ifdef LR_FASTMATH
+	ptr->flags = LR_OBJ_FAST;
+#endif
 	/* set all the pseudo-uniform random number generators */
 	ptr->ui = LR_irand;
 	ptr->ul = LR_lrand;
@@ -74,19 +192,13 @@ LR_obj *LR_new(LR_type t, LR_data_type d) {
 	ptr->t = t;
 	switch (t) {
 	case unif:
-		ptr->type = "unif";
+		ptr->ops = &unif_ops;
 		if (d == LR_double) {
 			ptr->a.d = (double) 0.0;
 			ptr->b.d = (double) 1.0;
-			ptr->rnd  = LRd_unif_RAN;
-			ptr->pdfd = LRd_unif_PDF;
-			ptr->cdfd = LRd_unif_CDF;
 		} else if (d == LR_float) {
 			ptr->a.f = (float) 0.0;
 			ptr->b.f = (float) 1.0;
-			ptr->rnf  = LRf_unif_RAN;
-			ptr->pdff = LRf_unif_PDF;
-			ptr->cdff = LRf_unif_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
@@ -94,10 +206,11 @@ LR_obj *LR_new(LR_type t, LR_data_type d) {
 		break;
 	case piece:
 	{
-		ptr->type = "piece";
-		if (!(ptr->aux = (void *) calloc(sizeof(LR_pcs),1)))
-			goto objerr;
+		ptr->ops = &piece_ops;
+		if (!(ptr->aux = LR_aux_alloc(arena, sizeof(LR_pcs))))
+			return LRerr_AllocFail;
 		LR_pcs *aux = (LR_pcs *) ptr->aux;
+		aux->arena = arena;
 		aux->new = LR_pcs_new;
 		aux->rm = LR_pcs_rm;
 		aux->set = LR_pcs_set;
@@ -106,16 +219,10 @@ LR_obj *LR_new(LR_type t, LR_data_type d) {
 			ptr->a.d = (double) -1.0;
 			ptr->b.d = (double)  1.0;
 			ptr->x.d = (double)  1.0;
-			ptr->rnd  = LRd_piece_RAN;
-			ptr->pdfd = LRd_piece_PDF;
-			ptr->cdfd = LRd_piece_CDF;
 		} else if (d == LR_float) {
 			ptr->a.f = (float) -1.0;
 			ptr->b.f = (float)  1.0;
 			ptr->x.f = (float)  1.0;
-			ptr->rnf  = LRf_piece_RAN;
-			ptr->pdff = LRf_piece_PDF;
-			ptr->cdff = LRf_piece_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
@@ -124,10 +231,11 @@ LR_obj *LR_new(LR_type t, LR_data_type d) {
 		break;
 	case lspline:
 	{
-		ptr->type = "lspline";
-		if (!(ptr->aux = (void *) calloc(sizeof(LR_pcs),1)))
-			goto objerr;
+		ptr->ops = &lspline_ops;
+		if (!(ptr->aux = LR_aux_alloc(arena, sizeof(LR_pcs))))
+			return LRerr_AllocFail;
 		LR_pcs *aux = (LR_pcs *) ptr->aux;
+		aux->arena = arena;
 		aux->new = LR_lspl_new;
 		aux->rm = LR_lspl_rm;
 		aux->set = LR_lspl_set;
@@ -135,15 +243,9 @@ LR_obj *LR_new(LR_type t, LR_data_type d) {
 		if (d == LR_double) {
 			ptr->a.d = (double) -1.0;
 			ptr->b.d = (double)  1.0;
-			ptr->rnd  = LRd_lspline_RAN;
-			ptr->pdfd = LRd_lspline_PDF;
-			ptr->cdfd = LRd_lspline_CDF;
 		} else if (d == LR_float) {
 			ptr->a.f = (float) -1.0;
 			ptr->b.f = (float)  1.0;
-			ptr->rnf  = LRf_lspline_RAN;
-			ptr->pdff = LRf_lspline_PDF;
-			ptr->cdff = LRf_lspline_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
@@ -152,9 +254,9 @@ LR_obj *LR_new(LR_type t, LR_data_type d) {
 		break;
 	case uinvcdf:
 	{
-		ptr->type = "uinvcdf";
-		if (!(ptr->aux = (void *) calloc(sizeof(LR_uinvcdf),1)))
-			goto objerr;
+		ptr->ops = &uinvcdf_ops;
+		if (!(ptr->aux = LR_aux_alloc(arena, sizeof(LR_uinvcdf))))
+			return LRerr_AllocFail;
 		LR_uinvcdf *aux = (LR_uinvcdf *) ptr->aux;
 		if (d == LR_double) {
 			aux->dcdf = NULL;
@@ -162,18 +264,12 @@ LR_obj *LR_new(LR_type t, LR_data_type d) {
 			ptr->b.d = NAN;
 			ptr->m.d = NAN;
 			ptr->s.d = NAN;
-			ptr->rnd  = LRd_uinvcdf_RAN;
-			ptr->pdfd = LRd_uinvcdf_PDF;
-			ptr->cdfd = LRd_uinvcdf_CDF;
 		} else if (d == LR_float) {
 			aux->fcdf = NULL;
 			ptr->a.f = NAN;
 			ptr->b.f = NAN;
 			ptr->m.f = NAN;
 			ptr->s.f = NAN;
-			ptr->rnf  = LRf_uinvcdf_RAN;
-			ptr->pdff = LRf_uinvcdf_PDF;
-			ptr->cdff = LRf_uinvcdf_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
@@ -181,228 +277,189 @@ LR_obj *LR_new(LR_type t, LR_data_type d) {
 	}
 		break;
 	case nexp:
-		ptr->type = "nexp";
+		ptr->ops = &nexp_ops;
 		if (d == LR_double) {
 			ptr->m.d = (double) 1.0;
 			ptr->s.d = NAN;
-			ptr->rnd  = LRd_nexp_RAN;
-			ptr->pdfd = LRd_nexp_PDF;
-			ptr->cdfd = LRd_nexp_CDF;
 		} else if (d == LR_float) {
 			ptr->m.f = (float) 1.0;
 			ptr->s.f = NAN;
-			ptr->rnf  = LRf_nexp_RAN;
-			ptr->pdff = LRf_nexp_PDF;
-			ptr->cdff = LRf_nexp_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
 		}
 		break;
 	case erlang:
-		ptr->type = "erlang";
+		ptr->ops = &erlang_ops;
 		ptr->k = 1;
 		if (d == LR_double) {
 			ptr->m.d = (double) 1.0;
 			ptr->s.d = NAN;
-			ptr->rnd  = LRd_erlang_RAN;
-			ptr->pdfd = LRd_erlang_PDF;
-			ptr->cdfd = LRd_erlang_CDF;
 		} else if (d == LR_float) {
 			ptr->m.f = (float) 1.0;
 			ptr->s.f = NAN;
-			ptr->rnf  = LRf_erlang_RAN;
-			ptr->pdff = LRf_erlang_PDF;
-			ptr->cdff = LRf_erlang_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
 		}
 		break;
 	case gausbm:
-		ptr->type = "gausbm";
+		ptr->ops = &gausbm_ops;
 		if (d == LR_double) {
 			ptr->m.d = (double) 0.0;
 			ptr->s.d = (double) 1.0;
 			ptr->x.d = NAN;
-			ptr->rnd  = LRd_gausbm_RAN;
-			ptr->pdfd = LRd_gaus_PDF;
-			ptr->cdfd = LRd_gaus_CDF;
 		} else if (d == LR_float) {
 			ptr->m.f = (float) 0.0;
 			ptr->s.f = (float) 1.0;
 			ptr->x.f = NAN;
-			ptr->rnf  = LRf_gausbm_RAN;
-			ptr->pdff = LRf_gaus_PDF;
-			ptr->cdff = LRf_gaus_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
 		}
 		break;
 	case gausmar:
-		ptr->type = "gausmar";
+		ptr->ops = &gausmar_ops;
 		if (d == LR_double) {
 			ptr->m.d = (double) 0.0;
 			ptr->s.d = (double) 1.0;
 			ptr->x.d = NAN;
-			ptr->rnd  = LRd_gausmar_RAN;
-			ptr->pdfd = LRd_gaus_PDF;
-			ptr->cdfd = LRd_gaus_CDF;
 		} else if (d == LR_float) {
 			ptr->m.f = (float) 0.0;
 			ptr->s.f = (float) 1.0;
 			ptr->x.f = NAN;
-			ptr->rnf  = LRf_gausmar_RAN;
-			ptr->pdff = LRf_gaus_PDF;
-			ptr->cdff = LRf_gaus_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
 		}
 		break;
 	case gsn2:
-		ptr->type = "gsn2";
+		ptr->ops = &gsn2_ops;
 		if (d == LR_double) {
 			ptr->a.d = (double) -1.0;
 			ptr->b.d = (double)  1.0;
 			ptr->m.d = (double) 0.0;
 			ptr->s.d = (double) 1.0;
-			ptr->rnd  = LRd_gsn2_RAN;
-			ptr->pdfd = LRd_gsn2_PDF;
-			ptr->cdfd = LRd_gsn2_CDF;
 		} else if (d == LR_float) {
 			ptr->a.f = (float)  -1.0;
 			ptr->b.f = (float)   1.0;
 			ptr->m.f = (float) 0.0;
 			ptr->s.f = (float) 1.0;
-			ptr->rnf  = LRf_gsn2_RAN;
-			ptr->pdff = LRf_gsn2_PDF;
-			ptr->cdff = LRf_gsn2_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
 		}
 		break;
 	case gsn4:
-		ptr->type = "gsn4";
+		ptr->ops = &gsn4_ops;
 		if (d == LR_double) {
 			ptr->a.d = (double) -2.0;
 			ptr->b.d = (double)  2.0;
 			ptr->m.d = (double) 0.0;
 			ptr->s.d = (double) 2.0;
-			ptr->rnd  = LRd_gsn4_RAN;
-			ptr->pdfd = LRd_gsn4_PDF;
-			ptr->cdfd = LRd_gsn4_CDF;
 		} else if (d == LR_float) {
 			ptr->a.f = (float)  -2.0;
 			ptr->b.f = (float)   2.0;
 			ptr->m.f = (float) 0.0;
 			ptr->s.f = (float) 2.0;
-			ptr->rnf  = LRf_gsn4_RAN;
-			ptr->pdff = LRf_gsn4_PDF;
-			ptr->cdff = LRf_gsn4_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
 		}
 		break;
 	case gsn12:
-		ptr->type = "gsn12";
+		ptr->ops = &gsn12_ops;
 		if (d == LR_double) {
 			ptr->a.d = (double) -6.0;
 			ptr->b.d = (double)  6.0;
 			ptr->m.d = (double) 0.0;
 			ptr->s.d = (double) 1.0;
-			ptr->rnd  = LRd_gsn12_RAN;
-			ptr->pdfd = LRd_gsn12_PDF;
-			ptr->cdfd = LRd_gsn12_CDF;
 		} else if (d == LR_float) {
 			ptr->a.f = (float)  -6.0;
 			ptr->b.f = (float)   6.0;
 			ptr->m.f = (float) 0.0;
 			ptr->s.f = (float) 1.0;
-			ptr->rnf  = LRf_gsn12_RAN;
-			ptr->pdff = LRf_gsn12_PDF;
-			ptr->cdff = LRf_gsn12_CDF;
+		} else {
+			/* error */
+			ptr->errno = LRerr_BadDataType;
+		}
+		break;
+	case gsnN:
+		ptr->ops = &gsnN_ops;
+		ptr->k = 12;
+		if (d == LR_double) {
+			ptr->m.d = (double) 0.0;
+			ptr->s.d = (double) 1.0;
+		} else if (d == LR_float) {
+			ptr->m.f = (float) 0.0;
+			ptr->s.f = (float) 1.0;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
 		}
 		break;
 	case cauchy:
-		ptr->type = "cauchy";
+		ptr->ops = &cauchy_ops;
 		if (d == LR_double) {
 			ptr->m.d = (double) 0.0;
 			ptr->s.d = (double) 1.0;
-			ptr->rnd  = LRd_cauchy_RAN;
-			ptr->pdfd = LRd_cauchy_PDF;
-			ptr->cdfd = LRd_cauchy_CDF;
 		} else if (d == LR_float) {
 			ptr->m.f = (float) 0.0;
 			ptr->s.f = (float) 1.0;
-			ptr->rnf  = LRf_cauchy_RAN;
-			ptr->pdff = LRf_cauchy_PDF;
-			ptr->cdff = LRf_cauchy_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
 		}
 		break;
 	case cauchymar:
-		ptr->type = "cauchymar";
+		ptr->ops = &cauchymar_ops;
 		if (d == LR_double) {
 			ptr->m.d = (double) 0.0;
 			ptr->s.d = (double) 1.0;
-			ptr->rnd  = LRd_cauchymar_RAN;
-			ptr->pdfd = LRd_cauchy_PDF;
-			ptr->cdfd = LRd_cauchy_CDF;
 		} else if (d == LR_float) {
 			ptr->m.f = (float) 0.0;
 			ptr->s.f = (float) 1.0;
-			ptr->rnf  = LRf_cauchymar_RAN;
-			ptr->pdff = LRf_cauchy_PDF;
-			ptr->cdff = LRf_cauchy_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
 		}
 		break;
 	case poisson:
-		ptr->type = "poisson";
+		ptr->ops = &poisson_ops;
 		if (d == LR_int) {
 			ptr->p = (float) 1.0;
 			ptr->q = NAN;
-			ptr->rni  = LRi_poisson_RAN;
-			ptr->pdfi = LRi_poisson_PDF;
-			ptr->cdfi = LRi_poisson_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
 		}
 		break;
 	case geometric:
-		ptr->type = "geometric";
+		ptr->ops = &geometric_ops;
+		if (d == LR_int) {
+			ptr->p = (float) 0.5;
+			ptr->q = NAN;
+		} else {
+			/* error */
+			ptr->errno = LRerr_BadDataType;
+		}
+		break;
+	case logd:
+		ptr->ops = &logd_ops;
 		if (d == LR_int) {
 			ptr->p = (float) 0.5;
 			ptr->q = NAN;
-			ptr->rni  = LRi_geometric_RAN;
-			ptr->pdfi = LRi_geometric_PDF;
-			ptr->cdfi = LRi_geometric_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
 		}
 		break;
 	case binomial:
-		ptr->type = "binomial";
+		ptr->ops = &binomial_ops;
 		if (d == LR_int) {
 			ptr->p = (float) 0.5;
 			ptr->q = NAN;
 			ptr->n = 0;
-			ptr->rni  = LRi_binomial_RAN;
-			ptr->pdfi = LRi_binomial_PDF;
-			ptr->cdfi = LRi_binomial_CDF;
 		} else {
 			/* error */
 			ptr->errno = LRerr_BadDataType;
@@ -413,41 +470,139 @@ LR_obj *LR_new(LR_type t, LR_data_type d) {
 		ptr->errno = LRerr_BadLRType;
 		break;
 	}
+	LR_derive(ptr);
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_new(LR_type t, LR_data_type d) - create the LR object
+and preset some default parameter values.
 
+@param	t	LR_type (e.g. LR_gausbm)
+@param	d	LR_data_type (e.g. LR_double)
+@return	LR_obj *
+*/
+LR_obj *LR_new(LR_type t, LR_data_type d) {
+	LR_obj *ptr = (void *) NULL;
+	/* start the object (and so its hot part) on a cache line */
+	if (posix_memalign((void **) &ptr, LR_CACHELINE, sizeof(LR_obj)))
+		return (LR_obj *) NULL;
+	(void) memset(ptr, 0, sizeof(LR_obj));
+	if (LR_setup(ptr, t, d, (LR_arena *) NULL) == LRerr_AllocFail) {
+		free((void *) ptr);
+		ptr = (void *) NULL;
+	}
 	return  ptr;
+}
+
+/*!
+@brief	LR_new_in(LR_arena *a, LR_type t, LR_data_type d) - create the
+LR object within an arena and preset some default parameter values.
+
+The object and any auxiliary object (and its tables) are allocated from
+the arena, and are only released with the arena
+(see \c LR_arena_reset() and \c LR_arena_rm() ).
+
+@param	a	LR_arena pointer
+@param	t	LR_type (e.g. LR_gausbm)
+@param	d	LR_data_type (e.g. LR_double)
+@return	LR_obj *
+*/
+LR_obj *LR_new_in(LR_arena *a, LR_type t, LR_data_type d) {
+	LR_obj *ptr = (void *) NULL;
 
-objerr:
-	free((void *) ptr);
-	ptr = (void *) NULL;
+	if (!a)
+		return ptr;
+	if (!(ptr = (LR_obj *) LR_arena_alloc(a, sizeof(LR_obj))))
+		return ptr;
+	if (LR_setup(ptr, t, d, a) == LRerr_AllocFail)
+		return (LR_obj *) NULL;
+	ptr->flags |= LR_OBJ_ARENA;
 	return  ptr;
 }
 
+/*!
+@brief	LR_init(LR_obj *o, LR_type t, LR_data_type d) - initialize the
+LR object in the caller's storage and preset some default parameter values.
+
+The storage should be aligned to `LR_CACHELINE`, which is the case for
+any declared `LR_obj` variable or array.  Only the auxiliary object
+(for the \e piece, \e lspline, and \e uinvcdf distributions) is allocated,
+and \c LR_rm() will release it but not the storage.
+
+@param	o	LR_obj storage
+@param	t	LR_type (e.g. LR_gausbm)
+@param	d	LR_data_type (e.g. LR_double)
+@return	0	if successful, non-zero if an error
+*/
+int LR_init(LR_obj *o, LR_type t, LR_data_type d) {
+	if (!o)
+		return LRerr_Unspecified;
+	(void) memset(o, 0, sizeof(LR_obj));
+	if (LR_setup(o, t, d, (LR_arena *) NULL) == LRerr_AllocFail)
+		return o->errno = LRerr_AllocFail;
+	o->flags |= LR_OBJ_INPLACE;
+	return o->errno;
+}
+
+/* the attributes fill three cache lines (LP64) and the counters, if
+ * LRconfig.h has LR_COUNTERS, a fourth */
+#ifdef LR_COUNTERS
+#  define LR_OBJ_LINES	4
+#else
+#  define LR_OBJ_LINES	3
+#endif
+_Static_assert(sizeof(LR_obj) % LR_CACHELINE == 0,
+	"LR_obj is not padded to a multiple of LR_CACHELINE");
+_Static_assert(sizeof(void *) != 8
+	|| sizeof(LR_obj) == LR_OBJ_LINES * LR_CACHELINE,
+	"LR_obj is not the size its LRconfig.h layout should give");
+
+/*!
+@brief	LR_obj_size(void) - the size of the `LR_obj` object in the library
+
+Code allocating its own `LR_obj` storage (e.g. for \c LR_init() ) can
+check this against \c sizeof(LR_obj) to be sure the \c libran.h it was
+compiled with matches the library.
+
+@return	size of `LR_obj` (bytes)
+*/
+size_t LR_obj_size(void) {
+	return sizeof(LR_obj);
+}
+
 /*!
 @brief	LR_rm(LR_obj **o) - destroy the LR object and release allocated
 memory.
 
+Any auxiliary object (including the \e piece and \e lspline segment
+tables) is released too.  A stream releases its reference to the shared
+spec instead.  Objects from \c LR_init() keep their storage, and objects
+from \c LR_new_in() are only released with their arena.
+
 @param	o	Address of LR_obj pointer
 @return	0	if successful, non-zero if an error
 */
 int LR_rm(LR_obj **o) {
 	/* check if LR_obj */
-	if (o && *o) {
-		if (((*o)->t == piece)
-		||  ((*o)->t == lspline)) {
-			free((void *) (*o)->aux);
-		}
-		switch ((*o)->d) {
-		case LR_int:
-		case LR_long:
-		case LR_float:
-		case LR_double:
-			free((void *) *o);
-			*o = (LR_obj *) NULL;
-			return LRerr_OK;
-		default:
-			return LRerr_BadDataType;
-		}
+	if (!o || !*o)
+		return LRerr_Unspecified;
+
+	if ((*o)->spec) {
+		/* a stream - the aux object belongs to the spec */
+		(void) LR_spec_rm(&((*o)->spec));
+	} else if ((*o)->flags & LR_OBJ_ARENA) {
+		/* released with the arena */
+	} else if ((*o)->aux) {
+		if ((*o)->t == piece || (*o)->t == lspline)
+			(void) LR_pcs_rm(*o);
+		free((void *) (*o)->aux);
+		(*o)->aux = (void *) NULL;
 	}
+	if (!((*o)->flags & (LR_OBJ_ARENA | LR_OBJ_INPLACE)))
+		free((void *) *o);
+	*o = (LR_obj *) NULL;
+	return LRerr_OK;
 }
 
 /*!
@@ -499,7 +654,7 @@ int LR_check(LR_obj *o) {
 				/* error */
 				return o->errno = LRerr_BadDataType;
 			}
-			return LRerr_OK;
+			break;
 
 		/* mixed attributes (a,b,m,s) */
 		case uinvcdf:
@@ -551,9 +706,17 @@ int LR_check(LR_obj *o) {
 				/* error */
 				return o->errno = LRerr_BadDataType;
 			}
-			return LRerr_OK;
+			break;
 
 		/* full range (m,s) */
+		case gsnN:
+			if (o->k < 0) {
+				o->k = - o->k;
+			}
+			if (o->k < 1 || o->k > LR_GSN_MAX) {
+				return o->errno = LRerr_InvalidInputValue;
+			}
+			/* fall through */
 		case gausbm:
 		case gausmar:
 		case gsn12:
@@ -577,7 +740,7 @@ int LR_check(LR_obj *o) {
 				/* error */
 				return o->errno = LRerr_BadDataType;
 			}
-			return LRerr_OK;
+			break;
 		/* semi-infinite (m)*/
 		case nexp:
 			if (o->d == LR_double) {
@@ -598,7 +761,7 @@ int LR_check(LR_obj *o) {
 				/* error */
 				return o->errno = LRerr_BadDataType;
 			}
-			return LRerr_OK;
+			break;
 
 		case erlang:
 			if (o->k < 0) {
@@ -624,7 +787,7 @@ int LR_check(LR_obj *o) {
 				/* error */
 				return o->errno = LRerr_BadDataType;
 			}
-			return LRerr_OK;
+			break;
 
 		case poisson:
 			if (o->p < 0) {
@@ -632,7 +795,7 @@ int LR_check(LR_obj *o) {
 			} else if (o->p == 0) {
 				return o->errno = LRerr_InvalidInputValue;
 			}
-			return LRerr_OK;
+			break;
 
 		case geometric:
 			if (o->p < 0) {
@@ -641,7 +804,16 @@ int LR_check(LR_obj *o) {
 			if (o->p == 0 || o->p > 1) {
 				return o->errno = LRerr_InvalidInputValue;
 			}
-			return LRerr_OK;
+			break;
+
+		case logd:
+			if (o->p < 0) {
+				o->p = - o->p;
+			}
+			if (o->p == 0 || o->p >= 1) {
+				return o->errno = LRerr_InvalidInputValue;
+			}
+			break;
 
 		case binomial:
 			if (o->p < 0) {
@@ -653,16 +825,220 @@ int LR_check(LR_obj *o) {
 			if (o->n < 1 || o->p == 0 || o->p > 1) {
 				return o->errno = LRerr_InvalidInputValue;
 			}
-			return LRerr_OK;
+			break;
 
 		default:
 			return o->errno = LRerr_BadLRType;
 		}
+		/* attributes may have changed */
+		LR_derive(o);
+		return LRerr_OK;
 	} else {
 		return	LRerr_Unspecified;
 	}
 }
 
+/*!
+@brief	LR_derive(LR_obj *o) - compute the derived constants
+
+Compute all the per-type constants derived from the object attributes
+and store them in the \e rc and \e dc blocks.  The RAN methods only use
+\e rc (kept in the object's first cache line together with the
+generator state), the PDF and CDF methods use \e dc .  This is called whenever the
+attributes change (by \c LR_new(), \c LR_set(), \c LR_set_all(), and
+\c LR_check()) so there is generally no need to call it directly.
+
+Type            | rc[0]         | rc[1]
+--------------- | ------------- | -------------
+unif            | a             | b - a
+gausbm, gausmar | m             | s
+gsn2            | a             | (b - a)/2
+gsn4            | a             | (b - a)/4
+gsn12           | m             | s
+gsnN            | m - k w/2     | w = s sqrt(12/k)
+cauchy(mar)     | m             | s
+nexp, erlang    |               | -m
+poisson         | exp(-p)       |
+geometric       | 1/log(1 - p)  |
+logd            | log(1 - p)    |
+binomial        | -log(1 - p)   | n
+
+Type            | dc[0]         | dc[1]          | dc[2]
+--------------- | ------------- | -------------- | -------------
+unif            | b - a         | 1/(b - a)      |
+gausbm, gausmar | 1/s           | 1/(s sqrt(2pi))| 1/(s sqrt(2))
+gsn2            | (b - a)/2     | 2/(b - a)      |
+gsn4            | (b - a)/4     | 4/(b - a)      |
+gsn12           | 1/s           |                |
+gsnN            | 1/w           | m - k w/2      |
+cauchy(mar)     | s*s           | s/pi           | 1/s
+nexp, erlang    | 1/m           |                |
+poisson         | exp(-p)       |                |
+geometric       | 1/log(1 - p)  | 1 - p          |
+logd            | log(p)        | -1/log(1 - p)  |
+binomial        | log(p)        | log(1 - p)     |
+
+The \e float values are used for the \e int (discrete) distributions.
+
+@param	o	LR_obj pointer
+@return	void
+*/
+void LR_derive(LR_obj *o) {
+	double	done = 1.0, dtwo = 2.0, dfour = 4.0, dtwelve = 12.0;
+	float	fone = 1.0, ftwo = 2.0, ffour = 4.0, ftwelve = 12.0;
+
+	switch (o->t) {
+	case unif:
+		if (o->d == LR_double) {
+			o->dc[0].d = o->b.d - o->a.d;
+			o->dc[1].d = done / o->dc[0].d;
+			o->rc[0].d = o->a.d;
+			o->rc[1].d = o->dc[0].d;
+		} else if (o->d == LR_float) {
+			o->dc[0].f = o->b.f - o->a.f;
+			o->dc[1].f = fone / o->dc[0].f;
+			o->rc[0].f = o->a.f;
+			o->rc[1].f = o->dc[0].f;
+		}
+		break;
+	case gausbm:
+	case gausmar:
+		if (o->d == LR_double) {
+			o->dc[0].d = done / o->s.d;
+			o->dc[1].d = .5 * M_2_SQRTPI * M_SQRT1_2 * o->dc[0].d;
+			o->dc[2].d = M_SQRT1_2 * o->dc[0].d;
+			o->rc[0].d = o->m.d;
+			o->rc[1].d = o->s.d;
+		} else if (o->d == LR_float) {
+			o->dc[0].f = fone / o->s.f;
+			o->dc[1].f = .5 * M_2_SQRTPI * M_SQRT1_2 * o->dc[0].f;
+			o->dc[2].f = M_SQRT1_2 * o->dc[0].f;
+			o->rc[0].f = o->m.f;
+			o->rc[1].f = o->s.f;
+		}
+		break;
+	case gsn2:
+		if (o->d == LR_double) {
+			o->dc[0].d = (o->b.d - o->a.d) / dtwo;
+			o->dc[1].d = done / o->dc[0].d;
+			o->rc[0].d = o->a.d;
+			o->rc[1].d = o->dc[0].d;
+		} else if (o->d == LR_float) {
+			o->dc[0].f = (o->b.f - o->a.f) / ftwo;
+			o->dc[1].f = fone / o->dc[0].f;
+			o->rc[0].f = o->a.f;
+			o->rc[1].f = o->dc[0].f;
+		}
+		break;
+	case gsn4:
+		if (o->d == LR_double) {
+			o->dc[0].d = (o->b.d - o->a.d) / dfour;
+			o->dc[1].d = dfour / (o->b.d - o->a.d);
+			o->rc[0].d = o->a.d;
+			o->rc[1].d = o->dc[0].d;
+		} else if (o->d == LR_float) {
+			o->dc[0].f = (o->b.f - o->a.f) / ffour;
+			o->dc[1].f = ffour / (o->b.f - o->a.f);
+			o->rc[0].f = o->a.f;
+			o->rc[1].f = o->dc[0].f;
+		}
+		break;
+	case gsn12:
+		if (o->d == LR_double) {
+			o->dc[0].d = done / o->s.d;
+			o->rc[0].d = o->m.d;
+			o->rc[1].d = o->s.d;
+		} else if (o->d == LR_float) {
+			o->dc[0].f = fone / o->s.f;
+			o->rc[0].f = o->m.f;
+			o->rc[1].f = o->s.f;
+		}
+		break;
+	case gsnN:
+		if (o->d == LR_double) {
+			o->rc[1].d = o->s.d * sqrt(dtwelve / o->k);
+			o->rc[0].d = o->m.d - .5 * o->k * o->rc[1].d;
+			o->dc[0].d = done / o->rc[1].d;
+			o->dc[1].d = o->rc[0].d;
+		} else if (o->d == LR_float) {
+			o->rc[1].f = o->s.f * sqrtf(ftwelve / o->k);
+			o->rc[0].f = o->m.f - .5f * o->k * o->rc[1].f;
+			o->dc[0].f = fone / o->rc[1].f;
+			o->dc[1].f = o->rc[0].f;
+		}
+		break;
+	case cauchy:
+	case cauchymar:
+		if (o->d == LR_double) {
+			o->dc[0].d = o->s.d * o->s.d;
+			o->dc[1].d = o->s.d * M_1_PI;
+			o->dc[2].d = done / o->s.d;
+			o->rc[0].d = o->m.d;
+			o->rc[1].d = o->s.d;
+		} else if (o->d == LR_float) {
+			o->dc[0].f = o->s.f * o->s.f;
+			o->dc[1].f = o->s.f * M_1_PI;
+			o->dc[2].f = fone / o->s.f;
+			o->rc[0].f = o->m.f;
+			o->rc[1].f = o->s.f;
+		}
+		break;
+	case nexp:
+	case erlang:
+		if (o->d == LR_double) {
+			o->dc[0].d = done / o->m.d;
+			o->rc[1].d = - o->m.d;
+		} else if (o->d == LR_float) {
+			o->dc[0].f = fone / o->m.f;
+			o->rc[1].f = - o->m.f;
+		}
+		break;
+	case poisson:
+		o->dc[0].f = expf(- o->p);
+		o->rc[0].f = o->dc[0].f;
+		break;
+	case geometric:
+		o->dc[0].f = fone / logf(fone - o->p);
+		o->dc[1].f = fone - o->p;
+		o->rc[0].f = o->dc[0].f;
+		break;
+	case logd:
+		o->dc[0].f = logf(o->p);
+		o->rc[0].f = log1pf(- o->p);
+		o->dc[1].f = - fone / o->rc[0].f;
+		break;
+	case binomial:
+		o->dc[0].d = log((double) o->p);
+		o->dc[1].d = log1p(- (double) o->p);
+		o->rc[0].f = - logf(fone - o->p);
+		o->rc[1].i = o->n;
+		break;
+	default:
+		/* nothing to derive */
+		break;
+	}
+}
+
+/*!
+@brief	LR_freeze(LR_obj *o) - check the LR object and precompute all
+derived constants
+
+Call this once all the attributes (and any auxiliary objects) have been
+set.  It performs \c LR_check() which also fills the per-type \e dc block
+(see \c LR_derive()), after which the RAN, PDF, and CDF methods are
+straight arithmetic on the object attributes.
+
+Setting any attribute afterwards with \c LR_set() or \c LR_set_all()
+recomputes the derived constants, so the object never holds stale values.
+
+@param	o	LR_obj pointer
+@return	0	if successful, non-zero if an error or not possible to fix
+*/
+int LR_freeze(LR_obj *o) {
+	/* LR_check() recomputes the derived constants when successful */
+	return LR_check(o);
+}
+
 #ifdef __cplusplus
 }
 #endif
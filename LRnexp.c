@@ -44,6 +44,9 @@ extern "C" {
 
 #include <math.h>
 #include "libran.h"
+#include "LRmathf.h"
+#include "LRmathd.h"
+#include "LRkern.h"
 
 /* double */
 /*!
@@ -55,13 +58,45 @@ Default values: peak m = 1.
 @return double
 */
 double LRd_nexp_RAN(LR_obj *o) {
-	double u, zero = 0.0, one = 1.0;
+	double u, zero = 0.0;
 
 	do {
 		u = o->ud(o);
 	} while (u == zero);
 
-	return - o->m.d*log(u);
+	return o->rc[1].d*log(u);
+}
+
+/*!
+@brief	LRd_nexp_RAN_n(LR_obj *o, double *x, long n) - a batch of double random
+negative exponential variates (see \c LRd_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRd_nexp_RAN_n(LR_obj *o, double *x, long n) {
+	double	zero = 0.0, s = o->rc[1].d;
+	long	m = 0, k;
+
+	/* zeros are skipped (as by LRd_nexp_RAN()), by dropping them
+	 * and drawing the rest again */
+	while (m < n) {
+		(void) LR_drand_n(o, x + m, n - m);
+		for (k = m; m < n; m++) {
+			if (x[m] != zero)
+				x[k++] = x[m];
+		}
+		m = k;
+	}
+	if (o->flags & LR_OBJ_FAST) {
+		LR_kern_get()->dnexp(x, n, s);
+	} else {
+		for (long i = 0; i < n; i++)
+			x[i] = s*log(x[i]);
+	}
+	return LRerr_OK;
 }
 
 /*!
@@ -73,13 +108,11 @@ probablity distribution function
 @return double PDF at x
 */
 double LRd_nexp_PDF(LR_obj *o, double x) {
-	double zero = 0.0, one = 1.0;
-	if (isnan(o->s.d))
-		o->s.d = one/o->m.d;
+	double zero = 0.0, sa = o->dc[0].d;
 
 	if (x < zero)	return zero;
 
-	return o->s.d * exp(- o->s.d * x);
+	return sa * exp(- sa * x);
 }
 
 /*!
@@ -91,13 +124,23 @@ cumulative distribution function
 @return double CDF at x
 */
 double LRd_nexp_CDF(LR_obj *o, double x) {
-	double zero = 0.0, one = 1.0;
-	if (isnan(o->s.d))
-		o->s.d = one/o->m.d;
+	double zero = 0.0, one = 1.0, sa = o->dc[0].d;
 
 	if (x < zero)	return zero;
 
-	return one - exp(- o->s.d * x);
+	return one - exp(- sa * x);
+}
+
+/*!
+@brief	LRd_nexp_QUANT(LR_obj *o, double u) - double negative exponential
+quantile (inverse cumulative distribution function)
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return double x where the CDF is u
+*/
+double LRd_nexp_QUANT(LR_obj *o, double u) {
+	return o->rc[1].d*log1p(- u);
 }
 
 /* float */
@@ -110,13 +153,39 @@ Default values: peak m = 1.
 @return float
 */
 float LRf_nexp_RAN(LR_obj *o) {
-	float u, zero = 0.0, one = 1.0;
+	float u, zero = 0.0;
 
 	do {
 		u = o->uf(o);
 	} while (u == zero);
 
-	return - o->m.f*log(u);
+	return o->rc[1].f*LR_logf(u);
+}
+
+/*!
+@brief	LRf_nexp_RAN_n(LR_obj *o, float *x, long n) - a batch of float random
+negative exponential variates (see \c LRf_RAN_n() )
+
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRf_nexp_RAN_n(LR_obj *o, float *x, long n) {
+	float	zero = 0.0;
+	long	m = 0, k;
+
+	/* zeros are skipped (as by LRf_nexp_RAN()) */
+	while (m < n) {
+		(void) LR_frand_n(o, x + m, n - m);
+		for (k = m; m < n; m++) {
+			if (x[m] != zero)
+				x[k++] = x[m];
+		}
+		m = k;
+	}
+	LR_kern_get()->fnexp(x, n, o->rc[1].f);
+	return LRerr_OK;
 }
 
 /*!
@@ -128,13 +197,11 @@ probablity distribution function
 @return float PDF at x
 */
 float LRf_nexp_PDF(LR_obj *o, float x) {
-	float zero = 0.0, one = 1.0;
-	if (isnan(o->s.f))
-		o->s.f = one/o->m.f;
+	float zero = 0.0, sa = o->dc[0].f;
 
 	if (x < zero)	return zero;
 
-	return o->s.f * expf(- o->s.f * x);
+	return sa * LR_expf(- sa * x);
 }
 
 /*!
@@ -146,13 +213,23 @@ cumulative distribution function
 @return float CDF at x
 */
 float LRf_nexp_CDF(LR_obj *o, float x) {
-	float zero = 0.0, one = 1.0;
-	if (isnan(o->s.f))
-		o->s.f = one/o->m.f;
+	float zero = 0.0, one = 1.0, sa = o->dc[0].f;
 
 	if (x < zero)	return zero;
 
-	return one - expf(- o->s.f * x);
+	return one - LR_expf(- sa * x);
+}
+
+/*!
+@brief	LRf_nexp_QUANT(LR_obj *o, float u) - float negative exponential
+quantile (inverse cumulative distribution function)
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return float x where the CDF is u
+*/
+float LRf_nexp_QUANT(LR_obj *o, float u) {
+	return o->rc[1].f*log1pf(- u);
 }
 
 #ifdef __cplusplus
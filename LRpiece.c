@@ -82,39 +82,34 @@ int LR_pcs_new(LR_obj *o, int n) {
 	&&  o->t != lspline)
 		return o->errno = LRerr_BadLRType;
 
+	/* drop any previous set of segments */
+	(void) LR_pcs_rm(o);
+
 	ptr->n  = n;
 	ptr->nn = 1;	/* always start with one interval */
-	ptr->c  = 0;
 	ptr->norm  = 0.;
 	ptr->flags  = 0;
 
-	if (!(ptr->bdrs = (double *) calloc(n, sizeof(double))))
-		goto bad0;
-
-	if (!(ptr->c = (double *) calloc(n, sizeof(double))))
-		goto bad1;
+	/* one allocation for all three tables */
+	if (ptr->arena)
+		ptr->bdrs = (double *) LR_arena_alloc(ptr->arena,
+			3 * (n + 1) * sizeof(double));
+	else
+		ptr->bdrs = (double *) calloc(3 * (n + 1), sizeof(double));
+	if (!ptr->bdrs)
+		return o->errno = LRerr_AllocFail;
 
-	if (!(ptr->sc = (double *) calloc(n + 1, sizeof(double))))
-		goto bad2;
+	ptr->c  = ptr->bdrs + (n + 1);
+	ptr->sc = ptr->c + (n + 1);
 
 	return LRerr_OK;
-
-bad2:
-	free((void *) ptr->sc);
-
-bad1:
-	free((void *) ptr->c);
-
-bad0:
-	free((void *) ptr->bdrs);
-
-	return o->errno = LRerr_AllocFail;
 }
 
 /*!
 @brief	LR_pcs_rm(LR_obj *o) - strip out the LR_pcs object part of LR_obj
 
 Removes the allocated memory for the segment pieces.
+It's safe to call more than once, and \c LR_rm() calls it too.
 
 @param	o	LR_obj object address
 @return	0 if successful, else non-zero if failed
@@ -124,9 +119,10 @@ int LR_pcs_rm(LR_obj *o) {
 	if (o && (o->t == piece || o->t == lspline)
 	&&  o->aux) {
 		aux = (LR_pcs *) o->aux;
-		free((void *) aux->bdrs);
-		free((void *) aux->c);
-		free((void *) aux->sc);
+		/* arena tables are released with the arena */
+		if (!aux->arena)
+			free((void *) aux->bdrs);
+		aux->bdrs = aux->c = aux->sc = (double *) NULL;
 		return LRerr_OK;
 	}
 	return o->errno = LRerr_Unspecified;
@@ -275,8 +271,20 @@ random variate.
 @return double if OK, else NaN
 */
 double LRd_piece_RAN(LR_obj *o) {
+	return LRd_piece_QUANT(o, o->ud(o));
+}
+
+/*!
+@brief	LRd_piece_QUANT(LR_obj *o, double u) - double piecewise uniform quantile
+(inverse cumulative distribution function)
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return double x where the CDF is u if OK, else NaN
+*/
+double LRd_piece_QUANT(LR_obj *o, double u) {
 	LR_pcs *aux = (LR_pcs *) o->aux;
-	double x, dx, zero = 0.0;
+	double dx, zero = 0.0;
 	int i = 0;
 
 	/* must have successfully normalized */
@@ -285,13 +293,13 @@ double LRd_piece_RAN(LR_obj *o) {
 		return NAN;
 	}
 
-	x = o->ud(o);
-	/* find interval */
-	while (x > aux->sc[i])	i++;
+	/* find interval (sc[0] = 0, so u = 0 falls in the first one) */
+	i = 1;
+	while (u > aux->sc[i] && i < aux->nn)	i++;
 
 	if (aux->c[i-1] == zero)	return aux->bdrs[i-1];
 
-	dx = (x - aux->sc[i-1]) / (aux->c[i-1] * aux->norm);
+	dx = (u - aux->sc[i-1]) / (aux->c[i-1] * aux->norm);
 	return aux->bdrs[i-1] + dx;
 }
 
@@ -358,8 +366,20 @@ double LRd_piece_CDF(LR_obj *o, double x) {
 @return float if OK, else NaN
 */
 float LRf_piece_RAN(LR_obj *o) {
+	return LRf_piece_QUANT(o, o->uf(o));
+}
+
+/*!
+@brief	LRf_piece_QUANT(LR_obj *o, float u) - float piecewise uniform quantile
+(inverse cumulative distribution function)
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return float x where the CDF is u if OK, else NaN
+*/
+float LRf_piece_QUANT(LR_obj *o, float u) {
 	LR_pcs *aux = (LR_pcs *) o->aux;
-	float x, dx, zero = 0.0;
+	float dx, zero = 0.0;
 	int i = 0;
 
 	/* must have successfully normalized */
@@ -368,13 +388,13 @@ float LRf_piece_RAN(LR_obj *o) {
 		return NAN;
 	}
 
-	x = o->ud(o);
-	/* find interval */
-	while (x > aux->sc[i])	i++;
+	/* find interval (sc[0] = 0, so u = 0 falls in the first one) */
+	i = 1;
+	while (u > aux->sc[i] && i < aux->nn)	i++;
 
 	if (aux->c[i-1] == zero)	return aux->bdrs[i-1];
 
-	dx = (x - aux->sc[i-1]) / (aux->c[i-1] * aux->norm);
+	dx = (u - aux->sc[i-1]) / (aux->c[i-1] * aux->norm);
 	return aux->bdrs[i-1] + dx;
 }
 
@@ -53,7 +53,9 @@ extern "C" {
 #endif
 
 #include <math.h>
+#include <float.h>
 #include "libran.h"
+#include "LRquant.h"
 
 /* int */
 /*!
@@ -64,10 +66,8 @@ Default values: scale m = 1.
 @return int
 */
 int LRi_poisson_RAN(LR_obj *o) {
-	float zero = 0.0, one = 1.0, u, p = one;
+	float zero = 0.0, one = 1.0, q = o->rc[0].f, u, p = one;
 	int kk = 0;
-	if (isnan(o->q))
-		o->q = expf(-o->p);
 
 	do {
 		do {
@@ -75,7 +75,7 @@ int LRi_poisson_RAN(LR_obj *o) {
 		} while (u == zero);
 		kk++;
 		p *= u;
-	} while (p > o->q);
+	} while (p > q);
 
 	return kk - 1;
 }
@@ -89,19 +89,17 @@ probablity (or mass) distribution function
 @return float PDF at x
 */
 float LRi_poisson_PDF(LR_obj *o, int x) {
-	float zero = 0.0, one = 1.0, p = one;
-	if (isnan(o->q))
-		o->q = expf(- o->p);
+	float zero = 0.0, one = 1.0, q = o->dc[0].f, p = one;
 
 	if (x < 0)	return zero;
 
 	if (x == 0) {
-		return o->q;
+		return q;
 	} else {
 		for (int nn = 1; nn <= x; nn++) {
 			p *= (o->p/nn);
 		}
-		return p * o->q;
+		return p * q;
 	}
 }
 
@@ -114,23 +112,56 @@ cumulative distribution function
 @return float CDF at x
 */
 float LRi_poisson_CDF(LR_obj *o, int x) {
-	float zero = 0.0, one = 1.0, p = one, s = one;
-	if (isnan(o->q))
-		o->q = expf(- o->p);
+	float zero = 0.0, one = 1.0, q = o->dc[0].f, p = one, s = one;
 
 	if (x < 0)	return zero;
 
 	if (x == 0) {
-		return o->q;
+		return q;
 	} else {
 		for (int nn = 1; nn <= x; nn++) {
 			p *= (o->p/nn);
 			s += p;
 		}
-		return s * o->q;
+		return s * q;
 	}
 }
 
+/*!
+@brief	LRi_poisson_QUANT(LR_obj *o, float u) - Poisson distribution
+quantile (inverse cumulative distribution function)
+
+The PDF is found at the mode from its logarithm (so it does not
+underflow for large \e p ), then by recurrence down to where the lower
+tail is negligible against \e u , and summed back up from there until
+it reaches \e u .
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return int smallest k where the CDF is at least u
+*/
+int LRi_poisson_QUANT(LR_obj *o, float u) {
+	double	zero = 0.0, l = o->p, t, s;
+	int	m, kk;
+
+	if (u <= zero)	return 0;
+
+	/* the mode & the PDF there */
+	m = (int) floor(l);
+	t = exp(m * log(l) - l - LR_lfact(m));
+	/* down to where the terms no longer count */
+	for (kk = m; kk > 0 && t > DBL_EPSILON * u; kk--)
+		t *= kk / l;
+	/* and sum up */
+	for (s = t; s < u; s += t) {
+		kk++;
+		t *= l / kk;
+		if (kk > m && t <= DBL_EPSILON * s)
+			break;
+	}
+	return kk;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,137 @@
+/*!	\file LRquant.h
+ *	\brief The unit Gaussian quantile and log factorial (internal)
+
+The Gaussian quantile methods use the first two directly, and the \e erlang and
+\e gsn quantile methods use them for the starting guesses of their
+Newton iterations.  They are M.J. Wichura's algorithm AS241
+(Applied Statistics 37, 477-484 (1988)): \c LR_ppndd() is PPND16,
+good to about 1 part in \f$ 10^{16} \f$ , and \c LR_ppndf() is PPND7,
+good to about 1 part in \f$ 10^{7} \f$ .  Both give
+\f$ \mp\infty \f$ at 0 and 1 and do not check for other values outside
+\f$ [0,1] \f$.
+
+\c LR_lfact() is \f$ \log k! \f$ , from which the \e poisson and
+\e binomial quantile methods find the PMF at the mode without it
+underflowing (and the \e binomial PDF and CDF their terms).  It sums the logarithms for small \e k and otherwise
+uses Stirling's series, good to about 1 part in \f$ 10^{15} \f$ ,
+rather than \c lgamma() which sets the global \c signgam
+(not thread-safe).
+
+This header is not installed.
+ */
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+
+#ifndef 	_LRQUANT_H_
+#  define	_LRQUANT_H_
+#  ifdef __cplusplus
+extern "C" {
+#  endif
+
+#  include <math.h>
+
+/* the x where the unit Gaussian CDF is p */
+static inline double LR_ppndd(double p) {
+	double	zero = 0.0, one = 1.0, half = 0.5,
+		split1 = 0.425, split2 = 5.0,
+		const1 = 0.180625, const2 = 1.6, q, r, x;
+
+	if (p <= zero)	return -INFINITY;
+	if (p >= one)	return INFINITY;
+
+	q = p - half;
+	if (fabs(q) <= split1) {
+		r = const1 - q * q;
+		return q * (((((((r * 2509.0809287301226727
+			+ 33430.575583588128105) * r + 67265.770927008700853) * r
+			+ 45921.953931549871457) * r + 13731.693765509461125) * r
+			+ 1971.5909503065514427) * r + 133.14166789178437745) * r
+			+ 3.387132872796366608)
+		/ (((((((r * 5226.495278852545925
+			+ 28729.085735721942674) * r + 39307.89580009271061) * r
+			+ 21213.794301586595867) * r + 5394.1960214247511077) * r
+			+ 687.1870074920579083) * r + 42.313330701600911252) * r
+			+ one);
+	}
+	r = sqrt(- log(q < zero ? p : one - p));
+	if (r <= split2) {
+		r -= const2;
+		x = (((((((r * 7.7454501427834140764e-4
+			+ .0227238449892691845833) * r + .24178072517745061177) * r
+			+ 1.27045825245236838258) * r + 3.64784832476320460504) * r
+			+ 5.7694972214606914055) * r + 4.6303378461565452959) * r
+			+ 1.42343711074968357734)
+		/ (((((((r * 1.05075007164441684324e-9
+			+ 5.475938084995344946e-4) * r + .0151986665636164571966) * r
+			+ .14810397642748007459) * r + .68976733498510000455) * r
+			+ 1.6763848301838038494) * r + 2.05319162663775882187) * r
+			+ one);
+	} else {
+		r -= split2;
+		x = (((((((r * 2.01033439929228813265e-7
+			+ 2.71155556874348757815e-5) * r + .0012426609473880784386) * r
+			+ .026532189526576123093) * r + .29656057182850489123) * r
+			+ 1.7848265399172913358) * r + 5.4637849111641143699) * r
+			+ 6.6579046435011037772)
+		/ (((((((r * 2.04426310338993978564e-15
+			+ 1.4215117583164458887e-7) * r + 1.8463183175100546818e-5) * r
+			+ 7.868691311456132591e-4) * r + .0148753612908506148525) * r
+			+ .13692988092273580531) * r + .59983220655588793769) * r
+			+ one);
+	}
+	return (q < zero ? -x : x);
+}
+
+static inline float LR_ppndf(float p) {
+	float	zero = 0.0, one = 1.0, half = 0.5,
+		split1 = 0.425, split2 = 5.0,
+		const1 = 0.180625, const2 = 1.6, q, r, x;
+
+	if (p <= zero)	return -INFINITY;
+	if (p >= one)	return INFINITY;
+
+	q = p - half;
+	if (fabsf(q) <= split1) {
+		r = const1 - q * q;
+		return q * (((59.109374720f * r + 159.29113202f) * r
+			+ 50.434271938f) * r + 3.3871327179f)
+		/ (((67.187563600f * r + 78.757757664f) * r
+			+ 17.895169469f) * r + one);
+	}
+	r = sqrtf(- logf(q < zero ? p : one - p));
+	if (r <= split2) {
+		r -= const2;
+		x = (((0.17023821103f * r + 1.3067284816f) * r
+			+ 2.7568153900f) * r + 1.4234372777f)
+		/ ((0.12021132975f * r + 0.73700164250f) * r + one);
+	} else {
+		r -= split2;
+		x = (((0.017337203997f * r + 0.42868294337f) * r
+			+ 3.0812263860f) * r + 6.6579051150f)
+		/ ((0.012258202635f * r + 0.24197894225f) * r + one);
+	}
+	return (q < zero ? -x : x);
+}
+
+/* log k! for k >= 0 */
+static inline double LR_lfact(double k) {
+	double	zero = 0.0, half = 0.5, one = 1.0, x = k + one, x2, s = zero;
+
+	if (k < 16.0) {
+		for (double j = 2.0; j <= k; j++)
+			s += log(j);
+		return s;
+	}
+	/* log Gamma(x) = (x-1/2) log x - x + log(2 pi)/2 + 1/(12x) - ... */
+	x2 = one / (x * x);
+	s = (((- x2 / 1680.0 + one / 1260.0) * x2 - one / 360.0) * x2
+		+ one / 12.0) / x;
+	return (x - half) * log(x) - x + 0.91893853320467274178 + s;
+}
+
+#  ifdef __cplusplus
+}
+#  endif
+#endif	/* _LRQUANT_H_ */
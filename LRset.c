@@ -62,6 +62,9 @@ A \e real error will result in a positive return value.
 
 All other characters in the \e format string are an ignorable error.
 
+The derived constants (see \c LR_freeze()) are recomputed afterwards.
+The attributes of a stream object (see \c LR_stream_new()) can't be set.
+
 The precision of the input values are governed by the \c LR_obj
 \c LR_data_type, except for 'k','n' which are \c int only, and
 except for 'p','q' which are \c float only.
@@ -79,6 +82,10 @@ int LR_vset(LR_obj *o, char *x, va_list ap) {
 	char	x1;
 	int	ret = 0;
 
+	/* the attributes of a stream belong to its shared spec */
+	if (o->spec)
+		return o->errno = LRerr_SharedObject;
+
 	while (x1 = *x++) {
 		switch (x1) {
 		case	'k':
@@ -119,7 +126,7 @@ int LR_vset(LR_obj *o, char *x, va_list ap) {
 		}
 		switch (x1) {
 		case	'd':
-			(void) memcpy(&(o->d), &t, sizeof(LR_val));
+			(void) memcpy(&(o->d), &t, sizeof(o->d));
 			break;
 		case	'a':
 			(void) memcpy(&(o->a), &t, sizeof(LR_val));
@@ -147,6 +154,8 @@ int LR_vset(LR_obj *o, char *x, va_list ap) {
 			ret++;
 		}
 	}
+	/* keep the derived constants current */
+	LR_derive(o);
 	return -ret;
 }
 
@@ -205,6 +214,36 @@ int LR_set_all(LR_obj *o, char *x, ...) {
 	return ret;
 }
 
+/*!
+@brief	LR_fast(LR_obj *o, int on) - use fast math approximations
+
+When on, the double methods use the inline approximations of LRmathd.h
+for the functions where the C library is the slower - sin & cos
+(\e gausbm), tan (\e cauchy), and erf (the \e gaus CDF) - and the batch
+methods (see \c LRd_RAN_n()) use them for log too, so that their loops
+are vectorized.  The float \e gaus CDF uses the LRmathf.h erf (the other
+float methods always use LRmathf.h).  The approximations are within a
+few ulp (see LRmathd.h), far below the sampling noise of any practical
+number of variates, but the variates differ from those without.
+
+Objects start in fast math mode if the library was configured with
+\c --enable-fast-math , and streams start in the mode of their spec.
+Unlike the attributes the mode can be set for a stream.
+
+@param	o	LR_obj object
+@param	on	non-zero for fast math
+@return	0 if successful, else non-zero if failed
+*/
+int LR_fast(LR_obj *o, int on) {
+	if (!o)
+		return LRerr_Unspecified;
+	if (on)
+		o->flags |= LR_OBJ_FAST;
+	else
+		o->flags &= ~LR_OBJ_FAST;
+	return LRerr_OK;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,352 @@
+/*!
+\file	LRsobol.c
+\brief	A scrambled Sobol sequence of quasi-random points for quasi-Monte Carlo
+
+The `LR_sobol` object gives the successive points of the \e d
+dimensional Sobol sequence (I.M. Sobol', "On the distribution of points
+in a cube and the approximate evaluation of integrals", USSR Comput.
+Math. Math. Phys. 7, 86-112 (1967)) for \e d up to \c LR_SOBOL_MAX .
+Rather than being independent like pseudo-random numbers the points
+fill the unit cube evenly, so the error of a quasi-Monte Carlo
+average of a smooth integrand over \e n points falls nearly as
+\f$ 1/n \f$ instead of \f$ 1/\sqrt{n} \f$ .  The first \f$ 2^m \f$
+points (and each later block of them) are a \f$ (t,m,d) \f$-net, so
+use a power of 2 points when possible.
+
+Each coordinate is the exclusive-or of the direction numbers
+\f$ v_j \f$ of the dimension for the bits \e j of the Gray code
+\f$ g = i \oplus \lfloor i/2 \rfloor \f$ of the point index \e i ,
+so the next point differs from the last by just the one direction number
+for the lowest zero bit of \e i (Antonov and Saleev).  The direction
+numbers are those of Joe and Kuo (see LRsobtab.h) with
+\c LR_SOBOL_BITS bits, and the coordinates are returned as the centres
+of the intervals of the highest 52 bits, so they lie strictly in (0,1)
+and can be handed to any quantile function.
+
+Scrambling
+----------
+
+With a non-zero seed the sequence is scrambled by Matousek's random
+linear scrambling with a random digital shift (J. Matousek, "On the
+L2-discrepancy for anchored boxes", J. Complexity 14, 527-556 (1998)):
+the direction numbers of each dimension are multiplied by a random
+lower triangular (unit diagonal) binary matrix and each point is shifted
+by exclusive-or with a random number.  This keeps the net property, but
+each point is then uniformly distributed, so the QMC estimate is
+unbiased, and independent scramblings (different seeds) give
+an error estimate from their spread.  With a zero seed
+the sequence is the plain Sobol sequence (whose first point is the
+centre of the cube's lowest corner interval).
+
+Parallel use
+------------
+
+The point of any index is found directly with \c LR_sobol_skip(),
+so parallel workers can share one sequence by each having its own
+`LR_sobol` object, made with the same dimension and seed,
+and skipping to the start of its own block of indices.
+
+Sampling any distribution
+-------------------------
+
+The points sample other distributions by inversion, one dimension per
+variate, by passing each coordinate to the quantile of its `LR_obj`
+(see \c LR_sobol_quant() ).  The rejection and multiple uniform
+methods of the \c LR?_RAN() functions do not keep the even spread of
+the points and so are not used.
+
+\code
+#include <stdio.h>
+#include "libran.h"
+...
+// E[exp(-(X1^2 + X2^2))] for X1,X2 unit Gaussian
+LR_sobol *s = LR_sobol_new(2, 1234);
+LR_obj	*o[2] = {LR_new(gausbm, LR_double), LR_new(gausbm, LR_double)};
+double	x[2], sum = 0.0;
+long	n = 1l << 16;
+for (long i = 0; i < n; i++) {
+	LR_sobol_quant(s, o, x);
+	sum += exp(-(x[0]*x[0] + x[1]*x[1]));
+}
+printf("%g\n", sum / n);		// 1/3
+...
+LR_sobol_rm(&s);
+\endcode
+
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>	/* calloc,free */
+#include <limits.h>	/* ULONG_MAX */
+#include <float.h>	/* FLT_EPSILON */
+#include <math.h>	/* NAN,isnan() */
+#include "libran.h"
+#include "LRsobtab.h"
+
+/* the scrambling generator (splitmix64) */
+static unsigned long LR_sobol_rand(unsigned long *r) {
+	unsigned long	z = (*r += 0x9E3779B97F4A7C15ul);
+
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ul;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBul;
+	return z ^ (z >> 31);
+}
+
+/* the parity of the bits of x */
+static int LR_sobol_parity(unsigned long x) {
+	for (int sh = LR_SOBOL_BITS / 2; sh; sh >>= 1)
+		x ^= x >> sh;
+	return (int) (x & 1ul);
+}
+
+/* the direction numbers v[j*d + k], j = 0..LR_SOBOL_BITS-1,
+ * of dimension k (counted from 0) */
+static void LR_sobol_dir(LR_sobol *s, int k) {
+	unsigned long	*v = s->v + k, one = 1ul;
+	int		d = s->d, sd;
+	unsigned int	a;
+
+	if (k == 0) {
+		/* van der Corput */
+		for (int j = 0; j < LR_SOBOL_BITS; j++)
+			v[j*d] = one << (LR_SOBOL_BITS - 1 - j);
+		return;
+	}
+	a = LR_sobol_tab[k - 1].a;
+	for (sd = 0; a >> (sd + 1); sd++)
+		;	/* the degree */
+	for (int j = 0; j < sd; j++)
+		v[j*d] = (unsigned long) LR_sobol_tab[k - 1].m[j]
+			<< (LR_SOBOL_BITS - 1 - j);
+	/* v_j = c_1 v_{j-1} ^ ... ^ c_{s-1} v_{j-s+1} ^ v_{j-s} ^ v_{j-s}/2^s
+	 * where c_l is the coefficient of x^{s-l} */
+	for (int j = sd; j < LR_SOBOL_BITS; j++) {
+		unsigned long	w = v[(j - sd)*d];
+
+		w ^= w >> sd;
+		for (int l = 1; l < sd; l++)
+			if ((a >> (sd - l)) & 1u)
+				w ^= v[(j - l)*d];
+		v[j*d] = w;
+	}
+}
+
+/* Matousek's linear scrambling of dimension k: each bit b of the
+ * direction numbers becomes the parity of their bits b and above
+ * picked by row b of a random lower triangular matrix */
+static void LR_sobol_scramble(LR_sobol *s, int k, unsigned long *r) {
+	unsigned long	L[LR_SOBOL_BITS], *v = s->v + k, one = 1ul, w;
+	int		d = s->d;
+
+	for (int b = 0; b < LR_SOBOL_BITS; b++) {
+		/* the bits above the diagonal (none for the top bit) */
+		w = (b == LR_SOBOL_BITS - 1 ? 0ul : ~((one << (b + 1)) - one));
+		L[b] = (one << b) | (LR_sobol_rand(r) & w);
+	}
+	for (int j = 0; j < LR_SOBOL_BITS; j++) {
+		w = 0ul;
+		for (int b = 0; b < LR_SOBOL_BITS; b++)
+			w |= (unsigned long) LR_sobol_parity(L[b] & v[j*d]) << b;
+		v[j*d] = w;
+	}
+	s->e[k] = LR_sobol_rand(r);
+}
+
+/* the coordinate of the point bits x in (0,1) */
+static inline double LR_sobol_u(unsigned long x) {
+	double	half = 0.5, scale = 0x1p-52;
+
+	return ((double) (x >> (LR_SOBOL_BITS - 52)) + half) * scale;
+}
+
+/* advance the point bits x to the index i+1 */
+static inline void LR_sobol_step(LR_sobol *s) {
+	unsigned long	i = s->i, *v = s->v, *x = s->x;
+	int		c = 0, d = s->d;
+
+	/* the lowest zero bit of i */
+	while (i & 1ul) {
+		i >>= 1;
+		c++;
+	}
+	v += c * d;
+	for (int k = 0; k < d; k++)
+		x[k] ^= v[k];
+	s->i++;
+}
+
+/*!
+@brief	LR_sobol_new(int d, long seed) - create new Sobol sequence
+
+The sequence starts at the point of index 0.  The same dimension
+and seed always give the same sequence.
+
+@param	d	dimension (1 to LR_SOBOL_MAX)
+@param	seed	scrambling seed (0 for the plain Sobol sequence)
+@return	LR_sobol object if successful, else NULL
+*/
+LR_sobol *LR_sobol_new(int d, long seed) {
+	LR_sobol	*ptr = (void *) NULL;
+	unsigned long	r = (unsigned long) seed;
+
+	if (d < 1 || d > LR_SOBOL_MAX)
+		return ptr;
+	if (!(ptr = (LR_sobol *) calloc(1, sizeof(LR_sobol))))
+		return ptr;
+	ptr->d = d;
+	ptr->seed = seed;
+	ptr->x = (unsigned long *) calloc(d, sizeof(unsigned long));
+	ptr->e = (unsigned long *) calloc(d, sizeof(unsigned long));
+	ptr->v = (unsigned long *) calloc((size_t) LR_SOBOL_BITS * d,
+		sizeof(unsigned long));
+	if (!ptr->x || !ptr->e || !ptr->v) {
+		(void) LR_sobol_rm(&ptr);
+		return ptr;
+	}
+	for (int k = 0; k < d; k++) {
+		LR_sobol_dir(ptr, k);
+		if (seed)
+			LR_sobol_scramble(ptr, k, &r);
+	}
+	(void) LR_sobol_skip(ptr, 0ul);
+	return ptr;
+}
+
+/*!
+@brief	LR_sobol_rm(LR_sobol **s) - remove Sobol sequence
+
+@param	s	LR_sobol object address
+@return	0 if successful, else non-zero if failed
+*/
+int LR_sobol_rm(LR_sobol **s) {
+	if (s && *s) {
+		free((void *) (*s)->x);
+		free((void *) (*s)->e);
+		free((void *) (*s)->v);
+		free((void *) *s);
+		*s = (LR_sobol *) NULL;
+		return LRerr_OK;
+	}
+	return LRerr_Unspecified;
+}
+
+/*!
+@brief	LR_sobol_skip(LR_sobol *s, unsigned long i) - skip to the
+point of index i
+
+The next point will be that of index \e i (ahead or back), found
+directly from its Gray code in \f$ O(d \log i) \f$ steps.
+
+@param	s	LR_sobol object
+@param	i	index of the next point
+@return	0 if successful, else non-zero if failed
+*/
+int LR_sobol_skip(LR_sobol *s, unsigned long i) {
+	unsigned long	g = i ^ (i >> 1), *v = s->v;
+	int		d = s->d;
+
+	for (int k = 0; k < d; k++)
+		s->x[k] = s->e[k];
+	for (int j = 0; g; j++, g >>= 1) {
+		if (g & 1ul)
+			for (int k = 0; k < d; k++)
+				s->x[k] ^= v[j*d + k];
+	}
+	s->i = i;
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_sobol_next(LR_sobol *s, double *u) - the next point
+
+@param	s	LR_sobol object
+@param	u	the d coordinates of the point, each in (0,1)
+@return	0 if successful, else non-zero if failed
+*/
+int LR_sobol_next(LR_sobol *s, double *u) {
+	if (s->i == ULONG_MAX)
+		return s->errno = LRerr_TooManyValues;
+	for (int k = 0; k < s->d; k++)
+		u[k] = LR_sobol_u(s->x[k]);
+	LR_sobol_step(s);
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_sobol_next_n(LR_sobol *s, double *u, long n) - the next n points
+
+This is the batch version of \c LR_sobol_next() , giving the \e n
+points one after the other, so coordinate \e k of point \e j is
+\e u[j*d + k] .
+
+@param	s	LR_sobol object
+@param	u	the n*d coordinates of the points
+@param	n	number of points
+@return	0 if successful, else non-zero if failed
+*/
+int LR_sobol_next_n(LR_sobol *s, double *u, long n) {
+	int	d = s->d;
+
+	if (n < 0)
+		return s->errno = LRerr_InvalidInputValue;
+	if ((unsigned long) n > ULONG_MAX - s->i)
+		return s->errno = LRerr_TooManyValues;
+	for (long j = 0; j < n; j++, u += d) {
+		for (int k = 0; k < d; k++)
+			u[k] = LR_sobol_u(s->x[k]);
+		LR_sobol_step(s);
+	}
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_sobol_quant(LR_sobol *s, LR_obj **o, double *x) - the next
+point sampled from a distribution in each dimension
+
+Coordinate \e k of the next point is passed to the quantile of the
+distribution \e o[k] (of any data type), so \e x[k] is distributed as
+\c LR?_RAN(o[k]) but the points keep the even spread of the sequence.
+
+@param	s	LR_sobol object
+@param	o	the d LR_obj objects, one for each dimension
+@param	x	the d variates
+@return	0 if successful, else non-zero if failed (NAN for that variate)
+*/
+int LR_sobol_quant(LR_sobol *s, LR_obj **o, double *x) {
+	float	one = 1.0, top = one - .5f * FLT_EPSILON, u;
+	int	ret;
+
+	if ((ret = LR_sobol_next(s, x)))
+		return ret;
+	for (int k = 0; k < s->d; k++) {
+		/* kept below 1 when rounded */
+		u = (x[k] < top ? (float) x[k] : top);
+		switch (o[k]->d) {
+		case LR_double:
+			x[k] = LRd_QUANT(o[k], x[k]);
+			break;
+		case LR_float:
+			x[k] = LRf_QUANT(o[k], u);
+			break;
+		case LR_int:
+			x[k] = LRi_QUANT(o[k], u);
+			break;
+		default:
+			x[k] = NAN;
+			o[k]->errno = LRerr_BadDataType;
+		}
+		if (isnan(x[k]) && !ret)
+			ret = s->errno = o[k]->errno;
+	}
+	return ret;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,153 @@
+/*!
+\file	LRspec.c
+\brief	Shared read-only distribution specs and per-thread streams
+
+An `LR_obj` object holds both the distribution definition (the
+attributes and any auxiliary tables such as the \e piece or \e lspline
+segments) and the pseudo-random generator state.  When many threads
+sample the same distribution each one needs its own generator state, but
+there is no need for each to have its own copy of the definition.
+
+Once an `LR_obj` object has been fully set up it can be turned into a
+reference counted `LR_spec` spec with \c LR_spec_new().  The spec takes
+over the object, which can no longer be modified.
+Then any number of \e stream objects can be made from the spec with
+\c LR_stream_new().  A stream is an ordinary `LR_obj` object and
+can be used with all the usual methods, but it shares the spec's
+auxiliary tables rather than copying them.  Its attributes can't be changed
+(\c LR_set() and the \c LR_aux_*() methods return \c LRerr_SharedObject ).
+Each stream holds a reference to the spec, and the spec is released when
+the last stream and the spec itself are removed.
+
+\code
+#include "libran.h"
+...
+LR_obj *o = LR_new(piece, LR_double);
+LR_set_all(o,"abx", 0., 8., 4.);
+LR_aux_new(o,6);
+LR_aux_set(o, 2.0, 1.0);
+...
+LR_aux_norm(o);
+// hand the object over to a shared spec (o is set to NULL)
+LR_spec *spec = LR_spec_new(&o);
+...
+// in each thread
+LR_obj *s = LR_stream_new(spec);
+LR_lsetseed(s, myseed);
+x = LRd_RAN(s);
+...
+LR_rm(&s);
+...
+// when done with the spec
+LR_spec_rm(&spec);
+\endcode
+
+\see LRnew.c
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>	/* calloc,posix_memalign,free */
+#include <string.h>	/* memcpy */
+#include "libran.h"
+
+/*!
+@brief	LR_spec_new(LR_obj **o) - create a shared spec from a set up LR_obj
+
+The object is checked (see \c LR_check()), and the auxiliary methods
+must have been normalized for those distributions that need them.
+If successful the spec takes over the object and \e *o is set to NULL,
+else the object is left in place with its \e errno set.
+
+@param	o	Address of LR_obj pointer
+@return	LR_spec * with one reference, or NULL if failed
+*/
+LR_spec *LR_spec_new(LR_obj **o) {
+	LR_spec *ptr = (void *) NULL;
+
+	if (!o || !*o || (*o)->spec)
+		return ptr;
+	if (LR_check(*o))
+		return ptr;
+	if (((*o)->t == piece || (*o)->t == lspline)
+	&&  !(((LR_pcs *) (*o)->aux)->flags & LR_AUX_NORM)) {
+		(*o)->errno = LRerr_NoAuxNormalizeDone;
+		return ptr;
+	}
+	if (!(ptr = (LR_spec *) calloc(sizeof(LR_spec),1))) {
+		(*o)->errno = LRerr_AllocFail;
+		return ptr;
+	}
+	ptr->o = *o;
+	ptr->refs = 1;
+	*o = (LR_obj *) NULL;
+	return ptr;
+}
+
+/*!
+@brief	LR_spec_ref(LR_spec *s) - take another reference to the spec
+
+@param	s	LR_spec pointer
+@return	LR_spec * the same spec
+*/
+LR_spec *LR_spec_ref(LR_spec *s) {
+	if (s)
+		(void) __atomic_add_fetch(&(s->refs), 1, __ATOMIC_RELAXED);
+	return s;
+}
+
+/*!
+@brief	LR_spec_rm(LR_spec **s) - release a reference to the spec
+
+The spec and its auxiliary tables are deallocated with the last reference.
+In either case \e *s is set to NULL.
+
+@param	s	Address of LR_spec pointer
+@return	0	if successful, non-zero if an error
+*/
+int LR_spec_rm(LR_spec **s) {
+	if (!s || !*s)
+		return LRerr_Unspecified;
+	if (!__atomic_sub_fetch(&((*s)->refs), 1, __ATOMIC_ACQ_REL)) {
+		(void) LR_rm(&((*s)->o));
+		free((void *) *s);
+	}
+	*s = (LR_spec *) NULL;
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_stream_new(LR_spec *s) - create a new stream object for the spec
+
+The stream starts with a copy of the spec's attributes and generator
+state (but with zeroed `LR_counters`) and fast math mode, so each stream
+should be given its own seed.
+It shares the spec's auxiliary tables and holds a reference to the spec
+until removed with \c LR_rm().
+
+@param	s	LR_spec pointer
+@return	LR_obj *, or NULL if failed
+*/
+LR_obj *LR_stream_new(LR_spec *s) {
+	LR_obj *ptr = (void *) NULL;
+
+	if (!s)
+		return ptr;
+	if (posix_memalign((void **) &ptr, LR_CACHELINE, sizeof(LR_obj)))
+		return (LR_obj *) NULL;
+	(void) memcpy(ptr, s->o, sizeof(LR_obj));
+	ptr->errno = 0;
+	ptr->flags = s->o->flags & LR_OBJ_FAST;
+	LR_counters_reset(ptr);
+	ptr->spec = LR_spec_ref(s);
+	return ptr;
+}
+
+#ifdef __cplusplus
+}
+#endif
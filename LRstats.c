@@ -0,0 +1,353 @@
+/*!
+\file	LRstats.c
+\brief	Streaming sample moments - mean, variance, skewness, and kurtosis
+
+The `LR_stats` object accumulates the sample moments of a stream of
+values one at a time (or an array at a time) without storing them,
+so the statistics of any number of samples can be found in one pass
+and with little memory.
+
+The central moment sums are updated with the numerically stable online
+formulas of Welford (1962) extended to the third and fourth moments
+by Terriberry (2007):
+\f{eqnarray*}{
+	n &\gets& n + 1, \quad
+	\delta = x - \bar{x}, \quad
+	\delta_n = \delta / n		\\
+	\bar{x} &\gets& \bar{x} + \delta_n	\\
+	M_4 &\gets& M_4 + \delta \delta_n^3 (n-1)(n^2 - 3n + 3)
+		+ 6 \delta_n^2 M_2 - 4 \delta_n M_3	\\
+	M_3 &\gets& M_3 + \delta \delta_n^2 (n-1)(n-2) - 3 \delta_n M_2 \\
+	M_2 &\gets& M_2 + \delta \delta_n (n-1)
+\f}
+where \f$ M_k = \sum (x_i - \bar{x})^k \f$ .
+
+Partial results (e.g. one per thread) are combined with
+\c LR_stats_merge() using the pairwise formulas of Chan, Golub, and
+LeVeque (1979), which \c LR_stats_add_n() also uses to add each chunk of
+an array after finding its moments with a simple loop.
+
+\code
+#include <stdio.h>
+#include "libran.h"
+...
+LR_stats *s = LR_stats_new();
+...
+for (long i = 0; i < 10000000000l; i++) {
+	LR_stats_add(s, LRd_RAN(o));
+}
+...
+printf("mean = %f +/- %f\n", LR_stats_mean(s), LR_stats_sem(s));
+printf("variance = %f skewness = %f kurtosis = %f\n",
+	LR_stats_var(s), LR_stats_skew(s), LR_stats_kurt(s));
+printf("min = %f max = %f\n", s->min, s->max);
+...
+LR_stats_rm(&s);
+\endcode
+
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>	/* malloc,free */
+#include <math.h>	/* isnan(),sqrt() */
+#include "libran.h"
+
+/* number of values to find the moments of at a time */
+#define LR_STATS_CHUNK	256
+/* number of independent partial sums */
+#define LR_STATS_NSUM	4
+
+/*!
+@brief	LR_stats_new() - create new streaming moments object
+
+@return	LR_stats object if successful, else NULL
+*/
+LR_stats *LR_stats_new(void) {
+	LR_stats *ptr = (void *) NULL;
+
+	if (!(ptr = (LR_stats *) malloc(sizeof(LR_stats))))
+		return ptr;
+	(void) LR_stats_reset(ptr);
+	return ptr;
+}
+
+/*!
+@brief	LR_stats_rm(LR_stats **s) - remove streaming moments object
+
+@param	s	LR_stats object address
+@return	0 if successful, else non-zero if failed
+*/
+int LR_stats_rm(LR_stats **s) {
+	if (s && *s) {
+		free((void *) *s);
+		*s = (LR_stats *) NULL;
+		return LRerr_OK;
+	}
+	return LRerr_Unspecified;
+}
+
+/*!
+@brief	LR_stats_reset(LR_stats *s) - clear the moments
+
+This can also be used to initialize an `LR_stats` object not
+created with \c LR_stats_new() (e.g. on the stack).
+
+@param	s	LR_stats object
+@return	0 if successful, else non-zero if failed
+*/
+int LR_stats_reset(LR_stats *s) {
+	if (!s)
+		return LRerr_Unspecified;
+	s->n = 0;
+	s->mean = s->m2 = s->m3 = s->m4 = 0.0;
+	s->min = INFINITY;
+	s->max = -INFINITY;
+	s->errno = 0;
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_stats_add(LR_stats *s, double x) - add a value
+
+@param	s	LR_stats object
+@param	x	value
+@return	0 if successful, else non-zero if failed
+*/
+int LR_stats_add(LR_stats *s, double x) {
+	double	one = 1.0, two = 2.0, three = 3.0, four = 4.0, six = 6.0,
+		n, n1, d, dn, dn2, t;
+
+	if (isnan(x))
+		return s->errno = LRerr_InvalidInputValue;
+
+	n1 = (double) s->n;
+	n = n1 + one;
+	d = x - s->mean;
+	dn = d / n;
+	dn2 = dn * dn;
+	t = d * dn * n1;
+	s->mean += dn;
+	s->m4 += t * dn2 * (n * n - three * n + three)
+		+ six * dn2 * s->m2 - four * dn * s->m3;
+	s->m3 += t * dn * (n - two) - three * dn * s->m2;
+	s->m2 += t;
+	s->min = (x < s->min ? x : s->min);
+	s->max = (x > s->max ? x : s->max);
+	s->n++;
+
+	return LRerr_OK;
+}
+
+/* combine the moments b into a (Chan et al.) */
+static void LR_stats_comb(LR_stats *a, const LR_stats *b) {
+	double	three = 3.0, four = 4.0, six = 6.0,
+		na, nb, n, d, dn, m2, m3;
+
+	if (!b->n)
+		return;
+	if (!a->n) {
+		a->n = b->n;
+		a->mean = b->mean;
+		a->m2 = b->m2;
+		a->m3 = b->m3;
+		a->m4 = b->m4;
+		a->min = b->min;
+		a->max = b->max;
+		return;
+	}
+	na = (double) a->n;
+	nb = (double) b->n;
+	n = na + nb;
+	d = b->mean - a->mean;
+	dn = d / n;
+	m2 = a->m2 + b->m2 + d * dn * na * nb;
+	m3 = a->m3 + b->m3 + d * dn * dn * na * nb * (na - nb)
+		+ three * dn * (na * b->m2 - nb * a->m2);
+	a->m4 += b->m4
+		+ d * dn * dn * dn * na * nb * (na * na - na * nb + nb * nb)
+		+ six * dn * dn * (na * na * b->m2 + nb * nb * a->m2)
+		+ four * dn * (na * b->m3 - nb * a->m3);
+	a->m3 = m3;
+	a->m2 = m2;
+	a->mean += dn * nb;
+	a->min = (b->min < a->min ? b->min : a->min);
+	a->max = (b->max > a->max ? b->max : a->max);
+	a->n += b->n;
+}
+
+/*!
+@brief	LR_stats_add_n(LR_stats *s, const double *x, size_t n) - add
+an array of values
+
+This is the batch version of \c LR_stats_add() giving the same results
+to within roundoff.  The moments of each chunk of values are found
+directly with simple loops (the mean first, then the central sums
+with several independent partial sums so the loops can be vectorized)
+and then combined.
+NaN values are not added and raise an error, but the remaining
+values are still added.
+
+@param	s	LR_stats object
+@param	x	array of values
+@param	n	number of values
+@return	0 if successful, else non-zero if failed
+*/
+int LR_stats_add_n(LR_stats *s, const double *x, size_t n) {
+	double	zero = 0.0, sum[LR_STATS_NSUM], s2[LR_STATS_NSUM],
+		s3[LR_STATS_NSUM], s4[LR_STATS_NSUM], lo, hi, m;
+	LR_stats c;
+	size_t	k, j, l, nc;
+	int	ret = LRerr_OK;
+
+	for (k = 0; k < n; k += nc) {
+		nc = (n - k < LR_STATS_CHUNK ? n - k : LR_STATS_CHUNK);
+		if (nc < LR_STATS_NSUM) {
+			for (j = 0; j < nc; j++)
+				if (LR_stats_add(s, x[k + j]))
+					ret = s->errno;
+			continue;
+		}
+		/* the sum, min, and max */
+		lo = hi = x[k];
+		for (l = 0; l < LR_STATS_NSUM; l++)
+			sum[l] = zero;
+		for (j = 0; j + LR_STATS_NSUM <= nc; j += LR_STATS_NSUM) {
+			for (l = 0; l < LR_STATS_NSUM; l++) {
+				double y = x[k + j + l];
+				sum[l] += y;
+				lo = (y < lo ? y : lo);
+				hi = (y > hi ? y : hi);
+			}
+		}
+		for (; j < nc; j++) {
+			sum[0] += x[k + j];
+			lo = (x[k + j] < lo ? x[k + j] : lo);
+			hi = (x[k + j] > hi ? x[k + j] : hi);
+		}
+		m = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+		if (isnan(m) || isinf(m)) {
+			/* a NaN (or overflow) - one at a time for this chunk */
+			for (j = 0; j < nc; j++)
+				if (LR_stats_add(s, x[k + j]))
+					ret = s->errno;
+			continue;
+		}
+		m /= (double) nc;
+		/* the central sums */
+		for (l = 0; l < LR_STATS_NSUM; l++)
+			s2[l] = s3[l] = s4[l] = zero;
+		for (j = 0; j + LR_STATS_NSUM <= nc; j += LR_STATS_NSUM) {
+			for (l = 0; l < LR_STATS_NSUM; l++) {
+				double d = x[k + j + l] - m, d2 = d * d;
+				s2[l] += d2;
+				s3[l] += d2 * d;
+				s4[l] += d2 * d2;
+			}
+		}
+		for (; j < nc; j++) {
+			double d = x[k + j] - m, d2 = d * d;
+			s2[0] += d2;
+			s3[0] += d2 * d;
+			s4[0] += d2 * d2;
+		}
+		c.n = (long) nc;
+		c.min = lo;
+		c.max = hi;
+		c.m2 = (s2[0] + s2[1]) + (s2[2] + s2[3]);
+		c.m3 = (s3[0] + s3[1]) + (s3[2] + s3[3]);
+		c.m4 = (s4[0] + s4[1]) + (s4[2] + s4[3]);
+		c.mean = m;
+		LR_stats_comb(s, &c);
+	}
+	if (ret)
+		s->errno = ret;
+	return ret;
+}
+
+/*!
+@brief	LR_stats_merge(LR_stats *dst, const LR_stats *src) - add the
+moments of one object to another
+
+The result is the same (to within roundoff) as if all the values had been
+added to \e dst .
+
+@param	dst	LR_stats object to add to
+@param	src	LR_stats object to add
+@return	0 if successful, else non-zero if failed
+*/
+int LR_stats_merge(LR_stats *dst, const LR_stats *src) {
+	if (!dst || !src)
+		return LRerr_Unspecified;
+	LR_stats_comb(dst, src);
+	return LRerr_OK;
+}
+
+/*!
+@brief	LR_stats_mean(const LR_stats *s) - the sample mean
+
+@param	s	LR_stats object
+@return	mean, or NAN if no values
+*/
+double LR_stats_mean(const LR_stats *s) {
+	return (s->n ? s->mean : NAN);
+}
+
+/*!
+@brief	LR_stats_var(const LR_stats *s) - the (unbiased) sample variance
+\f$ M_2/(n-1) \f$
+
+@param	s	LR_stats object
+@return	variance, or NAN if fewer than two values
+*/
+double LR_stats_var(const LR_stats *s) {
+	return (s->n > 1 ? s->m2 / (double) (s->n - 1) : NAN);
+}
+
+/*!
+@brief	LR_stats_sem(const LR_stats *s) - the standard error of the mean
+\f$ \sqrt{s^2/n} \f$
+
+@param	s	LR_stats object
+@return	standard error, or NAN if fewer than two values
+*/
+double LR_stats_sem(const LR_stats *s) {
+	return (s->n > 1 ? sqrt(LR_stats_var(s) / (double) s->n) : NAN);
+}
+
+/*!
+@brief	LR_stats_skew(const LR_stats *s) - the sample skewness
+\f$ g_1 = \sqrt{n} M_3 / M_2^{3/2} \f$
+
+@param	s	LR_stats object
+@return	skewness, or NAN if undefined
+*/
+double LR_stats_skew(const LR_stats *s) {
+	double	zero = 0.0;
+	if (s->n < 2 || s->m2 == zero)
+		return NAN;
+	return sqrt((double) s->n) * s->m3 / (s->m2 * sqrt(s->m2));
+}
+
+/*!
+@brief	LR_stats_kurt(const LR_stats *s) - the sample excess kurtosis
+\f$ g_2 = n M_4 / M_2^2 - 3 \f$
+
+@param	s	LR_stats object
+@return	excess kurtosis, or NAN if undefined
+*/
+double LR_stats_kurt(const LR_stats *s) {
+	double	zero = 0.0, three = 3.0;
+	if (s->n < 2 || s->m2 == zero)
+		return NAN;
+	return (double) s->n * s->m4 / (s->m2 * s->m2) - three;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -146,12 +146,19 @@ extern "C" {
 #endif
 
 #include "libran.h"
+#include "urand/config.h"	/* LR_DEPS, LR_DSQEPS, ... */
 #include <math.h>
 
 #define Abs(a) (((a)<0)?-(a):(a))
 #define Signabs(a,b) ((b)<0?-(a):(a))
 #define Sign(a,b) ((b)<0?-Abs(a):Abs(a))
 
+/* evaluate the user CDF, counting the callback (see LR_COUNT) */
+#define LRd_ucdf(o,x) (LR_COUNT(o, callbacks, 1), \
+	((LR_uinvcdf *) (o)->aux)->dcdf(x))
+#define LRf_ucdf(o,x) (LR_COUNT(o, callbacks, 1), \
+	((LR_uinvcdf *) (o)->aux)->fcdf(x))
+
 /*!
 \brief	LRd_uinvcdf() - set the user defined CDF for this variate distribution
 
@@ -189,6 +196,7 @@ specialized to CDF()s
  *
  * by R.K.Owen,Ph.D.  1994/04/18
 
+@param	o	LR_obj object (for its counters)
 @param	ax	left  endpoint of the initial interval
 @param	bx	right endpoint of the initial interval
 @param	U	Uniform random variate of where to find x such that f(x) = U
@@ -198,25 +206,20 @@ specialized to CDF()s
 		  final result ( must be >= 0.) (Always set to zero here.)
 @return	double 	the value x such that UserCDF(x) - U = 0
  */
-double LRd_zeroin(
+double LRd_zeroin(LR_obj *o,
 	double ax, double bx,
 	double U, double (*f)(double), double tol) {
 
 	const double zero = 0.0, one = 1.0, two = 2.0, three = 3.0,
 		half = 0.5;
-	static double eps;
-	static char FIRST = (0 == 0);
+	const double eps = LR_DEPS;
 	double a,b,c,e,d,fa,fb,fc,tol1,xm,p,q,r,s,tmp1,tmp2;
 
-	if (FIRST) {
-		eps = LR_dgetval("LR_DEPS");
-		FIRST = !FIRST;
-	}
 /* initialization */
 	a = ax;
 	b = bx;
-	fa = (*f)(a) - U;
-	fb = (*f)(b) - U;
+	fa = (LR_COUNT(o, callbacks, 1), (*f)(a)) - U;
+	fb = (LR_COUNT(o, callbacks, 1), (*f)(b)) - U;
 /* begin step */
 	c = a;
 	fc = fa;
@@ -274,11 +277,12 @@ double LRd_zeroin(
 			}
 		}
 /* complete step */
+		LR_COUNT(o, iterations, 1);
 		a = b;
 		fa = fb;
 		if (Abs(d) > tol1) b += d;
 		else b += Signabs(tol1,xm);
-		fb = (*f)(b) - U;
+		fb = (LR_COUNT(o, callbacks, 1), (*f)(b)) - U;
 
 		if ((fb*Signabs(one,fc)) > zero) {
 /* begin step again */
@@ -298,7 +302,23 @@ of the UserCDF() fn.
 @return	double
 */
 double LRd_uinvcdf_RAN(LR_obj *o) {
-	double	u, ax,bx, fax, fbx;
+	return LRd_uinvcdf_QUANT(o, o->ud(o));
+}
+
+/*!
+@brief LRd_uinvcdf_QUANT(LR_obj *o, double u) - double quantile (inverse
+cumulative distribution function) of the UserCDF() fn.
+
+The root of CDF(x) = u is bracketed by \e a and \e b , or else by
+stepping out from \e m in multiples of \e s , and found by
+\c LRd_zeroin().
+
+@param	o	LR_obj object
+@param	u	probability in [0,1]
+@return	double x where the CDF is u
+*/
+double LRd_uinvcdf_QUANT(LR_obj *o, double u) {
+	double	ax,bx, fax, fbx;
 	double	zero = 0.0, one = 1.0, two = 2.0;
 	if (!o->aux) {
 		o->errno = LRerr_NoAuxiliaryObject;
@@ -309,40 +329,43 @@ double LRd_uinvcdf_RAN(LR_obj *o) {
 		return NAN;
 	}
 
-	u = o->ud(o);
 	if (!isnan(o->a.d)) {
 		ax = o->a.d;
+	} else if (u <= zero) {
+		return -INFINITY;
 	} else {
 		double scale = one;
 		ax = o->m.d;
-		fax = ((LR_uinvcdf *) o->aux)->dcdf(ax);
+		fax = LRd_ucdf(o, ax);
 		if (fax < zero) {
 			o->errno = LRerr_InvalidCDF;
 			return NAN;
 		}
 		while (fax > u) {
 			ax = o->m.d - scale*o->s.d;
-			fax = ((LR_uinvcdf *) o->aux)->dcdf(ax);
+			fax = LRd_ucdf(o, ax);
 			scale *= two;
 		}
 	}
 	if (!isnan(o->b.d)) {
 		bx = o->b.d;
+	} else if (u >= one) {
+		return INFINITY;
 	} else {
 		double scale = one;
 		bx = o->m.d;
-		fbx = ((LR_uinvcdf *) o->aux)->dcdf(bx);
+		fbx = LRd_ucdf(o, bx);
 		if (fbx > one) {
 			o->errno = LRerr_InvalidCDF;
 			return NAN;
 		}
 		while (fbx < u) {
 			bx = o->m.d + scale*o->s.d;
-			fbx = ((LR_uinvcdf *) o->aux)->dcdf(bx);
+			fbx = LRd_ucdf(o, bx);
 			scale *= two;
 		}
 	}
-	return LRd_zeroin(ax, bx, u, ((LR_uinvcdf *) o->aux)->dcdf, zero);
+	return LRd_zeroin(o, ax, bx, u, ((LR_uinvcdf *) o->aux)->dcdf, zero);
 }
 
 /*!
@@ -358,7 +381,7 @@ CDF.
 @return	double PDF at x
 */
 double LRd_uinvcdf_PDF(LR_obj *o, double x) {
-	static double sqeps = NAN, isqeps, nearzero;
+	const double sqeps = LR_DSQEPS, nearzero = sqeps*sqrt(sqeps);
 	double	half = 0.5, zero = 0.0, one = 1.0, xp, xm, fp, fm, f0, ret;
 	LR_uinvcdf *aux = (LR_uinvcdf *) o->aux;
 
@@ -371,12 +394,6 @@ double LRd_uinvcdf_PDF(LR_obj *o, double x) {
 		return NAN;
 	}
 
-	if (isnan(sqeps)) {
-		sqeps = LR_dgetval("LR_DSQEPS");
-		isqeps = one/sqeps;
-		nearzero = sqeps*sqrt(sqeps);
-	}
-	
 	/* use three values around x */
 	if (-nearzero < x && x < nearzero) {
 		xp = sqeps;
@@ -385,14 +402,14 @@ double LRd_uinvcdf_PDF(LR_obj *o, double x) {
 		xp = x*(one + sqeps);
 		xm = x*(one - sqeps);
 	}
-	fm = aux->dcdf(xm);
-	fp = aux->dcdf(xp);
+	fm = LRd_ucdf(o, xm);
+	fp = LRd_ucdf(o, xp);
 	
 	if (fp == one) {
-		f0 = aux->dcdf(x);
+		f0 = LRd_ucdf(o, x);
 		ret = (f0-fm)/(x-xm);
 	} else if (fm == zero) {
-		f0 = aux->dcdf(x);
+		f0 = LRd_ucdf(o, x);
 		ret = (fp-f0)/(xp-x);
 	} else {
 		ret = (fp-fm)/(xp-xm);
@@ -425,7 +442,7 @@ double LRd_uinvcdf_CDF(LR_obj *o, double x) {
 		return NAN;
 	}
 
-	ret = aux->dcdf(x);
+	ret = LRd_ucdf(o, x);
 
 	if (ret < zero || ret > one) {
 		o->errno = LRerr_InvalidCDF;
@@ -471,6 +488,7 @@ specialized to CDF()s
  *
  * by R.K.Owen,Ph.D.  1994/04/18
 
+@param	o	LR_obj object (for its counters)
 @param	ax	left  endpoint of the initial interval
 @param	bx	right endpoint of the initial interval
 @param	U	Uniform random variate of where to find x such that f(x) = U
@@ -480,25 +498,20 @@ specialized to CDF()s
 		  final result ( must be >= 0.) (Always set to zero here.)
 @return	float 	the value x such that UserCDF(x) - U = 0
  */
-float LRf_zeroin(
+float LRf_zeroin(LR_obj *o,
 	float ax, float bx,
 	float U, float (*f)(float), float tol) {
 
 	const float zero = 0.0, one = 1.0, two = 2.0, three = 3.0,
 		half = 0.5;
-	static float eps;
-	static char FIRST = (0 == 0);
+	const float eps = LR_FEPS;
 	float a,b,c,e,d,fa,fb,fc,tol1,xm,p,q,r,s,tmp1,tmp2;
 
-	if (FIRST) {
-		eps = LR_fgetval("LR_FEPS");
-		FIRST = !FIRST;
-	}
 /* initialization */
 	a = ax;
 	b = bx;
-	fa = (*f)(a) - U;
-	fb = (*f)(b) - U;
+	fa = (LR_COUNT(o, callbacks, 1), (*f)(a)) - U;
+	fb = (LR_COUNT(o, callbacks, 1), (*f)(b)) - U;
 /* begin step */
 	c = a;
 	fc = fa;
@@ -556,11 +569,12 @@ float LRf_zeroin(
 			}
 		}
 /* complete step */
+		LR_COUNT(o, iterations, 1);
 		a = b;
 		fa = fb;
 		if (Abs(d) > tol1) b += d;
 		else b += Signabs(tol1,xm);
-		fb = (*f)(b) - U;
+		fb = (LR_COUNT(o, callbacks, 1), (*f)(b)) - U;
 
 		if ((fb*Signabs(one,fc)) > zero) {
 /* begin step again */
@@ -580,7 +594,23 @@ of the UserCDF() fn.
 @return	float
 */
 float LRf_uinvcdf_RAN(LR_obj *o) {
-	float	u, ax,bx, fax, fbx;
+	return LRf_uinvcdf_QUANT(o, o->uf(o));
+}
+
+/*!
+@brief LRf_uinvcdf_QUANT(LR_obj *o, float u) - float quantile (inverse
+cumulative distribution function) of the UserCDF() fn.
+
+The root of CDF(x) = u is bracketed by \e a and \e b , or else by
+stepping out from \e m in multiples of \e s , and found by
+\c LRf_zeroin().
+
+@param	o	LR_obj object
+@param	u	probability in [0,1]
+@return	float x where the CDF is u
+*/
+float LRf_uinvcdf_QUANT(LR_obj *o, float u) {
+	float	ax,bx, fax, fbx;
 	float	zero = 0.0, one = 1.0, two = 2.0;
 	if (!o->aux) {
 		o->errno = LRerr_NoAuxiliaryObject;
@@ -591,40 +621,43 @@ float LRf_uinvcdf_RAN(LR_obj *o) {
 		return NAN;
 	}
 
-	u = o->ud(o);
 	if (!isnan(o->a.f)) {
 		ax = o->a.f;
+	} else if (u <= zero) {
+		return -INFINITY;
 	} else {
 		float scale = one;
 		ax = o->m.f;
-		fax = ((LR_uinvcdf *) o->aux)->fcdf(ax);
+		fax = LRf_ucdf(o, ax);
 		if (fax < zero) {
 			o->errno = LRerr_InvalidCDF;
 			return NAN;
 		}
 		while (fax > u) {
 			ax = o->m.f - scale*o->s.f;
-			fax = ((LR_uinvcdf *) o->aux)->fcdf(ax);
+			fax = LRf_ucdf(o, ax);
 			scale *= two;
 		}
 	}
 	if (!isnan(o->b.f)) {
 		bx = o->b.f;
+	} else if (u >= one) {
+		return INFINITY;
 	} else {
 		float scale = one;
 		bx = o->m.f;
-		fbx = ((LR_uinvcdf *) o->aux)->fcdf(bx);
+		fbx = LRf_ucdf(o, bx);
 		if (fbx > one) {
 			o->errno = LRerr_InvalidCDF;
 			return NAN;
 		}
 		while (fbx < u) {
 			bx = o->m.f + scale*o->s.f;
-			fbx = ((LR_uinvcdf *) o->aux)->fcdf(bx);
+			fbx = LRf_ucdf(o, bx);
 			scale *= two;
 		}
 	}
-	return LRf_zeroin(ax, bx, u, ((LR_uinvcdf *) o->aux)->fcdf, zero);
+	return LRf_zeroin(o, ax, bx, u, ((LR_uinvcdf *) o->aux)->fcdf, zero);
 }
 
 /*!
@@ -640,7 +673,7 @@ CDF.
 @return	float PDF at x
 */
 float LRf_uinvcdf_PDF(LR_obj *o, float x) {
-	static float sqeps = NAN, isqeps, nearzero;
+	const float sqeps = LR_FSQEPS, nearzero = sqeps*sqrtf(sqeps);
 	float	half = 0.5, zero = 0.0, one = 1.0, xp, xm, fp, fm, f0, ret;
 	LR_uinvcdf *aux = (LR_uinvcdf *) o->aux;
 
@@ -653,12 +686,6 @@ float LRf_uinvcdf_PDF(LR_obj *o, float x) {
 		return NAN;
 	}
 
-	if (isnan(sqeps)) {
-		sqeps = LR_fgetval("LR_FSQEPS");
-		isqeps = one/sqeps;
-		nearzero = sqeps*sqrtf(sqeps);
-	}
-	
 	/* use three values around x */
 	if (-nearzero < x && x < nearzero) {
 		xp = sqeps;
@@ -667,14 +694,14 @@ float LRf_uinvcdf_PDF(LR_obj *o, float x) {
 		xp = x*(one + sqeps);
 		xm = x*(one - sqeps);
 	}
-	fm = aux->fcdf(xm);
-	fp = aux->fcdf(xp);
+	fm = LRf_ucdf(o, xm);
+	fp = LRf_ucdf(o, xp);
 	
 	if (fp == one) {
-		f0 = aux->fcdf(x);
+		f0 = LRf_ucdf(o, x);
 		ret = (f0-fm)/(x-xm);
 	} else if (fm == zero) {
-		f0 = aux->fcdf(x);
+		f0 = LRf_ucdf(o, x);
 		ret = (fp-f0)/(xp-x);
 	} else {
 		ret = (fp-fm)/(xp-xm);
@@ -707,7 +734,7 @@ float LRf_uinvcdf_CDF(LR_obj *o, float x) {
 		return NAN;
 	}
 
-	ret = aux->fcdf(x);
+	ret = LRf_ucdf(o, x);
 
 	if (ret < zero || ret > one) {
 		o->errno = LRerr_InvalidCDF;
@@ -45,6 +45,7 @@ extern "C" {
 #endif
 
 #include "libran.h"
+#include "LRkern.h"
 
 /*!
 @brief	LRd_unif_RAN(LR_obj *o) - double random uniform distribution
@@ -53,10 +54,22 @@ extern "C" {
 @return double
 */
 double LRd_unif_RAN(LR_obj *o) {
-	double x, diff = (o->b.d - o->a.d); 
-	x = o->ud(o);
+	return o->rc[0].d + o->ud(o) * o->rc[1].d;
+}
+
+/*!
+@brief	LRd_unif_RAN_n(LR_obj *o, double *x, long n) - a batch of double random
+uniform variates (see \c LRd_RAN_n() )
 
-	return o->a.d + x * diff;
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRd_unif_RAN_n(LR_obj *o, double *x, long n) {
+	(void) LR_drand_n(o, x, n);
+	LR_kern_get()->dunif(x, n, o->rc[0].d, o->rc[1].d);
+	return LRerr_OK;
 }
 
 /*!
@@ -67,12 +80,10 @@ double LRd_unif_RAN(LR_obj *o) {
 @return double PDF at x
 */
 double LRd_unif_PDF(LR_obj *o, double x) {
-	double diff = (o->b.d - o->a.d); 
-
 	if (x < o->a.d || x >= o->b.d) {
 		return 0.0;
 	} else {
-		return 1.0 / diff;
+		return o->dc[1].d;
 	}
 }
 
@@ -84,17 +95,27 @@ double LRd_unif_PDF(LR_obj *o, double x) {
 @return double CDF at x
 */
 double LRd_unif_CDF(LR_obj *o, double x) {
-	double diff = (o->b.d - o->a.d); 
-
 	if (x < o->a.d) {
 		return 0.0;
 	} else if (x >= o->b.d) {
 		return 1.0;
 	} else {
-		return (x - o->a.d) / diff;
+		return (x - o->a.d) * o->dc[1].d;
 	}
 }
 
+/*!
+@brief	LRd_unif_QUANT(LR_obj *o, double u) - double uniform quantile
+(inverse cumulative distribution function)
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return double x where the CDF is u
+*/
+double LRd_unif_QUANT(LR_obj *o, double u) {
+	return o->rc[0].d + u * o->rc[1].d;
+}
+
 /*!
 @brief	LRf_unif_RAN(LR_obj *o) - float random uniform distribution
 
@@ -102,10 +123,22 @@ double LRd_unif_CDF(LR_obj *o, double x) {
 @return float
 */
 float LRf_unif_RAN(LR_obj *o) {
-	float x, diff = (o->b.f - o->a.f); 
-	x = o->uf(o);
+	return o->rc[0].f + o->uf(o) * o->rc[1].f;
+}
+
+/*!
+@brief	LRf_unif_RAN_n(LR_obj *o, float *x, long n) - a batch of float random
+uniform variates (see \c LRf_RAN_n() )
 
-	return o->a.f + x * diff;
+@param o	LR_obj object
+@param x	array of n values
+@param n	number of variates
+@return 0
+*/
+int LRf_unif_RAN_n(LR_obj *o, float *x, long n) {
+	(void) LR_frand_n(o, x, n);
+	LR_kern_get()->funif(x, n, o->rc[0].f, o->rc[1].f);
+	return LRerr_OK;
 }
 
 /*!
@@ -116,12 +149,10 @@ float LRf_unif_RAN(LR_obj *o) {
 @return float PDF at x
 */
 float LRf_unif_PDF(LR_obj *o, float x) {
-	float diff = (o->b.f - o->a.f); 
-
 	if (x < o->a.f || x >= o->b.f) {
 		return 0.0;
 	} else {
-		return 1.0 / diff;
+		return o->dc[1].f;
 	}
 }
 
@@ -133,17 +164,27 @@ float LRf_unif_PDF(LR_obj *o, float x) {
 @return float CDF at x
 */
 float LRf_unif_CDF(LR_obj *o, float x) {
-	float diff = (o->b.f - o->a.f); 
-
 	if (x < o->a.f) {
 		return 0.0;
 	} else if (x >= o->b.f) {
 		return 1.0;
 	} else {
-		return (x - o->a.f) / diff;
+		return (x - o->a.f) * o->dc[1].f;
 	}
 }
 
+/*!
+@brief	LRf_unif_QUANT(LR_obj *o, float u) - float uniform quantile
+(inverse cumulative distribution function)
+
+@param o	LR_obj object
+@param u	probability in [0,1]
+@return float x where the CDF is u
+*/
+float LRf_unif_QUANT(LR_obj *o, float u) {
+	return o->rc[0].f + u * o->rc[1].f;
+}
+
 #ifdef __cplusplus
 }
 #endif
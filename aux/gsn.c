@@ -80,19 +80,30 @@ to prevent inaccuracies and overflows when evaluating a large polynomial.
 
 Finally the coefficients pairs are output into a format such the text
 could be included into C code with minimal editing.
-This was how the coefficients were generated for `LRgsn.c`.
-
-The invoking
-functions must initialize the floating point coefficients by calculating
-the ratio of coefficient pairs.  This only needs to be done once if
-the floating point values are stored in an array.
+This was how the coefficients were first generated for `LRgsn.c`.
+
+With \e -t it writes `LRgsntab.h`, the tables for every order
+up to \c GSN_TMAX (see \c writetab()), which `LRgsn.c` includes,
+so no tables need to be set up at run time.  The tables are kept in
+the tree (so cross builds need not run this), \c make \c gsntab
+regenerates them.  The rationals overflow a
+\e long beyond 12, so these are computed directly on each local interval
+as exact integers over \f$ n! \f$ with 128 bit integers and each
+quotient is rounded just once, to double and to float (see \c wdiv()).
+
+\code
+gsn [-n order]		show the rationals for order (default 12)
+gsn -t nmax > LRgsntab.h	write the tables for orders 1 to nmax
+\endcode
 
 \see{LRgsn.c}
 
 */
 
 #include <stdio.h>
+#include <stdlib.h>	/* atoi */
 #include <limits.h>
+#include <unistd.h>	/* getopt */
 
 #define	NINT	15
 
@@ -344,8 +355,7 @@ for the new Gaussian-like culmulative distributions functions of order n
 @param int nn	order of gsn.
 */
 void newcdf(int nn) {
-	extern LINT	pn[NINT][NINT], pd[NINT][NINT],
-			cn[NINT][NINT], cd[NINT][NINT];
+	extern LINT	cn[NINT][NINT], cd[NINT][NINT];
 
 	LINT ss = 1;
 	for (int i = 0; i <= nn; i++) {
@@ -489,8 +499,301 @@ void transint(int nn, LINT xn[][NINT], LINT xd[][NINT]) {
 	}
 }
 
-int main() {
-	int nn = 12;
+/*!
+\def	GSN_TMAX
+\brief	the largest order the tables are written for
+*/
+#define	GSN_TMAX	24
+
+/*!
+\typedef	WINT
+\brief		a 128 bit two's complement integer as 32 bit limbs, least
+significant first.  Intermediate sums may wrap around, but the numerators
+of the tables (\f$ n! \f$ times the coefficients) fit.
+*/
+typedef	struct { unsigned long long l[4]; } WINT;
+
+#define	WMASK	0xffffffffULL
+
+/*!
+@brief void wmul(WINT *w, unsigned long long k) w *= k, for k < 2^32
+*/
+void wmul(WINT *w, unsigned long long k) {
+	unsigned long long c = 0;
+	for (int i = 0; i < 4; i++) {
+		c += w->l[i] * k;
+		w->l[i] = c & WMASK;
+		c >>= 32;
+	}
+}
+
+/*!
+@brief void wadd(WINT *a, WINT *b, int neg) a += b, or a -= b if neg
+*/
+void wadd(WINT *a, WINT *b, int neg) {
+	unsigned long long c = (neg ? 1 : 0);	/* -b = ~b + 1 */
+	for (int i = 0; i < 4; i++) {
+		c += a->l[i] + (neg ? ~b->l[i] & WMASK : b->l[i]);
+		a->l[i] = c & WMASK;
+		c >>= 32;
+	}
+}
+
+/*!
+@brief unsigned long long ubinom(int n, int k) binomial factor without
+the factorials (which overflow beyond 20!)
+*/
+unsigned long long ubinom(int n, int k) {
+	unsigned long long r = 1;
+	for (int i = 1; i <= k; i++)
+		r = r * (n - k + i) / i;
+	return r;
+}
+
+/*!
+@brief void wcoef(nn, j, m, WINT *w) n! times the CDF coefficient of x^m
+on the local interval [j,j+1)
+
+\manonly
+   n! c_jm = sum_i=0^j (-1)^i (n i) (n m) (j-i)^(n-m)
+\endmanonly
+\f[
+n!\,c_{jm} = \sum_{i = 0}^{j} (-1)^i
+\left(\begin{array}{c} {n} \\ {i} \end{array}\right)
+\left(\begin{array}{c} {n} \\ {m} \end{array}\right)
+(j - i)^{n-m}
+\f]
+the binomial expansion of \c newcdf() and the translation of
+\c transint() done together.  For \f$ j = n \f$ it is 1 (\f$ m = 0 \f$)
+or 0.
+
+@param int nn	order of gsn.
+@param int j	interval
+@param int m	power
+@param WINT *w	output numerator
+*/
+void wcoef(int nn, int j, int m, WINT *w) {
+	WINT	t;
+
+	*w = (WINT) {{0, 0, 0, 0}};
+	for (int i = 0; i <= j; i++) {
+		t = (WINT) {{1, 0, 0, 0}};
+		wmul(&t, ubinom(nn, i));
+		wmul(&t, ubinom(nn, m));
+		for (int k = 0; k < nn - m; k++)
+			wmul(&t, (unsigned long long) (j - i));
+		wadd(w, &t, i & 1);
+	}
+}
+
+/*!
+\def	WBIG
+\brief	the number of 32 bit limbs for the long division in \c wdiv()
+*/
+#define	WBIG	12
+
+/*!
+@brief int wbits(unsigned long long *a) the number of significant bits
+of the \c WBIG limb integer a
+*/
+int wbits(unsigned long long *a) {
+	for (int i = WBIG - 1; i >= 0; i--)
+		for (int k = 31; k >= 0; k--)
+			if ((a[i] >> k) & 1)
+				return 32*i + k + 1;
+	return 0;
+}
+
+/*!
+@brief int wbit(unsigned long long *a, int k) bit k of a
+*/
+int wbit(unsigned long long *a, int k) {
+	return (k < 0 || k >= 32*WBIG ? 0 : (a[k/32] >> (k%32)) & 1);
+}
+
+/*!
+@brief double wdiv(WINT w, int nn, int p) \f$ w/n! \f$ rounded once to
+p bits (53 for double, 24 for float), to nearest with ties to even
+
+The quotient is found by binary long division to two bits past p, with
+a sticky bit for any remainder, so the result is exactly what one
+correctly rounded division of the rationals would give.  A long double
+(64 bit significand on x86, and possibly just a double) cannot hold the
+numerators above \f$ 2^{64} \f$ and would round them first.
+
+@param WINT w	numerator, \f$ n! \f$ times the coefficient
+@param int nn	order, the denominator is \f$ n! \f$
+@param int p	bits of precision
+@return double	the rounded value (exact in a float if p <= 24)
+*/
+double wdiv(WINT w, int nn, int p) {
+	WINT			z = {{0, 0, 0, 0}}, f = {{1, 0, 0, 0}};
+	unsigned long long	a[WBIG] = {0}, d[WBIG] = {0}, r[WBIG] = {0},
+				q = 0, c;
+	int			neg = (w.l[3] >> 31) & 1, s, e, la, ld, lq, x;
+	double			v;
+
+	if (neg)
+		wadd(&z, &w, 1);
+	else
+		z = w;
+	for (int i = 2; i <= nn; i++)
+		wmul(&f, (unsigned long long) i);
+	for (int i = 0; i < 4; i++) {
+		a[i] = z.l[i];
+		d[i] = f.l[i];
+	}
+	if ((la = wbits(a)) == 0)
+		return 0.0;
+	ld = wbits(d);
+	/* a*2^s/d lies in [2^(p+1), 2^(p+3)) */
+	e = s = p + 2 - (la - ld);
+	/* bitwise restoring division of a*2^s by d (d*2^-s if s < 0) */
+	if (s < 0) {
+		for (int i = 0; i < -s; i++) {	/* d <<= 1 */
+			c = 0;
+			for (int k = 0; k < WBIG; k++) {
+				c |= d[k] << 1;
+				d[k] = c & WMASK;
+				c >>= 32;
+			}
+		}
+		s = 0;
+	}
+	for (int k = la + s - 1; k >= 0; k--) {
+		int ge = 1;
+
+		c = (unsigned long long) wbit(a, k - s);	/* r = 2r + bit */
+		for (int i = 0; i < WBIG; i++) {
+			c |= r[i] << 1;
+			r[i] = c & WMASK;
+			c >>= 32;
+		}
+		for (int i = WBIG - 1; i >= 0; i--) {	/* r >= d ? */
+			if (r[i] != d[i]) {
+				ge = (r[i] > d[i]);
+				break;
+			}
+		}
+		q <<= 1;
+		if (ge) {
+			c = 1;
+			for (int i = 0; i < WBIG; i++) {	/* r -= d */
+				c += r[i] + (~d[i] & WMASK);
+				r[i] = c & WMASK;
+				c >>= 32;
+			}
+			q |= 1;
+		}
+	}
+	/* round q to p bits, ties to even, sticky for the remainder */
+	for (lq = 0; (q >> lq) > 0; lq++)
+		;
+	x = lq - p;
+	{
+		unsigned long long	h = (q >> (x - 1)) & 1,
+					t = (q & ((1ULL << (x - 1)) - 1)) != 0
+						|| wbits(r) != 0;
+
+		q >>= x;
+		if (h && (t || (q & 1)))
+			q++;
+	}
+	/* scale by 2^(x-e), exact in the range of the tables */
+	v = (double) q;
+	for (e = x - e; e > 0; e--)
+		v *= 2.0;
+	for ( ; e < 0; e++)
+		v *= 0.5;
+	return (neg ? -v : v);
+}
+
+/*!
+@brief void writetab(nmax) output the tables for orders 1 to nmax as C
+
+For each order \f$ n \f$ there are \f$ n+1 \f$ intervals (the last is
+\f$ x \ge n \f$, for rounding at the top) of \f$ n+1 \f$ coefficients
+on the local interval \f$ 0 \le x < 1 \f$, lowest power first, at
+\c LR_gsn_off[n] in each table.  The PDF coefficients are
+\f$ (m+1) c_{j,m+1} \f$.  The values are written in hexadecimal so
+they are read back exactly.
+
+@param int nmax	largest order
+*/
+void writetab(int nmax) {
+	WINT		w;
+	double		q;
+	int		off = 0;
+	const char	*tab[4] = {"double LR_gsn_cdfd", "double LR_gsn_pdfd",
+				"float  LR_gsn_cdff", "float  LR_gsn_pdff"};
+
+	printf("/* LRgsntab.h - the gsn coefficient tables for orders 1 to %d\n"
+		" * generated by aux/gsn -t %d (make gsntab, see aux/gsn.c), do not edit */\n\n",
+		nmax, nmax);
+	printf("#if LR_GSN_MAX != %d\n#  error \"LR_GSN_MAX does not match"
+		" the generated tables\"\n#endif\n\n", nmax);
+	printf("static const int LR_gsn_off[%d] = {\n\t0", nmax + 2);
+	for (int nn = 1; nn <= nmax; nn++) {
+		printf(",%s%d", (nn % 8 ? " " : "\n\t"), off);
+		off += (nn + 1) * (nn + 1);
+	}
+	printf(",%s%d\n};\n", ((nmax + 1) % 8 ? " " : "\n\t"), off);
+	for (int t = 0; t < 4; t++) {
+		printf("\nstatic const %s[%d] = {\n", tab[t], off);
+		for (int nn = 1; nn <= nmax; nn++) {
+			printf("/* %d */\n", nn);
+			for (int j = 0; j <= nn; j++) {
+				printf("\t");
+				for (int m = 0; m <= nn; m++) {
+					if (t & 1) {	/* PDF */
+						if (m < nn) {
+							wcoef(nn, j, m + 1, &w);
+							wmul(&w, (unsigned long long) (m + 1));
+						} else {
+							w = (WINT) {{0, 0, 0, 0}};
+						}
+					} else {
+						wcoef(nn, j, m, &w);
+					}
+					q = (j < nn ? wdiv(w, nn, (t < 2 ? 53 : 24))
+						: (m == 0 && !(t & 1) ? 1.0 : 0.0));
+					if (t < 2)
+						printf("%a,", q);
+					else
+						printf("%af,", (float) q);
+					printf("%s", (m < nn ? " " : "\n"));
+				}
+			}
+		}
+		printf("};\n");
+	}
+}
+
+int main(int argc, char **argv) {
+	int nn = 12, c;
+
+	while ((c = getopt(argc, argv, "n:t:")) != -1) {
+		switch (c) {
+		case 'n': nn = atoi(optarg); break;
+		case 't':
+			nn = atoi(optarg);
+			if (nn < 1 || nn > GSN_TMAX) {
+				fprintf(stderr, "%s: order must be 1 to %d\n",
+					argv[0], GSN_TMAX);
+				return 1;
+			}
+			writetab(nn);
+			return 0;
+		default:
+			fprintf(stderr, "usage: %s [-n order] [-t nmax]\n",
+				argv[0]);
+			return 1;
+		}
+	}
+	if (nn < 1 || nn > 12) {
+		fprintf(stderr, "%s: order must be 1 to 12\n", argv[0]);
+		return 1;
+	}
 	newcdf(nn);
 	showdf("CDF",nn, cn, cd);
 	newpdf(nn);
@@ -0,0 +1,455 @@
+/*!
+\file	LRbench.c
+\brief	Throughput benchmarks of the LibRan distributions
+
+Measures, for every `LR_type` and data type combination,
+the time per sample of \c LRd_RAN() (or \c LRf_RAN() , \c LRi_RAN() )
+and the time per evaluation of the PDF and CDF,
+in nanoseconds and (where the time stamp counter can be read) cycles.
+Each is the best of several repetitions to reduce the noise.
+The PDF and CDF are evaluated at samples of the distribution itself.
+
+The multi-thread scaling of the sampling is measured with
+1, 2, 4, ... threads (up to the number of cores), each with its own stream
+of a shared `LR_spec` object, giving the total throughput and the speedup
+over one thread.
+
+The batch sampling of \c LRd_RAN_n() (or \c LRf_RAN_n() ) is timed too,
+noting whether the type has a (vectorized) batch kernel or is sampled
+one at a time, and the scalar and batch paths of the tallying objects
+(`LR_bin`, `LR_ibin`, `LR_stats`, `LR_kll`) are compared.
+
+With \e -f every object is in fast math mode (see \c LR_fast()), so the
+two reports can be compared.  The report notes the instruction set of
+the batch kernels (see \c LR_isa()), which the \c LR_ISA environment
+variable can change.
+
+If LibRan was configured with \c --enable-counters the uniforms,
+rejections, root finder iterations and callbacks per sample
+(see `LR_counters`) are reported too, else they are null.
+
+The results are written as JSON, with the LibRan version and CPU model,
+so versions of the library can be compared on the same hardware,
+and a summary to stdout.
+
+	LRbench [-n evals] [-r reps] [-t threads] [-f] [-o report] [type ...]
+
+\code
+make bench
+make bench BENCH_N=10000000 BENCH_REPORT=v0.2.json
+make bench BENCH_FLAGS=-f BENCH_REPORT=fast.json
+LR_ISA=generic make bench BENCH_REPORT=generic.json
+\endcode
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>	/* getopt,sysconf */
+#include <pthread.h>
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>	/* __rdtsc() */
+#  define HAVE_TSC	1
+#else
+#  define HAVE_TSC	0
+#endif
+#include "libran.h"
+#include "LRharness.h"
+
+#define NX	4096	/* evaluation points */
+
+static long	nevals = 2000000l;
+static int	nreps = 5;
+
+static inline unsigned long long ticks(void) {
+#if HAVE_TSC
+	return __rdtsc();
+#else
+	return 0ull;
+#endif
+}
+
+/* the best of the repetitions, per evaluation */
+typedef struct {
+	double	ns;
+	double	cyc;
+} btime;
+
+/* keep the compiler from discarding the results (main thread only,
+ * the scaling threads keep their own) */
+static volatile double sink;
+
+typedef enum { B_RAN, B_RANN, B_PDF, B_CDF } bwhat;
+
+/* one timed loop - the float or int points follow the double ones,
+ * returns the sum of the results */
+static double bloop(LR_obj *o, bwhat w, const double *x, long n) {
+	double	buf[NX];	/* on the stack, so each thread has its own */
+	double	s = 0.0;
+
+	if (w == B_RANN) {
+		for (long i = 0, m; i < n; i += m) {
+			m = (n - i < NX ? n - i : NX);
+			if (o->d == LR_double)
+				(void) LRd_RAN_n(o, buf, m);
+			else
+				(void) LRf_RAN_n(o, (float *) buf, m);
+			s += buf[0];
+		}
+	} else if (w == B_RAN) {
+		if (o->d == LR_double)
+			for (long i = 0; i < n; i++) s += LRd_RAN(o);
+		else if (o->d == LR_float)
+			for (long i = 0; i < n; i++) s += LRf_RAN(o);
+		else
+			for (long i = 0; i < n; i++) s += LRi_RAN(o);
+	} else if (o->d == LR_double) {
+		if (w == B_PDF)
+			for (long i = 0; i < n; i++) s += LRd_PDF(o, x[i & (NX-1)]);
+		else
+			for (long i = 0; i < n; i++) s += LRd_CDF(o, x[i & (NX-1)]);
+	} else if (o->d == LR_float) {
+		const float *y = (const float *) (x + NX);
+		if (w == B_PDF)
+			for (long i = 0; i < n; i++) s += LRf_PDF(o, y[i & (NX-1)]);
+		else
+			for (long i = 0; i < n; i++) s += LRf_CDF(o, y[i & (NX-1)]);
+	} else {
+		const int *k = (const int *) (x + NX);
+		if (w == B_PDF)
+			for (long i = 0; i < n; i++) s += LRi_PDF(o, k[i & (NX-1)]);
+		else
+			for (long i = 0; i < n; i++) s += LRi_CDF(o, k[i & (NX-1)]);
+	}
+	return s;
+}
+
+static btime bestof(LR_obj *o, bwhat w, const double *x, long n) {
+	btime	b = {INFINITY, INFINITY};
+	double	t;
+	unsigned long long c;
+
+	sink += bloop(o, w, x, n / 10 + 1);	/* warm up */
+	for (int r = 0; r < nreps; r++) {
+		t = now();
+		c = ticks();
+		sink += bloop(o, w, x, n);
+		c = ticks() - c;
+		t = now() - t;
+		b.ns = (1e9 * t / n < b.ns ? 1e9 * t / n : b.ns);
+		b.cyc = ((double) c / n < b.cyc ? (double) c / n : b.cyc);
+	}
+	if (!HAVE_TSC)
+		b.cyc = NAN;
+	return b;
+}
+
+/* thread scaling - each thread's parameters and result in their own
+ * cache line */
+typedef struct {
+	LR_spec	*s;
+	long	n;
+	long	seed;
+	double	sum;
+} LR_ALIGNED bthr;
+
+static void *brun(void *arg) {
+	bthr	*a = (bthr *) arg;
+	LR_obj	*o = LR_stream_new(a->s);
+
+	if (!o)
+		return NULL;
+	LR_lsetseed(o, a->seed);
+	a->sum = bloop(o, B_RAN, NULL, a->n);
+	LR_rm(&o);
+	return NULL;
+}
+
+/* samples per second in all threads */
+static double bthreads(LR_spec *s, int nt, long n) {
+	pthread_t	th[nt];
+	bthr		par[nt];
+	double		t, best = 0.0;
+	int		m;
+
+	for (int r = 0; r < nreps; r++) {
+		t = now();
+		for (m = 0; m < nt; m++) {
+			par[m].s = s;
+			par[m].n = n;
+			par[m].seed = 19580512l + 2l * m;
+			par[m].sum = 0.0;
+			if (pthread_create(&th[m], NULL, brun, &par[m]))
+				break;
+		}
+		for (int i = 0; i < m; i++) {
+			pthread_join(th[i], NULL);
+			sink += par[i].sum;
+		}
+		if (m < nt)
+			return NAN;
+		t = now() - t;
+		best = (nt * n / t > best ? nt * n / t : best);
+	}
+	return best;
+}
+
+/* tallying objects - scalar and batch */
+typedef enum { T_BIN, T_IBIN, T_STATS, T_KLL } btally;
+static const char *tname[] = {"LR_bin", "LR_ibin", "LR_stats", "LR_kll"};
+
+static double btally1(btally w, int batch, const double *x, const int *k,
+	long n) {
+	LR_bin	*b = NULL;
+	LR_ibin	*ib = NULL;
+	LR_stats *st = NULL;
+	LR_kll	*kl = NULL;
+	double	t, best = INFINITY;
+	long	m;
+
+	for (int r = 0; r < nreps; r++) {
+		switch (w) {
+		case T_BIN: b = LR_bin_new_uniform(100, -4., 4.); break;
+		case T_IBIN: ib = LR_ibin_new(0); break;
+		case T_STATS: st = LR_stats_new(); break;
+		case T_KLL: kl = LR_kll_new(0); break;
+		}
+		t = now();
+		for (long i = 0; i < n; i += m) {
+			m = (n - i < NX ? n - i : NX);
+			if (batch) {
+				switch (w) {
+				case T_BIN: LR_bin_add_n(b, x, m); break;
+				case T_IBIN: LR_ibin_add_n(ib, k, m); break;
+				case T_STATS: LR_stats_add_n(st, x, m); break;
+				case T_KLL: LR_kll_add_n(kl, x, m); break;
+				}
+			} else {
+				for (long j = 0; j < m; j++) {
+					switch (w) {
+					case T_BIN: LR_bin_add(b, x[j]); break;
+					case T_IBIN: LR_ibin_add(ib, k[j]); break;
+					case T_STATS: LR_stats_add(st, x[j]); break;
+					case T_KLL: LR_kll_add(kl, x[j]); break;
+					}
+				}
+			}
+		}
+		t = now() - t;
+		best = (1e9 * t / n < best ? 1e9 * t / n : best);
+		LR_bin_rm(&b);
+		LR_ibin_rm(&ib);
+		LR_stats_rm(&st);
+		LR_kll_rm(&kl);
+	}
+	return best;
+}
+
+/* the CPU model from /proc/cpuinfo (if any) */
+static void cpumodel(char *buf, size_t len) {
+	FILE	*fp = fopen("/proc/cpuinfo", "r");
+	char	line[256], *p;
+
+	(void) snprintf(buf, len, "unknown");
+	if (!fp)
+		return;
+	while (fgets(line, sizeof(line), fp)) {
+		if (!strncmp(line, "model name", 10) && (p = strchr(line, ':'))) {
+			for (p++; *p == ' '; p++);
+			p[strcspn(p, "\n")] = '\0';
+			/* no quotes or backslashes in the JSON */
+			for (char *q = p; *q; q++)
+				*q = (*q == '"' || *q == '\\' ? ' ' : *q);
+			(void) snprintf(buf, len, "%s", p);
+			break;
+		}
+	}
+	fclose(fp);
+}
+
+static void usage(const char *prog) {
+	fprintf(stderr, "usage: %s [-n evals] [-r reps] [-t threads] "
+		"[-f] [-o report] [type ...]\n", prog);
+	exit(255);
+}
+
+int main(int argc, char **argv) {
+	int	ncores = (int) sysconf(_SC_NPROCESSORS_ONLN), maxt, opt,
+		first = 1, fast = 0;
+	char	*report = "bench.json", cpu[128];
+	double	*x, t0 = now();
+	FILE	*fp;
+
+	maxt = (ncores > 0 ? ncores : 1);
+	while ((opt = getopt(argc, argv, "n:r:t:fo:h")) != -1) {
+		switch (opt) {
+		case 'n': nevals = (long) atof(optarg); break;
+		case 'r': nreps = atoi(optarg); break;
+		case 't': maxt = atoi(optarg); break;
+		case 'f': fast = 1; break;
+		case 'o': report = optarg; break;
+		default: usage(argv[0]);
+		}
+	}
+	if (nevals < 1000 || nreps < 1 || maxt < 1)
+		usage(argv[0]);
+	/* room for the double, and the float or int evaluation points */
+	if (!(x = (double *) malloc(2 * NX * sizeof(double)))) {
+		perror(argv[0]);
+		return 255;
+	}
+	if (!(fp = fopen(report, "w"))) {
+		perror(report);
+		return 255;
+	}
+	cpumodel(cpu, sizeof(cpu));
+
+	fprintf(fp, "{\n  \"libran\": \"%s\",\n  \"cpu\": \"%s\",\n"
+		"  \"cores\": %d,\n  \"evals\": %ld,\n  \"reps\": %d,\n"
+		"  \"tsc\": %s,\n  \"fast\": %s,\n  \"isa\": \"%s\",\n"
+		"  \"distributions\": [",
+		LRversion("version"), cpu, ncores, nevals, nreps,
+		(HAVE_TSC ? "true" : "false"), (fast ? "true" : "false"),
+		LR_isa());
+	printf("%-10s %-6s %9s %9s %9s %9s %9s %9s %9s  %s\n", "type",
+		"data", "RAN ns", "cycles", "batch ns", "PDF ns", "cycles",
+		"CDF ns", "cycles",
+		"threads: speedup");
+
+	for (int i = 0; i < NCASES; i++) {
+		vcase	*c = &cases[i];
+		LR_obj	*o;
+		LR_spec	*s;
+		long	n = nevals / c->div;
+		btime	br, bb, bp, bc, none = {NAN, NAN};
+		double	r1 = NAN, rt;
+		LR_counters	work;
+		int	cnt;
+
+		if (!wanted(c, argc - optind, argv + optind))
+			continue;
+		if (!(o = make(c)) || LR_check(o)) {
+			fprintf(stderr, "%s: can't set up case %d\n", argv[0], i);
+			LR_rm(&o);
+			continue;
+		}
+		(void) LR_fast(o, fast);
+		LR_lsetseed(o, 19580512l);
+		/* evaluation points from the distribution */
+		for (int j = 0; j < NX; j++) {
+			if (c->d == LR_double)
+				x[j] = LRd_RAN(o);
+			else if (c->d == LR_float)
+				((float *) (x + NX))[j] = LRf_RAN(o);
+			else
+				((int *) (x + NX))[j] = LRi_RAN(o);
+		}
+		/* the work per variate, if counted (see LR_counters) */
+		LR_counters_reset(o);
+		sink += bloop(o, B_RAN, NULL, NX);
+		cnt = LR_counters_get(o, &work);
+		br = bestof(o, B_RAN, x, n);
+		bb = (c->d == LR_int ? none : bestof(o, B_RANN, x, n));
+		bp = bestof(o, B_PDF, x, nevals);
+		bc = bestof(o, B_CDF, x, nevals);
+
+		fprintf(fp, "%s\n    {\"type\": \"%s\", \"data\": \"%s\", "
+			"\"ran_ns\": ", (first ? "" : ","), o->ops->type,
+			dname(c->d));
+		jnum(fp, br.ns);
+		fprintf(fp, ", \"ran_cycles\": ");
+		jnum(fp, br.cyc);
+		fprintf(fp, ", \"pdf_ns\": ");
+		jnum(fp, bp.ns);
+		fprintf(fp, ", \"pdf_cycles\": ");
+		jnum(fp, bp.cyc);
+		fprintf(fp, ", \"cdf_ns\": ");
+		jnum(fp, bc.ns);
+		fprintf(fp, ", \"cdf_cycles\": ");
+		jnum(fp, bc.cyc);
+		if (cnt) {
+			fprintf(fp, ", \"per_variate\": null");
+		} else {
+			fprintf(fp, ", \"per_variate\": {\"uniforms\": %.4f, "
+				"\"rejections\": %.4f, \"iterations\": %.4f, "
+				"\"callbacks\": %.4f}", (double) work.uniforms / NX,
+				(double) work.rejections / NX,
+				(double) work.iterations / NX,
+				(double) work.callbacks / NX);
+		}
+		fprintf(fp, ", \"batch_ns\": ");
+		jnum(fp, bb.ns);
+		fprintf(fp, ", \"batch_cycles\": ");
+		jnum(fp, bb.cyc);
+		fprintf(fp, ", \"batch_kernel\": %s,\n      \"threads\": [",
+			((c->d == LR_double && o->ops->rnd_n)
+			|| (c->d == LR_float && o->ops->rnf_n) ? "true" : "false"));
+		printf("%-10s %-6s %9.2f %9.1f %9.2f %9.2f %9.1f %9.2f %9.1f ",
+			o->ops->type, dname(c->d), br.ns, br.cyc, bb.ns,
+			bp.ns, bp.cyc, bc.ns, bc.cyc);
+		first = 0;
+
+		if ((s = LR_spec_new(&o))) {
+			for (int nt = 1; nt <= maxt; nt = (2 * nt > maxt
+			&& nt < maxt ? maxt : 2 * nt)) {
+				rt = bthreads(s, nt, n / 4 + 1);
+				r1 = (nt == 1 ? rt : r1);
+				fprintf(fp, "%s{\"threads\": %d, \"samples_per_s\": ",
+					(nt == 1 ? "" : ", "), nt);
+				jnum(fp, rt);
+				fprintf(fp, ", \"speedup\": ");
+				jnum(fp, rt / r1);
+				fprintf(fp, "}");
+				printf(" %d:%.2f", nt, rt / r1);
+			}
+			LR_spec_rm(&s);
+		} else {
+			LR_rm(&o);
+		}
+		fprintf(fp, "]}");
+		printf("\n");
+		fflush(stdout);
+	}
+
+	/* the tallying objects */
+	{
+		LR_obj	*o = LR_new(gausbm, LR_double),
+			*p = LR_new(poisson, LR_int);
+		int	*k = (int *) (x + NX);
+
+		LR_set(p, 'p', 12.5);
+		LR_lsetseed(o, 19580512l);
+		LR_lsetseed(p, 19580512l);
+		for (int j = 0; j < NX; j++) {
+			x[j] = LRd_RAN(o);
+			k[j] = LRi_RAN(p);
+		}
+		fprintf(fp, "\n  ],\n  \"tallies\": [");
+		printf("\n%-10s %9s %9s\n", "tally", "add ns", "add_n ns");
+		for (int w = T_BIN; w <= T_KLL; w++) {
+			double	ts = btally1(w, 0, x, k, nevals),
+				tb = btally1(w, 1, x, k, nevals);
+			fprintf(fp, "%s\n    {\"name\": \"%s\", \"scalar_ns\": ",
+				(w == T_BIN ? "" : ","), tname[w]);
+			jnum(fp, ts);
+			fprintf(fp, ", \"batch_ns\": ");
+			jnum(fp, tb);
+			fprintf(fp, "}");
+			printf("%-10s %9.2f %9.2f\n", tname[w], ts, tb);
+		}
+		LR_rm(&o);
+		LR_rm(&p);
+	}
+
+	t0 = now() - t0;
+	fprintf(fp, "\n  ],\n  \"seconds\": %.3f\n}\n", t0);
+	fclose(fp);
+	free(x);
+	printf("%.1f seconds, report in %s\n", t0, report);
+	return 0;
+}
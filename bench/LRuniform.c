@@ -0,0 +1,135 @@
+/*!
+\file	LRuniform.c
+\brief	Quality and speed of the LibRan uniform generators
+
+The spectral test is run on the multipliers of the \e int and
+\e long linear congruential generators (\c LR_IA and \c LR_LA ),
+then the statistical battery of \c LR_battery_run() on the
+float (\e int LCG) and double (\e long LCG) uniforms, reporting
+the throughput of the generator and of each test next to its p-value.
+The results are written as JSON and a summary to stdout.
+
+	LRuniform [-n uniforms] [-r reps] [-t threads] [-s seed] [-o report]
+
+\code
+make battery
+make battery BATTERY_N=100000000 BATTERY_REPORT=big.json
+\endcode
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>	/* getopt,sysconf */
+#include "libran.h"
+
+static void usage(const char *prog) {
+	fprintf(stderr, "usage: %s [-n uniforms] [-r reps] [-t threads] "
+		"[-s seed] [-o report]\n", prog);
+	exit(255);
+}
+
+int main(int argc, char **argv) {
+	long		n = 1l << 22, seed = 19580512l;
+	int		reps = 8, opt, err = 0,
+			nthreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	char		*report = "battery.json";
+	FILE		*fp;
+	struct {
+		const char	*name;
+		unsigned long	a, m;
+	} lcg[2] = {
+		{"LR_IA", (unsigned long) LR_igetval("LR_IA"),
+			2ul * (unsigned long) LR_igetval("LR_IRAND_IMAX2")},
+		{"LR_LA", (unsigned long) LR_lgetval("LR_LA"),
+			2ul * (unsigned long) LR_lgetval("LR_IRAND_LMAX2")}
+	};
+	LR_data_type	dt[2] = {LR_float, LR_double};
+
+	while ((opt = getopt(argc, argv, "n:r:t:s:o:h")) != -1) {
+		switch (opt) {
+		case 'n': n = (long) atof(optarg); break;
+		case 'r': reps = atoi(optarg); break;
+		case 't': nthreads = atoi(optarg); break;
+		case 's': seed = atol(optarg); break;
+		case 'o': report = optarg; break;
+		default: usage(argv[0]);
+		}
+	}
+	if (n < (1l << 16) || reps < 1 || nthreads < 1)
+		usage(argv[0]);
+	if (!(fp = fopen(report, "w"))) {
+		perror(report);
+		return 255;
+	}
+
+	fprintf(fp, "{\n  \"libran\": \"%s\",\n  \"spectral\": [",
+		LRversion("version"));
+	printf("spectral test S_t (1 is best, below .1 is poor)\n%-6s", "");
+	for (int k = 2; k <= LR_SPECTRAL_MAX; k++)
+		printf("      S_%d", k);
+	printf("\n");
+	for (int i = 0; i < 2; i++) {
+		double	nu[LR_SPECTRAL_MAX + 1], st[LR_SPECTRAL_MAX + 1];
+		int	e = LR_spectral(lcg[i].a, lcg[i].m, LR_SPECTRAL_MAX,
+				nu, st);
+
+		err |= e;
+		fprintf(fp, "%s\n    {\"lcg\": \"%s\", \"a\": %lu, \"m\": %lu, "
+			"\"S\": [", (i ? "," : ""), lcg[i].name, lcg[i].a,
+			lcg[i].m);
+		printf("%-6s", lcg[i].name);
+		for (int k = 2; k <= LR_SPECTRAL_MAX; k++) {
+			fprintf(fp, "%s%.4f", (k > 2 ? ", " : ""),
+				(e ? 0.0 : st[k]));
+			printf(" %8.4f", (e ? 0.0 : st[k]));
+		}
+		fprintf(fp, "]}");
+		printf("\n");
+	}
+
+	fprintf(fp, "\n  ],\n  \"uniforms\": %ld,\n  \"reps\": %d,\n"
+		"  \"threads\": %d,\n  \"seed\": %ld,\n  \"battery\": [",
+		n, reps, nthreads, seed);
+	printf("\n%-7s %8s %-10s %10s %14s\n", "data", "ns/unif", "test",
+		"p", "uniforms/s");
+	for (int i = 0; i < 2; i++) {
+		LR_obj		*o = LR_new(unif, dt[i]);
+		LR_spec		*s = NULL;
+		LR_battery	b;
+		int		e;
+
+		if (!o || !(s = LR_spec_new(&o))) {
+			fprintf(stderr, "%s: can't create the generator\n",
+				argv[0]);
+			LR_rm(&o);
+			err |= LRerr_Unspecified;
+			continue;
+		}
+		e = LR_battery_run(&b, s, n, reps, nthreads, seed);
+		err |= e;
+		fprintf(fp, "%s\n    {\"data\": \"%s\", \"ns_per_uniform\": "
+			"%.3f, \"seconds\": %.3f, \"error\": \"%s\", "
+			"\"tests\": [", (i ? "," : ""),
+			(dt[i] == LR_float ? "float" : "double"),
+			(e ? 0.0 : b.ns), (e ? 0.0 : b.secs),
+			(e ? LRstrerrno(e) : ""));
+		for (int k = 0; !e && k < LR_BATTERY_TESTS; k++) {
+			fprintf(fp, "%s\n      {\"test\": \"%s\", \"p\": %.4g, "
+				"\"uniforms_per_second\": %.4g}",
+				(k ? "," : ""), LR_battery_name(k), b.p[k],
+				b.rate[k]);
+			printf("%-7s %8.2f %-10s %10.3g %14.4g\n",
+				(dt[i] == LR_float ? "float" : "double"),
+				b.ns, LR_battery_name(k), b.p[k], b.rate[k]);
+		}
+		fprintf(fp, "\n    ]}");
+		LR_spec_rm(&s);
+	}
+	fprintf(fp, "\n  ]\n}\n");
+	fclose(fp);
+	printf("report in %s\n", report);
+	return (err ? 1 : 0);
+}
@@ -13,6 +13,8 @@ extern "C" {
 #  endif
 
 #  include <stdarg.h>
+#  include <stddef.h>
+#  include "LRconfig.h"
 
 /*!	\def	LR_VERSION
  *	\brief	LibRan Library Version (X.Y.Z)
@@ -44,6 +46,7 @@ LibRan Error Numbers
 #  define LRerr_SuspiciousValues	0x1B /*!< Something suspicious */
 #  define LRerr_AllocFail		0x1D /*!< Memory alloc failure */
 #  define LRerr_InvalidCDF		0x21 /*!< CDF is not monotonic, etc. */
+#  define LRerr_SharedObject		0x23 /*!< Shared read-only object */
 
 /*!
 \enum	LR_type
@@ -64,6 +67,7 @@ typedef	enum {
 	gsn2,		/**< Gaussian like - 2 uni (saw tooth) */
 	gsn4,		/**< Gaussian like - 4 uni */
 	gsn12,		/**< Gaussian like - 12 uni */
+	gsnN,		/**< Gaussian like - k uni (k = 1..LR_GSN_MAX) */
 	logd,		/**< logirithmic */
 	nexp,		/**< negative exponential */
 	erlang,		/**< Erlang */
@@ -102,12 +106,87 @@ typedef enum {
 	LR_double	/*!< double precision floating type */
 }	LR_data_type;
 
+/*!	\def	LR_CACHELINE
+ *	\brief	cache line size (bytes) the `LR_obj` layout is built around
+ */
+#  define LR_CACHELINE	64
+#  ifdef __GNUC__
+#    define LR_ALIGNED	__attribute__((aligned(LR_CACHELINE)))
+#  else
+#    define LR_ALIGNED
+#  endif
+
+/*!
+\struct	LR_counters
+\brief	per-object instrumentation counters
+
+When LibRan is configured with \c --enable-counters the installed
+\c LRconfig.h defines \c LR_COUNTERS and each `LR_obj` object carries
+these counters, otherwise they and the code updating them are compiled
+out.  Since \c libran.h includes \c LRconfig.h the library and the code
+using it always agree on the `LR_obj` layout.  They are per object, so
+the streams of a shared spec count independently without contention.
+See `LR_counters_get()` and `LR_counters_reset()`.
+*/
+typedef struct {
+	unsigned long	uniforms;	/*!< uniforms - urand values consumed */
+	unsigned long	rejections;	/*!< rejections - rejected candidates */
+	unsigned long	iterations;	/*!< iterations - root finder steps */
+	unsigned long	callbacks;	/*!< callbacks - user fn evaluations */
+}	LR_counters;
+
+/*!	\def	LR_COUNT
+ *	\brief	add \e n to counter \e f of object \e o (if LR_COUNTERS)
+ */
+#  ifdef LR_COUNTERS
+#    define LR_COUNT(o, f, n)	((void) ((o)->cnt.f += (n)))
+#  else
+#    define LR_COUNT(o, f, n)	((void) (o))
+#  endif
+
 /*!
 \typedef	LR_obj
 \brief		the fundamental LibRan distribution object - the `LR_obj` struct
 */
 /* tag & predefine the fns object */
 typedef struct LR_obj LR_obj;
+/* tag & predefine the shared spec object */
+typedef struct LR_spec LR_spec;
+
+/*!
+\struct	LR_ops
+\brief	the per-type dispatch table
+
+There is one static `LR_ops` table for each random variate distribution
+type holding the type name and the distribution's RAN, PDF, CDF, and
+quantile (QUANT) functions for each data type.  It is shared by every `LR_obj` object of
+that type, so the objects themselves only carry a single pointer to it.
+Functions not available for a data type are NULL, and those types
+without a batch RAN function are sampled one at a time by `LRd_RAN_n()`
+and `LRf_RAN_n()`.
+*/
+typedef struct {
+	const char *	type;				/*!< named distribution type */
+	/**< set of Random Fns for this distribution type */
+	float	(*rnf)(LR_obj *);		/*!< rnf - float _RAN fn */
+	double	(*rnd)(LR_obj *);		/*!< rnd - double _RAN fn */
+	int	(*rni)(LR_obj *);		/*!< rni - int _RAN fn */
+	/**< set of PDFs for this distribution type */
+	float	(*pdff)(LR_obj *, float);	/*!< pdff - float _PDF fn */
+	double	(*pdfd)(LR_obj *, double);	/*!< pdfd - double _PDF fn */
+	float	(*pdfi)(LR_obj *, int);		/*!< pdfi - float _PDF fn */
+	/**< set of CDFs for this distribution type  */
+	float	(*cdff)(LR_obj *, float);	/*!< cdff - float _CDF fn */
+	double	(*cdfd)(LR_obj *, double);	/*!< cdfd - double _CDF fn */
+	float	(*cdfi)(LR_obj *, int);		/*!< cdfi - float _PDF fn */
+	/**< batch RANs (NULL - one at a time) - see LRf_RAN_n() */
+	int	(*rnf_n)(LR_obj *, float *, long);	/*!< rnf_n - float */
+	int	(*rnd_n)(LR_obj *, double *, long);	/*!< rnd_n - double */
+	/**< quantiles (inverse CDFs) - see LRf_QUANT() */
+	float	(*qnf)(LR_obj *, float);	/*!< qnf - float _QUANT fn */
+	double	(*qnd)(LR_obj *, double);	/*!< qnd - double _QUANT fn */
+	int	(*qni)(LR_obj *, float);	/*!< qni - int _QUANT fn */
+}	LR_ops;
 
 /*!
 \struct	LR_obj
@@ -121,52 +200,85 @@ If the built-in pseudo-random number generator is used then the generator
 values are also stored within the object to allow each object to act
 independently.
 
-Other of the attributes serve the object-oriented aspect of the `LR_obj`
-object by having pointers to the random variate distribution's
-RAN, PDF, and CDF functions. 
+The object-oriented aspect of the `LR_obj` object is served by the
+\e ops pointer to the distribution type's shared `LR_ops` table of
+RAN, PDF, and CDF functions.
 
 Some random variate distributions (e.g. \e piece and \e lspline ) require
 auxiliary methods to define the distribution.
 
+Any constants derived from the attributes (e.g. \f$ 1/s \f$ or
+\f$ e^{-p} \f$) are kept in \e rc and \e dc and are recomputed whenever
+the attributes are set (see `LR_freeze()`), so the RAN, PDF, and CDF methods
+never have to derive them on each call.
+
+The object is laid out so that everything a RAN call touches
+(the dispatch pointer, the generator state and uniform functions,
+the RAN constants \e rc, the saved variate \e x, the data type and \e k)
+lies in the first `LR_CACHELINE` bytes.  The remaining attributes are only
+read by the PDF, CDF, set and check methods.  The object is aligned
+to (and padded to a multiple of) `LR_CACHELINE`, so an array of
+per-thread objects never has two threads writing the same cache line.
+If configured with \c LR_COUNTERS the object ends with its
+`LR_counters` \e cnt (see \c LRconfig.h ), and its size is also given
+by `LR_obj_size()` for checking against the \c libran.h in use.
+
 Lastly there is \e errno which contains the last error number encountered.
 Use `LR_perror()` to display the error description.
 */
 struct LR_obj {
-	const char const *	type;	/*!< named distribution type */
-	LR_type		t;	/*!< t - distribution type */
-	LR_data_type	d;	/*!< d - data type */
-	LR_val		a;	/*!< a - lower bound of interval */
-	LR_val		b;	/*!< b - upper bound of interval */
-	LR_val		m;	/*!< m - middle value of distribution */
-	LR_val		s;	/*!< s - measure of distribution width */
+	/**< hot - one cache line for the RAN methods */
+	const LR_ops *	ops;	/*!< ops - shared per-type dispatch table */
+	LR_val		iy;	/*!< iy - current random number sequence value*/
+	float	(*uf)(LR_obj *);	/*!< uf - float random number fn */
+	double	(*ud)(LR_obj *);	/*!< ud - double random number fn */
+	LR_val		rc[2];	/*!< rc - RAN location & scale - see LR_derive() */
 	LR_val		x;	/*!< x - auxiliary value */
+	LR_data_type	d;	/*!< d - data type */
 	int		k;	/*!< k - integer attribute */
+	/**< cold - attributes */
+	LR_type		t;	/*!< t - distribution type */
 	int		n;	/*!< n - integer attribute */
 	float		p;	/*!< p - float attribute */
 	float		q;	/*!< q - float attribute */
-	/**< object random values */
-	LR_val		iy;	/*!< iy - current random number sequence value*/
+	LR_val		a;	/*!< a - lower bound of interval */
+	LR_val		b;	/*!< b - upper bound of interval */
+	LR_val		m;	/*!< m - middle value of distribution */
+	LR_val		s;	/*!< s - measure of distribution width */
+	/**< derived constants - see LR_freeze() */
+	LR_val		dc[4];	/*!< dc - per-type precomputed constants */
 	LR_val		iy0;	/*!< iy0- initial random number sequence value*/
-	/**< set of uniform random number generators - one for each data type */
+	/**< rest of the uniform random number generators */
 	int	(*ui)(LR_obj *);	/*!< ui - int random number fn */
 	long	(*ul)(LR_obj *);	/*!< ul - long random number fn */
-	float	(*uf)(LR_obj *);	/*!< uf - float random number fn */
-	double	(*ud)(LR_obj *);	/*!< ud - double random number fn */
-	/**< set of Random Fns for this distribution type */
-	float	(*rnf)(LR_obj *);		/*!< rnf - float _RAN fn */
-	double	(*rnd)(LR_obj *);		/*!< rnd - double _RAN fn */
-	int	(*rni)(LR_obj *);		/*!< rni - int _RAN fn */
-	/**< set of PDFs for this distribution type */
-	float	(*pdff)(LR_obj *, float);	/*!< pdff - float _PDF fn */
-	double	(*pdfd)(LR_obj *, double);	/*!< pdfd - double _PDF fn */
-	float	(*pdfi)(LR_obj *, int);		/*!< pdfi - float _PDF fn */
-	/**< set of CDFs for this distribution type  */
-	float	(*cdff)(LR_obj *, float);	/*!< cdff - float _CDF fn */
-	double	(*cdfd)(LR_obj *, double);	/*!< cdfd - double _CDF fn */
-	float	(*cdfi)(LR_obj *, int);		/*!< cdfi - float _PDF fn */
 	/**< generic (void) pointer to some other object */
 	void *		aux;	/*!< aux - auxiliary object */
+	LR_spec *	spec;	/*!< spec - shared spec (streams only) */
 	int		errno;	/*!< errno - last error encountered */
+	int		flags;	/*!< flags - memory owner, fast math mode */
+#  ifdef LR_COUNTERS
+	LR_counters	cnt;	/*!< cnt - instrumentation counters */
+#  endif
+} LR_ALIGNED;
+
+/**< LR_obj.flags */
+#  define	LR_OBJ_INPLACE		0x01 /*!< caller's storage (LR_init) */
+#  define	LR_OBJ_ARENA		0x02 /*!< allocated from an LR_arena */
+#  define	LR_OBJ_FAST		0x04 /*!< fast math mode (LR_fast) */
+
+/*!
+\struct	LR_spec
+\brief	a shared read-only distribution definition
+
+The `LR_spec` object takes over a fully set up `LR_obj` object
+(attributes and auxiliary tables) and is shared, read-only,
+by any number of per-thread \e stream objects made with
+`LR_stream_new()`.  It is reference counted and released when the last
+reference is dropped with `LR_spec_rm()`.
+*/
+struct LR_spec {
+	LR_obj *	o;	/*!< o - the defining object */
+	int		refs;	/*!< refs - reference count */
 };
 
 /*!
@@ -177,6 +289,21 @@ The `LR_bin` object is a useful tool for tallying and creating a
 histogram of samples.  The array of bins and boundaries are allocated
 when instantiated the number of which may be less than actually used.
 
+Partial tallies (e.g. one per thread made with `LR_bin_clone_empty()`)
+can be combined with `LR_bin_merge()`, or a single object can be shared
+by several threads once set to tally with atomic counters
+(`LR_bin_atomic()`).
+
+Weighted tallies (`LR_bin_weighted()`) also sum each sample's weight
+and squared weight per bin in \e sw and \e sw2 with compensated
+(Kahan) summation, the small remainders being kept in \e cw .
+Use `LR_bin_sumw()`, `LR_bin_var()`, and `LR_bin_ess()` to read them.
+
+Bins of equal width made with `LR_bin_new_uniform()` keep the lowest
+boundary \e lo and the inverse width \e w1 so the bin can be found
+arithmetically, otherwise \e w1 is zero and the boundaries are
+binary searched.
+
 The object also has
 \e errno which contains the last error number encountered.
 Use `LR_perror()` to display the error description.
@@ -187,9 +314,193 @@ typedef struct {
 	long		c;	/*!< c - count of sample values */
 	double *	bdrs;	/*!< bdrs - set of bin boundaries (n - 1) */
 	long *		bins;	/*!< bins - set of bins (n) */
+	double		lo;	/*!< lo - lowest boundary (uniform bins) */
+	double		w1;	/*!< w1 - 1/bin width (uniform bins) or 0 */
+	int		flags;	/*!< flags - bin flags (LR_BIN_ATOMIC,...) */
 	int		errno;	/*!< errno - last bin error encountered */
+	double *	sw;	/*!< sw - sums of weights (n) or NULL */
+	double *	sw2;	/*!< sw2 - sums of squared weights (n) */
+	double *	cw;	/*!< cw - compensation for sw and sw2 (2n) */
 }	LR_bin;
 
+/**< LR_bin.flags */
+#  define	LR_BIN_ATOMIC		0x01 /*!< tally with atomic counters */
+#  define	LR_BIN_WEIGHTED		0x02 /*!< also sum sample weights */
+
+/*!
+\struct	LR_ibin
+\brief	the integer binning object - for tallying discrete results
+
+The `LR_ibin` object tallies integer values (e.g. from `LRi_RAN()`)
+without needing to know their range ahead of time.  Values in
+[0,nd) are counted directly in \e dense , any others in an open
+addressing hash table of \e cap slots (\e keys and \e vals ) which
+grows as needed.  A slot is empty when its count is zero.
+*/
+typedef struct {
+	long		c;	/*!< c - count of sample values */
+	int		nd;	/*!< nd - number of dense bins [0,nd) */
+	long *		dense;	/*!< dense - the dense bins (nd) */
+	size_t		cap;	/*!< cap - hash table slots (power of 2) */
+	size_t		used;	/*!< used - hash table slots in use */
+	int *		keys;	/*!< keys - hash table values (cap) */
+	long *		vals;	/*!< vals - hash table counts (cap) */
+	int		errno;	/*!< errno - last bin error encountered */
+}	LR_ibin;
+
+/*!
+\struct	LR_stats
+\brief	the streaming moments object - for sample statistics
+
+The `LR_stats` object accumulates the count, mean, and central
+moment sums \f$ M_k = \sum (x_i - \bar{x})^k \f$ for \e k = 2,3,4
+of a stream of values without storing them, along with the
+minimum and maximum values (\e min is \f$ \infty \f$ and \e max is
+\f$ -\infty \f$ before any are added).
+*/
+typedef struct {
+	long		n;	/*!< n - count of values */
+	double		mean;	/*!< mean - sample mean */
+	double		m2;	/*!< m2 - sum of squared deviations */
+	double		m3;	/*!< m3 - sum of cubed deviations */
+	double		m4;	/*!< m4 - sum of 4th power deviations */
+	double		min;	/*!< min - smallest value */
+	double		max;	/*!< max - largest value */
+	int		errno;	/*!< errno - last error encountered */
+}	LR_stats;
+
+/*!	\def	LR_KLL_LEVELS
+ *	\brief	most levels in an `LR_kll` sketch (at least \f$ 2^{50} \f$ values)
+ */
+#  define LR_KLL_LEVELS	60
+
+/*!
+\struct	LR_kll
+\brief	the quantile sketch object - for sample percentiles
+
+The `LR_kll` object is a KLL sketch of a stream of values, which keeps
+\e len[h] sampled values in \e lev[h] at each level \e h
+(of \e nlev), each standing in for \f$ 2^h \f$ values.
+It holds about \e 3k values however many, \e n , have been added,
+compacting a level when the total capacity \e tot is reached.
+*/
+typedef struct {
+	int		k;	/*!< k - size parameter */
+	int		nlev;	/*!< nlev - number of levels in use */
+	long		n;	/*!< n - count of values added */
+	long		size;	/*!< size - count of values kept */
+	double		min;	/*!< min - smallest value */
+	double		max;	/*!< max - largest value */
+	unsigned long	rng;	/*!< rng - compaction generator state */
+	long		tot;	/*!< tot - total capacity of the levels */
+	int		cap[LR_KLL_LEVELS]; /*!< cap - capacity of each level */
+	int		len[LR_KLL_LEVELS]; /*!< len - values in each level */
+	int		sz[LR_KLL_LEVELS];  /*!< sz - allocated size of each */
+	double *	lev[LR_KLL_LEVELS]; /*!< lev - values of each level */
+	int		errno;	/*!< errno - last error encountered */
+}	LR_kll;
+
+/*!
+\struct	LR_gof
+\brief	the goodness-of-fit object - testing samples against a distribution
+
+The `LR_gof` object tests a stream of samples against the distribution
+of the `LR_obj` object \e o , tallying them in the bins \e b for the
+chi-square test and collecting them in batches of \e m in \e buf for the
+Kolmogorov-Smirnov and Anderson-Darling tests.  The p-values of the
+\e nb batches tested so far are kept in \e pks and \e pad .
+*/
+typedef struct {
+	LR_obj *	o;	/*!< o - reference distribution (not owned) */
+	LR_bin *	b;	/*!< b - chi-square bins */
+	long		n;	/*!< n - count of samples added */
+	size_t		m;	/*!< m - batch size */
+	size_t		nbuf;	/*!< nbuf - samples in the partial batch */
+	double *	buf;	/*!< buf - partial batch (NULL if discrete) */
+	int		nb;	/*!< nb - number of batches tested */
+	int		mb;	/*!< mb - allocated size of pks and pad */
+	double *	pks;	/*!< pks - KS p-value of each batch */
+	double *	pad;	/*!< pad - AD p-value of each batch */
+	int		errno;	/*!< errno - last error encountered */
+}	LR_gof;
+
+/*!	\def	LR_SOBOL_MAX
+ *	\brief	largest dimension of the `LR_sobol` sequence
+ */
+#  define LR_SOBOL_MAX	1024
+
+/*!	\def	LR_SOBOL_BITS
+ *	\brief	bits of each `LR_sobol` coordinate (and most points
+ *	\f$ 2^{64} \f$ )
+ */
+#  define LR_SOBOL_BITS	64
+
+/*!
+\struct	LR_sobol
+\brief	the quasi-random (Sobol sequence) object - for quasi-Monte Carlo
+
+The `LR_sobol` object gives the points of the \e d dimensional
+(scrambled) Sobol sequence, as the \e LR_SOBOL_BITS bit integers \e x
+of the next point, index \e i .  The \e v are the (scrambled)
+direction numbers, \e v[j*d + k] for bit \e j of dimension \e k ,
+and \e e the digital shift of each dimension (the point of index 0).
+*/
+typedef struct {
+	int		d;	/*!< d - dimension */
+	long		seed;	/*!< seed - scrambling seed (0 - none) */
+	unsigned long	i;	/*!< i - index of the next point */
+	unsigned long *	x;	/*!< x - next point (d) */
+	unsigned long *	e;	/*!< e - digital shift (d) */
+	unsigned long *	v;	/*!< v - direction numbers (LR_SOBOL_BITS*d) */
+	int		errno;	/*!< errno - last error encountered */
+}	LR_sobol;
+
+/*!	\def	LR_BATTERY_TESTS
+ *	\brief	number of statistical tests in the uniform generator battery
+ */
+#  define LR_BATTERY_TESTS	5
+
+/*!	\def	LR_SPECTRAL_MAX
+ *	\brief	largest dimension of the spectral test
+ */
+#  define LR_SPECTRAL_MAX	8
+
+/*!
+\struct	LR_battery
+\brief	the results of the uniform generator battery
+
+The `LR_battery` object holds the combined p-value \e p[i] of each test
+of \c LR_battery_run() (named by \c LR_battery_name(i) ) and its
+throughput, along with that of the generator alone.
+*/
+typedef struct {
+	long		n;	/*!< n - uniforms for each test */
+	int		reps;	/*!< reps - replications of each test */
+	int		nthreads; /*!< nthreads - number of threads used */
+	double		ns;	/*!< ns - ns per uniform of the generator */
+	double		p[LR_BATTERY_TESTS];	/*!< p - p-value of each test */
+	double		rate[LR_BATTERY_TESTS];	/*!< rate - uniforms/s */
+	double		secs;	/*!< secs - elapsed time (s) */
+	int		errno;	/*!< errno - last error encountered */
+}	LR_battery;
+
+/*!
+\struct	LR_arena
+\brief	an arena for allocating many objects cheaply
+
+The `LR_arena` object hands out cache line aligned memory from large
+blocks for `LR_new_in()` objects and their auxiliary tables.
+Everything allocated from it is released at once with
+`LR_arena_reset()` or `LR_arena_rm()`.
+*/
+typedef struct {
+	size_t		size;	/*!< size - block size (bytes) */
+	void *		blk;	/*!< blk - current block (blocks are linked) */
+	size_t		used;	/*!< used - bytes used in current block */
+	size_t		cap;	/*!< cap - size of current block */
+	int		errno;	/*!< errno - last arena error encountered */
+}	LR_arena;
+
 /*!
 \struct	LR_pcs
 \brief	A special object for defining some of the random variate distributions.
@@ -211,6 +522,7 @@ typedef struct {
 	double *	sc;	/*!< sc - cumulative probability for each interval (n) */
 	double 		norm;	/*!< norm - normalization factor for `c` */
 	int		flags;	/*!< flags to guarantee certain actions */
+	LR_arena *	arena;	/*!< arena - if the tables are from an arena */
 
 /**< special auxiliary methods */
 	int (*new)(LR_obj *o, int n);		/*!< aux new fn */
@@ -242,19 +554,122 @@ typedef struct {
 
 /* LibRan function declarations */
 LR_obj *LR_new(LR_type t, LR_data_type d);
+LR_obj *LR_new_in(LR_arena *a, LR_type t, LR_data_type d);
+int LR_init(LR_obj *o, LR_type t, LR_data_type d);
+size_t LR_obj_size(void);
 int LR_rm(LR_obj **o);
 int LR_check(LR_obj *o);
+int LR_freeze(LR_obj *o);
+void LR_derive(LR_obj *o);
+
+/* LibRan arenas */
+LR_arena *LR_arena_new(size_t size);
+void *LR_arena_alloc(LR_arena *a, size_t n);
+int LR_arena_reset(LR_arena *a);
+int LR_arena_rm(LR_arena **a);
+
+/* LibRan shared specs & streams */
+LR_spec *LR_spec_new(LR_obj **o);
+LR_spec *LR_spec_ref(LR_spec *s);
+int LR_spec_rm(LR_spec **s);
+LR_obj *LR_stream_new(LR_spec *s);
+
+/* LibRan instrumentation counters */
+int LR_counters_get(LR_obj *o, LR_counters *c);
+void LR_counters_reset(LR_obj *o);
 
 /* LibRan object parameter setting */
 int LR_vset(LR_obj *o, char *x, va_list ap);
 int LR_set(LR_obj *o, char x, ...);
 int LR_set_all(LR_obj *o, char *x, ...);
+int LR_fast(LR_obj *o, int on);
 
 /* LibRan binning object */
 LR_bin *LR_bin_new(int n);
+LR_bin *LR_bin_new_uniform(int n, double lo, double hi);
+LR_bin *LR_bin_new_array(const double *x, int m);
+LR_bin *LR_bin_new_log(int n, double lo, double hi);
+LR_bin *LR_bin_new_geom(int n, double lo, double w, double r);
+LR_bin *LR_bin_new_quantile(LR_obj *o, int n);
 int LR_bin_rm(LR_bin **b);
 int LR_bin_set(LR_bin *b, double x);
 int LR_bin_add(LR_bin *b, double x);
+int LR_bin_add_n(LR_bin *b, const double *x, size_t n);
+LR_bin *LR_bin_clone_empty(const LR_bin *b);
+int LR_bin_merge(LR_bin *dst, const LR_bin *src);
+int LR_bin_atomic(LR_bin *b, int on);
+int LR_bin_weighted(LR_bin *b);
+int LR_bin_addw(LR_bin *b, double x, double w);
+int LR_bin_addw_n(LR_bin *b, const double *x, const double *w, size_t n);
+double LR_bin_sumw(const LR_bin *b, int i);
+double LR_bin_var(const LR_bin *b, int i);
+double LR_bin_ess(const LR_bin *b, int i);
+
+/* LibRan integer binning object */
+LR_ibin *LR_ibin_new(int nd);
+int LR_ibin_rm(LR_ibin **b);
+int LR_ibin_add(LR_ibin *b, int k);
+int LR_ibin_add_n(LR_ibin *b, const int *k, size_t n);
+long LR_ibin_get(const LR_ibin *b, int k);
+size_t LR_ibin_size(const LR_ibin *b);
+int LR_ibin_merge(LR_ibin *dst, const LR_ibin *src);
+int LR_ibin_export(const LR_ibin *b, int *keys, long *counts);
+
+/* LibRan streaming moments object */
+LR_stats *LR_stats_new(void);
+int LR_stats_rm(LR_stats **s);
+int LR_stats_reset(LR_stats *s);
+int LR_stats_add(LR_stats *s, double x);
+int LR_stats_add_n(LR_stats *s, const double *x, size_t n);
+int LR_stats_merge(LR_stats *dst, const LR_stats *src);
+double LR_stats_mean(const LR_stats *s);
+double LR_stats_var(const LR_stats *s);
+double LR_stats_sem(const LR_stats *s);
+double LR_stats_skew(const LR_stats *s);
+double LR_stats_kurt(const LR_stats *s);
+
+/* LibRan quantile sketch object */
+LR_kll *LR_kll_new(int k);
+int LR_kll_rm(LR_kll **s);
+int LR_kll_add(LR_kll *s, double x);
+int LR_kll_add_n(LR_kll *s, const double *x, size_t n);
+int LR_kll_merge(LR_kll *dst, const LR_kll *src);
+double LR_kll_quantile(const LR_kll *s, double p);
+double LR_kll_rank(const LR_kll *s, double x);
+double LR_kll_eps(const LR_kll *s);
+int LR_kll_compare(const LR_kll *s, LR_obj *o, int m, const double *p,
+	double *xq, double *fq);
+double LR_kll_ksdist(const LR_kll *s, LR_obj *o);
+
+/* LibRan goodness-of-fit tests */
+double LR_gof_chisq(LR_obj *o, const LR_bin *b, double *chi2, int *df);
+double LR_gof_ks(LR_obj *o, double *x, size_t n, double *d);
+double LR_gof_ad(LR_obj *o, double *x, size_t n, double *a2);
+LR_gof *LR_gof_new(LR_obj *o, int nbins, size_t m);
+int LR_gof_rm(LR_gof **g);
+int LR_gof_add_n(LR_gof *g, const double *x, size_t n);
+int LR_gof_merge(LR_gof *dst, const LR_gof *src);
+int LR_gof_flush(LR_gof *g);
+double LR_gof_pchisq(LR_gof *g, double *chi2, int *df);
+double LR_gof_pks(LR_gof *g);
+double LR_gof_pad(LR_gof *g);
+int LR_gof_spec(LR_gof *g, LR_spec *s, long n, int nthreads, long seed);
+double LR_gammq(double a, double x);
+
+/* LibRan quasi-random (Sobol) sequence */
+LR_sobol *LR_sobol_new(int d, long seed);
+int LR_sobol_rm(LR_sobol **s);
+int LR_sobol_skip(LR_sobol *s, unsigned long i);
+int LR_sobol_next(LR_sobol *s, double *u);
+int LR_sobol_next_n(LR_sobol *s, double *u, long n);
+int LR_sobol_quant(LR_sobol *s, LR_obj **o, double *x);
+
+/* LibRan uniform generator battery */
+const char *LR_battery_name(int i);
+int LR_battery_run(LR_battery *b, LR_spec *s, long n, int reps,
+	int nthreads, long seed);
+int LR_spectral(unsigned long a, unsigned long m, int t, double *nu,
+	double *st);
 
 /* LibRan error and info routines */
 char *LRstrerror(int LRerrno);
@@ -282,6 +697,12 @@ long	LR_lgetval(char *str);
 float	LR_fgetval(char *str);
 double	LR_dgetval(char *str);
 
+/* batches of urand uniforms & the instruction set of the batch kernels */
+int	LR_drand_n(LR_obj *, double *x, long n);
+int	LR_frand_n(LR_obj *, float *x, long n);
+const char *LR_isa(void);
+int	LR_isa_set(const char *name);
+
 /* LibRan generic distribution functions */
 /* double */
 double LRd_RAN(LR_obj *o);
@@ -295,6 +716,15 @@ float LRf_CDF(LR_obj *o, float x);
 int   LRi_RAN(LR_obj *o);
 float LRi_PDF(LR_obj *o, int x);
 float LRi_CDF(LR_obj *o, int x);
+/* batches */
+int LRd_RAN_n(LR_obj *o, double *x, long n);
+int LRf_RAN_n(LR_obj *o, float *x, long n);
+double LRd_QUANT(LR_obj *o, double u);
+float LRf_QUANT(LR_obj *o, float u);
+int LRi_QUANT(LR_obj *o, float u);
+int LRd_QUANT_n(LR_obj *o, const double *u, double *x, long n);
+int LRf_QUANT_n(LR_obj *o, const float *u, float *x, long n);
+int LRi_QUANT_n(LR_obj *o, const float *u, int *x, long n);
 /* LibRan generic auxiliary functions */
 int LR_aux_new(LR_obj *o, int n);
 int LR_aux_rm(LR_obj *o);
@@ -304,12 +734,16 @@ int LR_aux_norm(LR_obj *o);
 /* specific LibRan distribution functions */
 /* double unif */
 double LRd_unif_RAN(LR_obj *o);
+int LRd_unif_RAN_n(LR_obj *o, double *x, long n);
 double LRd_unif_PDF(LR_obj *o, double x);
 double LRd_unif_CDF(LR_obj *o, double x);
+double LRd_unif_QUANT(LR_obj *o, double u);
 /* float unif */
 float LRf_unif_RAN(LR_obj *o);
+int LRf_unif_RAN_n(LR_obj *o, float *x, long n);
 float LRf_unif_PDF(LR_obj *o, float x);
 float LRf_unif_CDF(LR_obj *o, float x);
+float LRf_unif_QUANT(LR_obj *o, float u);
 
 /* piecewise uniform */
 int LR_pcs_new(LR_obj *o, int n);
@@ -320,10 +754,12 @@ int LR_pcs_norm(LR_obj *o);
 double LRd_piece_RAN(LR_obj *o);
 double LRd_piece_PDF(LR_obj *o, double x);
 double LRd_piece_CDF(LR_obj *o, double x);
+double LRd_piece_QUANT(LR_obj *o, double u);
 /* float piece */
 float LRf_piece_RAN(LR_obj *o);
 float LRf_piece_PDF(LR_obj *o, float x);
 float LRf_piece_CDF(LR_obj *o, float x);
+float LRf_piece_QUANT(LR_obj *o, float u);
 
 /* linear spline */
 int LR_lspl_new(LR_obj *o, int n);
@@ -334,105 +770,159 @@ int LR_lspl_norm(LR_obj *o);
 double LRd_lspline_RAN(LR_obj *o);
 double LRd_lspline_PDF(LR_obj *o, double x);
 double LRd_lspline_CDF(LR_obj *o, double x);
+double LRd_lspline_QUANT(LR_obj *o, double u);
 /* float linear spline */
 float LRf_lspline_RAN(LR_obj *o);
 float LRf_lspline_PDF(LR_obj *o, float x);
 float LRf_lspline_CDF(LR_obj *o, float x);
+float LRf_lspline_QUANT(LR_obj *o, float u);
 
 /* double user inverse CDF */
 double LRd_uinvcdf_RAN(LR_obj *o);
 double LRd_uinvcdf_PDF(LR_obj *o, double x);
 double LRd_uinvcdf_CDF(LR_obj *o, double x);
+double LRd_uinvcdf_QUANT(LR_obj *o, double u);
 int LRd_uinvcdf(LR_obj *o, double (*cdf)(double));
 /* float user inverse CDF spline */
 float LRf_uinvcdf_RAN(LR_obj *o);
 float LRf_uinvcdf_PDF(LR_obj *o, float x);
 float LRf_uinvcdf_CDF(LR_obj *o, float x);
+float LRf_uinvcdf_QUANT(LR_obj *o, float u);
 int LRf_uinvcdf(LR_obj *o, float (*cdf)(float));
 
 /* double negative exponential */
 double LRd_nexp_RAN(LR_obj *o);
+int LRd_nexp_RAN_n(LR_obj *o, double *x, long n);
 double LRd_nexp_PDF(LR_obj *o, double x);
 double LRd_nexp_CDF(LR_obj *o, double x);
+double LRd_nexp_QUANT(LR_obj *o, double u);
 /* float negative exponential */
 float LRf_nexp_RAN(LR_obj *o);
+int LRf_nexp_RAN_n(LR_obj *o, float *x, long n);
 float LRf_nexp_PDF(LR_obj *o, float x);
 float LRf_nexp_CDF(LR_obj *o, float x);
+float LRf_nexp_QUANT(LR_obj *o, float u);
 
 /* double Erlang */
 double LRd_erlang_RAN(LR_obj *o);
 double LRd_erlang_PDF(LR_obj *o, double x);
 double LRd_erlang_CDF(LR_obj *o, double x);
+double LRd_erlang_QUANT(LR_obj *o, double u);
 /* float Erlang */
 float LRf_erlang_RAN(LR_obj *o);
 float LRf_erlang_PDF(LR_obj *o, float x);
 float LRf_erlang_CDF(LR_obj *o, float x);
+float LRf_erlang_QUANT(LR_obj *o, float u);
 
 /* double gaussian */
 double LRd_gausbm_RAN(LR_obj *o);
+int LRd_gausbm_RAN_n(LR_obj *o, double *x, long n);
 double LRd_gausmar_RAN(LR_obj *o);
 double LRd_gaus_PDF(LR_obj *o, double x);
 double LRd_gaus_CDF(LR_obj *o, double x);
+double LRd_gaus_QUANT(LR_obj *o, double u);
 /* float gaussian */
 float LRf_gausbm_RAN(LR_obj *o);
+int LRf_gausbm_RAN_n(LR_obj *o, float *x, long n);
 float LRf_gausmar_RAN(LR_obj *o);
 float LRf_gaus_PDF(LR_obj *o, float x);
 float LRf_gaus_CDF(LR_obj *o, float x);
+float LRf_gaus_QUANT(LR_obj *o, float u);
 
 /* double gsn2 */
 double LRd_gsn2_RAN(LR_obj *o);
+int LRd_gsn2_RAN_n(LR_obj *o, double *x, long n);
 double LRd_gsn2_PDF(LR_obj *o, double x);
 double LRd_gsn2_CDF(LR_obj *o, double x);
+double LRd_gsn2_QUANT(LR_obj *o, double u);
 /* float gsn2 */
 float LRf_gsn2_RAN(LR_obj *o);
+int LRf_gsn2_RAN_n(LR_obj *o, float *x, long n);
 float LRf_gsn2_PDF(LR_obj *o, float x);
 float LRf_gsn2_CDF(LR_obj *o, float x);
+float LRf_gsn2_QUANT(LR_obj *o, float u);
 
 /* double gsn4 */
 double LRd_gsn4_RAN(LR_obj *o);
+int LRd_gsn4_RAN_n(LR_obj *o, double *x, long n);
 double LRd_gsn4_PDF(LR_obj *o, double x);
 double LRd_gsn4_CDF(LR_obj *o, double x);
+double LRd_gsn4_QUANT(LR_obj *o, double u);
 /* float gsn4 */
 float LRf_gsn4_RAN(LR_obj *o);
+int LRf_gsn4_RAN_n(LR_obj *o, float *x, long n);
 float LRf_gsn4_PDF(LR_obj *o, float x);
 float LRf_gsn4_CDF(LR_obj *o, float x);
+float LRf_gsn4_QUANT(LR_obj *o, float u);
 
 /* double gsn12 */
 double LRd_gsn12_RAN(LR_obj *o);
+int LRd_gsn12_RAN_n(LR_obj *o, double *x, long n);
 double LRd_gsn12_PDF(LR_obj *o, double x);
 double LRd_gsn12_CDF(LR_obj *o, double x);
+double LRd_gsn12_QUANT(LR_obj *o, double u);
 double LRd_xgsn12_PDF(LR_obj *o, double x);
 double LRd_xgsn12_CDF(LR_obj *o, double x);
 /* float gsn12 */
 float LRf_gsn12_RAN(LR_obj *o);
+int LRf_gsn12_RAN_n(LR_obj *o, float *x, long n);
 float LRf_gsn12_PDF(LR_obj *o, float x);
 float LRf_gsn12_CDF(LR_obj *o, float x);
+float LRf_gsn12_QUANT(LR_obj *o, float u);
+
+/* the largest gsnN order */
+#  define LR_GSN_MAX	24
+/* double gsnN */
+double LRd_gsnN_RAN(LR_obj *o);
+int LRd_gsnN_RAN_n(LR_obj *o, double *x, long n);
+double LRd_gsnN_PDF(LR_obj *o, double x);
+double LRd_gsnN_CDF(LR_obj *o, double x);
+double LRd_gsnN_QUANT(LR_obj *o, double u);
+/* float gsnN */
+float LRf_gsnN_RAN(LR_obj *o);
+int LRf_gsnN_RAN_n(LR_obj *o, float *x, long n);
+float LRf_gsnN_PDF(LR_obj *o, float x);
+float LRf_gsnN_CDF(LR_obj *o, float x);
+float LRf_gsnN_QUANT(LR_obj *o, float u);
 
 /* double cauchy */
 double LRd_cauchy_RAN(LR_obj *o);
+int LRd_cauchy_RAN_n(LR_obj *o, double *x, long n);
 double LRd_cauchymar_RAN(LR_obj *o);
 double LRd_cauchy_PDF(LR_obj *o, double x);
 double LRd_cauchy_CDF(LR_obj *o, double x);
+double LRd_cauchy_QUANT(LR_obj *o, double u);
 /* float cauchy */
 float LRf_cauchy_RAN(LR_obj *o);
+int LRf_cauchy_RAN_n(LR_obj *o, float *x, long n);
 float LRf_cauchymar_RAN(LR_obj *o);
 float LRf_cauchy_PDF(LR_obj *o, float x);
 float LRf_cauchy_CDF(LR_obj *o, float x);
+float LRf_cauchy_QUANT(LR_obj *o, float u);
 
 /* Poisson */
 int LRi_poisson_RAN(LR_obj *o);
 float LRi_poisson_PDF(LR_obj *o, int x);
 float LRi_poisson_CDF(LR_obj *o, int x);
+int LRi_poisson_QUANT(LR_obj *o, float u);
 
 /* Geometric */
 int LRi_geometric_RAN(LR_obj *o);
 float LRi_geometric_PDF(LR_obj *o, int x);
 float LRi_geometric_CDF(LR_obj *o, int x);
+int LRi_geometric_QUANT(LR_obj *o, float u);
+
+/* int logd */
+int LRi_logd_RAN(LR_obj *o);
+float LRi_logd_PDF(LR_obj *o, int x);
+float LRi_logd_CDF(LR_obj *o, int x);
+int LRi_logd_QUANT(LR_obj *o, float u);
 
 /* Binomial */
 int LRi_binomial_RAN(LR_obj *o);
 float LRi_binomial_PDF(LR_obj *o, int x);
 float LRi_binomial_CDF(LR_obj *o, int x);
+int LRi_binomial_QUANT(LR_obj *o, float u);
 
 #  ifdef __cplusplus
 }
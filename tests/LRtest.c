@@ -1,5 +1,10 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <limits.h>
 #include <math.h>
+#include <pthread.h>
 #include "libran.h"
 #include "urand/urand.h"
 #include <CUnit/CUnit.h>
@@ -48,7 +53,9 @@ void test_LR_errors(void) {
 0x17,	"LRerr_InvalidRange : LibRan - Invalid Range Value Error\n",
 0x19,	"LRerr_UnmetPreconditions : LibRan - Preconditions Not Performed\n",
 0x1B,	"LRerr_SuspiciousValues : LibRan - Suspicious Value - Normalization Error?\n",
-0x1D,	"LRerr_AllocFail : LibRan - Memory Allocation Error\n"};
+0x1D,	"LRerr_AllocFail : LibRan - Memory Allocation Error\n",
+0x21,	"LRerr_InvalidCDF : LibRan - Invalid CDF Function\n",
+0x23,	"LRerr_SharedObject : LibRan - Shared Object is Read-Only\n"};
 
 /* capture stderr to file */
 	newstderr = stderr = tmpfile();
@@ -108,6 +115,8 @@ void test_LR_version(void) {
 	CU_ASSERT_PTR_EQUAL(o->uf, LR_frand);				\
 	CU_ASSERT_PTR_EQUAL(o->ud, LR_drand);				\
 	CU_ASSERT_EQUAL(sizeof (*o), sizeof (LR_obj));			\
+	CU_ASSERT_EQUAL(((size_t) o) % LR_CACHELINE, 0);		\
+	CU_ASSERT_STRING_EQUAL(o->ops->type, "gausbm");			\
 	LR_rm(&o);							\
 	CU_ASSERT_PTR_NULL(o);						\
 }
@@ -117,6 +126,29 @@ testLRnew(float)
 testLRnew(long)
 testLRnew(double)
 
+/* RAN attributes are in the first cache line, and objects don't share one */
+void test_LR_layout(void) {
+	LR_obj	objs[2];
+	LR_obj	*o = LR_new(unif, LR_double), *p = LR_new(unif, LR_float);
+
+	CU_ASSERT_EQUAL(sizeof(LR_obj) % LR_CACHELINE, 0);
+	CU_ASSERT_EQUAL(LR_obj_size(), sizeof(LR_obj));
+	CU_ASSERT(offsetof(LR_obj, ops) + sizeof(objs[0].ops) <= LR_CACHELINE);
+	CU_ASSERT(offsetof(LR_obj, iy) + sizeof(objs[0].iy) <= LR_CACHELINE);
+	CU_ASSERT(offsetof(LR_obj, uf) + sizeof(objs[0].uf) <= LR_CACHELINE);
+	CU_ASSERT(offsetof(LR_obj, ud) + sizeof(objs[0].ud) <= LR_CACHELINE);
+	CU_ASSERT(offsetof(LR_obj, rc) + sizeof(objs[0].rc) <= LR_CACHELINE);
+	CU_ASSERT(offsetof(LR_obj, x) + sizeof(objs[0].x) <= LR_CACHELINE);
+	CU_ASSERT(offsetof(LR_obj, d) + sizeof(objs[0].d) <= LR_CACHELINE);
+	CU_ASSERT(offsetof(LR_obj, k) + sizeof(objs[0].k) <= LR_CACHELINE);
+	CU_ASSERT_EQUAL(((size_t) &objs[1]) % LR_CACHELINE, 0);
+	/* dispatch table is shared per type */
+	CU_ASSERT_PTR_EQUAL(o->ops, p->ops);
+	CU_ASSERT_STRING_EQUAL(o->ops->type, "unif");
+	LR_rm(&o);
+	LR_rm(&p);
+}
+
 /* test when individual parameters are set */
 #define testLRset(tt, ptt, att)		void test_set_##tt(void) {	\
 	LR_obj *o = LR_new(gausbm, LR_##tt);				\
@@ -306,6 +338,48 @@ testLRcheck(8, uinvcdf, f, float,
 	CU_ASSERT_EQUAL(LR_check(o), LRerr_InvalidRange);
 )
 
+/* freeze - derived constants follow the attributes */
+testLRcheck(10, gausbm, d, double, 
+	LR_set_all(o, "ms", 1.0,-2.0);
+	CU_ASSERT_EQUAL(LR_freeze(o), LRerr_OK);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_PDF(o, 1.0), .5*M_2_SQRTPI*M_SQRT1_2/2.,1e-12);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_CDF(o, 1.0), .5, 1e-12);
+	LR_set(o, 's', 4.0);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_PDF(o, 1.0), .5*M_2_SQRTPI*M_SQRT1_2/4.,1e-12);
+)
+testLRcheck(11, nexp, d, double, 
+	LR_set(o, 'm', -2.0);
+	CU_ASSERT_EQUAL(LR_freeze(o), LRerr_OK);
+	CU_ASSERT_EQUAL(o->m.d, 2.0);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_CDF(o, 2.0), 1. - exp(-1.), 1e-12);
+	LR_set(o, 'm', 4.0);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_CDF(o, 2.0), 1. - exp(-.5), 1e-12);
+)
+testLRcheck(12, cauchy, d, double, 
+	LR_set_all(o, "ms", 1.0, -2.0);
+	CU_ASSERT_EQUAL(LR_freeze(o), LRerr_OK);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_PDF(o, 1.0), M_1_PI/2., 1e-12);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_CDF(o, 3.0), .75, 1e-12);
+)
+testLRcheck(10, gsn2, f, float, 
+	LR_set_all(o, "ab", 3.0, -1.0);
+	CU_ASSERT_EQUAL(LR_freeze(o), LRerr_OK);
+	CU_ASSERT_DOUBLE_EQUAL(LRf_PDF(o, 1.0), .5, 1e-6);
+	CU_ASSERT_DOUBLE_EQUAL(LRf_CDF(o, 1.0), .5, 1e-6);
+	LR_set(o, 'b', 1.0);
+	CU_ASSERT_DOUBLE_EQUAL(LRf_PDF(o, 0.0), 1., 1e-6);
+)
+testLRcheck(10, poisson, i, int, 
+	CU_ASSERT_EQUAL(LR_freeze(o), LRerr_OK);
+	CU_ASSERT_DOUBLE_EQUAL(LRi_PDF(o, 0), exp(-1.), 1e-6);
+	LR_set(o, 'p', 2.0);
+	CU_ASSERT_DOUBLE_EQUAL(LRi_PDF(o, 0), exp(-2.), 1e-6);
+)
+testLRcheck(11, poisson, i, int, 
+	LR_set(o, 'p', 0.0);
+	CU_ASSERT_EQUAL(LR_freeze(o), LRerr_InvalidInputValue);
+)
+
 /* independent pseudo-random sequences */
 #define testLRindep(dist, nn, num, incr, setup)				\
 void test_indep_seq_##nn(void) {					\
@@ -338,6 +412,267 @@ testLRindep(gsn2, 6, 10, 5000,
 	LR_lsetseed(o2, 19580512l);
 )
 
+/* thread safety
+ * each thread owns its LR_obj for RAN, while all threads query one
+ * shared LR_obj for PDF/CDF (which must not modify the object) */
+#define NTHREADS	4
+
+#define testLRthread(dist,nn,tt,ttt,xlo,xhi,num,setup)			\
+typedef struct {							\
+	long	seed;							\
+	double	ran, pdf, cdf;						\
+	LR_obj	*shared;						\
+} thr_##dist##_##nn;							\
+static void thr_work_##dist##_##nn(thr_##dist##_##nn *a) {		\
+	LR_obj *o = LR_new(dist, LR_##ttt);				\
+	setup;								\
+	LR_lsetseed(o, a->seed);					\
+	a->ran = a->pdf = a->cdf = 0.0;					\
+	for (int i = 0; i < num; i++) {					\
+		ttt x = (ttt) (xlo + (xhi - xlo)*((double) i)/num);	\
+		a->ran += LR##tt##_RAN(o);				\
+		a->pdf += LR##tt##_PDF(a->shared, x);			\
+		a->cdf += LR##tt##_CDF(a->shared, x);			\
+	}								\
+	LR_rm(&o);							\
+}									\
+static void *thr_run_##dist##_##nn(void *arg) {				\
+	thr_work_##dist##_##nn((thr_##dist##_##nn *) arg);		\
+	return NULL;							\
+}									\
+void test_thread_##dist##_##nn(void) {					\
+	pthread_t		th[NTHREADS];				\
+	thr_##dist##_##nn	par[NTHREADS], seq[NTHREADS];		\
+	LR_obj *o = LR_new(dist, LR_##ttt);				\
+	setup;								\
+	CU_ASSERT_EQUAL(LR_check(o), LRerr_OK);				\
+	for (int i = 0; i < NTHREADS; i++) {				\
+		par[i].seed = seq[i].seed = 19580512l + 2*i;		\
+		par[i].shared = seq[i].shared = o;			\
+	}								\
+	for (int i = 0; i < NTHREADS; i++)				\
+		CU_ASSERT_EQUAL(pthread_create(&th[i], NULL,		\
+			thr_run_##dist##_##nn, &par[i]), 0);		\
+	for (int i = 0; i < NTHREADS; i++)				\
+		CU_ASSERT_EQUAL(pthread_join(th[i], NULL), 0);		\
+	/* the same work done serially must give identical results */	\
+	for (int i = 0; i < NTHREADS; i++) {				\
+		thr_work_##dist##_##nn(&seq[i]);			\
+		CU_ASSERT_EQUAL(par[i].ran, seq[i].ran);		\
+		CU_ASSERT_EQUAL(par[i].pdf, seq[i].pdf);		\
+		CU_ASSERT_EQUAL(par[i].cdf, seq[i].cdf);		\
+	}								\
+	CU_ASSERT_NOT_EQUAL(par[0].ran, par[1].ran);			\
+	LR_rm(&o);							\
+}
+
+testLRthread(unif,    1, d, double, -.5,  1.5, 20000, )
+testLRthread(gausbm,  2, d, double, -4.,  4.,  20000, )
+testLRthread(gausmar, 3, f, float,  -4.,  4.,  20000, )
+testLRthread(gsn4,    4, d, double, -2.5, 2.5, 20000, )
+testLRthread(gsn12,   5, f, float,  -7.,  7.,  20000, )
+testLRthread(nexp,    6, d, double, -1.,  8.,  20000,
+	LR_set(o, 'm', 2.0); )
+testLRthread(erlang,  7, f, float,  -1.,  8.,  20000,
+	LR_set_all(o, "km", 3, 1.5); )
+testLRthread(poisson, 8, i, int,    -1.,  12., 20000,
+	LR_set(o, 'p', 3.5); )
+testLRthread(geometric, 9, i, int,  -1.,  12., 20000,
+	LR_set(o, 'p', .35); )
+testLRthread(binomial,10, i, int,   -1.,  12., 20000,
+	LR_set_all(o, "np", 10, .35); )
+double MyCDFc(double x);
+testLRthread(uinvcdf, 11, d, double, -4., 5., 2000,
+	LRd_uinvcdf(o, MyCDFc);
+	LR_set_all(o, "ms", .5, 1.); )
+
+/* per-thread streams sharing one read-only spec */
+#define testLRspec(dist,nn,tt,ttt,xlo,xhi,num,setup)			\
+typedef struct {							\
+	long	seed;							\
+	double	ran, pdf, cdf;						\
+	LR_spec	*spec;							\
+} spc_##dist##_##nn;							\
+static void *spc_run_##dist##_##nn(void *arg) {				\
+	spc_##dist##_##nn *a = (spc_##dist##_##nn *) arg;		\
+	LR_obj *o = LR_stream_new(a->spec);				\
+	LR_lsetseed(o, a->seed);					\
+	a->ran = a->pdf = a->cdf = 0.0;					\
+	for (int i = 0; i < num; i++) {					\
+		ttt x = (ttt) (xlo + (xhi - xlo)*((double) i)/num);	\
+		a->ran += LR##tt##_RAN(o);				\
+		a->pdf += LR##tt##_PDF(o, x);				\
+		a->cdf += LR##tt##_CDF(o, x);				\
+	}								\
+	LR_rm(&o);							\
+	return NULL;							\
+}									\
+void test_spec_##dist##_##nn(void) {					\
+	pthread_t		th[NTHREADS];				\
+	spc_##dist##_##nn	par[NTHREADS];				\
+	LR_spec *spec;							\
+	LR_obj *s1, *s2, *o = LR_new(dist, LR_##ttt);			\
+	setup;								\
+	CU_ASSERT_PTR_NOT_NULL(spec = LR_spec_new(&o));		\
+	CU_ASSERT_PTR_NULL(o);						\
+	CU_ASSERT_EQUAL(spec->refs, 1);					\
+	/* streams share the aux object and can't change it */		\
+	s1 = LR_stream_new(spec);					\
+	s2 = LR_stream_new(spec);					\
+	CU_ASSERT_EQUAL(spec->refs, 3);					\
+	CU_ASSERT_PTR_EQUAL(s1->aux, s2->aux);				\
+	CU_ASSERT_PTR_EQUAL(s1->aux, spec->o->aux);			\
+	CU_ASSERT_EQUAL(LR_set(s1, 'x', 1.), LRerr_SharedObject);	\
+	CU_ASSERT_EQUAL(s1->errno, LRerr_SharedObject);			\
+	if (s1->t == piece || s1->t == lspline) {			\
+		CU_ASSERT_EQUAL(LR_aux_set(s2, 1., 1.), LRerr_SharedObject);\
+		CU_ASSERT_EQUAL(LR_aux_rm(s2), LRerr_SharedObject);	\
+	}								\
+	LR_rm(&s1);							\
+	CU_ASSERT_PTR_NULL(s1);						\
+	CU_ASSERT_EQUAL(spec->refs, 2);					\
+	for (int i = 0; i < NTHREADS; i++) {				\
+		par[i].seed = 19580512l + 2*i;				\
+		par[i].spec = spec;					\
+	}								\
+	for (int i = 0; i < NTHREADS; i++)				\
+		CU_ASSERT_EQUAL(pthread_create(&th[i], NULL,		\
+			spc_run_##dist##_##nn, &par[i]), 0);		\
+	for (int i = 0; i < NTHREADS; i++)				\
+		CU_ASSERT_EQUAL(pthread_join(th[i], NULL), 0);		\
+	CU_ASSERT_EQUAL(spec->refs, 2);					\
+	/* each stream must match a stand-alone object */		\
+	for (int i = 0; i < NTHREADS; i++) {				\
+		double ran = 0.0, pdf = 0.0, cdf = 0.0;			\
+		o = LR_new(dist, LR_##ttt);				\
+		setup;							\
+		LR_lsetseed(o, par[i].seed);				\
+		for (int j = 0; j < num; j++) {				\
+			ttt x = (ttt) (xlo + (xhi - xlo)*((double) j)/num);\
+			ran += LR##tt##_RAN(o);				\
+			pdf += LR##tt##_PDF(o, x);			\
+			cdf += LR##tt##_CDF(o, x);			\
+		}							\
+		CU_ASSERT_EQUAL(par[i].ran, ran);			\
+		CU_ASSERT_EQUAL(par[i].pdf, pdf);			\
+		CU_ASSERT_EQUAL(par[i].cdf, cdf);			\
+		if (o->t == piece || o->t == lspline)			\
+			LR_aux_rm(o);					\
+		LR_rm(&o);						\
+	}								\
+	/* the spec lives on until the last reference is gone */	\
+	CU_ASSERT_EQUAL(LR_spec_rm(&spec), LRerr_OK);			\
+	CU_ASSERT_PTR_NULL(spec);					\
+	CU_ASSERT_EQUAL(s2->spec->refs, 1);				\
+	CU_ASSERT(isfinite(LR##tt##_RAN(s2)));				\
+	LR_rm(&s2);							\
+}
+
+testLRspec(piece,   1, d, double, -3., 7., 20000,
+	LR_aux_new(o,6);
+	LR_set_all(o,"abx", -2., 6., 4.);
+	LR_aux_set(o, o->a.d + 2.0, 1.0);
+	LR_aux_set(o, o->a.d + 3.0, 3.0);
+	LR_aux_set(o, o->a.d + 4.0, 0.0);
+	LR_aux_set(o, o->a.d + 5.0, 5.0);
+	LR_aux_set(o, o->a.d + 7.0, 2.0);
+	LR_aux_norm(o); )
+testLRspec(lspline, 2, f, float,  -3., 7., 20000,
+	LR_aux_new(o,6);
+	LR_set_all(o,"abx", -2., 6., 0.);
+	LR_aux_set(o, o->a.f + 2.0, 1.0);
+	LR_aux_set(o, o->a.f + 3.0, 3.0);
+	LR_aux_set(o, o->a.f + 4.0, 0.0);
+	LR_aux_set(o, o->a.f + 5.0, 5.0);
+	LR_aux_set(o, o->a.f + 7.0, 2.0);
+	LR_aux_norm(o); )
+testLRspec(gausbm,  3, d, double, -4., 4., 20000,
+	LR_set_all(o, "ms", 1., 2.); )
+testLRspec(uinvcdf, 4, d, double, -4., 5., 2000,
+	LRd_uinvcdf(o, MyCDFc);
+	LR_set_all(o, "ms", .5, 1.); )
+
+/* arena & in-place objects must act like the heap ones */
+#define PIECESETUP(o)							\
+	LR_aux_new(o,6);						\
+	LR_set_all(o,"abx", -2., 6., 4.);				\
+	LR_aux_set(o, o->a.d + 2.0, 1.0);				\
+	LR_aux_set(o, o->a.d + 3.0, 3.0);				\
+	LR_aux_set(o, o->a.d + 4.0, 0.0);				\
+	LR_aux_set(o, o->a.d + 5.0, 5.0);				\
+	LR_aux_set(o, o->a.d + 7.0, 2.0);				\
+	LR_aux_norm(o);
+
+void test_LR_arena(void) {
+	LR_arena *a = LR_arena_new(1024);
+	LR_obj *o[100], *h = LR_new(piece, LR_double), *g;
+	double	x;
+
+	CU_ASSERT_PTR_NOT_NULL(a);
+	PIECESETUP(h)
+	for (int k = 0; k < 2; k++) {
+		for (int i = 0; i < 100; i++) {
+			o[i] = LR_new_in(a, (i % 2 ? piece : gausbm), LR_double);
+			CU_ASSERT_PTR_NOT_NULL(o[i]);
+			CU_ASSERT_EQUAL(((size_t) o[i]) % LR_CACHELINE, 0);
+			CU_ASSERT_EQUAL(o[i]->flags & ~LR_OBJ_FAST, LR_OBJ_ARENA);
+			if (i % 2) {
+				PIECESETUP(o[i])
+				CU_ASSERT_PTR_EQUAL(((LR_pcs *) o[i]->aux)->arena, a);
+			}
+			LR_lsetseed(o[i], 19580512l + i);
+		}
+		/* small blocks - so several of them */
+		CU_ASSERT_PTR_NOT_NULL(*((void **) a->blk));
+		LR_lsetseed(h, 19580512l + 99);
+		for (int j = 0; j < 1000; j++) {
+			x = LRd_RAN(h);
+			CU_ASSERT_EQUAL(LRd_RAN(o[99]), x);
+			CU_ASSERT_EQUAL(LRd_PDF(o[99], x), LRd_PDF(h, x));
+			CU_ASSERT_EQUAL(LRd_CDF(o[99], x), LRd_CDF(h, x));
+		}
+		g = o[98];
+		CU_ASSERT_EQUAL(LR_rm(&g), LRerr_OK);
+		CU_ASSERT_PTR_NULL(g);
+		CU_ASSERT(isfinite(LRd_RAN(o[98])));
+		/* drop them all */
+		CU_ASSERT_EQUAL(LR_arena_reset(a), LRerr_OK);
+		CU_ASSERT_PTR_NULL(*((void **) a->blk));
+	}
+	LR_aux_rm(h);
+	LR_rm(&h);
+	CU_ASSERT_EQUAL(LR_arena_rm(&a), LRerr_OK);
+	CU_ASSERT_PTR_NULL(a);
+}
+
+void test_LR_init(void) {
+	LR_obj	objs[2], *p = &objs[1], *h = LR_new(piece, LR_double);
+	double	x;
+
+	CU_ASSERT_EQUAL(LR_init(&objs[0], unif, LR_double), LRerr_OK);
+	CU_ASSERT_EQUAL(LR_init(p, piece, LR_double), LRerr_OK);
+	CU_ASSERT_EQUAL(objs[0].flags & ~LR_OBJ_FAST, LR_OBJ_INPLACE);
+	CU_ASSERT_STRING_EQUAL(objs[0].ops->type, "unif");
+	PIECESETUP(p)
+	PIECESETUP(h)
+	LR_lsetseed(p, 19580512l);
+	LR_lsetseed(h, 19580512l);
+	for (int j = 0; j < 1000; j++) {
+		x = LRd_RAN(h);
+		CU_ASSERT_EQUAL(LRd_RAN(p), x);
+		CU_ASSERT_EQUAL(LRd_CDF(p, x), LRd_CDF(h, x));
+	}
+	CU_ASSERT_EQUAL(LR_init(&objs[0], nexp, LR_int), LRerr_BadDataType);
+	CU_ASSERT_EQUAL(objs[0].errno, LRerr_BadDataType);
+	CU_ASSERT_EQUAL(LR_init(&objs[0], -1, LR_double), LRerr_BadLRType);
+	/* releases the aux tables, not the storage */
+	CU_ASSERT_EQUAL(LR_rm(&p), LRerr_OK);
+	CU_ASSERT_PTR_NULL(p);
+	CU_ASSERT_PTR_NULL(objs[1].aux);
+	CU_ASSERT_EQUAL(LR_rm(&p), LRerr_Unspecified);
+	LR_rm(&h);
+}
+
 /* binning object */
 #define testLRbinnew(tt)		void test_bin_new_##tt(void) {	\
 	LR_bin *b = LR_bin_new(10);					\
@@ -398,6 +733,1431 @@ testLRbinadd(2,30)
 testLRbinadd(3,50)
 testLRbinadd(4,100)
 
+/* equal width bins must tally the same as the boundary search */
+#define testLRbinunif(tn,nb,lo,hi)	void test_bin_unif_##tn(void) {	\
+	LR_bin *u = LR_bin_new_uniform(nb, lo, hi), *b = LR_bin_new(nb+2);\
+	LR_obj *o = LR_new(unif, LR_double);				\
+	double	x;							\
+	CU_ASSERT_PTR_NOT_NULL(u);					\
+	CU_ASSERT_EQUAL(u->nn, nb+2);					\
+	for (int i = 0; i <= nb; i++) {					\
+		CU_ASSERT_EQUAL(LR_bin_set(b, u->bdrs[i]),0);		\
+	}								\
+	CU_ASSERT_EQUAL(LR_bin_set(u, lo),LRerr_TooManyValues);		\
+	LR_set_all(o, "ab", lo - 1., hi + 1.);				\
+	for (int i = 0; i < 20000; i++) {				\
+		x = LRd_RAN(o);						\
+		CU_ASSERT_EQUAL(LR_bin_add(u, x),0);			\
+		CU_ASSERT_EQUAL(LR_bin_add(b, x),0);			\
+	}								\
+	/* exactly on the boundaries, and just below */		\
+	for (int i = 0; i <= nb; i++) {					\
+		LR_bin_add(u, u->bdrs[i]);				\
+		LR_bin_add(b, u->bdrs[i]);				\
+		LR_bin_add(u, nextafter(u->bdrs[i], -INFINITY));	\
+		LR_bin_add(b, nextafter(u->bdrs[i], -INFINITY));	\
+	}								\
+	LR_bin_add(u, -INFINITY); LR_bin_add(b, -INFINITY);		\
+	LR_bin_add(u,  INFINITY); LR_bin_add(b,  INFINITY);		\
+	CU_ASSERT_EQUAL(LR_bin_add(u, NAN),LRerr_InvalidInputValue);	\
+	CU_ASSERT_EQUAL(u->c, b->c);					\
+	for (int i = 0; i < nb+2; i++) {				\
+		CU_ASSERT_EQUAL(u->bins[i], b->bins[i]);		\
+	}								\
+	CU_ASSERT(u->bins[0] > 0);					\
+	CU_ASSERT(u->bins[nb+1] > 0);					\
+	LR_bin_rm(&u);							\
+	LR_bin_rm(&b);							\
+	LR_rm(&o);							\
+}
+
+testLRbinunif(1,1,0.,1.)
+testLRbinunif(2,10,-1.,2.)
+testLRbinunif(3,1000,.1,.7)
+testLRbinunif(4,7,-3.3,11.1)
+
+/* batch binning must give exactly the one-at-a-time results */
+#define testLRbinaddn(tn,nb,nx,uni)	void test_bin_add_n_##tn(void) {\
+	LR_bin *b1, *b2;						\
+	LR_obj *o = LR_new(gausbm, LR_double);				\
+	double	*x = (double *) malloc(nx * sizeof(double));		\
+	int	r1 = 0;							\
+	if (uni) {							\
+		b1 = LR_bin_new_uniform(nb, -2., 2.);			\
+		b2 = LR_bin_new_uniform(nb, -2., 2.);			\
+	} else {							\
+		b1 = LR_bin_new(nb+2);					\
+		b2 = LR_bin_new(nb+2);					\
+		for (int i = 0; i <= nb; i++) {				\
+			LR_bin_set(b1, -2. + (4.*i*i)/(nb*nb));		\
+			LR_bin_set(b2, -2. + (4.*i*i)/(nb*nb));		\
+		}							\
+	}								\
+	for (int i = 0; i < nx; i++)					\
+		x[i] = LRd_RAN(o);					\
+	/* some NaNs, infinities, and boundary values */		\
+	for (int i = 0; i < nx; i += 97)				\
+		x[i] = NAN;						\
+	for (int i = 5; i < nx; i += 101)				\
+		x[i] = (i % 2 ? INFINITY : -INFINITY);			\
+	for (int i = 7; i < nx; i += 13)				\
+		x[i] = b1->bdrs[(i/13) % (nb+1)];			\
+	for (int i = 0; i < nx; i++)					\
+		if (LR_bin_add(b1, x[i])) r1 = b1->errno;		\
+	CU_ASSERT_EQUAL(LR_bin_add_n(b2, x, nx), r1);			\
+	CU_ASSERT_EQUAL(b2->errno, b1->errno);				\
+	CU_ASSERT_EQUAL(b2->c, b1->c);					\
+	for (int i = 0; i < nb+2; i++) {				\
+		CU_ASSERT_EQUAL(b2->bins[i], b1->bins[i]);		\
+	}								\
+	/* and it accumulates */					\
+	CU_ASSERT_EQUAL(LR_bin_add_n(b2, x + 1, 96), LRerr_OK);		\
+	CU_ASSERT_EQUAL(b2->c, b1->c + 96);				\
+	free(x);							\
+	LR_bin_rm(&b1);							\
+	LR_bin_rm(&b2);							\
+	LR_rm(&o);							\
+}
+
+testLRbinaddn(1, 10, 10007, 1)
+testLRbinaddn(2, 10, 10007, 0)
+testLRbinaddn(3, 1, 300, 1)
+testLRbinaddn(4, 1, 300, 0)
+testLRbinaddn(5, 500, 100000, 1)
+testLRbinaddn(6, 333, 100000, 0)
+
+/* per-thread bins merged, or shared atomic bins, match a serial tally */
+typedef struct {
+	long	seed;
+	int	batch;
+	LR_bin	*b;
+} bin_thr;
+static void *bin_thr_run(void *arg) {
+	bin_thr	*a = (bin_thr *) arg;
+	LR_obj	*o = LR_new(gausbm, LR_double);
+	double	x[100];
+	LR_lsetseed(o, a->seed);
+	for (int i = 0; i < 200; i++) {
+		for (int j = 0; j < 100; j++)
+			x[j] = ((i + j) % 37 ? LRd_RAN(o) : NAN);
+		if (a->batch) {
+			LR_bin_add_n(a->b, x, 100);
+		} else {
+			for (int j = 0; j < 100; j++)
+				LR_bin_add(a->b, x[j]);
+		}
+	}
+	LR_rm(&o);
+	return NULL;
+}
+#define testLRbinmerge(tn,uni,atom,bat)				\
+void test_bin_merge_##tn(void) {					\
+	pthread_t	th[NTHREADS];					\
+	bin_thr		par[NTHREADS];					\
+	LR_bin	*tot, *ser, *b;						\
+	if (uni) {							\
+		tot = LR_bin_new_uniform(40, -3., 3.);			\
+	} else {							\
+		tot = LR_bin_new(22);					\
+		for (int i = 0; i <= 20; i++)				\
+			LR_bin_set(tot, -3. + .015*i*i);		\
+	}								\
+	ser = LR_bin_clone_empty(tot);					\
+	CU_ASSERT_PTR_NOT_NULL(ser);					\
+	CU_ASSERT_EQUAL(ser->nn, tot->nn);				\
+	CU_ASSERT_EQUAL(ser->c, 0);					\
+	for (int i = 0; i < tot->nn - 1; i++) {				\
+		CU_ASSERT_EQUAL(ser->bdrs[i], tot->bdrs[i]);		\
+	}								\
+	if (atom)							\
+		CU_ASSERT_EQUAL(LR_bin_atomic(tot, 1), LRerr_OK);	\
+	for (int i = 0; i < NTHREADS; i++) {				\
+		par[i].seed = 19580512l + 2*i;				\
+		par[i].batch = bat;					\
+		par[i].b = (atom ? tot : LR_bin_clone_empty(tot));	\
+	}								\
+	for (int i = 0; i < NTHREADS; i++)				\
+		CU_ASSERT_EQUAL(pthread_create(&th[i], NULL,		\
+			bin_thr_run, &par[i]), 0);			\
+	for (int i = 0; i < NTHREADS; i++)				\
+		CU_ASSERT_EQUAL(pthread_join(th[i], NULL), 0);		\
+	if (!atom) {							\
+		for (int i = 0; i < NTHREADS; i++) {			\
+			CU_ASSERT_EQUAL(LR_bin_merge(tot, par[i].b), 0);\
+			LR_bin_rm(&(par[i].b));				\
+		}							\
+	}								\
+	/* the same work serially into one */				\
+	for (int i = 0; i < NTHREADS; i++) {				\
+		par[i].b = ser;						\
+		bin_thr_run(&par[i]);					\
+	}								\
+	CU_ASSERT_EQUAL(tot->c, ser->c);				\
+	CU_ASSERT_EQUAL(tot->c, NTHREADS*(20000 - 534));		\
+	CU_ASSERT_EQUAL(ser->errno, LRerr_InvalidInputValue);		\
+	for (int i = 0; i < tot->nn; i++) {				\
+		CU_ASSERT_EQUAL(tot->bins[i], ser->bins[i]);		\
+	}								\
+	/* must have the same boundaries */				\
+	b = LR_bin_new_uniform(40, -3., 3.1);				\
+	CU_ASSERT_EQUAL(LR_bin_merge(ser, b), LRerr_InvalidRange);	\
+	LR_bin_rm(&b);							\
+	LR_bin_rm(&tot);						\
+	LR_bin_rm(&ser);						\
+}
+
+testLRbinmerge(1, 1, 0, 0)
+testLRbinmerge(2, 0, 0, 1)
+testLRbinmerge(3, 1, 1, 0)
+testLRbinmerge(4, 0, 1, 1)
+
+/* the bulk boundary constructors */
+void test_bin_new_array(void) {
+	double	bd[] = {3.3, -1., 4.5, 0., .5, .5};
+	int	nbd = sizeof(bd)/sizeof(bd[0]);
+	LR_bin	*a = LR_bin_new_array(bd, nbd), *b = LR_bin_new(nbd+1);
+	CU_ASSERT_PTR_NOT_NULL(a);
+	for (int i = 0; i < nbd; i++)
+		LR_bin_set(b, bd[i]);
+	CU_ASSERT_EQUAL(a->nn, b->nn);
+	for (int i = 0; i < nbd; i++) {
+		CU_ASSERT_EQUAL(a->bdrs[i], b->bdrs[i]);
+	}
+	/* the object is full */
+	CU_ASSERT_EQUAL(LR_bin_set(a, 1.), LRerr_TooManyValues);
+	for (int i = -20; i < 60; i++) {
+		LR_bin_add(a, .1*i);
+		LR_bin_add(b, .1*i);
+	}
+	for (int i = 0; i < nbd+1; i++) {
+		CU_ASSERT_EQUAL(a->bins[i], b->bins[i]);
+	}
+	LR_bin_rm(&a);
+	LR_bin_rm(&b);
+	a = LR_bin_new_array(bd, 0);
+	CU_ASSERT_EQUAL(a->nn, 1);
+	LR_bin_rm(&a);
+	bd[2] = NAN;
+	CU_ASSERT_PTR_NULL(LR_bin_new_array(bd, nbd));
+}
+
+void test_bin_new_log(void) {
+	LR_bin	*b = LR_bin_new_log(30, .01, 1e4);
+	CU_ASSERT_PTR_NOT_NULL(b);
+	CU_ASSERT_EQUAL(b->nn, 32);
+	CU_ASSERT_EQUAL(b->bdrs[0], .01);
+	CU_ASSERT_EQUAL(b->bdrs[30], 1e4);
+	/* 6 decades in 30 bins */
+	for (int i = 0; i <= 30; i += 5) {
+		CU_ASSERT_DOUBLE_EQUAL(b->bdrs[i], pow(10., -2. + i/5), 1e-12*b->bdrs[i]);
+	}
+	for (int i = 1; i <= 30; i++) {
+		CU_ASSERT_DOUBLE_EQUAL(b->bdrs[i]/b->bdrs[i-1], pow(10., .2), 1e-12);
+	}
+	LR_bin_add(b, .001);
+	LR_bin_add(b, .0101);
+	LR_bin_add(b, 9999.);
+	LR_bin_add(b, 1e4);
+	CU_ASSERT_EQUAL(b->bins[0], 1);
+	CU_ASSERT_EQUAL(b->bins[1], 1);
+	CU_ASSERT_EQUAL(b->bins[30], 1);
+	CU_ASSERT_EQUAL(b->bins[31], 1);
+	LR_bin_rm(&b);
+	CU_ASSERT_PTR_NULL(LR_bin_new_log(10, 0., 1.));
+	CU_ASSERT_PTR_NULL(LR_bin_new_log(10, 2., 1.));
+}
+
+void test_bin_new_geom(void) {
+	LR_bin	*b = LR_bin_new_geom(10, -1., .5, 2.);
+	CU_ASSERT_PTR_NOT_NULL(b);
+	CU_ASSERT_EQUAL(b->nn, 12);
+	for (int i = 0; i <= 10; i++) {
+		CU_ASSERT_DOUBLE_EQUAL(b->bdrs[i], -1. + .5*(pow(2., i) - 1.), 1e-12);
+	}
+	LR_bin_rm(&b);
+	/* r = 1 is uniform */
+	b = LR_bin_new_geom(8, 2., .25, 1.);
+	CU_ASSERT_EQUAL(b->nn, 10);
+	CU_ASSERT_NOT_EQUAL(b->w1, 0.);
+	CU_ASSERT_EQUAL(b->bdrs[8], 4.);
+	LR_bin_rm(&b);
+	CU_ASSERT_PTR_NULL(LR_bin_new_geom(10, 0., -1., 2.));
+	CU_ASSERT_PTR_NULL(LR_bin_new_geom(2000, 0., 1., 2.));
+}
+
+/* the equal probability boundaries are the quantiles */
+#define testLRbinquant(tn,tt,dt,nb,tol)				\
+void test_bin_new_quant_##tn(void) {					\
+	LR_obj	*o = LR_new(tt, LR_##dt);				\
+	LR_bin	*b;							\
+	LR_set_all(o, "ms", 3., 2.);					\
+	b = LR_bin_new_quantile(o, nb);					\
+	CU_ASSERT_PTR_NOT_NULL(b);					\
+	CU_ASSERT_EQUAL(b->nn, nb);					\
+	for (int i = 1; i < nb; i++) {					\
+		CU_ASSERT_DOUBLE_EQUAL(LR##dt##_CDF(o, b->bdrs[i-1]),	\
+			(double) i/nb, tol);				\
+		CU_ASSERT(b->bdrs[i-1] >= b->bdrs[i > 1 ? i-2 : 0]);	\
+	}								\
+	LR_bin_rm(&b);							\
+	LR_rm(&o);							\
+}
+
+#define LRdouble_CDF	LRd_CDF
+#define LRfloat_CDF	LRf_CDF
+testLRbinquant(1, gausbm, double, 10, 1e-14)
+testLRbinquant(2, gausbm, double, 100000, 1e-14)
+testLRbinquant(3, cauchy, double, 1000, 1e-14)
+testLRbinquant(4, nexp, double, 1000, 1e-14)
+testLRbinquant(5, gsn4, float, 100, 2e-6)
+testLRbinquant(6, unif, double, 7, 1e-14)
+
+void test_bin_new_quant_disc(void) {
+	LR_obj	*o = LR_new(poisson, LR_int);
+	LR_bin	*b;
+	LR_set(o, 'p', 7.5);
+	b = LR_bin_new_quantile(o, 20);
+	CU_ASSERT_PTR_NOT_NULL(b);
+	CU_ASSERT_EQUAL(b->nn, 20);
+	for (int i = 1; i < 20; i++) {
+		int k = (int) floor(b->bdrs[i-1]);
+		CU_ASSERT_EQUAL(b->bdrs[i-1], k + .5);
+		CU_ASSERT(LRi_CDF(o, k) >= (float) i/20);
+		CU_ASSERT(LRi_CDF(o, k - 1) < (float) i/20);
+	}
+	LR_bin_rm(&b);
+	LR_rm(&o);
+}
+
+/* binomial has a finite support, the boundaries must stay within it */
+#define testLRbinquantbinom(tn,nn,pp)					\
+void test_bin_new_quant_binom_##tn(void) {				\
+	LR_obj	*o = LR_new(binomial, LR_int);				\
+	LR_bin	*b;							\
+	LR_set_all(o, "np", nn, pp);					\
+	b = LR_bin_new_quantile(o, 20);					\
+	CU_ASSERT_PTR_NOT_NULL(b);					\
+	for (int i = 1; i < 20; i++) {					\
+		int k = (int) floor(b->bdrs[i-1]);			\
+		CU_ASSERT_EQUAL(b->bdrs[i-1], k + .5);			\
+		CU_ASSERT(k >= 0 && k <= nn);				\
+		CU_ASSERT(LRi_CDF(o, k) >= (float) i/20);		\
+		CU_ASSERT(LRi_CDF(o, k - 1) < (float) i/20);		\
+	}								\
+	LR_bin_rm(&b);							\
+	LR_rm(&o);							\
+}
+testLRbinquantbinom(1, 10, .999)
+testLRbinquantbinom(2, 1000, .999)
+testLRbinquantbinom(3, 100000, .999)
+testLRbinquantbinom(4, 1000000, .35)
+
+/* weighted tallies */
+#define testLRbinwt(tn,uni,nx)	void test_bin_weighted_##tn(void) {	\
+	LR_obj	*o = LR_new(gausbm, LR_double);				\
+	LR_bin	*b1 = (uni ? LR_bin_new_uniform(20, -2., 2.)		\
+			: LR_bin_new_quantile(o, 20)),			\
+		*b2 = LR_bin_clone_empty(b1), *b3 = LR_bin_clone_empty(b1);\
+	double	*x = (double *) malloc(nx*sizeof(double)),		\
+		*w = (double *) malloc(nx*sizeof(double));		\
+	LR_lsetseed(o, 19580512l);					\
+	for (int i = 0; i < nx; i++) {					\
+		x[i] = LRd_RAN(o);					\
+		w[i] = exp(-x[i]);					\
+	}								\
+	x[nx/2] = NAN;							\
+	w[nx/3] = INFINITY;						\
+	/* must be asked for */						\
+	CU_ASSERT_EQUAL(LR_bin_addw(b1, 0., 1.), LRerr_UnmetPreconditions);\
+	CU_ASSERT(isnan(LR_bin_sumw(b1, 0)));				\
+	CU_ASSERT_EQUAL(LR_bin_weighted(b1), LRerr_OK);			\
+	CU_ASSERT_EQUAL(LR_bin_weighted(b2), LRerr_OK);			\
+	CU_ASSERT_EQUAL(LR_bin_weighted(b3), LRerr_OK);			\
+	CU_ASSERT_EQUAL(LR_bin_atomic(b1, 1), LRerr_UnmetPreconditions);\
+	for (int i = 0; i < nx; i++)					\
+		LR_bin_addw(b1, x[i], w[i]);				\
+	CU_ASSERT_EQUAL(b1->errno, LRerr_InvalidInputValue);		\
+	CU_ASSERT_EQUAL(LR_bin_addw_n(b2, x, w, nx),			\
+		LRerr_InvalidInputValue);				\
+	CU_ASSERT_EQUAL(b1->c, nx - 2);					\
+	CU_ASSERT_EQUAL(b2->c, b1->c);					\
+	for (int i = 0; i < b1->nn; i++) {				\
+		CU_ASSERT_EQUAL(b2->bins[i], b1->bins[i]);		\
+		CU_ASSERT_EQUAL(LR_bin_sumw(b2, i), LR_bin_sumw(b1, i));\
+		CU_ASSERT_EQUAL(LR_bin_var(b2, i), LR_bin_var(b1, i));	\
+		CU_ASSERT(LR_bin_ess(b1, i) <= b1->bins[i] + 1e-9);	\
+	}								\
+	/* in two halves merged */					\
+	LR_bin_addw_n(b3, x, w, nx/2);					\
+	b1 = (LR_bin_rm(&b1), LR_bin_clone_empty(b3));			\
+	CU_ASSERT_EQUAL(b1->flags & LR_BIN_WEIGHTED, LR_BIN_WEIGHTED);	\
+	LR_bin_addw_n(b1, x + nx/2, w + nx/2, nx - nx/2);		\
+	CU_ASSERT_EQUAL(LR_bin_merge(b3, b1), LRerr_OK);		\
+	CU_ASSERT_EQUAL(b3->c, b2->c);					\
+	for (int i = 0; i < b1->nn; i++) {				\
+		CU_ASSERT_EQUAL(b3->bins[i], b2->bins[i]);		\
+		CU_ASSERT_DOUBLE_EQUAL(LR_bin_sumw(b3, i),		\
+			LR_bin_sumw(b2, i), 1e-12*LR_bin_sumw(b2, i));	\
+		CU_ASSERT_DOUBLE_EQUAL(LR_bin_var(b3, i),		\
+			LR_bin_var(b2, i), 1e-12*LR_bin_var(b2, i));	\
+	}								\
+	CU_ASSERT_DOUBLE_EQUAL(LR_bin_sumw(b3, -1),			\
+		LR_bin_sumw(b2, -1), 1e-12*LR_bin_sumw(b2, -1));	\
+	/* can't merge weighted with unweighted */			\
+	LR_bin_rm(&b1);							\
+	b1 = LR_bin_new_array(b3->bdrs, b3->nn - 1);			\
+	CU_ASSERT_EQUAL(LR_bin_merge(b3, b1), LRerr_UnmetPreconditions);\
+	free(x);							\
+	free(w);							\
+	LR_bin_rm(&b1);							\
+	LR_bin_rm(&b2);							\
+	LR_bin_rm(&b3);							\
+	LR_rm(&o);							\
+}
+
+testLRbinwt(1, 1, 10007)
+testLRbinwt(2, 0, 100000)
+
+/* unit weights are counts, and the sums are compensated */
+void test_bin_weighted_sums(void) {
+	LR_bin	*b = LR_bin_new_uniform(4, 0., 4.);
+	double	x[1000], w[1000];
+	long	nr = 10000;
+	CU_ASSERT_EQUAL(LR_bin_weighted(b), LRerr_OK);
+	for (int i = 0; i < 1000; i++) {
+		x[i] = .5 + (i % 4);
+		w[i] = (i % 4 == 3 ? (i % 8 == 3 ? 1. : 3.) : .1);
+	}
+	/* weight 1 */
+	LR_bin_add(b, -1.);
+	LR_bin_add_n(b, x, 3);
+	CU_ASSERT_EQUAL(LR_bin_sumw(b, 0), 1.);
+	CU_ASSERT_EQUAL(LR_bin_var(b, 1), 1.);
+	CU_ASSERT_EQUAL(LR_bin_ess(b, -1), 4.);
+	CU_ASSERT_EQUAL(LR_bin_ess(b, 4), 0.);
+	/* many small weights */
+	for (long r = 0; r < nr; r++)
+		LR_bin_addw_n(b, x, w, 1000);
+	CU_ASSERT_EQUAL(b->c, 4 + 1000*nr);
+	CU_ASSERT_DOUBLE_EQUAL(LR_bin_sumw(b, 1), 1. + .1*250*nr, 1e-15*.1*250*nr);
+	CU_ASSERT_DOUBLE_EQUAL(LR_bin_var(b, 2), 1. + .01*250*nr, 1e-15*.01*250*nr);
+	CU_ASSERT_DOUBLE_EQUAL(LR_bin_sumw(b, 4), 4.*125*nr, 1e-15*4.*125*nr);
+	/* ESS of weights 1 and 3 equally is 16/20 of the count */
+	CU_ASSERT_DOUBLE_EQUAL(LR_bin_ess(b, 4), .8*250*nr, 1e-9);
+	CU_ASSERT_DOUBLE_EQUAL(LR_bin_ess(b, 1),
+		(1. + 25.*nr)*(1. + 25.*nr)/(1. + 2.5*nr), 1e-9);
+	LR_bin_rm(&b);
+}
+
+/* integer bins against a plain array tally */
+#define testLRibin(tn,tt,pp,nd,nx)	void test_ibin_##tn(void) {	\
+	LR_obj	*o = LR_new(tt, LR_int);				\
+	LR_ibin	*b1 = LR_ibin_new(nd), *b2 = LR_ibin_new(nd),		\
+		*b3 = LR_ibin_new(7);					\
+	int	*x = (int *) malloc(nx*sizeof(int)), *k;		\
+	long	ref[2048] = {0}, *c;					\
+	size_t	m = 0;							\
+	CU_ASSERT_PTR_NOT_NULL(b1);					\
+	LR_set(o, 'p', pp);						\
+	LR_lsetseed(o, 19580512l);					\
+	for (int i = 0; i < nx; i++) {					\
+		x[i] = LRi_RAN(o);					\
+		if (x[i] > 2000) x[i] = 2000;				\
+		ref[x[i]]++;						\
+		CU_ASSERT_EQUAL(LR_ibin_add(b1, x[i]), 0);		\
+	}								\
+	CU_ASSERT_EQUAL(LR_ibin_add_n(b2, x, nx/3), 0);			\
+	CU_ASSERT_EQUAL(LR_ibin_add_n(b3, x + nx/3, nx - nx/3), 0);	\
+	CU_ASSERT_EQUAL(LR_ibin_merge(b2, b3), 0);			\
+	CU_ASSERT_EQUAL(b1->c, nx);					\
+	CU_ASSERT_EQUAL(b2->c, nx);					\
+	for (int i = 0; i <= 2000; i++) {				\
+		CU_ASSERT_EQUAL(LR_ibin_get(b1, i), ref[i]);		\
+		CU_ASSERT_EQUAL(LR_ibin_get(b2, i), ref[i]);		\
+		m += (ref[i] != 0);					\
+	}								\
+	CU_ASSERT_EQUAL(LR_ibin_size(b1), m);				\
+	CU_ASSERT_EQUAL(LR_ibin_size(b2), m);				\
+	k = (int *) malloc(m*sizeof(int));				\
+	c = (long *) malloc(m*sizeof(long));				\
+	CU_ASSERT_EQUAL(LR_ibin_export(b2, k, c), 0);			\
+	for (size_t i = 0; i < m; i++) {				\
+		CU_ASSERT_EQUAL(c[i], ref[k[i]]);			\
+		if (i) CU_ASSERT(k[i] > k[i-1]);			\
+	}								\
+	free(k);							\
+	free(c);							\
+	free(x);							\
+	LR_ibin_rm(&b1);						\
+	LR_ibin_rm(&b2);						\
+	LR_ibin_rm(&b3);						\
+	LR_rm(&o);							\
+}
+
+testLRibin(1, poisson, 12.5, 0, 100000)
+testLRibin(2, poisson, 700., 0, 100000)
+testLRibin(3, geometric, .01, 16, 100000)
+testLRibin(4, geometric, .2, 1, 10000)
+
+/* any int value, in order */
+void test_ibin_keys(void) {
+	int	x[] = {INT_MAX, -1, 0, 5, INT_MIN, 300, -1, 255, 256, INT_MAX,
+			-70000, 70000, 5, 0};
+	int	k[11], ek[] = {INT_MIN, -70000, -1, 0, 5, 255, 256, 300,
+			70000, INT_MAX};
+	long	c[11], ec[] = {1, 1, 2, 2, 2, 1, 1, 1, 1, 2};
+	LR_ibin	*b = LR_ibin_new(0);
+	CU_ASSERT_EQUAL(LR_ibin_add_n(b, x, sizeof(x)/sizeof(x[0])), 0);
+	CU_ASSERT_EQUAL(LR_ibin_size(b), 10);
+	CU_ASSERT_EQUAL(LR_ibin_export(b, k, c), 0);
+	for (int i = 0; i < 10; i++) {
+		CU_ASSERT_EQUAL(k[i], ek[i]);
+		CU_ASSERT_EQUAL(c[i], ec[i]);
+	}
+	CU_ASSERT_EQUAL(LR_ibin_get(b, 4), 0);
+	CU_ASSERT_EQUAL(LR_ibin_get(b, 12345), 0);
+	CU_ASSERT_EQUAL(LR_ibin_get(b, INT_MIN), 1);
+	LR_ibin_rm(&b);
+	CU_ASSERT_PTR_NULL(b);
+	CU_ASSERT_EQUAL(LR_ibin_rm(&b), LRerr_BinGeneric);
+}
+
+/* streaming moments - a known case */
+void test_stats_known(void) {
+	double	x[] = {2., 4., 1., 5., 3.};
+	LR_stats s, *p = LR_stats_new();
+	CU_ASSERT_EQUAL(LR_stats_reset(&s), 0);
+	CU_ASSERT(isnan(LR_stats_mean(&s)));
+	CU_ASSERT(isnan(LR_stats_var(&s)));
+	for (int i = 0; i < 5; i++)
+		CU_ASSERT_EQUAL(LR_stats_add(&s, x[i]), 0);
+	CU_ASSERT_EQUAL(LR_stats_add(&s, NAN), LRerr_InvalidInputValue);
+	CU_ASSERT_EQUAL(s.n, 5);
+	CU_ASSERT_DOUBLE_EQUAL(LR_stats_mean(&s), 3., 1e-15);
+	CU_ASSERT_DOUBLE_EQUAL(LR_stats_var(&s), 2.5, 1e-15);
+	CU_ASSERT_DOUBLE_EQUAL(LR_stats_sem(&s), sqrt(.5), 1e-15);
+	CU_ASSERT_DOUBLE_EQUAL(LR_stats_skew(&s), 0., 1e-15);
+	CU_ASSERT_DOUBLE_EQUAL(LR_stats_kurt(&s), -1.3, 1e-14);
+	CU_ASSERT_EQUAL(s.min, 1.);
+	CU_ASSERT_EQUAL(s.max, 5.);
+	/* merging into an empty one copies */
+	CU_ASSERT_EQUAL(LR_stats_merge(p, &s), 0);
+	CU_ASSERT_EQUAL(p->n, 5);
+	CU_ASSERT_EQUAL(p->m4, s.m4);
+	LR_stats_rm(&p);
+	CU_ASSERT_PTR_NULL(p);
+}
+
+/* streaming, batch, and merged moments against stored two pass sums */
+#define testLRstats(tn,tt,nx,...)	void test_stats_##tn(void) {	\
+	LR_obj	*o = LR_new(tt, LR_double);				\
+	LR_stats *s1 = LR_stats_new(), *s2 = LR_stats_new(),		\
+		*s3 = LR_stats_new(), *s4 = LR_stats_new();		\
+	double	*x = (double *) malloc(nx*sizeof(double)),		\
+		m = 0., m2 = 0., m3 = 0., m4 = 0., lo = INFINITY, hi = -INFINITY;\
+	__VA_ARGS__							\
+	LR_lsetseed(o, 19580512l);					\
+	for (int i = 0; i < nx; i++) {					\
+		x[i] = LRd_RAN(o);					\
+		m += x[i];						\
+		lo = (x[i] < lo ? x[i] : lo);				\
+		hi = (x[i] > hi ? x[i] : hi);				\
+	}								\
+	m /= nx;							\
+	for (int i = 0; i < nx; i++) {					\
+		double d = x[i] - m;					\
+		m2 += d*d; m3 += d*d*d; m4 += d*d*d*d;			\
+	}								\
+	for (int i = 0; i < nx; i++)					\
+		LR_stats_add(s1, x[i]);					\
+	CU_ASSERT_EQUAL(LR_stats_add_n(s2, x, nx), 0);			\
+	/* uneven pieces merged */					\
+	LR_stats_add_n(s3, x, nx/7);					\
+	LR_stats_add_n(s4, x + nx/7, 3);				\
+	LR_stats_merge(s3, s4);						\
+	LR_stats_reset(s4);						\
+	LR_stats_add_n(s4, x + nx/7 + 3, nx - nx/7 - 3);		\
+	LR_stats_merge(s3, s4);						\
+	/* relative roundoff grows with the offset of the mean */	\
+	double	rel = 1e-11*(1. + fabs(m)/sqrt(m2/nx));			\
+	LR_stats *ss[] = {s1, s2, s3};					\
+	for (int k = 0; k < 3; k++) {					\
+		LR_stats *s = ss[k];					\
+		CU_ASSERT_EQUAL(s->n, nx);				\
+		CU_ASSERT_EQUAL(s->min, lo);				\
+		CU_ASSERT_EQUAL(s->max, hi);				\
+		CU_ASSERT_DOUBLE_EQUAL(s->mean, m, 1e-12*(1. + fabs(m)));\
+		CU_ASSERT_DOUBLE_EQUAL(s->m2, m2, rel*m2);		\
+		CU_ASSERT_DOUBLE_EQUAL(s->m3, m3, 10.*rel*m2*sqrt(m2/nx));\
+		CU_ASSERT_DOUBLE_EQUAL(s->m4, m4, rel*m4);		\
+	}								\
+	/* a NaN in a batch is skipped */				\
+	x[nx/2] = NAN;							\
+	LR_stats_reset(s2);						\
+	CU_ASSERT_EQUAL(LR_stats_add_n(s2, x, nx),			\
+		LRerr_InvalidInputValue);				\
+	CU_ASSERT_EQUAL(s2->n, nx - 1);					\
+	free(x);							\
+	LR_stats_rm(&s1);						\
+	LR_stats_rm(&s2);						\
+	LR_stats_rm(&s3);						\
+	LR_stats_rm(&s4);						\
+	LR_rm(&o);							\
+}
+
+testLRstats(1, gausbm, 100000, LR_set_all(o, "ms", 1e6, 1.);)
+testLRstats(2, nexp, 100003, LR_set(o, 'm', 2.);)
+testLRstats(3, unif, 1001, LR_set_all(o, "ab", -1., 3.);)
+testLRstats(4, cauchy, 10, )
+
+/* per-thread moments merged match the moments of all the samples */
+typedef struct {
+	long	seed;
+	LR_stats s;
+} stats_thr;
+static void *stats_thr_run(void *arg) {
+	stats_thr *a = (stats_thr *) arg;
+	LR_obj	*o = LR_new(erlang, LR_double);
+	double	x[1000];
+	LR_set(o, 'k', 3);
+	LR_lsetseed(o, a->seed);
+	LR_stats_reset(&(a->s));
+	for (int i = 0; i < 100; i++) {
+		for (int j = 0; j < 1000; j++)
+			x[j] = LRd_RAN(o);
+		LR_stats_add_n(&(a->s), x, 1000);
+	}
+	LR_rm(&o);
+	return NULL;
+}
+void test_stats_threads(void) {
+	pthread_t	th[NTHREADS];
+	stats_thr	par[NTHREADS];
+	LR_stats	tot, ser;
+	LR_stats_reset(&tot);
+	LR_stats_reset(&ser);
+	for (int i = 0; i < NTHREADS; i++) {
+		par[i].seed = 19580512l + 2*i;
+		CU_ASSERT_EQUAL(pthread_create(&th[i], NULL,
+			stats_thr_run, &par[i]), 0);
+	}
+	for (int i = 0; i < NTHREADS; i++) {
+		CU_ASSERT_EQUAL(pthread_join(th[i], NULL), 0);
+		CU_ASSERT_EQUAL(LR_stats_merge(&tot, &(par[i].s)), 0);
+	}
+	for (int i = 0; i < NTHREADS; i++) {
+		stats_thr_run(&par[i]);
+		LR_stats_merge(&ser, &(par[i].s));
+	}
+	CU_ASSERT_EQUAL(tot.n, NTHREADS*100000l);
+	CU_ASSERT_EQUAL(tot.n, ser.n);
+	CU_ASSERT_EQUAL(tot.mean, ser.mean);
+	CU_ASSERT_EQUAL(tot.m2, ser.m2);
+	/* erlang k=3 m=1: mean 3, variance 3, skewness 2/sqrt(3) */
+	CU_ASSERT_DOUBLE_EQUAL(LR_stats_mean(&tot), 3., 5.*LR_stats_sem(&tot));
+	CU_ASSERT_DOUBLE_EQUAL(LR_stats_var(&tot), 3., .05);
+	CU_ASSERT_DOUBLE_EQUAL(LR_stats_skew(&tot), 2./sqrt(3.), .05);
+	CU_ASSERT_DOUBLE_EQUAL(LR_stats_kurt(&tot), 2., .2);
+}
+
+/* the quantile sketch is exact while everything is kept */
+void test_kll_exact(void) {
+	LR_kll	*s = LR_kll_new(0);
+	double	x[100];
+	CU_ASSERT_PTR_NOT_NULL(s);
+	CU_ASSERT(isnan(LR_kll_quantile(s, .5)));
+	for (int i = 0; i < 100; i++)
+		x[i] = (37*i) % 100;
+	x[50] = NAN;
+	CU_ASSERT_EQUAL(LR_kll_add_n(s, x, 100), LRerr_InvalidInputValue);
+	CU_ASSERT_EQUAL(s->n, 99);
+	CU_ASSERT_EQUAL(LR_kll_eps(s), 0.);
+	/* x[50] was 50 */
+	CU_ASSERT_EQUAL(LR_kll_quantile(s, 0.), 0.);
+	CU_ASSERT_EQUAL(LR_kll_quantile(s, 1.), 99.);
+	CU_ASSERT_EQUAL(LR_kll_quantile(s, .1), 9.);
+	CU_ASSERT_EQUAL(LR_kll_quantile(s, 50./99.), 49.);
+	CU_ASSERT_EQUAL(LR_kll_quantile(s, 51./99.), 51.);
+	CU_ASSERT_DOUBLE_EQUAL(LR_kll_rank(s, 50.), 50./99., 1e-15);
+	CU_ASSERT_DOUBLE_EQUAL(LR_kll_rank(s, -1.), 0., 1e-15);
+	CU_ASSERT(isnan(LR_kll_quantile(s, 1.5)));
+	LR_kll_rm(&s);
+	CU_ASSERT_PTR_NULL(s);
+	CU_ASSERT_PTR_NULL(LR_kll_new(3));
+}
+
+/* the sketch rank error against the sorted samples */
+static int kll_cmp(const void *a, const void *b) {
+	double	x = *((const double *) a), y = *((const double *) b);
+	return (x > y) - (x < y);
+}
+static double kll_maxerr(const LR_kll *s, double *x, long nx) {
+	double	mx = 0.;
+	qsort(x, nx, sizeof(double), kll_cmp);
+	for (int j = 1; j < 100; j++) {
+		double	q = LR_kll_quantile(s, j/100.), e;
+		long	lo = 0, hi = nx;
+		while (lo < hi) {
+			long m = (lo + hi)/2;
+			if (x[m] <= q) lo = m + 1; else hi = m;
+		}
+		e = fabs(lo/(double) nx - j/100.);
+		mx = (e > mx ? e : mx);
+		/* and the rank is the inverse */
+		e = fabs(LR_kll_rank(s, q) - lo/(double) nx);
+		CU_ASSERT(e <= LR_kll_eps(s));
+	}
+	return mx;
+}
+#define testLRkll(tn,tt,kk,nx,bat,...)	void test_kll_##tn(void) {	\
+	LR_obj	*o = LR_new(tt, LR_double);				\
+	LR_kll	*s = LR_kll_new(kk);					\
+	double	*x = (double *) malloc(nx*sizeof(double)), d;		\
+	double	p[] = {.001, .01, .1, .5, .9, .99, .999}, xq[7], fq[7];	\
+	__VA_ARGS__							\
+	LR_lsetseed(o, 19580512l);					\
+	for (long i = 0; i < nx; i++)					\
+		x[i] = LRd_RAN(o);					\
+	if (bat) {							\
+		CU_ASSERT_EQUAL(LR_kll_add_n(s, x, nx), 0);		\
+	} else {							\
+		int r = 0;						\
+		for (long i = 0; i < nx; i++)				\
+			r |= LR_kll_add(s, x[i]);			\
+		CU_ASSERT_EQUAL(r, 0);					\
+	}								\
+	CU_ASSERT_EQUAL(s->n, nx);					\
+	/* bounded memory */						\
+	CU_ASSERT(s->size <= 3*s->k + 8*s->nlev);			\
+	CU_ASSERT(LR_kll_eps(s) > 0.);					\
+	/* against the distribution */					\
+	CU_ASSERT_EQUAL(LR_kll_compare(s, o, 7, p, xq, fq), 0);		\
+	for (int i = 0; i < 7; i++) {					\
+		CU_ASSERT_DOUBLE_EQUAL(fq[i], p[i], LR_kll_eps(s)	\
+			+ 3.*sqrt(p[i]*(1.-p[i])/nx));			\
+		if (i) CU_ASSERT(xq[i] >= xq[i-1]);			\
+	}								\
+	d = LR_kll_ksdist(s, o);					\
+	CU_ASSERT(d < LR_kll_eps(s) + 1.63/sqrt(nx));			\
+	CU_ASSERT(kll_maxerr(s, x, nx) <= LR_kll_eps(s));		\
+	CU_ASSERT_EQUAL(LR_kll_quantile(s, 0.), x[0]);			\
+	CU_ASSERT_EQUAL(LR_kll_quantile(s, 1.), x[nx-1]);		\
+	free(x);							\
+	LR_kll_rm(&s);							\
+	LR_rm(&o);							\
+}
+
+testLRkll(1, unif, 0, 1000000, 0, )
+testLRkll(2, gausbm, 0, 1000000, 1, LR_set_all(o, "ms", 3., 2.);)
+testLRkll(3, nexp, 50, 300000, 1, )
+testLRkll(4, cauchy, 400, 2000000, 1, )
+
+/* per-thread sketches merged */
+typedef struct {
+	long	seed;
+	double	*x;
+	LR_kll	*s;
+} kll_thr;
+static void *kll_thr_run(void *arg) {
+	kll_thr *a = (kll_thr *) arg;
+	LR_obj	*o = LR_new(gausbm, LR_double);
+	LR_lsetseed(o, a->seed);
+	for (int i = 0; i < 250000; i++)
+		a->x[i] = LRd_RAN(o);
+	LR_kll_add_n(a->s, a->x, 250000);
+	LR_rm(&o);
+	return NULL;
+}
+void test_kll_merge(void) {
+	pthread_t	th[NTHREADS];
+	kll_thr		par[NTHREADS];
+	LR_kll		*tot = LR_kll_new(0);
+	LR_obj		*o = LR_new(gausbm, LR_double);
+	double		*x = (double *) malloc(NTHREADS*250000*sizeof(double));
+	for (int i = 0; i < NTHREADS; i++) {
+		par[i].seed = 19580512l + 2*i;
+		par[i].x = x + i*250000;
+		par[i].s = LR_kll_new(0);
+		CU_ASSERT_EQUAL(pthread_create(&th[i], NULL,
+			kll_thr_run, &par[i]), 0);
+	}
+	for (int i = 0; i < NTHREADS; i++) {
+		CU_ASSERT_EQUAL(pthread_join(th[i], NULL), 0);
+		CU_ASSERT_EQUAL(LR_kll_merge(tot, par[i].s), 0);
+		LR_kll_rm(&(par[i].s));
+	}
+	CU_ASSERT_EQUAL(tot->n, NTHREADS*250000l);
+	CU_ASSERT(tot->size <= 3*tot->k + 8*tot->nlev);
+	CU_ASSERT(kll_maxerr(tot, x, NTHREADS*250000l) <= LR_kll_eps(tot));
+	CU_ASSERT(LR_kll_ksdist(tot, o) < LR_kll_eps(tot) + .002);
+	free(x);
+	LR_kll_rm(&tot);
+	LR_rm(&o);
+}
+
+/* statistics of constructed samples */
+void test_gof_known(void) {
+	LR_obj	*o = LR_new(unif, LR_double);
+	LR_bin	*b = LR_bin_new_uniform(4, 0., 1.);
+	double	x[100], d, a2, chi2;
+	int	df;
+	/* as close to uniform as can be */
+	for (int i = 0; i < 100; i++)
+		x[99 - i] = (i + .5)/100.;
+	CU_ASSERT(LR_gof_ks(o, x, 100, &d) > .999);
+	CU_ASSERT_DOUBLE_EQUAL(d, .005, 1e-12);
+	CU_ASSERT(x[0] < x[99]);
+	CU_ASSERT(LR_gof_ad(o, x, 100, &a2) > .999);
+	CU_ASSERT_DOUBLE_EQUAL(a2, .0115, 1e-4);
+	/* squeezed toward 0 */
+	for (int i = 0; i < 100; i++)
+		x[i] = x[i]*x[i]*x[i];
+	CU_ASSERT(LR_gof_ks(o, x, 100, &d) < 1e-6);
+	CU_ASSERT_DOUBLE_EQUAL(d, .385, .01);
+	CU_ASSERT(LR_gof_ad(o, x, 100, &a2) < 1e-6);
+	/* exactly the expected counts, then 10 moved */
+	for (int i = 0; i < 100; i++)
+		LR_bin_add(b, (i + .5)/100.);
+	CU_ASSERT_DOUBLE_EQUAL(LR_gof_chisq(o, b, &chi2, &df), 1., 1e-12);
+	CU_ASSERT_EQUAL(df, 3);
+	CU_ASSERT_DOUBLE_EQUAL(chi2, 0., 1e-12);
+	b->bins[1] -= 10;
+	b->bins[2] += 10;
+	/* chi2 = 8 with 3 df */
+	CU_ASSERT_DOUBLE_EQUAL(LR_gof_chisq(o, b, &chi2, &df), .0460, 1e-4);
+	CU_ASSERT_DOUBLE_EQUAL(chi2, 8., 1e-12);
+	/* not for discrete */
+	LR_rm(&o);
+	o = LR_new(poisson, LR_int);
+	CU_ASSERT(isnan(LR_gof_ks(o, x, 100, &d)));
+	CU_ASSERT_EQUAL(o->errno, LRerr_BadDataType);
+	LR_bin_rm(&b);
+	LR_rm(&o);
+}
+
+/* samples tested against the right and a shifted distribution */
+#define testLRgof(tn,tt,dt,nx,mb,...)	void test_gof_##tn(void) { \
+	LR_obj	*o = LR_new(tt, dt), *r = LR_new(tt, dt),		\
+		*w = LR_new(tt, dt);					\
+	LR_gof	*g, *h;							\
+	double	*x = (double *) malloc(nx*sizeof(double));		\
+	__VA_ARGS__							\
+	LR_lsetseed(o, 19580512l);					\
+	for (long i = 0; i < nx; i++)					\
+		x[i] = (dt == LR_double ? LRd_RAN(o)			\
+			: (dt == LR_float ? (double) LRf_RAN(o)		\
+			: (double) LRi_RAN(o)));			\
+	CU_ASSERT_PTR_NOT_NULL(g = LR_gof_new(r, 0, mb));		\
+	CU_ASSERT_PTR_NOT_NULL(h = LR_gof_new(w, 0, mb));		\
+	CU_ASSERT_EQUAL(LR_gof_add_n(g, x, nx), 0);			\
+	CU_ASSERT_EQUAL(LR_gof_add_n(h, x, nx), 0);			\
+	CU_ASSERT_EQUAL(LR_gof_flush(g), 0);				\
+	CU_ASSERT_EQUAL(LR_gof_flush(h), 0);				\
+	CU_ASSERT_EQUAL(g->n, nx);					\
+	CU_ASSERT(LR_gof_pchisq(g, NULL, NULL) > 1e-4);			\
+	CU_ASSERT(LR_gof_pchisq(h, NULL, NULL) < 1e-6);			\
+	if (dt == LR_int) {						\
+		CU_ASSERT_EQUAL(g->nb, 0);				\
+		CU_ASSERT(isnan(LR_gof_pks(g)));			\
+	} else {							\
+		CU_ASSERT_EQUAL(g->nb, (nx + mb - 1)/mb);		\
+		CU_ASSERT(LR_gof_pks(g) > 1e-4);			\
+		CU_ASSERT(LR_gof_pad(g) > 1e-4);			\
+		CU_ASSERT(LR_gof_pks(h) < 1e-6);			\
+		CU_ASSERT(LR_gof_pad(h) < 1e-6);			\
+	}								\
+	free(x);							\
+	LR_gof_rm(&g);							\
+	LR_gof_rm(&h);							\
+	LR_rm(&o);							\
+	LR_rm(&r);							\
+	LR_rm(&w);							\
+}
+
+testLRgof(1, unif, LR_double, 1000000, 100000,
+	LR_set_all(w, "ab", .01, 1.01);)
+testLRgof(2, gausbm, LR_double, 1000000, 65536,
+	LR_set_all(o, "ms", 3., 2.); LR_set_all(r, "ms", 3., 2.);
+	LR_set_all(w, "ms", 3., 2.1);)
+testLRgof(3, gausbm, LR_float, 300000, 50000,
+	LR_set_all(w, "ms", .05, 1.);)
+testLRgof(4, nexp, LR_double, 500000, 100000, LR_set(w, 'm', 1.05);)
+testLRgof(5, poisson, LR_int, 1000000, 1000,
+	LR_set(o, 'p', 12.5); LR_set(r, 'p', 12.5); LR_set(w, 'p', 12.6);)
+
+/* threaded and repeatable */
+void test_gof_spec(void) {
+	LR_obj	*o = LR_new(gausbm, LR_double), *r = LR_new(gausbm, LR_double);
+	LR_spec	*sp;
+	LR_gof	*g = LR_gof_new(r, 200, 1 << 16),
+		*h = LR_gof_new(r, 200, 1 << 16);
+	double	c1, c2;
+	int	df;
+	CU_ASSERT_PTR_NOT_NULL(sp = LR_spec_new(&o));
+	CU_ASSERT_EQUAL(LR_gof_spec(g, sp, 2000000l, NTHREADS, 12345l), 0);
+	CU_ASSERT_EQUAL(LR_gof_flush(g), 0);
+	CU_ASSERT_EQUAL(g->n, 2000000l);
+	CU_ASSERT_EQUAL(g->nb, 31);
+	CU_ASSERT(LR_gof_pchisq(g, &c1, &df) > 1e-4);
+	CU_ASSERT_EQUAL(df, 199);
+	CU_ASSERT(LR_gof_pks(g) > 1e-4);
+	CU_ASSERT(LR_gof_pad(g) > 1e-4);
+	CU_ASSERT_EQUAL(LR_gof_spec(h, sp, 2000000l, NTHREADS, 12345l), 0);
+	(void) LR_gof_pchisq(h, &c2, &df);
+	CU_ASSERT_EQUAL(c1, c2);
+	for (int i = 0; i < h->nb; i++)
+		CU_ASSERT_EQUAL(g->pad[i], h->pad[i]);
+	LR_gof_rm(&g);
+	LR_gof_rm(&h);
+	LR_spec_rm(&sp);
+	LR_rm(&r);
+}
+
+/* the spectral test - minstd (Park & Miller) and a brute force search */
+void test_spectral(void) {
+	double	nu[LR_SPECTRAL_MAX + 1], st[LR_SPECTRAL_MAX + 1];
+	long	m = 4096, a = 1229, best2 = m * m, best3 = m * m;
+	CU_ASSERT_EQUAL(LR_spectral(16807ul, 2147483647ul, 6, nu, st), 0);
+	CU_ASSERT_DOUBLE_EQUAL(nu[2] * nu[2], 282475250., .5);
+	CU_ASSERT_DOUBLE_EQUAL(st[2], .338, .001);
+	/* shortest dual vectors: x + a y + a^2 z = 0 mod m */
+	for (long x = -70; x <= 70; x++)
+		for (long y = -70; y <= 70; y++) {
+			long n2 = x*x + y*y;
+			if (n2 && n2 < best2 && (x + a*y) % m == 0)
+				best2 = n2;
+			for (long z = -70; z <= 70; z++) {
+				long n3 = n2 + z*z;
+				if (n3 && n3 < best3
+				&& (x + a*y + (a*a % m)*z) % m == 0)
+					best3 = n3;
+			}
+		}
+	CU_ASSERT_EQUAL(LR_spectral(a, m, 3, nu, st), 0);
+	CU_ASSERT_DOUBLE_EQUAL(nu[2] * nu[2], best2, 1e-6);
+	CU_ASSERT_DOUBLE_EQUAL(nu[3] * nu[3], best3, 1e-6);
+	/* the libran generators */
+	CU_ASSERT_EQUAL(LR_spectral(LR_igetval("LR_IA"),
+		2ul * LR_igetval("LR_IRAND_IMAX2"), LR_SPECTRAL_MAX, nu, st), 0);
+	for (int k = 2; k <= LR_SPECTRAL_MAX; k++)
+		CU_ASSERT(st[k] > .3 && st[k] <= 1.);
+	CU_ASSERT_EQUAL(LR_spectral(LR_lgetval("LR_LA"),
+		2ul * LR_lgetval("LR_IRAND_LMAX2"), LR_SPECTRAL_MAX, nu, st), 0);
+	for (int k = 2; k <= LR_SPECTRAL_MAX; k++)
+		CU_ASSERT(st[k] > .3 && st[k] <= 1.);
+	CU_ASSERT_EQUAL(LR_spectral(5ul, 3ul, 9, nu, st), LRerr_InvalidInputValue);
+}
+
+/* a Weyl sequence - uniform but hopelessly correlated */
+static double test_weyl(LR_obj *o) {
+	o->iy.l = (long) ((unsigned long) o->iy.l + 0x9E3779B97F4A7C15ul);
+	return (double) (((unsigned long) o->iy.l) >> 11) * 0x1.0p-53;
+}
+
+/* the battery - passes the long LCG, fails a Weyl sequence */
+void test_battery(void) {
+	LR_obj		*o = LR_new(unif, LR_double);
+	LR_spec		*sp;
+	LR_battery	b, c;
+	CU_ASSERT_PTR_NOT_NULL(sp = LR_spec_new(&o));
+	CU_ASSERT_EQUAL(LR_battery_run(&b, sp, 1l << 18, 4, NTHREADS, 1234l), 0);
+	CU_ASSERT_EQUAL(LR_battery_run(&c, sp, 1l << 18, 4, 1, 1234l), 0);
+	for (int i = 0; i < LR_BATTERY_TESTS; i++) {
+		CU_ASSERT(b.p[i] > 1e-4);
+		CU_ASSERT(b.rate[i] > 0.);
+		CU_ASSERT_EQUAL(b.p[i], c.p[i]);
+	}
+	CU_ASSERT(b.ns > 0.);
+	CU_ASSERT_EQUAL(LR_battery_run(&c, sp, 1000l, 4, 1, 1234l),
+		LRerr_InvalidInputValue);
+	LR_spec_rm(&sp);
+	o = LR_new(unif, LR_double);
+	o->ud = test_weyl;
+	CU_ASSERT_PTR_NOT_NULL(sp = LR_spec_new(&o));
+	CU_ASSERT_EQUAL(LR_battery_run(&b, sp, 1l << 18, 2, NTHREADS, 1234l), 0);
+	for (int i = 0; i < LR_BATTERY_TESTS; i++)
+		CU_ASSERT(b.p[i] < 1e-6);
+	CU_ASSERT_STRING_EQUAL(LR_battery_name(0), "birthday");
+	CU_ASSERT_PTR_NULL(LR_battery_name(LR_BATTERY_TESTS));
+	LR_spec_rm(&sp);
+}
+
+/* a user CDF for the counters */
+static double test_cdf2(double x) {
+	return x * x;
+}
+
+/* the instrumentation counters - only kept with LR_COUNTERS */
+void test_counters(void) {
+	LR_obj		*o = LR_new(gausmar, LR_double),
+			*u = LR_new(uinvcdf, LR_double), *s;
+	LR_spec		*sp;
+	LR_counters	c;
+	int		nrv = 100000;
+	CU_ASSERT_EQUAL(LR_set_all(u, "ab", 0., 1.), 0);
+	CU_ASSERT_EQUAL(LRd_uinvcdf(u, test_cdf2), 0);
+	for (int i = 0; i < nrv; i++) {
+		(void) LRd_RAN(o);
+		if (i < 100)
+			(void) LRd_RAN(u);
+	}
+#ifdef LR_COUNTERS
+	CU_ASSERT_EQUAL(LR_counters_get(o, &c), 0);
+	/* two uniforms per pair of variates, and per rejection */
+	CU_ASSERT_EQUAL(c.uniforms, (unsigned long) nrv + 2ul * c.rejections);
+	CU_ASSERT_DOUBLE_EQUAL(c.rejections / (.5 * nrv + c.rejections),
+		1. - M_PI/4., .01);
+	CU_ASSERT_EQUAL(c.iterations, 0);
+	CU_ASSERT_EQUAL(c.callbacks, 0);
+	CU_ASSERT_EQUAL(LR_counters_get(u, &c), 0);
+	CU_ASSERT_EQUAL(c.uniforms, 100);
+	CU_ASSERT_EQUAL(c.rejections, 0);
+	CU_ASSERT(c.iterations > 100);
+	/* the two end points then one per iteration */
+	CU_ASSERT_EQUAL(c.callbacks, 200 + c.iterations);
+	(void) LRd_PDF(u, .5);
+	CU_ASSERT_EQUAL(LR_counters_get(u, &c), 0);
+	CU_ASSERT_EQUAL(c.callbacks, 202 + c.iterations);
+	LR_counters_reset(u);
+	CU_ASSERT_EQUAL(LR_counters_get(u, &c), 0);
+	CU_ASSERT_EQUAL(c.uniforms + c.rejections + c.iterations
+		+ c.callbacks, 0);
+	/* streams start from zero */
+	CU_ASSERT_PTR_NOT_NULL(sp = LR_spec_new(&o));
+	CU_ASSERT_PTR_NOT_NULL(s = LR_stream_new(sp));
+	CU_ASSERT_EQUAL(LR_counters_get(s, &c), 0);
+	CU_ASSERT_EQUAL(c.uniforms, 0);
+	(void) LRd_RAN(s);
+	CU_ASSERT_EQUAL(LR_counters_get(s, &c), 0);
+	CU_ASSERT(c.uniforms >= 2);
+#else
+	CU_ASSERT_EQUAL(LR_counters_get(o, &c), LRerr_UnmetPreconditions);
+	CU_ASSERT_EQUAL(c.uniforms + c.rejections + c.iterations
+		+ c.callbacks, 0);
+	LR_counters_reset(o);
+	CU_ASSERT_PTR_NOT_NULL(sp = LR_spec_new(&o));
+	CU_ASSERT_PTR_NOT_NULL(s = LR_stream_new(sp));
+#endif
+	CU_ASSERT_EQUAL(LR_counters_get(NULL, &c), LRerr_InvalidInputValue);
+	LR_rm(&s);
+	LR_spec_rm(&sp);
+	LR_rm(&u);
+}
+
+/* the batch RANs give the same sequence as the scalar ones */
+void test_RAN_n(void) {
+	LR_type		t[] = {unif, nexp, gausbm, cauchy, gausmar,
+				gsn2, gsn4, gsn12, gsnN};
+	long		chunk[] = {1, 7, 500, 0, 493}, nrv = 1001;
+	double		xd[1001];
+	float		xf[1001];
+	for (int k = 0; k < (int) (sizeof(t)/sizeof(t[0])); k++) {
+		LR_obj	*od = LR_new(t[k], LR_double), *bd = LR_new(t[k], LR_double),
+			*of = LR_new(t[k], LR_float), *bf = LR_new(t[k], LR_float);
+		long	i = 0;
+		for (int j = 0; j < (int) (sizeof(chunk)/sizeof(chunk[0])); j++) {
+			CU_ASSERT_EQUAL(LRd_RAN_n(bd, xd + i, chunk[j]), 0);
+			CU_ASSERT_EQUAL(LRf_RAN_n(bf, xf + i, chunk[j]), 0);
+			i += chunk[j];
+		}
+		CU_ASSERT_EQUAL(i, nrv);
+		for (i = 0; i < nrv; i++) {
+			double	d = LRd_RAN(od);
+			float	f = LRf_RAN(of);
+			CU_ASSERT_DOUBLE_EQUAL(xd[i], d, 1e-12 * (1. + fabs(d)));
+			CU_ASSERT_DOUBLE_EQUAL(xf[i], f, 1e-5 * (1. + fabs(f)));
+		}
+		CU_ASSERT_EQUAL(LRf_RAN_n(bd, xf, 1), LRerr_BadDataType);
+		CU_ASSERT_EQUAL(LRd_RAN_n(bd, xd, -1), LRerr_InvalidInputValue);
+		LR_rm(&od);
+		LR_rm(&bd);
+		LR_rm(&of);
+		LR_rm(&bf);
+	}
+}
+
+/* the quantiles invert the CDFs */
+void test_quant(void) {
+	LR_type		t[] = {unif, nexp, erlang, gausbm, gausmar, cauchy,
+				cauchymar, gsn2, gsn4, gsn12, gsnN},
+			ti[] = {poisson, geometric, logd, binomial};
+	double		ud[101], xd[101];
+	float		uf[101], xf[101];
+	int		xi[101];
+	LR_obj		*o, *of;
+	for (int k = 0; k < (int) (sizeof(t)/sizeof(t[0])); k++) {
+		o = LR_new(t[k], LR_double);
+		of = LR_new(t[k], LR_float);
+		if (t[k] == erlang) {
+			LR_set_all(o, "km", 5, 2.);
+			LR_set_all(of, "km", 5, 2.);
+		} else if (t[k] == gsnN) {
+			LR_set_all(o, "k", 7);
+			LR_set_all(of, "k", 7);
+		}
+		for (int i = 1; i < 1000; i++) {
+			double	u = .001 * i;
+			CU_ASSERT_DOUBLE_EQUAL(LRd_CDF(o, LRd_QUANT(o, u)), u, 1e-12);
+			CU_ASSERT_DOUBLE_EQUAL(LRf_CDF(of, LRf_QUANT(of, u)), u, 2e-5);
+		}
+		/* the ends of the support */
+		CU_ASSERT_EQUAL(LRd_CDF(o, LRd_QUANT(o, 0.)), 0.);
+		CU_ASSERT_EQUAL(LRd_CDF(o, LRd_QUANT(o, 1.)), 1.);
+		CU_ASSERT(isnan(LRd_QUANT(o, 1.5)));
+		CU_ASSERT_EQUAL(o->errno, LRerr_InvalidInputValue);
+		CU_ASSERT(isnan(LRf_QUANT(of, -.5)));
+		CU_ASSERT_EQUAL(of->errno, LRerr_InvalidInputValue);
+		CU_ASSERT(isnan(LRd_QUANT(of, .5)));
+		CU_ASSERT_EQUAL(of->errno, LRerr_BadDataType);
+		/* the batch ones are the scalar ones, in place too */
+		for (int i = 0; i <= 100; i++) {
+			ud[i] = xd[i] = .01 * i;
+			uf[i] = xf[i] = .01f * i;
+		}
+		CU_ASSERT_EQUAL(LRd_QUANT_n(o, ud, ud, 101), 0);
+		CU_ASSERT_EQUAL(LRf_QUANT_n(of, uf, uf, 101), 0);
+		for (int i = 0; i <= 100; i++) {
+			CU_ASSERT_EQUAL(ud[i], LRd_QUANT(o, xd[i]));
+			CU_ASSERT_EQUAL(uf[i], LRf_QUANT(of, xf[i]));
+		}
+		xd[50] = 2.;
+		CU_ASSERT_EQUAL(LRd_QUANT_n(o, xd, ud, 101),
+			LRerr_InvalidInputValue);
+		CU_ASSERT(isnan(ud[50]));
+		CU_ASSERT_EQUAL(ud[51], LRd_QUANT(o, .51));
+		LR_rm(&o);
+		LR_rm(&of);
+	}
+	/* against known values */
+	o = LR_new(gausbm, LR_double);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_QUANT(o, .975), 1.959963984540054, 1e-15);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_QUANT(o, 1e-10), -6.361340902404056, 1e-14);
+	LR_rm(&o);
+	o = LR_new(erlang, LR_double);
+	LR_set_all(o, "km", 5, 2.);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_QUANT(o, .5), 9.341817765591967, 1e-14);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_QUANT(o, .01), 2.558212160187206, 1e-14);
+	LR_rm(&o);
+	o = LR_new(cauchy, LR_double);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_QUANT(o, .75), 1., 1e-15);
+	LR_rm(&o);
+	o = LR_new(nexp, LR_double);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_QUANT(o, .5), M_LN2, 1e-15);
+	LR_rm(&o);
+	o = LR_new(gsnN, LR_double);
+	LR_set_all(o, "k", 7);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_QUANT(o, 1.), 3.5 * sqrt(12./7.), 1e-14);
+	CU_ASSERT_DOUBLE_EQUAL(LRd_QUANT(o, .5), 0., 1e-15);
+	LR_rm(&o);
+	/* the tabulated & user ones */
+	o = LR_new(piece, LR_double);
+	PIECESETUP(o);
+	of = LR_new(lspline, LR_float);
+	LR_aux_new(of,6);
+	LR_set_all(of,"abx", -2., 6., 0.);
+	LR_aux_set(of, of->a.f + 2.0, 1.0);
+	LR_aux_set(of, of->a.f + 3.0, 3.0);
+	LR_aux_set(of, of->a.f + 4.0, 0.0);
+	LR_aux_set(of, of->a.f + 5.0, 5.0);
+	LR_aux_set(of, of->a.f + 7.0, 2.0);
+	LR_aux_norm(of);
+	for (int i = 1; i < 1000; i++) {
+		double	u = .001 * i;
+		CU_ASSERT_DOUBLE_EQUAL(LRd_CDF(o, LRd_QUANT(o, u)), u, 1e-12);
+		CU_ASSERT_DOUBLE_EQUAL(LRf_CDF(of, LRf_QUANT(of, u)), u, 2e-5);
+	}
+	CU_ASSERT_EQUAL(LRd_QUANT(o, 0.), -2.);
+	CU_ASSERT_EQUAL(LRf_QUANT(of, 1.f), 6.f);
+	LR_rm(&o);
+	LR_rm(&of);
+	o = LR_new(uinvcdf, LR_double);
+	LRd_uinvcdf(o, MyCDFc);
+	LR_set_all(o, "ms", .5, 1.);
+	for (int i = 1; i < 100; i++) {
+		double	u = .01 * i;
+		CU_ASSERT_DOUBLE_EQUAL(MyCDFc(LRd_QUANT(o, u)), u, 1e-7);
+	}
+	LR_rm(&o);
+	/* the discrete ones give the smallest k with CDF(k) >= u */
+	for (int k = 0; k < (int) (sizeof(ti)/sizeof(ti[0])); k++) {
+		o = LR_new(ti[k], LR_int);
+		if (ti[k] == binomial)
+			LR_set_all(o, "np", 10, .35);
+		for (int i = 0; i < 100; i++) {
+			float	u = .01f * i;
+			int	x = LRi_QUANT(o, u);
+			CU_ASSERT(LRi_CDF(o, x) >= u - 1e-6f);
+			if (i > 0)
+				CU_ASSERT(LRi_CDF(o, x - 1) < u + 1e-6f);
+			uf[i] = u;
+		}
+		uf[100] = 1.f;
+		CU_ASSERT(LRi_QUANT(o, 1.f) >= LRi_QUANT(o, .99f));
+		CU_ASSERT_EQUAL(LRi_QUANT_n(o, uf, xi, 101), 0);
+		for (int i = 0; i <= 100; i++)
+			CU_ASSERT_EQUAL(xi[i], LRi_QUANT(o, uf[i]));
+		CU_ASSERT_EQUAL(LRi_QUANT(o, 2.f), 0);
+		CU_ASSERT_EQUAL(o->errno, LRerr_InvalidInputValue);
+		CU_ASSERT(isnan(LRd_QUANT(o, .5)));
+		CU_ASSERT_EQUAL(o->errno, LRerr_BadDataType);
+		LR_rm(&o);
+	}
+	o = LR_new(geometric, LR_int);
+	CU_ASSERT_EQUAL(LRi_QUANT(o, .75f), 2);
+	LR_rm(&o);
+	/* large parameters, where the PDF at 0 underflows */
+	o = LR_new(binomial, LR_int);
+	LR_set_all(o, "np", 5000, .5);
+	CU_ASSERT_EQUAL(LRi_QUANT(o, .01f), 2418);
+	CU_ASSERT_EQUAL(LRi_QUANT(o, .5f), 2500);
+	CU_ASSERT_EQUAL(LRi_QUANT(o, .99f), 2582);
+	LR_set_all(o, "np", 1100, .5);
+	CU_ASSERT_EQUAL(LRi_QUANT(o, .01f), 511);
+	CU_ASSERT_EQUAL(LRi_QUANT(o, .5f), 550);
+	CU_ASSERT_EQUAL(LRi_QUANT(o, .99f), 589);
+	LR_rm(&o);
+	o = LR_new(poisson, LR_int);
+	LR_set(o, 'p', 1000.);
+	CU_ASSERT_EQUAL(LRi_QUANT(o, .01f), 927);
+	CU_ASSERT_EQUAL(LRi_QUANT(o, .5f), 1000);
+	CU_ASSERT_EQUAL(LRi_QUANT(o, .99f), 1074);
+	for (int i = 1; i < 100; i++)
+		CU_ASSERT(LRi_QUANT(o, .01f * (i - 1)) <= LRi_QUANT(o, .01f * i));
+	LR_rm(&o);
+}
+
+/* the (scrambled) Sobol sequence & skipping about in it */
+void test_sobol(void) {
+	int		d = 5, m = 10, n = 1 << 10, c[1 << 10];
+	double		u[5 << 10], x[5], sum = 0.0, half = .5, eps = 0x1p-53;
+	LR_sobol	*s = LR_sobol_new(3, 0), *t;
+	LR_obj		*o[3];
+	CU_ASSERT_PTR_NULL(LR_sobol_new(0, 0));
+	CU_ASSERT_PTR_NULL(LR_sobol_new(LR_SOBOL_MAX + 1, 0));
+	/* the plain sequence, in the middle of the bottom 2^-52 interval */
+	CU_ASSERT_EQUAL(LR_sobol_next(s, x), 0);
+	for (int k = 0; k < 3; k++)
+		CU_ASSERT_EQUAL(x[k], eps);
+	CU_ASSERT_EQUAL(LR_sobol_next(s, x), 0);
+	for (int k = 0; k < 3; k++)
+		CU_ASSERT_EQUAL(x[k], half + eps);
+	CU_ASSERT_EQUAL(LR_sobol_next(s, x), 0);
+	CU_ASSERT_EQUAL(x[0], .75 + eps);
+	CU_ASSERT_EQUAL(x[1], .25 + eps);
+	CU_ASSERT_EQUAL(x[2], .25 + eps);
+	CU_ASSERT_EQUAL(LR_sobol_next(s, x), 0);
+	CU_ASSERT_EQUAL(x[0], .25 + eps);
+	CU_ASSERT_EQUAL(x[1], .75 + eps);
+	CU_ASSERT_EQUAL(x[2], .75 + eps);
+	CU_ASSERT_EQUAL(LR_sobol_rm(&s), 0);
+	CU_ASSERT_PTR_NULL(s);
+	/* scrambled, the first 2^m points are still a (0,m,2)-net in the
+	 * first two dimensions and stratified in each one */
+	s = LR_sobol_new(d, 1234);
+	CU_ASSERT_EQUAL(LR_sobol_next_n(s, u, n), 0);
+	for (int k = 0; k < d; k++) {
+		memset(c, 0, sizeof(c));
+		for (int i = 0; i < n; i++)
+			c[(int) (u[i*d + k] * n)]++;
+		for (int i = 0; i < n; i++)
+			CU_ASSERT_EQUAL(c[i], 1);
+	}
+	for (int a = 0; a <= m; a++) {
+		memset(c, 0, sizeof(c));
+		for (int i = 0; i < n; i++)
+			c[((int) (u[i*d] * (1 << a)) << (m - a))
+				+ (int) (u[i*d + 1] * (1 << (m - a)))]++;
+		for (int i = 0; i < n; i++)
+			CU_ASSERT_EQUAL(c[i], 1);
+	}
+	/* skipping to any point, ahead or back, & the same seed */
+	t = LR_sobol_new(d, 1234);
+	for (unsigned long i = 0; i < (unsigned long) n; i += 37) {
+		CU_ASSERT_EQUAL(LR_sobol_skip(t, n - 1 - i), 0);
+		CU_ASSERT_EQUAL(LR_sobol_next(t, x), 0);
+		CU_ASSERT_EQUAL(memcmp(x, u + (n - 1 - i)*d, sizeof(x)), 0);
+		CU_ASSERT_EQUAL(t->i, n - i);
+	}
+	CU_ASSERT_EQUAL(LR_sobol_skip(t, 0), 0);
+	for (int i = 0; i < n; i++) {
+		CU_ASSERT_EQUAL(LR_sobol_next(t, x), 0);
+		CU_ASSERT_EQUAL(memcmp(x, u + i*d, sizeof(x)), 0);
+	}
+	CU_ASSERT_EQUAL(LR_sobol_next_n(t, u, -1), LRerr_InvalidInputValue);
+	CU_ASSERT_EQUAL(LR_sobol_skip(t, ULONG_MAX), 0);
+	CU_ASSERT_EQUAL(LR_sobol_next(t, x), LRerr_TooManyValues);
+	LR_sobol_rm(&t);
+	t = LR_sobol_new(d, 4321);
+	CU_ASSERT_EQUAL(LR_sobol_next(t, x), 0);
+	CU_ASSERT_NOT_EQUAL(memcmp(x, u, sizeof(x)), 0);
+	LR_sobol_rm(&t);
+	LR_sobol_rm(&s);
+	/* E[exp(-(X^2 + Y^2))] = 1/3 for unit Gaussian X & Y, far closer
+	 * than the 1/sqrt(n) of random sampling, and a Poisson mean */
+	s = LR_sobol_new(3, 1234);
+	o[0] = LR_new(gausbm, LR_double);
+	o[1] = LR_new(gausmar, LR_float);
+	o[2] = LR_new(poisson, LR_int);
+	LR_set(o[2], 'p', 4.);
+	for (int i = 0; i < (1 << 14); i++) {
+		CU_ASSERT_EQUAL(LR_sobol_quant(s, o, x), 0);
+		sum += exp(-(x[0]*x[0] + x[1]*x[1]));
+		u[i % n] = x[2];
+		CU_ASSERT_EQUAL(x[2], floor(x[2]));
+	}
+	CU_ASSERT_DOUBLE_EQUAL(sum / (1 << 14), 1./3., 1e-6);
+	sum = 0.0;
+	for (int i = 0; i < n; i++)
+		sum += u[i];
+	CU_ASSERT_DOUBLE_EQUAL(sum / n, 4., .01);
+	for (int k = 0; k < 3; k++)
+		LR_rm(&o[k]);
+	LR_sobol_rm(&s);
+	CU_ASSERT_NOT_EQUAL(LR_sobol_rm(&s), 0);
+}
+
+/* fast math mode gives the same variates & CDFs to within a few ulp */
+void test_fast(void) {
+	LR_type		t[] = {gausbm, cauchy, nexp};
+	double		xd[1001];
+	int		nrv = 1001;
+	LR_obj		*o, *f, *s;
+	LR_spec		*sp;
+	for (int k = 0; k < (int) (sizeof(t)/sizeof(t[0])); k++) {
+		LR_obj	*od = LR_new(t[k], LR_double), *fd = LR_new(t[k], LR_double),
+			*bd = LR_new(t[k], LR_double);
+		CU_ASSERT_EQUAL(LR_fast(od, 0), 0);
+		CU_ASSERT_EQUAL(LR_fast(fd, 1), 0);
+		CU_ASSERT_EQUAL(LR_fast(bd, 1), 0);
+		CU_ASSERT_EQUAL(LRd_RAN_n(bd, xd, nrv), 0);
+		for (int i = 0; i < nrv; i++) {
+			double	d = LRd_RAN(od), e = LRd_RAN(fd);
+			CU_ASSERT_DOUBLE_EQUAL(e, d, 1e-13 * (1. + fabs(d)));
+			CU_ASSERT_DOUBLE_EQUAL(xd[i], d, 1e-13 * (1. + fabs(d)));
+		}
+		LR_rm(&od);
+		LR_rm(&fd);
+		LR_rm(&bd);
+	}
+	/* the Gaussian CDF with the approximate erf */
+	o = LR_new(gausbm, LR_double);
+	f = LR_new(gausbm, LR_double);
+	CU_ASSERT_EQUAL(LR_fast(o, 0), 0);
+	CU_ASSERT_EQUAL(LR_fast(f, 1), 0);
+	for (double x = -8.; x <= 8.; x += .01)
+		CU_ASSERT_DOUBLE_EQUAL(LRd_CDF(f, x), LRd_CDF(o, x), 1e-15);
+	LR_rm(&o);
+	LR_rm(&f);
+	o = LR_new(gausbm, LR_float);
+	f = LR_new(gausbm, LR_float);
+	CU_ASSERT_EQUAL(LR_fast(o, 0), 0);
+	CU_ASSERT_EQUAL(LR_fast(f, 1), 0);
+	for (float x = -8.f; x <= 8.f; x += .01f)
+		CU_ASSERT_DOUBLE_EQUAL(LRf_CDF(f, x), LRf_CDF(o, x), 3e-7);
+	LR_rm(&o);
+	/* the default follows the build, and streams follow their spec */
+	o = LR_new(gausbm, LR_double);
+#ifdef LR_FASTMATH
+	CU_ASSERT(o->flags & LR_OBJ_FAST);
+#else
+	CU_ASSERT_FALSE(o->flags & LR_OBJ_FAST);
+#endif
+	CU_ASSERT_PTR_NOT_NULL(sp = LR_spec_new(&f));
+	CU_ASSERT_PTR_NOT_NULL(s = LR_stream_new(sp));
+	CU_ASSERT(s->flags & LR_OBJ_FAST);
+	CU_ASSERT_EQUAL(LR_fast(s, 0), 0);
+	CU_ASSERT_FALSE(s->flags & LR_OBJ_FAST);
+	CU_ASSERT_NOT_EQUAL(LR_fast(NULL, 1), 0);
+	LR_rm(&s);
+	LR_spec_rm(&sp);
+	LR_rm(&o);
+}
+
+/* every instruction set's batch kernels give urand's uniforms bit for bit */
+void test_isa(void) {
+	const char	*isa[] = {"generic", "sse4.2", "avx2", "avx512"},
+			*def = LR_isa();
+	LR_type		t[] = {unif, nexp, gausbm, cauchy};
+	long		chunk[] = {1, 15, 16, 17, 952}, nrv = 1001;
+	double		xd[1001];
+	float		xf[1001];
+	CU_ASSERT_EQUAL(LR_isa_set("mmx"), LRerr_InvalidInputValue);
+	CU_ASSERT_EQUAL(LR_isa_set("generic"), 0);
+	CU_ASSERT_STRING_EQUAL(LR_isa(), "generic");
+	for (int k = 0; k < (int) (sizeof(isa)/sizeof(isa[0])); k++) {
+		int	e = LR_isa_set(isa[k]);
+		if (e) {
+			CU_ASSERT_EQUAL(e, LRerr_UnmetPreconditions);
+			continue;
+		}
+		CU_ASSERT_STRING_EQUAL(LR_isa(), isa[k]);
+		LR_obj	*od = LR_new(unif, LR_double), *bd = LR_new(unif, LR_double),
+			*of = LR_new(unif, LR_float), *bf = LR_new(unif, LR_float);
+		long	i = 0;
+		for (int j = 0; j < (int) (sizeof(chunk)/sizeof(chunk[0])); j++) {
+			CU_ASSERT_EQUAL(LR_drand_n(bd, xd + i, chunk[j]), 0);
+			CU_ASSERT_EQUAL(LR_frand_n(bf, xf + i, chunk[j]), 0);
+			i += chunk[j];
+		}
+		CU_ASSERT_EQUAL(i, nrv);
+		for (i = 0; i < nrv; i++) {
+			CU_ASSERT_EQUAL(xd[i], LR_drand(od));
+			CU_ASSERT_EQUAL(xf[i], LR_frand(of));
+		}
+		CU_ASSERT_EQUAL(LR_lgetrand(bd), LR_lgetrand(od));
+		CU_ASSERT_EQUAL(LR_igetrand(bf), LR_igetrand(of));
+		CU_ASSERT_EQUAL(LR_drand_n(bd, xd, -1), LRerr_InvalidInputValue);
+		LR_rm(&od);
+		LR_rm(&bd);
+		LR_rm(&of);
+		LR_rm(&bf);
+		/* and the transforms (fast math for double) */
+		for (int m = 0; m < (int) (sizeof(t)/sizeof(t[0])); m++) {
+			od = LR_new(t[m], LR_double);
+			bd = LR_new(t[m], LR_double);
+			of = LR_new(t[m], LR_float);
+			bf = LR_new(t[m], LR_float);
+			CU_ASSERT_EQUAL(LR_fast(od, 0), 0);
+			CU_ASSERT_EQUAL(LR_fast(bd, 1), 0);
+			CU_ASSERT_EQUAL(LRd_RAN_n(bd, xd, nrv), 0);
+			CU_ASSERT_EQUAL(LRf_RAN_n(bf, xf, nrv), 0);
+			for (i = 0; i < nrv; i++) {
+				double	d = LRd_RAN(od);
+				float	f = LRf_RAN(of);
+				CU_ASSERT_DOUBLE_EQUAL(xd[i], d, 1e-13 * (1. + fabs(d)));
+				CU_ASSERT_DOUBLE_EQUAL(xf[i], f, 1e-5 * (1. + fabs(f)));
+			}
+			LR_rm(&od);
+			LR_rm(&bd);
+			LR_rm(&of);
+			LR_rm(&bf);
+		}
+	}
+	CU_ASSERT_EQUAL(LR_isa_set(NULL), 0);
+	CU_ASSERT_STRING_EQUAL(LR_isa(), def);
+	CU_ASSERT_EQUAL(LR_drand_n(NULL, xd, 1), LRerr_InvalidInputValue);
+}
+
+/* the boundary search against a linear scan (with repeated boundaries) */
+void test_bin_search(void) {
+	double	bd[] = {-2., -1., -1., 0., .5, .5, .5, 1., 3., 7., 7.5};
+	int	nbd = sizeof(bd)/sizeof(bd[0]);
+	for (int m = 0; m <= nbd; m++) {
+		LR_bin *b = LR_bin_new(m+1);
+		for (int i = 0; i < m; i++)
+			LR_bin_set(b, bd[i]);
+		for (int k = 0; k < 2*nbd + 2; k++) {
+			double x = (k < nbd ? bd[k] : -2.5 + .5*(k - nbd));
+			int j = 0;
+			while (j < m && !(x < bd[j])) j++;
+			LR_bin_add(b, x);
+			CU_ASSERT_EQUAL(b->bins[j], 1);
+			b->bins[j] = 0;
+		}
+		LR_bin_rm(&b);
+	}
+}
+
 /* distributions */
 #define compCdfPdf(tt,oo,xx,xxh,tol)				\
 CU_ASSERT_DOUBLE_EQUAL(							\
@@ -1097,6 +2857,68 @@ testLRgsn12(2,f,float,25,)
 testLRgsn12(3,f,float,20,LR_set_all(o,"ms",-2.,2.))
 testLRgsn12(4,f,float,30,LR_set_all(o,"ms",1.,.5))
 
+/* gsnN */
+/* the orders with their own type agree, and the k = 1 uniform */
+#define testCdfPdf0gsnN(nn,tt,ttt,del,tol)				\
+void test_cdf_pdf_##tt ## _gsnN ## _##nn(void) {			\
+	LR_obj *o = LR_new(gsnN, LR_##ttt);				\
+	LR_obj *g = LR_new(gsn12, LR_##ttt);				\
+	ttt	w = sqrt(3.);						\
+	for (ttt x = -7.; x <= 7.; x += .05) {				\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _CDF(o,x),LR##tt ## _CDF(g,x),tol)	\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _PDF(o,x),LR##tt ## _PDF(g,x),tol)	\
+	}								\
+	LR_rm(&g);							\
+	g = LR_new(gsn4, LR_##ttt);					\
+	LR_set_all(o,"kms", 4, 1., .5);					\
+	LR_set_all(g,"ab", 1. - w, 1. + w);				\
+	for (ttt x = -1.; x <= 3.; x += .05) {				\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _CDF(o,x),LR##tt ## _CDF(g,x),tol)	\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _PDF(o,x),LR##tt ## _PDF(g,x),tol)	\
+	}								\
+	LR_rm(&g);							\
+	LR_set_all(o,"kms", 1, 0., 1.);					\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _CDF(o,-w-.1),0.,tol)			\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _PDF(o,-w-.1),0.,tol)			\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _CDF(o,-w/2),.25,tol)			\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _PDF(o,-w/2),.5/w,tol)			\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _CDF(o,w/2),.75,tol)			\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _PDF(o,w/2),.5/w,tol)			\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _CDF(o,w+.1),1.,tol)			\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _PDF(o,w+.1),0.,tol)			\
+	/* order 24 is nearer the Gaussian than order 12 */		\
+	LR_set(o,'k', 24);						\
+	for (ttt x = -4.; x <= 4.; x += .1) {				\
+		ttt pp = exp(-.5*x*x)/sqrt(2.*M_PI);			\
+	  compCdfPdf(tt,o,x,x+del,.001)					\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _PDF(o,x),pp,.003)			\
+CU_ASSERT_DOUBLE_EQUAL(LR##tt ## _CDF(o,x)+LR##tt ## _CDF(o,-x),1.,tol)	\
+	}								\
+	/* out of range orders */					\
+	LR_set(o,'k', LR_GSN_MAX + 1);					\
+	CU_ASSERT_EQUAL(LR_check(o),LRerr_InvalidInputValue);		\
+	CU_ASSERT(isnan(LR##tt ## _CDF(o,0.)));				\
+	LR_set(o,'k', 0);						\
+	CU_ASSERT_EQUAL(LR_check(o),LRerr_InvalidInputValue);		\
+	LR_set(o,'k', -3);						\
+	CU_ASSERT_EQUAL(LR_check(o),0);					\
+	CU_ASSERT_EQUAL(o->k,3);					\
+	LR_rm(&o);							\
+}
+
+#define testLRgsnN(nn,tt,ttt,bn,setup)					\
+	testLRfull(gsnN,nn,tt,ttt,4.,bn,100*10007,.1,20,setup)
+
+testCdfPdf0gsnN(0,d,double,.0001,1e-12)
+testLRgsnN(1,d,double,25,LR_set(o,'k',24))
+testLRgsnN(2,d,double,20,LR_set_all(o,"kms",3,-2.,2.))
+testLRgsnN(3,d,double,20,LR_set_all(o,"kms",17,1.,.5))
+
+testCdfPdf0gsnN(0,f,float,.003,2e-5)
+testLRgsnN(1,f,float,25,LR_set(o,'k',24))
+testLRgsnN(2,f,float,20,LR_set_all(o,"kms",3,-2.,2.))
+testLRgsnN(3,f,float,20,LR_set_all(o,"kms",17,1.,.5))
+
 /* lspline */
 /* test some well defined points */
 #define testCdfPdf0lspline(nn,tt,ttt,tol,lo,hi)				\
@@ -2120,6 +3942,83 @@ testLRcheck(3, geometric, i, int,
 	CU_ASSERT_EQUAL(LR_check(o), LRerr_InvalidInputValue);
 )
 
+/* Logarithmic */
+#define testCdfPdf0logd(nn,xp,setup)					\
+void test_cdf_pdf_##xp ## _logd ## _##nn(void) {			\
+	LR_obj *o = LR_new(logd, LR_int);				\
+	LR_set_all(o,"p", . ## xp);					\
+	setup;								\
+}
+
+testCdfPdf0logd(1,25,
+  tryPdfCdf(0,.000000,.000000)
+  tryPdfCdf(1,.869015,.869015)
+  tryPdfCdf(2,.108627,.977642)
+  tryPdfCdf(3,.018104,.995746)
+  tryPdfCdf(5,.000679,.999820)
+  tryPdfCdf(8,.000007,.999998)
+)
+testCdfPdf0logd(2,50,
+  tryPdfCdf(1,.721348,.721348)
+  tryPdfCdf(2,.180337,.901684)
+  tryPdfCdf(3,.060112,.961797)
+  tryPdfCdf(5,.009017,.993356)
+  tryPdfCdf(8,.000704,.999427)
+)
+testCdfPdf0logd(3,90,
+  tryPdfCdf(1,.390865,.390865)
+  tryPdfCdf(2,.175889,.566754)
+  tryPdfCdf(3,.105534,.672288)
+  tryPdfCdf(5,.051289,.794812)
+  tryPdfCdf(8,.023369,.886323)
+  tryPdfCdf(20,.002640,.982960)
+)
+/* the long tail, summed from either end */
+testCdfPdf0logd(4,99,
+  tryPdfCdf(1,.214976,.214976)
+  tryPdfCdf(10,.019638,.614783)
+  tryPdfCdf(100,.000795,.953158)
+  tryPdfCdf(500,.000003,.999759)
+  tryPdfCdf(1000,.000000,.999999)
+  tryPdfCdf(2000,.000000,1.000000)
+)
+testCdfPdf0logd(5,9999,
+  tryPdfCdf(1,.108565,.108565)
+  tryPdfCdf(100,.001075,.562139)
+  tryPdfCdf(10000,.000004,.976191)
+  tryPdfCdf(100000,.000000,.999999)
+  tryPdfCdf(200000,.000000,1.000000)
+)
+
+#define testLRlogd(nn,bn,setup)					\
+	testLRdisc(logd,nn,bn,50*10007,.1,100,setup)
+
+testLRlogd(1,10, )
+testLRlogd(2,10, LR_set_all(o,"p", .2); )
+testLRlogd(3,20, LR_set_all(o,"p", .75); )
+testLRlogd(4,25, LR_set_all(o,"p", .9); )
+testLRlogd(5,40, LR_set_all(o,"p", .99); )
+
+testLRcheck(1, logd, i, int, 
+	LR_set_all(o, "p", -.5);
+	CU_ASSERT_EQUAL(LR_check(o), LRerr_OK);
+)
+testLRcheck(2, logd, i, int, 
+	LR_set_all(o, "p", 0.0);
+	CU_ASSERT_EQUAL(LR_check(o), LRerr_InvalidInputValue);
+)
+testLRcheck(3, logd, i, int, 
+	LR_set_all(o, "p", 1.0);
+	CU_ASSERT_EQUAL(LR_check(o), LRerr_InvalidInputValue);
+)
+/* next to 1, where log(q) may vanish */
+testLRcheck(4, logd, i, int, 
+	LR_set_all(o, "p", (double) nextafterf(1.f, 0.f));
+	CU_ASSERT_EQUAL(LR_check(o), LRerr_OK);
+	for (int i = 0; i < 10000; i++)
+		CU_ASSERT(LRi_RAN(o) >= 1);
+)
+
 /* Binomial */
 #define testCdfPdf0binom(nn,xp,mm,setup)				\
 void test_cdf_pdf_##xp ## _binomial ## _##nn(void) {			\
@@ -2149,6 +4048,14 @@ testCdfPdf0binom(3,80, 10,
   tryPdfCdf(8,.301990,.624190)
   tryPdfCdf(10,.107374,1.000000)
 )
+/* large n, around the mode (350000) */
+testCdfPdf0binom(4,35, 1000000,
+  tryPdfCdf(0,.000000,.000000)
+  tryPdfCdf(349000,.000093,.018047)
+  tryPdfCdf(350000,.000836,.500465)
+  tryPdfCdf(351000,.000093,.982015)
+  tryPdfCdf(1000000,.000000,1.000000)
+)
 
 #define testLRbinom(nn,bn,setup)					\
 	testLRdisc(binomial,nn,bn,50*10007,.1,100,			\
@@ -2270,6 +4177,9 @@ if ((NULL == CU_add_test(pS,"errors", test_LR_errors))
 ||  (NULL == CU_add_test(pS,"new - float", test_new_float))
 ||  (NULL == CU_add_test(pS,"new - long", test_new_long))
 ||  (NULL == CU_add_test(pS,"new - double", test_new_double))
+||  (NULL == CU_add_test(pS,"layout", test_LR_layout))
+||  (NULL == CU_add_test(pS,"arena", test_LR_arena))
+||  (NULL == CU_add_test(pS,"init", test_LR_init))
 ||  (NULL == CU_add_test(pS,"set - int", test_set_int))
 ||  (NULL == CU_add_test(pS,"set - float", test_set_float))
 ||  (NULL == CU_add_test(pS,"set - long", test_set_long))
@@ -2307,12 +4217,33 @@ if ((NULL == CU_add_test(pS,"errors", test_LR_errors))
 ||  (NULL == CU_add_test(pS,"check - f - 7",test_check_uinvcdf_f_7))
 ||  (NULL == CU_add_test(pS,"check - f - 8",test_check_uinvcdf_f_8))
 ||  (NULL == CU_add_test(pS,"check - f - 9",test_check_uinvcdf_f_9))
+||  (NULL == CU_add_test(pS,"freeze - d - 10",test_check_gausbm_d_10))
+||  (NULL == CU_add_test(pS,"freeze - d - 11",test_check_nexp_d_11))
+||  (NULL == CU_add_test(pS,"freeze - d - 12",test_check_cauchy_d_12))
+||  (NULL == CU_add_test(pS,"freeze - f - 10",test_check_gsn2_f_10))
+||  (NULL == CU_add_test(pS,"freeze - i - 10",test_check_poisson_i_10))
+||  (NULL == CU_add_test(pS,"freeze - i - 11",test_check_poisson_i_11))
 ||  (NULL == CU_add_test(pS,"indep seq - 1",test_indep_seq_1))
 ||  (NULL == CU_add_test(pS,"indep seq - 2",test_indep_seq_2))
 ||  (NULL == CU_add_test(pS,"indep seq - 3",test_indep_seq_3))
 ||  (NULL == CU_add_test(pS,"indep seq - 4",test_indep_seq_4))
 ||  (NULL == CU_add_test(pS,"indep seq - 5",test_indep_seq_5))
 ||  (NULL == CU_add_test(pS,"indep seq - 6",test_indep_seq_6))
+||  (NULL == CU_add_test(pS,"thread - 1",test_thread_unif_1))
+||  (NULL == CU_add_test(pS,"thread - 2",test_thread_gausbm_2))
+||  (NULL == CU_add_test(pS,"thread - 3",test_thread_gausmar_3))
+||  (NULL == CU_add_test(pS,"thread - 4",test_thread_gsn4_4))
+||  (NULL == CU_add_test(pS,"thread - 5",test_thread_gsn12_5))
+||  (NULL == CU_add_test(pS,"thread - 6",test_thread_nexp_6))
+||  (NULL == CU_add_test(pS,"thread - 7",test_thread_erlang_7))
+||  (NULL == CU_add_test(pS,"thread - 8",test_thread_poisson_8))
+||  (NULL == CU_add_test(pS,"thread - 9",test_thread_geometric_9))
+||  (NULL == CU_add_test(pS,"thread - 10",test_thread_binomial_10))
+||  (NULL == CU_add_test(pS,"thread - 11",test_thread_uinvcdf_11))
+||  (NULL == CU_add_test(pS,"spec - 1",test_spec_piece_1))
+||  (NULL == CU_add_test(pS,"spec - 2",test_spec_lspline_2))
+||  (NULL == CU_add_test(pS,"spec - 3",test_spec_gausbm_3))
+||  (NULL == CU_add_test(pS,"spec - 4",test_spec_uinvcdf_4))
 /*
 ||  (NULL == CU_add_test(pS,"new_bin - int", test_bin_new_int))
 ||  (NULL == CU_add_test(pS,"new_bin - float", test_bin_new_float))
@@ -2327,6 +4258,70 @@ if ((NULL == CU_add_test(pS,"errors", test_LR_errors))
 ||  (NULL == CU_add_test(pS,"new_bin_add - 2", test_bin_add_2))
 ||  (NULL == CU_add_test(pS,"new_bin_add - 3", test_bin_add_3))
 ||  (NULL == CU_add_test(pS,"new_bin_add - 4", test_bin_add_4))
+||  (NULL == CU_add_test(pS,"new_bin_unif - 1", test_bin_unif_1))
+||  (NULL == CU_add_test(pS,"new_bin_unif - 2", test_bin_unif_2))
+||  (NULL == CU_add_test(pS,"new_bin_unif - 3", test_bin_unif_3))
+||  (NULL == CU_add_test(pS,"new_bin_unif - 4", test_bin_unif_4))
+||  (NULL == CU_add_test(pS,"new_bin_search", test_bin_search))
+||  (NULL == CU_add_test(pS,"new_bin_add_n - 1", test_bin_add_n_1))
+||  (NULL == CU_add_test(pS,"new_bin_add_n - 2", test_bin_add_n_2))
+||  (NULL == CU_add_test(pS,"new_bin_add_n - 3", test_bin_add_n_3))
+||  (NULL == CU_add_test(pS,"new_bin_add_n - 4", test_bin_add_n_4))
+||  (NULL == CU_add_test(pS,"new_bin_add_n - 5", test_bin_add_n_5))
+||  (NULL == CU_add_test(pS,"new_bin_add_n - 6", test_bin_add_n_6))
+||  (NULL == CU_add_test(pS,"bin_merge - 1", test_bin_merge_1))
+||  (NULL == CU_add_test(pS,"bin_merge - 2", test_bin_merge_2))
+||  (NULL == CU_add_test(pS,"bin_merge - 3", test_bin_merge_3))
+||  (NULL == CU_add_test(pS,"bin_merge - 4", test_bin_merge_4))
+||  (NULL == CU_add_test(pS,"new_bin_array", test_bin_new_array))
+||  (NULL == CU_add_test(pS,"new_bin_log", test_bin_new_log))
+||  (NULL == CU_add_test(pS,"new_bin_geom", test_bin_new_geom))
+||  (NULL == CU_add_test(pS,"new_bin_quantile - 1", test_bin_new_quant_1))
+||  (NULL == CU_add_test(pS,"new_bin_quantile - 2", test_bin_new_quant_2))
+||  (NULL == CU_add_test(pS,"new_bin_quantile - 3", test_bin_new_quant_3))
+||  (NULL == CU_add_test(pS,"new_bin_quantile - 4", test_bin_new_quant_4))
+||  (NULL == CU_add_test(pS,"new_bin_quantile - 5", test_bin_new_quant_5))
+||  (NULL == CU_add_test(pS,"new_bin_quantile - 6", test_bin_new_quant_6))
+||  (NULL == CU_add_test(pS,"new_bin_quantile - disc", test_bin_new_quant_disc))
+||  (NULL == CU_add_test(pS,"new_bin_quantile - binom 1", test_bin_new_quant_binom_1))
+||  (NULL == CU_add_test(pS,"new_bin_quantile - binom 2", test_bin_new_quant_binom_2))
+||  (NULL == CU_add_test(pS,"new_bin_quantile - binom 3", test_bin_new_quant_binom_3))
+||  (NULL == CU_add_test(pS,"new_bin_quantile - binom 4", test_bin_new_quant_binom_4))
+||  (NULL == CU_add_test(pS,"bin_weighted - 1", test_bin_weighted_1))
+||  (NULL == CU_add_test(pS,"bin_weighted - 2", test_bin_weighted_2))
+||  (NULL == CU_add_test(pS,"bin_weighted - sums", test_bin_weighted_sums))
+||  (NULL == CU_add_test(pS,"ibin - 1", test_ibin_1))
+||  (NULL == CU_add_test(pS,"ibin - 2", test_ibin_2))
+||  (NULL == CU_add_test(pS,"ibin - 3", test_ibin_3))
+||  (NULL == CU_add_test(pS,"ibin - 4", test_ibin_4))
+||  (NULL == CU_add_test(pS,"ibin_keys", test_ibin_keys))
+||  (NULL == CU_add_test(pS,"stats_known", test_stats_known))
+||  (NULL == CU_add_test(pS,"stats - 1", test_stats_1))
+||  (NULL == CU_add_test(pS,"stats - 2", test_stats_2))
+||  (NULL == CU_add_test(pS,"stats - 3", test_stats_3))
+||  (NULL == CU_add_test(pS,"stats - 4", test_stats_4))
+||  (NULL == CU_add_test(pS,"stats_threads", test_stats_threads))
+||  (NULL == CU_add_test(pS,"kll_exact", test_kll_exact))
+||  (NULL == CU_add_test(pS,"kll - 1", test_kll_1))
+||  (NULL == CU_add_test(pS,"kll - 2", test_kll_2))
+||  (NULL == CU_add_test(pS,"kll - 3", test_kll_3))
+||  (NULL == CU_add_test(pS,"kll - 4", test_kll_4))
+||  (NULL == CU_add_test(pS,"kll_merge", test_kll_merge))
+||  (NULL == CU_add_test(pS,"gof_known", test_gof_known))
+||  (NULL == CU_add_test(pS,"gof - 1", test_gof_1))
+||  (NULL == CU_add_test(pS,"gof - 2", test_gof_2))
+||  (NULL == CU_add_test(pS,"gof - 3", test_gof_3))
+||  (NULL == CU_add_test(pS,"gof - 4", test_gof_4))
+||  (NULL == CU_add_test(pS,"gof - 5", test_gof_5))
+||  (NULL == CU_add_test(pS,"gof_spec", test_gof_spec))
+||  (NULL == CU_add_test(pS,"spectral", test_spectral))
+||  (NULL == CU_add_test(pS,"battery", test_battery))
+||  (NULL == CU_add_test(pS,"counters", test_counters))
+||  (NULL == CU_add_test(pS,"RAN_n", test_RAN_n))
+||  (NULL == CU_add_test(pS,"quant", test_quant))
+||  (NULL == CU_add_test(pS,"sobol", test_sobol))
+||  (NULL == CU_add_test(pS,"fast", test_fast))
+||  (NULL == CU_add_test(pS,"isa", test_isa))
 ||  (NULL == CU_add_test(pS,"bad data type - 1", test_bad_d_dt_1))
 ||  (NULL == CU_add_test(pS,"bad data type - 2", test_bad_f_dt_2))
 ||  (NULL == CU_add_test(pS,"bad data type - 3", test_bad_d_dt_3))
@@ -2460,6 +4455,14 @@ if ((NULL == CU_add_test(pSint,"Unif-P/CDF-d-0", test_cdf_pdf_d_unif_0))
 ||  (NULL == CU_add_test(pSint,"Gsn12-Ran-f-2", test_gsn12_f_2))
 ||  (NULL == CU_add_test(pSint,"Gsn12-Ran-f-3", test_gsn12_f_3))
 ||  (NULL == CU_add_test(pSint,"Gsn12-Ran-f-4", test_gsn12_f_4))
+||  (NULL == CU_add_test(pSint,"GsnN-P/CDF-d-0", test_cdf_pdf_d_gsnN_0))
+||  (NULL == CU_add_test(pSint,"GsnN-Ran-d-1", test_gsnN_d_1))
+||  (NULL == CU_add_test(pSint,"GsnN-Ran-d-2", test_gsnN_d_2))
+||  (NULL == CU_add_test(pSint,"GsnN-Ran-d-3", test_gsnN_d_3))
+||  (NULL == CU_add_test(pSint,"GsnN-P/CDF-f-0", test_cdf_pdf_f_gsnN_0))
+||  (NULL == CU_add_test(pSint,"GsnN-Ran-f-1", test_gsnN_f_1))
+||  (NULL == CU_add_test(pSint,"GsnN-Ran-f-2", test_gsnN_f_2))
+||  (NULL == CU_add_test(pSint,"GsnN-Ran-f-3", test_gsnN_f_3))
 ||  (NULL == CU_add_test(pSint,"Lspline-P/CDF-d-0",test_cdf_pdf_d_lspline_0))
 ||  (NULL == CU_add_test(pSint,"Lspline-P/CDF-d-1",test_cdf_pdf_d_lspline_1))
 ||  (NULL == CU_add_test(pSint,"Lspline-P/CDF-d-2",test_cdf_pdf_d_lspline_2))
@@ -2694,9 +4697,24 @@ if ((NULL == CU_add_test(pSdisc,"Poisson-P/CDF-1-1", test_cdf_pdf_1_poisson_1))
 ||  (NULL == CU_add_test(pSdisc,"check - Geom - 1",test_check_geometric_i_1))
 ||  (NULL == CU_add_test(pSdisc,"check - Geom - 2",test_check_geometric_i_2))
 ||  (NULL == CU_add_test(pSdisc,"check - Geom - 3",test_check_geometric_i_3))
+||  (NULL == CU_add_test(pSdisc,"Logd-P/CDF-25-1", test_cdf_pdf_25_logd_1))
+||  (NULL == CU_add_test(pSdisc,"Logd-P/CDF-50-2", test_cdf_pdf_50_logd_2))
+||  (NULL == CU_add_test(pSdisc,"Logd-P/CDF-90-3", test_cdf_pdf_90_logd_3))
+||  (NULL == CU_add_test(pSdisc,"Logd-P/CDF-99-4", test_cdf_pdf_99_logd_4))
+||  (NULL == CU_add_test(pSdisc,"Logd-P/CDF-9999-5", test_cdf_pdf_9999_logd_5))
+||  (NULL == CU_add_test(pSdisc,"Logd-Ran-def-1", test_logd_i_1))
+||  (NULL == CU_add_test(pSdisc,"Logd-Ran-20-2", test_logd_i_2))
+||  (NULL == CU_add_test(pSdisc,"Logd-Ran-75-3", test_logd_i_3))
+||  (NULL == CU_add_test(pSdisc,"Logd-Ran-90-4", test_logd_i_4))
+||  (NULL == CU_add_test(pSdisc,"Logd-Ran-99-5", test_logd_i_5))
+||  (NULL == CU_add_test(pSdisc,"check - Logd - 1",test_check_logd_i_1))
+||  (NULL == CU_add_test(pSdisc,"check - Logd - 2",test_check_logd_i_2))
+||  (NULL == CU_add_test(pSdisc,"check - Logd - 3",test_check_logd_i_3))
+||  (NULL == CU_add_test(pSdisc,"check - Logd - 4",test_check_logd_i_4))
 ||  (NULL == CU_add_test(pSdisc,"Binom-P/CDF-25-1", test_cdf_pdf_25_binomial_1))
 ||  (NULL == CU_add_test(pSdisc,"Binom-P/CDF-50-2", test_cdf_pdf_50_binomial_2))
 ||  (NULL == CU_add_test(pSdisc,"Binom-P/CDF-75-3", test_cdf_pdf_80_binomial_3))
+||  (NULL == CU_add_test(pSdisc,"Binom-P/CDF-35-4", test_cdf_pdf_35_binomial_4))
 ||  (NULL == CU_add_test(pSdisc,"Binomial-Ran-def-1", test_binomial_i_1))
 ||  (NULL == CU_add_test(pSdisc,"Binomial-Ran-50-1", test_binomial_i_2))
 ||  (NULL == CU_add_test(pSdisc,"Binomial-Ran-20-1", test_binomial_i_3))
@@ -74,41 +74,34 @@ extern "C" {
 #include "libran.h"	/* LR_obj, LR_val */
 #include <string.h>	/* strcmp */
 
-/* global variables */
-/* random sequence values */
-/*
-int	lr_iy = 0, lr_iy0 = 0;
-long	lr_ly = 0, lr_ly0 = 0;
-*/
-float	lr_fscale, lr_fhalfm;
-double	lr_dscale, lr_dhalfm;
-int	lr_ia = 0, lr_ic = 0, lr_imc = 0;
-long	lr_la = 0, lr_lc = 0, lr_lmc = 0;
-
 #define SQRT3 1.7320508075688772935
 #define PI 3.141592653589793238462643
 
-void _set_rand(void) {
-	extern float lr_fscale, lr_fhalfm;
-	extern double lr_dscale, lr_dhalfm;
-	extern int lr_ia, lr_ic, lr_imc;
-	extern long lr_la, lr_lc, lr_lmc;
-
-	lr_fhalfm = (float) LR_IRAND_IMAX2;
-	lr_dhalfm = (double) LR_IRAND_LMAX2;
-
+/* urand constants
+ *
+ * These are fixed by the configuration step and are computed here at
+ * compile time, so there is no first-entry initialization and no shared
+ * mutable state between threads.  Each LR_obj carries its own sequence.
+ */
 /*  COMPUTE MULTIPLIER AND INCREMENT FOR LINEAR CONGRUENTIAL METHOD */
-	lr_ia = ((int) (lr_fhalfm * PI / 32.) << 3) + 5;
-	lr_ic = ((int) (lr_fhalfm * (.5 - SQRT3 / 6.)) << 1) + 1;
-	lr_imc = (LR_IRAND_IMAX2 - lr_ic) + LR_IRAND_IMAX2;
-	lr_la = ((long) (lr_dhalfm * PI / 32.) << 3) + 5;
-	lr_lc = ((long) (lr_dhalfm * (.5 - SQRT3 / 6.)) << 1) + 1;
-	lr_lmc = (LR_IRAND_LMAX2 - lr_lc) + LR_IRAND_LMAX2;
+#define LR_IA	(((int) (((float) LR_IRAND_IMAX2) * PI / 32.) << 3) + 5)
+#define LR_IC	(((int) (((float) LR_IRAND_IMAX2) * (.5 - SQRT3 / 6.)) << 1) + 1)
+#define LR_LA	(((long) (((double) LR_IRAND_LMAX2) * PI / 32.) << 3) + 5)
+#define LR_LC	(((long) (((double) LR_IRAND_LMAX2) * (.5 - SQRT3 / 6.)) << 1) + 1)
+
+static const int  lr_ia  = LR_IA;
+static const int  lr_ic  = LR_IC;
+static const int  lr_imc = (LR_IRAND_IMAX2 - LR_IC) + LR_IRAND_IMAX2;
+static const long lr_la  = LR_LA;
+static const long lr_lc  = LR_LC;
+static const long lr_lmc = (LR_IRAND_LMAX2 - LR_LC) + LR_IRAND_LMAX2;
 
 /*  SCALE FACTOR FOR CONVERTING TO FLOATING POINT */
-	lr_fscale = .5 / lr_fhalfm;
-	lr_dscale = .5 / lr_dhalfm;
-}
+static const float  lr_fscale = .5 / ((float) LR_IRAND_IMAX2);
+static const double lr_dscale = .5 / ((double) LR_IRAND_LMAX2);
+/*  LARGEST VALUES BELOW 1 (THE CONVERSIONS ABOVE MAY ROUND UP TO 1) */
+static const float  lr_fmax = 1.f - 1.f / 16777216.f;
+static const double lr_dmax = 1. - 1. / 9007199254740992.;
 
 /*!
 @brief	LR_irand(LR_obj *) - returns int       in range [0,LR_IRAND_IMAX]
@@ -119,13 +112,7 @@ Returns a pseudo-random \e int in the range [0,LR_IRAND_MAX]
 @return int	range [0, LR_IRAND_IMAX]
 */
 int LR_irand(LR_obj *o) {
-	/* extern int lr_iy, lr_iy0; */
-	extern float lr_fscale, lr_fhalfm;
-	extern int lr_ia, lr_ic, lr_imc;
-
-/*  IF FIRST ENTRY, COMPUTE URAND CONSTANTS */
-	if (lr_ia == 0) _set_rand();
-
+	LR_COUNT(o, uniforms, 1);
 /*  COMPUTE NEXT RANDOM NUMBER */
 	o->iy.i *= lr_ia;
 /*  THE FOLLOWING STATEMENT IS FOR COMPUTERS WHICH DO NOT ALLOW */
@@ -191,13 +178,12 @@ Returns a pseudo-random \e float in the range [0.0, 1.0)
 @return float	range [0.0, 1.0)
 */
 float LR_frand(LR_obj *o) {
-	/* extern int lr_iy; */
-	extern float lr_fscale;
 
 /*  COMPUTE NEXT RANDOM NUMBER */
 	LR_irand(o);
 
-	return (float) (o->iy.i) * lr_fscale;
+	float x = (float) (o->iy.i) * lr_fscale;
+	return (x < lr_fmax ? x : lr_fmax);
 }
 
 /*!
@@ -210,11 +196,6 @@ Set the seed for this \c LR_obj .
 @return void
 */
 void LR_isetseed(LR_obj *o, int X) {
-	/* extern int lr_iy, lr_iy0; */
-	extern int lr_ia;
-
-/*  IF FIRST ENTRY, COMPUTE URAND CONSTANTS */
-	if (lr_ia == 0) _set_rand();
 
 	o->iy.i = o->iy0.i = X;
 }
@@ -228,7 +209,6 @@ Get the seed from this \c LR_obj .
 @return int	current object seed
 */
 int LR_igetseed(LR_obj *o) {
-	/* extern int lr_iy0; */
 	return o->iy0.i;
 }
 
@@ -241,7 +221,6 @@ Get the current pseudo-random number from this \c LR_obj .
 @return int	current pseudo-random number
 */
 int LR_igetrand(LR_obj *o) {
-	/* extern int lr_iy; */
 	return o->iy.i;
 }
 
@@ -254,9 +233,8 @@ Get the current pseudo-random number from this \c LR_obj .
 @return float	current pseudo-random number
 */
 float LR_fgetrand(LR_obj *o) {
-	/* extern int lr_iy; */
-	extern float lr_fscale;
-	return (float) (o->iy.i) * lr_fscale;
+	float x = (float) (o->iy.i) * lr_fscale;
+	return (x < lr_fmax ? x : lr_fmax);
 }
 
 /*!
@@ -268,13 +246,7 @@ Returns a pseudo-random \e int in the range [0,LR_IRAND_LMAX]
 @return int	range [0, LR_IRAND_LMAX]
 */
 long LR_lrand(LR_obj *o) {
-	/* extern long lr_ly, lr_ly0; */
-	extern double lr_dscale, lr_dhalfm;
-	extern long lr_la, lr_lc, lr_lmc;
-
-/*  IF FIRST ENTRY, COMPUTE URAND CONSTANTS */
-	if (lr_la == 0) _set_rand();
-
+	LR_COUNT(o, uniforms, 1);
 /*  COMPUTE NEXT RANDOM NUMBER */
 	o->iy.l *= lr_la;
 /*  THE FOLLOWING STATEMENT IS FOR COMPUTERS WHICH DO NOT ALLOW */
@@ -340,13 +312,12 @@ Returns a pseudo-random \e double in the range [0.0, 1.0)
 @return double	range [0.0, 1.0)
 */
 double LR_drand(LR_obj *o) {
-	/* extern long lr_ly; */
-	extern double lr_dscale;
 
 /*  COMPUTE NEXT RANDOM NUMBER */
 	LR_lrand(o);
 
-	return (double) (o->iy.l) * lr_dscale;
+	double x = (double) (o->iy.l) * lr_dscale;
+	return (x < lr_dmax ? x : lr_dmax);
 }
 
 /*!
@@ -359,11 +330,6 @@ Set the seed for this \c LR_obj .
 @return void
 */
 void LR_lsetseed(LR_obj *o, long X) {
-	/* extern long lr_ly, lr_ly0; */
-	extern long lr_la;
-
-/*  IF FIRST ENTRY, COMPUTE URAND CONSTANTS */
-	if (lr_la == 0) _set_rand();
 
 	o->iy.l = o->iy0.l = X;
 }
@@ -377,7 +343,6 @@ Get the seed from this \c LR_obj .
 @return long	current object seed
 */
 long LR_lgetseed(LR_obj *o) {
-	/* extern long lr_ly0; */
 	return o->iy0.l;
 }
 
@@ -390,7 +355,6 @@ Get the current pseudo-random number from this \c LR_obj .
 @return long	current pseudo-random number
 */
 long LR_lgetrand(LR_obj *o) {
-	/* extern long lr_ly; */
 	return o->iy.l;
 }
 
@@ -403,16 +367,16 @@ Get the current pseudo-random number from this \c LR_obj .
 @return double	current pseudo-random number
 */
 double LR_dgetrand(LR_obj *o) {
-	/* extern long lr_ly; */
-	extern double lr_dscale;
-	return (double) (o->iy.l) * lr_dscale;
+	double x = (double) (o->iy.l) * lr_dscale;
+	return (x < lr_dmax ? x : lr_dmax);
 }
 
 /*!
 @brief	LR_igetval(char *val) - return the configure value
 
 Return the value computed from the library configuration step, such as
-\c LR_IRAND_IMAX2 , \c LR_IRAND_IMAX , and \c LR_IRAND_INOT .
+\c LR_IRAND_IMAX2 , \c LR_IRAND_IMAX , and \c LR_IRAND_INOT ,
+or the multiplier \c LR_IA and increment \c LR_IC of the generator.
 
 \see urand/config.h
 
@@ -426,6 +390,10 @@ int LR_igetval(char *val) {
 		return	LR_IRAND_IMAX;
 	else if (!strcmp(val, "LR_IRAND_INOT"))
 		return	LR_IRAND_INOT;
+	else if (!strcmp(val, "LR_IA"))
+		return	lr_ia;
+	else if (!strcmp(val, "LR_IC"))
+		return	lr_ic;
 	return 0;
 }
 
@@ -433,7 +401,8 @@ int LR_igetval(char *val) {
 @brief	LR_lgetval(char *val) - return the configure value
 
 Return the value computed from the library configuration step, such as
-\c LR_IRAND_LMAX2 , \c LR_IRAND_LMAX , and \c LR_IRAND_LNOT .
+\c LR_IRAND_LMAX2 , \c LR_IRAND_LMAX , and \c LR_IRAND_LNOT ,
+or the multiplier \c LR_LA and increment \c LR_LC of the generator.
 
 \see urand/config.h
 
@@ -447,6 +416,10 @@ long LR_lgetval(char *val) {
 		return	LR_IRAND_LMAX;
 	else if (!strcmp(val, "LR_IRAND_LNOT"))
 		return	LR_IRAND_LNOT;
+	else if (!strcmp(val, "LR_LA"))
+		return	lr_la;
+	else if (!strcmp(val, "LR_LC"))
+		return	lr_lc;
 	return 0;
 }
 
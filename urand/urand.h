@@ -35,9 +35,8 @@ static const char RCSID[]="$Id: urand.c 106 2002-02-10 08:02:39Z rk $";
  *  LR_igetval()	- returns URAND int  configuration values
  *  LR_lgetval()	- returns URAND long configuration values
  *
- *  extern INTEGER IRAND_MAX	- the maximum value returned by irand
- *				  it's only defined after a call to
- *				  urand(), irand(), or setseed().
+ *  All urand constants are fixed at compile time; the only state is
+ *  the sequence value carried in each LR_obj .
  */
 
 #ifndef	_URAND_H_
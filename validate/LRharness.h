@@ -0,0 +1,166 @@
+/*!
+\file	LRharness.h
+\brief	What the validation and benchmark programs share
+
+The `LR_type` and data type combinations, each set up with typical
+attributes, a monotonic clock, and JSON output of numbers.
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#ifndef _LRHARNESS_H_
+#  define _LRHARNESS_H_
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "libran.h"
+
+/* the test setups */
+static void setup_piece(LR_obj *o) {
+	double	a = -2.0;
+
+	LR_aux_new(o, 6);
+	LR_set_all(o, "abx", a, 6.0, 4.0);
+	LR_aux_set(o, a + 2.0, 1.0);
+	LR_aux_set(o, a + 3.0, 3.0);
+	LR_aux_set(o, a + 4.0, 0.0);
+	LR_aux_set(o, a + 5.0, 5.0);
+	LR_aux_set(o, a + 7.0, 2.0);
+	LR_aux_norm(o);
+}
+static void setup_lspline(LR_obj *o) {
+	double	a = -2.0;
+
+	LR_aux_new(o, 6);
+	LR_set_all(o, "ab", a, 6.0);
+	LR_aux_set(o, a + 2.0, 1.0);
+	LR_aux_set(o, a + 3.0, 3.0);
+	LR_aux_set(o, a + 4.0, 0.0);
+	LR_aux_set(o, a + 5.0, 5.0);
+	LR_aux_set(o, a + 7.0, 2.0);
+	LR_aux_norm(o);
+}
+/* Cauchy CDF (moved by 0.5) */
+static double cdf_cauchyd(double x) {
+	return 0.5 + M_1_PI * atan(x - 0.5);
+}
+static float cdf_cauchyf(float x) {
+	return 0.5f + (float) M_1_PI * atanf(x - 0.5f);
+}
+static void setup_uinvcdf(LR_obj *o) {
+	if (o->d == LR_double)
+		LRd_uinvcdf(o, cdf_cauchyd);
+	else
+		LRf_uinvcdf(o, cdf_cauchyf);
+	LR_set_all(o, "ms", .5, 1.);
+}
+static void setup_gsnN(LR_obj *o) {
+	LR_set_all(o, "kms", 24, .5, 2.);
+}
+static void setup_erlang(LR_obj *o) {
+	LR_set_all(o, "km", 3, 1.5);
+}
+static void setup_poisson(LR_obj *o) {
+	LR_set(o, 'p', 3.5);
+}
+static void setup_geometric(LR_obj *o) {
+	LR_set(o, 'p', .35);
+}
+static void setup_logd(LR_obj *o) {
+	LR_set(o, 'p', .9);
+}
+static void setup_binomial(LR_obj *o) {
+	LR_set_all(o, "np", 10, .35);
+}
+
+/* each combination - slow ones use 1/div as many samples */
+typedef struct {
+	LR_type		t;
+	LR_data_type	d;
+	int		div;
+	void		(*setup)(LR_obj *o);
+} vcase;
+
+static vcase cases[] = {
+	{poisson,	LR_int,		1,	setup_poisson},
+	{geometric,	LR_int,		1,	setup_geometric},
+	{logd,		LR_int,		1,	setup_logd},
+	{binomial,	LR_int,		1,	setup_binomial},
+	{unif,		LR_double,	1,	NULL},
+	{unif,		LR_float,	1,	NULL},
+	{piece,		LR_double,	1,	setup_piece},
+	{piece,		LR_float,	1,	setup_piece},
+	{lspline,	LR_double,	1,	setup_lspline},
+	{lspline,	LR_float,	1,	setup_lspline},
+	{uinvcdf,	LR_double,	100,	setup_uinvcdf},
+	{uinvcdf,	LR_float,	100,	setup_uinvcdf},
+	{gausbm,	LR_double,	1,	NULL},
+	{gausbm,	LR_float,	1,	NULL},
+	{gausmar,	LR_double,	1,	NULL},
+	{gausmar,	LR_float,	1,	NULL},
+	{gsn2,		LR_double,	1,	NULL},
+	{gsn2,		LR_float,	1,	NULL},
+	{gsn4,		LR_double,	1,	NULL},
+	{gsn4,		LR_float,	1,	NULL},
+	{gsn12,		LR_double,	1,	NULL},
+	{gsn12,		LR_float,	1,	NULL},
+	{gsnN,		LR_double,	2,	setup_gsnN},
+	{gsnN,		LR_float,	2,	setup_gsnN},
+	{nexp,		LR_double,	1,	NULL},
+	{nexp,		LR_float,	1,	NULL},
+	{erlang,	LR_double,	1,	setup_erlang},
+	{erlang,	LR_float,	1,	setup_erlang},
+	{cauchy,	LR_double,	1,	NULL},
+	{cauchy,	LR_float,	1,	NULL},
+	{cauchymar,	LR_double,	1,	NULL},
+	{cauchymar,	LR_float,	1,	NULL},
+};
+#define NCASES	((int) (sizeof(cases) / sizeof(cases[0])))
+
+static LR_obj *make(vcase *c) {
+	LR_obj	*o = LR_new(c->t, c->d);
+
+	if (o && c->setup)
+		c->setup(o);
+	return o;
+}
+
+static const char *dname(LR_data_type d) {
+	return (d == LR_int ? "int" : (d == LR_long ? "long"
+		: (d == LR_float ? "float" : "double")));
+}
+
+/* is the case one of the named types (or none named) */
+static int wanted(vcase *c, int argc, char **argv) {
+	LR_obj	*o;
+	int	ok = 0;
+
+	if (!argc)
+		return 1;
+	if (!(o = LR_new(c->t, c->d)))
+		return 0;
+	for (int i = 0; i < argc && !ok; i++)
+		ok = !strcmp(argv[i], o->ops->type);
+	LR_rm(&o);
+	return ok;
+}
+
+/* JSON has no NaN or Infinity */
+static void jnum(FILE *fp, double x) {
+	if (isfinite(x))
+		fprintf(fp, "%.6g", x);
+	else
+		fprintf(fp, "null");
+}
+
+static double now(void) {
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+#endif /* _LRHARNESS_H_ */
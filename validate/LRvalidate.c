@@ -0,0 +1,155 @@
+/*!
+\file	LRvalidate.c
+\brief	Large-scale statistical validation of the LibRan distributions
+
+Every `LR_type` and data type combination is sampled many times
+(10^8 by default) in as many threads as there are cores, and the
+samples are tested against the analytic CDF of the distribution
+with the chi-square, Kolmogorov-Smirnov, and Anderson-Darling tests
+of the `LR_gof` object.  Unlike the CUnit suite this uses the real
+uniform generators, so it can catch subtle biases in a sampler.
+
+A combination fails if any of its p-values is below the
+significance level \e alpha .  The results are written as JSON
+with the runtime of each combination, and a summary to stdout.
+
+	LRvalidate [-n samples] [-t threads] [-s seed] [-a alpha] [-f]
+		[-o report] [type ...]
+
+With no types given all are validated.  With \e -f the samplers use
+fast math mode (see \c LR_fast()) but the reference CDFs don't, which
+tests the approximations at the full sample size.  The exit status is
+the number of failed combinations (at most 255).
+
+\code
+make validate
+make validate VALIDATE_N=1000000000 VALIDATE_REPORT=big.json
+make validate VALIDATE_N=1000000000 VALIDATE_FLAGS="-f gausbm cauchy nexp"
+\endcode
+*/
+/*
+ * Copyright	2019	R.K. Owen, Ph.D.
+ * License	see lgpl.md (Gnu Lesser General Public License)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>	/* getopt,sysconf */
+#include "libran.h"
+#include "LRharness.h"
+
+static void usage(const char *prog) {
+	fprintf(stderr, "usage: %s [-n samples] [-t threads] [-s seed] "
+		"[-a alpha] [-f] [-o report] [type ...]\n", prog);
+	exit(255);
+}
+
+int main(int argc, char **argv) {
+	long	n = 100000000l, seed = 19580512l;
+	int	nthreads = (int) sysconf(_SC_NPROCESSORS_ONLN), nfail = 0, opt,
+		first = 1, fast = 0;
+	double	alpha = 1e-5, t0 = now();
+	char	*report = "validate.json";
+	FILE	*fp;
+
+	while ((opt = getopt(argc, argv, "n:t:s:a:fo:h")) != -1) {
+		switch (opt) {
+		case 'n': n = (long) atof(optarg); break;
+		case 't': nthreads = atoi(optarg); break;
+		case 's': seed = atol(optarg); break;
+		case 'a': alpha = atof(optarg); break;
+		case 'f': fast = 1; break;
+		case 'o': report = optarg; break;
+		default: usage(argv[0]);
+		}
+	}
+	if (n < 1000 || nthreads < 1 || !(alpha > 0.0))
+		usage(argv[0]);
+	if (!(fp = fopen(report, "w"))) {
+		perror(report);
+		return 255;
+	}
+
+	fprintf(fp, "{\n  \"libran\": \"%s\",\n  \"samples\": %ld,\n"
+		"  \"threads\": %d,\n  \"seed\": %ld,\n  \"alpha\": %g,\n"
+		"  \"fast\": %s,\n  \"results\": [", LRversion("version"), n,
+		nthreads, seed, alpha, (fast ? "true" : "false"));
+	printf("%-10s %-6s %11s %8s %10s %10s %10s %10s\n", "type", "data",
+		"samples", "seconds", "ns/sample", "p(chisq)", "p(KS)", "p(AD)");
+
+	for (int i = 0; i < NCASES; i++) {
+		vcase	*c = &cases[i];
+		LR_obj	*o, *ref;
+		LR_spec	*s = NULL;
+		LR_gof	*g = NULL;
+		long	nc = n / c->div;
+		double	t, chi2 = NAN, pc = NAN, pk = NAN, pa = NAN;
+		int	df = 0, err, pass;
+
+		if (!wanted(c, argc - optind, argv + optind))
+			continue;
+		if (!(o = make(c)) || !(ref = make(c))) {
+			fprintf(stderr, "%s: can't create case %d\n", argv[0], i);
+			LR_rm(&o);
+			nfail++;
+			continue;
+		}
+		(void) LR_fast(o, fast);
+		(void) LR_fast(ref, 0);
+		t = now();
+		if ((err = LR_check(ref))) {
+			;
+		} else if (!(g = LR_gof_new(ref, 1000, 0))
+		|| !(s = LR_spec_new(&o))) {
+			err = (g ? o->errno : ref->errno);
+			err = (err ? err : LRerr_Unspecified);
+		} else if (!(err = LR_gof_spec(g, s, nc, nthreads,
+			seed + 2l * nthreads * i))
+		&& !(err = LR_gof_flush(g))) {
+			pc = LR_gof_pchisq(g, &chi2, &df);
+			pk = LR_gof_pks(g);
+			pa = LR_gof_pad(g);
+		}
+		t = now() - t;
+		pass = (!err && pc >= alpha && !(pk < alpha) && !(pa < alpha));
+		nfail += !pass;
+
+		fprintf(fp, "%s\n    {\"type\": \"%s\", \"data\": \"%s\", "
+			"\"samples\": %ld, \"seconds\": %.3f, \"ns_per_sample\": ",
+			(first ? "" : ","), ref->ops->type, dname(c->d), nc, t);
+		jnum(fp, 1e9 * t / nc);
+		fprintf(fp, ", \"chisq\": ");
+		jnum(fp, chi2);
+		fprintf(fp, ", \"df\": %d, \"p_chisq\": ", df);
+		jnum(fp, pc);
+		fprintf(fp, ", \"batches\": %d, \"p_ks\": ", (g ? g->nb : 0));
+		jnum(fp, pk);
+		fprintf(fp, ", \"p_ad\": ");
+		jnum(fp, pa);
+		fprintf(fp, ", \"error\": \"%s\", \"pass\": %s}",
+			(err ? LRstrerrno(err) : ""), (pass ? "true" : "false"));
+		first = 0;
+
+		printf("%-10s %-6s %11ld %8.2f %10.1f %10.3g %10.3g %10.3g %s\n",
+			ref->ops->type, dname(c->d), nc, t, 1e9 * t / nc,
+			pc, pk, pa, (pass ? "ok" : (err ? LRstrerror(err)
+			: "FAIL")));
+		fflush(stdout);
+
+		LR_gof_rm(&g);
+		if (s)
+			LR_spec_rm(&s);
+		else
+			LR_rm(&o);
+		LR_rm(&ref);
+	}
+
+	t0 = now() - t0;
+	fprintf(fp, "\n  ],\n  \"seconds\": %.3f,\n  \"failures\": %d\n}\n",
+		t0, nfail);
+	fclose(fp);
+	printf("%d failed, %.1f seconds, report in %s\n", nfail, t0, report);
+	return (nfail > 255 ? 255 : nfail);
+}